@@ -0,0 +1,139 @@
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "execution/sql/operators/like_operators.h"
+#include "storage/storage_defs.h"
+
+namespace noisepage {
+
+/**
+ * Benchmarks LIKE over a column of VarlenEntrys, for every shape of pattern that has a specialized kernel. The General
+ * benchmarks run the same patterns through the general matcher, for comparison.
+ */
+class LikeBenchmark : public benchmark::Fixture {
+ public:
+  void SetUp(const benchmark::State &state) final {
+    // Comment-like strings in the style of TPC-H, some of which contain the words that the patterns look for.
+    const std::vector<std::string> words = {"carefully", "final", "deposits", "sleep", "furiously", "ironic",
+                                            "packages",  "haggle", "special",  "quickly", "requests", "blithely"};
+    std::mt19937 rng(0);
+    strings_.reserve(NUM_STRINGS);
+    for (uint32_t i = 0; i < NUM_STRINGS; i++) {
+      std::string s;
+      const uint32_t num_words = 3 + rng() % 12;
+      for (uint32_t w = 0; w < num_words; w++) {
+        s += (w == 0 ? "" : " ") + words[rng() % words.size()];
+      }
+      strings_.emplace_back(std::move(s));
+    }
+    column_.reserve(NUM_STRINGS);
+    for (const auto &s : strings_) {
+      column_.emplace_back(storage::VarlenEntry::Create(s));
+    }
+  }
+
+  void TearDown(const benchmark::State &state) final {
+    column_.clear();
+    strings_.clear();
+  }
+
+ protected:
+  // Count the matches of the pattern in the column with an analyzed pattern.
+  uint32_t CountAnalyzed(const std::string &pattern) const {
+    const execution::sql::LikePattern like_pattern(pattern.data(), pattern.size());
+    uint32_t count = 0;
+    for (const auto &str : column_) {
+      count += static_cast<uint32_t>(like_pattern.Matches(str));
+    }
+    return count;
+  }
+
+  // Count the matches of the pattern in the column with the general matcher.
+  uint32_t CountGeneral(const std::string &pattern) const {
+    uint32_t count = 0;
+    for (const auto &str : column_) {
+      count += static_cast<uint32_t>(execution::sql::Like::Impl(reinterpret_cast<const char *>(str.Content()),
+                                                                 str.Size(), pattern.data(), pattern.size()));
+    }
+    return count;
+  }
+
+  static constexpr uint32_t NUM_STRINGS = 100000;
+
+  static constexpr const char *PREFIX_PATTERN = "final%";
+  static constexpr const char *SUFFIX_PATTERN = "%requests";
+  static constexpr const char *CONTAINS_PATTERN = "%special%";
+
+  std::vector<std::string> strings_;
+  std::vector<storage::VarlenEntry> column_;
+};
+
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(LikeBenchmark, Prefix)(benchmark::State &state) {
+  // NOLINTNEXTLINE
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(CountAnalyzed(PREFIX_PATTERN));
+  }
+  state.SetItemsProcessed(state.iterations() * NUM_STRINGS);
+}
+
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(LikeBenchmark, Suffix)(benchmark::State &state) {
+  // NOLINTNEXTLINE
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(CountAnalyzed(SUFFIX_PATTERN));
+  }
+  state.SetItemsProcessed(state.iterations() * NUM_STRINGS);
+}
+
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(LikeBenchmark, Contains)(benchmark::State &state) {
+  // NOLINTNEXTLINE
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(CountAnalyzed(CONTAINS_PATTERN));
+  }
+  state.SetItemsProcessed(state.iterations() * NUM_STRINGS);
+}
+
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(LikeBenchmark, GeneralPrefix)(benchmark::State &state) {
+  // NOLINTNEXTLINE
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(CountGeneral(PREFIX_PATTERN));
+  }
+  state.SetItemsProcessed(state.iterations() * NUM_STRINGS);
+}
+
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(LikeBenchmark, GeneralSuffix)(benchmark::State &state) {
+  // NOLINTNEXTLINE
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(CountGeneral(SUFFIX_PATTERN));
+  }
+  state.SetItemsProcessed(state.iterations() * NUM_STRINGS);
+}
+
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(LikeBenchmark, GeneralContains)(benchmark::State &state) {
+  // NOLINTNEXTLINE
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(CountGeneral(CONTAINS_PATTERN));
+  }
+  state.SetItemsProcessed(state.iterations() * NUM_STRINGS);
+}
+
+// ----------------------------------------------------------------------------
+// BENCHMARK REGISTRATION
+// ----------------------------------------------------------------------------
+// clang-format off
+BENCHMARK_REGISTER_F(LikeBenchmark, Prefix)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(LikeBenchmark, Suffix)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(LikeBenchmark, Contains)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(LikeBenchmark, GeneralPrefix)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(LikeBenchmark, GeneralSuffix)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(LikeBenchmark, GeneralContains)->Unit(benchmark::kMillisecond);
+// clang-format on
+
+}  // namespace noisepage
@@ -1,9 +1,15 @@
+#include <string>
+#include <thread>  // NOLINT
+
 #include "benchmark/benchmark.h"
 #include "benchmark_util/benchmark_config.h"
 #include "common/dedicated_thread_registry.h"
+#include "common/container/concurrent_blocking_queue.h"
 #include "common/scoped_timer.h"
 #include "replication/replication_messages.h"
+#include "storage/recovery/replication_log_provider.h"
 #include "storage/write_ahead_log/log_io.h"
+#include "storage/write_ahead_log/log_record.h"
 
 namespace noisepage {
 
@@ -17,6 +23,28 @@ class ReplicationMessagesBenchmark : public benchmark::Fixture {
     }
   }
   char RandomChar() { return static_cast<char>(std::rand() % (CHAR_MAX - CHAR_MIN + 1) + CHAR_MIN); }
+
+  /** Fill the buffer with serialized commit records of consecutive transactions, as the log serializer would. */
+  void FillBufferWithCommits(storage::BufferedLogWriter *buffer, uint64_t *next_txn) {
+    const uint32_t size = storage::CommitRecord::Size();
+    const auto type = storage::LogRecordType::COMMIT;
+    for (uint64_t i = 0; i < COMMITS_PER_BATCH; i++) {
+      const transaction::timestamp_t txn_begin{(*next_txn)++};
+      const transaction::timestamp_t commit_time{(*next_txn)++};
+      buffer->BufferWrite(&size, sizeof(size));
+      buffer->BufferWrite(&type, sizeof(type));
+      buffer->BufferWrite(&txn_begin, sizeof(txn_begin));
+      buffer->BufferWrite(&commit_time, sizeof(commit_time));
+      buffer->BufferWrite(&txn_begin, sizeof(txn_begin));
+    }
+  }
+
+  static constexpr uint64_t NUM_BATCHES = 10000;
+  /** Size of a serialized commit record: size, type, txn begin, commit time, and oldest active txn. */
+  static constexpr uint64_t SERIALIZED_COMMIT_SIZE =
+      sizeof(uint32_t) + sizeof(storage::LogRecordType) + 3 * sizeof(transaction::timestamp_t);
+  /** Number of whole commit records that fit into a batch. */
+  static constexpr uint64_t COMMITS_PER_BATCH = common::Constants::LOG_BUFFER_SIZE / SERIALIZED_COMMIT_SIZE;
 };
 
 // Serialize
@@ -136,6 +164,56 @@ BENCHMARK_DEFINE_F(ReplicationMessagesBenchmark, TxnAppliedMsgDeserialization)(b
   state.SetItemsProcessed(state.iterations());
 }
 
+// End-to-end
+
+/**
+ * Ship batches of log records from a primary thread to an in-process replica thread and read them back as log records,
+ * i.e., everything that replication does except for the network and applying the records. Reports the rate at which
+ * uncompressed log records get through, with and without compression.
+ */
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(ReplicationMessagesBenchmark, LogShipping)(benchmark::State &state) {
+  const bool compress = state.range(0) != 0;
+
+  // NOLINTNEXTLINE
+  for (auto _ : state) {
+    storage::ReplicationLogProvider provider;
+    common::ConcurrentBlockingQueue<std::string> wire;
+    uint64_t elapsed_ms;
+    {
+      common::ScopedTimer<std::chrono::milliseconds> timer(&elapsed_ms);
+      std::thread primary([&] {
+        uint64_t next_txn = 1;
+        for (uint64_t batch_id = 1; batch_id <= NUM_BATCHES; batch_id++) {
+          storage::BufferedLogWriter buffer;
+          FillBufferWithCommits(&buffer, &next_txn);
+          replication::RecordsBatchMsg msg(replication::ReplicationMessageMetadata(replication::msg_id_t(batch_id)),
+                                           replication::record_batch_id_t(batch_id), &buffer, compress);
+          wire.Enqueue(msg.Serialize());
+        }
+      });
+      std::thread replica([&] {
+        for (uint64_t i = 0; i < NUM_BATCHES; i++) {
+          std::string serialized;
+          wire.Dequeue(&serialized);
+          auto msg = replication::BaseReplicationMessage::ParseFromString(serialized);
+          provider.AddBatchOfRecords(std::move(*static_cast<replication::RecordsBatchMsg *>(msg.get())));
+        }
+      });
+
+      for (uint64_t i = 0; i < NUM_BATCHES * COMMITS_PER_BATCH; i++) {
+        auto record = provider.GetNextRecord();
+        delete[] reinterpret_cast<byte *>(record.first);
+      }
+      primary.join();
+      replica.join();
+    }
+    provider.EndReplication();
+    state.SetIterationTime(static_cast<double>(elapsed_ms) / 1000.0);
+  }
+  state.SetBytesProcessed(state.iterations() * NUM_BATCHES * COMMITS_PER_BATCH * SERIALIZED_COMMIT_SIZE);
+}
+
 // ----------------------------------------------------------------------------
 // BENCHMARK REGISTRATION
 // ----------------------------------------------------------------------------
@@ -146,6 +224,11 @@ BENCHMARK_REGISTER_F(ReplicationMessagesBenchmark, TxnAppliedMsgSerialization)->
 BENCHMARK_REGISTER_F(ReplicationMessagesBenchmark, NotifyOATMsgDeserialization)->Unit(benchmark::kNanosecond);
 BENCHMARK_REGISTER_F(ReplicationMessagesBenchmark, RecordsBatchMsgDeserialization)->Unit(benchmark::kNanosecond);
 BENCHMARK_REGISTER_F(ReplicationMessagesBenchmark, TxnAppliedMsgDeserialization)->Unit(benchmark::kNanosecond);
+BENCHMARK_REGISTER_F(ReplicationMessagesBenchmark, LogShipping)
+    ->Unit(benchmark::kMillisecond)
+    ->UseManualTime()
+    ->ArgName("compress")
+    ->DenseRange(0, 1);
 // clang-format on
 
 }  // namespace noisepage
@@ -1,3 +1,4 @@
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -6,6 +7,7 @@
 #include "common/scoped_timer.h"
 #include "storage/index/bplustree.h"
 #include "storage/storage_defs.h"
+#include "test_util/bwtree_test_util.h"
 #include "test_util/multithread_test_util.h"
 
 namespace noisepage {
@@ -22,6 +24,44 @@ class BPlusTreeBenchmark : public benchmark::Fixture {
 
   void TearDown(const benchmark::State &state) final {}
 
+  /**
+   * Look up every key once, in random order, spread over the given number of threads.
+   * @param state benchmark state, whose only argument is the number of threads
+   * @param lookup looks up a key
+   * @param thread_init called by every thread before its first lookup, with the id of the thread
+   */
+  template <typename Lookup>
+  void RunLookups(benchmark::State *state, Lookup lookup,
+                  std::function<void(uint32_t)> thread_init = [](uint32_t) {}) {
+    const auto num_threads = static_cast<uint32_t>(state->range(0));
+    common::WorkerPool thread_pool(num_threads, {});
+    thread_pool.Startup();
+
+    // NOLINTNEXTLINE
+    for (auto _ : *state) {
+      auto workload = [&](uint32_t id) {
+        thread_init(id);
+        uint32_t start_key = num_keys_ / num_threads * id;
+        uint32_t end_key = start_key + num_keys_ / num_threads;
+
+        std::vector<int64_t> values;
+        values.reserve(1);
+        for (uint32_t i = start_key; i < end_key; i++) {
+          lookup(key_permutation_[i], &values);
+          values.clear();
+        }
+      };
+
+      uint64_t elapsed_ms;
+      {
+        common::ScopedTimer<std::chrono::milliseconds> timer(&elapsed_ms);
+        MultiThreadTestUtil::RunThreadsUntilFinish(&thread_pool, num_threads, workload);
+      }
+      state->SetIterationTime(static_cast<double>(elapsed_ms) / 1000.0);
+    }
+    state->SetItemsProcessed(state->iterations() * num_keys_);
+  }
+
   // Workload
   const uint32_t num_keys_ = 10000000;
 
@@ -262,6 +302,50 @@ BENCHMARK_DEFINE_F(BPlusTreeBenchmark, SequentialInsertSequentialRead)(benchmark
   }
 }
 
+// Point lookups that read versions instead of latching nodes, i.e., the lookup path of the B+ tree.
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(BPlusTreeBenchmark, OptimisticLookup)(benchmark::State &state) {
+  auto tree = std::make_unique<storage::index::BPlusTree<int64_t, int64_t>>();
+  for (uint32_t i = 0; i < num_keys_; i++) {
+    tree->Insert(tree->GetElement(key_permutation_[i], key_permutation_[i]), predicate_);
+  }
+
+  RunLookups(&state, [&](const int64_t key, std::vector<int64_t> *values) { tree->FindValueOfKey(key, values); });
+}
+
+// Point lookups that crab shared latches from the root down to the leaf node, which is how iterators find their leaf.
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(BPlusTreeBenchmark, LatchCrabbingLookup)(benchmark::State &state) {
+  auto tree = std::make_unique<storage::index::BPlusTree<int64_t, int64_t>>();
+  for (uint32_t i = 0; i < num_keys_; i++) {
+    tree->Insert(tree->GetElement(key_permutation_[i], key_permutation_[i]), predicate_);
+  }
+
+  RunLookups(&state, [&](const int64_t key, std::vector<int64_t> *values) {
+    auto iterator = tree->Begin(key);
+    if (iterator != tree->End() && iterator != tree->Retry() && iterator.Key() == key) {
+      values->push_back(iterator.Value());
+    }
+  });
+}
+
+// The same point lookups on the BwTree, for comparison.
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(BPlusTreeBenchmark, BwTreeLookup)(benchmark::State &state) {
+  auto *const tree = BwTreeTestUtil::GetEmptyTree();
+  for (uint32_t i = 0; i < num_keys_; i++) {
+    tree->Insert(key_permutation_[i], key_permutation_[i]);
+  }
+
+  tree->UpdateThreadLocal(state.range(0) + 1);
+  RunLookups(
+      &state, [&](const int64_t key, std::vector<int64_t> *values) { tree->GetValue(key, *values); },
+      [&](const uint32_t id) { tree->AssignGCID(static_cast<int>(id) + 1); });
+  tree->UpdateThreadLocal(1);
+
+  delete tree;
+}
+
 // ----------------------------------------------------------------------------
 // BENCHMARK REGISTRATION
 // ----------------------------------------------------------------------------
@@ -290,6 +374,27 @@ BENCHMARK_REGISTER_F(BPlusTreeBenchmark, SequentialInsertSequentialRead)
     ->Unit(benchmark::kMillisecond)
     ->UseManualTime()
     ->MinTime(3);
+BENCHMARK_REGISTER_F(BPlusTreeBenchmark, OptimisticLookup)
+    ->ArgName("threads")
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->Unit(benchmark::kMillisecond)
+    ->UseManualTime()
+    ->MinTime(3);
+BENCHMARK_REGISTER_F(BPlusTreeBenchmark, LatchCrabbingLookup)
+    ->ArgName("threads")
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->Unit(benchmark::kMillisecond)
+    ->UseManualTime()
+    ->MinTime(3);
+BENCHMARK_REGISTER_F(BPlusTreeBenchmark, BwTreeLookup)
+    ->ArgName("threads")
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->Unit(benchmark::kMillisecond)
+    ->UseManualTime()
+    ->MinTime(3);
 // clang-format on
 
 }  // namespace noisepage
@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "benchmark/benchmark.h"
@@ -9,6 +11,7 @@
 #include "storage/index/index_builder.h"
 #include "storage/projected_row.h"
 #include "storage/sql_table.h"
+#include "storage/storage_util.h"
 #include "test_util/catalog_test_util.h"
 #include "test_util/multithread_test_util.h"
 #include "transaction/deferred_action_manager.h"
@@ -41,6 +44,9 @@ class IndexBenchmark : public benchmark::Fixture {
   // Table size chosen to exceed L3 cache size on benchmark machine
   const uint32_t table_size_ = 100000000;
 
+  // Number of keys of the index builds, which are repeated and thus use a smaller table
+  const uint32_t build_size_ = 10000000;
+
   // SqlTable
   storage::SqlTable *sql_table_;
   storage::ProjectedRowInitializer tuple_initializer_ =
@@ -138,6 +144,51 @@ class IndexBenchmark : public benchmark::Fixture {
     txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
   }
 
+  // Table is populated with keys in random order, as CREATE INDEX usually finds them. Returns the key of every tuple.
+  std::vector<std::pair<int32_t, storage::TupleSlot>> PopulateTable(const uint32_t num_tuples) {
+    std::vector<int32_t> keys(num_tuples);
+    for (uint32_t i = 0; i < num_tuples; i++) keys[i] = static_cast<int32_t>(i);
+    std::shuffle(keys.begin(), keys.end(), generator_);
+
+    std::vector<std::pair<int32_t, storage::TupleSlot>> tuples;
+    tuples.reserve(num_tuples);
+    auto *const insert_txn = txn_manager_->BeginTransaction();
+    for (const int32_t key : keys) {
+      auto *const insert_redo =
+          insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+      *reinterpret_cast<int32_t *>(insert_redo->Delta()->AccessForceNotNull(0)) = key;
+      tuples.emplace_back(key, sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo));
+    }
+    txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+    return tuples;
+  }
+
+  // Build a new index of the same type as index_ from the given tuples, either by inserting the keys one at a time or
+  // by staging them for a bulk load. Only the index build is timed.
+  uint64_t RunIndexBuild(const std::vector<std::pair<int32_t, storage::TupleSlot>> &tuples, const bool bulk_load) {
+    std::unique_ptr<storage::index::Index> index((storage::index::IndexBuilder().SetKeySchema(index_schema_)).Build());
+    auto *const insert_key = index->GetProjectedRowInitializer().InitializeRow(key_buffer_);
+    auto *const insert_txn = txn_manager_->BeginTransaction();
+    uint64_t elapsed_ns = 0;
+    {
+      common::ScopedTimer<std::chrono::nanoseconds> timer(&elapsed_ns);
+      for (const auto &[key, slot] : tuples) {
+        *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = key;
+        if (bulk_load) {
+          index->StageForBulkLoad(common::ManagedPointer(insert_txn), *insert_key, slot);
+        } else {
+          index->Insert(common::ManagedPointer(insert_txn), *insert_key, slot);
+        }
+      }
+      if (bulk_load) {
+        index->BulkLoad(common::ManagedPointer(insert_txn), storage::index::BULK_LOAD_FILL_FACTOR);
+      }
+    }
+    EXPECT_EQ(index->GetSize(), tuples.size());
+    txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+    return elapsed_ns;
+  }
+
   // Do a random lookup of a subset of keys in the domain; scoped timer only times ScanKey operation
   // and will accumulate into a value for the total amount of time required
   uint64_t RunWorkload() {
@@ -166,6 +217,40 @@ class IndexBenchmark : public benchmark::Fixture {
     txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
     return total_ns;
   }
+
+  // Same as RunWorkload(), but looks up batches of random keys with ScanKeyBatch
+  uint64_t RunBatchWorkload(const uint32_t batch_size) {
+    auto *scan_txn = txn_manager_->BeginTransaction();
+    const auto &initializer = index_->GetProjectedRowInitializer();
+    const uint32_t key_size = storage::StorageUtil::PadUpToSize(sizeof(uint64_t), initializer.ProjectedRowSize());
+    byte *const batch_key_buffer = common::AllocationUtil::AllocateAligned(key_size * batch_size);
+    std::vector<const storage::ProjectedRow *> scan_keys;
+    for (uint32_t i = 0; i < batch_size; i++) {
+      scan_keys.push_back(initializer.InitializeRow(batch_key_buffer + i * key_size));
+    }
+    uint64_t total_ns = 0;
+    uint64_t elapsed_ns = 0;
+
+    std::vector<std::vector<storage::TupleSlot>> results;
+    for (uint32_t i = 0; i < table_size_; i += batch_size) {
+      for (uint32_t j = 0; j < batch_size; j++) {
+        const uint32_t random_key =
+            std::uniform_int_distribution(static_cast<uint32_t>(0), static_cast<uint32_t>(table_size_ - 1))(generator_);
+        auto *const scan_key = reinterpret_cast<storage::ProjectedRow *>(batch_key_buffer + j * key_size);
+        *reinterpret_cast<uint32_t *>(scan_key->AccessForceNotNull(0)) = random_key;
+      }
+      {
+        common::ScopedTimer<std::chrono::nanoseconds> timer(&elapsed_ns);
+        index_->ScanKeyBatch(*scan_txn, scan_keys, &results);
+      }
+      for (const auto &result : results) EXPECT_EQ(result.size(), 1);
+      total_ns += elapsed_ns;
+    }
+
+    delete[] batch_key_buffer;
+    txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+    return total_ns;
+  }
 };
 
 // Determine required time to run key lookup with BplusTree structure for index
@@ -184,6 +269,47 @@ BENCHMARK_DEFINE_F(IndexBenchmark, BPlusTreeIndexRandomScanKey)(benchmark::State
   state.SetItemsProcessed(state.iterations() * table_size_);
 }
 
+// Determine required time to run key lookup with Adaptive Radix Tree structure for index
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(IndexBenchmark, ARTIndexRandomScanKey)(benchmark::State &state) {
+  CreateIndex(storage::index::IndexType::ART);
+  PopulateTableAndIndex();
+  // NOLINTNEXTLINE
+  for (auto _ : state) {
+    // Run key lookup and record amount of time required in seconds
+    const auto total_ns = RunWorkload();
+    state.SetIterationTime(static_cast<double>(total_ns) / 1000000000.0);
+  }
+  // Determine total number of items processed
+  state.SetItemsProcessed(state.iterations() * table_size_);
+}
+
+// Determine required time to run batched key lookups with BplusTree structure for index
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(IndexBenchmark, BPlusTreeIndexRandomScanKeyBatch)(benchmark::State &state) {
+  CreateIndex(storage::index::IndexType::BPLUSTREE);
+  PopulateTableAndIndex();
+  // NOLINTNEXTLINE
+  for (auto _ : state) {
+    const auto total_ns = RunBatchWorkload(state.range(0));
+    state.SetIterationTime(static_cast<double>(total_ns) / 1000000000.0);
+  }
+  state.SetItemsProcessed(state.iterations() * table_size_);
+}
+
+// Determine required time to run batched key lookups with Adaptive Radix Tree structure for index
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(IndexBenchmark, ARTIndexRandomScanKeyBatch)(benchmark::State &state) {
+  CreateIndex(storage::index::IndexType::ART);
+  PopulateTableAndIndex();
+  // NOLINTNEXTLINE
+  for (auto _ : state) {
+    const auto total_ns = RunBatchWorkload(state.range(0));
+    state.SetIterationTime(static_cast<double>(total_ns) / 1000000000.0);
+  }
+  state.SetItemsProcessed(state.iterations() * table_size_);
+}
+
 // Determine required time to run key lookup with HashMap structure for index
 // NOLINTNEXTLINE
 BENCHMARK_DEFINE_F(IndexBenchmark, HashIndexRandomScanKey)(benchmark::State &state) {
@@ -199,6 +325,32 @@ BENCHMARK_DEFINE_F(IndexBenchmark, HashIndexRandomScanKey)(benchmark::State &sta
   state.SetItemsProcessed(state.iterations() * table_size_);
 }
 
+// Determine required time to build a BPlusTree index on an existing table, by inserting (0) or bulk loading (1) the keys
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(IndexBenchmark, BPlusTreeIndexBuild)(benchmark::State &state) {
+  CreateIndex(storage::index::IndexType::BPLUSTREE);
+  const auto tuples = PopulateTable(build_size_);
+  // NOLINTNEXTLINE
+  for (auto _ : state) {
+    const auto total_ns = RunIndexBuild(tuples, state.range(0) != 0);
+    state.SetIterationTime(static_cast<double>(total_ns) / 1000000000.0);
+  }
+  state.SetItemsProcessed(state.iterations() * build_size_);
+}
+
+// Determine required time to build a BwTree index on an existing table, by inserting (0) or bulk loading (1) the keys
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(IndexBenchmark, BwTreeIndexBuild)(benchmark::State &state) {
+  CreateIndex(storage::index::IndexType::BWTREE);
+  const auto tuples = PopulateTable(build_size_);
+  // NOLINTNEXTLINE
+  for (auto _ : state) {
+    const auto total_ns = RunIndexBuild(tuples, state.range(0) != 0);
+    state.SetIterationTime(static_cast<double>(total_ns) / 1000000000.0);
+  }
+  state.SetItemsProcessed(state.iterations() * build_size_);
+}
+
 // ----------------------------------------------------------------------------
 // BENCHMARK REGISTRATION
 // ----------------------------------------------------------------------------
@@ -206,9 +358,34 @@ BENCHMARK_DEFINE_F(IndexBenchmark, HashIndexRandomScanKey)(benchmark::State &sta
 BENCHMARK_REGISTER_F(IndexBenchmark, BPlusTreeIndexRandomScanKey)
     ->UseManualTime()
     ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(IndexBenchmark, ARTIndexRandomScanKey)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(IndexBenchmark, BPlusTreeIndexRandomScanKeyBatch)
+    ->ArgName("batch_size")
+    ->Arg(16)
+    ->Arg(256)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(IndexBenchmark, ARTIndexRandomScanKeyBatch)
+    ->ArgName("batch_size")
+    ->Arg(16)
+    ->Arg(256)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
 BENCHMARK_REGISTER_F(IndexBenchmark, HashIndexRandomScanKey)
     ->UseManualTime()
     ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(IndexBenchmark, BPlusTreeIndexBuild)
+    ->ArgName("bulk_load")
+    ->DenseRange(0, 1)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(IndexBenchmark, BwTreeIndexBuild)
+    ->ArgName("bulk_load")
+    ->DenseRange(0, 1)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
 // clang-format on
 
 }  // namespace noisepage
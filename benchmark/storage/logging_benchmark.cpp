@@ -33,10 +33,23 @@ class LoggingBenchmark : public benchmark::Fixture {
   const std::chrono::microseconds log_serialization_interval_{100};
   const std::chrono::microseconds log_persist_interval_{100};
   const uint64_t log_persist_threshold_ = (1U << 20U);  // 1MB
+
+  /** Create and start a log manager that writes the log file with the given I/O interface. */
+  storage::LogManager *StartLogManager(const storage::LogIoBackend io_backend) {
+    auto *log_manager =
+        new storage::LogManager(noisepage::BenchmarkConfig::logfile_path.data(), num_log_buffers_,
+                                log_serialization_interval_, log_persist_interval_, log_persist_threshold_,
+                                common::ManagedPointer(&buffer_pool_), common::ManagedPointer(&empty_buffer_queue_),
+                                DISABLED, common::ManagedPointer<common::DedicatedThreadRegistry>(&thread_registry_),
+                                0 /* segment_size */, io_backend);
+    log_manager->Start();
+    return log_manager;
+  }
 };
 
 /**
  * Run a TPCC-like workload (5 statements per txn, 10% insert, 40% update, 50% select).
+ * The argument selects the LogIoBackend, to compare blocking writes with io_uring with and without O_DIRECT.
  */
 // NOLINTNEXTLINE
 BENCHMARK_DEFINE_F(LoggingBenchmark, TPCCish)(benchmark::State &state) {
@@ -46,12 +59,7 @@ BENCHMARK_DEFINE_F(LoggingBenchmark, TPCCish)(benchmark::State &state) {
   // NOLINTNEXTLINE
   for (auto _ : state) {
     unlink(noisepage::BenchmarkConfig::logfile_path.data());
-    log_manager_ =
-        new storage::LogManager(noisepage::BenchmarkConfig::logfile_path.data(), num_log_buffers_,
-                                log_serialization_interval_, log_persist_interval_, log_persist_threshold_,
-                                common::ManagedPointer(&buffer_pool_), common::ManagedPointer(&empty_buffer_queue_),
-                                DISABLED, common::ManagedPointer<common::DedicatedThreadRegistry>(&thread_registry_));
-    log_manager_->Start();
+    log_manager_ = StartLogManager(static_cast<storage::LogIoBackend>(state.range(0)));
     LargeDataTableBenchmarkObject tested(attr_sizes_, initial_table_size_, txn_length, insert_update_select_ratio,
                                          &block_store_, &buffer_pool_, &generator_, true, log_manager_);
     // log all of the Inserts from table creation
@@ -89,12 +97,7 @@ BENCHMARK_DEFINE_F(LoggingBenchmark, HighAbortRate)(benchmark::State &state) {
   for (auto _ : state) {
     unlink(noisepage::BenchmarkConfig::logfile_path.data());
     // use a smaller table to make aborts more likely
-    log_manager_ =
-        new storage::LogManager(noisepage::BenchmarkConfig::logfile_path.data(), num_log_buffers_,
-                                log_serialization_interval_, log_persist_interval_, log_persist_threshold_,
-                                common::ManagedPointer(&buffer_pool_), common::ManagedPointer(&empty_buffer_queue_),
-                                DISABLED, common::ManagedPointer<common::DedicatedThreadRegistry>(&thread_registry_));
-    log_manager_->Start();
+    log_manager_ = StartLogManager(storage::LogIoBackend::POSIX);
     LargeDataTableBenchmarkObject tested(attr_sizes_, 1000, txn_length, insert_update_select_ratio, &block_store_,
                                          &buffer_pool_, &generator_, true, log_manager_);
     // log all of the Inserts from table creation
@@ -122,6 +125,7 @@ BENCHMARK_DEFINE_F(LoggingBenchmark, HighAbortRate)(benchmark::State &state) {
 
 /**
  * Single statement insert throughput. Should have no aborts.
+ * The argument selects the LogIoBackend, see TPCCish.
  */
 // NOLINTNEXTLINE
 BENCHMARK_DEFINE_F(LoggingBenchmark, SingleStatementInsert)(benchmark::State &state) {
@@ -131,12 +135,7 @@ BENCHMARK_DEFINE_F(LoggingBenchmark, SingleStatementInsert)(benchmark::State &st
   // NOLINTNEXTLINE
   for (auto _ : state) {
     unlink(noisepage::BenchmarkConfig::logfile_path.data());
-    log_manager_ =
-        new storage::LogManager(noisepage::BenchmarkConfig::logfile_path.data(), num_log_buffers_,
-                                log_serialization_interval_, log_persist_interval_, log_persist_threshold_,
-                                common::ManagedPointer(&buffer_pool_), common::ManagedPointer(&empty_buffer_queue_),
-                                DISABLED, common::ManagedPointer<common::DedicatedThreadRegistry>(&thread_registry_));
-    log_manager_->Start();
+    log_manager_ = StartLogManager(static_cast<storage::LogIoBackend>(state.range(0)));
     LargeDataTableBenchmarkObject tested(attr_sizes_, 0, txn_length, insert_update_select_ratio, &block_store_,
                                          &buffer_pool_, &generator_, true, log_manager_);
     // log all of the Inserts from table creation
@@ -173,12 +172,7 @@ BENCHMARK_DEFINE_F(LoggingBenchmark, SingleStatementUpdate)(benchmark::State &st
   // NOLINTNEXTLINE
   for (auto _ : state) {
     unlink(noisepage::BenchmarkConfig::logfile_path.data());
-    log_manager_ =
-        new storage::LogManager(noisepage::BenchmarkConfig::logfile_path.data(), num_log_buffers_,
-                                log_serialization_interval_, log_persist_interval_, log_persist_threshold_,
-                                common::ManagedPointer(&buffer_pool_), common::ManagedPointer(&empty_buffer_queue_),
-                                DISABLED, common::ManagedPointer<common::DedicatedThreadRegistry>(&thread_registry_));
-    log_manager_->Start();
+    log_manager_ = StartLogManager(storage::LogIoBackend::POSIX);
     LargeDataTableBenchmarkObject tested(attr_sizes_, initial_table_size_, txn_length, insert_update_select_ratio,
                                          &block_store_, &buffer_pool_, &generator_, true, log_manager_);
     // log all of the Inserts from table creation
@@ -215,12 +209,7 @@ BENCHMARK_DEFINE_F(LoggingBenchmark, SingleStatementSelect)(benchmark::State &st
   // NOLINTNEXTLINE
   for (auto _ : state) {
     unlink(noisepage::BenchmarkConfig::logfile_path.data());
-    log_manager_ =
-        new storage::LogManager(noisepage::BenchmarkConfig::logfile_path.data(), num_log_buffers_,
-                                log_serialization_interval_, log_persist_interval_, log_persist_threshold_,
-                                common::ManagedPointer(&buffer_pool_), common::ManagedPointer(&empty_buffer_queue_),
-                                DISABLED, common::ManagedPointer<common::DedicatedThreadRegistry>(&thread_registry_));
-    log_manager_->Start();
+    log_manager_ = StartLogManager(storage::LogIoBackend::POSIX);
     LargeDataTableBenchmarkObject tested(attr_sizes_, initial_table_size_, txn_length, insert_update_select_ratio,
                                          &block_store_, &buffer_pool_, &generator_, true, log_manager_);
     // log all of the Inserts from table creation
@@ -251,6 +240,8 @@ BENCHMARK_DEFINE_F(LoggingBenchmark, SingleStatementSelect)(benchmark::State &st
 // ----------------------------------------------------------------------------
 // clang-format off
 BENCHMARK_REGISTER_F(LoggingBenchmark, TPCCish)
+    ->ArgName("io_backend")
+    ->DenseRange(0, 2)
     ->Unit(benchmark::kMillisecond)
     ->UseManualTime()
     ->MinTime(3);
@@ -259,6 +250,8 @@ BENCHMARK_REGISTER_F(LoggingBenchmark, HighAbortRate)
     ->UseManualTime()
     ->MinTime(10);
 BENCHMARK_REGISTER_F(LoggingBenchmark, SingleStatementInsert)
+    ->ArgName("io_backend")
+    ->DenseRange(0, 2)
     ->Unit(benchmark::kMillisecond)
     ->UseManualTime()
     ->MinTime(3);
@@ -0,0 +1,26 @@
+// Expected output: 0
+
+fun main() -> int {
+  var pattern: LikePattern
+  @likePatternInit(&pattern, @stringToSql("%special%requests%"))
+
+  if (!@sqlToBool(@likePatternMatch(@stringToSql("no special requests here"), &pattern))) {
+    return 1
+  }
+  if (@sqlToBool(@likePatternMatch(@stringToSql("no special needs"), &pattern))) {
+    return 2
+  }
+
+  var prefix: LikePattern
+  @likePatternInit(&prefix, @stringToSql("spec%"))
+  if (!@sqlToBool(@likePatternMatch(@stringToSql("special"), &prefix))) {
+    return 3
+  }
+  if (@sqlToBool(@likePatternMatch(@stringToSql("a special"), &prefix))) {
+    return 4
+  }
+
+  @likePatternFree(&prefix)
+  @likePatternFree(&pattern)
+  return 0
+}
@@ -18,5 +18,6 @@ BENCHMARKS_TO_RUN = {
     "bplustree_benchmark": DEFAULT_FAILURE_THRESHOLD,
     "cuckoomap_benchmark": DEFAULT_FAILURE_THRESHOLD,
     "parser_benchmark": 20,
+    "like_benchmark": DEFAULT_FAILURE_THRESHOLD,
     "slot_iterator_benchmark": DEFAULT_FAILURE_THRESHOLD,
 }
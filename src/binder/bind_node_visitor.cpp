@@ -30,8 +30,10 @@
 #include "parser/expression/subquery_expression.h"
 #include "parser/expression/table_star_expression.h"
 #include "parser/expression/type_cast_expression.h"
+#include "parser/expression/window_expression.h"
 #include "parser/parse_result.h"
 #include "parser/statements.h"
+#include "type/type_util.h"
 
 namespace noisepage::binder {
 
@@ -235,6 +237,16 @@ void BindNodeVisitor::Visit(common::ManagedPointer<parser::CreateStatement> node
                                    common::ErrorCode::ERRCODE_INVALID_OBJECT_DEFINITION);
         }
       }
+
+      if (node->GetIndexPredicate() != nullptr) {
+        node->GetIndexPredicate()->Accept(common::ManagedPointer(this).CastManagedPointerTo<SqlNodeVisitor>());
+        BinderUtil::ValidateWhereClause(node->GetIndexPredicate());
+        node->GetIndexPredicate()->DeriveSubqueryFlag();
+        if (node->GetIndexPredicate()->HasSubquery()) {
+          throw BINDER_EXCEPTION("Cannot use subquery in index predicate.",
+                                 common::ErrorCode::ERRCODE_FEATURE_NOT_SUPPORTED);
+        }
+      }
       break;
     case parser::CreateStatement::CreateType::kTrigger:
       ValidateDatabaseName(node->GetDatabaseName());
@@ -487,6 +499,27 @@ void BindNodeVisitor::Visit(common::ManagedPointer<parser::SelectStatement> node
   }
 
   context_ = context_->GetUpperContext();
+
+  if (node->GetSetOpSelect() != nullptr) {
+    // The right input of a set operation is bound in its own context, it cannot see the tables of the left input.
+    node->GetSetOpSelect()->Accept(common::ManagedPointer(this).CastManagedPointerTo<SqlNodeVisitor>());
+
+    const auto &left_columns = node->GetSelectColumns();
+    const auto &right_columns = node->GetSetOpSelect()->GetSelectColumns();
+    if (left_columns.size() != right_columns.size()) {
+      throw BINDER_EXCEPTION("each set operation query must have the same number of columns",
+                             common::ErrorCode::ERRCODE_SYNTAX_ERROR);
+    }
+    for (size_t i = 0; i < left_columns.size(); i++) {
+      // The set operation compares and outputs the rows of both inputs as they are, so the types must be the same.
+      if (left_columns[i]->GetReturnValueType() != right_columns[i]->GetReturnValueType()) {
+        throw BINDER_EXCEPTION(fmt::format("set operation column {} has different types {} and {}", i + 1,
+                                           type::TypeUtil::TypeIdToString(left_columns[i]->GetReturnValueType()),
+                                           type::TypeUtil::TypeIdToString(right_columns[i]->GetReturnValueType())),
+                               common::ErrorCode::ERRCODE_DATATYPE_MISMATCH);
+      }
+    }
+  }
 }
 
 void BindNodeVisitor::Visit(UNUSED_ATTRIBUTE common::ManagedPointer<parser::TransactionStatement> node) {
@@ -726,6 +759,12 @@ void BindNodeVisitor::Visit(UNUSED_ATTRIBUTE common::ManagedPointer<parser::Type
   SqlNodeVisitor::Visit(expr);
 }
 
+void BindNodeVisitor::Visit(common::ManagedPointer<parser::WindowExpression> expr) {
+  BINDER_LOG_TRACE("Visiting WindowExpression ...");
+  SqlNodeVisitor::Visit(expr);
+  expr->DeriveReturnValueType();
+}
+
 void BindNodeVisitor::Visit(common::ManagedPointer<parser::GroupByDescription> node) {
   BINDER_LOG_TRACE("Visiting GroupByDescription ...");
   SqlNodeVisitor::Visit(node);
@@ -11,11 +11,23 @@
 
 namespace noisepage::binder {
 
+namespace {
+bool ContainsWindowFunction(const common::ManagedPointer<parser::AbstractExpression> expr) {
+  if (expr->GetExpressionType() == parser::ExpressionType::WINDOW_FUNCTION) return true;
+  const auto children = expr->GetChildren();
+  return std::any_of(children.begin(), children.end(), ContainsWindowFunction);
+}
+}  // namespace
+
 void BinderUtil::ValidateWhereClause(const common::ManagedPointer<parser::AbstractExpression> value) {
   if (value->GetReturnValueType() != type::TypeId::BOOLEAN) {
     // TODO(Matt): NULL literal (type::TypeId::INVALID and cve->IsNull()) should be allowed but breaks stuff downstream
     throw BINDER_EXCEPTION("argument of WHERE must be type boolean", common::ErrorCode::ERRCODE_DATATYPE_MISMATCH);
   }
+  if (ContainsWindowFunction(value)) {
+    // Window functions are computed after WHERE filters the rows.
+    throw BINDER_EXCEPTION("window functions are not allowed in WHERE", common::ErrorCode::ERRCODE_WINDOWING_ERROR);
+  }
 }
 
 void BinderUtil::PromoteParameters(
@@ -164,14 +164,15 @@ bool DatabaseCatalog::SetIndexPointer(const common::ManagedPointer<transaction::
       write_lock_.load() == txn->FinishTime(),
       "Setting the object's pointer should only be done after successful DDL change request. i.e. this txn "
       "should already have the lock.");
-  if (index_ptr->Type() == storage::index::IndexType::BWTREE) {
+  if (index_ptr->Type() == storage::index::IndexType::BWTREE || index_ptr->Type() == storage::index::IndexType::ART) {
     garbage_collector_->RegisterIndexForGC(common::ManagedPointer(index_ptr));
   }
   // This needs to be deferred because if any items were subsequently inserted into this index, they will have deferred
   // abort actions that will be above this action on the abort stack.  The defer ensures we execute after them.
   txn->RegisterAbortAction(
       [=, garbage_collector{garbage_collector_}](transaction::DeferredActionManager *deferred_action_manager) {
-        if (index_ptr->Type() == storage::index::IndexType::BWTREE) {
+        if (index_ptr->Type() == storage::index::IndexType::BWTREE ||
+            index_ptr->Type() == storage::index::IndexType::ART) {
           garbage_collector->UnregisterIndexForGC(common::ManagedPointer(index_ptr));
         }
         deferred_action_manager->RegisterDeferredAction([=]() { delete index_ptr; });
@@ -37,6 +37,7 @@ nlohmann::json IndexSchema::ToJson() const {
   j["primary"] = is_primary_;
   j["exclusion"] = is_exclusion_;
   j["immediate"] = is_immediate_;
+  j["predicate"] = predicate_ == nullptr ? nlohmann::json(nullptr) : predicate_->ToJson();
   return j;
 }
 
@@ -53,7 +54,14 @@ std::unique_ptr<IndexSchema> IndexSchema::DeserializeSchema(const nlohmann::json
   auto immediate = j.at("immediate").get<bool>();
   auto type = static_cast<storage::index::IndexType>(j.at("type").get<char>());
 
-  auto schema = std::make_unique<IndexSchema>(columns, type, unique, primary, exclusion, immediate);
+  std::unique_ptr<parser::AbstractExpression> predicate;
+  if (j.contains("predicate") && !j.at("predicate").is_null()) {
+    predicate = parser::DeserializeExpression(j.at("predicate")).result_;
+  }
+
+  auto schema = std::make_unique<IndexSchema>(
+      columns, type, unique, primary, exclusion, immediate,
+      common::ManagedPointer(static_cast<const parser::AbstractExpression *>(predicate.get())));
 
   return schema;
 }
@@ -226,7 +226,7 @@ std::function<void(void)> PgCoreImpl::GetTearDownFn(common::ManagedPointer<trans
           table_schemas{std::move(table_schemas)}, index_schemas{std::move(index_schemas)}]() {
     for (auto table : tables) delete table;
     for (auto index : indexes) {
-      if (index->Type() == storage::index::IndexType::BWTREE) {
+      if (index->Type() == storage::index::IndexType::BWTREE || index->Type() == storage::index::IndexType::ART) {
         garbage_collector->UnregisterIndexForGC(common::ManagedPointer(index));
       }
       delete index;
@@ -749,6 +749,11 @@ bool PgCoreImpl::CreateIndexEntry(const common::ManagedPointer<transaction::Tran
       PgIndex::INDISREADY.Set(delta, pm, true);
       PgIndex::INDISLIVE.Set(delta, pm, true);
       PgIndex::IND_TYPE.Set(delta, pm, static_cast<char>(schema.type_));
+      if (schema.Partial()) {
+        PgIndex::INDPRED.Set(delta, pm, storage::StorageUtil::CreateVarlen(schema.Predicate()->ToJson().dump()));
+      } else {
+        PgIndex::INDPRED.SetNull(delta, pm);
+      }
 
       // Insert into pg_index.
       const auto indexes_tuple_slot = indexes_->Insert(txn, indexes_insert_redo);
@@ -802,7 +807,8 @@ bool PgCoreImpl::CreateIndexEntry(const common::ManagedPointer<transaction::Tran
     std::vector<IndexSchema::Column> cols =
         GetColumns<IndexSchema::Column, index_oid_t, indexkeycol_oid_t>(txn, index_oid);
     auto *new_schema =
-        new IndexSchema(cols, schema.Type(), schema.Unique(), schema.Primary(), schema.Exclusion(), schema.Immediate());
+        new IndexSchema(cols, schema.Type(), schema.Unique(), schema.Primary(), schema.Exclusion(), schema.Immediate(),
+                        schema.Predicate());
     txn->RegisterAbortAction([=]() { delete new_schema; });
 
     auto *const update_redo = txn->StageWrite(db_oid_, PgClass::CLASS_TABLE_OID, set_class_schema_pri_);
@@ -969,7 +975,8 @@ bool PgCoreImpl::DeleteIndex(const common::ManagedPointer<transaction::Transacti
     // txn manager. See base function comment.
     txn->RegisterCommitAction(
         [=, garbage_collector{dbc->garbage_collector_}](transaction::DeferredActionManager *deferred_action_manager) {
-          if (index_ptr->Type() == storage::index::IndexType::BWTREE) {
+          if (index_ptr->Type() == storage::index::IndexType::BWTREE ||
+              index_ptr->Type() == storage::index::IndexType::ART) {
             garbage_collector->UnregisterIndexForGC(common::ManagedPointer(index_ptr));
           }
           // Unregistering from GC can happen immediately, but we have to double-defer freeing the actual objects
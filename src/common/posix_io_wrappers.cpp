@@ -62,6 +62,18 @@ void PosixIoWrappers::WriteFully(int fd, const void *buf, size_t nbyte) {
   }
 }
 
+void PosixIoWrappers::PWriteFully(int fd, const void *buf, size_t nbyte, off_t offset) {
+  ssize_t written = 0;
+  while (static_cast<size_t>(written) < nbyte) {
+    ssize_t ret = pwrite(fd, reinterpret_cast<const char *>(buf) + written, nbyte - written, offset + written);
+    if (ret == -1) {
+      if (errno == EINTR) continue;
+      throw std::runtime_error("Positional write to log file failed with errno " + std::to_string(errno));
+    }
+    written += ret;
+  }
+}
+
 template int PosixIoWrappers::Open<>(const char *path, int oflag);
 template int PosixIoWrappers::Open<int>(const char *path, int oflag, int mode);
 
@@ -18,10 +18,13 @@
 #include "execution/ast/type.h"
 #include "execution/sql/aggregation_hash_table.h"
 #include "execution/sql/aggregators.h"
+#include "execution/sql/csv_scanner.h"
 #include "execution/sql/filter_manager.h"
 #include "execution/sql/index_iterator.h"
 #include "execution/sql/join_hash_table.h"
 #include "execution/sql/join_hash_table_vector_probe.h"
+#include "execution/sql/operators/like_operators.h"
+#include "execution/sql/segment_tree.h"
 #include "execution/sql/sorter.h"
 #include "execution/sql/table_vector_iterator.h"
 #include "execution/sql/thread_state_container.h"
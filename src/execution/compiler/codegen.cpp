@@ -474,7 +474,8 @@ ast::Expr *CodeGen::IndexIteratorScan(ast::Identifier iter, planner::IndexScanTy
   return IndexIteratorScan(AddressOf(iter), scan_type, limit);
 }
 
-ast::Expr *CodeGen::IndexIteratorScan(ast::Expr *iter_ptr, planner::IndexScanType scan_type, uint32_t limit) {
+ast::Expr *CodeGen::IndexIteratorScan(ast::Expr *iter_ptr, planner::IndexScanType scan_type, uint32_t limit,
+                                      bool with_keys) {
   // @indexIteratorScanKey(iter_ptr)
   ast::Builtin builtin;
   bool asc_scan = false;
@@ -490,7 +491,7 @@ ast::Expr *CodeGen::IndexIteratorScan(ast::Expr *iter_ptr, planner::IndexScanTyp
     case planner::IndexScanType::AscendingOpenBoth:
       asc_scan = true;
       use_limit = true;
-      builtin = ast::Builtin::IndexIteratorScanAscending;
+      builtin = with_keys ? ast::Builtin::IndexIteratorScanAscendingKeys : ast::Builtin::IndexIteratorScanAscending;
       if (scan_type == planner::IndexScanType::AscendingClosed)
         asc_type = storage::index::ScanType::Closed;
       else if (scan_type == planner::IndexScanType::AscendingOpenHigh)
@@ -646,6 +647,43 @@ ast::Expr *CodeGen::IterateTableParallel(catalog::table_oid_t table_oid, ast::Id
 
 ast::Expr *CodeGen::AbortTxn(ast::Expr *exec_ctx) { return CallBuiltin(ast::Builtin::AbortTxn, {exec_ctx}); }
 
+// ---------------------------------------------------------
+// CSV Scanner
+// ---------------------------------------------------------
+
+ast::Expr *CodeGen::CSVScanInit(ast::Expr *scanner, ast::Expr *exec_ctx, std::string_view file_name,
+                                uint32_t num_cols, char delimiter, char quote, char escape) {
+  ast::Expr *call = CallBuiltin(ast::Builtin::CSVScanInit, {scanner, exec_ctx, ConstString(file_name),
+                                                             Const32(num_cols), Const32(delimiter), Const32(quote),
+                                                             Const32(escape)});
+  call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Nil));
+  return call;
+}
+
+ast::Expr *CodeGen::CSVScanAdvance(ast::Expr *scanner) {
+  ast::Expr *call = CallBuiltin(ast::Builtin::CSVScanAdvance, {scanner});
+  call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Bool));
+  return call;
+}
+
+ast::Expr *CodeGen::CSVScanGetVPI(ast::Expr *scanner) {
+  ast::Expr *call = CallBuiltin(ast::Builtin::CSVScanGetVPI, {scanner});
+  call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::VectorProjectionIterator)->PointerTo());
+  return call;
+}
+
+ast::Expr *CodeGen::CSVScanClose(ast::Expr *scanner) {
+  ast::Expr *call = CallBuiltin(ast::Builtin::CSVScanClose, {scanner});
+  call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Nil));
+  return call;
+}
+
+ast::Expr *CodeGen::IterateCSVParallel(ast::Expr *scanner, ast::Expr *query_state, ast::Identifier worker_name) {
+  ast::Expr *call = CallBuiltin(ast::Builtin::CSVScanParallel, {scanner, query_state, MakeExpr(worker_name)});
+  call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Nil));
+  return call;
+}
+
 // ---------------------------------------------------------
 // Vector Projection Iterator
 // ---------------------------------------------------------
@@ -931,12 +969,48 @@ ast::Expr *CodeGen::JoinHashTableBuildParallel(ast::Expr *join_hash_table, ast::
   return call;
 }
 
+ast::Expr *CodeGen::JoinHashTableMoveTuplesParallel(ast::Expr *join_hash_table, ast::Expr *thread_state_container,
+                                                    ast::Expr *offset) {
+  ast::Expr *call =
+      CallBuiltin(ast::Builtin::JoinHashTableMoveTuplesParallel, {join_hash_table, thread_state_container, offset});
+  call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Nil));
+  return call;
+}
+
+ast::Expr *CodeGen::JoinHashTableBuildAndJoin(ast::Expr *join_hash_table, ast::Expr *probe_join_hash_table,
+                                              ast::Expr *query_state, ast::Expr *pipeline_state,
+                                              ast::Identifier join_fn) {
+  ast::Expr *call =
+      CallBuiltin(ast::Builtin::JoinHashTableBuildAndJoin,
+                  {join_hash_table, probe_join_hash_table, query_state, pipeline_state, MakeExpr(join_fn)});
+  call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Nil));
+  return call;
+}
+
+ast::Expr *CodeGen::JoinHashTableBuildAndJoinParallel(ast::Expr *join_hash_table, ast::Expr *probe_join_hash_table,
+                                                      ast::Expr *query_state, ast::Expr *thread_state_container,
+                                                      ast::Identifier join_fn) {
+  ast::Expr *call =
+      CallBuiltin(ast::Builtin::JoinHashTableBuildAndJoinParallel,
+                  {join_hash_table, probe_join_hash_table, query_state, thread_state_container, MakeExpr(join_fn)});
+  call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Nil));
+  return call;
+}
+
 ast::Expr *CodeGen::JoinHashTableLookup(ast::Expr *join_hash_table, ast::Expr *entry_iter, ast::Expr *hash_val) {
   ast::Expr *call = CallBuiltin(ast::Builtin::JoinHashTableLookup, {join_hash_table, entry_iter, hash_val});
   call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Nil));
   return call;
 }
 
+ast::Expr *CodeGen::JoinHashTableParallelScan(ast::Expr *join_hash_table, ast::Expr *query_state,
+                                              ast::Expr *thread_state_container, ast::Identifier worker_fn) {
+  ast::Expr *call = CallBuiltin(ast::Builtin::JoinHashTableParallelScan,
+                                {join_hash_table, query_state, thread_state_container, MakeExpr(worker_fn)});
+  call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Nil));
+  return call;
+}
+
 ast::Expr *CodeGen::JoinHashTableFree(ast::Expr *join_hash_table) {
   ast::Expr *call = CallBuiltin(ast::Builtin::JoinHashTableFree, {join_hash_table});
   call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Nil));
@@ -995,6 +1069,14 @@ ast::Expr *CodeGen::AggHashTableInit(ast::Expr *agg_ht, ast::Expr *exec_ctx, ast
   return call;
 }
 
+ast::Expr *CodeGen::AggHashTableInit(ast::Expr *agg_ht, ast::Expr *exec_ctx, ast::Identifier agg_payload_type,
+                                     uint32_t initial_size) {
+  ast::Expr *size = Const32(static_cast<int32_t>(initial_size));
+  ast::Expr *call = CallBuiltin(ast::Builtin::AggHashTableInit, {agg_ht, exec_ctx, SizeOf(agg_payload_type), size});
+  call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Nil));
+  return call;
+}
+
 ast::Expr *CodeGen::AggHashTableLookup(ast::Expr *agg_ht, ast::Expr *hash_val, ast::Identifier key_check,
                                        ast::Expr *input, ast::Identifier agg_payload_type) {
   ast::Expr *call = CallBuiltin(ast::Builtin::AggHashTableLookup, {agg_ht, hash_val, MakeExpr(key_check), input});
@@ -1117,6 +1199,18 @@ ast::Expr *CodeGen::AggregatorAdvance(ast::Expr *agg, ast::Expr *val) {
   return call;
 }
 
+ast::Expr *CodeGen::AggregatorAdvanceVector(ast::Expr *agg, ast::Expr *vpi, uint32_t col_idx) {
+  ast::Expr *call = CallBuiltin(ast::Builtin::AggAdvanceVector, {agg, vpi, Const32(col_idx)});
+  call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Nil));
+  return call;
+}
+
+ast::Expr *CodeGen::AggregatorAdvanceVector(ast::Expr *agg, ast::Expr *vpi) {
+  ast::Expr *call = CallBuiltin(ast::Builtin::AggAdvanceVector, {agg, vpi});
+  call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Nil));
+  return call;
+}
+
 ast::Expr *CodeGen::AggregatorMerge(ast::Expr *agg1, ast::Expr *agg2) {
   ast::Expr *call = CallBuiltin(ast::Builtin::AggMerge, {agg1, agg2});
   call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Nil));
@@ -1190,6 +1284,14 @@ ast::Expr *CodeGen::SortTopKParallel(ast::Expr *sorter, ast::Expr *tls, ast::Exp
   return call;
 }
 
+ast::Expr *CodeGen::SorterScanPartitionsParallel(ast::Expr *sorter, ast::Expr *query_state, ast::Expr *tls,
+                                                 ast::Identifier same_partition_fn, ast::Identifier scan_fn) {
+  ast::Expr *call = CallBuiltin(ast::Builtin::SorterScanPartitionsParallel,
+                                {sorter, query_state, tls, MakeExpr(same_partition_fn), MakeExpr(scan_fn)});
+  call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Nil));
+  return call;
+}
+
 ast::Expr *CodeGen::SorterFree(ast::Expr *sorter) {
   ast::Expr *call = CallBuiltin(ast::Builtin::SorterFree, {sorter});
   call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Nil));
@@ -1232,6 +1334,47 @@ ast::Expr *CodeGen::SorterIterClose(ast::Expr *iter) {
   return call;
 }
 
+// ---------------------------------------------------------
+// Segment trees
+// ---------------------------------------------------------
+
+ast::Expr *CodeGen::SegmentTreeInit(ast::Expr *tree, ast::Expr *exec_ctx, sql::SegmentTree::AggregateKind kind) {
+  ast::Expr *call = CallBuiltin(ast::Builtin::SegmentTreeInit, {tree, exec_ctx, Const32(static_cast<int32_t>(kind))});
+  call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Nil));
+  return call;
+}
+
+ast::Expr *CodeGen::SegmentTreeAppend(ast::Expr *tree, ast::Expr *val) {
+  ast::Expr *call = CallBuiltin(ast::Builtin::SegmentTreeAppend, {tree, val});
+  call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Nil));
+  return call;
+}
+
+ast::Expr *CodeGen::SegmentTreeBuild(ast::Expr *tree) {
+  ast::Expr *call = CallBuiltin(ast::Builtin::SegmentTreeBuild, {tree});
+  call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Nil));
+  return call;
+}
+
+ast::Expr *CodeGen::SegmentTreeQuery(ast::Expr *tree, ast::Expr *begin, ast::Expr *end, bool real_result) {
+  const auto builtin = real_result ? ast::Builtin::SegmentTreeQueryReal : ast::Builtin::SegmentTreeQueryInt;
+  ast::Expr *call = CallBuiltin(builtin, {tree, begin, end});
+  call->SetType(ast::BuiltinType::Get(context_, real_result ? ast::BuiltinType::Real : ast::BuiltinType::Integer));
+  return call;
+}
+
+ast::Expr *CodeGen::SegmentTreeReset(ast::Expr *tree) {
+  ast::Expr *call = CallBuiltin(ast::Builtin::SegmentTreeReset, {tree});
+  call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Nil));
+  return call;
+}
+
+ast::Expr *CodeGen::SegmentTreeFree(ast::Expr *tree) {
+  ast::Expr *call = CallBuiltin(ast::Builtin::SegmentTreeFree, {tree});
+  call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Nil));
+  return call;
+}
+
 // ---------------------------------------------------------
 // SQL functions
 // ---------------------------------------------------------
@@ -1246,6 +1389,24 @@ ast::Expr *CodeGen::NotLike(ast::Expr *str, ast::Expr *pattern) {
   return UnaryOp(parsing::Token::Type::BANG, Like(str, pattern));
 }
 
+ast::Expr *CodeGen::LikePatternInit(ast::Expr *like_pattern, ast::Expr *pattern) {
+  ast::Expr *call = CallBuiltin(ast::Builtin::LikePatternInit, {like_pattern, pattern});
+  call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Nil));
+  return call;
+}
+
+ast::Expr *CodeGen::LikePatternMatch(ast::Expr *str, ast::Expr *like_pattern) {
+  ast::Expr *call = CallBuiltin(ast::Builtin::LikePatternMatch, {str, like_pattern});
+  call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Boolean));
+  return call;
+}
+
+ast::Expr *CodeGen::LikePatternFree(ast::Expr *like_pattern) {
+  ast::Expr *call = CallBuiltin(ast::Builtin::LikePatternFree, {like_pattern});
+  call->SetType(ast::BuiltinType::Get(context_, ast::BuiltinType::Nil));
+  return call;
+}
+
 // ---------------------------------------------------------
 // CSV
 // ---------------------------------------------------------
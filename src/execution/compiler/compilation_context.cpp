@@ -37,9 +37,11 @@
 #include "execution/compiler/operator/output_translator.h"
 #include "execution/compiler/operator/projection_translator.h"
 #include "execution/compiler/operator/seq_scan_translator.h"
+#include "execution/compiler/operator/set_op_translator.h"
 #include "execution/compiler/operator/sort_translator.h"
 #include "execution/compiler/operator/static_aggregation_translator.h"
 #include "execution/compiler/operator/update_translator.h"
+#include "execution/compiler/operator/window_translator.h"
 #include "execution/compiler/pipeline.h"
 #include "execution/exec/execution_settings.h"
 #include "parser/expression/abstract_expression.h"
@@ -69,6 +71,7 @@
 #include "planner/plannodes/seq_scan_plan_node.h"
 #include "planner/plannodes/set_op_plan_node.h"
 #include "planner/plannodes/update_plan_node.h"
+#include "planner/plannodes/window_plan_node.h"
 #include "self_driving/modeling/operating_unit_recorder.h"
 #include "spdlog/fmt/fmt.h"
 
@@ -89,6 +92,7 @@ CompilationContext::CompilationContext(ExecutableQuery *query, query_id_t query_
       query_state_var_(codegen_.MakeIdentifier("queryState")),
       query_state_type_(codegen_.MakeIdentifier("QueryState")),
       query_state_(query_state_type_, [this](CodeGen *codegen) { return codegen->MakeExpr(query_state_var_); }),
+      plan_meta_data_(nullptr),
       counters_enabled_(settings.GetIsCountersEnabled()),
       pipeline_metrics_enabled_(settings.GetIsPipelineMetricsEnabled()) {}
 
@@ -102,6 +106,10 @@ ast::FunctionDecl *CompilationContext::GenerateInitFunction() {
       (void)_;
       op->InitializeQueryState(&builder);
     }
+    for (auto &[_, expr] : expressions_) {
+      (void)_;
+      expr->InitializeQueryState(&builder);
+    }
   }
   return builder.Finish();
 }
@@ -116,12 +124,17 @@ ast::FunctionDecl *CompilationContext::GenerateTearDownFunction() {
       (void)_;
       op->TearDownQueryState(&builder);
     }
+    for (auto &[_, expr] : expressions_) {
+      (void)_;
+      expr->TearDownQueryState(&builder);
+    }
   }
   return builder.Finish();
 }
 
 void CompilationContext::GeneratePlan(const planner::AbstractPlanNode &plan,
                                       common::ManagedPointer<planner::PlanMetaData> plan_meta_data) {
+  plan_meta_data_ = plan_meta_data;
   exec_ctx_ =
       query_state_.DeclareStateEntry(GetCodeGen(), "execCtx", codegen_.PointerType(ast::BuiltinType::ExecutionContext));
 
@@ -272,6 +285,16 @@ void CompilationContext::Prepare(const planner::AbstractPlanNode &plan, Pipeline
       translator = std::make_unique<SeqScanTranslator>(seq_scan, this, pipeline);
       break;
     }
+    case planner::PlanNodeType::SETOP: {
+      const auto &set_op = dynamic_cast<const planner::SetOpPlanNode &>(plan);
+      translator = std::make_unique<SetOpTranslator>(set_op, this, pipeline);
+      break;
+    }
+    case planner::PlanNodeType::WINDOW: {
+      const auto &window = dynamic_cast<const planner::WindowPlanNode &>(plan);
+      translator = std::make_unique<WindowTranslator>(window, this, pipeline);
+      break;
+    }
     case planner::PlanNodeType::INSERT: {
       const auto &insert = dynamic_cast<const planner::InsertPlanNode &>(plan);
       translator = std::make_unique<InsertTranslator>(insert, this, pipeline);
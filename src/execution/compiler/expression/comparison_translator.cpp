@@ -3,8 +3,10 @@
 #include "common/error/exception.h"
 #include "execution/compiler/codegen.h"
 #include "execution/compiler/compilation_context.h"
+#include "execution/compiler/function_builder.h"
 #include "execution/compiler/work_context.h"
 #include "parser/expression/comparison_expression.h"
+#include "parser/expression/constant_value_expression.h"
 #include "spdlog/fmt/fmt.h"
 
 namespace noisepage::execution::compiler {
@@ -21,10 +23,52 @@ ComparisonTranslator::ComparisonTranslator(const parser::ComparisonExpression &e
   for (const auto &child : expr.GetChildren()) {
     compilation_context->Prepare(*child);
   }
+
+  // A constant pattern is analyzed once per query instead of once per tuple.
+  if (HasConstantLikePattern()) {
+    auto *codegen = GetCodeGen();
+    like_pattern_ = compilation_context->GetQueryState()->DeclareStateEntry(
+        codegen, "likePattern", codegen->BuiltinType(ast::BuiltinType::LikePattern));
+  }
+}
+
+bool ComparisonTranslator::HasConstantLikePattern() const {
+  const auto &expr = GetExpression();
+  const auto expr_type = expr.GetExpressionType();
+  if (expr_type != parser::ExpressionType::COMPARE_LIKE && expr_type != parser::ExpressionType::COMPARE_NOT_LIKE) {
+    return false;
+  }
+  const auto &pattern = *expr.GetChild(1);
+  return pattern.GetExpressionType() == parser::ExpressionType::VALUE_CONSTANT &&
+         pattern.GetReturnValueType() == type::TypeId::VARCHAR &&
+         !dynamic_cast<const parser::ConstantValueExpression &>(pattern).IsNull();
+}
+
+void ComparisonTranslator::InitializeQueryState(FunctionBuilder *function) const {
+  if (HasConstantLikePattern()) {
+    auto *codegen = GetCodeGen();
+    const auto &pattern = dynamic_cast<const parser::ConstantValueExpression &>(*GetExpression().GetChild(1));
+    auto pattern_val = codegen->StringToSql(pattern.GetStringVal().StringView());
+    function->Append(codegen->LikePatternInit(like_pattern_.GetPtr(codegen), pattern_val));
+  }
+}
+
+void ComparisonTranslator::TearDownQueryState(FunctionBuilder *function) const {
+  if (HasConstantLikePattern()) {
+    auto *codegen = GetCodeGen();
+    function->Append(codegen->LikePatternFree(like_pattern_.GetPtr(codegen)));
+  }
 }
 
 ast::Expr *ComparisonTranslator::DeriveValue(WorkContext *ctx, const ColumnValueProvider *provider) const {
   auto *codegen = GetCodeGen();
+  if (HasConstantLikePattern()) {
+    auto str_val = ctx->DeriveValue(*GetExpression().GetChild(0), provider);
+    auto match = codegen->LikePatternMatch(str_val, like_pattern_.GetPtr(codegen));
+    const bool negate = GetExpression().GetExpressionType() == parser::ExpressionType::COMPARE_NOT_LIKE;
+    return negate ? codegen->UnaryOp(parsing::Token::Type::BANG, match) : match;
+  }
+
   auto left_val = ctx->DeriveValue(*GetExpression().GetChild(0), provider);
   auto right_val = ctx->DeriveValue(*GetExpression().GetChild(1), provider);
 
@@ -5,6 +5,7 @@
 #include "execution/compiler/codegen.h"
 #include "execution/compiler/compilation_context.h"
 #include "execution/compiler/function_builder.h"
+#include "execution/compiler/if.h"
 #include "execution/compiler/loop.h"
 #include "execution/compiler/pipeline.h"
 #include "execution/compiler/work_context.h"
@@ -14,78 +15,105 @@
 
 namespace noisepage::execution::compiler {
 
-namespace {
-constexpr const char FIELD_PREFIX[] = "field";
-}  // namespace
-
 CSVScanTranslator::CSVScanTranslator(const planner::CSVScanPlanNode &plan, CompilationContext *compilation_context,
                                      Pipeline *pipeline)
     : OperatorTranslator(plan, compilation_context, pipeline, selfdriving::ExecutionOperatingUnitType::DUMMY),
-      base_row_type_(GetCodeGen()->MakeFreshIdentifier("CSVRow")) {
-  // CSV scans are serial, for now.
-  pipeline->RegisterSource(this, Pipeline::Parallelism::Serial);
+      vpi_var_(GetCodeGen()->MakeFreshIdentifier("vpi")) {
+  pipeline->RegisterSource(this, Pipeline::Parallelism::Parallel);
   // Declare state.
-  base_row_ = compilation_context->GetQueryState()->DeclareStateEntry(GetCodeGen(), "csvRow",
-                                                                      GetCodeGen()->MakeExpr(base_row_type_));
+  csv_scanner_base_ =
+      pipeline->DeclarePipelineStateEntry("csvScannerBase", GetCodeGen()->BuiltinType(ast::BuiltinType::CSVScanner));
+  csv_scanner_needs_free_ =
+      pipeline->DeclarePipelineStateEntry("csvScannerNeedsFree", GetCodeGen()->BuiltinType(ast::BuiltinType::Bool));
 }
 
-void CSVScanTranslator::DefineHelperStructs(util::RegionVector<ast::StructDecl *> *decls) {
+void CSVScanTranslator::InitializePipelineState(const Pipeline &pipeline, FunctionBuilder *function) const {
   auto *codegen = GetCodeGen();
+  // pipelineState.csvScannerNeedsFree = false
+  function->Append(codegen->Assign(csv_scanner_needs_free_.Get(codegen), codegen->ConstBool(false)));
+}
 
-  // Reserve now to reduce allocations.
-  const auto output_schema = GetPlan().GetOutputSchema();
-  auto fields = codegen->MakeEmptyFieldList();
-  fields.reserve(output_schema->NumColumns());
-
-  // Add columns to output.
-  for (uint32_t idx = 0; idx < output_schema->NumColumns(); idx++) {
-    auto field_name = codegen->MakeIdentifier(FIELD_PREFIX + std::to_string(idx));
-    fields.emplace_back(codegen->MakeField(field_name, codegen->TplType(sql::TypeId::Varchar)));
+void CSVScanTranslator::TearDownPipelineState(const Pipeline &pipeline, FunctionBuilder *function) const {
+  auto *codegen = GetCodeGen();
+  // if (pipelineState.csvScannerNeedsFree)
+  If need_free(function, csv_scanner_needs_free_.Get(codegen));
+  {
+    // @csvScanClose(&pipelineState.csvScannerBase)
+    function->Append(codegen->CSVScanClose(csv_scanner_base_.GetPtr(codegen)));
+    // pipelineState.csvScannerNeedsFree = false
+    function->Append(codegen->Assign(csv_scanner_needs_free_.Get(codegen), codegen->ConstBool(false)));
   }
-
-  decls->push_back(codegen->DeclareStruct(base_row_type_, std::move(fields)));
+  need_free.EndIf();
 }
 
-ast::Expr *CSVScanTranslator::GetField(uint32_t field_index) const {
+void CSVScanTranslator::InitScanner(FunctionBuilder *function) const {
   auto *codegen = GetCodeGen();
-  ast::Identifier field_name = codegen->MakeIdentifier(FIELD_PREFIX + std::to_string(field_index));
-  return codegen->AccessStructMember(base_row_.Get(codegen), field_name);
+  const auto &plan = GetCSVPlan();
+  // @csvScanInit(&pipelineState.csvScannerBase, execCtx, file_name, num_cols, delimiter, quote, escape)
+  function->Append(codegen->CSVScanInit(csv_scanner_base_.GetPtr(codegen), GetExecutionContext(), plan.GetFileName(),
+                                        plan.GetValueTypes().size(), plan.GetDelimiterChar(), plan.GetQuoteChar(),
+                                        plan.GetEscapeChar()));
+  // pipelineState.csvScannerNeedsFree = true
+  function->Append(codegen->Assign(csv_scanner_needs_free_.Get(codegen), codegen->ConstBool(true)));
 }
 
-ast::Expr *CSVScanTranslator::GetFieldPtr(uint32_t field_index) const {
-  return GetCodeGen()->AddressOf(GetField(field_index));
+void CSVScanTranslator::ScanVPI(WorkContext *context, FunctionBuilder *function) const {
+  auto *codegen = GetCodeGen();
+  auto vpi = codegen->MakeExpr(vpi_var_);
+  // for (; @vpiHasNext(vpi); @vpiAdvance(vpi))
+  Loop vpi_loop(function, nullptr, codegen->VPIHasNext(vpi, false), codegen->MakeStmt(codegen->VPIAdvance(vpi, false)));
+  {
+    // Done.
+    context->Push(function);
+  }
+  vpi_loop.EndLoop();
 }
 
 void CSVScanTranslator::PerformPipelineWork(WorkContext *context, FunctionBuilder *function) const {
-  UNREACHABLE("CSV support disabled because <charconv> missing on CI.");
-#if 0
   auto *codegen = GetCodeGen();
-  auto reader_var_base = codegen->MakeFreshIdentifier("csvReaderBase");
-  auto reader_var = codegen->MakeFreshIdentifier("csvReader");
-  function->Append(codegen->DeclareVarNoInit(reader_var_base, ast::BuiltinType::CSVReader));
-  function->Append(codegen->DeclareVarWithInit(reader_var, codegen->AddressOf(reader_var_base)));
-  function->Append(
-      codegen->DeclareVarWithInit(codegen->MakeFreshIdentifier("isValid"),
-                                  codegen->CSVReaderInit(codegen->MakeExpr(reader_var), GetCSVPlan().GetFileName())));
-  Loop scan_loop(function, codegen->CSVReaderAdvance(codegen->MakeExpr(reader_var)));
+
+  // In a parallel pipeline, the work function is handed the vectors of records directly.
+  if (GetPipeline()->IsParallel() && GetPipeline()->IsDriver(this)) {
+    ScanVPI(context, function);
+    return;
+  }
+
+  InitScanner(function);
+  // for (@csvScanAdvance(&pipelineState.csvScannerBase))
+  Loop scan_loop(function, codegen->CSVScanAdvance(csv_scanner_base_.GetPtr(codegen)));
   {
-    // Read fields.
-    const auto output_schema = GetPlan().GetOutputSchema();
-    for (uint32_t i = 0; i < output_schema->NumColumns(); i++) {
-      ast::Expr *field_ptr = GetFieldPtr(i);
-      function->Append(codegen->CSVReaderGetField(codegen->MakeExpr(reader_var), i, field_ptr));
-    }
-    // Done.
-    context->Push(function);
+    // var vpi = @csvScanGetVPI(&pipelineState.csvScannerBase)
+    function->Append(codegen->DeclareVarWithInit(vpi_var_, codegen->CSVScanGetVPI(csv_scanner_base_.GetPtr(codegen))));
+    ScanVPI(context, function);
   }
   scan_loop.EndLoop();
-  function->Append(codegen->CSVReaderClose(codegen->MakeExpr(reader_var)));
-#endif
+  // @csvScanClose(&pipelineState.csvScannerBase)
+  function->Append(codegen->CSVScanClose(csv_scanner_base_.GetPtr(codegen)));
+  // pipelineState.csvScannerNeedsFree = false
+  function->Append(codegen->Assign(csv_scanner_needs_free_.Get(codegen), codegen->ConstBool(false)));
+}
+
+util::RegionVector<ast::FieldDecl *> CSVScanTranslator::GetWorkerParams() const {
+  auto *codegen = GetCodeGen();
+  auto *vpi_type = codegen->PointerType(ast::BuiltinType::VectorProjectionIterator);
+  return codegen->MakeFieldList({codegen->MakeField(vpi_var_, vpi_type)});
+}
+
+void CSVScanTranslator::LaunchWork(FunctionBuilder *function, ast::Identifier work_func_name) const {
+  // The scanner lives in the pipeline state of the launching thread, and is closed when that state is torn down.
+  InitScanner(function);
+  // @iterateCSVParallel(&pipelineState.csvScannerBase, queryState, workFn)
+  function->Append(
+      GetCodeGen()->IterateCSVParallel(csv_scanner_base_.GetPtr(GetCodeGen()), GetQueryStatePtr(), work_func_name));
+}
+
+ast::Expr *CSVScanTranslator::GetChildOutput(WorkContext *context, uint32_t child_idx, uint32_t attr_idx) const {
+  return GetTableColumn(catalog::col_oid_t(attr_idx));
 }
 
 ast::Expr *CSVScanTranslator::GetTableColumn(catalog::col_oid_t col_oid) const {
   const auto output_schema = GetPlan().GetOutputSchema();
-  if (col_oid.UnderlyingValue() > output_schema->NumColumns()) {
+  if (col_oid.UnderlyingValue() >= output_schema->NumColumns()) {
     throw EXECUTION_EXCEPTION(
         fmt::format("Codegen: out-of-bounds CSV column access @ idx={}", col_oid.UnderlyingValue()),
         common::ErrorCode::ERRCODE_DATA_EXCEPTION);
@@ -93,7 +121,7 @@ ast::Expr *CSVScanTranslator::GetTableColumn(catalog::col_oid_t col_oid) const {
 
   // Return the field converted to the appropriate type.
   auto *codegen = GetCodeGen();
-  auto *field = GetField(col_oid.UnderlyingValue());
+  auto *field = codegen->VPIGet(codegen->MakeExpr(vpi_var_), sql::TypeId::Varchar, true, col_oid.UnderlyingValue());
   auto output_type = sql::GetTypeId(GetPlan().GetOutputSchema()->GetColumn(col_oid.UnderlyingValue()).GetType());
   switch (output_type) {
     case sql::TypeId::Boolean:
@@ -26,6 +26,9 @@ DeleteTranslator::DeleteTranslator(const planner::DeletePlanNode &plan, Compilat
     for (const auto &index_col : index_schema.GetColumns()) {
       compilation_context->Prepare(*index_col.StoredExpression());
     }
+    if (index_schema.Partial()) {
+      compilation_context->Prepare(*index_schema.Predicate());
+    }
   }
 
   num_deletes_ = CounterDeclare("num_deletes", pipeline);
@@ -47,7 +50,16 @@ void DeleteTranslator::PerformPipelineWork(WorkContext *context, FunctionBuilder
   const auto &op = GetPlanAs<planner::DeletePlanNode>();
   const auto &indexes = op.GetIndexOids();
   for (const auto &index_oid : indexes) {
-    GenIndexDelete(function, context, index_oid);
+    const auto &index_schema = GetCodeGen()->GetCatalogAccessor()->GetIndexSchema(index_oid);
+    if (index_schema.Partial()) {
+      // A partial index only contains the tuples that satisfy its predicate.
+      const auto &child = GetCompilationContext()->LookupTranslator(*op.GetChild(0));
+      If partial(function, context->DeriveValue(*index_schema.Predicate(), child));
+      GenIndexDelete(function, context, index_oid);
+      partial.EndIf();
+    } else {
+      GenIndexDelete(function, context, index_oid);
+    }
   }
 }
 
@@ -1,5 +1,7 @@
 #include "execution/compiler/operator/hash_aggregation_translator.h"
 
+#include <algorithm>
+
 #include "execution/compiler/codegen.h"
 #include "execution/compiler/compilation_context.h"
 #include "execution/compiler/function_builder.h"
@@ -8,12 +10,16 @@
 #include "execution/compiler/work_context.h"
 #include "execution/sql/aggregation_hash_table.h"
 #include "planner/plannodes/aggregate_plan_node.h"
+#include "planner/plannodes/plan_meta_data.h"
 
 namespace noisepage::execution::compiler {
 
 namespace {
 constexpr char GROUP_BY_TERM_ATTR_PREFIX[] = "gb_term_attr";
 constexpr char AGGREGATE_TERM_ATTR_PREFIX[] = "agg_term_attr";
+// The largest number of groups the global hash table is pre-sized for. Estimates beyond this are not trusted enough
+// to allocate for up-front; the table grows past it as usual.
+constexpr uint64_t MAX_PRESIZED_NUM_GROUPS = 1U << 20U;
 }  // namespace
 
 HashAggregationTranslator::HashAggregationTranslator(const planner::AggregatePlanNode &plan,
@@ -273,8 +279,28 @@ void HashAggregationTranslator::DefineHelperFunctions(util::RegionVector<ast::Fu
   }
 }
 
-void HashAggregationTranslator::InitializeAggregationHashTable(FunctionBuilder *function, ast::Expr *agg_ht) const {
-  function->Append(GetCodeGen()->AggHashTableInit(agg_ht, GetExecutionContext(), agg_payload_type_));
+uint32_t HashAggregationTranslator::EstimateNumGroups() const {
+  // Thread-local tables are sized to fit in cache and the global table is only merged into, so pre-sizing only helps
+  // when the build is certainly serial.
+  const bool serial_build = !build_pipeline_.IsParallel() ||
+                            !GetCompilationContext()->GetExecutionSettings().GetIsParallelQueryExecutionEnabled();
+  const auto plan_meta_data = GetCompilationContext()->GetPlanMetaData();
+  const auto plan_node_id = GetPlan().GetPlanNodeId();
+  if (!serial_build || plan_meta_data == nullptr || !plan_meta_data->HasPlanNodeMetaData(plan_node_id)) {
+    return 0;
+  }
+  // The output cardinality of the aggregation is the number of groups.
+  const uint64_t num_groups = plan_meta_data->GetPlanNodeMetaData(plan_node_id).GetCardinality();
+  return static_cast<uint32_t>(std::min(num_groups, MAX_PRESIZED_NUM_GROUPS));
+}
+
+void HashAggregationTranslator::InitializeAggregationHashTable(FunctionBuilder *function, ast::Expr *agg_ht,
+                                                               uint32_t num_groups) const {
+  if (num_groups > sql::AggregationHashTable::DEFAULT_INITIAL_TABLE_SIZE) {
+    function->Append(GetCodeGen()->AggHashTableInit(agg_ht, GetExecutionContext(), agg_payload_type_, num_groups));
+  } else {
+    function->Append(GetCodeGen()->AggHashTableInit(agg_ht, GetExecutionContext(), agg_payload_type_));
+  }
 }
 
 void HashAggregationTranslator::TearDownAggregationHashTable(FunctionBuilder *function, ast::Expr *agg_ht) const {
@@ -282,7 +308,7 @@ void HashAggregationTranslator::TearDownAggregationHashTable(FunctionBuilder *fu
 }
 
 void HashAggregationTranslator::InitializeQueryState(FunctionBuilder *function) const {
-  InitializeAggregationHashTable(function, global_agg_ht_.GetPtr(GetCodeGen()));
+  InitializeAggregationHashTable(function, global_agg_ht_.GetPtr(GetCodeGen()), EstimateNumGroups());
   for (auto &p : distinct_filters_) {
     p.second.Initialize(GetCodeGen(), function, GetExecutionContext());
   }
@@ -345,7 +371,7 @@ void HashAggregationTranslator::DefineTLSDependentHelperFunctions(const Pipeline
 
 void HashAggregationTranslator::InitializePipelineState(const Pipeline &pipeline, FunctionBuilder *function) const {
   if (IsBuildPipeline(pipeline) && build_pipeline_.IsParallel()) {
-    InitializeAggregationHashTable(function, local_agg_ht_.GetPtr(GetCodeGen()));
+    InitializeAggregationHashTable(function, local_agg_ht_.GetPtr(GetCodeGen()), 0);
 
     // agg_count_ cannot be initialized in InitializeCounters.
     // @see HashAggregationTranslator::agg_count_ for reasoning.
@@ -7,8 +7,10 @@
 #include "execution/compiler/loop.h"
 #include "execution/compiler/work_context.h"
 #include "execution/sql/join_hash_table.h"
+#include "execution/sql/value.h"
 #include "planner/plannodes/hash_join_plan_node.h"
 #include "planner/plannodes/output_schema.h"
+#include "planner/plannodes/plan_meta_data.h"
 
 namespace noisepage::execution::compiler {
 
@@ -21,6 +23,7 @@ HashJoinTranslator::HashJoinTranslator(const planner::HashJoinPlanNode &plan, Co
     // The ExecutionOperatingUnitType depends on whether it is the build pipeline or probe pipeline.
     : OperatorTranslator(plan, compilation_context, pipeline, selfdriving::ExecutionOperatingUnitType::DUMMY),
       join_consumer_flag_(false),
+      partitioned_(UsePartitionedJoin()),
       build_row_var_(GetCodeGen()->MakeFreshIdentifier("buildRow")),
       build_row_type_(GetCodeGen()->MakeFreshIdentifier("BuildRow")),
       build_mark_(GetCodeGen()->MakeFreshIdentifier("buildMark")),
@@ -56,16 +59,69 @@ HashJoinTranslator::HashJoinTranslator(const planner::HashJoinPlanNode &plan, Co
     local_join_ht_ = left_pipeline_.DeclarePipelineStateEntry("joinHashTable", join_ht_type);
   }
 
+  if (partitioned_) {
+    // The probe rows are materialized in their own join hash table, thread-local ones first if the probe is parallel.
+    global_probe_join_ht_ =
+        compilation_context->GetQueryState()->DeclareStateEntry(codegen, "probeJoinHashTable", join_ht_type);
+    local_probe_join_ht_ = pipeline->DeclarePipelineStateEntry("probeJoinHashTable", join_ht_type);
+    partitioned_join_fn_ = codegen->MakeFreshIdentifier(pipeline->CreatePipelineFunctionName("PartitionedJoin"));
+  }
+
   num_build_rows_ = CounterDeclare("num_build_rows", &left_pipeline_);
   num_probe_rows_ = CounterDeclare("num_probe_rows", pipeline);
   num_match_rows_ = CounterDeclare("num_match_rows", pipeline);
 
-  if (left_pipeline_.IsParallel() && IsPipelineMetricsEnabled()) {
+  if (left_pipeline_.IsParallel() && IsPipelineMetricsEnabled() && !partitioned_) {
     parallel_build_pre_hook_fn_ =
         GetCodeGen()->MakeFreshIdentifier(left_pipeline_.CreatePipelineFunctionName("PreHook"));
     parallel_build_post_hook_fn_ =
         GetCodeGen()->MakeFreshIdentifier(left_pipeline_.CreatePipelineFunctionName("PostHook"));
   }
+
+  if (EmitsUnmatchedBuildRows()) {
+    unmatched_left_rows_scan_fn_ =
+        GetCodeGen()->MakeFreshIdentifier(pipeline->CreatePipelineFunctionName("UnmatchedLeftRows"));
+  }
+
+  if (EmitsUnmatchedBuildRows() || partitioned_) {
+    // The unmatched build rows, or all joined rows in a partitioned join, are emitted after the parallel probe. The
+    // operators consuming them must not end their per-thread work before that.
+    pipeline->DeferEndParallelPipelineWork(this);
+  }
+}
+
+bool HashJoinTranslator::UsePartitionedJoin() const {
+  // Other join types track matches across probes, through marks or per probe row, so they probe one row at a time.
+  const auto &join_plan = GetPlanAs<planner::HashJoinPlanNode>();
+  if (join_plan.GetLogicalJoinType() != planner::LogicalJoinType::INNER) {
+    return false;
+  }
+
+  const auto plan_meta_data = GetCompilationContext()->GetPlanMetaData();
+  const auto build_plan_node_id = join_plan.GetChild(0)->GetPlanNodeId();
+  if (plan_meta_data == nullptr || !plan_meta_data->HasPlanNodeMetaData(build_plan_node_id)) {
+    return false;
+  }
+
+  // The build row holds every column of the build side.
+  const uint64_t num_build_rows = plan_meta_data->GetPlanNodeMetaData(build_plan_node_id).GetCardinality();
+  std::size_t build_row_size = 0;
+  for (const auto &col : join_plan.GetChild(0)->GetOutputSchema()->GetColumns()) {
+    build_row_size += sql::ValUtil::GetSqlSize(col.GetType());
+  }
+  return sql::JoinHashTable::ShouldPartitionJoin(num_build_rows, build_row_size);
+}
+
+bool HashJoinTranslator::IsOuterJoin() const { return EmitsUnmatchedBuildRows() || EmitsUnmatchedProbeRows(); }
+
+bool HashJoinTranslator::EmitsUnmatchedBuildRows() const {
+  const auto join_type = GetPlanAs<planner::HashJoinPlanNode>().GetLogicalJoinType();
+  return join_type == planner::LogicalJoinType::LEFT || join_type == planner::LogicalJoinType::OUTER;
+}
+
+bool HashJoinTranslator::EmitsUnmatchedProbeRows() const {
+  const auto join_type = GetPlanAs<planner::HashJoinPlanNode>().GetLogicalJoinType();
+  return join_type == planner::LogicalJoinType::RIGHT || join_type == planner::LogicalJoinType::OUTER;
 }
 
 void HashJoinTranslator::DefineHelperStructs(util::RegionVector<ast::StructDecl *> *decls) {
@@ -81,8 +137,8 @@ void HashJoinTranslator::DefineHelperStructs(util::RegionVector<ast::StructDecl
   struct_decl_ = struct_decl;
   decls->push_back(struct_decl);
 
-  /* Probe row declaration - only for left outer joins */
-  if (GetPlanAs<planner::HashJoinPlanNode>().GetLogicalJoinType() == planner::LogicalJoinType::LEFT) {
+  /* Probe row declaration - only for outer joins, and partitioned joins which materialize the probe side */
+  if (IsOuterJoin() || partitioned_) {
     // TODO(abalakum): support mini-runners for this struct as well
     fields = codegen->MakeEmptyFieldList();
     GetAllChildOutputFields(1, row_attr_prefix, &fields);
@@ -92,7 +148,7 @@ void HashJoinTranslator::DefineHelperStructs(util::RegionVector<ast::StructDecl
 }
 
 void HashJoinTranslator::DefineHelperFunctions(util::RegionVector<ast::FunctionDecl *> *decls) {
-  if (GetPlanAs<planner::HashJoinPlanNode>().GetLogicalJoinType() == planner::LogicalJoinType::LEFT) {
+  if (IsOuterJoin()) {
     auto cc = GetCompilationContext();
     auto *pipeline = GetPipeline();
     // Create a WorkContext and make the state identical to the WorkContext generated inside
@@ -112,6 +168,28 @@ void HashJoinTranslator::DefineHelperFunctions(util::RegionVector<ast::FunctionD
     join_consumer_flag_ = false;
     decls->push_back(function.Finish());
   }
+
+  if (partitioned_) {
+    decls->push_back(GeneratePartitionedJoinFunction());
+  }
+}
+
+ast::FunctionDecl *HashJoinTranslator::GeneratePartitionedJoinFunction() {
+  auto *codegen = GetCodeGen();
+  auto *pipeline = GetPipeline();
+
+  // The join hash table invokes this function on every pair of build and probe rows with equal hash values, so the
+  // rows are provided after the pipeline parameters, as in joinConsumer.
+  WorkContext ctx(GetCompilationContext(), *pipeline);
+  ctx.SetSource(this);
+  util::RegionVector<ast::FieldDecl *> params = pipeline->PipelineParams();
+  params.push_back(codegen->MakeField(build_row_var_, codegen->PointerType(build_row_type_)));
+  params.push_back(codegen->MakeField(probe_row_var_, codegen->PointerType(probe_row_type_)));
+  join_consumer_flag_ = true;
+  FunctionBuilder function(codegen, partitioned_join_fn_, std::move(params), codegen->Nil());
+  { CheckJoinPredicate(&ctx, &function, nullptr); }
+  join_consumer_flag_ = false;
+  return function.Finish();
 }
 
 ast::FunctionDecl *HashJoinTranslator::GenerateStartHookFunction() const {
@@ -152,14 +230,18 @@ ast::FunctionDecl *HashJoinTranslator::GenerateEndHookFunction() const {
 
 void HashJoinTranslator::DefineTLSDependentHelperFunctions(const Pipeline &pipeline,
                                                            util::RegionVector<ast::FunctionDecl *> *decls) {
-  if (IsLeftPipeline(pipeline) && left_pipeline_.IsParallel() && IsPipelineMetricsEnabled()) {
+  if (IsLeftPipeline(pipeline) && left_pipeline_.IsParallel() && IsPipelineMetricsEnabled() && !partitioned_) {
     decls->push_back(GenerateStartHookFunction());
     decls->push_back(GenerateEndHookFunction());
   }
+  if (IsRightPipeline(pipeline) && pipeline.IsParallel() && EmitsUnmatchedBuildRows()) {
+    decls->push_back(GenerateUnmatchedLeftRowsScanFunction());
+  }
 }
 
-void HashJoinTranslator::InitializeJoinHashTable(FunctionBuilder *function, ast::Expr *jht_ptr) const {
-  function->Append(GetCodeGen()->JoinHashTableInit(jht_ptr, GetExecutionContext(), build_row_type_));
+void HashJoinTranslator::InitializeJoinHashTable(FunctionBuilder *function, ast::Expr *jht_ptr,
+                                                 ast::Identifier row_type) const {
+  function->Append(GetCodeGen()->JoinHashTableInit(jht_ptr, GetExecutionContext(), row_type));
 }
 
 void HashJoinTranslator::TearDownJoinHashTable(FunctionBuilder *function, ast::Expr *jht_ptr) const {
@@ -168,16 +250,25 @@ void HashJoinTranslator::TearDownJoinHashTable(FunctionBuilder *function, ast::E
 
 void HashJoinTranslator::InitializeQueryState(FunctionBuilder *function) const {
   auto *codegen = GetCodeGen();
-  InitializeJoinHashTable(function, global_join_ht_.GetPtr(codegen));
+  InitializeJoinHashTable(function, global_join_ht_.GetPtr(codegen), build_row_type_);
+  if (partitioned_) {
+    InitializeJoinHashTable(function, global_probe_join_ht_.GetPtr(codegen), probe_row_type_);
+  }
 }
 
 void HashJoinTranslator::TearDownQueryState(FunctionBuilder *function) const {
   TearDownJoinHashTable(function, global_join_ht_.GetPtr(GetCodeGen()));
+  if (partitioned_) {
+    TearDownJoinHashTable(function, global_probe_join_ht_.GetPtr(GetCodeGen()));
+  }
 }
 
 void HashJoinTranslator::InitializePipelineState(const Pipeline &pipeline, FunctionBuilder *function) const {
   if (IsLeftPipeline(pipeline) && left_pipeline_.IsParallel()) {
-    InitializeJoinHashTable(function, local_join_ht_.GetPtr(GetCodeGen()));
+    InitializeJoinHashTable(function, local_join_ht_.GetPtr(GetCodeGen()), build_row_type_);
+  }
+  if (IsRightPipeline(pipeline) && pipeline.IsParallel() && partitioned_) {
+    InitializeJoinHashTable(function, local_probe_join_ht_.GetPtr(GetCodeGen()), probe_row_type_);
   }
 
   InitializeCounters(pipeline, function);
@@ -187,6 +278,9 @@ void HashJoinTranslator::TearDownPipelineState(const Pipeline &pipeline, Functio
   if (IsLeftPipeline(pipeline) && left_pipeline_.IsParallel()) {
     TearDownJoinHashTable(function, local_join_ht_.GetPtr(GetCodeGen()));
   }
+  if (IsRightPipeline(pipeline) && pipeline.IsParallel() && partitioned_) {
+    TearDownJoinHashTable(function, local_probe_join_ht_.GetPtr(GetCodeGen()));
+  }
 }
 
 void HashJoinTranslator::InitializeCounters(const Pipeline &pipeline, FunctionBuilder *function) const {
@@ -269,6 +363,25 @@ void HashJoinTranslator::FillProbeRow(WorkContext *ctx, FunctionBuilder *functio
   }
 }
 
+void HashJoinTranslator::FillNullRow(FunctionBuilder *function, ast::Expr *row, uint32_t child_idx) const {
+  auto *codegen = GetCodeGen();
+  const auto child_schema = GetPlan().GetChild(child_idx)->GetOutputSchema();
+  for (uint32_t attr_idx = 0; attr_idx < child_schema->GetColumns().size(); attr_idx++) {
+    ast::Expr *lhs = GetRowAttribute(row, attr_idx);
+    ast::Expr *rhs = codegen->ConstNull(child_schema->GetColumn(attr_idx).GetType());
+    function->Append(codegen->Assign(lhs, rhs));
+  }
+}
+
+void HashJoinTranslator::CallJoinConsumer(FunctionBuilder *function, ast::Expr *build_row,
+                                          ast::Expr *probe_row) const {
+  auto *codegen = GetCodeGen();
+  // joinConsumer(queryState, pipelineState, buildRow, probeRow);
+  std::initializer_list<ast::Expr *> args{GetQueryStatePtr(), codegen->MakeExpr(GetPipeline()->GetPipelineStateVar()),
+                                          build_row, probe_row};
+  function->Append(codegen->Call(join_consumer_, args));
+}
+
 void HashJoinTranslator::InsertIntoJoinHashTable(WorkContext *ctx, FunctionBuilder *function) const {
   auto *codegen = GetCodeGen();
 
@@ -287,6 +400,24 @@ void HashJoinTranslator::InsertIntoJoinHashTable(WorkContext *ctx, FunctionBuild
   CounterAdd(function, num_build_rows_, 1);
 }
 
+void HashJoinTranslator::InsertIntoProbeJoinHashTable(WorkContext *ctx, FunctionBuilder *function) const {
+  auto *codegen = GetCodeGen();
+
+  const auto probe_join_ht = ctx->GetPipeline().IsParallel() ? local_probe_join_ht_ : global_probe_join_ht_;
+
+  // var hashVal = @hash(...)
+  auto hash_val = HashKeys(ctx, function, GetPlanAs<planner::HashJoinPlanNode>().GetRightHashKeys());
+
+  // var probeRow = @joinHTInsert(...)
+  function->Append(codegen->DeclareVarWithInit(
+      probe_row_var_, codegen->JoinHashTableInsert(probe_join_ht.GetPtr(codegen), hash_val, probe_row_type_)));
+
+  // Fill row.
+  FillProbeRow(ctx, function, codegen->MakeExpr(probe_row_var_));
+
+  CounterAdd(function, num_probe_rows_, 1);
+}
+
 void HashJoinTranslator::ProbeJoinHashTable(WorkContext *ctx, FunctionBuilder *function) const {
   auto *codegen = GetCodeGen();
 
@@ -346,19 +477,42 @@ void HashJoinTranslator::ProbeJoinHashTable(WorkContext *ctx, FunctionBuilder *f
       right_semi_check.EndIf();
     }
   } else {
+    // For right and full outer joins, track whether the probe row found a match.
+    // var probeMatched = false
+    ast::Expr *probe_matched = nullptr;
+    if (EmitsUnmatchedProbeRows()) {
+      ast::Identifier probe_matched_var = codegen->MakeFreshIdentifier("probeMatched");
+      function->Append(codegen->DeclareVarWithInit(probe_matched_var, codegen->ConstBool(false)));
+      probe_matched = codegen->MakeExpr(probe_matched_var);
+    }
+
     // For regular joins: while (has_next)
     Loop entry_loop(function, lookup_call, has_next_call, nullptr);
     {
       // var buildRow = @ptrCast(*BuildRow, @htEntryIterGetRow())
       function->Append(
           codegen->DeclareVarWithInit(build_row_var_, codegen->HTEntryIterGetRow(entry_iter, build_row_type_)));
-      CheckJoinPredicate(ctx, function);
+      CheckJoinPredicate(ctx, function, probe_matched);
     }
     entry_loop.EndLoop();
+
+    if (EmitsUnmatchedProbeRows()) {
+      // if (!probeMatched)
+      If check_unmatched(function, codegen->UnaryOp(parsing::Token::Type::BANG, probe_matched));
+      {
+        // Fill probe row.
+        auto probe_row = codegen->MakeExpr(probe_row_var_);
+        function->Append(codegen->DeclareVarNoInit(probe_row_var_, codegen->MakeExpr(probe_row_type_)));
+        FillProbeRow(ctx, function, probe_row);
+        EmitUnmatchedProbeRow(function);
+      }
+      check_unmatched.EndIf();
+    }
   }
 }
 
-void HashJoinTranslator::CheckJoinPredicate(WorkContext *ctx, FunctionBuilder *function) const {
+void HashJoinTranslator::CheckJoinPredicate(WorkContext *ctx, FunctionBuilder *function,
+                                            ast::Expr *probe_matched) const {
   const auto &join_plan = GetPlanAs<planner::HashJoinPlanNode>();
   auto *codegen = GetCodeGen();
 
@@ -374,25 +528,34 @@ void HashJoinTranslator::CheckJoinPredicate(WorkContext *ctx, FunctionBuilder *f
   If check_condition(function, cond);
   {
     if (join_plan.RequiresLeftMark()) {
-      // Mark this tuple as accessed.
+      // Mark this tuple as accessed. Outer joins probe in parallel, and many
+      // probe rows can match the same build row, so only write the mark the
+      // first time to keep the build row's cache line shared afterwards.
       auto left_mark = codegen->AccessStructMember(codegen->MakeExpr(build_row_var_), build_mark_);
-      function->Append(codegen->Assign(left_mark, codegen->ConstBool(false)));
+      if (EmitsUnmatchedBuildRows()) {
+        If check_mark(function, left_mark);
+        function->Append(codegen->Assign(left_mark, codegen->ConstBool(false)));
+        check_mark.EndIf();
+      } else {
+        function->Append(codegen->Assign(left_mark, codegen->ConstBool(false)));
+      }
     }
 
-    // If left outer join, then call joinConsumer in order to reduce TPL code duplication,
+    if (probe_matched != nullptr) {
+      // probeMatched = true
+      function->Append(codegen->Assign(probe_matched, codegen->ConstBool(true)));
+    }
+
+    // If outer join, then call joinConsumer in order to reduce TPL code duplication,
     // otherwise just push to parent
-    if (join_plan.GetLogicalJoinType() == planner::LogicalJoinType::LEFT) {
+    if (IsOuterJoin()) {
       // var probeRow : ProbeRow
       auto probe_row_type = codegen->MakeExpr(probe_row_type_);
       auto probe_row = codegen->MakeExpr(probe_row_var_);
       function->Append(codegen->DeclareVarNoInit(probe_row_var_, probe_row_type));
       // Fill row.
       FillProbeRow(ctx, function, codegen->MakeExpr(probe_row_var_));
-      // joinConsumer(queryState, pipelineState, buildRow, probeRow);
-      std::initializer_list<ast::Expr *> args{GetQueryStatePtr(),
-                                              codegen->MakeExpr(GetPipeline()->GetPipelineStateVar()),
-                                              codegen->MakeExpr(build_row_var_), codegen->AddressOf(probe_row)};
-      function->Append(codegen->Call(join_consumer_, args));
+      CallJoinConsumer(function, codegen->MakeExpr(build_row_var_), codegen->AddressOf(probe_row));
     } else {
       // Just push forward
       ctx->Push(function);
@@ -419,6 +582,41 @@ void HashJoinTranslator::CheckRightMark(WorkContext *ctx, FunctionBuilder *funct
   check_condition.EndIf();
 }
 
+void HashJoinTranslator::EmitUnmatchedProbeRow(FunctionBuilder *function) const {
+  auto *codegen = GetCodeGen();
+
+  // var nullBuildRow : BuildRow
+  auto null_build_row_var = codegen->MakeFreshIdentifier("nullBuildRow");
+  auto null_build_row = codegen->MakeExpr(null_build_row_var);
+  function->Append(codegen->DeclareVarNoInit(null_build_row_var, codegen->MakeExpr(build_row_type_)));
+  // Fill build row with NULLs
+  FillNullRow(function, null_build_row, 0);
+  CallJoinConsumer(function, codegen->AddressOf(null_build_row), codegen->AddressOf(codegen->MakeExpr(probe_row_var_)));
+}
+
+void HashJoinTranslator::EmitUnmatchedBuildRow(FunctionBuilder *function, ast::Expr *jht_iter) const {
+  auto *codegen = GetCodeGen();
+
+  // var buildRow = @joinHTIterGetRow()
+  function->Append(
+      codegen->DeclareVarWithInit(build_row_var_, codegen->JoinHTIteratorGetRow(jht_iter, build_row_type_)));
+
+  auto left_mark = codegen->AccessStructMember(codegen->MakeExpr(build_row_var_), build_mark_);
+
+  // If mark is true, then row was not matched
+  If check_condition(function, left_mark);
+  {
+    // var probeRow : ProbeRow
+    auto probe_row_type = codegen->MakeExpr(probe_row_type_);
+    auto probe_row = codegen->MakeExpr(probe_row_var_);
+    function->Append(codegen->DeclareVarNoInit(probe_row_var_, probe_row_type));
+    // Fill probe row with NULLs
+    FillNullRow(function, probe_row, 1);
+    CallJoinConsumer(function, codegen->MakeExpr(build_row_var_), codegen->AddressOf(probe_row));
+  }
+  check_condition.EndIf();
+}
+
 void HashJoinTranslator::CollectUnmatchedLeftRows(FunctionBuilder *function) const {
   auto *codegen = GetCodeGen();
 
@@ -438,47 +636,44 @@ void HashJoinTranslator::CollectUnmatchedLeftRows(FunctionBuilder *function) con
   Loop loop(function, codegen->MakeStmt(codegen->JoinHTIteratorInit(jht_iter_expr, jht)),
             codegen->JoinHTIteratorHasNext(jht_iter_expr),
             codegen->MakeStmt(codegen->JoinHTIteratorNext(jht_iter_expr)));
-  {
-    // var buildRow = @joinHTIterGetRow()
-    function->Append(
-        codegen->DeclareVarWithInit(build_row_var_, codegen->JoinHTIteratorGetRow(jht_iter_expr, build_row_type_)));
-
-    auto left_mark = codegen->AccessStructMember(codegen->MakeExpr(build_row_var_), build_mark_);
-
-    // If mark is true, then row was not matched
-    If check_condition(function, left_mark);
-    {
-      // var probeRow : ProbeRow
-      auto probe_row_type = codegen->MakeExpr(probe_row_type_);
-      auto probe_row = codegen->MakeExpr(probe_row_var_);
-      function->Append(codegen->DeclareVarNoInit(probe_row_var_, probe_row_type));
-      // Fill probe row with NULLs
-      const auto child_schema = GetPlan().GetChild(1)->GetOutputSchema();
-      for (uint32_t attr_idx = 0; attr_idx < child_schema->GetColumns().size(); attr_idx++) {
-        auto type = child_schema->GetColumn(attr_idx).GetType();
-        ast::Expr *lhs = GetRowAttribute(probe_row, attr_idx);
-        ast::Expr *rhs = GetCodeGen()->ConstNull(type);
-        function->Append(codegen->Assign(lhs, rhs));
-      }
-      // joinConsumer(queryState, pipelineState, buildRow, probeRow);
-      std::initializer_list<ast::Expr *> args{GetQueryStatePtr(),
-                                              codegen->MakeExpr(GetPipeline()->GetPipelineStateVar()),
-                                              codegen->MakeExpr(build_row_var_), codegen->AddressOf(probe_row)};
-      function->Append(codegen->Call(join_consumer_, args));
-    }
-  }
+  { EmitUnmatchedBuildRow(function, jht_iter_expr); }
   loop.EndLoop();
 
   // Close iterator.
   function->Append(codegen->JoinHTIteratorFree(jht_iter_expr));
 }
 
+ast::FunctionDecl *HashJoinTranslator::GenerateUnmatchedLeftRowsScanFunction() const {
+  auto *codegen = GetCodeGen();
+  const auto &pipeline = *GetPipeline();
+
+  // The iterator over the morsel to scan is provided after the pipeline parameters.
+  auto params = pipeline.PipelineParams();
+  auto jht_iter = codegen->MakeFreshIdentifier("joinHTIter");
+  params.push_back(codegen->MakeField(jht_iter, codegen->PointerType(ast::BuiltinType::JoinHashTableIterator)));
+
+  FunctionBuilder builder(codegen, unmatched_left_rows_scan_fn_, std::move(params), codegen->Nil());
+  {
+    // The iterator is positioned at the start of the morsel already.
+    auto jht_iter_expr = codegen->MakeExpr(jht_iter);
+    Loop loop(&builder, static_cast<ast::Stmt *>(nullptr), codegen->JoinHTIteratorHasNext(jht_iter_expr),
+              codegen->MakeStmt(codegen->JoinHTIteratorNext(jht_iter_expr)));
+    { EmitUnmatchedBuildRow(&builder, jht_iter_expr); }
+    loop.EndLoop();
+  }
+  return builder.Finish();
+}
+
 void HashJoinTranslator::PerformPipelineWork(WorkContext *ctx, FunctionBuilder *function) const {
   if (IsLeftPipeline(ctx->GetPipeline())) {
     InsertIntoJoinHashTable(ctx, function);
   } else {
     NOISEPAGE_ASSERT(IsRightPipeline(ctx->GetPipeline()), "Pipeline is unknown to join translator");
-    ProbeJoinHashTable(ctx, function);
+    if (partitioned_) {
+      InsertIntoProbeJoinHashTable(ctx, function);
+    } else {
+      ProbeJoinHashTable(ctx, function);
+    }
   }
 }
 
@@ -488,7 +683,16 @@ void HashJoinTranslator::FinishPipelineWork(const Pipeline &pipeline, FunctionBu
   if (IsLeftPipeline(pipeline)) {
     ast::Expr *jht = global_join_ht_.GetPtr(codegen);
 
-    if (left_pipeline_.IsParallel()) {
+    if (partitioned_) {
+      // The table is built when it's joined, after the probe side is materialized. Until then, it only takes the
+      // tuples of the thread-local tables.
+      if (left_pipeline_.IsParallel()) {
+        auto *offset = local_join_ht_.OffsetFromState(codegen);
+        function->Append(codegen->JoinHashTableMoveTuplesParallel(jht, GetThreadStateContainer(), offset));
+      } else {
+        RecordCounters(pipeline, function);
+      }
+    } else if (left_pipeline_.IsParallel()) {
       if (IsPipelineMetricsEnabled()) {
         // Setup the hooks
         auto *exec_ctx = GetExecutionContext();
@@ -513,8 +717,35 @@ void HashJoinTranslator::FinishPipelineWork(const Pipeline &pipeline, FunctionBu
       RecordCounters(pipeline, function);
     }
   } else {
-    if (GetPlanAs<planner::HashJoinPlanNode>().GetLogicalJoinType() == planner::LogicalJoinType::LEFT) {
-      CollectUnmatchedLeftRows(function);
+    if (partitioned_) {
+      // Build and join both sides, radix-partitioned if the build side turns out to be larger than the cache. Each
+      // thread emits the joined rows into its own pipeline state. The pipeline runs the deferred end-of-work logic of
+      // the consumers on every thread state afterwards.
+      ast::Expr *jht = global_join_ht_.GetPtr(codegen);
+      ast::Expr *probe_jht = global_probe_join_ht_.GetPtr(codegen);
+      if (pipeline.IsParallel()) {
+        auto *offset = local_probe_join_ht_.OffsetFromState(codegen);
+        function->Append(codegen->JoinHashTableMoveTuplesParallel(probe_jht, GetThreadStateContainer(), offset));
+        function->Append(codegen->JoinHashTableBuildAndJoinParallel(jht, probe_jht, GetQueryStatePtr(),
+                                                                    GetThreadStateContainer(), partitioned_join_fn_));
+      } else {
+        auto *pipeline_state = codegen->MakeExpr(GetPipeline()->GetPipelineStateVar());
+        function->Append(codegen->JoinHashTableBuildAndJoin(jht, probe_jht, GetQueryStatePtr(), pipeline_state,
+                                                            partitioned_join_fn_));
+      }
+    }
+
+    if (EmitsUnmatchedBuildRows()) {
+      if (pipeline.IsParallel()) {
+        // Scan the join hash table in parallel, each thread emitting the
+        // unmatched rows into its own pipeline state. The pipeline runs the
+        // deferred end-of-work logic of the consumers on every thread state
+        // afterwards.
+        function->Append(codegen->JoinHashTableParallelScan(global_join_ht_.GetPtr(codegen), GetQueryStatePtr(),
+                                                            GetThreadStateContainer(), unmatched_left_rows_scan_fn_));
+      } else {
+        CollectUnmatchedLeftRows(function);
+      }
     }
 
     if (!pipeline.IsParallel()) {
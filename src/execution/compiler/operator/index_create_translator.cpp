@@ -31,10 +31,17 @@ IndexCreateTranslator::IndexCreateTranslator(const planner::CreateIndexPlanNode
       all_oids_(AllColOids(table_schema_)),
       index_oid_(
           codegen_->GetCatalogAccessor()->GetIndexOid(GetPlanAs<planner::CreateIndexPlanNode>().GetIndexName())) {
+  for (uint16_t i = 0; i < all_oids_.size(); i++) {
+    oid_offset_[all_oids_[i]] = i;
+  }
+
   const auto &index_schema = codegen_->GetCatalogAccessor()->GetIndexSchema(index_oid_);
   for (const auto &index_col : index_schema.GetColumns()) {
     compilation_context->Prepare(*index_col.StoredExpression());
   }
+  if (index_schema.Partial()) {
+    compilation_context->Prepare(*index_schema.Predicate());
+  }
   pipeline->RegisterSource(this, Pipeline::Parallelism::Parallel);
 
   // col_oids is a global array
@@ -128,9 +135,12 @@ void IndexCreateTranslator::LaunchWork(FunctionBuilder *function, ast::Identifie
     function->Append(codegen->ExecCtxRegisterHook(exec_ctx, post, parallel_build_post_hook_fn_));
   }
 
+  // The scan uses its own number of threads, since CREATE INDEX usually runs alone, e.g., after a bulk load.
+  const auto num_threads = GetCompilationContext()->GetExecutionSettings().GetNumberOfIndexBuildThreads();
   ast::Expr *iter_table_parallel = codegen_->CallBuiltin(
-      ast::Builtin::TableIterParallel, {codegen_->Const32(table_oid_.UnderlyingValue()), global_col_oids_.Get(codegen_),
-                                        GetQueryStatePtr(), GetExecutionContext(), codegen_->MakeExpr(work_func)});
+      ast::Builtin::TableIterParallel,
+      {codegen_->Const32(table_oid_.UnderlyingValue()), global_col_oids_.Get(codegen_), GetQueryStatePtr(),
+       GetExecutionContext(), codegen_->MakeExpr(work_func), codegen_->Const32(num_threads)});
   iter_table_parallel->SetType(ast::BuiltinType::Get(codegen_->GetAstContext().Get(), ast::BuiltinType::Nil));
   function->Append(iter_table_parallel);
 
@@ -150,6 +160,7 @@ void IndexCreateTranslator::PerformPipelineWork(WorkContext *context, FunctionBu
   // Close TVI, if need be.
   if (declare_local_tvi) {
     function->Append(codegen_->TableIterClose(codegen_->MakeExpr(tvi_var_)));
+    IndexBulkLoad(function);
     if (IsPipelineMetricsEnabled()) {
       auto *codegen = GetCodeGen();
 
@@ -171,6 +182,13 @@ void IndexCreateTranslator::PerformPipelineWork(WorkContext *context, FunctionBu
   }
 }
 
+void IndexCreateTranslator::FinishPipelineWork(const Pipeline &pipeline, FunctionBuilder *function) const {
+  // The EndHook runs after every worker is done, so that its metrics cover the bulk load.
+  if (pipeline.IsParallel() && !IsPipelineMetricsEnabled()) {
+    IndexBulkLoad(function);
+  }
+}
+
 void IndexCreateTranslator::SetGlobalOids(FunctionBuilder *function, ast::Expr *global_col_oids) const {
   for (uint64_t i = 0; i < all_oids_.size(); i++) {
     // col_oids_var_[i] = col_oid
@@ -234,8 +252,6 @@ void IndexCreateTranslator::ScanVPI(WorkContext *ctx, FunctionBuilder *function,
       auto assign = codegen_->Assign(local_tuple_slot_.Get(codegen_), make_slot);
       function->Append(assign);
       IndexInsert(ctx, function);
-      // We expect create index to be the end of a pipeline, so no need to push to parent
-      CounterAdd(function, num_inserts_, 1);
     }
     vpi_loop.EndLoop();
   };
@@ -248,39 +264,57 @@ void IndexCreateTranslator::IndexInsert(WorkContext *ctx, FunctionBuilder *funct
   const auto &index_schema = codegen_->GetCatalogAccessor()->GetIndexSchema(index_oid_);
   auto *index_pr_expr = local_index_pr_.Get(codegen_);
 
-  std::unordered_map<catalog::col_oid_t, uint16_t> oid_offset;
-  for (uint16_t i = 0; i < all_oids_.size(); i++) {
-    oid_offset[all_oids_[i]] = i;
-  }
+  auto gen_index_insert = [&]() {
+    for (const auto &index_col : index_schema.GetColumns()) {
+      // The key is evaluated over the scanned tuple, see GetTableColumn().
+      // @prSet(insert_index_pr, attr_type, attr_idx, nullable, attr_index, col_expr, false)
+      const auto &col_expr = ctx->DeriveValue(*index_col.StoredExpression(), this);
+      uint16_t attr_offset = index_pm.at(index_col.Oid());
+      type::TypeId attr_type = index_col.Type();
+      bool nullable = index_col.Nullable();
+      auto *set_key_call = codegen_->PRSet(index_pr_expr, attr_type, nullable, attr_offset, col_expr, false);
+      function->Append(codegen_->MakeStmt(set_key_call));
+    }
 
-  for (const auto &index_col : index_schema.GetColumns()) {
-    auto stored_expr = index_col.StoredExpression();
-    NOISEPAGE_ASSERT(stored_expr->GetExpressionType() == parser::ExpressionType::COLUMN_VALUE,
-                     "CREATE INDEX supported on base columns only");
-
-    // col_expr comes from the base table so we need to use TableSchema to get the correct scan_offset.
-    // col_expr = @VPIGet(vpi_var_, attr_sql_type, true, oid)
-    auto cve = stored_expr.CastManagedPointerTo<const parser::ColumnValueExpression>();
-    NOISEPAGE_ASSERT(cve->GetColumnOid() != catalog::INVALID_COLUMN_OID, "CREATE INDEX column oid not bound");
-    NOISEPAGE_ASSERT(oid_offset.find(cve->GetColumnOid()) != oid_offset.end(), "CREATE INDEX missing column scan");
-    auto &tbl_col = table_schema_.GetColumn(cve->GetColumnOid());
-    auto sql_type = sql::GetTypeId(tbl_col.Type());
-    auto scan_offset = oid_offset[cve->GetColumnOid()];
-    const auto &col_expr = codegen_->VPIGet(codegen_->MakeExpr(vpi_var_), sql_type, tbl_col.Nullable(), scan_offset);
-
-    // @prSet(insert_index_pr, attr_type, attr_idx, nullable, attr_index, col_expr, false)
-    uint16_t attr_offset = index_pm.at(index_col.Oid());
-    type::TypeId attr_type = index_col.Type();
-    bool nullable = index_col.Nullable();
-    auto *set_key_call = codegen_->PRSet(index_pr_expr, attr_type, nullable, attr_offset, col_expr, false);
-    function->Append(codegen_->MakeStmt(set_key_call));
+    // The entry is only staged here, and the index is built once the scan is done, see IndexBulkLoad().
+    // if (!@indexBulkLoadStage(&local_storage_interface, &local_tuple_slot)) { Abort(); }
+    auto *index_stage_call =
+        codegen_->CallBuiltin(ast::Builtin::IndexBulkLoadStage,
+                              {local_storage_interface_.GetPtr(codegen_), local_tuple_slot_.GetPtr(codegen_)});
+    auto *cond = codegen_->UnaryOp(parsing::Token::Type::BANG, index_stage_call);
+    If success(function, cond);
+    { function->Append(codegen_->AbortTxn(GetExecutionContext())); }
+    success.EndIf();
+
+    // We expect create index to be the end of a pipeline, so no need to push to parent
+    CounterAdd(function, num_inserts_, 1);
+  };
+
+  if (index_schema.Partial()) {
+    // A partial index only gets the tuples that satisfy its predicate.
+    // if (predicate) { ... }
+    If partial(function, ctx->DeriveValue(*index_schema.Predicate(), this));
+    gen_index_insert();
+    partial.EndIf();
+  } else {
+    gen_index_insert();
   }
+}
+
+ast::Expr *IndexCreateTranslator::GetTableColumn(catalog::col_oid_t col_oid) const {
+  // col_expr comes from the base table so we need to use TableSchema to get the correct scan_offset.
+  // @VPIGet(vpi_var_, attr_sql_type, nullable, scan_offset)
+  NOISEPAGE_ASSERT(oid_offset_.find(col_oid) != oid_offset_.end(), "CREATE INDEX missing column scan");
+  const auto &tbl_col = table_schema_.GetColumn(col_oid);
+  auto sql_type = sql::GetTypeId(tbl_col.Type());
+  return codegen_->VPIGet(codegen_->MakeExpr(vpi_var_), sql_type, tbl_col.Nullable(), oid_offset_.at(col_oid));
+}
 
-  // if (!@IndexInsertWithSlot(&local_storage_interface, &local_tuple_slot, unique)) { Abort(); }
-  auto *index_insert_call = codegen_->CallBuiltin(
-      ast::Builtin::IndexInsertWithSlot, {local_storage_interface_.GetPtr(codegen_), local_tuple_slot_.GetPtr(codegen_),
-                                          codegen_->ConstBool(index_schema.Unique())});
-  auto *cond = codegen_->UnaryOp(parsing::Token::Type::BANG, index_insert_call);
+void IndexCreateTranslator::IndexBulkLoad(FunctionBuilder *function) const {
+  // if (!@indexBulkLoad(&local_storage_interface)) { Abort(); }
+  auto *bulk_load_call =
+      codegen_->CallBuiltin(ast::Builtin::IndexBulkLoad, {local_storage_interface_.GetPtr(codegen_)});
+  auto *cond = codegen_->UnaryOp(parsing::Token::Type::BANG, bulk_load_call);
   If success(function, cond);
   { function->Append(codegen_->AbortTxn(GetExecutionContext())); }
   success.EndIf();
@@ -296,6 +330,7 @@ ast::FunctionDecl *IndexCreateTranslator::GenerateEndHookFunction() const {
   {
     auto *exec_ctx = GetExecutionContext();
     pipeline->InjectStartResourceTracker(&builder, true);
+    IndexBulkLoad(&builder);
 
     auto num_tuples = codegen->MakeFreshIdentifier("num_tuples");
     auto *idx_size = codegen->CallBuiltin(ast::Builtin::IndexGetSize, {local_storage_interface_.GetPtr(codegen_)});
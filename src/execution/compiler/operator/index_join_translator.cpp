@@ -9,6 +9,7 @@
 #include "execution/compiler/if.h"
 #include "execution/compiler/loop.h"
 #include "execution/compiler/operator/operator_translator.h"
+#include "execution/compiler/operator/seq_scan_translator.h"
 #include "execution/compiler/work_context.h"
 #include "planner/plannodes/index_join_plan_node.h"
 #include "storage/index/index.h"
@@ -43,6 +44,13 @@ IndexJoinTranslator::IndexJoinTranslator(const planner::IndexJoinPlanNode &plan,
   }
 
   compilation_context->Prepare(*GetPlan().GetChild(0), pipeline);
+  // The batched lookup only finds exact keys.
+  const auto &child = *GetPlan().GetChild(0);
+  if (child.GetPlanNodeType() == planner::PlanNodeType::SEQSCAN &&
+      plan.GetScanType() == planner::IndexScanType::Exact) {
+    vectorized_scan_ = static_cast<const SeqScanTranslator *>(compilation_context->LookupTranslator(child));
+    pipeline->UpdateVectorization(Pipeline::Vectorization::Enabled);
+  }
   index_size_ = CounterDeclare("index_size", pipeline);
   num_scans_index_ = CounterDeclare("num_scans_index", pipeline);
   num_loops_ = CounterDeclare("num_loops", pipeline);
@@ -65,13 +73,26 @@ void IndexJoinTranslator::PerformPipelineWork(WorkContext *context, FunctionBuil
   // var lo_index_pr = @indexIteratorGetLoPR(&index_iter)
   // var hi_index_pr = @indexIteratorGetHiPR(&index_iter)
   DeclareIndexPR(function);
-  // @prSet(lo_index_pr, ...)
-  FillKey(context, function, lo_index_pr_, op.GetLoIndexColumns());
-  // @prSet(hi_index_pr, ...)
-  FillKey(context, function, hi_index_pr_, op.GetHiIndexColumns());
 
-  // @indexIteratorScanKey(&index_iter)
-  ast::Expr *scan_call = GetCodeGen()->IndexIteratorScan(index_iter_, op.GetScanType(), 0);
+  if (vectorized_scan_ != nullptr) {
+    PerformVectorizedWork(context, function);
+  } else {
+    // @prSet(lo_index_pr, ...)
+    FillKey(context, function, lo_index_pr_, op.GetLoIndexColumns());
+    // @prSet(hi_index_pr, ...)
+    FillKey(context, function, hi_index_pr_, op.GetHiIndexColumns());
+    // @indexIteratorScanKey(&index_iter)
+    JoinOuterTuple(context, function, GetCodeGen()->IndexIteratorScan(index_iter_, op.GetScanType(), 0));
+  }
+
+  CounterSetExpr(function, index_size_,
+                 GetCodeGen()->CallBuiltin(ast::Builtin::IndexIteratorGetSize, {GetCodeGen()->AddressOf(index_iter_)}));
+  // @indexIteratorFree(&index_iter_)
+  FreeIterator(function);
+}
+
+void IndexJoinTranslator::JoinOuterTuple(WorkContext *context, FunctionBuilder *function, ast::Expr *scan_call) const {
+  const auto &op = GetPlanAs<planner::IndexJoinPlanNode>();
   ast::Stmt *loop_init = GetCodeGen()->MakeStmt(scan_call);
   // @indexIteratorAdvance(&index_iter)
   ast::Expr *advance_call =
@@ -79,7 +100,7 @@ void IndexJoinTranslator::PerformPipelineWork(WorkContext *context, FunctionBuil
 
   CounterAdd(function, num_loops_, 1);
 
-  // for (@indexIteratorScanKey(&index_iter); @indexIteratorAdvance(&index_iter);)
+  // for (scan_call; @indexIteratorAdvance(&index_iter);)
   Loop loop(function, loop_init, advance_call, nullptr);
   {
     // var table_pr = @indexIteratorGetTablePR(&index_iter)
@@ -102,11 +123,50 @@ void IndexJoinTranslator::PerformPipelineWork(WorkContext *context, FunctionBuil
     CounterAdd(function, num_scans_index_, 1);
   }
   loop.EndLoop();
+}
 
-  CounterSetExpr(function, index_size_,
-                 GetCodeGen()->CallBuiltin(ast::Builtin::IndexIteratorGetSize, {GetCodeGen()->AddressOf(index_iter_)}));
-  // @indexIteratorFree(&index_iter_)
-  FreeIterator(function);
+void IndexJoinTranslator::PerformVectorizedWork(WorkContext *context, FunctionBuilder *function) const {
+  const auto &op = GetPlanAs<planner::IndexJoinPlanNode>();
+  auto *codegen = GetCodeGen();
+  ast::Expr *vpi = vectorized_scan_->GetVPI();
+  const bool filtered = vectorized_scan_->HasPredicate();
+
+  // for (; @vpiHasNext(vpi); @vpiAdvance(vpi)) {
+  //   @prSet(lo_index_pr, ...)
+  //   @indexIteratorAddBatchKey(&index_iter)
+  // }
+  Loop key_loop(function, nullptr, codegen->VPIHasNext(vpi, filtered),
+                codegen->MakeStmt(codegen->VPIAdvance(vpi, filtered)));
+  {
+    FillKey(context, function, lo_index_pr_, op.GetLoIndexColumns());
+    function->Append(codegen->CallBuiltin(ast::Builtin::IndexIteratorAddBatchKey, {codegen->AddressOf(index_iter_)}));
+  }
+  key_loop.EndLoop();
+  // The values derived for the keys may be local to the loop.
+  context->ClearExpressionCache();
+
+  // @indexIteratorScanKeyBatch(&index_iter)
+  function->Append(codegen->CallBuiltin(ast::Builtin::IndexIteratorScanKeyBatch, {codegen->AddressOf(index_iter_)}));
+
+  // Go over the VPI again, and join every outer tuple with the result of its key.
+  // @vpiReset(vpi)
+  // var key_idx = 0
+  function->Append(codegen->CallBuiltin(filtered ? ast::Builtin::VPIResetFiltered : ast::Builtin::VPIReset, {vpi}));
+  ast::Identifier key_idx = codegen->MakeFreshIdentifier("key_idx");
+  function->Append(codegen->DeclareVarWithInit(key_idx, codegen->Const32(0)));
+  Loop join_loop(function, nullptr, codegen->VPIHasNext(vpi, filtered),
+                 codegen->MakeStmt(codegen->VPIAdvance(vpi, filtered)));
+  {
+    // @indexIteratorSelectBatchResult(&index_iter, key_idx)
+    JoinOuterTuple(context, function,
+                   codegen->CallBuiltin(ast::Builtin::IndexIteratorSelectBatchResult,
+                                        {codegen->AddressOf(index_iter_), codegen->MakeExpr(key_idx)}));
+    // key_idx = key_idx + 1
+    function->Append(codegen->Assign(
+        codegen->MakeExpr(key_idx),
+        codegen->BinaryOp(parsing::Token::Type::PLUS, codegen->MakeExpr(key_idx), codegen->Const32(1))));
+  }
+  join_loop.EndLoop();
 }
 
 void IndexJoinTranslator::FinishPipelineWork(const Pipeline &pipeline, FunctionBuilder *function) const {
@@ -10,6 +10,7 @@
 #include "execution/compiler/loop.h"
 #include "execution/compiler/operator/operator_translator.h"
 #include "execution/compiler/work_context.h"
+#include "parser/expression/column_value_expression.h"
 #include "planner/plannodes/index_scan_plan_node.h"
 #include "storage/index/index.h"
 #include "storage/sql_table.h"
@@ -29,8 +30,19 @@ IndexScanTranslator::IndexScanTranslator(const planner::IndexScanPlanNode &plan,
       lo_index_pr_(GetCodeGen()->MakeFreshIdentifier("lo_index_pr")),
       hi_index_pr_(GetCodeGen()->MakeFreshIdentifier("hi_index_pr")),
       table_pr_(GetCodeGen()->MakeFreshIdentifier("table_pr")),
+      key_pr_(GetCodeGen()->MakeFreshIdentifier("key_pr")),
       slot_(GetCodeGen()->MakeFreshIdentifier("slot")) {
   pipeline->RegisterSource(this, Pipeline::Parallelism::Serial);
+  if (plan.GetIndexOnly()) {
+    // Map the table columns to the key attributes, whose expressions are the columns of the table.
+    for (const auto &key_col : index_schema_.GetColumns()) {
+      auto cve = key_col.StoredExpression().CastManagedPointerTo<const parser::ColumnValueExpression>();
+      auto col_oid = cve->GetColumnOid() != catalog::INVALID_COLUMN_OID
+                         ? cve->GetColumnOid()
+                         : table_schema_.GetColumn(cve->GetColumnName()).Oid();
+      key_pm_.emplace(col_oid, index_pm_.at(key_col.Oid()));
+    }
+  }
   if (plan.GetScanPredicate() != nullptr) {
     compilation_context->Prepare(*plan.GetScanPredicate());
   }
@@ -82,8 +94,8 @@ void IndexScanTranslator::PerformPipelineWork(WorkContext *context, FunctionBuil
   }
 
   // @indexIteratorScanKey(&pipelineState.indexIterator)
-  ast::Expr *scan_call =
-      GetCodeGen()->IndexIteratorScan(index_iter_.GetPtr(GetCodeGen()), op.GetScanType(), op.GetScanLimit());
+  ast::Expr *scan_call = GetCodeGen()->IndexIteratorScan(index_iter_.GetPtr(GetCodeGen()), op.GetScanType(),
+                                                         op.GetScanLimit(), op.GetIndexOnly());
   ast::Stmt *loop_init = GetCodeGen()->MakeStmt(scan_call);
   // @indexIteratorAdvance(&pipelineState.indexIterator)
   ast::Expr *advance_call =
@@ -92,8 +104,13 @@ void IndexScanTranslator::PerformPipelineWork(WorkContext *context, FunctionBuil
   // for (@indexIteratorScanKey(&index_iter); @indexIteratorAdvance(&index_iter);)
   Loop loop(function, loop_init, advance_call, nullptr);
   {
-    // var table_pr = @indexIteratorGetTablePR(&pipelineState.indexIterator)
-    DeclareTablePR(function);
+    if (!op.GetIndexOnly()) {
+      // var table_pr = @indexIteratorGetTablePR(&pipelineState.indexIterator)
+      DeclareTablePR(function);
+    } else if (op.GetScanType() != planner::IndexScanType::Exact) {
+      // var key_pr = @indexIteratorGetKeyPR(&pipelineState.indexIterator)
+      DeclareKeyPR(function);
+    }
     // var slot = @indexIteratorGetSlot(&pipelineState.indexIterator)
     DeclareSlot(function);
 
@@ -123,9 +140,16 @@ void IndexScanTranslator::PerformPipelineWork(WorkContext *context, FunctionBuil
 }
 
 ast::Expr *IndexScanTranslator::GetTableColumn(catalog::col_oid_t col_oid) const {
-  // @prGet(table_pr, type, nullable, attr_idx)
   auto type = table_schema_.GetColumn(col_oid).Type();
   auto nullable = table_schema_.GetColumn(col_oid).Nullable();
+  const auto &op = GetPlanAs<planner::IndexScanPlanNode>();
+  if (op.GetIndexOnly()) {
+    // Exact scans only return tuples whose key is the probe key.
+    // @prGet(key_pr or index_pr, type, nullable, attr_idx)
+    auto pr = op.GetScanType() == planner::IndexScanType::Exact ? index_pr_ : key_pr_;
+    return GetCodeGen()->PRGet(GetCodeGen()->MakeExpr(pr), type, nullable, key_pm_.at(col_oid));
+  }
+  // @prGet(table_pr, type, nullable, attr_idx)
   uint16_t attr_idx = table_pm_.find(col_oid)->second;
   return GetCodeGen()->PRGet(GetCodeGen()->MakeExpr(table_pr_), type, nullable, attr_idx);
 }
@@ -185,6 +209,13 @@ void IndexScanTranslator::DeclareTablePR(noisepage::execution::compiler::Functio
   builder->Append(GetCodeGen()->DeclareVar(table_pr_, nullptr, get_pr_call));
 }
 
+void IndexScanTranslator::DeclareKeyPR(noisepage::execution::compiler::FunctionBuilder *builder) const {
+  // var key_pr = @indexIteratorGetKeyPR(&pipelineState.indexIterator)
+  ast::Expr *get_pr_call =
+      GetCodeGen()->CallBuiltin(ast::Builtin::IndexIteratorGetKeyPR, {index_iter_.GetPtr(GetCodeGen())});
+  builder->Append(GetCodeGen()->DeclareVar(key_pr_, nullptr, get_pr_call));
+}
+
 void IndexScanTranslator::DeclareSlot(noisepage::execution::compiler::FunctionBuilder *builder) const {
   // var slot = @indexIteratorGetSlot(&pipelineState.indexIterator)
   ast::Expr *get_slot_call =
@@ -58,6 +58,9 @@ InsertTranslator::InsertTranslator(const planner::InsertPlanNode &plan, Compilat
     for (const auto &index_col : index_schema.GetColumns()) {
       compilation_context->Prepare(*index_col.StoredExpression());
     }
+    if (index_schema.Partial()) {
+      compilation_context->Prepare(*index_schema.Predicate());
+    }
   }
 
   num_inserts_ = CounterDeclare("num_inserts", pipeline);
@@ -108,6 +111,12 @@ void InsertTranslator::PerformPipelineWork(WorkContext *context, FunctionBuilder
   FeatureArithmeticRecordMul(function, context->GetPipeline(), GetTranslatorId(), CounterVal(num_inserts_));
 }
 
+void InsertTranslator::FinishPipelineWork(const Pipeline &pipeline, FunctionBuilder *function) const {
+  if (!GetPlanAs<planner::InsertPlanNode>().GetIndexOids().empty()) {
+    GenIndexFlushBatches(function);
+  }
+}
+
 void InsertTranslator::TearDownPipelineState(const Pipeline &pipeline, FunctionBuilder *function) const {
   GenInserterFree(function);
 }
@@ -124,7 +133,15 @@ void InsertTranslator::PerformInsertWork(
   function->Append(GetCodeGen()->ExecCtxAddRowsAffected(GetExecutionContext(), 1));
   const auto &index_oids = GetPlanAs<planner::InsertPlanNode>().GetIndexOids();
   for (const auto &index_oid : index_oids) {
-    GenIndexInsert(context, function, index_oid);
+    const auto &index_schema = GetCodeGen()->GetCatalogAccessor()->GetIndexSchema(index_oid);
+    if (index_schema.Partial()) {
+      // A partial index only gets the tuples that satisfy its predicate.
+      If partial(function, context->DeriveValue(*index_schema.Predicate(), this));
+      GenIndexInsert(context, function, index_oid);
+      partial.EndIf();
+    } else {
+      GenIndexInsert(context, function, index_oid);
+    }
   }
 }
 
@@ -250,15 +267,26 @@ void InsertTranslator::GenIndexInsert(WorkContext *context, FunctionBuilder *bui
     builder->Append(GetCodeGen()->MakeStmt(set_key_call));
   }
 
-  // if (!@indexInsert(&pipelineState.storageInterface)) { abortTxn(queryState.execCtx); }
-  const auto &builtin = index_schema.Unique() ? ast::Builtin::IndexInsertUnique : ast::Builtin::IndexInsert;
-  auto *index_insert_call = GetCodeGen()->CallBuiltin(builtin, {si_inserter_.GetPtr(GetCodeGen())});
+  // The entry is only staged here, and inserted together with the other entries of the index once the batch is full
+  // or the pipeline is done, see GenIndexFlushBatches(). The index enforces uniqueness when it inserts the batch.
+  // if (!@indexInsertBatch(&pipelineState.storageInterface)) { abortTxn(queryState.execCtx); }
+  auto *index_insert_call =
+      GetCodeGen()->CallBuiltin(ast::Builtin::IndexInsertBatch, {si_inserter_.GetPtr(GetCodeGen())});
   auto *cond = GetCodeGen()->UnaryOp(parsing::Token::Type::BANG, index_insert_call);
   If success(builder, cond);
   { builder->Append(GetCodeGen()->AbortTxn(GetExecutionContext())); }
   success.EndIf();
 }
 
+void InsertTranslator::GenIndexFlushBatches(FunctionBuilder *builder) const {
+  // if (!@indexFlushBatches(&pipelineState.storageInterface)) { abortTxn(queryState.execCtx); }
+  auto *flush_call = GetCodeGen()->CallBuiltin(ast::Builtin::IndexFlushBatches, {si_inserter_.GetPtr(GetCodeGen())});
+  auto *cond = GetCodeGen()->UnaryOp(parsing::Token::Type::BANG, flush_call);
+  If success(builder, cond);
+  { builder->Append(GetCodeGen()->AbortTxn(GetExecutionContext())); }
+  success.EndIf();
+}
+
 std::vector<catalog::col_oid_t> InsertTranslator::AllColOids(const catalog::Schema &table_schema) {
   std::vector<catalog::col_oid_t> oids;
   for (const auto &col : table_schema.GetColumns()) {
@@ -230,12 +230,6 @@ void SeqScanTranslator::ScanVPI(WorkContext *ctx, FunctionBuilder *function, ast
   };
   // TODO(Amadou): What if the predicate doesn't filter out anything?
   gen_vpi_loop(HasPredicate());
-
-  // var vpi_num_tuples = @tableIterGetNumTuples(tvi)
-  ast::Identifier vpi_num_tuples = codegen->MakeFreshIdentifier("vpi_num_tuples");
-  function->Append(codegen->DeclareVarWithInit(
-      vpi_num_tuples, codegen->CallBuiltin(ast::Builtin::TableIterGetVPINumTuples, {codegen->MakeExpr(tvi_var_)})));
-  CounterAdd(function, num_scans_, vpi_num_tuples);
 }
 
 void SeqScanTranslator::ScanTable(WorkContext *ctx, FunctionBuilder *function) const {
@@ -255,7 +249,16 @@ void SeqScanTranslator::ScanTable(WorkContext *ctx, FunctionBuilder *function) c
 
     if (!ctx->GetPipeline().IsVectorized()) {
       ScanVPI(ctx, function, vpi);
+    } else {
+      // The parent consumes the whole (filtered) vector projection at once.
+      ctx->Push(function);
     }
+
+    // var vpi_num_tuples = @tableIterGetNumTuples(tvi)
+    ast::Identifier vpi_num_tuples = codegen->MakeFreshIdentifier("vpi_num_tuples");
+    function->Append(codegen->DeclareVarWithInit(
+        vpi_num_tuples, codegen->CallBuiltin(ast::Builtin::TableIterGetVPINumTuples, {codegen->MakeExpr(tvi_var_)})));
+    CounterAdd(function, num_scans_, vpi_num_tuples);
   }
   tvi_loop.EndLoop();
 }
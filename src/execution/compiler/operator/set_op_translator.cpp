@@ -0,0 +1,461 @@
+#include "execution/compiler/operator/set_op_translator.h"
+
+#include <string>
+#include <vector>
+
+#include "execution/compiler/codegen.h"
+#include "execution/compiler/compilation_context.h"
+#include "execution/compiler/function_builder.h"
+#include "execution/compiler/if.h"
+#include "execution/compiler/loop.h"
+#include "execution/compiler/work_context.h"
+#include "execution/exec/execution_settings.h"
+#include "planner/plannodes/set_op_plan_node.h"
+
+namespace noisepage::execution::compiler {
+
+namespace {
+constexpr char ROW_ATTR_PREFIX[] = "attr";
+constexpr char LEFT_COUNT_ATTR[] = "leftCount";
+constexpr char RIGHT_COUNT_ATTR[] = "rightCount";
+}  // namespace
+
+SetOpTranslator::SetOpTranslator(const planner::SetOpPlanNode &plan, CompilationContext *compilation_context,
+                                 Pipeline *pipeline)
+    : OperatorTranslator(plan, compilation_context, pipeline, selfdriving::ExecutionOperatingUnitType::DUMMY),
+      row_var_(GetCodeGen()->MakeFreshIdentifier("setOpRow")),
+      row_type_(GetCodeGen()->MakeFreshIdentifier("SetOpRow")),
+      key_check_fn_(GetCodeGen()->MakeFreshIdentifier(pipeline->CreatePipelineFunctionName("KeyCheck"))),
+      merge_partitions_fn_(GetCodeGen()->MakeFreshIdentifier(pipeline->CreatePipelineFunctionName("MergePartitions"))),
+      left_pipeline_(this, Pipeline::Parallelism::Parallel),
+      right_pipeline_(this, Pipeline::Parallelism::Parallel) {
+  NOISEPAGE_ASSERT(plan.GetChildrenSize() == 2, "Set operations should have exactly two children");
+  NOISEPAGE_ASSERT(plan.GetSetOp() != planner::SetOpType::INVALID, "Invalid set operation");
+  NOISEPAGE_ASSERT(plan.GetChild(0)->GetOutputSchema()->NumColumns() ==
+                       plan.GetChild(1)->GetOutputSchema()->NumColumns(),
+                   "Both inputs of a set operation should have the same schema");
+
+  // The inputs can only be partitioned if the set can be produced in parallel. Otherwise, both inputs would insert
+  // into the global hash table, which must be done serially.
+  if (!pipeline->IsParallel() || !compilation_context->GetExecutionSettings().GetIsParallelQueryExecutionEnabled()) {
+    left_pipeline_.UpdateParallelism(Pipeline::Parallelism::Serial);
+    right_pipeline_.UpdateParallelism(Pipeline::Parallelism::Serial);
+  }
+
+  // The right input is counted after the left input, and the set is produced after both.
+  right_pipeline_.LinkSourcePipeline(&left_pipeline_);
+  pipeline->LinkSourcePipeline(&right_pipeline_);
+
+  // Prepare the children.
+  compilation_context->Prepare(*plan.GetChild(0), &left_pipeline_);
+  compilation_context->Prepare(*plan.GetChild(1), &right_pipeline_);
+
+  // If either input is parallel, both inputs build partitioned tables and the set is produced in parallel.
+  partitioned_ = left_pipeline_.IsParallel() || right_pipeline_.IsParallel();
+  pipeline->RegisterSource(this, partitioned_ ? Pipeline::Parallelism::Parallel : Pipeline::Parallelism::Serial);
+
+  // Declare the global hash table.
+  auto *codegen = GetCodeGen();
+  ast::Expr *ht_type = codegen->BuiltinType(ast::BuiltinType::AggregationHashTable);
+  global_ht_ = compilation_context->GetQueryState()->DeclareStateEntry(codegen, "setOpHashTable", ht_type);
+
+  // In partitioned mode, declare a local hash table in each input pipeline, too.
+  if (partitioned_) {
+    left_local_ht_ = left_pipeline_.DeclarePipelineStateEntry("setOpHashTable", ht_type);
+    right_local_ht_ = right_pipeline_.DeclarePipelineStateEntry("setOpHashTable", ht_type);
+  }
+}
+
+bool SetOpTranslator::IsUnionAll() const { return GetSetOpPlan().GetSetOp() == planner::SetOpType::UNION_ALL; }
+
+bool SetOpTranslator::TracksCounts() const {
+  const auto set_op = GetSetOpPlan().GetSetOp();
+  return set_op != planner::SetOpType::UNION && set_op != planner::SetOpType::UNION_ALL;
+}
+
+ast::StructDecl *SetOpTranslator::GenerateRowStruct() {
+  auto *codegen = GetCodeGen();
+  const auto *input_schema = GetSetOpPlan().GetChild(0)->GetOutputSchema().Get();
+  auto fields = codegen->MakeEmptyFieldList();
+  fields.reserve(input_schema->NumColumns() + 2);
+
+  // Create a field for every input attribute.
+  for (uint32_t attr_idx = 0; attr_idx < input_schema->NumColumns(); attr_idx++) {
+    auto field_name = codegen->MakeIdentifier(ROW_ATTR_PREFIX + std::to_string(attr_idx));
+    auto type = codegen->TplType(sql::GetTypeId(input_schema->GetColumn(attr_idx).GetType()));
+    fields.push_back(codegen->MakeField(field_name, type));
+  }
+
+  // Create the counts of the row on either side, if needed.
+  if (TracksCounts()) {
+    fields.push_back(codegen->MakeField(codegen->MakeIdentifier(LEFT_COUNT_ATTR), codegen->Int64Type()));
+    fields.push_back(codegen->MakeField(codegen->MakeIdentifier(RIGHT_COUNT_ATTR), codegen->Int64Type()));
+  }
+
+  return codegen->DeclareStruct(row_type_, std::move(fields));
+}
+
+void SetOpTranslator::DefineHelperStructs(util::RegionVector<ast::StructDecl *> *decls) {
+  decls->push_back(GenerateRowStruct());
+}
+
+ast::FunctionDecl *SetOpTranslator::GenerateKeyCheckFunction() {
+  auto *codegen = GetCodeGen();
+  auto lhs_arg = codegen->MakeIdentifier("lhs");
+  auto rhs_arg = codegen->MakeIdentifier("rhs");
+  auto params = codegen->MakeFieldList({
+      codegen->MakeField(lhs_arg, codegen->PointerType(row_type_)),
+      codegen->MakeField(rhs_arg, codegen->PointerType(row_type_)),
+  });
+  auto ret_type = codegen->BuiltinType(ast::BuiltinType::Kind::Bool);
+  FunctionBuilder builder(codegen, key_check_fn_, std::move(params), ret_type);
+  {
+    // Set operations treat NULLs as equal to each other, so check NULL-ness before comparing values.
+    const auto num_attrs = GetSetOpPlan().GetChild(0)->GetOutputSchema()->NumColumns();
+    for (uint32_t attr_idx = 0; attr_idx < num_attrs; attr_idx++) {
+      auto lhs_null = codegen->CallBuiltin(ast::Builtin::IsValNull, {GetRowAttribute(lhs_arg, attr_idx)});
+      auto rhs_null = codegen->CallBuiltin(ast::Builtin::IsValNull, {GetRowAttribute(rhs_arg, attr_idx)});
+      If check_lhs_null(&builder, lhs_null);
+      {
+        If check_rhs_not_null(&builder, codegen->UnaryOp(parsing::Token::Type::BANG, rhs_null));
+        builder.Append(codegen->Return(codegen->ConstBool(false)));
+      }
+      check_lhs_null.Else();
+      {
+        If check_rhs_null(&builder, rhs_null);
+        builder.Append(codegen->Return(codegen->ConstBool(false)));
+        check_rhs_null.EndIf();
+        auto lhs = GetRowAttribute(lhs_arg, attr_idx);
+        auto rhs = GetRowAttribute(rhs_arg, attr_idx);
+        If check_match(&builder, codegen->Compare(parsing::Token::Type::BANG_EQUAL, lhs, rhs));
+        builder.Append(codegen->Return(codegen->ConstBool(false)));
+      }
+      check_lhs_null.EndIf();
+    }
+    builder.Append(codegen->Return(codegen->ConstBool(true)));
+  }
+  return builder.Finish();
+}
+
+void SetOpTranslator::MergeOverflowPartitions(FunctionBuilder *function, ast::Expr *set_op_ht, ast::Expr *iter) {
+  auto *codegen = GetCodeGen();
+
+  Loop loop(function, nullptr, codegen->AggPartitionIteratorHasNext(iter),
+            codegen->MakeStmt(codegen->AggPartitionIteratorNext(iter)));
+  {
+    // UNION ALL keeps every row, so every overflow entry is linked as is.
+    if (IsUnionAll()) {
+      function->Append(codegen->AggHashTableLinkEntry(set_op_ht, codegen->AggPartitionIteratorGetRowEntry(iter)));
+      loop.EndLoop();
+      return;
+    }
+
+    // Get hash from overflow entry.
+    auto hash_val = codegen->MakeFreshIdentifier("hashVal");
+    function->Append(codegen->DeclareVarWithInit(hash_val, codegen->AggPartitionIteratorGetHash(iter)));
+
+    // Get the partial row from the overflow entry.
+    auto partial_row = codegen->MakeFreshIdentifier("partialRow");
+    function->Append(codegen->DeclareVarWithInit(partial_row, codegen->AggPartitionIteratorGetRow(iter, row_type_)));
+
+    // Perform lookup.
+    auto lookup_result = codegen->MakeFreshIdentifier("setOpRow");
+    function->Append(codegen->DeclareVarWithInit(
+        lookup_result, codegen->AggHashTableLookup(set_op_ht, codegen->MakeExpr(hash_val), key_check_fn_,
+                                                   codegen->MakeExpr(partial_row), row_type_)));
+
+    If check_found(function, codegen->IsNilPointer(codegen->MakeExpr(lookup_result)));
+    {
+      // Link entry.
+      function->Append(codegen->AggHashTableLinkEntry(set_op_ht, codegen->AggPartitionIteratorGetRowEntry(iter)));
+    }
+    if (TracksCounts()) {
+      check_found.Else();
+      {
+        // Merge the partial counts.
+        for (const bool left : {true, false}) {
+          auto sum = codegen->BinaryOp(parsing::Token::Type::PLUS, GetRowCount(lookup_result, left),
+                                       GetRowCount(partial_row, left));
+          function->Append(codegen->Assign(GetRowCount(lookup_result, left), sum));
+        }
+      }
+    }
+    check_found.EndIf();
+  }
+  loop.EndLoop();
+}
+
+ast::FunctionDecl *SetOpTranslator::GenerateMergeOverflowPartitionsFunction() {
+  // The partition merge function has the following signature:
+  // (*QueryState, *AggregationHashTable, *AHTOverflowPartitionIterator) -> nil
+
+  auto *codegen = GetCodeGen();
+  auto params = GetCompilationContext()->QueryParams();
+
+  // Then the hash table and the overflow partition iterator.
+  auto set_op_ht = codegen->MakeIdentifier("setOpHashTable");
+  auto overflow_iter = codegen->MakeIdentifier("ahtOvfIter");
+  params.push_back(codegen->MakeField(set_op_ht, codegen->PointerType(ast::BuiltinType::AggregationHashTable)));
+  params.push_back(
+      codegen->MakeField(overflow_iter, codegen->PointerType(ast::BuiltinType::AHTOverflowPartitionIterator)));
+
+  auto ret_type = codegen->BuiltinType(ast::BuiltinType::Kind::Nil);
+  FunctionBuilder builder(codegen, merge_partitions_fn_, std::move(params), ret_type);
+  {
+    // Main merging logic.
+    MergeOverflowPartitions(&builder, codegen->MakeExpr(set_op_ht), codegen->MakeExpr(overflow_iter));
+  }
+  return builder.Finish();
+}
+
+void SetOpTranslator::DefineHelperFunctions(util::RegionVector<ast::FunctionDecl *> *decls) {
+  // UNION ALL never looks up a row.
+  if (!IsUnionAll()) {
+    decls->push_back(GenerateKeyCheckFunction());
+  }
+  if (partitioned_) {
+    decls->push_back(GenerateMergeOverflowPartitionsFunction());
+  }
+}
+
+void SetOpTranslator::InitializeQueryState(FunctionBuilder *function) const {
+  auto *codegen = GetCodeGen();
+  function->Append(codegen->AggHashTableInit(global_ht_.GetPtr(codegen), GetExecutionContext(), row_type_));
+}
+
+void SetOpTranslator::TearDownQueryState(FunctionBuilder *function) const {
+  auto *codegen = GetCodeGen();
+  function->Append(codegen->AggHashTableFree(global_ht_.GetPtr(codegen)));
+}
+
+void SetOpTranslator::InitializePipelineState(const Pipeline &pipeline, FunctionBuilder *function) const {
+  if (partitioned_ && !IsProducePipeline(pipeline)) {
+    auto *codegen = GetCodeGen();
+    const auto &local_ht = IsLeftPipeline(pipeline) ? left_local_ht_ : right_local_ht_;
+    function->Append(codegen->AggHashTableInit(local_ht.GetPtr(codegen), GetExecutionContext(), row_type_));
+  }
+}
+
+void SetOpTranslator::TearDownPipelineState(const Pipeline &pipeline, FunctionBuilder *function) const {
+  if (partitioned_ && !IsProducePipeline(pipeline)) {
+    auto *codegen = GetCodeGen();
+    const auto &local_ht = IsLeftPipeline(pipeline) ? left_local_ht_ : right_local_ht_;
+    function->Append(codegen->AggHashTableFree(local_ht.GetPtr(codegen)));
+  }
+}
+
+ast::Expr *SetOpTranslator::GetRowAttribute(ast::Identifier row, uint32_t attr_idx) const {
+  auto *codegen = GetCodeGen();
+  auto member = codegen->MakeIdentifier(ROW_ATTR_PREFIX + std::to_string(attr_idx));
+  return codegen->AccessStructMember(codegen->MakeExpr(row), member);
+}
+
+ast::Expr *SetOpTranslator::GetRowCount(ast::Identifier row, bool left) const {
+  auto *codegen = GetCodeGen();
+  auto member = codegen->MakeIdentifier(left ? LEFT_COUNT_ATTR : RIGHT_COUNT_ATTR);
+  return codegen->AccessStructMember(codegen->MakeExpr(row), member);
+}
+
+void SetOpTranslator::InsertInputRow(WorkContext *context, FunctionBuilder *function, ast::Expr *set_op_ht) const {
+  auto *codegen = GetCodeGen();
+  const bool left = IsLeftPipeline(context->GetPipeline());
+  const uint32_t child_idx = left ? 0 : 1;
+  const auto num_attrs = GetSetOpPlan().GetChild(child_idx)->GetOutputSchema()->NumColumns();
+
+  // var setOpValues : SetOpRow
+  auto values = codegen->MakeFreshIdentifier("setOpValues");
+  function->Append(codegen->DeclareVarNoInit(values, codegen->MakeExpr(row_type_)));
+  for (uint32_t attr_idx = 0; attr_idx < num_attrs; attr_idx++) {
+    auto rhs = OperatorTranslator::GetChildOutput(context, child_idx, attr_idx);
+    function->Append(codegen->Assign(GetRowAttribute(values, attr_idx), rhs));
+  }
+
+  // var hashVal = @hash(...)
+  std::vector<ast::Expr *> keys;
+  keys.reserve(num_attrs);
+  for (uint32_t attr_idx = 0; attr_idx < num_attrs; attr_idx++) {
+    keys.push_back(GetRowAttribute(values, attr_idx));
+  }
+  auto hash_val = codegen->MakeFreshIdentifier("hashVal");
+  function->Append(codegen->DeclareVarWithInit(hash_val, codegen->Hash(keys)));
+
+  // Insert a new row and copy the input attributes into it.
+  auto row = codegen->MakeFreshIdentifier("setOpRow");
+  const auto insert_new_row = [&]() {
+    auto insert_call = codegen->AggHashTableInsert(set_op_ht, codegen->MakeExpr(hash_val), partitioned_, row_type_);
+    function->Append(codegen->Assign(codegen->MakeExpr(row), insert_call));
+    for (uint32_t attr_idx = 0; attr_idx < num_attrs; attr_idx++) {
+      function->Append(codegen->Assign(GetRowAttribute(row, attr_idx), GetRowAttribute(values, attr_idx)));
+    }
+    if (TracksCounts()) {
+      function->Append(codegen->Assign(GetRowCount(row, true), codegen->Const64(0)));
+      function->Append(codegen->Assign(GetRowCount(row, false), codegen->Const64(0)));
+    }
+  };
+  const auto count_row = [&]() {
+    if (TracksCounts()) {
+      auto increment = codegen->BinaryOp(parsing::Token::Type::PLUS, GetRowCount(row, left), codegen->Const64(1));
+      function->Append(codegen->Assign(GetRowCount(row, left), increment));
+    }
+  };
+
+  // UNION ALL concatenates its inputs, so every input row gets its own entry.
+  if (IsUnionAll()) {
+    function->Append(codegen->DeclareVarNoInit(row, codegen->PointerType(row_type_)));
+    insert_new_row();
+    return;
+  }
+
+  // var setOpRow = @ptrCast(*SetOpRow, @aggHTLookup())
+  auto lookup_call = codegen->AggHashTableLookup(set_op_ht, codegen->MakeExpr(hash_val), key_check_fn_,
+                                                 codegen->AddressOf(codegen->MakeExpr(values)), row_type_);
+  function->Append(codegen->DeclareVarWithInit(row, lookup_call));
+
+  // When the inputs are not partitioned, the left input is fully counted in the global table before the right input
+  // starts. Rows that only appear on the right cannot contribute to INTERSECT or EXCEPT, so they are not inserted.
+  if (!left && !partitioned_ && TracksCounts()) {
+    If check_found(function, codegen->Compare(parsing::Token::Type::BANG_EQUAL, codegen->MakeExpr(row),
+                                              codegen->Nil()));
+    count_row();
+    check_found.EndIf();
+    return;
+  }
+
+  If check_new_row(function, codegen->IsNilPointer(codegen->MakeExpr(row)));
+  insert_new_row();
+  check_new_row.EndIf();
+  count_row();
+}
+
+void SetOpTranslator::EmitRow(WorkContext *context, FunctionBuilder *function) const {
+  auto *codegen = GetCodeGen();
+  auto left_count = [&]() { return GetRowCount(row_var_, true); };
+  auto right_count = [&]() { return GetRowCount(row_var_, false); };
+
+  switch (GetSetOpPlan().GetSetOp()) {
+    case planner::SetOpType::UNION:
+    case planner::SetOpType::UNION_ALL: {
+      // Every row in the table is emitted once.
+      context->Push(function);
+      break;
+    }
+    case planner::SetOpType::INTERSECT:
+    case planner::SetOpType::EXCEPT: {
+      // if (setOpRow.leftCount > 0 and setOpRow.rightCount [>|==] 0)
+      const auto right_op = GetSetOpPlan().GetSetOp() == planner::SetOpType::INTERSECT
+                                ? parsing::Token::Type::GREATER
+                                : parsing::Token::Type::EQUAL_EQUAL;
+      auto in_left = codegen->Compare(parsing::Token::Type::GREATER, left_count(), codegen->Const64(0));
+      auto in_right = codegen->Compare(right_op, right_count(), codegen->Const64(0));
+      If check_emit(function, codegen->BinaryOp(parsing::Token::Type::AND, in_left, in_right));
+      context->Push(function);
+      check_emit.EndIf();
+      break;
+    }
+    case planner::SetOpType::INTERSECT_ALL:
+    case planner::SetOpType::EXCEPT_ALL: {
+      // INTERSECT ALL emits min(leftCount, rightCount) copies of the row:
+      //   for (var copy = 0; copy < leftCount and copy < rightCount; copy = copy + 1)
+      // EXCEPT ALL emits max(leftCount - rightCount, 0) copies of the row:
+      //   for (var copy = rightCount; copy < leftCount; copy = copy + 1)
+      const bool intersect = GetSetOpPlan().GetSetOp() == planner::SetOpType::INTERSECT_ALL;
+      auto copy = codegen->MakeFreshIdentifier("copy");
+      function->Append(
+          codegen->DeclareVar(copy, codegen->Int64Type(), intersect ? codegen->Const64(0) : right_count()));
+      ast::Expr *cond = codegen->Compare(parsing::Token::Type::LESS, codegen->MakeExpr(copy), left_count());
+      if (intersect) {
+        auto below_right = codegen->Compare(parsing::Token::Type::LESS, codegen->MakeExpr(copy), right_count());
+        cond = codegen->BinaryOp(parsing::Token::Type::AND, cond, below_right);
+      }
+      auto next = codegen->BinaryOp(parsing::Token::Type::PLUS, codegen->MakeExpr(copy), codegen->Const64(1));
+      Loop loop(function, nullptr, cond, codegen->Assign(codegen->MakeExpr(copy), next));
+      context->Push(function);
+      loop.EndLoop();
+      break;
+    }
+    default:
+      UNREACHABLE("Impossible set operation");
+  }
+}
+
+void SetOpTranslator::ScanHashTable(WorkContext *context, FunctionBuilder *function, ast::Expr *set_op_ht) const {
+  auto *codegen = GetCodeGen();
+
+  // var iterBase: AHTIterator
+  ast::Identifier aht_iter_base = codegen->MakeFreshIdentifier("iterBase");
+  ast::Expr *aht_iter_type = codegen->BuiltinType(ast::BuiltinType::AHTIterator);
+  function->Append(codegen->DeclareVarNoInit(aht_iter_base, aht_iter_type));
+
+  // var ahtIter = &ahtIterBase
+  ast::Identifier aht_iter = codegen->MakeFreshIdentifier("iter");
+  ast::Expr *aht_iter_init = codegen->AddressOf(codegen->MakeExpr(aht_iter_base));
+  function->Append(codegen->DeclareVarWithInit(aht_iter, aht_iter_init));
+
+  Loop loop(function, codegen->MakeStmt(codegen->AggHashTableIteratorInit(codegen->MakeExpr(aht_iter), set_op_ht)),
+            codegen->AggHashTableIteratorHasNext(codegen->MakeExpr(aht_iter)),
+            codegen->MakeStmt(codegen->AggHashTableIteratorNext(codegen->MakeExpr(aht_iter))));
+  {
+    // var setOpRow = @ahtIterGetRow()
+    function->Append(codegen->DeclareVarWithInit(
+        row_var_, codegen->AggHashTableIteratorGetRow(codegen->MakeExpr(aht_iter), row_type_)));
+    EmitRow(context, function);
+  }
+  loop.EndLoop();
+
+  // Close iterator.
+  function->Append(codegen->AggHashTableIteratorClose(codegen->MakeExpr(aht_iter)));
+}
+
+void SetOpTranslator::PerformPipelineWork(WorkContext *context, FunctionBuilder *function) const {
+  auto *codegen = GetCodeGen();
+  const auto &pipeline = context->GetPipeline();
+  if (IsLeftPipeline(pipeline) || IsRightPipeline(pipeline)) {
+    const auto &set_op_ht = !partitioned_ ? global_ht_ : IsLeftPipeline(pipeline) ? left_local_ht_ : right_local_ht_;
+    InsertInputRow(context, function, set_op_ht.GetPtr(codegen));
+  } else {
+    NOISEPAGE_ASSERT(IsProducePipeline(pipeline), "Pipeline is unknown to set operation translator");
+    if (GetPipeline()->IsParallel()) {
+      // In parallel-mode, we would've issued a parallel partitioned scan. The hash table partition we're to scan is
+      // the last argument in the worker function which we're generating right now.
+      auto set_op_ht_param_position = GetPipeline()->PipelineParams().size();
+      ScanHashTable(context, function, function->GetParameterByPosition(set_op_ht_param_position));
+    } else {
+      ScanHashTable(context, function, global_ht_.GetPtr(codegen));
+    }
+  }
+}
+
+void SetOpTranslator::FinishPipelineWork(const Pipeline &pipeline, FunctionBuilder *function) const {
+  if (partitioned_ && !IsProducePipeline(pipeline)) {
+    // Move the partitions of this input into the global table. They are merged by the partitioned scan.
+    auto *codegen = GetCodeGen();
+    const auto &local_ht = IsLeftPipeline(pipeline) ? left_local_ht_ : right_local_ht_;
+    function->Append(codegen->AggHashTableMovePartitions(global_ht_.GetPtr(codegen), GetThreadStateContainer(),
+                                                         local_ht.OffsetFromState(codegen), merge_partitions_fn_));
+  }
+}
+
+ast::Expr *SetOpTranslator::GetChildOutput(WorkContext *context, uint32_t child_idx, uint32_t attr_idx) const {
+  if (IsProducePipeline(context->GetPipeline())) {
+    // Rows from either input are read out of the hash table.
+    return GetRowAttribute(row_var_, attr_idx);
+  }
+  // The request is in one of the input pipelines. Forward to child translator.
+  return OperatorTranslator::GetChildOutput(context, child_idx, attr_idx);
+}
+
+util::RegionVector<ast::FieldDecl *> SetOpTranslator::GetWorkerParams() const {
+  NOISEPAGE_ASSERT(partitioned_, "Should not issue parallel scan if the inputs aren't partitioned.");
+  auto *codegen = GetCodeGen();
+  return codegen->MakeFieldList({codegen->MakeField(codegen->MakeIdentifier("setOpHashTable"),
+                                                    codegen->PointerType(ast::BuiltinType::AggregationHashTable))});
+}
+
+void SetOpTranslator::LaunchWork(FunctionBuilder *function, ast::Identifier work_func_name) const {
+  NOISEPAGE_ASSERT(partitioned_, "Should not issue parallel scan if the inputs aren't partitioned.");
+  auto *codegen = GetCodeGen();
+  function->Append(codegen->AggHashTableParallelScan(global_ht_.GetPtr(codegen), GetQueryStatePtr(),
+                                                     GetThreadStateContainer(), work_func_name));
+}
+
+}  // namespace noisepage::execution::compiler
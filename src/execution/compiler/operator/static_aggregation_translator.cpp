@@ -5,13 +5,23 @@
 #include "execution/compiler/compilation_context.h"
 #include "execution/compiler/function_builder.h"
 #include "execution/compiler/if.h"
+#include "execution/compiler/operator/seq_scan_translator.h"
 #include "execution/compiler/work_context.h"
+#include "parser/expression/column_value_expression.h"
+#include "parser/expression/derived_value_expression.h"
 #include "planner/plannodes/aggregate_plan_node.h"
+#include "planner/plannodes/output_schema.h"
 
 namespace noisepage::execution::compiler {
 
 namespace {
 constexpr char AGG_ATTR_PREFIX[] = "agg_term_attr";
+
+// COUNT(*) is a COUNT of the star expression.
+bool IsCountStar(const parser::AggregateExpression &term) {
+  return term.GetExpressionType() == parser::ExpressionType::AGGREGATE_COUNT &&
+         term.GetChild(0)->GetExpressionType() == parser::ExpressionType::STAR;
+}
 }  // namespace
 
 StaticAggregationTranslator::StaticAggregationTranslator(const planner::AggregatePlanNode &plan,
@@ -47,6 +57,10 @@ StaticAggregationTranslator::StaticAggregationTranslator(const planner::Aggregat
   // Prepare the child.
   compilation_context->Prepare(*plan.GetChild(0), &build_pipeline_);
 
+  if (PrepareVectorizedAggregation()) {
+    build_pipeline_.UpdateVectorization(Pipeline::Vectorization::Enabled);
+  }
+
   // If there's a having clause, prepare it, too.
   if (const auto having_clause = plan.GetHavingClausePredicate(); having_clause != nullptr) {
     compilation_context->Prepare(*having_clause);
@@ -235,6 +249,86 @@ void StaticAggregationTranslator::UpdateGlobalAggregate(WorkContext *ctx, Functi
   }
 }
 
+bool StaticAggregationTranslator::PrepareVectorizedAggregation() {
+  const auto &plan = GetAggPlan();
+  const auto &child = *plan.GetChild(0);
+  if (child.GetPlanNodeType() != planner::PlanNodeType::SEQSCAN || !distinct_filters_.empty()) {
+    return false;
+  }
+  const auto *scan = static_cast<const SeqScanTranslator *>(GetCompilationContext()->LookupTranslator(child));
+
+  std::vector<uint32_t> col_idxs;
+  col_idxs.reserve(plan.GetAggregateTerms().size());
+  for (const auto &term : plan.GetAggregateTerms()) {
+    const auto agg_type = term->GetExpressionType();
+    if (IsCountStar(*term)) {
+      col_idxs.push_back(0);
+      continue;
+    }
+    if (agg_type != parser::ExpressionType::AGGREGATE_COUNT && agg_type != parser::ExpressionType::AGGREGATE_SUM &&
+        agg_type != parser::ExpressionType::AGGREGATE_MIN && agg_type != parser::ExpressionType::AGGREGATE_MAX &&
+        agg_type != parser::ExpressionType::AGGREGATE_AVG) {
+      return false;
+    }
+
+    // The input must be a column of the scanned table, possibly through the scan's output.
+    auto input = term->GetChild(0);
+    if (input->GetExpressionType() == parser::ExpressionType::VALUE_TUPLE) {
+      const auto dve = input.CastManagedPointerTo<parser::DerivedValueExpression>();
+      if (dve->GetTupleIdx() != 0) {
+        return false;
+      }
+      input = child.GetOutputSchema()->GetColumn(dve->GetValueIdx()).GetExpr();
+    }
+    if (input->GetExpressionType() != parser::ExpressionType::COLUMN_VALUE) {
+      return false;
+    }
+
+    // COUNT accepts any column, the other aggregates need a numeric one.
+    switch (input->GetReturnValueType()) {
+      case type::TypeId::TINYINT:
+      case type::TypeId::SMALLINT:
+      case type::TypeId::INTEGER:
+      case type::TypeId::BIGINT:
+      case type::TypeId::REAL:
+        break;
+      default:
+        if (agg_type != parser::ExpressionType::AGGREGATE_COUNT) {
+          return false;
+        }
+    }
+
+    const auto col_oid = input.CastManagedPointerTo<parser::ColumnValueExpression>()->GetColumnOid();
+    col_idxs.push_back(scan->GetColOidIndex(col_oid));
+  }
+
+  vectorized_scan_ = scan;
+  vectorized_col_idxs_ = std::move(col_idxs);
+  return true;
+}
+
+void StaticAggregationTranslator::UpdateGlobalAggregateVectorized(FunctionBuilder *function) const {
+  auto *codegen = GetCodeGen();
+
+  const auto agg_payload = build_pipeline_.IsParallel() ? local_aggs_ : global_aggs_;
+
+  ast::Expr *vpi = vectorized_scan_->GetVPI();
+  for (uint32_t term_idx = 0; term_idx < GetAggPlan().GetAggregateTerms().size(); term_idx++) {
+    auto agg_payload_ptr = GetAggregateTermPtr(agg_payload.Get(codegen), term_idx);
+    if (IsCountStar(*GetAggPlan().GetAggregateTerms()[term_idx])) {
+      function->Append(codegen->AggregatorAdvanceVector(agg_payload_ptr, vpi));
+    } else {
+      function->Append(codegen->AggregatorAdvanceVector(agg_payload_ptr, vpi, vectorized_col_idxs_[term_idx]));
+    }
+  }
+
+  // var num_agg_inputs = @vpiSelectedRowCount(vpi)
+  auto num_inputs = codegen->MakeFreshIdentifier("num_agg_inputs");
+  function->Append(
+      codegen->DeclareVarWithInit(num_inputs, codegen->CallBuiltin(ast::Builtin::VPIGetSelectedRowCount, {vpi})));
+  CounterAdd(function, num_agg_inputs_, num_inputs);
+}
+
 void StaticAggregationTranslator::PerformPipelineWork(WorkContext *context, FunctionBuilder *function) const {
   auto *codegen = GetCodeGen();
   if (IsProducePipeline(context->GetPipeline())) {
@@ -249,6 +343,8 @@ void StaticAggregationTranslator::PerformPipelineWork(WorkContext *context, Func
       context->Push(function);
     }
     CounterAdd(function, num_agg_outputs_, 1);
+  } else if (build_pipeline_.IsVectorized()) {
+    UpdateGlobalAggregateVectorized(function);
   } else {
     UpdateGlobalAggregate(context, function);
     CounterAdd(function, num_agg_inputs_, 1);
@@ -35,6 +35,9 @@ UpdateTranslator::UpdateTranslator(const planner::UpdatePlanNode &plan, Compilat
     for (const auto &index_col : index_schema.GetColumns()) {
       compilation_context->Prepare(*index_col.StoredExpression());
     }
+    if (index_schema.Partial()) {
+      compilation_context->Prepare(*index_schema.Predicate());
+    }
   }
 
   num_updates_ = CounterDeclare("num_updates", pipeline);
@@ -75,8 +78,21 @@ void UpdateTranslator::PerformPipelineWork(WorkContext *context, FunctionBuilder
     GenTableInsert(function);
     const auto &indexes = GetPlanAs<planner::UpdatePlanNode>().GetIndexOids();
     for (const auto &index_oid : indexes) {
-      GenIndexDelete(function, context, index_oid);
-      GenIndexInsert(context, function, index_oid);
+      const auto &index_schema = GetCodeGen()->GetCatalogAccessor()->GetIndexSchema(index_oid);
+      if (index_schema.Partial()) {
+        // A partial index only contains the tuples that satisfy its predicate, which is evaluated over the old tuple
+        // from the child for the delete, and over the new tuple for the insert.
+        const auto &child = GetCompilationContext()->LookupTranslator(*op.GetChild(0));
+        If old_matches(function, context->DeriveValue(*index_schema.Predicate(), child));
+        GenIndexDelete(function, context, index_oid);
+        old_matches.EndIf();
+        If new_matches(function, context->DeriveValue(*index_schema.Predicate(), this));
+        GenIndexInsert(context, function, index_oid);
+        new_matches.EndIf();
+      } else {
+        GenIndexDelete(function, context, index_oid);
+        GenIndexInsert(context, function, index_oid);
+      }
     }
   } else {
     // Non-indexed updates just update.
@@ -93,6 +109,10 @@ void UpdateTranslator::TearDownPipelineState(const Pipeline &pipeline, FunctionB
 }
 
 void UpdateTranslator::FinishPipelineWork(const Pipeline &pipeline, FunctionBuilder *function) const {
+  if (GetPlanAs<planner::UpdatePlanNode>().GetIndexedUpdate()) {
+    GenIndexFlushBatches(function);
+  }
+
   if (GetPlanAs<planner::UpdatePlanNode>().GetIndexOids().empty()) {
     FeatureRecord(function, selfdriving::ExecutionOperatingUnitType::UPDATE,
                   selfdriving::ExecutionOperatingUnitFeatureAttribute::NUM_ROWS, pipeline, CounterVal(num_updates_));
@@ -247,15 +267,26 @@ void UpdateTranslator::GenIndexInsert(WorkContext *context, FunctionBuilder *bui
     builder->Append(GetCodeGen()->MakeStmt(set_key_call));
   }
 
-  // if (!@indexInsert(&pipelineState.storageInterface)) { Abort(); }
-  const auto &builtin = index_schema.Unique() ? ast::Builtin::IndexInsertUnique : ast::Builtin::IndexInsert;
-  auto *index_insert_call = GetCodeGen()->CallBuiltin(builtin, {si_updater_.GetPtr(GetCodeGen())});
+  // The entry is only staged here, and inserted together with the other entries of the index once the batch is full
+  // or the pipeline is done, see GenIndexFlushBatches(). The index enforces uniqueness when it inserts the batch.
+  // if (!@indexInsertBatch(&pipelineState.storageInterface)) { Abort(); }
+  auto *index_insert_call =
+      GetCodeGen()->CallBuiltin(ast::Builtin::IndexInsertBatch, {si_updater_.GetPtr(GetCodeGen())});
   auto *cond = GetCodeGen()->UnaryOp(parsing::Token::Type::BANG, index_insert_call);
   If success(builder, cond);
   { builder->Append(GetCodeGen()->AbortTxn(GetExecutionContext())); }
   success.EndIf();
 }
 
+void UpdateTranslator::GenIndexFlushBatches(FunctionBuilder *builder) const {
+  // if (!@indexFlushBatches(&pipelineState.storageInterface)) { Abort(); }
+  auto *flush_call = GetCodeGen()->CallBuiltin(ast::Builtin::IndexFlushBatches, {si_updater_.GetPtr(GetCodeGen())});
+  auto *cond = GetCodeGen()->UnaryOp(parsing::Token::Type::BANG, flush_call);
+  If success(builder, cond);
+  { builder->Append(GetCodeGen()->AbortTxn(GetExecutionContext())); }
+  success.EndIf();
+}
+
 void UpdateTranslator::GenTableDelete(FunctionBuilder *builder) const {
   // if (!@tableDelete(&pipelineState.storageInterface, &slot)) { Abort(); }
   const auto &op = GetPlanAs<planner::UpdatePlanNode>();
@@ -299,9 +330,9 @@ void UpdateTranslator::GenIndexDelete(FunctionBuilder *builder, WorkContext *con
     builder->Append(GetCodeGen()->MakeStmt(pr_set_call));
   }
 
-  // @indexDelete(&pipelineState.storageInterface)
+  // @indexDeleteBatch(&pipelineState.storageInterface, &slot)
   std::vector<ast::Expr *> delete_args{si_updater_.GetPtr(GetCodeGen()), child->GetSlotAddress()};
-  auto *index_delete_call = GetCodeGen()->CallBuiltin(ast::Builtin::IndexDelete, delete_args);
+  auto *index_delete_call = GetCodeGen()->CallBuiltin(ast::Builtin::IndexDeleteBatch, delete_args);
   builder->Append(GetCodeGen()->MakeStmt(index_delete_call));
 }
 
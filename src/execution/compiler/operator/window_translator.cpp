@@ -0,0 +1,589 @@
+#include "execution/compiler/operator/window_translator.h"
+
+#include <string>
+#include <utility>
+
+#include "common/error/exception.h"
+#include "execution/compiler/compilation_context.h"
+#include "execution/compiler/function_builder.h"
+#include "execution/compiler/if.h"
+#include "execution/compiler/loop.h"
+#include "execution/compiler/work_context.h"
+#include "execution/sql/segment_tree.h"
+#include "planner/plannodes/output_schema.h"
+#include "planner/plannodes/window_plan_node.h"
+#include "spdlog/fmt/fmt.h"
+
+namespace noisepage::execution::compiler {
+
+namespace {
+constexpr const char WINDOW_ROW_ATTR_PREFIX[] = "attr";
+constexpr const char WINDOW_ROW_PARTITION_KEY_PREFIX[] = "partKey";
+constexpr const char WINDOW_ROW_SORT_KEY_PREFIX[] = "sortKey";
+constexpr const char WINDOW_ROW_ARG_PREFIX[] = "arg";
+
+sql::SegmentTree::AggregateKind SegmentTreeKind(planner::WindowFunctionType type) {
+  switch (type) {
+    case planner::WindowFunctionType::COUNT:
+      return sql::SegmentTree::AggregateKind::Count;
+    case planner::WindowFunctionType::SUM:
+      return sql::SegmentTree::AggregateKind::Sum;
+    case planner::WindowFunctionType::MIN:
+      return sql::SegmentTree::AggregateKind::Min;
+    case planner::WindowFunctionType::MAX:
+      return sql::SegmentTree::AggregateKind::Max;
+    case planner::WindowFunctionType::AVG:
+      return sql::SegmentTree::AggregateKind::Avg;
+    default:
+      UNREACHABLE("Window function is not evaluated with a segment tree");
+  }
+}
+}  // namespace
+
+WindowTranslator::WindowTranslator(const planner::WindowPlanNode &plan, CompilationContext *compilation_context,
+                                   Pipeline *pipeline)
+    : OperatorTranslator(plan, compilation_context, pipeline, selfdriving::ExecutionOperatingUnitType::DUMMY),
+      row_var_(GetCodeGen()->MakeFreshIdentifier("windowRow")),
+      row_type_(GetCodeGen()->MakeFreshIdentifier("WindowRow")),
+      lhs_row_(GetCodeGen()->MakeIdentifier("lhs")),
+      rhs_row_(GetCodeGen()->MakeIdentifier("rhs")),
+      compare_func_(GetCodeGen()->MakeFreshIdentifier(pipeline->CreatePipelineFunctionName("Compare"))),
+      same_partition_func_(GetCodeGen()->MakeFreshIdentifier(pipeline->CreatePipelineFunctionName("SamePartition"))),
+      same_peers_func_(GetCodeGen()->MakeFreshIdentifier(pipeline->CreatePipelineFunctionName("SamePeers"))),
+      build_pipeline_(this, Pipeline::Parallelism::Parallel) {
+  NOISEPAGE_ASSERT(plan.GetChildrenSize() == 1, "Windows expected to have a single child.");
+  // Register this as the source for the pipeline. If the build is parallel, so is the produce side: the sorted rows
+  // are split into ranges of whole partitions that are scanned in parallel.
+  pipeline->RegisterSource(
+      this, build_pipeline_.IsParallel() ? Pipeline::Parallelism::Parallel : Pipeline::Parallelism::Serial);
+
+  // The build pipeline must complete before the produce pipeline.
+  pipeline->LinkSourcePipeline(&build_pipeline_);
+
+  // Prepare the child.
+  compilation_context->Prepare(*plan.GetChild(0), &build_pipeline_);
+
+  // Prepare the partition keys, sort keys and window function arguments.
+  for (const auto &key : plan.GetPartitionByKeys()) {
+    compilation_context->Prepare(*key);
+  }
+  for (const auto &[expr, _] : plan.GetSortKeys()) {
+    (void)_;
+    compilation_context->Prepare(*expr);
+  }
+
+  // Register a Sorter instance in the global query state, and another in the pipeline-local state if the build
+  // pipeline is parallel.
+  CodeGen *codegen = compilation_context->GetCodeGen();
+  ast::Expr *sorter_type = codegen->BuiltinType(ast::BuiltinType::Sorter);
+  global_sorter_ = compilation_context->GetQueryState()->DeclareStateEntry(codegen, "sorter", sorter_type);
+  if (build_pipeline_.IsParallel()) {
+    local_sorter_ = build_pipeline_.DeclarePipelineStateEntry("sorter", sorter_type);
+  }
+
+  // Every window function gets a variable for its value in the current row. Aggregates over frames get a segment
+  // tree in the produce pipeline's state.
+  const auto &window_functions = plan.GetWindowFunctions();
+  segment_trees_.resize(window_functions.size());
+  for (uint32_t func_idx = 0; func_idx < window_functions.size(); func_idx++) {
+    const auto &func = window_functions[func_idx];
+    window_vars_.push_back(codegen->MakeFreshIdentifier("windowValue"));
+    if (func.argument_ != nullptr) {
+      compilation_context->Prepare(*func.argument_);
+      const auto arg_type = sql::GetTypeId(func.argument_->GetReturnValueType());
+      if (!sql::IsTypeNumeric(arg_type) && func.type_ != planner::WindowFunctionType::COUNT) {
+        throw NOT_IMPLEMENTED_EXCEPTION(fmt::format("Window aggregates over {}", sql::TypeIdToString(arg_type)));
+      }
+    }
+    if (UsesSegmentTree(func_idx)) {
+      ast::Expr *tree_type = codegen->BuiltinType(ast::BuiltinType::SegmentTree);
+      segment_trees_[func_idx] = pipeline->DeclarePipelineStateEntry("segTree", tree_type);
+    }
+  }
+}
+
+bool WindowTranslator::UsesSegmentTree(uint32_t func_idx) const {
+  const auto &func = GetWindowPlan().GetWindowFunctions()[func_idx];
+  return !func.IsRanking() && func.type_ != planner::WindowFunctionType::COUNT_STAR;
+}
+
+bool WindowTranslator::HasRealResult(uint32_t func_idx) const {
+  const auto &func = GetWindowPlan().GetWindowFunctions()[func_idx];
+  switch (func.type_) {
+    case planner::WindowFunctionType::AVG:
+      return true;
+    case planner::WindowFunctionType::SUM:
+    case planner::WindowFunctionType::MIN:
+    case planner::WindowFunctionType::MAX: {
+      const auto arg_type = sql::GetTypeId(func.argument_->GetReturnValueType());
+      return arg_type == sql::TypeId::Float || arg_type == sql::TypeId::Double;
+    }
+    default:
+      return false;
+  }
+}
+
+void WindowTranslator::DefineHelperStructs(util::RegionVector<ast::StructDecl *> *decls) {
+  auto *codegen = GetCodeGen();
+  auto fields = codegen->MakeEmptyFieldList();
+  GetAllChildOutputFields(0, WINDOW_ROW_ATTR_PREFIX, &fields);
+
+  // The keys and arguments are evaluated once, when the row is inserted.
+  const auto add_field = [&](const char *prefix, uint32_t idx, const parser::AbstractExpression &expr) {
+    auto name = codegen->MakeIdentifier(prefix + std::to_string(idx));
+    auto type = codegen->TplType(sql::GetTypeId(expr.GetReturnValueType()));
+    fields.push_back(codegen->MakeField(name, type));
+  };
+  const auto &plan = GetWindowPlan();
+  for (uint32_t idx = 0; idx < plan.GetPartitionByKeys().size(); idx++) {
+    add_field(WINDOW_ROW_PARTITION_KEY_PREFIX, idx, *plan.GetPartitionByKeys()[idx]);
+  }
+  for (uint32_t idx = 0; idx < plan.GetSortKeys().size(); idx++) {
+    add_field(WINDOW_ROW_SORT_KEY_PREFIX, idx, *plan.GetSortKeys()[idx].first);
+  }
+  for (uint32_t idx = 0; idx < plan.GetWindowFunctions().size(); idx++) {
+    if (const auto &arg = plan.GetWindowFunctions()[idx].argument_; arg != nullptr) {
+      add_field(WINDOW_ROW_ARG_PREFIX, idx, *arg);
+    }
+  }
+
+  decls->push_back(codegen->DeclareStruct(row_type_, std::move(fields)));
+}
+
+ast::Expr *WindowTranslator::GetRowField(ast::Identifier row, const char *prefix, uint32_t idx) const {
+  auto *codegen = GetCodeGen();
+  ast::Identifier field_name = codegen->MakeIdentifier(prefix + std::to_string(idx));
+  return codegen->AccessStructMember(codegen->MakeExpr(row), field_name);
+}
+
+ast::FunctionDecl *WindowTranslator::GenerateComparisonFunction() {
+  auto *codegen = GetCodeGen();
+  auto params = codegen->MakeFieldList({
+      codegen->MakeField(lhs_row_, codegen->PointerType(row_type_)),
+      codegen->MakeField(rhs_row_, codegen->PointerType(row_type_)),
+  });
+  FunctionBuilder builder(codegen, compare_func_, std::move(params), codegen->Int32Type());
+  {
+    // Order by the partition keys first, so that the rows of a partition are contiguous, and then by the sort keys.
+    // NULLs sort after all other values, as in Postgres.
+    const auto compare_key = [&](const char *prefix, uint32_t idx, optimizer::OrderByOrderingType sort_order) {
+      const int32_t less_ret = sort_order == optimizer::OrderByOrderingType::ASC ? -1 : 1;
+      ast::Expr *lhs_null = codegen->CallBuiltin(ast::Builtin::IsValNull, {GetRowField(lhs_row_, prefix, idx)});
+      ast::Expr *rhs_null = codegen->CallBuiltin(ast::Builtin::IsValNull, {GetRowField(rhs_row_, prefix, idx)});
+      If check_lhs_null(&builder, lhs_null);
+      {
+        If check_rhs_not_null(&builder, codegen->UnaryOp(parsing::Token::Type::BANG, rhs_null));
+        builder.Append(codegen->Return(codegen->Const32(-less_ret)));
+        check_rhs_not_null.EndIf();
+      }
+      check_lhs_null.Else();
+      {
+        If check_rhs_null(&builder,
+                          codegen->CallBuiltin(ast::Builtin::IsValNull, {GetRowField(rhs_row_, prefix, idx)}));
+        builder.Append(codegen->Return(codegen->Const32(less_ret)));
+        check_rhs_null.EndIf();
+      }
+      check_lhs_null.EndIf();
+
+      int32_t ret_value = less_ret;
+      for (const auto tok : {parsing::Token::Type::LESS, parsing::Token::Type::GREATER}) {
+        ast::Expr *lhs = GetRowField(lhs_row_, prefix, idx);
+        ast::Expr *rhs = GetRowField(rhs_row_, prefix, idx);
+        If check_comparison(&builder, codegen->Compare(tok, lhs, rhs));
+        builder.Append(codegen->Return(codegen->Const32(ret_value)));
+        check_comparison.EndIf();
+        ret_value = -ret_value;
+      }
+    };
+    const auto &plan = GetWindowPlan();
+    for (uint32_t idx = 0; idx < plan.GetPartitionByKeys().size(); idx++) {
+      compare_key(WINDOW_ROW_PARTITION_KEY_PREFIX, idx, optimizer::OrderByOrderingType::ASC);
+    }
+    for (uint32_t idx = 0; idx < plan.GetSortKeys().size(); idx++) {
+      compare_key(WINDOW_ROW_SORT_KEY_PREFIX, idx, plan.GetSortKeys()[idx].second);
+    }
+  }
+  return builder.Finish(codegen->Const32(0));
+}
+
+ast::FunctionDecl *WindowTranslator::GenerateEqualityFunction(ast::Identifier name, bool partition_keys) {
+  auto *codegen = GetCodeGen();
+  auto params = codegen->MakeFieldList({
+      codegen->MakeField(lhs_row_, codegen->PointerType(row_type_)),
+      codegen->MakeField(rhs_row_, codegen->PointerType(row_type_)),
+  });
+  FunctionBuilder builder(codegen, name, std::move(params), codegen->BoolType());
+  {
+    // Two rows are in the same partition, or are peers, if every key is either NULL in both rows or equal.
+    const auto &plan = GetWindowPlan();
+    const auto prefix = partition_keys ? WINDOW_ROW_PARTITION_KEY_PREFIX : WINDOW_ROW_SORT_KEY_PREFIX;
+    const auto num_keys = partition_keys ? plan.GetPartitionByKeys().size() : plan.GetSortKeys().size();
+    for (uint32_t idx = 0; idx < num_keys; idx++) {
+      ast::Expr *lhs_null = codegen->CallBuiltin(ast::Builtin::IsValNull, {GetRowField(lhs_row_, prefix, idx)});
+      If check_lhs_null(&builder, lhs_null);
+      {
+        ast::Expr *rhs_null = codegen->CallBuiltin(ast::Builtin::IsValNull, {GetRowField(rhs_row_, prefix, idx)});
+        If check_rhs_not_null(&builder, codegen->UnaryOp(parsing::Token::Type::BANG, rhs_null));
+        builder.Append(codegen->Return(codegen->ConstBool(false)));
+        check_rhs_not_null.EndIf();
+      }
+      check_lhs_null.Else();
+      {
+        ast::Expr *rhs_null = codegen->CallBuiltin(ast::Builtin::IsValNull, {GetRowField(rhs_row_, prefix, idx)});
+        If check_rhs_null(&builder, rhs_null);
+        builder.Append(codegen->Return(codegen->ConstBool(false)));
+        check_rhs_null.EndIf();
+        If check_not_equal(&builder, codegen->Compare(parsing::Token::Type::BANG_EQUAL,
+                                                      GetRowField(lhs_row_, prefix, idx),
+                                                      GetRowField(rhs_row_, prefix, idx)));
+        builder.Append(codegen->Return(codegen->ConstBool(false)));
+        check_not_equal.EndIf();
+      }
+      check_lhs_null.EndIf();
+    }
+  }
+  return builder.Finish(codegen->ConstBool(true));
+}
+
+void WindowTranslator::DefineHelperFunctions(util::RegionVector<ast::FunctionDecl *> *decls) {
+  decls->push_back(GenerateComparisonFunction());
+  decls->push_back(GenerateEqualityFunction(same_partition_func_, true));
+  decls->push_back(GenerateEqualityFunction(same_peers_func_, false));
+}
+
+void WindowTranslator::InitializeQueryState(FunctionBuilder *function) const {
+  auto *codegen = GetCodeGen();
+  ast::Expr *sorter_ptr = global_sorter_.GetPtr(codegen);
+  function->Append(codegen->SorterInit(sorter_ptr, GetExecutionContext(), compare_func_, row_type_));
+}
+
+void WindowTranslator::TearDownQueryState(FunctionBuilder *function) const {
+  function->Append(GetCodeGen()->SorterFree(global_sorter_.GetPtr(GetCodeGen())));
+}
+
+void WindowTranslator::InitializePipelineState(const Pipeline &pipeline, FunctionBuilder *function) const {
+  auto *codegen = GetCodeGen();
+  if (IsBuildPipeline(pipeline) && build_pipeline_.IsParallel()) {
+    ast::Expr *sorter_ptr = local_sorter_.GetPtr(codegen);
+    function->Append(codegen->SorterInit(sorter_ptr, GetExecutionContext(), compare_func_, row_type_));
+  } else if (IsProducePipeline(pipeline)) {
+    const auto &window_functions = GetWindowPlan().GetWindowFunctions();
+    for (uint32_t func_idx = 0; func_idx < window_functions.size(); func_idx++) {
+      if (UsesSegmentTree(func_idx)) {
+        const auto kind = SegmentTreeKind(window_functions[func_idx].type_);
+        ast::Expr *tree = segment_trees_[func_idx].GetPtr(codegen);
+        function->Append(codegen->SegmentTreeInit(tree, GetExecutionContext(), kind));
+      }
+    }
+  }
+}
+
+void WindowTranslator::TearDownPipelineState(const Pipeline &pipeline, FunctionBuilder *function) const {
+  auto *codegen = GetCodeGen();
+  if (IsBuildPipeline(pipeline) && build_pipeline_.IsParallel()) {
+    function->Append(codegen->SorterFree(local_sorter_.GetPtr(codegen)));
+  } else if (IsProducePipeline(pipeline)) {
+    for (uint32_t func_idx = 0; func_idx < segment_trees_.size(); func_idx++) {
+      if (UsesSegmentTree(func_idx)) {
+        function->Append(codegen->SegmentTreeFree(segment_trees_[func_idx].GetPtr(codegen)));
+      }
+    }
+  }
+}
+
+void WindowTranslator::InsertIntoSorter(WorkContext *ctx, FunctionBuilder *function, ast::Expr *sorter_ptr) const {
+  auto *codegen = GetCodeGen();
+
+  // var windowRow = @ptrCast(*WindowRow, @sorterInsert(sorter, @sizeOf(WindowRow)))
+  function->Append(codegen->DeclareVarWithInit(row_var_, codegen->SorterInsert(sorter_ptr, row_type_)));
+
+  // Copy the child's columns, then evaluate the keys and arguments.
+  const auto child_schema = GetPlan().GetChild(0)->GetOutputSchema();
+  for (uint32_t attr_idx = 0; attr_idx < child_schema->GetColumns().size(); attr_idx++) {
+    ast::Expr *lhs = GetRowField(row_var_, WINDOW_ROW_ATTR_PREFIX, attr_idx);
+    function->Append(codegen->Assign(lhs, GetChildOutput(ctx, 0, attr_idx)));
+  }
+  const auto &plan = GetWindowPlan();
+  for (uint32_t idx = 0; idx < plan.GetPartitionByKeys().size(); idx++) {
+    ast::Expr *lhs = GetRowField(row_var_, WINDOW_ROW_PARTITION_KEY_PREFIX, idx);
+    function->Append(codegen->Assign(lhs, ctx->DeriveValue(*plan.GetPartitionByKeys()[idx], this)));
+  }
+  for (uint32_t idx = 0; idx < plan.GetSortKeys().size(); idx++) {
+    ast::Expr *lhs = GetRowField(row_var_, WINDOW_ROW_SORT_KEY_PREFIX, idx);
+    function->Append(codegen->Assign(lhs, ctx->DeriveValue(*plan.GetSortKeys()[idx].first, this)));
+  }
+  for (uint32_t idx = 0; idx < plan.GetWindowFunctions().size(); idx++) {
+    if (const auto &arg = plan.GetWindowFunctions()[idx].argument_; arg != nullptr) {
+      ast::Expr *lhs = GetRowField(row_var_, WINDOW_ROW_ARG_PREFIX, idx);
+      function->Append(codegen->Assign(lhs, ctx->DeriveValue(*arg, this)));
+    }
+  }
+}
+
+void WindowTranslator::ReadPartition(FunctionBuilder *function, ast::Expr *peek_iter, ast::Identifier part_first,
+                                     ast::Identifier part_size) const {
+  auto *codegen = GetCodeGen();
+
+  // var partitionSize: int64 = 0
+  function->Append(codegen->DeclareVar(part_size, codegen->Int64Type(), codegen->Const64(0)));
+
+  // The look-ahead iterator is at the first row of the partition. Advance it past the last row of the partition.
+  // var inPartition = true
+  auto in_partition = codegen->MakeFreshIdentifier("inPartition");
+  function->Append(codegen->DeclareVarWithInit(in_partition, codegen->ConstBool(true)));
+  Loop loop(function, codegen->MakeExpr(in_partition));
+  {
+    // var peekRow = @ptrCast(*WindowRow, @sorterIterGetRow(peek))
+    auto peek_row = codegen->MakeFreshIdentifier("peekRow");
+    function->Append(codegen->DeclareVarWithInit(peek_row, codegen->SorterIterGetRow(peek_iter, row_type_)));
+    ast::Expr *same_partition =
+        codegen->Call(same_partition_func_, {codegen->MakeExpr(part_first), codegen->MakeExpr(peek_row)});
+    If check_partition(function, same_partition);
+    {
+      // Append the arguments of the row to the segment trees.
+      const auto &window_functions = GetWindowPlan().GetWindowFunctions();
+      for (uint32_t func_idx = 0; func_idx < window_functions.size(); func_idx++) {
+        if (UsesSegmentTree(func_idx)) {
+          ast::Expr *tree = segment_trees_[func_idx].GetPtr(codegen);
+          function->Append(codegen->SegmentTreeAppend(tree, GetRowField(peek_row, WINDOW_ROW_ARG_PREFIX, func_idx)));
+        }
+      }
+      // partitionSize = partitionSize + 1
+      ast::Expr *size = codegen->MakeExpr(part_size);
+      function->Append(
+          codegen->Assign(size, codegen->BinaryOp(parsing::Token::Type::PLUS, size, codegen->Const64(1))));
+      // @sorterIterNext(peek)
+      // inPartition = @sorterIterHasNext(peek)
+      function->Append(codegen->SorterIterNext(peek_iter));
+      function->Append(codegen->Assign(codegen->MakeExpr(in_partition), codegen->SorterIterHasNext(peek_iter)));
+    }
+    check_partition.Else();
+    {
+      // The row starts the next partition.
+      function->Append(codegen->Assign(codegen->MakeExpr(in_partition), codegen->ConstBool(false)));
+    }
+    check_partition.EndIf();
+  }
+  loop.EndLoop();
+}
+
+void WindowTranslator::EmitPartition(WorkContext *ctx, FunctionBuilder *function, ast::Expr *iter,
+                                     ast::Identifier part_first, ast::Identifier part_size) const {
+  auto *codegen = GetCodeGen();
+  const auto &window_functions = GetWindowPlan().GetWindowFunctions();
+
+  bool needs_rank = false;
+  for (const auto &func : window_functions) {
+    needs_rank |=
+        func.type_ == planner::WindowFunctionType::RANK || func.type_ == planner::WindowFunctionType::DENSE_RANK;
+  }
+
+  // var prevRow = partitionFirst
+  // var rank: int64 = 1
+  // var denseRank: int64 = 1
+  auto prev_row = codegen->MakeFreshIdentifier("prevRow");
+  auto rank = codegen->MakeFreshIdentifier("rank");
+  auto dense_rank = codegen->MakeFreshIdentifier("denseRank");
+  if (needs_rank) {
+    function->Append(codegen->DeclareVarWithInit(prev_row, codegen->MakeExpr(part_first)));
+    function->Append(codegen->DeclareVar(rank, codegen->Int64Type(), codegen->Const64(1)));
+    function->Append(codegen->DeclareVar(dense_rank, codegen->Int64Type(), codegen->Const64(1)));
+  }
+
+  // var rowIdx: int64 = 0
+  // for (; rowIdx < partitionSize; rowIdx = rowIdx + 1)
+  auto row_idx = codegen->MakeFreshIdentifier("rowIdx");
+  ast::Expr *idx = codegen->MakeExpr(row_idx);
+  const auto plus = [&](ast::Expr *lhs, int64_t val) {
+    return codegen->BinaryOp(parsing::Token::Type::PLUS, lhs, codegen->Const64(val));
+  };
+  function->Append(codegen->DeclareVar(row_idx, codegen->Int64Type(), codegen->Const64(0)));
+  Loop loop(function, nullptr, codegen->Compare(parsing::Token::Type::LESS, idx, codegen->MakeExpr(part_size)),
+            codegen->Assign(idx, plus(idx, 1)));
+  {
+    // var windowRow = @ptrCast(*WindowRow, @sorterIterGetRow(iter))
+    function->Append(codegen->DeclareVarWithInit(row_var_, codegen->SorterIterGetRow(iter, row_type_)));
+
+    // A row that isn't a peer of the previous row starts a new rank.
+    if (needs_rank) {
+      ast::Expr *same_peers =
+          codegen->Call(same_peers_func_, {codegen->MakeExpr(prev_row), codegen->MakeExpr(row_var_)});
+      If check_peers(function, codegen->UnaryOp(parsing::Token::Type::BANG, same_peers));
+      {
+        function->Append(codegen->Assign(codegen->MakeExpr(rank), plus(idx, 1)));
+        function->Append(codegen->Assign(codegen->MakeExpr(dense_rank), plus(codegen->MakeExpr(dense_rank), 1)));
+      }
+      check_peers.EndIf();
+      function->Append(codegen->Assign(codegen->MakeExpr(prev_row), codegen->MakeExpr(row_var_)));
+    }
+
+    for (uint32_t func_idx = 0; func_idx < window_functions.size(); func_idx++) {
+      const auto &func = window_functions[func_idx];
+      ast::Expr *value;
+      switch (func.type_) {
+        case planner::WindowFunctionType::ROW_NUMBER:
+          value = codegen->CallBuiltin(ast::Builtin::IntToSql, {plus(idx, 1)});
+          break;
+        case planner::WindowFunctionType::RANK:
+          value = codegen->CallBuiltin(ast::Builtin::IntToSql, {codegen->MakeExpr(rank)});
+          break;
+        case planner::WindowFunctionType::DENSE_RANK:
+          value = codegen->CallBuiltin(ast::Builtin::IntToSql, {codegen->MakeExpr(dense_rank)});
+          break;
+        default: {
+          // The frame is [frameStart, frameEnd), clamped to the partition.
+          auto frame_start = codegen->MakeFreshIdentifier("frameStart");
+          auto frame_end = codegen->MakeFreshIdentifier("frameEnd");
+          ast::Expr *start =
+              func.start_unbounded_
+                  ? codegen->Const64(0)
+                  : codegen->BinaryOp(parsing::Token::Type::MINUS, idx,
+                                      codegen->Const64(static_cast<int64_t>(func.start_preceding_)));
+          ast::Expr *end = func.end_unbounded_ ? codegen->MakeExpr(part_size)
+                                               : plus(idx, static_cast<int64_t>(func.end_following_) + 1);
+          function->Append(codegen->DeclareVar(frame_start, codegen->Int64Type(), start));
+          function->Append(codegen->DeclareVar(frame_end, codegen->Int64Type(), end));
+          if (!func.start_unbounded_) {
+            If clamp_start(function, codegen->Compare(parsing::Token::Type::LESS, codegen->MakeExpr(frame_start),
+                                                      codegen->Const64(0)));
+            function->Append(codegen->Assign(codegen->MakeExpr(frame_start), codegen->Const64(0)));
+            clamp_start.EndIf();
+          }
+          if (!func.end_unbounded_) {
+            If clamp_end(function, codegen->Compare(parsing::Token::Type::GREATER, codegen->MakeExpr(frame_end),
+                                                    codegen->MakeExpr(part_size)));
+            function->Append(codegen->Assign(codegen->MakeExpr(frame_end), codegen->MakeExpr(part_size)));
+            clamp_end.EndIf();
+          }
+
+          if (func.type_ == planner::WindowFunctionType::COUNT_STAR) {
+            ast::Expr *frame_size = codegen->BinaryOp(parsing::Token::Type::MINUS, codegen->MakeExpr(frame_end),
+                                                      codegen->MakeExpr(frame_start));
+            value = codegen->CallBuiltin(ast::Builtin::IntToSql, {frame_size});
+          } else {
+            value = codegen->SegmentTreeQuery(segment_trees_[func_idx].GetPtr(codegen), codegen->MakeExpr(frame_start),
+                                              codegen->MakeExpr(frame_end), HasRealResult(func_idx));
+          }
+          break;
+        }
+      }
+      function->Append(codegen->DeclareVarWithInit(window_vars_[func_idx], value));
+    }
+
+    // Move along
+    ctx->Push(function);
+    function->Append(codegen->SorterIterNext(iter));
+  }
+  loop.EndLoop();
+}
+
+void WindowTranslator::ScanPartitions(WorkContext *ctx, FunctionBuilder *function) const {
+  auto *codegen = GetCodeGen();
+
+  // In parallel mode, the iterators over this task's range of partitions are the worker parameters. Otherwise,
+  // declare and initialize iterators over the whole sorter.
+  ast::Expr *iter, *peek_iter;
+  const bool parallel = ctx->GetPipeline().IsParallel();
+  if (parallel) {
+    auto iter_param_position = GetPipeline()->PipelineParams().size();
+    iter = function->GetParameterByPosition(iter_param_position);
+    peek_iter = function->GetParameterByPosition(iter_param_position + 1);
+  } else {
+    const auto declare_iter = [&](const std::string &name) {
+      auto base_iter_name = codegen->MakeFreshIdentifier(name + "Base");
+      function->Append(codegen->DeclareVarNoInit(base_iter_name, ast::BuiltinType::SorterIterator));
+      auto iter_name = codegen->MakeFreshIdentifier(name);
+      function->Append(codegen->DeclareVarWithInit(iter_name, codegen->AddressOf(codegen->MakeExpr(base_iter_name))));
+      function->Append(codegen->SorterIterInit(codegen->MakeExpr(iter_name), global_sorter_.GetPtr(codegen)));
+      return codegen->MakeExpr(iter_name);
+    };
+    iter = declare_iter("iter");
+    peek_iter = declare_iter("peekIter");
+  }
+
+  Loop loop(function, codegen->SorterIterHasNext(iter));
+  {
+    // var partitionFirst = @ptrCast(*WindowRow, @sorterIterGetRow(iter))
+    auto part_first = codegen->MakeFreshIdentifier("partitionFirst");
+    function->Append(codegen->DeclareVarWithInit(part_first, codegen->SorterIterGetRow(iter, row_type_)));
+
+    // Find the partition and fill the segment trees.
+    auto part_size = codegen->MakeFreshIdentifier("partitionSize");
+    ReadPartition(function, peek_iter, part_first, part_size);
+    for (uint32_t func_idx = 0; func_idx < segment_trees_.size(); func_idx++) {
+      if (UsesSegmentTree(func_idx)) {
+        function->Append(codegen->SegmentTreeBuild(segment_trees_[func_idx].GetPtr(codegen)));
+      }
+    }
+
+    // Emit every row of the partition, then clear the trees for the next one.
+    EmitPartition(ctx, function, iter, part_first, part_size);
+    for (uint32_t func_idx = 0; func_idx < segment_trees_.size(); func_idx++) {
+      if (UsesSegmentTree(func_idx)) {
+        function->Append(codegen->SegmentTreeReset(segment_trees_[func_idx].GetPtr(codegen)));
+      }
+    }
+  }
+  loop.EndLoop();
+
+  // @sorterIterClose(). The sorter owns the iterators of a parallel scan.
+  if (!parallel) {
+    function->Append(codegen->SorterIterClose(iter));
+    function->Append(codegen->SorterIterClose(peek_iter));
+  }
+}
+
+void WindowTranslator::PerformPipelineWork(WorkContext *ctx, FunctionBuilder *function) const {
+  if (IsProducePipeline(ctx->GetPipeline())) {
+    ScanPartitions(ctx, function);
+  } else {
+    NOISEPAGE_ASSERT(IsBuildPipeline(ctx->GetPipeline()), "Pipeline is unknown to window translator");
+    const auto sorter = ctx->GetPipeline().IsParallel() ? local_sorter_ : global_sorter_;
+    InsertIntoSorter(ctx, function, sorter.GetPtr(GetCodeGen()));
+  }
+}
+
+void WindowTranslator::FinishPipelineWork(const Pipeline &pipeline, FunctionBuilder *function) const {
+  if (IsBuildPipeline(pipeline)) {
+    auto *codegen = GetCodeGen();
+    ast::Expr *sorter_ptr = global_sorter_.GetPtr(codegen);
+    if (build_pipeline_.IsParallel()) {
+      // Every thread sorted its own rows. Merge them into the global sorter.
+      ast::Expr *offset = local_sorter_.OffsetFromState(codegen);
+      function->Append(codegen->SortParallel(sorter_ptr, GetThreadStateContainer(), offset));
+    } else {
+      function->Append(codegen->SorterSort(sorter_ptr));
+    }
+  }
+}
+
+util::RegionVector<ast::FieldDecl *> WindowTranslator::GetWorkerParams() const {
+  NOISEPAGE_ASSERT(build_pipeline_.IsParallel(), "Should not issue parallel scan if pipeline isn't parallelized.");
+  auto *codegen = GetCodeGen();
+  ast::Expr *iter_type = codegen->PointerType(codegen->BuiltinType(ast::BuiltinType::SorterIterator));
+  return codegen->MakeFieldList({codegen->MakeField(codegen->MakeIdentifier("iter"), iter_type),
+                                 codegen->MakeField(codegen->MakeIdentifier("peekIter"), iter_type)});
+}
+
+void WindowTranslator::LaunchWork(FunctionBuilder *function, ast::Identifier work_func_name) const {
+  NOISEPAGE_ASSERT(build_pipeline_.IsParallel(), "Should not issue parallel scan if pipeline isn't parallelized.");
+  auto *codegen = GetCodeGen();
+  function->Append(codegen->SorterScanPartitionsParallel(global_sorter_.GetPtr(codegen), GetQueryStatePtr(),
+                                                         GetThreadStateContainer(), same_partition_func_,
+                                                         work_func_name));
+}
+
+ast::Expr *WindowTranslator::GetChildOutput(WorkContext *context, uint32_t child_idx, uint32_t attr_idx) const {
+  if (IsProducePipeline(context->GetPipeline())) {
+    if (child_idx == 0) {
+      return GetRowField(row_var_, WINDOW_ROW_ATTR_PREFIX, attr_idx);
+    }
+    NOISEPAGE_ASSERT(child_idx == 1 && attr_idx < window_vars_.size(), "Window function index out of bounds");
+    return GetCodeGen()->MakeExpr(window_vars_[attr_idx]);
+  }
+
+  NOISEPAGE_ASSERT(IsBuildPipeline(context->GetPipeline()), "Pipeline not known to window");
+  return OperatorTranslator::GetChildOutput(context, child_idx, attr_idx);
+}
+
+}  // namespace noisepage::execution::compiler
@@ -28,6 +28,7 @@ Pipeline::Pipeline(CompilationContext *ctx)
       driver_(nullptr),
       parallelism_(Parallelism::Parallel),
       check_parallelism_(true),
+      vectorization_(Vectorization::Disabled),
       state_var_(codegen_->MakeIdentifier("pipelineState")),
       state_(codegen_->MakeIdentifier(fmt::format("P{}_State", id_)),
              [this](CodeGen *codegen) { return codegen_->MakeExpr(state_var_); }) {}
@@ -63,6 +64,37 @@ void Pipeline::UpdateParallelism(Pipeline::Parallelism parallelism) {
 
 void Pipeline::SetParallelCheck(bool check) { check_parallelism_ = check; }
 
+void Pipeline::UpdateVectorization(Pipeline::Vectorization vectorization) { vectorization_ = vectorization; }
+
+void Pipeline::DeferEndParallelPipelineWork(const OperatorTranslator *op) {
+  if (std::find(deferred_end_ops_.begin(), deferred_end_ops_.end(), op) == deferred_end_ops_.end()) {
+    deferred_end_ops_.push_back(op);
+  }
+}
+
+bool Pipeline::IsEndParallelPipelineWorkDeferred(const OperatorTranslator *op) const {
+  if (deferred_end_ops_.empty()) {
+    return false;
+  }
+  // Only operators after the first deferring one in the pipeline wait.
+  const auto is_deferring = [this](const OperatorTranslator *step) {
+    return std::find(deferred_end_ops_.begin(), deferred_end_ops_.end(), step) != deferred_end_ops_.end();
+  };
+  const auto first_deferring = std::find_if(Begin(), End(), is_deferring);
+  NOISEPAGE_ASSERT(first_deferring != End(), "The deferring operator is not in the pipeline");
+  return std::find(Begin(), first_deferring + 1, op) == first_deferring + 1;
+}
+
+const OperatorTranslator *Pipeline::GetLastDeferringOperator() const {
+  const OperatorTranslator *last = nullptr;
+  for (auto iter = Begin(), end = End(); iter != end; ++iter) {
+    if (std::find(deferred_end_ops_.begin(), deferred_end_ops_.end(), *iter) != deferred_end_ops_.end()) {
+      last = *iter;
+    }
+  }
+  return last;
+}
+
 void Pipeline::RegisterExpression(ExpressionTranslator *expression) {
   NOISEPAGE_ASSERT(std::find(expressions_.begin(), expressions_.end(), expression) == expressions_.end(),
                    "Expression already registered in pipeline");
@@ -93,6 +125,10 @@ ast::Identifier Pipeline::GetWorkFunctionName() const {
   return codegen_->MakeIdentifier(CreatePipelineFunctionName(IsParallel() ? "ParallelWork" : "SerialWork"));
 }
 
+ast::Identifier Pipeline::GetDeferredEndWorkFunctionName() const {
+  return codegen_->MakeIdentifier(CreatePipelineFunctionName("DeferredEndWork"));
+}
+
 void Pipeline::InjectStartResourceTracker(FunctionBuilder *builder, bool is_hook) const {
   if (compilation_context_->IsPipelineMetricsEnabled()) {
     auto *exec_ctx = compilation_context_->GetExecutionContextPtrFromQueryState();
@@ -171,11 +207,12 @@ void Pipeline::Prepare(const exec::ExecutionSettings &exec_settings) {
 
   // Finalize the execution mode. We choose serial execution if ANY of the below
   // conditions are satisfied:
-  //  1. If parallel execution is globally disabled.
+  //  1. If parallel execution is disabled for the driver of the pipeline, which is usually a global setting.
   //  2. If the consumer doesn't support parallel execution.
   //  3. If ANY operator in the pipeline explicitly requested serial execution.
 
-  const bool parallel_exec_disabled = !exec_settings.GetIsParallelQueryExecutionEnabled();
+  const bool parallel_exec_disabled = driver_ != nullptr ? !driver_->IsParallelExecutionEnabled(exec_settings)
+                                                         : !exec_settings.GetIsParallelQueryExecutionEnabled();
   const bool parallel_consumer = true;
   if (parallel_exec_disabled || !parallel_consumer || parallelism_ == Pipeline::Parallelism::Serial) {
     parallelism_ = Pipeline::Parallelism::Serial;
@@ -277,7 +314,9 @@ ast::FunctionDecl *Pipeline::GeneratePipelineWorkFunction() const {
 
     if (IsParallel()) {
       for (auto *op : steps_) {
-        op->EndParallelPipelineWork(*this, &builder);
+        if (!IsEndParallelPipelineWorkDeferred(op)) {
+          op->EndParallelPipelineWork(*this, &builder);
+        }
       }
 
       InjectEndResourceTracker(&builder, false);
@@ -286,6 +325,20 @@ ast::FunctionDecl *Pipeline::GeneratePipelineWorkFunction() const {
   return builder.Finish();
 }
 
+ast::FunctionDecl *Pipeline::GenerateDeferredEndWorkFunction() const {
+  FunctionBuilder builder(codegen_, GetDeferredEndWorkFunctionName(), PipelineParams(), codegen_->Nil());
+  {
+    // Begin a new code scope for fresh variables.
+    CodeGen::CodeScope code_scope(codegen_);
+    for (auto *op : steps_) {
+      if (IsEndParallelPipelineWorkDeferred(op)) {
+        op->EndParallelPipelineWork(*this, &builder);
+      }
+    }
+  }
+  return builder.Finish();
+}
+
 ast::FunctionDecl *Pipeline::GenerateRunPipelineFunction() const {
   bool started_tracker = false;
   auto name = codegen_->MakeIdentifier(CreatePipelineFunctionName("Run"));
@@ -322,8 +375,15 @@ ast::FunctionDecl *Pipeline::GenerateRunPipelineFunction() const {
     // TODO(abalakum): This shouldn't actually be dependent on order and the loop can be simplified
     // after issue #1154 is fixed
     // Let the operators perform some completion work in this pipeline.
+    const OperatorTranslator *last_deferring_op = GetLastDeferringOperator();
     for (auto iter = Begin(), end = End(); iter != end; ++iter) {
       (*iter)->FinishPipelineWork(*this, &builder);
+
+      // All tuples are in the thread states now, run the deferred end-of-work logic on each of them.
+      if (IsParallel() && *iter == last_deferring_op) {
+        auto tls = codegen_->ExecCtxGetTLS(compilation_context_->GetExecutionContextPtrFromQueryState());
+        builder.Append(codegen_->TLSIterate(tls, builder.GetParameterByPosition(0), GetDeferredEndWorkFunctionName()));
+      }
     }
 
     if (started_tracker) {
@@ -360,6 +420,9 @@ void Pipeline::GeneratePipeline(ExecutableQueryFragmentBuilder *builder) const {
 
   // Generate main pipeline logic.
   builder->DeclareFunction(GeneratePipelineWorkFunction());
+  if (IsParallel() && !deferred_end_ops_.empty()) {
+    builder->DeclareFunction(GenerateDeferredEndWorkFunction());
+  }
 
   // Register the main init, run, tear-down functions as steps, in that order.
   builder->RegisterStep(GenerateInitPipelineFunction());
@@ -8,6 +8,8 @@ void ExecutionSettings::UpdateFromSettingsManager(common::ManagedPointer<setting
   if (settings) {
     is_parallel_execution_enabled_ = settings->GetBool(settings::Param::parallel_execution);
     number_of_parallel_execution_threads_ = settings->GetInt(settings::Param::num_parallel_execution_threads);
+    is_parallel_index_build_enabled_ = settings->GetBool(settings::Param::parallel_index_build);
+    number_of_index_build_threads_ = settings->GetInt(settings::Param::num_index_build_threads);
     is_counters_enabled_ = settings->GetBool(settings::Param::counters_enable);
     is_pipeline_metrics_enabled_ = settings->GetBool(settings::Param::pipeline_metrics_enable);
   }
@@ -240,6 +240,62 @@ void Sema::CheckBuiltinStringLikeCall(ast::CallExpr *call) {
   call->SetType(GetBuiltinType(ast::BuiltinType::Boolean));
 }
 
+void Sema::CheckBuiltinLikePatternCall(ast::CallExpr *call, ast::Builtin builtin) {
+  const auto pattern_kind = ast::BuiltinType::LikePattern;
+  const auto str_kind = ast::BuiltinType::StringVal;
+  switch (builtin) {
+    case ast::Builtin::LikePatternInit: {
+      if (!CheckArgCount(call, 2)) {
+        return;
+      }
+      // First argument is a pointer to the pattern to initialize
+      if (!IsPointerToSpecificBuiltin(call->Arguments()[0]->GetType(), pattern_kind)) {
+        ReportIncorrectCallArg(call, 0, GetBuiltinType(pattern_kind)->PointerTo());
+        return;
+      }
+      // Second argument is the SQL string holding the pattern
+      if (!call->Arguments()[1]->GetType()->IsSpecificBuiltin(str_kind)) {
+        ReportIncorrectCallArg(call, 1, GetBuiltinType(str_kind));
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+      break;
+    }
+    case ast::Builtin::LikePatternMatch: {
+      if (!CheckArgCount(call, 2)) {
+        return;
+      }
+      // First argument is the SQL string to match
+      if (!call->Arguments()[0]->GetType()->IsSpecificBuiltin(str_kind)) {
+        ReportIncorrectCallArg(call, 0, GetBuiltinType(str_kind));
+        return;
+      }
+      // Second argument is a pointer to the analyzed pattern
+      if (!IsPointerToSpecificBuiltin(call->Arguments()[1]->GetType(), pattern_kind)) {
+        ReportIncorrectCallArg(call, 1, GetBuiltinType(pattern_kind)->PointerTo());
+        return;
+      }
+      // Returns a SQL boolean
+      call->SetType(GetBuiltinType(ast::BuiltinType::Boolean));
+      break;
+    }
+    case ast::Builtin::LikePatternFree: {
+      if (!CheckArgCount(call, 1)) {
+        return;
+      }
+      if (!IsPointerToSpecificBuiltin(call->Arguments()[0]->GetType(), pattern_kind)) {
+        ReportIncorrectCallArg(call, 0, GetBuiltinType(pattern_kind)->PointerTo());
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+      break;
+    }
+    default: {
+      UNREACHABLE("Impossible LIKE pattern call");
+    }
+  }
+}
+
 void Sema::CheckBuiltinDateFunctionCall(ast::CallExpr *call, ast::Builtin builtin) {
   if (!CheckArgCountAtLeast(call, 1)) {
     return;
@@ -281,7 +337,7 @@ void Sema::CheckBuiltinAggHashTableCall(ast::CallExpr *call, ast::Builtin builti
 
   switch (builtin) {
     case ast::Builtin::AggHashTableInit: {
-      if (!CheckArgCount(call, 3)) {
+      if (!CheckArgCountBetween(call, 3, 4)) {
         return;
       }
       // Second argument is the execution context.
@@ -296,6 +352,16 @@ void Sema::CheckBuiltinAggHashTableCall(ast::CallExpr *call, ast::Builtin builti
         ReportIncorrectCallArg(call, 2, GetBuiltinType(uint_kind));
         return;
       }
+      // Optional fourth argument is the initial number of groups to size the table for, a 32-bit value
+      if (call->NumArgs() == 4) {
+        if (!args[3]->GetType()->IsIntegerType()) {
+          ReportIncorrectCallArg(call, 3, GetBuiltinType(uint_kind));
+          return;
+        }
+        if (!args[3]->GetType()->IsSpecificBuiltin(uint_kind)) {
+          call->SetArgument(3, ImplCastExprToType(args[3], GetBuiltinType(uint_kind), ast::CastKind::IntegralCast));
+        }
+      }
       // Nil return
       call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
       break;
@@ -584,6 +650,61 @@ void Sema::CheckBuiltinAggregatorCall(ast::CallExpr *call, ast::Builtin builtin)
       call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
       break;
     }
+    case ast::Builtin::AggAdvanceVector: {
+      if (!CheckArgCountBetween(call, 2, 3)) {
+        return;
+      }
+      // First argument to @aggAdvanceVector() must be a SQL aggregator with a vectorized advance
+      if (!IsPointerToAggregatorValue(args[0]->GetType())) {
+        GetErrorReporter()->Report(call->Position(), ErrorMessages::kNotASQLAggregate, args[0]->GetType());
+        return;
+      }
+      // Without a column, COUNT aggregators count the selected tuples of the VPI. Others need a column.
+      uint32_t expected_arg_count;
+      switch (args[0]->GetType()->GetPointeeType()->As<ast::BuiltinType>()->GetKind()) {
+        case ast::BuiltinType::CountStarAggregate:
+          expected_arg_count = 2;
+          break;
+        case ast::BuiltinType::CountAggregate:
+          expected_arg_count = call->NumArgs();
+          break;
+        case ast::BuiltinType::IntegerSumAggregate:
+        case ast::BuiltinType::IntegerMaxAggregate:
+        case ast::BuiltinType::IntegerMinAggregate:
+        case ast::BuiltinType::RealSumAggregate:
+        case ast::BuiltinType::RealMaxAggregate:
+        case ast::BuiltinType::RealMinAggregate:
+        case ast::BuiltinType::AvgAggregate:
+          expected_arg_count = 3;
+          break;
+        default:
+          ReportIncorrectCallArg(call, 0, "numeric or COUNT aggregator");
+          return;
+      }
+      if (!CheckArgCount(call, expected_arg_count)) {
+        return;
+      }
+      // Second argument is the VPI whose current vector projection is aggregated
+      const auto vpi_kind = ast::BuiltinType::VectorProjectionIterator;
+      if (!IsPointerToSpecificBuiltin(args[1]->GetType(), vpi_kind)) {
+        ReportIncorrectCallArg(call, 1, GetBuiltinType(vpi_kind)->PointerTo());
+        return;
+      }
+      // Third argument, if any, is the index of the aggregated column, a 32-bit value
+      if (expected_arg_count == 3) {
+        const auto uint_kind = ast::BuiltinType::Uint32;
+        if (!args[2]->GetType()->IsIntegerType()) {
+          ReportIncorrectCallArg(call, 2, GetBuiltinType(uint_kind));
+          return;
+        }
+        if (!args[2]->GetType()->IsSpecificBuiltin(uint_kind)) {
+          call->SetArgument(2, ImplCastExprToType(args[2], GetBuiltinType(uint_kind), ast::CastKind::IntegralCast));
+        }
+      }
+      // Advance returns nil
+      call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+      break;
+    }
     case ast::Builtin::AggMerge: {
       if (!CheckArgCount(call, 2)) {
         return;
@@ -763,7 +884,8 @@ void Sema::CheckBuiltinJoinHashTableBuild(ast::CallExpr *call, ast::Builtin buil
     case ast::Builtin::JoinHashTableBuild: {
       break;
     }
-    case ast::Builtin::JoinHashTableBuildParallel: {
+    case ast::Builtin::JoinHashTableBuildParallel:
+    case ast::Builtin::JoinHashTableMoveTuplesParallel: {
       if (!CheckArgCount(call, 3)) {
         return;
       }
@@ -790,6 +912,53 @@ void Sema::CheckBuiltinJoinHashTableBuild(ast::CallExpr *call, ast::Builtin buil
   call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
 }
 
+void Sema::CheckBuiltinJoinHashTableBuildAndJoin(ast::CallExpr *call, ast::Builtin builtin) {
+  if (!CheckArgCount(call, 5)) {
+    return;
+  }
+
+  const auto &args = call->Arguments();
+
+  // First and second arguments must be pointers to the build and probe JoinHashTables
+  const auto jht_kind = ast::BuiltinType::JoinHashTable;
+  for (uint32_t i = 0; i < 2; i++) {
+    if (!IsPointerToSpecificBuiltin(args[i]->GetType(), jht_kind)) {
+      ReportIncorrectCallArg(call, i, GetBuiltinType(jht_kind)->PointerTo());
+      return;
+    }
+  }
+
+  // Third argument is an opaque query state pointer
+  if (!args[2]->GetType()->IsPointerType()) {
+    ReportIncorrectCallArg(call, 2, GetBuiltinType(ast::BuiltinType::Uint8)->PointerTo());
+    return;
+  }
+
+  // Fourth argument is the pipeline state pointer in serial mode, and the thread state container
+  // pointer in parallel mode
+  if (builtin == ast::Builtin::JoinHashTableBuildAndJoin) {
+    if (!args[3]->GetType()->IsPointerType()) {
+      ReportIncorrectCallArg(call, 3, GetBuiltinType(ast::BuiltinType::Uint8)->PointerTo());
+      return;
+    }
+  } else {
+    const auto tls_kind = ast::BuiltinType::ThreadStateContainer;
+    if (!IsPointerToSpecificBuiltin(args[3]->GetType(), tls_kind)) {
+      ReportIncorrectCallArg(call, 3, GetBuiltinType(tls_kind)->PointerTo());
+      return;
+    }
+  }
+
+  // Fifth argument is the join function
+  if (!args[4]->GetType()->IsFunctionType()) {
+    GetErrorReporter()->Report(call->Position(), ErrorMessages::kBadJoinFunction, args[4]->GetType());
+    return;
+  }
+
+  // This call returns nothing
+  call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+}
+
 void Sema::CheckBuiltinJoinHashTableLookup(ast::CallExpr *call) {
   if (!CheckArgCount(call, 3)) {
     return;
@@ -820,6 +989,43 @@ void Sema::CheckBuiltinJoinHashTableLookup(ast::CallExpr *call) {
   call->SetType(GetBuiltinType(ast::BuiltinType::HashTableEntryIterator));
 }
 
+void Sema::CheckBuiltinJoinHashTableParallelScan(ast::CallExpr *call) {
+  if (!CheckArgCount(call, 4)) {
+    return;
+  }
+
+  const auto &args = call->Arguments();
+
+  // First argument must be a pointer to a JoinHashTable
+  const auto jht_kind = ast::BuiltinType::JoinHashTable;
+  if (!IsPointerToSpecificBuiltin(args[0]->GetType(), jht_kind)) {
+    ReportIncorrectCallArg(call, 0, GetBuiltinType(jht_kind)->PointerTo());
+    return;
+  }
+
+  // Second argument is an opaque query state pointer
+  if (!args[1]->GetType()->IsPointerType()) {
+    ReportIncorrectCallArg(call, 1, GetBuiltinType(ast::BuiltinType::Uint8)->PointerTo());
+    return;
+  }
+
+  // Third argument is the thread state container pointer
+  const auto tls_kind = ast::BuiltinType::ThreadStateContainer;
+  if (!IsPointerToSpecificBuiltin(args[2]->GetType(), tls_kind)) {
+    ReportIncorrectCallArg(call, 2, GetBuiltinType(tls_kind)->PointerTo());
+    return;
+  }
+
+  // Fourth argument is the scanning function
+  if (!args[3]->GetType()->IsFunctionType()) {
+    GetErrorReporter()->Report(call->Position(), ErrorMessages::kBadParallelScanFunction, args[3]->GetType());
+    return;
+  }
+
+  // This call returns nothing
+  call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+}
+
 void Sema::CheckBuiltinJoinHashTableFree(ast::CallExpr *call) {
   if (!CheckArgCount(call, 1)) {
     return;
@@ -1330,7 +1536,7 @@ void Sema::CheckBuiltinTableIterCall(ast::CallExpr *call, ast::Builtin builtin)
 }
 
 void Sema::CheckBuiltinTableIterParCall(ast::CallExpr *call) {
-  if (!CheckArgCount(call, 5)) {
+  if (!CheckArgCountBetween(call, 5, 6)) {
     return;
   }
 
@@ -1383,6 +1589,114 @@ void Sema::CheckBuiltinTableIterParCall(ast::CallExpr *call) {
     return;
   }
 
+  // The optional sixth argument is the number of threads, which must be a constant.
+  if (call_args.size() > 5 && !call_args[5]->IsIntegerLiteral()) {
+    ReportIncorrectCallArg(call, 5, "Sixth argument should be an integer literal.");
+    return;
+  }
+
+  // This builtin does not return a value.
+  call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+}
+
+void Sema::CheckBuiltinCSVScanCall(ast::CallExpr *call, ast::Builtin builtin) {
+  if (!CheckArgCountAtLeast(call, 1)) {
+    return;
+  }
+
+  const auto &call_args = call->Arguments();
+
+  const auto scanner_kind = ast::BuiltinType::CSVScanner;
+  if (!IsPointerToSpecificBuiltin(call_args[0]->GetType(), scanner_kind)) {
+    ReportIncorrectCallArg(call, 0, GetBuiltinType(scanner_kind)->PointerTo());
+    return;
+  }
+
+  switch (builtin) {
+    case ast::Builtin::CSVScanInit: {
+      if (!CheckArgCount(call, 7)) {
+        return;
+      }
+      // The second argument is the execution context
+      const auto exec_ctx_kind = ast::BuiltinType::ExecutionContext;
+      if (!IsPointerToSpecificBuiltin(call_args[1]->GetType(), exec_ctx_kind)) {
+        ReportIncorrectCallArg(call, 1, GetBuiltinType(exec_ctx_kind)->PointerTo());
+        return;
+      }
+      // The third argument is the file name
+      if (!call_args[2]->IsStringLiteral()) {
+        ReportIncorrectCallArg(call, 2, ast::StringType::Get(GetContext()));
+        return;
+      }
+      // The remaining arguments are the number of fields, and the delimiter, quote and escape characters
+      for (uint32_t i = 3; i < 7; i++) {
+        if (!call_args[i]->IsIntegerLiteral()) {
+          ReportIncorrectCallArg(call, i, "Argument should be an integer literal.");
+          return;
+        }
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+      break;
+    }
+    case ast::Builtin::CSVScanAdvance: {
+      // A single-arg builtin returning a boolean
+      call->SetType(GetBuiltinType(ast::BuiltinType::Bool));
+      break;
+    }
+    case ast::Builtin::CSVScanGetVPI: {
+      // A single-arg builtin return a pointer to the current VPI
+      const auto vpi_kind = ast::BuiltinType::VectorProjectionIterator;
+      call->SetType(GetBuiltinType(vpi_kind)->PointerTo());
+      break;
+    }
+    case ast::Builtin::CSVScanClose: {
+      // A single-arg builtin returning void
+      call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+      break;
+    }
+    default: {
+      UNREACHABLE("Impossible CSV scan call");
+    }
+  }
+}
+
+void Sema::CheckBuiltinCSVScanParCall(ast::CallExpr *call) {
+  if (!CheckArgCount(call, 3)) {
+    return;
+  }
+
+  const auto &call_args = call->Arguments();
+
+  // The first argument is the scanner.
+  const auto scanner_kind = ast::BuiltinType::CSVScanner;
+  if (!IsPointerToSpecificBuiltin(call_args[0]->GetType(), scanner_kind)) {
+    ReportIncorrectCallArg(call, 0, GetBuiltinType(scanner_kind)->PointerTo());
+    return;
+  }
+
+  // The second argument is an opaque query state. For now, check it's a pointer.
+  const auto void_kind = ast::BuiltinType::Nil;
+  if (!call_args[1]->GetType()->IsPointerType()) {
+    ReportIncorrectCallArg(call, 1, GetBuiltinType(void_kind)->PointerTo());
+    return;
+  }
+
+  // The third argument is the scanner function. See CSVScanner::ScanFn.
+  auto *scan_fn_type = call_args[2]->GetType()->SafeAs<ast::FunctionType>();
+  if (scan_fn_type == nullptr) {
+    GetErrorReporter()->Report(call->Position(), ErrorMessages::kBadParallelScanFunction, call_args[2]->GetType());
+    return;
+  }
+  const auto vpi_kind = ast::BuiltinType::VectorProjectionIterator;
+  const auto &params = scan_fn_type->GetParams();
+  if (params.size() != 3                                            // Scan function has 3 arguments.
+      || !params[0].type_->IsPointerType()                          // QueryState, must contain execCtx.
+      || !params[1].type_->IsPointerType()                          // Thread state.
+      || !IsPointerToSpecificBuiltin(params[2].type_, vpi_kind)) {  // VectorProjectionIterator.
+    GetErrorReporter()->Report(call->Position(), ErrorMessages::kBadParallelScanFunction, call_args[2]->GetType());
+    return;
+  }
+
   // This builtin does not return a value.
   call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
 }
@@ -2267,6 +2581,46 @@ void Sema::CheckBuiltinSorterSort(ast::CallExpr *call, ast::Builtin builtin) {
   call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
 }
 
+void Sema::CheckBuiltinSorterScanPartitionsParallel(ast::CallExpr *call) {
+  if (!CheckArgCount(call, 5)) {
+    return;
+  }
+
+  const auto &call_args = call->Arguments();
+
+  // First argument must be a pointer to a Sorter
+  const auto sorter_kind = ast::BuiltinType::Sorter;
+  if (!IsPointerToSpecificBuiltin(call_args[0]->GetType(), sorter_kind)) {
+    ReportIncorrectCallArg(call, 0, GetBuiltinType(sorter_kind)->PointerTo());
+    return;
+  }
+
+  // Second argument is an opaque query state pointer
+  if (!call_args[1]->GetType()->IsPointerType()) {
+    ReportIncorrectCallArg(call, 1, GetBuiltinType(ast::BuiltinType::Uint8)->PointerTo());
+    return;
+  }
+
+  // Third argument is the *ThreadStateContainer.
+  const auto tls_kind = ast::BuiltinType::ThreadStateContainer;
+  if (!IsPointerToSpecificBuiltin(call_args[2]->GetType(), tls_kind)) {
+    ReportIncorrectCallArg(call, 2, GetBuiltinType(tls_kind)->PointerTo());
+    return;
+  }
+
+  // Fourth argument is the partition equality function, and the fifth is the scanning function
+  for (uint32_t arg_idx : {3, 4}) {
+    if (!call_args[arg_idx]->GetType()->IsFunctionType()) {
+      GetErrorReporter()->Report(call->Position(), ErrorMessages::kBadParallelScanFunction,
+                                 call_args[arg_idx]->GetType());
+      return;
+    }
+  }
+
+  // This call returns nothing
+  call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+}
+
 void Sema::CheckBuiltinSorterFree(ast::CallExpr *call) {
   if (!CheckArgCount(call, 1)) {
     return;
@@ -2345,6 +2699,85 @@ void Sema::CheckBuiltinSorterIterCall(ast::CallExpr *call, ast::Builtin builtin)
   }
 }
 
+void Sema::CheckBuiltinSegmentTreeCall(ast::CallExpr *call, ast::Builtin builtin) {
+  if (!CheckArgCountAtLeast(call, 1)) {
+    return;
+  }
+
+  const auto &args = call->Arguments();
+
+  // First argument is always a pointer to a SegmentTree
+  const auto tree_kind = ast::BuiltinType::SegmentTree;
+  if (!IsPointerToSpecificBuiltin(args[0]->GetType(), tree_kind)) {
+    ReportIncorrectCallArg(call, 0, GetBuiltinType(tree_kind)->PointerTo());
+    return;
+  }
+
+  switch (builtin) {
+    case ast::Builtin::SegmentTreeInit: {
+      if (!CheckArgCount(call, 3)) {
+        return;
+      }
+      // The second argument is the execution context
+      const auto exec_ctx_kind = ast::BuiltinType::ExecutionContext;
+      if (!IsPointerToSpecificBuiltin(args[1]->GetType(), exec_ctx_kind)) {
+        ReportIncorrectCallArg(call, 1, GetBuiltinType(exec_ctx_kind)->PointerTo());
+        return;
+      }
+      // The third argument is the aggregate kind
+      if (!args[2]->GetType()->IsIntegerType()) {
+        ReportIncorrectCallArg(call, 2, GetBuiltinType(ast::BuiltinType::Uint32));
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+      break;
+    }
+    case ast::Builtin::SegmentTreeAppend: {
+      if (!CheckArgCount(call, 2)) {
+        return;
+      }
+      // The second argument is the SQL integer or real value to append
+      if (!args[1]->GetType()->IsSpecificBuiltin(ast::BuiltinType::Integer) &&
+          !args[1]->GetType()->IsSpecificBuiltin(ast::BuiltinType::Real)) {
+        ReportIncorrectCallArg(call, 1, "SQL Integer or Real");
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+      break;
+    }
+    case ast::Builtin::SegmentTreeQueryInt:
+    case ast::Builtin::SegmentTreeQueryReal: {
+      if (!CheckArgCount(call, 3)) {
+        return;
+      }
+      // The second and third arguments are the 64-bit bounds of the range
+      for (uint32_t arg_idx = 1; arg_idx < 3; arg_idx++) {
+        if (!args[arg_idx]->GetType()->IsSpecificBuiltin(ast::BuiltinType::Int64) &&
+            !args[arg_idx]->GetType()->IsSpecificBuiltin(ast::BuiltinType::Uint64)) {
+          ReportIncorrectCallArg(call, arg_idx, GetBuiltinType(ast::BuiltinType::Uint64));
+          return;
+        }
+      }
+      const auto ret_kind =
+          builtin == ast::Builtin::SegmentTreeQueryInt ? ast::BuiltinType::Integer : ast::BuiltinType::Real;
+      call->SetType(GetBuiltinType(ret_kind));
+      break;
+    }
+    case ast::Builtin::SegmentTreeBuild:
+    case ast::Builtin::SegmentTreeReset:
+    case ast::Builtin::SegmentTreeFree: {
+      if (!CheckArgCount(call, 1)) {
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+      break;
+    }
+    default: {
+      UNREACHABLE("Impossible segment tree call");
+    }
+  }
+}
+
 void Sema::CheckBuiltinIndexIteratorInit(execution::ast::CallExpr *call, ast::Builtin builtin) {
   // First argument must be a pointer to a IndexIterator
   const auto index_kind = ast::BuiltinType::IndexIterator;
@@ -2421,14 +2854,18 @@ void Sema::CheckBuiltinIndexIteratorScan(execution::ast::CallExpr *call, ast::Bu
 
   switch (builtin) {
     case ast::Builtin::IndexIteratorScanKey:
+    case ast::Builtin::IndexIteratorAddBatchKey:
+    case ast::Builtin::IndexIteratorScanKeyBatch:
     case ast::Builtin::IndexIteratorScanDescending: {
       if (!CheckArgCount(call, 1)) return;
       break;
     }
-    case ast::Builtin::IndexIteratorScanAscending: {
+    case ast::Builtin::IndexIteratorScanAscending:
+    case ast::Builtin::IndexIteratorScanAscendingKeys: {
       if (!CheckArgCount(call, 3)) return;
       break;
     }
+    case ast::Builtin::IndexIteratorSelectBatchResult:
     case ast::Builtin::IndexIteratorScanLimitDescending: {
       if (!CheckArgCount(call, 2)) return;
       auto uint32_kind = ast::BuiltinType::Uint32;
@@ -2491,6 +2928,7 @@ void Sema::CheckBuiltinIndexIteratorPRCall(ast::CallExpr *call, ast::Builtin bui
     case ast::Builtin::IndexIteratorGetLoPR:
     case ast::Builtin::IndexIteratorGetHiPR:
     case ast::Builtin::IndexIteratorGetTablePR:
+    case ast::Builtin::IndexIteratorGetKeyPR:
       call->SetType(GetBuiltinType(ast::BuiltinType::ProjectedRow)->PointerTo());
       break;
     case ast::Builtin::IndexIteratorGetSlot:
@@ -2796,6 +3234,53 @@ void Sema::CheckBuiltinStorageInterfaceCall(ast::CallExpr *call, ast::Builtin bu
       call->SetType(GetBuiltinType(ast::BuiltinType::Bool));
       break;
     }
+    case ast::Builtin::IndexInsertBatch: {
+      if (!CheckArgCount(call, 1)) {
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Bool));
+      break;
+    }
+    case ast::Builtin::IndexDeleteBatch: {
+      if (!CheckArgCount(call, 2)) {
+        return;
+      }
+      // Second argument is a tuple slot
+      auto tuple_slot_type = ast::BuiltinType::TupleSlot;
+      if (!IsPointerToSpecificBuiltin(call_args[1]->GetType(), tuple_slot_type)) {
+        ReportIncorrectCallArg(call, 1, GetBuiltinType(tuple_slot_type)->PointerTo());
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+      break;
+    }
+    case ast::Builtin::IndexFlushBatches: {
+      if (!CheckArgCount(call, 1)) {
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Bool));
+      break;
+    }
+    case ast::Builtin::IndexBulkLoadStage: {
+      if (!CheckArgCount(call, 2)) {
+        return;
+      }
+      // Second argument is a tuple slot
+      auto tuple_slot_type = ast::BuiltinType::TupleSlot;
+      if (!IsPointerToSpecificBuiltin(call_args[1]->GetType(), tuple_slot_type)) {
+        ReportIncorrectCallArg(call, 1, GetBuiltinType(tuple_slot_type)->PointerTo());
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Bool));
+      break;
+    }
+    case ast::Builtin::IndexBulkLoad: {
+      if (!CheckArgCount(call, 1)) {
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Bool));
+      break;
+    }
     case ast::Builtin::IndexDelete: {
       if (!CheckArgCount(call, 2)) {
         return;
@@ -3299,6 +3784,12 @@ void Sema::CheckBuiltinCall(ast::CallExpr *call) {
       CheckBuiltinStringLikeCall(call);
       break;
     }
+    case ast::Builtin::LikePatternInit:
+    case ast::Builtin::LikePatternMatch:
+    case ast::Builtin::LikePatternFree: {
+      CheckBuiltinLikePatternCall(call, builtin);
+      break;
+    }
     case ast::Builtin::DatePart: {
       CheckBuiltinDateFunctionCall(call, builtin);
       break;
@@ -3346,6 +3837,17 @@ void Sema::CheckBuiltinCall(ast::CallExpr *call) {
       CheckBuiltinTableIterParCall(call);
       break;
     }
+    case ast::Builtin::CSVScanInit:
+    case ast::Builtin::CSVScanAdvance:
+    case ast::Builtin::CSVScanGetVPI:
+    case ast::Builtin::CSVScanClose: {
+      CheckBuiltinCSVScanCall(call, builtin);
+      break;
+    }
+    case ast::Builtin::CSVScanParallel: {
+      CheckBuiltinCSVScanParCall(call);
+      break;
+    }
     case ast::Builtin::VPIInit:
     case ast::Builtin::VPIFree:
     case ast::Builtin::VPIIsFiltered:
@@ -3458,6 +3960,7 @@ void Sema::CheckBuiltinCall(ast::CallExpr *call) {
     }
     case ast::Builtin::AggInit:
     case ast::Builtin::AggAdvance:
+    case ast::Builtin::AggAdvanceVector:
     case ast::Builtin::AggMerge:
     case ast::Builtin::AggReset:
     case ast::Builtin::AggResult:
@@ -3478,14 +3981,24 @@ void Sema::CheckBuiltinCall(ast::CallExpr *call) {
       break;
     }
     case ast::Builtin::JoinHashTableBuild:
-    case ast::Builtin::JoinHashTableBuildParallel: {
+    case ast::Builtin::JoinHashTableBuildParallel:
+    case ast::Builtin::JoinHashTableMoveTuplesParallel: {
       CheckBuiltinJoinHashTableBuild(call, builtin);
       break;
     }
+    case ast::Builtin::JoinHashTableBuildAndJoin:
+    case ast::Builtin::JoinHashTableBuildAndJoinParallel: {
+      CheckBuiltinJoinHashTableBuildAndJoin(call, builtin);
+      break;
+    }
     case ast::Builtin::JoinHashTableLookup: {
       CheckBuiltinJoinHashTableLookup(call);
       break;
     }
+    case ast::Builtin::JoinHashTableParallelScan: {
+      CheckBuiltinJoinHashTableParallelScan(call);
+      break;
+    }
     case ast::Builtin::JoinHashTableFree: {
       CheckBuiltinJoinHashTableFree(call);
       break;
@@ -3523,6 +4036,10 @@ void Sema::CheckBuiltinCall(ast::CallExpr *call) {
       CheckBuiltinSorterSort(call, builtin);
       break;
     }
+    case ast::Builtin::SorterScanPartitionsParallel: {
+      CheckBuiltinSorterScanPartitionsParallel(call);
+      break;
+    }
     case ast::Builtin::SorterFree: {
       CheckBuiltinSorterFree(call);
       break;
@@ -3536,6 +4053,16 @@ void Sema::CheckBuiltinCall(ast::CallExpr *call) {
       CheckBuiltinSorterIterCall(call, builtin);
       break;
     }
+    case ast::Builtin::SegmentTreeInit:
+    case ast::Builtin::SegmentTreeAppend:
+    case ast::Builtin::SegmentTreeBuild:
+    case ast::Builtin::SegmentTreeQueryInt:
+    case ast::Builtin::SegmentTreeQueryReal:
+    case ast::Builtin::SegmentTreeReset:
+    case ast::Builtin::SegmentTreeFree: {
+      CheckBuiltinSegmentTreeCall(call, builtin);
+      break;
+    }
     case ast::Builtin::ResultBufferNew:
     case ast::Builtin::ResultBufferAllocOutRow:
     case ast::Builtin::ResultBufferFinalize:
@@ -3552,7 +4079,11 @@ void Sema::CheckBuiltinCall(ast::CallExpr *call) {
       break;
     }
     case ast::Builtin::IndexIteratorScanKey:
+    case ast::Builtin::IndexIteratorAddBatchKey:
+    case ast::Builtin::IndexIteratorScanKeyBatch:
+    case ast::Builtin::IndexIteratorSelectBatchResult:
     case ast::Builtin::IndexIteratorScanAscending:
+    case ast::Builtin::IndexIteratorScanAscendingKeys:
     case ast::Builtin::IndexIteratorScanDescending:
     case ast::Builtin::IndexIteratorScanLimitDescending: {
       CheckBuiltinIndexIteratorScan(call, builtin);
@@ -3566,7 +4097,8 @@ void Sema::CheckBuiltinCall(ast::CallExpr *call) {
     case ast::Builtin::IndexIteratorGetLoPR:
     case ast::Builtin::IndexIteratorGetHiPR:
     case ast::Builtin::IndexIteratorGetSlot:
-    case ast::Builtin::IndexIteratorGetTablePR: {
+    case ast::Builtin::IndexIteratorGetTablePR:
+    case ast::Builtin::IndexIteratorGetKeyPR: {
       CheckBuiltinIndexIteratorPRCall(call, builtin);
       break;
     }
@@ -3638,6 +4170,11 @@ void Sema::CheckBuiltinCall(ast::CallExpr *call) {
     case ast::Builtin::IndexInsert:
     case ast::Builtin::IndexInsertUnique:
     case ast::Builtin::IndexInsertWithSlot:
+    case ast::Builtin::IndexInsertBatch:
+    case ast::Builtin::IndexDeleteBatch:
+    case ast::Builtin::IndexFlushBatches:
+    case ast::Builtin::IndexBulkLoadStage:
+    case ast::Builtin::IndexBulkLoad:
     case ast::Builtin::IndexDelete:
     case ast::Builtin::StorageInterfaceFree: {
       CheckBuiltinStorageInterfaceCall(call, builtin);
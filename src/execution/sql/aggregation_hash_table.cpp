@@ -167,7 +167,10 @@ AggregationHashTable::AggregationHashTable(const exec::ExecutionSettings &exec_s
       partition_tails_(nullptr),
       partition_estimates_(nullptr),
       partition_tables_(nullptr),
-      partition_shift_bits_(util::BitUtil::CountLeadingZeros(uint64_t(DEFAULT_NUM_PARTITIONS) - 1)) {
+      partition_shift_bits_(util::BitUtil::CountLeadingZeros(uint64_t(DEFAULT_NUM_PARTITIONS) - 1)),
+      num_preaggregated_tuples_(0),
+      num_bypass_batches_left_(0),
+      num_bypass_tuples_left_(0) {
   hash_table_.SetSize(initial_size, memory_->GetTracker());
   max_fill_ = std::llround(hash_table_.GetCapacity() * hash_table_.GetLoadFactor());
 
@@ -270,6 +273,16 @@ void AggregationHashTable::AllocateOverflowPartitions() {
   }
 }
 
+void AggregationHashTable::LinkIntoOverflowPartition(HashTableEntry *entry) {
+  const uint64_t partition_idx = (entry->hash_ >> partition_shift_bits_);
+  entry->next_ = partition_heads_[partition_idx];
+  partition_heads_[partition_idx] = entry;
+  if (UNLIKELY(partition_tails_[partition_idx] == nullptr)) {
+    partition_tails_[partition_idx] = entry;
+  }
+  partition_estimates_[partition_idx]->Update(common::HashUtil::ScrambleHash(entry->hash_));
+}
+
 void AggregationHashTable::FlushToOverflowPartitions() {
   if (UNLIKELY(partition_heads_ == nullptr)) {
     AllocateOverflowPartitions();
@@ -285,24 +298,42 @@ void AggregationHashTable::FlushToOverflowPartitions() {
   // hash values using a bijective hash scrambling before feeding them to the
   // estimator.
 
-  hash_table_.FlushEntries([this](HashTableEntry *entry) {
-    const uint64_t partition_idx = (entry->hash_ >> partition_shift_bits_);
-    entry->next_ = partition_heads_[partition_idx];
-    partition_heads_[partition_idx] = entry;
-    if (UNLIKELY(partition_tails_[partition_idx] == nullptr)) {
-      partition_tails_[partition_idx] = entry;
-    }
-    partition_estimates_[partition_idx]->Update(common::HashUtil::ScrambleHash(entry->hash_));
-  });
+  hash_table_.FlushEntries([this](HashTableEntry *entry) { LinkIntoOverflowPartition(entry); });
 
   // Update stats
   stats_.num_flushes_++;
 }
 
+bool AggregationHashTable::FlushPreAggregationTable() {
+  const double reduction = static_cast<double>(num_preaggregated_tuples_) / GetTupleCount();
+  FlushToOverflowPartitions();
+  num_preaggregated_tuples_ = 0;
+  return reduction < MIN_PREAGGREGATION_REDUCTION;
+}
+
 byte *AggregationHashTable::AllocInputTuplePartitioned(hash_t hash) {
+  // If pre-aggregation recently failed to reduce the input, skip the main
+  // table. The new entry goes straight into its overflow partition, where it
+  // is merged with the other partial aggregates of its group. Lookups made
+  // while bypassing always miss, so they don't count towards the reduction of
+  // the main table once it is tried again.
+  if (num_bypass_tuples_left_ > 0) {
+    if (UNLIKELY(partition_heads_ == nullptr)) {
+      AllocateOverflowPartitions();
+    }
+    if (--num_bypass_tuples_left_ == 0) {
+      num_preaggregated_tuples_ = 0;
+    }
+    auto *entry = reinterpret_cast<HashTableEntry *>(entries_.Append());
+    entry->hash_ = hash;
+    LinkIntoOverflowPartition(entry);
+    stats_.num_bypassed_++;
+    return entry->payload_;
+  }
+
   byte *ret = AllocInputTuple(hash);
-  if (NeedsToFlushToOverflowPartitions()) {
-    FlushToOverflowPartitions();
+  if (NeedsToFlushToOverflowPartitions() && FlushPreAggregationTable()) {
+    num_bypass_tuples_left_ = NUM_BYPASS_TUPLES;
   }
   return ret;
 }
@@ -492,6 +523,43 @@ void AggregationHashTable::AdvanceGroups(VectorProjectionIterator *input_batch,
   advance_agg_fn(&iter, input_batch);
 }
 
+void AggregationHashTable::BypassBatch(VectorProjectionIterator *input_batch,
+                                       const AggregationHashTable::VectorInitAggFn init_agg_fn,
+                                       const AggregationHashTable::VectorAdvanceAggFn advance_agg_fn) {
+  if (UNLIKELY(partition_heads_ == nullptr)) {
+    AllocateOverflowPartitions();
+  }
+
+  // After the reset, the groups-not-found list holds every active tuple in the
+  // batch. Give each its own entry, and link it straight into its overflow
+  // partition without touching the main table. Duplicate keys are combined
+  // when the partitions are merged.
+  TupleIdList *tids = batch_state_->GroupsNotFound();
+  auto *RESTRICT raw_hashes = reinterpret_cast<const hash_t *>(batch_state_->Hashes()->GetData());
+  auto *RESTRICT raw_entries = reinterpret_cast<HashTableEntry **>(batch_state_->Entries()->GetData());
+  tids->ForEach([&](const uint64_t i) {
+    auto *entry = reinterpret_cast<HashTableEntry *>(entries_.Append());
+    entry->hash_ = raw_hashes[i];
+    LinkIntoOverflowPartition(entry);
+    raw_entries[i] = entry;
+  });
+
+  // Initialize the new aggregates, then advance each with its tuple.
+  {
+    VectorProjectionIterator iter(batch_state_->Projection(), tids);
+    input_batch->SetVectorProjection(input_batch->GetVectorProjection(), tids);
+    init_agg_fn(&iter, input_batch);
+  }
+  {
+    VectorProjectionIterator iter(batch_state_->Projection(), tids);
+    input_batch->SetVectorProjection(input_batch->GetVectorProjection(), tids);
+    advance_agg_fn(&iter, input_batch);
+  }
+
+  // Update stats
+  stats_.num_bypassed_ += tids->GetTupleCount();
+}
+
 void AggregationHashTable::ProcessBatch(VectorProjectionIterator *input_batch, const std::vector<uint32_t> &key_indexes,
                                         const AggregationHashTable::VectorInitAggFn init_agg_fn,
                                         const AggregationHashTable::VectorAdvanceAggFn advance_agg_fn,
@@ -506,6 +574,14 @@ void AggregationHashTable::ProcessBatch(VectorProjectionIterator *input_batch, c
     batch_state_ = memory_->MakeObject<BatchProcessState>(
         libcount::HLL::Create(DEFAULT_HLL_PRECISION),  // The Hyper-Log-Log estimator
         std::make_unique<HashToGroupIdMap>());         // The Hash-to-GroupID map
+
+    // In partitioned mode, the main table never grows. It is flushed once it
+    // reaches the flush threshold, so size it for the threshold up-front to
+    // keep its chains short. This is only possible while it is empty.
+    if (partitioned_aggregation && max_fill_ < flush_threshold_ && GetTupleCount() == 0) {
+      hash_table_.SetSize(flush_threshold_, memory_->GetTracker());
+      max_fill_ = std::llround(hash_table_.GetCapacity() * hash_table_.GetLoadFactor());
+    }
   }
 
   // Reset state for the incoming batch.
@@ -514,6 +590,17 @@ void AggregationHashTable::ProcessBatch(VectorProjectionIterator *input_batch, c
   // Compute the hashes.
   ComputeHash(input_batch, key_indexes);
 
+  // If pre-aggregation recently failed to reduce the input, skip it.
+  if (partitioned_aggregation && num_bypass_batches_left_ > 0) {
+    num_bypass_batches_left_--;
+    BypassBatch(input_batch, init_agg_fn, advance_agg_fn);
+    return;
+  }
+
+  if (partitioned_aggregation) {
+    num_preaggregated_tuples_ += input_batch->GetSelectedTupleCount();
+  }
+
   // Find groups.
   FindGroups(input_batch, key_indexes);
 
@@ -523,8 +610,10 @@ void AggregationHashTable::ProcessBatch(VectorProjectionIterator *input_batch, c
   // If the caller requested a partitioned aggregation, drain the main hash
   // table out to the overflow partitions, but only if needed.
   if (partitioned_aggregation) {
-    if (NeedsToFlushToOverflowPartitions()) {
-      FlushToOverflowPartitions();
+    if (NeedsToFlushToOverflowPartitions() && FlushPreAggregationTable()) {
+      // The table is full, and its groups didn't absorb enough of the input
+      // to pay for the lookups. Bypass it for the next few batches.
+      num_bypass_batches_left_ = NUM_BYPASS_BATCHES;
     }
   } else {
     if (NeedsToGrow()) {
@@ -0,0 +1,504 @@
+#include "execution/sql/csv_scanner.h"
+
+#include <emmintrin.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include "common/constants.h"
+#include "common/error/error_code.h"
+#include "common/error/exception.h"
+#include "execution/exec/execution_context.h"
+#include "execution/exec/execution_settings.h"
+#include "execution/sql/thread_state_container.h"
+#include "execution/util/bit_util.h"
+#include "execution/util/timer.h"
+#include "loggers/execution_logger.h"
+#include "spdlog/fmt/fmt.h"
+#include "storage/storage_defs.h"
+
+namespace noisepage::execution::sql {
+
+namespace {
+
+/** The number of bytes that are classified at once. */
+constexpr uint32_t K_BLOCK_SIZE = 64;
+
+/** The characters that structure a CSV file. */
+struct CSVFormat {
+  char delimiter_;
+  char quote_;
+  char escape_;
+};
+
+/** Bitmaps of the quotes, delimiters and newlines in a block of the file. Bit i describes byte i of the block. */
+struct Block {
+  uint64_t quotes_;
+  uint64_t delimiters_;
+  uint64_t newlines_;
+};
+
+/** @return A bitmap of the bytes that are within quotes, given a bitmap of the quotes, in bit order. */
+uint64_t PrefixXor(uint64_t bits) {
+  bits ^= bits << 1;
+  bits ^= bits << 2;
+  bits ^= bits << 4;
+  bits ^= bits << 8;
+  bits ^= bits << 16;
+  bits ^= bits << 32;
+  return bits;
+}
+
+/** @return All ones if the last bit of the bitmap is set; zero otherwise. */
+uint64_t BroadcastLastBit(uint64_t bits) { return static_cast<uint64_t>(static_cast<int64_t>(bits) >> 63); }
+
+/**
+ * Classifies a range of the file a block at a time. An escape character escapes the character after it, unless it is
+ * itself escaped, so a character is escaped if it follows an odd number of escape characters.
+ */
+class BlockClassifier {
+ public:
+  BlockClassifier(const char *data, std::size_t size, const CSVFormat &format, std::size_t begin)
+      : data_end_(data + size),
+        quote_(_mm_set1_epi8(format.quote_)),
+        delimiter_(_mm_set1_epi8(format.delimiter_)),
+        newline_(_mm_set1_epi8('\n')),
+        escape_(_mm_set1_epi8(format.escape_)),
+        has_escape_(format.escape_ != format.quote_) {
+    // Whether the range begins with an escaped character depends on the escape characters right before it.
+    if (has_escape_) {
+      std::size_t num_escapes = 0;
+      while (num_escapes < begin && data[begin - num_escapes - 1] == format.escape_) {
+        num_escapes++;
+      }
+      escaped_ = num_escapes % 2;
+    }
+  }
+
+  /**
+   * Classify the block that begins at the given byte.
+   * @param block The first byte of the block.
+   * @param len The number of bytes in the block that belong to the range, at most 64.
+   * @return The bitmaps of the block, without the bytes beyond the range and without escaped quotes.
+   */
+  Block Classify(const char *block, uint32_t len) {
+    // Don't read past the end of the mapping.
+    alignas(16) char padded[K_BLOCK_SIZE];
+    if (block + K_BLOCK_SIZE > data_end_) {
+      std::memset(padded, 0, K_BLOCK_SIZE);
+      std::memcpy(padded, block, len);
+      block = padded;
+    }
+    const __m128i in[4] = {_mm_loadu_si128(reinterpret_cast<const __m128i *>(block)),
+                           _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + 16)),
+                           _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + 32)),
+                           _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + 48))};
+    const uint64_t valid = len == K_BLOCK_SIZE ? ~uint64_t{0} : (uint64_t{1} << len) - 1;
+
+    Block result{Compare(in, quote_) & valid, Compare(in, delimiter_) & valid, Compare(in, newline_) & valid};
+    if (has_escape_) {
+      result.quotes_ &= ~FindEscaped(Compare(in, escape_) & valid);
+    }
+    return result;
+  }
+
+ private:
+  // Bitmap of the bytes equal to the given character.
+  static uint64_t Compare(const __m128i (&in)[4], const __m128i needle) {
+    uint64_t result = 0;
+    for (uint32_t i = 0; i < 4; i++) {
+      const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(in[i], needle)));
+      result |= static_cast<uint64_t>(mask) << (16 * i);
+    }
+    return result;
+  }
+
+  // Bitmap of the escaped bytes, given the bitmap of the escape characters. Runs of escape characters that begin on an
+  // even bit escape the byte after them if they end on an odd bit, and vice versa, which one addition finds for all
+  // runs at once.
+  uint64_t FindEscaped(uint64_t escapes) {
+    constexpr uint64_t even_bits = 0x5555555555555555ULL;
+    escapes &= ~escaped_;
+    const uint64_t follows_escape = escapes << 1 | escaped_;
+    const uint64_t odd_sequence_starts = escapes & ~even_bits & ~follows_escape;
+    uint64_t sequences_starting_on_even_bits;
+    escaped_ = __builtin_add_overflow(odd_sequence_starts, escapes, &sequences_starting_on_even_bits) ? 1 : 0;
+    const uint64_t invert_mask = sequences_starting_on_even_bits << 1;
+    return (even_bits ^ invert_mask) & follows_escape;
+  }
+
+ private:
+  const char *data_end_;
+  const __m128i quote_;
+  const __m128i delimiter_;
+  const __m128i newline_;
+  const __m128i escape_;
+  const bool has_escape_;
+  // 1 if the next block begins with an escaped byte.
+  uint64_t escaped_{0};
+};
+
+/** What the first pass over the file learns about one piece of it. */
+struct PieceSummary {
+  static constexpr std::size_t K_NONE = std::numeric_limits<std::size_t>::max();
+  // True if the piece has an odd number of quotes.
+  bool odd_quotes_{false};
+  // The offset of the first newline outside of quotes if the piece begins outside of [0] or within [1] quotes.
+  std::size_t first_newline_[2] = {K_NONE, K_NONE};
+};
+
+/** @return The summary of the bytes [begin, end) of the file. */
+PieceSummary SummarizePiece(const char *data, std::size_t size, const CSVFormat &format, std::size_t begin,
+                            std::size_t end) {
+  PieceSummary summary;
+  BlockClassifier classifier(data, size, format, begin);
+  uint64_t in_quotes_carry = 0;
+  for (std::size_t pos = begin; pos < end; pos += K_BLOCK_SIZE) {
+    const auto len = static_cast<uint32_t>(std::min<std::size_t>(K_BLOCK_SIZE, end - pos));
+    const Block block = classifier.Classify(data + pos, len);
+    // Assume that the piece begins outside of quotes. If it doesn't, everything within quotes is outside of them.
+    const uint64_t in_quotes = PrefixXor(block.quotes_) ^ in_quotes_carry;
+    in_quotes_carry = BroadcastLastBit(in_quotes);
+    const uint64_t newlines[2] = {block.newlines_ & ~in_quotes, block.newlines_ & in_quotes};
+    for (uint32_t state = 0; state < 2; state++) {
+      if (summary.first_newline_[state] == PieceSummary::K_NONE && newlines[state] != 0) {
+        summary.first_newline_[state] = pos + util::BitUtil::CountTrailingZeros(newlines[state]);
+      }
+    }
+  }
+  summary.odd_quotes_ = in_quotes_carry != 0;
+  return summary;
+}
+
+/**
+ * Parses record-aligned chunks of the file into vector projections of Varchar columns, and hands every full vector
+ * projection to a consumer. The consumer may take the vector projection, in which case the parser creates a new one;
+ * otherwise the parser reuses it.
+ * @tparam Consumer A callable taking a std::unique_ptr<VectorProjection> *.
+ */
+template <typename Consumer>
+class ChunkParser {
+ public:
+  ChunkParser(const char *data, std::size_t size, uint32_t num_cols, const CSVFormat &format, Consumer *consumer)
+      : data_(data),
+        size_(size),
+        num_cols_(num_cols),
+        format_(format),
+        col_types_(num_cols, TypeId::Varchar),
+        consumer_(consumer) {
+    NewVectorProjection();
+  }
+
+  /** Parse the chunk spanning the bytes [begin, end) of the file, and hand the last vector to the consumer. */
+  void Parse(std::size_t begin, std::size_t end) {
+    BlockClassifier classifier(data_, size_, format_, begin);
+    const char *field_begin = data_ + begin;
+    record_begin_ = field_begin;
+    uint64_t in_quotes_carry = 0;
+    for (std::size_t pos = begin; pos < end; pos += K_BLOCK_SIZE) {
+      const auto len = static_cast<uint32_t>(std::min<std::size_t>(K_BLOCK_SIZE, end - pos));
+      const Block block = classifier.Classify(data_ + pos, len);
+      const uint64_t in_quotes = PrefixXor(block.quotes_) ^ in_quotes_carry;
+      in_quotes_carry = BroadcastLastBit(in_quotes);
+
+      // Visit the delimiters and newlines outside of quotes in order.
+      uint64_t structurals = (block.delimiters_ | block.newlines_) & ~in_quotes;
+      while (structurals != 0) {
+        const auto idx = util::BitUtil::CountTrailingZeros(structurals);
+        structurals &= structurals - 1;
+        const char *field_end = data_ + pos + idx;
+        if ((block.newlines_ >> idx & 1) == 0) {
+          AddField(field_begin, field_end);
+        } else {
+          EndRecord(field_begin, field_end);
+        }
+        field_begin = field_end + 1;
+      }
+    }
+
+    // The last record of the file may not end with a newline.
+    if (field_begin < data_ + end || field_ != 0) {
+      EndRecord(field_begin, data_ + end);
+    }
+    Flush();
+  }
+
+ private:
+  void NewVectorProjection() {
+    vector_projection_ = std::make_unique<VectorProjection>();
+    vector_projection_->Initialize(col_types_);
+    vector_projection_->Reset(common::Constants::K_DEFAULT_VECTOR_SIZE);
+  }
+
+  void AddField(const char *begin, const char *end) {
+    if (field_ == num_cols_) {
+      throw EXECUTION_EXCEPTION(
+          fmt::format("CSV record at byte {} has more than the expected {} fields", record_begin_ - data_, num_cols_),
+          common::ErrorCode::ERRCODE_BAD_COPY_FILE_FORMAT);
+    }
+    Vector *column = vector_projection_->GetColumn(field_++);
+    auto *values = reinterpret_cast<storage::VarlenEntry *>(column->GetData());
+
+    // An unquoted empty field is NULL.
+    if (begin == end) {
+      column->SetNull(row_, true);
+      return;
+    }
+    column->SetNull(row_, false);
+
+    if (end - begin >= 2 && *begin == format_.quote_ && end[-1] == format_.quote_) {
+      begin++;
+      end--;
+      if (std::find(begin, end, format_.quote_) != end ||
+          (format_.escape_ != format_.quote_ && std::find(begin, end, format_.escape_) != end)) {
+        values[row_] = Unescape(column, begin, end);
+        return;
+      }
+    }
+
+    // Reference the field in the mapped file.
+    values[row_] =
+        storage::VarlenEntry::Create(reinterpret_cast<const byte *>(begin), static_cast<uint32_t>(end - begin), false);
+  }
+
+  void EndRecord(const char *field_begin, const char *record_end) {
+    // Accept CRLF line endings.
+    const char *field_end = record_end;
+    if (field_end > field_begin && field_end[-1] == '\r') {
+      field_end--;
+    }
+
+    // Skip blank lines.
+    if (field_ != 0 || field_begin != field_end) {
+      AddField(field_begin, field_end);
+      if (field_ != num_cols_) {
+        throw EXECUTION_EXCEPTION(fmt::format("CSV record at byte {} has {} fields, but {} were expected",
+                                              record_begin_ - data_, field_, num_cols_),
+                                  common::ErrorCode::ERRCODE_BAD_COPY_FILE_FORMAT);
+      }
+      field_ = 0;
+      if (++row_ == common::Constants::K_DEFAULT_VECTOR_SIZE) {
+        Flush();
+      }
+    }
+    record_begin_ = record_end + 1;
+  }
+
+  storage::VarlenEntry Unescape(Vector *column, const char *begin, const char *end) {
+    buffer_.clear();
+    for (const char *c = begin; c < end; c++) {
+      if (*c == format_.escape_ && c + 1 < end && (c[1] == format_.quote_ || c[1] == format_.escape_)) {
+        c++;
+      }
+      buffer_.push_back(*c);
+    }
+    return column->GetMutableStringHeap()->AddVarlen(buffer_);
+  }
+
+  void Flush() {
+    if (row_ == 0) {
+      return;
+    }
+    vector_projection_->Reset(row_);
+    (*consumer_)(&vector_projection_);
+    if (vector_projection_ == nullptr) {
+      NewVectorProjection();
+    } else {
+      for (uint32_t i = 0; i < num_cols_; i++) {
+        vector_projection_->GetColumn(i)->GetMutableStringHeap()->Destroy();
+      }
+      vector_projection_->Reset(common::Constants::K_DEFAULT_VECTOR_SIZE);
+    }
+    row_ = 0;
+  }
+
+ private:
+  const char *data_;
+  const std::size_t size_;
+  const uint32_t num_cols_;
+  const CSVFormat format_;
+  const std::vector<TypeId> col_types_;
+  Consumer *consumer_;
+
+  // The vector projection being filled, and its row and column being filled.
+  std::unique_ptr<VectorProjection> vector_projection_;
+  uint32_t row_{0};
+  uint32_t field_{0};
+  // The first byte of the current record, for error messages.
+  const char *record_begin_{nullptr};
+  // Buffer for unescaping fields.
+  std::string buffer_;
+};
+
+}  // namespace
+
+CSVScanner::CSVScanner(exec::ExecutionContext *exec_ctx, std::string_view file_name, uint32_t num_cols,
+                       char delimiter, char quote, char escape)
+    : exec_ctx_(exec_ctx), num_cols_(num_cols), delimiter_(delimiter), quote_(quote), escape_(escape) {
+  NOISEPAGE_ASSERT(num_cols > 0, "CSV records must have a field");
+  NOISEPAGE_ASSERT(delimiter != quote && delimiter != '\n' && quote != '\n', "Ambiguous CSV format");
+
+  const std::string path(file_name);
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    throw EXECUTION_EXCEPTION(fmt::format("could not open file \"{}\" for reading: {}", path, std::strerror(errno)),
+                              common::ErrorCode::ERRCODE_UNDEFINED_FILE);
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) == -1) {
+    const int saved_errno = errno;
+    close(fd);
+    throw EXECUTION_EXCEPTION(fmt::format("could not stat file \"{}\": {}", path, std::strerror(saved_errno)),
+                              common::ErrorCode::ERRCODE_IO_ERROR);
+  }
+  size_ = static_cast<std::size_t>(file_stat.st_size);
+
+  if (size_ > 0) {
+    void *const ptr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    const int saved_errno = errno;
+    close(fd);
+    if (ptr == MAP_FAILED) {
+      throw EXECUTION_EXCEPTION(fmt::format("could not map file \"{}\": {}", path, std::strerror(saved_errno)),
+                                common::ErrorCode::ERRCODE_IO_ERROR);
+    }
+    // The whole file is read once, by many threads at different offsets.
+    madvise(ptr, size_, MADV_WILLNEED);
+    data_ = static_cast<const char *>(ptr);
+  } else {
+    close(fd);
+  }
+
+  FindChunks();
+}
+
+CSVScanner::~CSVScanner() {
+  if (data_ != nullptr) {
+    munmap(const_cast<char *>(data_), size_);
+  }
+}
+
+uint32_t CSVScanner::GetNumThreads(const uint32_t num_threads) const {
+  if (num_threads != 0) {
+    return num_threads;
+  }
+  return static_cast<uint32_t>(std::max(exec_ctx_->GetExecutionSettings().GetNumberOfParallelExecutionThreads(), 1));
+}
+
+void CSVScanner::FindChunks() {
+  chunk_starts_.push_back(0);
+  if (size_ == 0) {
+    return;
+  }
+
+  const std::size_t num_pieces = (size_ + K_CHUNK_SIZE - 1) / K_CHUNK_SIZE;
+  if (num_pieces > 1) {
+    const CSVFormat format{delimiter_, quote_, escape_};
+    std::vector<PieceSummary> summaries(num_pieces);
+    tbb::task_arena limited_arena(GetNumThreads(0));
+    limited_arena.execute([&] {
+      tbb::parallel_for(std::size_t{0}, num_pieces, [&](const std::size_t piece) {
+        const std::size_t begin = piece * K_CHUNK_SIZE;
+        summaries[piece] = SummarizePiece(data_, size_, format, begin, std::min(size_, begin + K_CHUNK_SIZE));
+      });
+    });
+
+    // A chunk begins after the first newline of every piece that is outside of quotes, which depends on the quotes in
+    // all pieces before it.
+    bool in_quotes = summaries[0].odd_quotes_;
+    for (std::size_t piece = 1; piece < num_pieces; piece++) {
+      const std::size_t newline = summaries[piece].first_newline_[in_quotes ? 1 : 0];
+      if (newline != PieceSummary::K_NONE && newline + 1 < size_) {
+        chunk_starts_.push_back(newline + 1);
+      }
+      in_quotes ^= summaries[piece].odd_quotes_;
+    }
+  }
+
+  chunk_starts_.push_back(size_);
+}
+
+bool CSVScanner::Advance() {
+  while (next_parsed_ == parsed_.size()) {
+    if (next_chunk_ == GetNumChunks()) {
+      return false;
+    }
+    ParseNextChunks();
+  }
+  vector_projection_iterator_.SetVectorProjection(parsed_[next_parsed_++].get());
+  return true;
+}
+
+void CSVScanner::ParseNextChunks() {
+  const uint32_t num_threads = GetNumThreads(0);
+  const std::size_t begin = next_chunk_;
+  const std::size_t end = std::min(GetNumChunks(), begin + num_threads);
+
+  const CSVFormat format{delimiter_, quote_, escape_};
+  std::vector<std::vector<std::unique_ptr<VectorProjection>>> chunk_vectors(end - begin);
+  tbb::task_arena limited_arena(num_threads);
+  limited_arena.execute([&] {
+    tbb::parallel_for(begin, end, [&](const std::size_t chunk) {
+      auto &vectors = chunk_vectors[chunk - begin];
+      auto consume = [&vectors](std::unique_ptr<VectorProjection> *vector_projection) {
+        vectors.push_back(std::move(*vector_projection));
+      };
+      ChunkParser<decltype(consume)> parser(data_, size_, num_cols_, format, &consume);
+      parser.Parse(chunk_starts_[chunk], chunk_starts_[chunk + 1]);
+    });
+  });
+
+  parsed_.clear();
+  next_parsed_ = 0;
+  for (auto &vectors : chunk_vectors) {
+    for (auto &vector_projection : vectors) {
+      parsed_.push_back(std::move(vector_projection));
+    }
+  }
+  next_chunk_ = end;
+}
+
+void CSVScanner::ParallelScan(void *const query_state, const ScanFn scan_fn, const uint32_t num_threads) {
+  util::Timer<std::milli> timer;
+  timer.Start();
+
+  const uint32_t arena_threads = GetNumThreads(num_threads);
+  exec_ctx_->SetNumConcurrentEstimate(std::min<std::size_t>(arena_threads, GetNumChunks()));
+
+  const CSVFormat format{delimiter_, quote_, escape_};
+  ThreadStateContainer *const thread_state_container = exec_ctx_->GetThreadStateContainer();
+  tbb::task_arena limited_arena(arena_threads);
+  limited_arena.execute([&] {
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, GetNumChunks(), 1),
+                      [&](const tbb::blocked_range<std::size_t> &chunks) {
+                        VectorProjectionIterator iter;
+                        auto consume = [&](std::unique_ptr<VectorProjection> *vector_projection) {
+                          iter.SetVectorProjection(vector_projection->get());
+                          byte *const thread_state = thread_state_container->AccessCurrentThreadState();
+                          scan_fn(query_state, thread_state, &iter);
+                        };
+                        ChunkParser<decltype(consume)> parser(data_, size_, num_cols_, format, &consume);
+                        for (std::size_t chunk = chunks.begin(); chunk != chunks.end(); chunk++) {
+                          parser.Parse(chunk_starts_[chunk], chunk_starts_[chunk + 1]);
+                        }
+                      });
+  });
+
+  exec_ctx_->SetNumConcurrentEstimate(0);
+  timer.Stop();
+
+  UNUSED_ATTRIBUTE double mbps = size_ / timer.GetElapsed() / 1000.0;
+  EXECUTION_LOG_TRACE("Scanned {} bytes of CSV in {} chunks in {} ms ({:.3f} MB/s)", size_, GetNumChunks(),
+                      timer.GetElapsed(), mbps);
+}
+
+}  // namespace noisepage::execution::sql
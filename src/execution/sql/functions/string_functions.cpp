@@ -395,6 +395,17 @@ void StringFunctions::Like(BoolVal *result, UNUSED_ATTRIBUTE exec::ExecutionCont
   result->val_ = sql::Like{}(string.val_, pattern.val_);  // NOLINT
 }
 
+void StringFunctions::Like(BoolVal *result, UNUSED_ATTRIBUTE exec::ExecutionContext *ctx, const StringVal &string,
+                           const LikePattern &pattern) {
+  if (string.is_null_) {
+    *result = BoolVal::Null();
+    return;
+  }
+
+  result->is_null_ = false;
+  result->val_ = pattern.Matches(string.val_);
+}
+
 void StringFunctions::StartsWith(BoolVal *result, exec::ExecutionContext *ctx, const StringVal &str,
                                  const StringVal &start) {
   if (str.is_null_ || start.is_null_) {
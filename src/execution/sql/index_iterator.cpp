@@ -1,8 +1,11 @@
 #include "execution/sql/index_iterator.h"
 
+#include <cstring>
+
 #include "catalog/catalog_accessor.h"
 #include "execution/sql/value.h"
 #include "storage/sql_table.h"
+#include "storage/storage_util.h"
 
 namespace noisepage::execution::sql {
 
@@ -29,6 +32,15 @@ void IndexIterator::Init() {
   hi_index_buffer_ =
       exec_ctx_->GetMemoryPool()->AllocateAligned(index_pri.ProjectedRowSize(), alignof(uint64_t), false);
   hi_index_pr_ = index_pri.InitializeRow(hi_index_buffer_);
+
+  // Key's PR, for index-only scans
+  key_size_ = index_->KeyListEntrySize();
+  if (key_size_ > 0) {
+    key_buffer_ = exec_ctx_->GetMemoryPool()->AllocateAligned(index_pri.ProjectedRowSize(), alignof(uint64_t), false);
+    key_pr_ = index_pri.InitializeRow(key_buffer_);
+    key_varlen_buffer_ =
+        reinterpret_cast<byte *>(exec_ctx_->GetMemoryPool()->AllocateAligned(key_size_, alignof(uint64_t), false));
+  }
 }
 
 void IndexIterator::ScanKey() {
@@ -38,6 +50,33 @@ void IndexIterator::ScanKey() {
   index_->ScanKey(*exec_ctx_->GetTxn(), *index_pr_, &tuples_);
 }
 
+void IndexIterator::AddBatchKey() {
+  const uint32_t key_size = storage::StorageUtil::PadUpToSize(alignof(uint64_t), index_pr_->Size());
+  batch_keys_.resize((num_batch_keys_ + 1) * key_size);
+  std::memcpy(batch_keys_.data() + num_batch_keys_ * key_size, index_pr_, index_pr_->Size());
+  num_batch_keys_++;
+}
+
+void IndexIterator::ScanKeyBatch() {
+  // The key buffer may have moved while it grew, so the keys are only located now
+  const uint32_t key_size = storage::StorageUtil::PadUpToSize(alignof(uint64_t), index_pr_->Size());
+  std::vector<const storage::ProjectedRow *> keys;
+  keys.reserve(num_batch_keys_);
+  for (uint32_t i = 0; i < num_batch_keys_; i++) {
+    keys.push_back(reinterpret_cast<const storage::ProjectedRow *>(batch_keys_.data() + i * key_size));
+  }
+  index_->ScanKeyBatch(*exec_ctx_->GetTxn(), keys, &batch_results_);
+  num_batch_keys_ = 0;
+}
+
+void IndexIterator::SelectBatchResult(uint32_t key_idx) {
+  NOISEPAGE_ASSERT(key_idx < batch_results_.size(), "SelectBatchResult() must follow a ScanKeyBatch() of the key.");
+  // Every result is iterated once, so it is taken instead of copied
+  tuples_.clear();
+  tuples_.swap(batch_results_[key_idx]);
+  curr_index_ = 0;
+}
+
 void IndexIterator::ScanAscending(storage::index::ScanType scan_type, uint32_t limit) {
   // Scan the index
   tuples_.clear();
@@ -45,6 +84,16 @@ void IndexIterator::ScanAscending(storage::index::ScanType scan_type, uint32_t l
   index_->ScanAscending(*exec_ctx_->GetTxn(), scan_type, num_attrs_, index_pr_, hi_index_pr_, limit, &tuples_);
 }
 
+void IndexIterator::ScanAscendingKeys(storage::index::ScanType scan_type, uint32_t limit) {
+  NOISEPAGE_ASSERT(key_size_ > 0, "The index can't return its keys.");
+  // Scan the index
+  tuples_.clear();
+  keys_.clear();
+  curr_index_ = 0;
+  index_->ScanAscendingWithKeys(*exec_ctx_->GetTxn(), scan_type, num_attrs_, index_pr_, hi_index_pr_, limit, &tuples_,
+                                &keys_);
+}
+
 void IndexIterator::ScanDescending() {
   // Scan the index
   tuples_.clear();
@@ -72,10 +121,20 @@ storage::ProjectedRow *IndexIterator::TablePR() {
   return table_pr_;
 }
 
+storage::ProjectedRow *IndexIterator::KeyPR() {
+  NOISEPAGE_ASSERT(keys_.size() == tuples_.size() * key_size_, "KeyPR() must follow a ScanAscendingKeys().");
+  index_->KeyToProjectedRow(keys_.data() + (curr_index_ - 1) * key_size_, key_pr_, key_varlen_buffer_);
+  return key_pr_;
+}
+
 IndexIterator::~IndexIterator() {
   // Free allocated buffers
   exec_ctx_->GetMemoryPool()->Deallocate(table_buffer_, table_pr_->Size());
   exec_ctx_->GetMemoryPool()->Deallocate(index_buffer_, index_pr_->Size());
   exec_ctx_->GetMemoryPool()->Deallocate(hi_index_buffer_, hi_index_pr_->Size());
+  if (key_size_ > 0) {
+    exec_ctx_->GetMemoryPool()->Deallocate(key_buffer_, key_pr_->Size());
+    exec_ctx_->GetMemoryPool()->Deallocate(key_varlen_buffer_, key_size_);
+  }
 }
 }  // namespace noisepage::execution::sql
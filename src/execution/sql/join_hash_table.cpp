@@ -1,10 +1,12 @@
 #include "execution/sql/join_hash_table.h"
 
 #include <llvm/ADT/STLExtras.h>
+#include <tbb/parallel_for.h>
 #include <tbb/parallel_for_each.h>
 #include <tbb/task_scheduler_init.h>
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
 #include <utility>
 #include <vector>
@@ -15,6 +17,8 @@
 #include "execution/sql/thread_state_container.h"
 #include "execution/sql/vector.h"
 #include "execution/sql/vector_operations/unary_operation_executor.h"
+#include "execution/sql/vector_operations/vector_operations.h"
+#include "execution/util/bit_util.h"
 #include "execution/util/cpu_info.h"
 #include "execution/util/memory.h"
 #include "execution/util/timer.h"
@@ -32,6 +36,7 @@ JoinHashTable::JoinHashTable(const exec::ExecutionSettings &exec_settings, exec:
       hll_estimator_(libcount::HLL::Create(DEFAULT_HLL_PRECISION)),
       built_(false),
       use_concise_ht_(use_concise_ht),
+      prefetch_probes_(false),
       tracker_(exec_ctx->GetMemoryPool()->GetTracker()) {}
 
 // Needed because we forward-declared HLL from libcount
@@ -52,8 +57,12 @@ void JoinHashTable::BuildChainingHashTable() {
   // Perfectly size the generic hash table in preparation for bulk-load.
   chaining_hash_table_.SetSize(GetTupleCount(), tracker_);
 
-  // Bulk-load the, now correctly sized, generic hash table using a non-concurrent algorithm.
+  // Bulk-load the, now correctly sized, generic hash table using a non-concurrent algorithm. The
+  // table owns tuples moved from thread-local tables through MoveTuplesParallel().
   chaining_hash_table_.InsertBatch<false>(&entries_);
+  for (auto &entries : owned_) {
+    chaining_hash_table_.InsertBatch<false>(&entries);
+  }
 
 #ifndef NDEBUG
   const auto [min, max, avg] = chaining_hash_table_.GetChainLengthStats();
@@ -511,19 +520,63 @@ void JoinHashTable::Build() {
   UNUSED_ATTRIBUTE double tps = (GetTupleCount() / timer.GetElapsed()) / 1000.0;
   EXECUTION_LOG_DEBUG("JHT: built {} tuples in {} ms ({:.2f} tps)", GetTupleCount(), timer.GetElapsed(), tps);
 
+  ChooseProbePrefetching();
   built_ = true;
 }
 
+void JoinHashTable::ChooseProbePrefetching() {
+  // Probes into a table that fits in cache don't miss, so prefetching only adds
+  // instructions. Otherwise, nearly every probe misses in the directory and then
+  // again in the entry it finds, which is what batched lookups prefetch.
+  const uint64_t l3_cache_size = CpuInfo::Instance()->GetCacheSize(CpuInfo::L3_CACHE);
+  const uint64_t entry_memory = GetTupleCount() * entries_.ElementSize();
+  prefetch_probes_ = GetJoinIndexMemoryUsage() + entry_memory > l3_cache_size;
+}
+
 // TODO(pmenon): Vectorized bloom filter pre-filtering.
-// TODO(pmenon): Implement prefetching.
+
+// Lookups are vectorized, so rather than hiding probe misses with a state
+// machine per probe, we prefetch in groups: the first pass over the vector
+// prefetches the directory slot of every hash, and the second finds every
+// chain head, by which time its slot has (hopefully) arrived, and prefetches
+// the head entry for the key comparison that follows.
 
 void JoinHashTable::LookupBatchInChainingHashTable(const Vector &hashes, Vector *results) const {
+  if (prefetch_probes_) {
+    const auto *RESTRICT raw_hashes = reinterpret_cast<const hash_t *>(hashes.GetData());
+    VectorOps::Exec(hashes, [&](const uint64_t i, UNUSED_ATTRIBUTE const uint64_t k) {
+      chaining_hash_table_.PrefetchChainHead<true>(raw_hashes[i]);
+    });
+    UnaryOperationExecutor::Execute<hash_t, const HashTableEntry *>(
+        exec_settings_, hashes, results, [&](const hash_t hash_val) noexcept {
+          HashTableEntry *entry = chaining_hash_table_.FindChainHead(hash_val);
+          util::Memory::Prefetch<true, Locality::Low>(entry);
+          return entry;
+        });
+    return;
+  }
+
   UnaryOperationExecutor::Execute<hash_t, const HashTableEntry *>(
       exec_settings_, hashes,
       results, [&](const hash_t hash_val) noexcept { return chaining_hash_table_.FindChainHead(hash_val); });
 }
 
 void JoinHashTable::LookupBatchInConciseHashTable(const Vector &hashes, Vector *results) const {
+  if (prefetch_probes_) {
+    const auto *RESTRICT raw_hashes = reinterpret_cast<const hash_t *>(hashes.GetData());
+    VectorOps::Exec(hashes, [&](const uint64_t i, UNUSED_ATTRIBUTE const uint64_t k) {
+      concise_hash_table_.PrefetchSlotGroup<true>(raw_hashes[i]);
+    });
+    UnaryOperationExecutor::Execute<hash_t, const HashTableEntry *>(
+        exec_settings_, hashes, results, [&](const hash_t hash_val) noexcept {
+          const auto [found, entry_idx] = concise_hash_table_.Lookup(hash_val);
+          const HashTableEntry *entry = found ? EntryAt(entry_idx) : nullptr;
+          util::Memory::Prefetch<true, Locality::Low>(entry);
+          return entry;
+        });
+    return;
+  }
+
   UnaryOperationExecutor::Execute<hash_t, const HashTableEntry *>(
       exec_settings_, hashes, results, [&](const hash_t hash_val) noexcept {
         const auto [found, entry_idx] = concise_hash_table_.Lookup(hash_val);
@@ -617,6 +670,238 @@ void JoinHashTable::MergeParallel(ThreadStateContainer *thread_state_container,
                       use_serial_build ? "Serial" : "Parallel", tl_join_tables.size(), num_elem_estimate,
                       chaining_hash_table_.GetElementCount(), timer.GetElapsed(), tps);
 
+  ChooseProbePrefetching();
+  built_ = true;
+}
+
+void JoinHashTable::MoveTuplesParallel(ThreadStateContainer *thread_state_container, const std::size_t jht_offset) {
+  NOISEPAGE_ASSERT(!IsBuilt(), "Cannot move tuples into a JoinHashTable that has already been built");
+
+  std::vector<JoinHashTable *> tl_join_tables;
+  thread_state_container->CollectThreadLocalStateElementsAs(&tl_join_tables, jht_offset);
+
+  common::SpinLatch::ScopedSpinLatch latch(&owned_latch_);
+  for (auto *jht : tl_join_tables) {
+    hll_estimator_->Merge(jht->hll_estimator_.get());
+    if (!jht->entries_.empty()) {
+      owned_.emplace_back(std::move(jht->entries_));
+    }
+  }
+}
+
+bool JoinHashTable::ShouldPartitionJoin(const uint64_t num_tuples, const std::size_t tuple_size) {
+  // Probing a table that doesn't fit in cache misses on nearly every probe, in
+  // the directory and then again in the entry it finds.
+  const uint64_t l3_cache_size = CpuInfo::Instance()->GetCacheSize(CpuInfo::L3_CACHE);
+  return num_tuples * (HashTableEntry::ComputeEntrySize(tuple_size) + sizeof(HashTableEntry *)) > l3_cache_size;
+}
+
+std::vector<JoinHashTable::EntryList *> JoinHashTable::GetEntryLists() {
+  std::vector<EntryList *> lists;
+  if (!entries_.empty()) {
+    lists.push_back(&entries_);
+  }
+  for (auto &entries : owned_) {
+    if (!entries.empty()) {
+      lists.push_back(&entries);
+    }
+  }
+  return lists;
+}
+
+namespace {
+
+// Invoke the function on every index in [0, n) along with the thread state of
+// the thread it's invoked in. If no thread state container is provided, this
+// is done serially with the provided serial thread state.
+template <typename F>
+void ForEachIndex(ThreadStateContainer *thread_state_container, void *serial_thread_state, const std::size_t n,
+                  const F &f) {
+  if (thread_state_container == nullptr) {
+    for (std::size_t i = 0; i < n; i++) {
+      f(serial_thread_state, i);
+    }
+    return;
+  }
+  tbb::parallel_for(std::size_t{0}, n,
+                    [&](const std::size_t i) { f(thread_state_container->AccessCurrentThreadState(), i); });
+}
+
+// Radix-partition the entries in the source lists into the empty list
+// 'target', in parallel over the sources if a thread state container is
+// provided. Partitions are stored one after the other, and within a partition,
+// the entries of each source are. Returns the index in the target where each
+// partition begins, followed by the size of the target.
+template <typename PartitionFn>
+std::vector<uint64_t> RadixPartition(const std::vector<JoinHashTable::EntryList *> &sources,
+                                     const uint32_t num_partitions, const PartitionFn &partition_of,
+                                     ThreadStateContainer *thread_state_container, JoinHashTable::EntryList *target) {
+  NOISEPAGE_ASSERT(target->empty(), "Partitioned entry list must be empty");
+
+  // First, histogram the partitions of each source.
+  std::vector<std::vector<uint64_t>> positions(sources.size(), std::vector<uint64_t>(num_partitions, 0));
+  ForEachIndex(thread_state_container, nullptr, sources.size(), [&](void *, const std::size_t i) {
+    for (const byte *entry : *sources[i]) {
+      positions[i][partition_of(entry)]++;
+    }
+  });
+
+  // Turn the histograms into the position each source writes its entries of
+  // each partition to.
+  std::vector<uint64_t> partition_begins(num_partitions + 1);
+  uint64_t position = 0;
+  for (uint32_t part_idx = 0; part_idx < num_partitions; part_idx++) {
+    partition_begins[part_idx] = position;
+    for (auto &source_positions : positions) {
+      position += std::exchange(source_positions[part_idx], position);
+    }
+  }
+  partition_begins[num_partitions] = position;
+
+  // Then, scatter the entries of each source to their partitions.
+  for (uint64_t i = 0; i < position; i++) {
+    target->Append();
+  }
+  ForEachIndex(thread_state_container, nullptr, sources.size(), [&](void *, const std::size_t i) {
+    const std::size_t entry_size = sources[i]->ElementSize();
+    uint64_t *source_positions = positions[i].data();
+    for (const byte *entry : *sources[i]) {
+      std::memcpy((*target)[source_positions[partition_of(entry)]++], entry, entry_size);
+    }
+  });
+
+  return partition_begins;
+}
+
+}  // namespace
+
+void JoinHashTable::ExecuteParallelScan(void *query_state, ThreadStateContainer *thread_state_container,
+                                        const ScanFn scan_fn) const {
+  NOISEPAGE_ASSERT(IsBuilt(), "Cannot scan a JoinHashTable that hasn't been built yet!");
+  NOISEPAGE_ASSERT(thread_state_container != nullptr, "Parallel scans require a thread state container");
+
+  // Split every entry list into morsels. If the table was built in parallel,
+  // its tuples are in the owned lists.
+  struct Morsel {
+    const EntryList *entries_;
+    uint64_t begin_, end_;
+  };
+  std::vector<Morsel> morsels;
+  const auto add_morsels = [&](const EntryList &entries) {
+    for (uint64_t begin = 0; begin < entries.size(); begin += PARALLEL_SCAN_MORSEL_SIZE) {
+      morsels.push_back({&entries, begin, std::min<uint64_t>(entries.size(), begin + PARALLEL_SCAN_MORSEL_SIZE)});
+    }
+  };
+  add_morsels(entries_);
+  for (const auto &entries : owned_) {
+    add_morsels(entries);
+  }
+
+  ForEachIndex(thread_state_container, nullptr, morsels.size(), [&](void *thread_state, const std::size_t i) {
+    JoinHashTableIterator iter(*this, *morsels[i].entries_, morsels[i].begin_, morsels[i].end_);
+    scan_fn(query_state, thread_state, &iter);
+  });
+}
+
+void JoinHashTable::BuildAndJoin(JoinHashTable *probe_table, void *query_state, void *thread_state,
+                                 const JoinFn join_fn) {
+  BuildAndJoinInternal(probe_table, query_state, thread_state, nullptr, join_fn);
+}
+
+void JoinHashTable::BuildAndJoinParallel(JoinHashTable *probe_table, void *query_state,
+                                         ThreadStateContainer *thread_state_container, const JoinFn join_fn) {
+  NOISEPAGE_ASSERT(thread_state_container != nullptr, "Parallel joins require a thread state container");
+  BuildAndJoinInternal(probe_table, query_state, nullptr, thread_state_container, join_fn);
+}
+
+void JoinHashTable::BuildAndJoinInternal(JoinHashTable *probe_table, void *query_state, void *thread_state,
+                                         ThreadStateContainer *thread_state_container, const JoinFn join_fn) {
+  NOISEPAGE_ASSERT(!IsBuilt(), "Join hash table has already been built");
+  NOISEPAGE_ASSERT(!UsingConciseHashTable(), "Joins with a concise hash table must be probed one tuple at a time");
+
+  const std::vector<EntryList *> probe_entries = probe_table->GetEntryLists();
+  if (ShouldPartitionJoin(GetTupleCount(), entries_.ElementSize() - sizeof(HashTableEntry)) &&
+      !probe_entries.empty()) {
+    BuildAndJoinPartitioned(probe_entries, query_state, thread_state, thread_state_container, join_fn);
+    return;
+  }
+
+  // The table stays in cache while it's probed.
+  Build();
+  ForEachIndex(thread_state_container, thread_state, probe_entries.size(),
+               [&](void *probe_thread_state, const std::size_t i) {
+                 for (const byte *probe : *probe_entries[i]) {
+                   const auto *probe_entry = reinterpret_cast<const HashTableEntry *>(probe);
+                   for (auto iter = Lookup<false>(probe_entry->hash_); iter.HasNext();) {
+                     join_fn(query_state, probe_thread_state, iter.GetMatchPayload(), probe_entry->PayloadAs<byte>());
+                   }
+                 }
+               });
+}
+
+void JoinHashTable::BuildAndJoinPartitioned(const std::vector<EntryList *> &probe_entries, void *query_state,
+                                            void *thread_state, ThreadStateContainer *thread_state_container,
+                                            const JoinFn join_fn) {
+  util::Timer<std::milli> timer;
+  timer.Start();
+
+  // We know the exact number of tuples, so size the directory perfectly.
+  const uint64_t num_tuples = GetTupleCount();
+  chaining_hash_table_.SetSize(num_tuples, tracker_);
+
+  // Tuples are partitioned by the most significant bits of the bucket they
+  // land in, so each partition owns a contiguous slice of the directory. Use
+  // as many partitions as needed for a partition's slice of the directory and
+  // its tuples to fit in half of L2.
+  const uint64_t capacity = chaining_hash_table_.GetCapacity();
+  const uint64_t l2_cache_size = CpuInfo::Instance()->GetCacheSize(CpuInfo::L2_CACHE);
+  const uint64_t total_size = chaining_hash_table_.GetTotalMemoryUsage() + num_tuples * entries_.ElementSize();
+  uint32_t radix_bits = 0;
+  while (radix_bits < MAX_RADIX_BITS && (uint64_t{1} << radix_bits) < capacity &&
+         (total_size >> radix_bits) > l2_cache_size / 2) {
+    radix_bits++;
+  }
+  const uint32_t num_partitions = 1u << radix_bits;
+  const uint64_t mask = capacity - 1;
+  const uint64_t shift = util::BitUtil::CountTrailingZeros(capacity) - radix_bits;
+  const auto partition_of = [&](const byte *entry) {
+    return static_cast<uint32_t>((reinterpret_cast<const HashTableEntry *>(entry)->hash_ & mask) >> shift);
+  };
+
+  // Partition both sides. The partitioned build tuples replace the originals,
+  // including those moved from thread-local tables.
+  EntryList build_partitions(entries_.ElementSize(), MemoryPoolAllocator<byte>(exec_ctx_->GetMemoryPool()));
+  const auto build_begins =
+      RadixPartition(GetEntryLists(), num_partitions, partition_of, thread_state_container, &build_partitions);
+  entries_ = std::move(build_partitions);
+  {
+    common::SpinLatch::ScopedSpinLatch latch(&owned_latch_);
+    owned_.clear();
+  }
+
+  EntryList probe_partitions(probe_entries[0]->ElementSize(), MemoryPoolAllocator<byte>(exec_ctx_->GetMemoryPool()));
+  const auto probe_begins =
+      RadixPartition(probe_entries, num_partitions, partition_of, thread_state_container, &probe_partitions);
+
+  // Build each partition of the table and probe it right away, while it's in
+  // cache. Partitions insert into disjoint slices of the directory, so they're
+  // joined in parallel without any synchronization.
+  ForEachIndex(thread_state_container, thread_state, num_partitions,
+               [&](void *part_thread_state, const std::size_t part_idx) {
+                 chaining_hash_table_.InsertRange(&entries_, build_begins[part_idx], build_begins[part_idx + 1]);
+                 for (uint64_t idx = probe_begins[part_idx]; idx < probe_begins[part_idx + 1]; idx++) {
+                   const auto *probe_entry = reinterpret_cast<const HashTableEntry *>(probe_partitions[idx]);
+                   for (auto iter = Lookup<false>(probe_entry->hash_); iter.HasNext();) {
+                     join_fn(query_state, part_thread_state, iter.GetMatchPayload(), probe_entry->PayloadAs<byte>());
+                   }
+                 }
+               });
+
+  timer.Stop();
+  EXECUTION_LOG_DEBUG("JHT: joined {} build and {} probe tuples in {} partitions in {} ms", num_tuples,
+                      probe_partitions.size(), num_partitions, timer.GetElapsed());
+
+  ChooseProbePrefetching();
   built_ = true;
 }
 
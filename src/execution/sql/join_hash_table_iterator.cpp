@@ -11,6 +11,16 @@ JoinHashTableIterator::JoinHashTableIterator(const JoinHashTable &table)
   if (!table.owned_.empty()) FindNextNonEmptyList();
 }
 
+JoinHashTableIterator::JoinHashTableIterator(const JoinHashTable &table, const JoinHashTable::EntryList &entries,
+                                             const uint64_t begin, const uint64_t end)
+    : entry_list_iter_(table.owned_.end()),
+      entry_list_end_(table.owned_.end()),
+      entry_iter_(entries.begin() + begin),
+      entry_end_(entries.begin() + end) {
+  NOISEPAGE_ASSERT(table.IsBuilt(), "Cannot iterate over a JoinHashTable that hasn't been built yet!");
+  NOISEPAGE_ASSERT(begin <= end && end <= entries.size(), "Invalid range of entries");
+}
+
 void JoinHashTableIterator::FindNextNonEmptyList() {
   for (; entry_list_iter_ != entry_list_end_ && entry_iter_ == entry_end_; ++entry_list_iter_) {
     entry_iter_ = entry_list_iter_->begin();
@@ -9,6 +9,7 @@
 #include "execution/sql/vector_operations/vector_operations.h"
 #include "execution/sql/vector_projection.h"
 #include "execution/util/cpu_info.h"
+#include "execution/util/memory.h"
 #include "spdlog/fmt/fmt.h"
 
 namespace noisepage::execution::sql {
@@ -81,7 +82,12 @@ void JoinHashTableVectorProbe::CheckKeyEquality(VectorProjection *input) {
 // Advance all non-null entries in the matches vector to their next element.
 void JoinHashTableVectorProbe::FollowNext() {
   auto *RESTRICT entries = reinterpret_cast<const HashTableEntry **>(curr_matches_.GetData());
-  non_null_entries_.Filter([&](uint64_t i) { return (entries[i] = entries[i]->next_) != nullptr; });
+  // Prefetch the next entries in the chains for the key check that follows.
+  non_null_entries_.Filter([&](uint64_t i) {
+    entries[i] = entries[i]->next_;
+    util::Memory::Prefetch<true, Locality::Low>(entries[i]);
+    return entries[i] != nullptr;
+  });
 }
 
 bool JoinHashTableVectorProbe::NextInnerJoin(VectorProjection *input) {
@@ -1,9 +1,152 @@
 #include "execution/sql/operators/like_operators.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#else
+#include <emmintrin.h>
+#endif
+
+#include <cstring>
+
 #include "common/macros.h"
+#include "execution/util/bit_util.h"
 
 namespace noisepage::execution::sql {
 
+LikePattern::LikePattern(const char *pattern, std::size_t pattern_len, char escape)
+    : pattern_(pattern, pattern_len), escape_(escape) {
+  NOISEPAGE_ASSERT(pattern != nullptr, "Pattern cannot be NULL");
+
+  // An escape character that is also a wildcard can't be told apart from it, so leave such patterns to Like::Impl().
+  if (escape == '%' || escape == '_') {
+    return;
+  }
+
+  // Skip the leading '%'s.
+  std::size_t begin = 0;
+  while (begin < pattern_len && pattern[begin] == '%') {
+    begin++;
+  }
+
+  // The remainder must be literal characters, optionally followed by '%'s.
+  std::size_t end = begin;
+  bool has_escapes = false, trailing = false;
+  for (std::size_t i = begin; i < pattern_len; i++) {
+    if (pattern[i] == '%') {
+      trailing = true;
+      continue;
+    }
+    if (trailing || pattern[i] == '_') {
+      return;
+    }
+    if (pattern[i] == escape) {
+      if (++i == pattern_len) {
+        // A trailing escape character never matches.
+        return;
+      }
+      has_escapes = true;
+    }
+    end = i + 1;
+  }
+
+  if (has_escapes) {
+    unescaped_.reserve(end - begin);
+    for (std::size_t i = begin; i < end; i++) {
+      i += static_cast<std::size_t>(pattern[i] == escape);
+      unescaped_.push_back(pattern[i]);
+    }
+  }
+  literal_begin_ = begin;
+  literal_len_ = end - begin;
+  has_escapes_ = has_escapes;
+
+  const bool leading = begin > 0;
+  if (leading) {
+    kind_ = trailing ? Kind::Contains : Kind::Suffix;
+  } else {
+    kind_ = trailing ? Kind::Prefix : Kind::Exact;
+  }
+}
+
+bool LikePattern::Matches(const char *str, std::size_t str_len) const {
+  NOISEPAGE_ASSERT(str != nullptr, "Input string cannot be NULL");
+  const std::string_view literal = GetLiteral();
+  const std::size_t literal_len = literal.size();
+  switch (kind_) {
+    case Kind::Exact:
+      return str_len == literal_len && std::memcmp(str, literal.data(), literal_len) == 0;
+    case Kind::Prefix:
+      return str_len >= literal_len && std::memcmp(str, literal.data(), literal_len) == 0;
+    case Kind::Suffix:
+      return str_len >= literal_len && std::memcmp(str + str_len - literal_len, literal.data(), literal_len) == 0;
+    case Kind::Contains:
+      return Contains(str, str_len, literal.data(), literal_len);
+    default:
+      return Like::Impl(str, str_len, pattern_.data(), pattern_.size(), escape_);
+  }
+}
+
+bool LikePattern::Contains(const char *haystack, std::size_t haystack_len, const char *needle,
+                           std::size_t needle_len) {
+  if (needle_len == 0) {
+    return true;
+  }
+  if (needle_len > haystack_len) {
+    return false;
+  }
+  if (needle_len == 1) {
+    return std::memchr(haystack, needle[0], haystack_len) != nullptr;
+  }
+
+  // A match at position i has needle[0] at haystack[i], and needle[last] at haystack[i + last]. Both are compared for
+  // a whole block of positions at once, and only the positions where both agree compare the rest of the needle.
+  const std::size_t last = needle_len - 1;
+  std::size_t i = 0;
+
+#if defined(__AVX2__)
+  const __m256i first_256 = _mm256_set1_epi8(needle[0]);
+  const __m256i last_256 = _mm256_set1_epi8(needle[last]);
+  for (; i + last + 32 <= haystack_len; i += 32) {
+    const auto *block = reinterpret_cast<const __m256i *>(haystack + i);
+    const auto *block_last = reinterpret_cast<const __m256i *>(haystack + i + last);
+    const __m256i eq_first = _mm256_cmpeq_epi8(first_256, _mm256_loadu_si256(block));
+    const __m256i eq_last = _mm256_cmpeq_epi8(last_256, _mm256_loadu_si256(block_last));
+    for (auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(eq_first, eq_last))); mask != 0;
+         mask &= mask - 1) {
+      const std::size_t pos = i + util::BitUtil::CountTrailingZeros(mask);
+      if (std::memcmp(haystack + pos + 1, needle + 1, last - 1) == 0) {
+        return true;
+      }
+    }
+  }
+#endif
+
+  const __m128i first_128 = _mm_set1_epi8(needle[0]);
+  const __m128i last_128 = _mm_set1_epi8(needle[last]);
+  for (; i + last + 16 <= haystack_len; i += 16) {
+    const auto *block = reinterpret_cast<const __m128i *>(haystack + i);
+    const auto *block_last = reinterpret_cast<const __m128i *>(haystack + i + last);
+    const __m128i eq_first = _mm_cmpeq_epi8(first_128, _mm_loadu_si128(block));
+    const __m128i eq_last = _mm_cmpeq_epi8(last_128, _mm_loadu_si128(block_last));
+    for (auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(eq_first, eq_last))); mask != 0;
+         mask &= mask - 1) {
+      const std::size_t pos = i + util::BitUtil::CountTrailingZeros(mask);
+      if (std::memcmp(haystack + pos + 1, needle + 1, last - 1) == 0) {
+        return true;
+      }
+    }
+  }
+
+  // The remaining positions don't fill a block.
+  for (; i + last < haystack_len; i++) {
+    if (haystack[i] == needle[0] && haystack[i + last] == needle[last] &&
+        std::memcmp(haystack + i + 1, needle + 1, last - 1) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
 #define NextByte(p, plen) ((p)++, (plen)--)
 
 // Inspired by Postgres
@@ -48,12 +191,9 @@ bool Like::Impl(const char *str, size_t str_len, const char *pattern, size_t pat
         return true;
       }
 
-      if (*p == escape) {
-        NextByte(p, plen);
-        NOISEPAGE_ASSERT(*p != 0, "LIKE pattern must not end with an escape character");
-        if (plen == 0) {
-          return false;
-        }
+      // An escaped character is left in the pattern, so that the recursive match below treats it literally.
+      if (*p == escape && plen == 1) {
+        return false;
       }
 
       while (slen > 0) {
@@ -0,0 +1,143 @@
+#include "execution/sql/segment_tree.h"
+
+#include <algorithm>
+
+#include "execution/exec/execution_context.h"
+#include "execution/sql/value.h"
+
+namespace noisepage::execution::sql {
+
+SegmentTree::SegmentTree(exec::ExecutionContext *exec_ctx, AggregateKind kind)
+    : kind_(kind), is_real_(false), built_(false), num_values_(0), nodes_(exec_ctx->GetMemoryPool()) {}
+
+void SegmentTree::Append(const Integer &val) {
+  NOISEPAGE_ASSERT(!built_, "Cannot append to a built segment tree");
+  NOISEPAGE_ASSERT(num_values_ == 0 || !is_real_, "All values in a segment tree must have the same type");
+  is_real_ = false;
+  Node leaf;
+  leaf.int_val_ = val.is_null_ ? 0 : val.val_;
+  leaf.count_ = val.is_null_ ? 0 : 1;
+  nodes_.push_back(leaf);
+  num_values_++;
+}
+
+void SegmentTree::Append(const Real &val) {
+  NOISEPAGE_ASSERT(!built_, "Cannot append to a built segment tree");
+  NOISEPAGE_ASSERT(num_values_ == 0 || is_real_, "All values in a segment tree must have the same type");
+  is_real_ = true;
+  Node leaf;
+  leaf.real_val_ = val.is_null_ ? 0.0 : val.val_;
+  leaf.count_ = val.is_null_ ? 0 : 1;
+  nodes_.push_back(leaf);
+  num_values_++;
+}
+
+void SegmentTree::Build() {
+  NOISEPAGE_ASSERT(!built_, "Segment tree was already built");
+  built_ = true;
+  if (num_values_ == 0) {
+    return;
+  }
+
+  // Move the leaves to the second half, then build every inner node from its two children, bottom-up.
+  nodes_.resize(2 * num_values_);
+  std::copy_backward(nodes_.begin(), nodes_.begin() + num_values_, nodes_.end());
+  for (uint64_t i = num_values_ - 1; i > 0; i--) {
+    nodes_[i] = Combine(nodes_[2 * i], nodes_[2 * i + 1]);
+  }
+}
+
+void SegmentTree::Reset() {
+  nodes_.clear();
+  num_values_ = 0;
+  built_ = false;
+}
+
+SegmentTree::Node SegmentTree::Combine(const Node &lhs, const Node &rhs) const {
+  // A side without values does not contribute to MIN or MAX.
+  if (rhs.count_ == 0 && kind_ != AggregateKind::Count) {
+    return lhs;
+  }
+  if (lhs.count_ == 0 && kind_ != AggregateKind::Count) {
+    return rhs;
+  }
+
+  Node result;
+  result.count_ = lhs.count_ + rhs.count_;
+  switch (kind_) {
+    case AggregateKind::Count:
+      result.int_val_ = 0;
+      break;
+    case AggregateKind::Sum:
+    case AggregateKind::Avg:
+      if (is_real_) {
+        result.real_val_ = lhs.real_val_ + rhs.real_val_;
+      } else {
+        result.int_val_ = lhs.int_val_ + rhs.int_val_;
+      }
+      break;
+    case AggregateKind::Min:
+      if (is_real_) {
+        result.real_val_ = std::min(lhs.real_val_, rhs.real_val_);
+      } else {
+        result.int_val_ = std::min(lhs.int_val_, rhs.int_val_);
+      }
+      break;
+    case AggregateKind::Max:
+      if (is_real_) {
+        result.real_val_ = std::max(lhs.real_val_, rhs.real_val_);
+      } else {
+        result.int_val_ = std::max(lhs.int_val_, rhs.int_val_);
+      }
+      break;
+  }
+  return result;
+}
+
+SegmentTree::Node SegmentTree::QueryRange(uint64_t begin, uint64_t end) const {
+  NOISEPAGE_ASSERT(built_, "Segment tree must be built before it is queried");
+  NOISEPAGE_ASSERT(begin <= end && end <= num_values_, "Range is out of bounds");
+
+  Node result;
+  result.int_val_ = 0;
+  result.count_ = 0;
+
+  // Walk up from both ends of the range. A left bound that is a right child, or a right bound that is a left child,
+  // covers a node its parent would overshoot, so that node is combined and the bound moves inwards.
+  for (begin += num_values_, end += num_values_; begin < end; begin /= 2, end /= 2) {
+    if ((begin & 1u) != 0) {
+      result = Combine(result, nodes_[begin++]);
+    }
+    if ((end & 1u) != 0) {
+      result = Combine(result, nodes_[--end]);
+    }
+  }
+  return result;
+}
+
+void SegmentTree::Query(uint64_t begin, uint64_t end, Integer *result) const {
+  NOISEPAGE_ASSERT(kind_ == AggregateKind::Count || (kind_ != AggregateKind::Avg && !is_real_),
+                   "Aggregate does not produce an integer");
+  const Node node = QueryRange(begin, end);
+  if (kind_ == AggregateKind::Count) {
+    *result = Integer(static_cast<int64_t>(node.count_));
+  } else if (node.count_ == 0) {
+    *result = Integer::Null();
+  } else {
+    *result = Integer(node.int_val_);
+  }
+}
+
+void SegmentTree::Query(uint64_t begin, uint64_t end, Real *result) const {
+  NOISEPAGE_ASSERT(kind_ == AggregateKind::Avg || (kind_ != AggregateKind::Count && is_real_),
+                   "Aggregate does not produce a real");
+  const Node node = QueryRange(begin, end);
+  if (node.count_ == 0) {
+    *result = Real::Null();
+    return;
+  }
+  const double val = is_real_ ? node.real_val_ : static_cast<double>(node.int_val_);
+  *result = Real(kind_ == AggregateKind::Avg ? val / static_cast<double>(node.count_) : val);
+}
+
+}  // namespace noisepage::execution::sql
@@ -12,6 +12,7 @@
 #include "execution/exec/execution_context.h"
 #include "execution/sql/thread_state_container.h"
 #include "execution/util/stage_timer.h"
+#include "execution/util/timer.h"
 #include "ips4o/ips4o.hpp"
 #include "loggers/execution_logger.h"
 #include "self_driving/modeling/operating_unit.h"
@@ -431,6 +432,53 @@ void Sorter::SortTopKParallel(ThreadStateContainer *thread_state_container, uint
   }
 }
 
+void Sorter::ScanPartitionsParallel(void *query_state, ThreadStateContainer *thread_states,
+                                    const Sorter::PartitionEqualityFn same_partition_fn,
+                                    const Sorter::ScanPartitionsFn scan_fn) const {
+  NOISEPAGE_ASSERT(IsSorted(), "Sorter must be sorted before scanning its partitions");
+
+  const uint64_t num_tuples = GetTupleCount();
+  if (num_tuples == 0) {
+    return;
+  }
+
+  // Split the tuples into ranges of roughly equal size. A range is extended past its nominal end until the next
+  // partition starts, so no partition is split across ranges. Partitions are contiguous in the sorted order, so the
+  // first tuple outside the current partition is found with a binary search.
+  const size_t num_threads = tbb::task_scheduler_init::default_num_threads();
+  const uint64_t range_size = std::max(uint64_t{1}, num_tuples / (num_threads * PARTITION_RANGES_PER_THREAD));
+  std::vector<std::pair<uint64_t, uint64_t>> ranges;
+  for (uint64_t begin = 0; begin < num_tuples;) {
+    uint64_t end = std::min(num_tuples, begin + range_size);
+    const byte *last = tuples_[end - 1];
+    end = std::partition_point(tuples_.begin() + end, tuples_.end(),
+                               [&](const byte *tuple) { return same_partition_fn(last, tuple); }) -
+          tuples_.begin();
+    ranges.emplace_back(begin, end);
+    begin = end;
+  }
+
+  util::Timer<std::milli> timer;
+  timer.Start();
+
+  exec_ctx_->SetNumConcurrentEstimate(std::min(num_threads, ranges.size()));
+
+  tbb::parallel_for_each(ranges, [&](const std::pair<uint64_t, uint64_t> &range) {
+    SorterIterator iter(*this, range.first, range.second);
+    SorterIterator peek_iter(*this, range.first, range.second);
+    auto *thread_state = thread_states->AccessCurrentThreadState();
+    scan_fn(query_state, thread_state, &iter, &peek_iter);
+  });
+
+  exec_ctx_->SetNumConcurrentEstimate(0);
+
+  timer.Stop();
+
+  UNUSED_ATTRIBUTE double tps = (num_tuples / timer.GetElapsed()) / 1000.0;
+  EXECUTION_LOG_DEBUG("Scanned {} partition ranges ({} tuples) in {:.2f} ms ({:.2f} mtps)", ranges.size(), num_tuples,
+                      timer.GetElapsed(), tps);
+}
+
 //===----------------------------------------------------------------------===//
 //
 // Sorter Iterator
@@ -439,6 +487,11 @@ void Sorter::SortTopKParallel(ThreadStateContainer *thread_state_container, uint
 
 SorterIterator::SorterIterator(const Sorter &sorter) : iter_(sorter.tuples_.begin()), end_(sorter.tuples_.end()) {}
 
+SorterIterator::SorterIterator(const Sorter &sorter, uint64_t begin, uint64_t end)
+    : iter_(sorter.tuples_.begin() + begin), end_(sorter.tuples_.begin() + end) {
+  NOISEPAGE_ASSERT(begin <= end && end <= sorter.tuples_.size(), "Invalid sorter range");
+}
+
 void SorterIterator::AdvanceBy(uint64_t n) {
   if (n > NumRemaining()) {
     iter_ = end_;
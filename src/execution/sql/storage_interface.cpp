@@ -1,6 +1,7 @@
 #include "execution/sql/storage_interface.h"
 
 #include <algorithm>
+#include <cstring>
 #include <vector>
 
 #include "catalog/catalog_accessor.h"
@@ -98,4 +99,82 @@ bool StorageInterface::IndexInsertWithTuple(storage::TupleSlot table_tuple_slot,
   return curr_index_->Insert(exec_ctx_->GetTxn(), *index_pr_, table_tuple_slot);
 }
 
+bool StorageInterface::IndexInsertBatch() {
+  NOISEPAGE_ASSERT(need_indexes_, "Index PR not allocated!");
+  auto *const batch = CurrentIndexBatch();
+  const auto offset = batch->insert_keys_.size();
+  batch->insert_keys_.resize(offset + batch->pr_words_);
+  std::memcpy(&batch->insert_keys_[offset], index_pr_, index_pr_->Size());
+  batch->insert_slots_.emplace_back(table_redo_->GetTupleSlot());
+  return batch->insert_slots_.size() < INDEX_BATCH_SIZE || FlushIndexBatch(batch);
+}
+
+void StorageInterface::IndexDeleteBatch(storage::TupleSlot table_tuple_slot) {
+  NOISEPAGE_ASSERT(need_indexes_, "Index PR not allocated!");
+  auto *const batch = CurrentIndexBatch();
+  const auto offset = batch->delete_keys_.size();
+  batch->delete_keys_.resize(offset + batch->pr_words_);
+  std::memcpy(&batch->delete_keys_[offset], index_pr_, index_pr_->Size());
+  batch->delete_slots_.emplace_back(table_tuple_slot);
+  // Deletes only register actions with the txn, so they can't fail.
+  if (batch->delete_slots_.size() >= INDEX_BATCH_SIZE) FlushIndexBatch(batch);
+}
+
+bool StorageInterface::IndexFlushBatches() {
+  for (auto &batch : index_batches_) {
+    if (!FlushIndexBatch(&batch)) return false;
+  }
+  return true;
+}
+
+StorageInterface::IndexBatch *StorageInterface::CurrentIndexBatch() {
+  // A statement maintains only a handful of indexes, so a linear search is cheaper than hashing.
+  for (auto &batch : index_batches_) {
+    if (batch.index_ == curr_index_) return &batch;
+  }
+  const uint32_t pr_size = curr_index_->GetProjectedRowInitializer().ProjectedRowSize();
+  auto &batch = index_batches_.emplace_back();
+  batch.index_ = curr_index_;
+  batch.pr_words_ = (pr_size + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+  return &batch;
+}
+
+bool StorageInterface::FlushIndexBatch(IndexBatch *batch) {
+  const auto txn = exec_ctx_->GetTxn();
+  std::vector<const storage::ProjectedRow *> keys;
+
+  if (!batch->delete_slots_.empty()) {
+    keys.reserve(batch->delete_slots_.size());
+    for (uint32_t i = 0; i < batch->delete_slots_.size(); i++) {
+      keys.emplace_back(reinterpret_cast<const storage::ProjectedRow *>(&batch->delete_keys_[i * batch->pr_words_]));
+    }
+    batch->index_->DeleteBatch(txn, keys, batch->delete_slots_);
+    batch->delete_keys_.clear();
+    batch->delete_slots_.clear();
+    keys.clear();
+  }
+
+  bool result = true;
+  if (!batch->insert_slots_.empty()) {
+    keys.reserve(batch->insert_slots_.size());
+    for (uint32_t i = 0; i < batch->insert_slots_.size(); i++) {
+      keys.emplace_back(reinterpret_cast<const storage::ProjectedRow *>(&batch->insert_keys_[i * batch->pr_words_]));
+    }
+    result = batch->index_->InsertBatch(txn, keys, batch->insert_slots_);
+    batch->insert_keys_.clear();
+    batch->insert_slots_.clear();
+  }
+  return result;
+}
+
+bool StorageInterface::IndexBulkLoadStage(storage::TupleSlot table_tuple_slot) {
+  NOISEPAGE_ASSERT(need_indexes_, "Index PR not allocated!");
+  return curr_index_->StageForBulkLoad(exec_ctx_->GetTxn(), *index_pr_, table_tuple_slot);
+}
+
+bool StorageInterface::IndexBulkLoad() {
+  NOISEPAGE_ASSERT(curr_index_ != nullptr, "Index must have been loaded");
+  return curr_index_->BulkLoad(exec_ctx_->GetTxn(), storage::index::BULK_LOAD_FILL_FACTOR);
+}
+
 }  // namespace noisepage::execution::sql
@@ -126,7 +126,8 @@ class ScanTask {
 
 bool TableVectorIterator::ParallelScan(uint32_t table_oid, uint32_t *col_oids, uint32_t num_oids,
                                        void *const query_state, exec::ExecutionContext *exec_ctx,
-                                       const TableVectorIterator::ScanFn scan_fn, const uint32_t min_grain_size) {
+                                       const TableVectorIterator::ScanFn scan_fn, const uint32_t num_threads,
+                                       const uint32_t min_grain_size) {
   // Lookup table
   const auto table = exec_ctx->GetAccessor()->GetTable(catalog::table_oid_t{table_oid});
   if (table == nullptr) {
@@ -138,12 +139,14 @@ bool TableVectorIterator::ParallelScan(uint32_t table_oid, uint32_t *col_oids, u
   timer.Start();
 
   // Execute parallel scan
-  size_t num_threads = std::max(exec_ctx->GetExecutionSettings().GetNumberOfParallelExecutionThreads(), 0);
+  size_t arena_threads = num_threads != 0
+                             ? num_threads
+                             : std::max(exec_ctx->GetExecutionSettings().GetNumberOfParallelExecutionThreads(), 0);
   size_t num_tasks = std::ceil(table->table_.data_table_->GetNumBlocks() * 1.0 / min_grain_size);
-  size_t concurrent = std::min(num_threads, num_tasks);
+  size_t concurrent = std::min(arena_threads, num_tasks);
   exec_ctx->SetNumConcurrentEstimate(concurrent);
 
-  tbb::task_arena limited_arena(num_threads);
+  tbb::task_arena limited_arena(arena_threads);
   tbb::blocked_range<uint32_t> block_range(0, table->table_.data_table_->GetNumBlocks(), min_grain_size);
   const bool is_static_partitioned = exec_ctx->GetExecutionSettings().GetIsStaticPartitionerEnabled();
   limited_arena.execute(
@@ -0,0 +1,146 @@
+#include "common/constants.h"
+#include "common/error/error_code.h"
+#include "common/error/exception.h"
+#include "execution/sql/tuple_id_list.h"
+#include "execution/sql/vector_operations/vector_operations.h"
+#include "execution/util/bit_util.h"
+#include "execution/util/simd.h"
+#include "spdlog/fmt/fmt.h"
+
+namespace noisepage::execution::sql {
+
+namespace {
+
+constexpr uint32_t WORD_SIZE_BITS = 64;
+
+// Compute the bitmap of the elements of the input vector to aggregate, i.e., its active elements that aren't NULL,
+// into the provided words, and return the number of such elements. If every element of the vector is aggregated, no
+// bitmap is computed and the output mask is null.
+uint64_t ComputeAggregateMask(const Vector &input, uint64_t words[], const uint64_t **mask) {
+  const TupleIdList *tid_list = input.GetFilteredTupleIdList();
+  const Vector::NullMask &null_mask = input.GetNullMask();
+
+  if (tid_list == nullptr && !null_mask.Any()) {
+    *mask = nullptr;
+    return input.GetSize();
+  }
+
+  NOISEPAGE_ASSERT(input.GetSize() <= common::Constants::K_DEFAULT_VECTOR_SIZE, "Vector too large");
+  NOISEPAGE_ASSERT(tid_list == nullptr || tid_list->GetCapacity() == input.GetSize(), "TID list size != vector size");
+
+  const uint64_t *null_words = null_mask.GetWords();
+  const uint64_t *tid_words = tid_list == nullptr ? nullptr : tid_list->GetBits().GetWords();
+  const uint32_t num_words = null_mask.GetNumWords();
+  for (uint32_t i = 0; i < num_words; i++) {
+    words[i] = (tid_words == nullptr ? ~uint64_t{0} : tid_words[i]) & ~null_words[i];
+  }
+
+  // Without a TID list, the unused bits of the last word are set.
+  if (const uint64_t extra_bits = input.GetSize() % WORD_SIZE_BITS; extra_bits != 0) {
+    words[num_words - 1] &= (uint64_t{1} << extra_bits) - 1;
+  }
+
+  uint64_t count = 0;
+  for (uint32_t i = 0; i < num_words; i++) {
+    count += util::BitUtil::CountPopulation(words[i]);
+  }
+
+  *mask = words;
+  return count;
+}
+
+template <typename T, typename Op>
+uint64_t TemplatedAggregateOperation(const Vector &input, util::simd::AggregateType<T> *result) {
+  using AggType = util::simd::AggregateType<T>;
+
+  alignas(common::Constants::CACHELINE_SIZE) uint64_t words[common::Constants::K_DEFAULT_VECTOR_SIZE / WORD_SIZE_BITS];
+  const uint64_t *mask;
+  const uint64_t num_elems = ComputeAggregateMask(input, words, &mask);
+  if (num_elems == 0) {
+    return 0;
+  }
+
+  const auto *RESTRICT data = reinterpret_cast<const T *>(input.GetData());
+  const auto size = static_cast<uint32_t>(input.GetSize());
+
+  // The SIMD kernel aggregates full SIMD vectors of elements, and leaves the tail to us.
+  uint32_t pos = 0;
+  AggType agg = util::simd::AggregateVector<T, Op>(data, size, mask, &pos);
+  for (; pos < size; pos++) {
+    if (mask == nullptr || ((mask[pos / WORD_SIZE_BITS] >> (pos % WORD_SIZE_BITS)) & 1U) != 0) {
+      agg = Op::Apply(agg, static_cast<AggType>(data[pos]));
+    }
+  }
+
+  *result = agg;
+  return num_elems;
+}
+
+template <typename Op>
+uint64_t IntegerAggregateOperation(const Vector &input, int64_t *result) {
+  switch (input.GetTypeId()) {
+    case TypeId::TinyInt:
+      return TemplatedAggregateOperation<int8_t, Op>(input, result);
+    case TypeId::SmallInt:
+      return TemplatedAggregateOperation<int16_t, Op>(input, result);
+    case TypeId::Integer:
+      return TemplatedAggregateOperation<int32_t, Op>(input, result);
+    case TypeId::BigInt:
+      return TemplatedAggregateOperation<int64_t, Op>(input, result);
+    default:
+      throw EXECUTION_EXCEPTION(
+          fmt::format("Vector of type {} cannot be aggregated as an integer.", TypeIdToString(input.GetTypeId())),
+          common::ErrorCode::ERRCODE_INTERNAL_ERROR);
+  }
+}
+
+template <typename Op>
+uint64_t RealAggregateOperation(const Vector &input, double *result) {
+  switch (input.GetTypeId()) {
+    case TypeId::Float:
+      return TemplatedAggregateOperation<float, Op>(input, result);
+    case TypeId::Double:
+      return TemplatedAggregateOperation<double, Op>(input, result);
+    default:
+      throw EXECUTION_EXCEPTION(
+          fmt::format("Vector of type {} cannot be aggregated as a real.", TypeIdToString(input.GetTypeId())),
+          common::ErrorCode::ERRCODE_INTERNAL_ERROR);
+  }
+}
+
+}  // namespace
+
+uint64_t VectorOps::Count(const Vector &input) {
+  if (!input.GetNullMask().Any()) {
+    return input.GetCount();
+  }
+  alignas(common::Constants::CACHELINE_SIZE) uint64_t words[common::Constants::K_DEFAULT_VECTOR_SIZE / WORD_SIZE_BITS];
+  const uint64_t *mask;
+  return ComputeAggregateMask(input, words, &mask);
+}
+
+uint64_t VectorOps::Sum(const Vector &input, int64_t *result) {
+  return IntegerAggregateOperation<util::simd::AggregateSum>(input, result);
+}
+
+uint64_t VectorOps::Sum(const Vector &input, double *result) {
+  return RealAggregateOperation<util::simd::AggregateSum>(input, result);
+}
+
+uint64_t VectorOps::Min(const Vector &input, int64_t *result) {
+  return IntegerAggregateOperation<util::simd::AggregateMin>(input, result);
+}
+
+uint64_t VectorOps::Min(const Vector &input, double *result) {
+  return RealAggregateOperation<util::simd::AggregateMin>(input, result);
+}
+
+uint64_t VectorOps::Max(const Vector &input, int64_t *result) {
+  return IntegerAggregateOperation<util::simd::AggregateMax>(input, result);
+}
+
+uint64_t VectorOps::Max(const Vector &input, double *result) {
+  return RealAggregateOperation<util::simd::AggregateMax>(input, result);
+}
+
+}  // namespace noisepage::execution::sql
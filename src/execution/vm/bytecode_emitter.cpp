@@ -292,8 +292,19 @@ void BytecodeEmitter::EmitTableIterInit(Bytecode bytecode, LocalVar iter, LocalV
 }
 
 void BytecodeEmitter::EmitParallelTableScan(LocalVar table_oid, LocalVar col_oids, uint32_t num_oids,
-                                            LocalVar query_state, LocalVar exec_ctx, FunctionId scan_fn) {
-  EmitAll(Bytecode::ParallelScanTable, table_oid, col_oids, num_oids, query_state, exec_ctx, scan_fn);
+                                            LocalVar query_state, LocalVar exec_ctx, FunctionId scan_fn,
+                                            uint32_t num_threads) {
+  EmitAll(Bytecode::ParallelScanTable, table_oid, col_oids, num_oids, query_state, exec_ctx, scan_fn, num_threads);
+}
+
+void BytecodeEmitter::EmitCSVScannerInit(LocalVar scanner, LocalVar exec_ctx, LocalVar file_name,
+                                         uint32_t file_name_len, uint32_t num_cols, uint32_t delimiter, uint32_t quote,
+                                         uint32_t escape) {
+  EmitAll(Bytecode::CSVScannerInit, scanner, exec_ctx, file_name, file_name_len, num_cols, delimiter, quote, escape);
+}
+
+void BytecodeEmitter::EmitParallelCSVScan(LocalVar scanner, LocalVar query_state, FunctionId scan_fn) {
+  EmitAll(Bytecode::ParallelScanCSV, scanner, query_state, scan_fn);
 }
 
 void BytecodeEmitter::EmitRegisterHook(LocalVar exec_ctx, LocalVar hook_idx, FunctionId hook_fn) {
@@ -336,11 +347,26 @@ void BytecodeEmitter::EmitAggHashTableParallelPartitionedScan(LocalVar agg_ht, L
   EmitAll(Bytecode::AggregationHashTableParallelPartitionedScan, agg_ht, context, tls, scan_part_fn);
 }
 
+void BytecodeEmitter::EmitJoinHashTableBuildAndJoin(Bytecode bytecode, LocalVar join_ht, LocalVar probe_join_ht,
+                                                    LocalVar context, LocalVar state, FunctionId join_fn) {
+  EmitAll(bytecode, join_ht, probe_join_ht, context, state, join_fn);
+}
+
+void BytecodeEmitter::EmitJoinHashTableParallelScan(LocalVar join_ht, LocalVar context, LocalVar tls,
+                                                    FunctionId scan_fn) {
+  EmitAll(Bytecode::JoinHashTableParallelScan, join_ht, context, tls, scan_fn);
+}
+
 void BytecodeEmitter::EmitSorterInit(Bytecode bytecode, LocalVar sorter, LocalVar exec_ctx, FunctionId cmp_fn,
                                      LocalVar tuple_size) {
   EmitAll(bytecode, sorter, exec_ctx, cmp_fn, tuple_size);
 }
 
+void BytecodeEmitter::EmitSorterScanPartitionsParallel(LocalVar sorter, LocalVar context, LocalVar tls,
+                                                       FunctionId same_partition_fn, FunctionId scan_fn) {
+  EmitAll(Bytecode::SorterScanPartitionsParallel, sorter, context, tls, same_partition_fn, scan_fn);
+}
+
 #if 0
 void BytecodeEmitter::EmitCSVReaderInit(LocalVar reader, LocalVar file_name, uint32_t file_name_len) {
   EmitAll(Bytecode::CSVReaderInit, reader, file_name, file_name_len);
@@ -274,6 +274,9 @@ void BytecodeGenerator::VisitImplicitCastExpr(ast::ImplicitCastExpr *node) {
         if (!fits_in_int) {
           bytecode = Bytecode::InitInteger64;
         }
+      } else if (arg->GetType()->GetSize() > sizeof(int32_t)) {
+        // A 64-bit variable must not be truncated.
+        bytecode = Bytecode::InitInteger64;
       }
       GetEmitter()->Emit(bytecode, dest, input);
       GetExecutionResult()->SetDestination(dest);
@@ -533,6 +536,9 @@ void BytecodeGenerator::VisitSqlConversionCall(ast::CallExpr *call, ast::Builtin
         if (!fits_in_int) {
           bytecode = Bytecode::InitInteger64;
         }
+      } else if (arg->GetType()->GetSize() > sizeof(int32_t)) {
+        // A 64-bit variable must not be truncated.
+        bytecode = Bytecode::InitInteger64;
       }
       auto input = VisitExpressionForRValue(arg);
       GetEmitter()->Emit(bytecode, dest, input);
@@ -635,6 +641,33 @@ void BytecodeGenerator::VisitSqlStringLikeCall(ast::CallExpr *call) {
   GetExecutionResult()->SetDestination(dest);
 }
 
+void BytecodeGenerator::VisitLikePatternCall(ast::CallExpr *call, ast::Builtin builtin) {
+  switch (builtin) {
+    case ast::Builtin::LikePatternInit: {
+      LocalVar pattern = VisitExpressionForRValue(call->Arguments()[0]);
+      LocalVar str = VisitExpressionForSQLValue(call->Arguments()[1]);
+      GetEmitter()->Emit(Bytecode::LikePatternInit, pattern, str);
+      break;
+    }
+    case ast::Builtin::LikePatternMatch: {
+      LocalVar dest = GetExecutionResult()->GetOrCreateDestination(call->GetType());
+      LocalVar str = VisitExpressionForSQLValue(call->Arguments()[0]);
+      LocalVar pattern = VisitExpressionForRValue(call->Arguments()[1]);
+      GetEmitter()->Emit(Bytecode::LikePatternMatch, dest, str, pattern);
+      GetExecutionResult()->SetDestination(dest);
+      break;
+    }
+    case ast::Builtin::LikePatternFree: {
+      LocalVar pattern = VisitExpressionForRValue(call->Arguments()[0]);
+      GetEmitter()->Emit(Bytecode::LikePatternFree, pattern);
+      break;
+    }
+    default: {
+      UNREACHABLE("Impossible LIKE pattern call");
+    }
+  }
+}
+
 void BytecodeGenerator::VisitBuiltinDateFunctionCall(ast::CallExpr *call, ast::Builtin builtin) {
   auto dest = GetExecutionResult()->GetOrCreateDestination(call->GetType());
   auto input = VisitExpressionForSQLValue(call->Arguments()[0]);
@@ -710,9 +743,66 @@ void BytecodeGenerator::VisitBuiltinTableIterParallelCall(ast::CallExpr *call) {
   LocalVar exec_ctx = VisitExpressionForRValue(call->Arguments()[3]);
   // The fifth argument is the scan function as an identifier.
   const auto scan_fn_name = call->Arguments()[4]->As<ast::IdentifierExpr>()->Name();
+  // The optional sixth argument is the constant number of threads, where 0 uses the execution settings.
+  uint32_t num_threads = 0;
+  if (call->NumArgs() > 5) {
+    num_threads = static_cast<uint32_t>(call->Arguments()[5]->As<ast::LitExpr>()->Int64Val());
+  }
   // Emit the bytecode.
   GetEmitter()->EmitParallelTableScan(table_oid, col_oids, static_cast<uint32_t>(arr_type->GetLength()), query_state,
-                                      exec_ctx, LookupFuncIdByName(scan_fn_name.GetData()));
+                                      exec_ctx, LookupFuncIdByName(scan_fn_name.GetData()), num_threads);
+}
+
+void BytecodeGenerator::VisitBuiltinCSVScanCall(ast::CallExpr *call, ast::Builtin builtin) {
+  // The first argument to all calls is a pointer to the scanner
+  LocalVar scanner = VisitExpressionForRValue(call->Arguments()[0]);
+
+  switch (builtin) {
+    case ast::Builtin::CSVScanInit: {
+      // The second argument should be the execution context
+      LocalVar exec_ctx = VisitExpressionForRValue(call->Arguments()[1]);
+      // The third argument is the file name, which is a string literal
+      auto file_name_lit = call->Arguments()[2]->As<ast::LitExpr>()->StringVal();
+      LocalVar file_name = NewStaticString(call->GetType()->GetContext(), file_name_lit);
+      // The remaining arguments are integer literals
+      const auto int_arg = [&](uint32_t idx) {
+        return static_cast<uint32_t>(call->Arguments()[idx]->As<ast::LitExpr>()->Int64Val());
+      };
+      GetEmitter()->EmitCSVScannerInit(scanner, exec_ctx, file_name, file_name_lit.GetLength(), int_arg(3),
+                                       int_arg(4), int_arg(5), int_arg(6));
+      break;
+    }
+    case ast::Builtin::CSVScanAdvance: {
+      LocalVar cond = GetExecutionResult()->GetOrCreateDestination(call->GetType());
+      GetEmitter()->Emit(Bytecode::CSVScannerNext, cond, scanner);
+      GetExecutionResult()->SetDestination(cond.ValueOf());
+      break;
+    }
+    case ast::Builtin::CSVScanGetVPI: {
+      LocalVar vpi = GetExecutionResult()->GetOrCreateDestination(call->GetType());
+      GetEmitter()->Emit(Bytecode::CSVScannerGetVPI, vpi, scanner);
+      GetExecutionResult()->SetDestination(vpi.ValueOf());
+      break;
+    }
+    case ast::Builtin::CSVScanClose: {
+      GetEmitter()->Emit(Bytecode::CSVScannerFree, scanner);
+      break;
+    }
+    default: {
+      UNREACHABLE("Impossible CSV scan call");
+    }
+  }
+}
+
+void BytecodeGenerator::VisitBuiltinCSVScanParallelCall(ast::CallExpr *call) {
+  // The first argument is the scanner.
+  LocalVar scanner = VisitExpressionForRValue(call->Arguments()[0]);
+  // The second argument is the query state.
+  LocalVar query_state = VisitExpressionForRValue(call->Arguments()[1]);
+  // The third argument is the scan function as an identifier.
+  const auto scan_fn_name = call->Arguments()[2]->As<ast::IdentifierExpr>()->Name();
+  // Emit the bytecode.
+  GetEmitter()->EmitParallelCSVScan(scanner, query_state, LookupFuncIdByName(scan_fn_name.GetData()));
 }
 
 void BytecodeGenerator::VisitBuiltinVPICall(ast::CallExpr *call, ast::Builtin builtin) {
@@ -1005,7 +1095,12 @@ void BytecodeGenerator::VisitBuiltinAggHashTableCall(ast::CallExpr *call, ast::B
       LocalVar agg_ht = VisitExpressionForRValue(call->Arguments()[0]);
       LocalVar exec_ctx = VisitExpressionForRValue(call->Arguments()[1]);
       LocalVar entry_size = VisitExpressionForRValue(call->Arguments()[2]);
-      GetEmitter()->Emit(Bytecode::AggregationHashTableInit, agg_ht, exec_ctx, entry_size);
+      if (call->NumArgs() == 4) {
+        LocalVar initial_size = VisitExpressionForRValue(call->Arguments()[3]);
+        GetEmitter()->Emit(Bytecode::AggregationHashTableInitWithSize, agg_ht, exec_ctx, entry_size, initial_size);
+      } else {
+        GetEmitter()->Emit(Bytecode::AggregationHashTableInit, agg_ht, exec_ctx, entry_size);
+      }
       break;
     }
     case ast::Builtin::AggHashTableGetTupleCount: {
@@ -1397,6 +1492,52 @@ void BytecodeGenerator::VisitBuiltinAggregatorCall(ast::CallExpr *call, ast::Bui
       GetEmitter()->Emit(bytecode, agg, input);
       break;
     }
+    case ast::Builtin::AggAdvanceVector: {
+      const auto &args = call->Arguments();
+      const auto agg_kind = args[0]->GetType()->GetPointeeType()->As<ast::BuiltinType>()->GetKind();
+      LocalVar agg = VisitExpressionForRValue(args[0]);
+      LocalVar vpi = VisitExpressionForRValue(args[1]);
+      if (call->NumArgs() == 2) {
+        // Count the selected tuples of the VPI.
+        const auto bytecode = agg_kind == ast::BuiltinType::CountStarAggregate
+                                  ? Bytecode::CountStarAggregateAdvanceVector
+                                  : Bytecode::CountAggregateAdvanceVectorRows;
+        GetEmitter()->Emit(bytecode, agg, vpi);
+        break;
+      }
+      LocalVar col_idx = VisitExpressionForRValue(args[2]);
+      Bytecode bytecode;
+      switch (agg_kind) {
+        case ast::BuiltinType::CountAggregate:
+          bytecode = Bytecode::CountAggregateAdvanceVector;
+          break;
+        case ast::BuiltinType::IntegerSumAggregate:
+          bytecode = Bytecode::IntegerSumAggregateAdvanceVector;
+          break;
+        case ast::BuiltinType::IntegerMaxAggregate:
+          bytecode = Bytecode::IntegerMaxAggregateAdvanceVector;
+          break;
+        case ast::BuiltinType::IntegerMinAggregate:
+          bytecode = Bytecode::IntegerMinAggregateAdvanceVector;
+          break;
+        case ast::BuiltinType::RealSumAggregate:
+          bytecode = Bytecode::RealSumAggregateAdvanceVector;
+          break;
+        case ast::BuiltinType::RealMaxAggregate:
+          bytecode = Bytecode::RealMaxAggregateAdvanceVector;
+          break;
+        case ast::BuiltinType::RealMinAggregate:
+          bytecode = Bytecode::RealMinAggregateAdvanceVector;
+          break;
+        case ast::BuiltinType::AvgAggregate:
+          bytecode = Bytecode::AvgAggregateAdvanceVector;
+          break;
+        default:
+          UNREACHABLE("Impossible vectorized aggregate type");
+      }
+      GetEmitter()->Emit(bytecode, agg, vpi, col_idx);
+      break;
+    }
     case ast::Builtin::AggMerge: {
       const auto &args = call->Arguments();
       const auto agg_kind = args[0]->GetType()->GetPointeeType()->As<ast::BuiltinType>()->GetKind();
@@ -1463,12 +1604,38 @@ void BytecodeGenerator::VisitBuiltinJoinHashTableCall(ast::CallExpr *call, ast::
       GetEmitter()->Emit(Bytecode::JoinHashTableBuildParallel, join_hash_table, tls, jht_offset);
       break;
     }
+    case ast::Builtin::JoinHashTableMoveTuplesParallel: {
+      LocalVar tls = VisitExpressionForRValue(call->Arguments()[1]);
+      LocalVar jht_offset = VisitExpressionForRValue(call->Arguments()[2]);
+      GetEmitter()->Emit(Bytecode::JoinHashTableMoveTuplesParallel, join_hash_table, tls, jht_offset);
+      break;
+    }
+    case ast::Builtin::JoinHashTableBuildAndJoin:
+    case ast::Builtin::JoinHashTableBuildAndJoinParallel: {
+      LocalVar probe_join_hash_table = VisitExpressionForRValue(call->Arguments()[1]);
+      LocalVar query_state = VisitExpressionForRValue(call->Arguments()[2]);
+      LocalVar state = VisitExpressionForRValue(call->Arguments()[3]);
+      auto join_fn = LookupFuncIdByName(call->Arguments()[4]->As<ast::IdentifierExpr>()->Name().GetData());
+      const Bytecode bytecode = builtin == ast::Builtin::JoinHashTableBuildAndJoin
+                                    ? Bytecode::JoinHashTableBuildAndJoin
+                                    : Bytecode::JoinHashTableBuildAndJoinParallel;
+      GetEmitter()->EmitJoinHashTableBuildAndJoin(bytecode, join_hash_table, probe_join_hash_table, query_state, state,
+                                                  join_fn);
+      break;
+    }
     case ast::Builtin::JoinHashTableLookup: {
       LocalVar ht_entry_iter = VisitExpressionForRValue(call->Arguments()[1]);
       LocalVar hash = VisitExpressionForRValue(call->Arguments()[2]);
       GetEmitter()->Emit(Bytecode::JoinHashTableLookup, join_hash_table, ht_entry_iter, hash);
       break;
     }
+    case ast::Builtin::JoinHashTableParallelScan: {
+      LocalVar query_state = VisitExpressionForRValue(call->Arguments()[1]);
+      LocalVar tls = VisitExpressionForRValue(call->Arguments()[2]);
+      auto scan_fn = LookupFuncIdByName(call->Arguments()[3]->As<ast::IdentifierExpr>()->Name().GetData());
+      GetEmitter()->EmitJoinHashTableParallelScan(join_hash_table, query_state, tls, scan_fn);
+      break;
+    }
     case ast::Builtin::JoinHashTableFree: {
       GetEmitter()->Emit(Bytecode::JoinHashTableFree, join_hash_table);
       break;
@@ -1600,6 +1767,15 @@ void BytecodeGenerator::VisitBuiltinSorterCall(ast::CallExpr *call, ast::Builtin
       GetEmitter()->Emit(Bytecode::SorterSortTopKParallel, sorter, tls, sorter_offset, top_k);
       break;
     }
+    case ast::Builtin::SorterScanPartitionsParallel: {
+      LocalVar sorter = VisitExpressionForRValue(call->Arguments()[0]);
+      LocalVar query_state = VisitExpressionForRValue(call->Arguments()[1]);
+      LocalVar tls = VisitExpressionForRValue(call->Arguments()[2]);
+      auto same_partition_fn = LookupFuncIdByName(call->Arguments()[3]->As<ast::IdentifierExpr>()->Name().GetData());
+      auto scan_fn = LookupFuncIdByName(call->Arguments()[4]->As<ast::IdentifierExpr>()->Name().GetData());
+      GetEmitter()->EmitSorterScanPartitionsParallel(sorter, query_state, tls, same_partition_fn, scan_fn);
+      break;
+    }
     case ast::Builtin::SorterFree: {
       LocalVar sorter = VisitExpressionForRValue(call->Arguments()[0]);
       GetEmitter()->Emit(Bytecode::SorterFree, sorter);
@@ -1652,6 +1828,53 @@ void BytecodeGenerator::VisitBuiltinSorterIterCall(ast::CallExpr *call, ast::Bui
   }
 }
 
+void BytecodeGenerator::VisitBuiltinSegmentTreeCall(ast::CallExpr *call, ast::Builtin builtin) {
+  // The first argument to all calls is the segment tree instance
+  const LocalVar tree = VisitExpressionForRValue(call->Arguments()[0]);
+
+  switch (builtin) {
+    case ast::Builtin::SegmentTreeInit: {
+      LocalVar exec_ctx = VisitExpressionForRValue(call->Arguments()[1]);
+      LocalVar kind = VisitExpressionForRValue(call->Arguments()[2]);
+      GetEmitter()->Emit(Bytecode::SegmentTreeInit, tree, exec_ctx, kind);
+      break;
+    }
+    case ast::Builtin::SegmentTreeAppend: {
+      const auto *val_type = call->Arguments()[1]->GetType();
+      LocalVar val = VisitExpressionForSQLValue(call->Arguments()[1]);
+      const auto bytecode = val_type->IsSpecificBuiltin(ast::BuiltinType::Real) ? Bytecode::SegmentTreeAppendReal
+                                                                                 : Bytecode::SegmentTreeAppendInteger;
+      GetEmitter()->Emit(bytecode, tree, val);
+      break;
+    }
+    case ast::Builtin::SegmentTreeBuild: {
+      GetEmitter()->Emit(Bytecode::SegmentTreeBuild, tree);
+      break;
+    }
+    case ast::Builtin::SegmentTreeQueryInt:
+    case ast::Builtin::SegmentTreeQueryReal: {
+      LocalVar result = GetExecutionResult()->GetOrCreateDestination(call->GetType());
+      LocalVar begin = VisitExpressionForRValue(call->Arguments()[1]);
+      LocalVar end = VisitExpressionForRValue(call->Arguments()[2]);
+      const auto bytecode = builtin == ast::Builtin::SegmentTreeQueryInt ? Bytecode::SegmentTreeQueryInteger
+                                                                          : Bytecode::SegmentTreeQueryReal;
+      GetEmitter()->Emit(bytecode, result, tree, begin, end);
+      break;
+    }
+    case ast::Builtin::SegmentTreeReset: {
+      GetEmitter()->Emit(Bytecode::SegmentTreeReset, tree);
+      break;
+    }
+    case ast::Builtin::SegmentTreeFree: {
+      GetEmitter()->Emit(Bytecode::SegmentTreeFree, tree);
+      break;
+    }
+    default: {
+      UNREACHABLE("Impossible segment tree call");
+    }
+  }
+}
+
 void BytecodeGenerator::VisitResultBufferCall(ast::CallExpr *call, ast::Builtin builtin) {
   LocalVar input = VisitExpressionForRValue(call->Arguments()[0]);
   switch (builtin) {
@@ -2410,6 +2633,36 @@ void BytecodeGenerator::VisitBuiltinStorageInterfaceCall(ast::CallExpr *call, as
       GetExecutionResult()->SetDestination(cond.ValueOf());
       break;
     }
+    case ast::Builtin::IndexInsertBatch: {
+      LocalVar cond = GetExecutionResult()->GetOrCreateDestination(ast::BuiltinType::Get(ctx, ast::BuiltinType::Bool));
+      GetEmitter()->Emit(Bytecode::StorageInterfaceIndexInsertBatch, cond, storage_interface);
+      GetExecutionResult()->SetDestination(cond.ValueOf());
+      break;
+    }
+    case ast::Builtin::IndexDeleteBatch: {
+      LocalVar tuple_slot = VisitExpressionForRValue(call->Arguments()[1]);
+      GetEmitter()->Emit(Bytecode::StorageInterfaceIndexDeleteBatch, storage_interface, tuple_slot);
+      break;
+    }
+    case ast::Builtin::IndexFlushBatches: {
+      LocalVar cond = GetExecutionResult()->GetOrCreateDestination(ast::BuiltinType::Get(ctx, ast::BuiltinType::Bool));
+      GetEmitter()->Emit(Bytecode::StorageInterfaceIndexFlushBatches, cond, storage_interface);
+      GetExecutionResult()->SetDestination(cond.ValueOf());
+      break;
+    }
+    case ast::Builtin::IndexBulkLoadStage: {
+      LocalVar cond = GetExecutionResult()->GetOrCreateDestination(ast::BuiltinType::Get(ctx, ast::BuiltinType::Bool));
+      LocalVar tuple_slot = VisitExpressionForRValue(call->Arguments()[1]);
+      GetEmitter()->Emit(Bytecode::StorageInterfaceIndexBulkLoadStage, cond, storage_interface, tuple_slot);
+      GetExecutionResult()->SetDestination(cond.ValueOf());
+      break;
+    }
+    case ast::Builtin::IndexBulkLoad: {
+      LocalVar cond = GetExecutionResult()->GetOrCreateDestination(ast::BuiltinType::Get(ctx, ast::BuiltinType::Bool));
+      GetEmitter()->Emit(Bytecode::StorageInterfaceIndexBulkLoad, cond, storage_interface);
+      GetExecutionResult()->SetDestination(cond.ValueOf());
+      break;
+    }
     case ast::Builtin::IndexDelete: {
       LocalVar tuple_slot = VisitExpressionForRValue(call->Arguments()[1]);
       GetEmitter()->Emit(Bytecode::StorageInterfaceIndexDelete, storage_interface, tuple_slot);
@@ -2682,6 +2935,12 @@ void BytecodeGenerator::VisitBuiltinCallExpr(ast::CallExpr *call) {
       VisitSqlStringLikeCall(call);
       break;
     }
+    case ast::Builtin::LikePatternInit:
+    case ast::Builtin::LikePatternMatch:
+    case ast::Builtin::LikePatternFree: {
+      VisitLikePatternCall(call, builtin);
+      break;
+    }
     case ast::Builtin::DatePart: {
       VisitBuiltinDateFunctionCall(call, builtin);
       break;
@@ -2757,6 +3016,17 @@ void BytecodeGenerator::VisitBuiltinCallExpr(ast::CallExpr *call) {
       VisitBuiltinTableIterParallelCall(call);
       break;
     }
+    case ast::Builtin::CSVScanInit:
+    case ast::Builtin::CSVScanAdvance:
+    case ast::Builtin::CSVScanGetVPI:
+    case ast::Builtin::CSVScanClose: {
+      VisitBuiltinCSVScanCall(call, builtin);
+      break;
+    }
+    case ast::Builtin::CSVScanParallel: {
+      VisitBuiltinCSVScanParallelCall(call);
+      break;
+    }
     case ast::Builtin::VPIInit:
     case ast::Builtin::VPIFree:
     case ast::Builtin::VPIIsFiltered:
@@ -2869,6 +3139,7 @@ void BytecodeGenerator::VisitBuiltinCallExpr(ast::CallExpr *call) {
     }
     case ast::Builtin::AggInit:
     case ast::Builtin::AggAdvance:
+    case ast::Builtin::AggAdvanceVector:
     case ast::Builtin::AggMerge:
     case ast::Builtin::AggReset:
     case ast::Builtin::AggResult:
@@ -2881,7 +3152,11 @@ void BytecodeGenerator::VisitBuiltinCallExpr(ast::CallExpr *call) {
     case ast::Builtin::JoinHashTableGetTupleCount:
     case ast::Builtin::JoinHashTableBuild:
     case ast::Builtin::JoinHashTableBuildParallel:
+    case ast::Builtin::JoinHashTableMoveTuplesParallel:
+    case ast::Builtin::JoinHashTableBuildAndJoin:
+    case ast::Builtin::JoinHashTableBuildAndJoinParallel:
     case ast::Builtin::JoinHashTableLookup:
+    case ast::Builtin::JoinHashTableParallelScan:
     case ast::Builtin::JoinHashTableFree: {
       VisitBuiltinJoinHashTableCall(call, builtin);
       break;
@@ -2907,6 +3182,7 @@ void BytecodeGenerator::VisitBuiltinCallExpr(ast::CallExpr *call) {
     case ast::Builtin::SorterSort:
     case ast::Builtin::SorterSortParallel:
     case ast::Builtin::SorterSortTopKParallel:
+    case ast::Builtin::SorterScanPartitionsParallel:
     case ast::Builtin::SorterFree: {
       VisitBuiltinSorterCall(call, builtin);
       break;
@@ -2920,6 +3196,16 @@ void BytecodeGenerator::VisitBuiltinCallExpr(ast::CallExpr *call) {
       VisitBuiltinSorterIterCall(call, builtin);
       break;
     }
+    case ast::Builtin::SegmentTreeInit:
+    case ast::Builtin::SegmentTreeAppend:
+    case ast::Builtin::SegmentTreeBuild:
+    case ast::Builtin::SegmentTreeQueryInt:
+    case ast::Builtin::SegmentTreeQueryReal:
+    case ast::Builtin::SegmentTreeReset:
+    case ast::Builtin::SegmentTreeFree: {
+      VisitBuiltinSegmentTreeCall(call, builtin);
+      break;
+    }
     case ast::Builtin::ResultBufferNew:
     case ast::Builtin::ResultBufferAllocOutRow:
     case ast::Builtin::ResultBufferFinalize:
@@ -2940,7 +3226,11 @@ void BytecodeGenerator::VisitBuiltinCallExpr(ast::CallExpr *call) {
     case ast::Builtin::IndexIteratorInit:
     case ast::Builtin::IndexIteratorGetSize:
     case ast::Builtin::IndexIteratorScanKey:
+    case ast::Builtin::IndexIteratorAddBatchKey:
+    case ast::Builtin::IndexIteratorScanKeyBatch:
+    case ast::Builtin::IndexIteratorSelectBatchResult:
     case ast::Builtin::IndexIteratorScanAscending:
+    case ast::Builtin::IndexIteratorScanAscendingKeys:
     case ast::Builtin::IndexIteratorScanDescending:
     case ast::Builtin::IndexIteratorScanLimitDescending:
     case ast::Builtin::IndexIteratorAdvance:
@@ -2949,6 +3239,7 @@ void BytecodeGenerator::VisitBuiltinCallExpr(ast::CallExpr *call) {
     case ast::Builtin::IndexIteratorGetLoPR:
     case ast::Builtin::IndexIteratorGetHiPR:
     case ast::Builtin::IndexIteratorGetTablePR:
+    case ast::Builtin::IndexIteratorGetKeyPR:
     case ast::Builtin::IndexIteratorGetSlot: {
       VisitBuiltinIndexIteratorCall(call, builtin);
       break;
@@ -3046,6 +3337,11 @@ void BytecodeGenerator::VisitBuiltinCallExpr(ast::CallExpr *call) {
     case ast::Builtin::IndexInsert:
     case ast::Builtin::IndexInsertUnique:
     case ast::Builtin::IndexInsertWithSlot:
+    case ast::Builtin::IndexInsertBatch:
+    case ast::Builtin::IndexDeleteBatch:
+    case ast::Builtin::IndexFlushBatches:
+    case ast::Builtin::IndexBulkLoadStage:
+    case ast::Builtin::IndexBulkLoad:
     case ast::Builtin::IndexDelete:
     case ast::Builtin::StorageInterfaceFree: {
       VisitBuiltinStorageInterfaceCall(call, builtin);
@@ -3182,12 +3478,31 @@ void BytecodeGenerator::VisitBuiltinIndexIteratorCall(ast::CallExpr *call, ast::
       GetEmitter()->Emit(Bytecode::IndexIteratorScanKey, iterator);
       break;
     }
+    case ast::Builtin::IndexIteratorAddBatchKey: {
+      GetEmitter()->Emit(Bytecode::IndexIteratorAddBatchKey, iterator);
+      break;
+    }
+    case ast::Builtin::IndexIteratorScanKeyBatch: {
+      GetEmitter()->Emit(Bytecode::IndexIteratorScanKeyBatch, iterator);
+      break;
+    }
+    case ast::Builtin::IndexIteratorSelectBatchResult: {
+      auto key_idx = VisitExpressionForRValue(call->Arguments()[1]);
+      GetEmitter()->Emit(Bytecode::IndexIteratorSelectBatchResult, iterator, key_idx);
+      break;
+    }
     case ast::Builtin::IndexIteratorScanAscending: {
       auto asc_type = VisitExpressionForRValue(call->Arguments()[1]);
       auto limit = VisitExpressionForRValue(call->Arguments()[2]);
       GetEmitter()->Emit(Bytecode::IndexIteratorScanAscending, iterator, asc_type, limit);
       break;
     }
+    case ast::Builtin::IndexIteratorScanAscendingKeys: {
+      auto asc_type = VisitExpressionForRValue(call->Arguments()[1]);
+      auto limit = VisitExpressionForRValue(call->Arguments()[2]);
+      GetEmitter()->Emit(Bytecode::IndexIteratorScanAscendingKeys, iterator, asc_type, limit);
+      break;
+    }
     case ast::Builtin::IndexIteratorScanDescending: {
       GetEmitter()->Emit(Bytecode::IndexIteratorScanDescending, iterator);
       break;
@@ -3227,6 +3542,11 @@ void BytecodeGenerator::VisitBuiltinIndexIteratorCall(ast::CallExpr *call, ast::
       GetEmitter()->Emit(Bytecode::IndexIteratorGetTablePR, pr, iterator);
       break;
     }
+    case ast::Builtin::IndexIteratorGetKeyPR: {
+      LocalVar pr = GetExecutionResult()->GetOrCreateDestination(call->GetType());
+      GetEmitter()->Emit(Bytecode::IndexIteratorGetKeyPR, pr, iterator);
+      break;
+    }
     case ast::Builtin::IndexIteratorGetSlot: {
       LocalVar pr = GetExecutionResult()->GetOrCreateDestination(call->GetType());
       GetEmitter()->Emit(Bytecode::IndexIteratorGetSlot, pr, iterator);
@@ -30,6 +30,24 @@ void OpTableVectorIteratorFree(noisepage::execution::sql::TableVectorIterator *i
   iter->~TableVectorIterator();
 }
 
+// ---------------------------------------------------------
+// CSV Scanner
+// ---------------------------------------------------------
+
+void OpCSVScannerInit(noisepage::execution::sql::CSVScanner *scanner,
+                      noisepage::execution::exec::ExecutionContext *exec_ctx, const uint8_t *file_name, uint32_t len,
+                      uint32_t num_cols, uint32_t delimiter, uint32_t quote, uint32_t escape) {
+  NOISEPAGE_ASSERT(scanner != nullptr, "Null scanner to initialize");
+  const std::string_view name(reinterpret_cast<const char *>(file_name), len);
+  new (scanner) noisepage::execution::sql::CSVScanner(exec_ctx, name, num_cols, static_cast<char>(delimiter),
+                                                      static_cast<char>(quote), static_cast<char>(escape));
+}
+
+void OpCSVScannerFree(noisepage::execution::sql::CSVScanner *scanner) {
+  NOISEPAGE_ASSERT(scanner != nullptr, "NULL scanner given to close");
+  scanner->~CSVScanner();
+}
+
 void OpVPIInit(noisepage::execution::sql::VectorProjectionIterator *vpi,
                noisepage::execution::sql::VectorProjection *vp) {
   new (vpi) noisepage::execution::sql::VectorProjectionIterator(vp);
@@ -87,6 +105,12 @@ void OpJoinHashTableBuildParallel(noisepage::execution::sql::JoinHashTable *join
   join_hash_table->MergeParallel(thread_state_container, jht_offset);
 }
 
+void OpJoinHashTableMoveTuplesParallel(noisepage::execution::sql::JoinHashTable *join_hash_table,
+                                       noisepage::execution::sql::ThreadStateContainer *thread_state_container,
+                                       uint32_t jht_offset) {
+  join_hash_table->MoveTuplesParallel(thread_state_container, jht_offset);
+}
+
 void OpJoinHashTableFree(noisepage::execution::sql::JoinHashTable *join_hash_table) {
   join_hash_table->~JoinHashTable();
 }
@@ -111,6 +135,13 @@ void OpAggregationHashTableInit(noisepage::execution::sql::AggregationHashTable
       noisepage::execution::sql::AggregationHashTable(exec_ctx->GetExecutionSettings(), exec_ctx, payload_size);
 }
 
+void OpAggregationHashTableInitWithSize(noisepage::execution::sql::AggregationHashTable *const agg_hash_table,
+                                        noisepage::execution::exec::ExecutionContext *exec_ctx,
+                                        const uint32_t payload_size, const uint32_t initial_size) {
+  new (agg_hash_table) noisepage::execution::sql::AggregationHashTable(exec_ctx->GetExecutionSettings(), exec_ctx,
+                                                                       payload_size, initial_size);
+}
+
 void OpAggregationHashTableGetTupleCount(uint32_t *result,
                                          noisepage::execution::sql::AggregationHashTable *const agg_hash_table) {
   *result = agg_hash_table->GetTupleCount();
@@ -173,6 +204,13 @@ void OpSorterSortTopKParallel(noisepage::execution::sql::Sorter *sorter,
   sorter->SortTopKParallel(thread_state_container, sorter_offset, top_k);
 }
 
+void OpSorterScanPartitionsParallel(const noisepage::execution::sql::Sorter *sorter, void *query_state,
+                                    noisepage::execution::sql::ThreadStateContainer *thread_state_container,
+                                    noisepage::execution::sql::Sorter::PartitionEqualityFn same_partition_fn,
+                                    noisepage::execution::sql::Sorter::ScanPartitionsFn scan_fn) {
+  sorter->ScanPartitionsParallel(query_state, thread_state_container, same_partition_fn, scan_fn);
+}
+
 void OpSorterFree(noisepage::execution::sql::Sorter *sorter) { sorter->~Sorter(); }
 
 void OpSorterIteratorInit(noisepage::execution::sql::SorterIterator *iter, noisepage::execution::sql::Sorter *sorter) {
@@ -181,6 +219,30 @@ void OpSorterIteratorInit(noisepage::execution::sql::SorterIterator *iter, noise
 
 void OpSorterIteratorFree(noisepage::execution::sql::SorterIterator *iter) { iter->~SorterIterator(); }
 
+// ---------------------------------------------------------
+// LIKE patterns
+// ---------------------------------------------------------
+
+void OpLikePatternInit(noisepage::execution::sql::LikePattern *pattern,
+                       const noisepage::execution::sql::StringVal *str) {
+  NOISEPAGE_ASSERT(!str->is_null_, "Only non-NULL patterns are analyzed ahead of time");
+  new (pattern) noisepage::execution::sql::LikePattern(str->val_);
+}
+
+void OpLikePatternFree(noisepage::execution::sql::LikePattern *pattern) { pattern->~LikePattern(); }
+
+// ---------------------------------------------------------
+// Segment Tree
+// ---------------------------------------------------------
+
+void OpSegmentTreeInit(noisepage::execution::sql::SegmentTree *tree,
+                       noisepage::execution::exec::ExecutionContext *exec_ctx, uint32_t kind) {
+  new (tree) noisepage::execution::sql::SegmentTree(
+      exec_ctx, static_cast<noisepage::execution::sql::SegmentTree::AggregateKind>(kind));
+}
+
+void OpSegmentTreeFree(noisepage::execution::sql::SegmentTree *tree) { tree->~SegmentTree(); }
+
 // ---------------------------------------------------------
 // CSV Reader
 // ---------------------------------------------------------
@@ -253,6 +315,23 @@ void OpStorageInterfaceIndexInsertWithSlot(bool *result, noisepage::execution::s
                                            noisepage::storage::TupleSlot *tuple_slot, bool unique) {
   *result = storage_interface->IndexInsertWithTuple(*tuple_slot, unique);
 }
+void OpStorageInterfaceIndexInsertBatch(bool *result, noisepage::execution::sql::StorageInterface *storage_interface) {
+  *result = storage_interface->IndexInsertBatch();
+}
+void OpStorageInterfaceIndexDeleteBatch(noisepage::execution::sql::StorageInterface *storage_interface,
+                                        noisepage::storage::TupleSlot *tuple_slot) {
+  storage_interface->IndexDeleteBatch(*tuple_slot);
+}
+void OpStorageInterfaceIndexFlushBatches(bool *result, noisepage::execution::sql::StorageInterface *storage_interface) {
+  *result = storage_interface->IndexFlushBatches();
+}
+void OpStorageInterfaceIndexBulkLoadStage(bool *result, noisepage::execution::sql::StorageInterface *storage_interface,
+                                          noisepage::storage::TupleSlot *tuple_slot) {
+  *result = storage_interface->IndexBulkLoadStage(*tuple_slot);
+}
+void OpStorageInterfaceIndexBulkLoad(bool *result, noisepage::execution::sql::StorageInterface *storage_interface) {
+  *result = storage_interface->IndexBulkLoad();
+}
 void OpStorageInterfaceIndexDelete(noisepage::execution::sql::StorageInterface *storage_interface,
                                    noisepage::storage::TupleSlot *tuple_slot) {
   storage_interface->IndexDelete(*tuple_slot);
@@ -685,9 +685,57 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {  // NOLINT
     auto query_state = frame->LocalAt<void *>(READ_LOCAL_ID());
     auto *exec_context = frame->LocalAt<exec::ExecutionContext *>(READ_LOCAL_ID());
     auto scan_fn_id = READ_FUNC_ID();
+    auto num_threads = READ_UIMM4();
 
     auto scan_fn = reinterpret_cast<sql::TableVectorIterator::ScanFn>(module_->GetRawFunctionImpl(scan_fn_id));
-    OpParallelScanTable(table_oid, col_oids, num_oids, query_state, exec_context, scan_fn);
+    OpParallelScanTable(table_oid, col_oids, num_oids, query_state, exec_context, scan_fn, num_threads);
+    DISPATCH_NEXT();
+  }
+
+  // -------------------------------------------------------
+  // CSV Scanner
+  // -------------------------------------------------------
+
+  OP(CSVScannerInit) : {
+    auto *scanner = frame->LocalAt<sql::CSVScanner *>(READ_LOCAL_ID());
+    auto *exec_ctx = frame->LocalAt<exec::ExecutionContext *>(READ_LOCAL_ID());
+    auto *file_name = module_->GetBytecodeModule()->AccessStaticLocalDataRaw(LocalVar::Decode(READ_STATIC_LOCAL_ID()));
+    auto length = READ_UIMM4();
+    auto num_cols = READ_UIMM4();
+    auto delimiter = READ_UIMM4();
+    auto quote = READ_UIMM4();
+    auto escape = READ_UIMM4();
+    OpCSVScannerInit(scanner, exec_ctx, file_name, length, num_cols, delimiter, quote, escape);
+    DISPATCH_NEXT();
+  }
+
+  OP(CSVScannerNext) : {
+    auto *has_more = frame->LocalAt<bool *>(READ_LOCAL_ID());
+    auto *scanner = frame->LocalAt<sql::CSVScanner *>(READ_LOCAL_ID());
+    OpCSVScannerNext(has_more, scanner);
+    DISPATCH_NEXT();
+  }
+
+  OP(CSVScannerGetVPI) : {
+    auto *vpi = frame->LocalAt<sql::VectorProjectionIterator **>(READ_LOCAL_ID());
+    auto *scanner = frame->LocalAt<sql::CSVScanner *>(READ_LOCAL_ID());
+    OpCSVScannerGetVPI(vpi, scanner);
+    DISPATCH_NEXT();
+  }
+
+  OP(CSVScannerFree) : {
+    auto *scanner = frame->LocalAt<sql::CSVScanner *>(READ_LOCAL_ID());
+    OpCSVScannerFree(scanner);
+    DISPATCH_NEXT();
+  }
+
+  OP(ParallelScanCSV) : {
+    auto *scanner = frame->LocalAt<sql::CSVScanner *>(READ_LOCAL_ID());
+    auto query_state = frame->LocalAt<void *>(READ_LOCAL_ID());
+    auto scan_fn_id = READ_FUNC_ID();
+
+    auto scan_fn = reinterpret_cast<sql::CSVScanner::ScanFn>(module_->GetRawFunctionImpl(scan_fn_id));
+    OpParallelScanCSV(scanner, query_state, scan_fn);
     DISPATCH_NEXT();
   }
 
@@ -1214,6 +1262,15 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {  // NOLINT
     DISPATCH_NEXT();
   }
 
+  OP(AggregationHashTableInitWithSize) : {
+    auto *agg_hash_table = frame->LocalAt<sql::AggregationHashTable *>(READ_LOCAL_ID());
+    auto *exec_ctx = frame->LocalAt<exec::ExecutionContext *>(READ_LOCAL_ID());
+    auto payload_size = frame->LocalAt<uint32_t>(READ_LOCAL_ID());
+    auto initial_size = frame->LocalAt<uint32_t>(READ_LOCAL_ID());
+    OpAggregationHashTableInitWithSize(agg_hash_table, exec_ctx, payload_size, initial_size);
+    DISPATCH_NEXT();
+  }
+
   OP(AggregationHashTableGetTupleCount) : {
     auto *result = frame->LocalAt<uint32_t *>(READ_LOCAL_ID());
     auto *agg_hash_table = frame->LocalAt<sql::AggregationHashTable *>(READ_LOCAL_ID());
@@ -1499,6 +1556,40 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {  // NOLINT
 
 #undef GEN_AGGREGATE
 
+#define GEN_AGGREGATE_ADVANCE_VECTOR(AGG_TYPE)                                      \
+  OP(AGG_TYPE##AdvanceVector) : {                                                   \
+    auto *agg = frame->LocalAt<sql::AGG_TYPE *>(READ_LOCAL_ID());                   \
+    auto *vpi = frame->LocalAt<sql::VectorProjectionIterator *>(READ_LOCAL_ID());   \
+    auto col_idx = frame->LocalAt<uint32_t>(READ_LOCAL_ID());                       \
+    Op##AGG_TYPE##AdvanceVector(agg, vpi, col_idx);                                 \
+    DISPATCH_NEXT();                                                                \
+  }
+
+  GEN_AGGREGATE_ADVANCE_VECTOR(CountAggregate);
+  GEN_AGGREGATE_ADVANCE_VECTOR(IntegerSumAggregate);
+  GEN_AGGREGATE_ADVANCE_VECTOR(IntegerMaxAggregate);
+  GEN_AGGREGATE_ADVANCE_VECTOR(IntegerMinAggregate);
+  GEN_AGGREGATE_ADVANCE_VECTOR(RealSumAggregate);
+  GEN_AGGREGATE_ADVANCE_VECTOR(RealMaxAggregate);
+  GEN_AGGREGATE_ADVANCE_VECTOR(RealMinAggregate);
+  GEN_AGGREGATE_ADVANCE_VECTOR(AvgAggregate);
+
+#undef GEN_AGGREGATE_ADVANCE_VECTOR
+
+  OP(CountAggregateAdvanceVectorRows) : {
+    auto *agg = frame->LocalAt<sql::CountAggregate *>(READ_LOCAL_ID());
+    auto *vpi = frame->LocalAt<sql::VectorProjectionIterator *>(READ_LOCAL_ID());
+    OpCountAggregateAdvanceVectorRows(agg, vpi);
+    DISPATCH_NEXT();
+  }
+
+  OP(CountStarAggregateAdvanceVector) : {
+    auto *agg = frame->LocalAt<sql::CountStarAggregate *>(READ_LOCAL_ID());
+    auto *vpi = frame->LocalAt<sql::VectorProjectionIterator *>(READ_LOCAL_ID());
+    OpCountStarAggregateAdvanceVector(agg, vpi);
+    DISPATCH_NEXT();
+  }
+
   OP(AvgAggregateInit) : {
     auto *agg = frame->LocalAt<sql::AvgAggregate *>(READ_LOCAL_ID());
     OpAvgAggregateInit(agg);
@@ -1639,6 +1730,39 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {  // NOLINT
     DISPATCH_NEXT();
   }
 
+  OP(JoinHashTableMoveTuplesParallel) : {
+    auto *join_hash_table = frame->LocalAt<sql::JoinHashTable *>(READ_LOCAL_ID());
+    auto *thread_state_container = frame->LocalAt<sql::ThreadStateContainer *>(READ_LOCAL_ID());
+    auto jht_offset = frame->LocalAt<uint32_t>(READ_LOCAL_ID());
+    OpJoinHashTableMoveTuplesParallel(join_hash_table, thread_state_container, jht_offset);
+    DISPATCH_NEXT();
+  }
+
+  OP(JoinHashTableBuildAndJoin) : {
+    auto *join_hash_table = frame->LocalAt<sql::JoinHashTable *>(READ_LOCAL_ID());
+    auto *probe_join_hash_table = frame->LocalAt<sql::JoinHashTable *>(READ_LOCAL_ID());
+    auto *query_state = frame->LocalAt<void *>(READ_LOCAL_ID());
+    auto *pipeline_state = frame->LocalAt<void *>(READ_LOCAL_ID());
+    auto join_fn_id = READ_FUNC_ID();
+
+    auto join_fn = reinterpret_cast<sql::JoinHashTable::JoinFn>(module_->GetRawFunctionImpl(join_fn_id));
+    OpJoinHashTableBuildAndJoin(join_hash_table, probe_join_hash_table, query_state, pipeline_state, join_fn);
+    DISPATCH_NEXT();
+  }
+
+  OP(JoinHashTableBuildAndJoinParallel) : {
+    auto *join_hash_table = frame->LocalAt<sql::JoinHashTable *>(READ_LOCAL_ID());
+    auto *probe_join_hash_table = frame->LocalAt<sql::JoinHashTable *>(READ_LOCAL_ID());
+    auto *query_state = frame->LocalAt<void *>(READ_LOCAL_ID());
+    auto *thread_state_container = frame->LocalAt<sql::ThreadStateContainer *>(READ_LOCAL_ID());
+    auto join_fn_id = READ_FUNC_ID();
+
+    auto join_fn = reinterpret_cast<sql::JoinHashTable::JoinFn>(module_->GetRawFunctionImpl(join_fn_id));
+    OpJoinHashTableBuildAndJoinParallel(join_hash_table, probe_join_hash_table, query_state, thread_state_container,
+                                        join_fn);
+    DISPATCH_NEXT();
+  }
+
   OP(JoinHashTableLookup) : {
     auto *join_hash_table = frame->LocalAt<sql::JoinHashTable *>(READ_LOCAL_ID());
     auto *ht_entry_iter = frame->LocalAt<sql::HashTableEntryIterator *>(READ_LOCAL_ID());
@@ -1647,6 +1771,17 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {  // NOLINT
     DISPATCH_NEXT();
   }
 
+  OP(JoinHashTableParallelScan) : {
+    auto *join_hash_table = frame->LocalAt<sql::JoinHashTable *>(READ_LOCAL_ID());
+    auto *query_state = frame->LocalAt<void *>(READ_LOCAL_ID());
+    auto *thread_state_container = frame->LocalAt<sql::ThreadStateContainer *>(READ_LOCAL_ID());
+    auto scan_fn_id = READ_FUNC_ID();
+
+    auto scan_fn = reinterpret_cast<sql::JoinHashTable::ScanFn>(module_->GetRawFunctionImpl(scan_fn_id));
+    OpJoinHashTableParallelScan(join_hash_table, query_state, thread_state_container, scan_fn);
+    DISPATCH_NEXT();
+  }
+
   OP(JoinHashTableFree) : {
     auto *join_hash_table = frame->LocalAt<sql::JoinHashTable *>(READ_LOCAL_ID());
     OpJoinHashTableFree(join_hash_table);
@@ -1767,6 +1902,20 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {  // NOLINT
     DISPATCH_NEXT();
   }
 
+  OP(SorterScanPartitionsParallel) : {
+    auto *sorter = frame->LocalAt<sql::Sorter *>(READ_LOCAL_ID());
+    auto *query_state = frame->LocalAt<void *>(READ_LOCAL_ID());
+    auto *thread_state_container = frame->LocalAt<sql::ThreadStateContainer *>(READ_LOCAL_ID());
+    auto same_partition_fn_id = READ_FUNC_ID();
+    auto scan_fn_id = READ_FUNC_ID();
+
+    auto same_partition_fn =
+        reinterpret_cast<sql::Sorter::PartitionEqualityFn>(module_->GetRawFunctionImpl(same_partition_fn_id));
+    auto scan_fn = reinterpret_cast<sql::Sorter::ScanPartitionsFn>(module_->GetRawFunctionImpl(scan_fn_id));
+    OpSorterScanPartitionsParallel(sorter, query_state, thread_state_container, same_partition_fn, scan_fn);
+    DISPATCH_NEXT();
+  }
+
   OP(SorterFree) : {
     auto *sorter = frame->LocalAt<sql::Sorter *>(READ_LOCAL_ID());
     OpSorterFree(sorter);
@@ -1813,6 +1962,68 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {  // NOLINT
     DISPATCH_NEXT();
   }
 
+  // -------------------------------------------------------
+  // Segment Tree
+  // -------------------------------------------------------
+
+  OP(SegmentTreeInit) : {
+    auto *tree = frame->LocalAt<sql::SegmentTree *>(READ_LOCAL_ID());
+    auto *exec_ctx = frame->LocalAt<noisepage::execution::exec::ExecutionContext *>(READ_LOCAL_ID());
+    auto kind = frame->LocalAt<uint32_t>(READ_LOCAL_ID());
+    OpSegmentTreeInit(tree, exec_ctx, kind);
+    DISPATCH_NEXT();
+  }
+
+  OP(SegmentTreeAppendInteger) : {
+    auto *tree = frame->LocalAt<sql::SegmentTree *>(READ_LOCAL_ID());
+    auto *val = frame->LocalAt<const sql::Integer *>(READ_LOCAL_ID());
+    OpSegmentTreeAppendInteger(tree, val);
+    DISPATCH_NEXT();
+  }
+
+  OP(SegmentTreeAppendReal) : {
+    auto *tree = frame->LocalAt<sql::SegmentTree *>(READ_LOCAL_ID());
+    auto *val = frame->LocalAt<const sql::Real *>(READ_LOCAL_ID());
+    OpSegmentTreeAppendReal(tree, val);
+    DISPATCH_NEXT();
+  }
+
+  OP(SegmentTreeBuild) : {
+    auto *tree = frame->LocalAt<sql::SegmentTree *>(READ_LOCAL_ID());
+    OpSegmentTreeBuild(tree);
+    DISPATCH_NEXT();
+  }
+
+  OP(SegmentTreeQueryInteger) : {
+    auto *result = frame->LocalAt<sql::Integer *>(READ_LOCAL_ID());
+    auto *tree = frame->LocalAt<const sql::SegmentTree *>(READ_LOCAL_ID());
+    auto begin = frame->LocalAt<uint64_t>(READ_LOCAL_ID());
+    auto end = frame->LocalAt<uint64_t>(READ_LOCAL_ID());
+    OpSegmentTreeQueryInteger(result, tree, begin, end);
+    DISPATCH_NEXT();
+  }
+
+  OP(SegmentTreeQueryReal) : {
+    auto *result = frame->LocalAt<sql::Real *>(READ_LOCAL_ID());
+    auto *tree = frame->LocalAt<const sql::SegmentTree *>(READ_LOCAL_ID());
+    auto begin = frame->LocalAt<uint64_t>(READ_LOCAL_ID());
+    auto end = frame->LocalAt<uint64_t>(READ_LOCAL_ID());
+    OpSegmentTreeQueryReal(result, tree, begin, end);
+    DISPATCH_NEXT();
+  }
+
+  OP(SegmentTreeReset) : {
+    auto *tree = frame->LocalAt<sql::SegmentTree *>(READ_LOCAL_ID());
+    OpSegmentTreeReset(tree);
+    DISPATCH_NEXT();
+  }
+
+  OP(SegmentTreeFree) : {
+    auto *tree = frame->LocalAt<sql::SegmentTree *>(READ_LOCAL_ID());
+    OpSegmentTreeFree(tree);
+    DISPATCH_NEXT();
+  }
+
   // -------------------------------------------------------
   // Output
   // -------------------------------------------------------
@@ -1924,6 +2135,25 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {  // NOLINT
     DISPATCH_NEXT();
   }
 
+  OP(IndexIteratorAddBatchKey) : {
+    auto *iter = frame->LocalAt<sql::IndexIterator *>(READ_LOCAL_ID());
+    OpIndexIteratorAddBatchKey(iter);
+    DISPATCH_NEXT();
+  }
+
+  OP(IndexIteratorScanKeyBatch) : {
+    auto *iter = frame->LocalAt<sql::IndexIterator *>(READ_LOCAL_ID());
+    OpIndexIteratorScanKeyBatch(iter);
+    DISPATCH_NEXT();
+  }
+
+  OP(IndexIteratorSelectBatchResult) : {
+    auto *iter = frame->LocalAt<sql::IndexIterator *>(READ_LOCAL_ID());
+    auto key_idx = frame->LocalAt<uint32_t>(READ_LOCAL_ID());
+    OpIndexIteratorSelectBatchResult(iter, key_idx);
+    DISPATCH_NEXT();
+  }
+
   OP(IndexIteratorScanAscending) : {
     auto *iter = frame->LocalAt<sql::IndexIterator *>(READ_LOCAL_ID());
     auto scan_type = frame->LocalAt<storage::index::ScanType>(READ_LOCAL_ID());
@@ -1932,6 +2162,14 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {  // NOLINT
     DISPATCH_NEXT();
   }
 
+  OP(IndexIteratorScanAscendingKeys) : {
+    auto *iter = frame->LocalAt<sql::IndexIterator *>(READ_LOCAL_ID());
+    auto scan_type = frame->LocalAt<storage::index::ScanType>(READ_LOCAL_ID());
+    auto limit = frame->LocalAt<uint32_t>(READ_LOCAL_ID());
+    OpIndexIteratorScanAscendingKeys(iter, scan_type, limit);
+    DISPATCH_NEXT();
+  }
+
   OP(IndexIteratorScanDescending) : {
     auto *iter = frame->LocalAt<sql::IndexIterator *>(READ_LOCAL_ID());
     OpIndexIteratorScanDescending(iter);
@@ -1986,6 +2224,13 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {  // NOLINT
     DISPATCH_NEXT();
   }
 
+  OP(IndexIteratorGetKeyPR) : {
+    auto *pr = frame->LocalAt<storage::ProjectedRow **>(READ_LOCAL_ID());
+    auto *iter = frame->LocalAt<sql::IndexIterator *>(READ_LOCAL_ID());
+    OpIndexIteratorGetKeyPR(pr, iter);
+    DISPATCH_NEXT();
+  }
+
   OP(IndexIteratorGetSlot) : {
     auto *slot = frame->LocalAt<storage::TupleSlot *>(READ_LOCAL_ID());
     auto *iter = frame->LocalAt<sql::IndexIterator *>(READ_LOCAL_ID());
@@ -2170,6 +2415,42 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {  // NOLINT
     DISPATCH_NEXT();
   }
 
+  OP(StorageInterfaceIndexInsertBatch) : {
+    auto *result = frame->LocalAt<bool *>(READ_LOCAL_ID());
+    auto *storage_interface = frame->LocalAt<sql::StorageInterface *>(READ_LOCAL_ID());
+    OpStorageInterfaceIndexInsertBatch(result, storage_interface);
+    DISPATCH_NEXT();
+  }
+
+  OP(StorageInterfaceIndexDeleteBatch) : {
+    auto *storage_interface = frame->LocalAt<sql::StorageInterface *>(READ_LOCAL_ID());
+    auto *tuple_slot = frame->LocalAt<storage::TupleSlot *>(READ_LOCAL_ID());
+    OpStorageInterfaceIndexDeleteBatch(storage_interface, tuple_slot);
+    DISPATCH_NEXT();
+  }
+
+  OP(StorageInterfaceIndexFlushBatches) : {
+    auto *result = frame->LocalAt<bool *>(READ_LOCAL_ID());
+    auto *storage_interface = frame->LocalAt<sql::StorageInterface *>(READ_LOCAL_ID());
+    OpStorageInterfaceIndexFlushBatches(result, storage_interface);
+    DISPATCH_NEXT();
+  }
+
+  OP(StorageInterfaceIndexBulkLoadStage) : {
+    auto *result = frame->LocalAt<bool *>(READ_LOCAL_ID());
+    auto *storage_interface = frame->LocalAt<sql::StorageInterface *>(READ_LOCAL_ID());
+    auto *tuple_slot = frame->LocalAt<storage::TupleSlot *>(READ_LOCAL_ID());
+    OpStorageInterfaceIndexBulkLoadStage(result, storage_interface, tuple_slot);
+    DISPATCH_NEXT();
+  }
+
+  OP(StorageInterfaceIndexBulkLoad) : {
+    auto *result = frame->LocalAt<bool *>(READ_LOCAL_ID());
+    auto *storage_interface = frame->LocalAt<sql::StorageInterface *>(READ_LOCAL_ID());
+    OpStorageInterfaceIndexBulkLoad(result, storage_interface);
+    DISPATCH_NEXT();
+  }
+
   OP(StorageInterfaceIndexDelete) : {
     auto *storage_interface = frame->LocalAt<sql::StorageInterface *>(READ_LOCAL_ID());
     auto *tuple_slot = frame->LocalAt<storage::TupleSlot *>(READ_LOCAL_ID());
@@ -2410,6 +2691,27 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {  // NOLINT
     DISPATCH_NEXT();
   }
 
+  OP(LikePatternInit) : {
+    auto *pattern = frame->LocalAt<sql::LikePattern *>(READ_LOCAL_ID());
+    auto *str = frame->LocalAt<const sql::StringVal *>(READ_LOCAL_ID());
+    OpLikePatternInit(pattern, str);
+    DISPATCH_NEXT();
+  }
+
+  OP(LikePatternMatch) : {
+    auto *result = frame->LocalAt<sql::BoolVal *>(READ_LOCAL_ID());
+    auto *input = frame->LocalAt<const sql::StringVal *>(READ_LOCAL_ID());
+    auto *pattern = frame->LocalAt<const sql::LikePattern *>(READ_LOCAL_ID());
+    OpLikePatternMatch(result, input, pattern);
+    DISPATCH_NEXT();
+  }
+
+  OP(LikePatternFree) : {
+    auto *pattern = frame->LocalAt<sql::LikePattern *>(READ_LOCAL_ID());
+    OpLikePatternFree(pattern);
+    DISPATCH_NEXT();
+  }
+
   OP(Lower) : {
     auto *result = frame->LocalAt<sql::StringVal *>(READ_LOCAL_ID());
     auto *exec_ctx = frame->LocalAt<exec::ExecutionContext *>(READ_LOCAL_ID());
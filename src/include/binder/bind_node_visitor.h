@@ -87,6 +87,7 @@ class BindNodeVisitor final : public SqlNodeVisitor {
   void Visit(common::ManagedPointer<parser::TableStarExpression> expr) override;
   void Visit(common::ManagedPointer<parser::SubqueryExpression> expr) override;
   void Visit(common::ManagedPointer<parser::TypeCastExpression> expr) override;
+  void Visit(common::ManagedPointer<parser::WindowExpression> expr) override;
 
   void Visit(common::ManagedPointer<parser::GroupByDescription> node) override;
   void Visit(common::ManagedPointer<parser::JoinDefinition> node) override;
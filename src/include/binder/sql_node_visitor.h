@@ -44,6 +44,7 @@ class StarExpression;
 class TableStarExpression;
 class SubqueryExpression;
 class TypeCastExpression;
+class WindowExpression;
 }  // namespace parser
 
 namespace binder {
@@ -238,6 +239,12 @@ class SqlNodeVisitor {
    */
   virtual void Visit(common::ManagedPointer<parser::TypeCastExpression> expr);
 
+  /**
+   * Visitor pattern for WindowExpression
+   * @param expr to be visited
+   */
+  virtual void Visit(common::ManagedPointer<parser::WindowExpression> expr);
+
   // START some sub query nodes inside SelectStatement
 
   /**
@@ -267,21 +267,67 @@ class IndexSchema {
    * @param is_primary indicating whether this will be the index for a primary key
    * @param is_exclusion indicating whether this index is for exclusion constraints
    * @param is_immediate indicating that the uniqueness check fails at insertion time
+   * @param predicate the rows that a partial index contains, or nullptr if the index contains every row
    */
   IndexSchema(std::vector<Column> columns, const storage::index::IndexType type, const bool is_unique,
-              const bool is_primary, const bool is_exclusion, const bool is_immediate)
+              const bool is_primary, const bool is_exclusion, const bool is_immediate,
+              common::ManagedPointer<const parser::AbstractExpression> predicate = nullptr)
       : columns_(std::move(columns)),
         type_(type),
         is_unique_(is_unique),
         is_primary_(is_primary),
         is_exclusion_(is_exclusion),
-        is_immediate_(is_immediate) {
+        is_immediate_(is_immediate),
+        predicate_(predicate == nullptr ? nullptr : predicate->Copy()) {
     NOISEPAGE_ASSERT((is_primary && is_unique) || (!is_primary), "is_primary requires is_unique to be true as well.");
     ExtractIndexedColOids();
   }
 
   IndexSchema() = default;
 
+  /**
+   * Overrides default copy constructor to ensure we do a deep copy on the predicate
+   * @param old_schema to be copied
+   */
+  IndexSchema(const IndexSchema &old_schema)
+      : columns_(old_schema.columns_),
+        type_(old_schema.type_),
+        indexed_oids_(old_schema.indexed_oids_),
+        is_unique_(old_schema.is_unique_),
+        is_primary_(old_schema.is_primary_),
+        is_exclusion_(old_schema.is_exclusion_),
+        is_immediate_(old_schema.is_immediate_),
+        predicate_(old_schema.predicate_ == nullptr ? nullptr : old_schema.predicate_->Copy()) {}
+
+  /**
+   * Allows operator= to call IndexSchema's custom copy-constructor.
+   * @param schema index schema to be copied
+   * @return the current index schema after update
+   */
+  IndexSchema &operator=(const IndexSchema &schema) {
+    columns_ = schema.columns_;
+    type_ = schema.type_;
+    indexed_oids_ = schema.indexed_oids_;
+    is_unique_ = schema.is_unique_;
+    is_primary_ = schema.is_primary_;
+    is_exclusion_ = schema.is_exclusion_;
+    is_immediate_ = schema.is_immediate_;
+    predicate_ = schema.predicate_ == nullptr ? nullptr : schema.predicate_->Copy();
+    return *this;
+  }
+
+  /** Default move constructor. */
+  IndexSchema(IndexSchema &&) = default;
+
+  /**
+   * Default move assignment.
+   * @return the current index schema after update
+   */
+  IndexSchema &operator=(IndexSchema &&) = default;
+
+  /** Default destructor. */
+  ~IndexSchema() = default;
+
   /**
    * @return the columns which define the index's schema
    */
@@ -329,6 +375,18 @@ class IndexSchema {
    */
   bool Immediate() const { return is_immediate_; }
 
+  /**
+   * @return true if this is a partial index, i.e., it only contains the rows that satisfy Predicate()
+   */
+  bool Partial() const { return predicate_ != nullptr; }
+
+  /**
+   * @return the predicate of a partial index, or nullptr if the index contains every row of the table
+   */
+  common::ManagedPointer<const parser::AbstractExpression> Predicate() const {
+    return common::ManagedPointer(static_cast<const parser::AbstractExpression *>(predicate_.get()));
+  }
+
   /**
    * @return the backend that should be used to implement this index
    */
@@ -411,6 +469,7 @@ class IndexSchema {
     hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(is_primary_));
     hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(is_exclusion_));
     hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(is_immediate_));
+    if (predicate_ != nullptr) hash = common::HashUtil::CombineHashes(hash, predicate_->Hash());
     return hash;
   }
 
@@ -427,7 +486,9 @@ class IndexSchema {
     if (is_immediate_ != rhs.is_immediate_) return false;
     // TODO(Ling): Does column order matter for compare equal?
     if (indexed_oids_ != rhs.indexed_oids_) return false;
-    return columns_ == rhs.columns_;
+    if (columns_ != rhs.columns_) return false;
+    if (predicate_ == nullptr) return rhs.predicate_ == nullptr;
+    return rhs.predicate_ != nullptr && *predicate_ == *rhs.predicate_;
   }
 
   /**
@@ -451,6 +512,7 @@ class IndexSchema {
   bool is_primary_;
   bool is_exclusion_;
   bool is_immediate_;
+  std::unique_ptr<parser::AbstractExpression> predicate_;
 };
 
 DEFINE_JSON_HEADER_DECLARATIONS(IndexSchema::Column);
@@ -110,6 +110,18 @@ struct Constants {
    */
   static constexpr const int NUM_PARALLEL_EXECUTION_THREADS = -1;
 
+  /**
+   * Flag indicating if CREATE INDEX scans the table in parallel even if IS_PARALLEL_EXECUTION_ENABLED is false.
+   * This value will be overwritten by the SettingsManager (if enabled).
+   */
+  static constexpr const bool IS_PARALLEL_INDEX_BUILD_ENABLED = false;
+
+  /**
+   * Number of threads that scan the table for CREATE INDEX, where 0 means one per hardware thread.
+   * This value will be overwritten by the SettingsManager (if enabled).
+   */
+  static constexpr const int NUM_INDEX_BUILD_THREADS = 0;
+
   /**
    * Flag indicating if counters is enabled
    * This value will be overwritten by the SettingsManager (if enabled).
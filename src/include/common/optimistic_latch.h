@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+
+#include "common/macros.h"
+#include "common/shared_latch.h"
+
+namespace noisepage::common {
+
+/**
+ * A shared latch with a version counter for optimistic readers, as used by optimistic lock coupling. Writers still take
+ * the latch exclusively, and every exclusive acquire and release increments the version, so that the version is odd
+ * while a writer holds the latch. A reader that observes the same even version before and after reading the protected
+ * data knows that no writer modified the data in between, without ever writing to the latch itself. Readers that have
+ * to keep the data stable for longer can still take the latch in shared mode, which does not change the version.
+ */
+class OptimisticLatch {
+ public:
+  /**
+   * Acquire exclusive lock on the latch, which invalidates the versions that optimistic readers hold.
+   */
+  void LockExclusive() {
+    latch_.LockExclusive();
+    version_.fetch_add(1, std::memory_order_relaxed);
+    // Keep the writes of the critical section from becoming visible before the odd version.
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+
+  /**
+   * Try to acquire exclusive lock on the latch.
+   * @return true if lock acquired, false otherwise.
+   */
+  bool TryExclusiveLock() {
+    if (!latch_.TryExclusiveLock()) return false;
+    version_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Acquire exclusive lock on the latch, but only if no writer held it since the given version was read.
+   * @param version version that was read by ReadVersion()
+   * @return true if lock acquired, false if the version is outdated, in which case the latch is not held
+   */
+  bool UpgradeToExclusive(const uint64_t version) {
+    if (version_.load(std::memory_order_relaxed) != version) return false;
+    LockExclusive();
+    if (version_.load(std::memory_order_relaxed) == version + 1) return true;
+    UnlockExclusive();
+    return false;
+  }
+
+  /**
+   * Release exclusive ownership of the latch.
+   */
+  void UnlockExclusive() {
+    version_.fetch_add(1, std::memory_order_release);
+    latch_.UnlockExclusive();
+  }
+
+  /**
+   * Acquire shared lock on the latch. This does not change the version.
+   */
+  void LockShared() { latch_.LockShared(); }
+
+  /**
+   * Try to acquire shared lock on the latch.
+   * @return true if lock acquired, false otherwise.
+   */
+  bool TryLockShared() { return latch_.TryLockShared(); }
+
+  /**
+   * Release shared ownership of the latch.
+   */
+  void UnlockShared() { latch_.UnlockShared(); }
+
+  /**
+   * Start an optimistic read. Waits until no writer holds the latch.
+   * @return the current version, to be passed to Validate() once the protected data was read
+   */
+  uint64_t ReadVersion() const {
+    uint64_t version = version_.load(std::memory_order_acquire);
+    while ((version & 1U) != 0) {
+      std::this_thread::yield();
+      version = version_.load(std::memory_order_acquire);
+    }
+    return version;
+  }
+
+  /**
+   * Finish an optimistic read. Anything read since ReadVersion() must be discarded if this returns false.
+   * @param version version returned by ReadVersion()
+   * @return true if no writer held the latch since the version was read
+   */
+  bool Validate(const uint64_t version) const {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return version_.load(std::memory_order_relaxed) == version;
+  }
+
+ private:
+  SharedLatch latch_;
+  std::atomic<uint64_t> version_ = 0;
+};
+
+}  // namespace noisepage::common
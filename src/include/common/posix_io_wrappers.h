@@ -1,5 +1,9 @@
 #pragma once
 
+#include <sys/types.h>
+
+#include <cstddef>
+
 #include "common/macros.h"
 
 namespace noisepage::storage {
@@ -53,6 +57,17 @@ class PosixIoWrappers {
    * @throws runtime_error if the underlying posix call failed
    */
   static void WriteFully(int fd, const void *buf, size_t nbyte);
+
+  /**
+   * Wrapper around the posix pwrite call, where a single function call will always write the entire buffer out at the
+   * given offset. The file offset of the file descriptor is not changed.
+   * @param fd posix fildes arg
+   * @param buf posix buf arg
+   * @param nbyte posix nbyte arg
+   * @param offset posix offset arg
+   * @throws runtime_error if the underlying posix call failed
+   */
+  static void PWriteFully(int fd, const void *buf, size_t nbyte, off_t offset);
 };
 
 extern template int PosixIoWrappers::Open<>(const char *path, int oflag);
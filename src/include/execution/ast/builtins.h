@@ -33,6 +33,9 @@ namespace noisepage::execution::ast {
                                                                         \
   /* SQL Functions */                                                   \
   F(Like, like)                                                         \
+  F(LikePatternInit, likePatternInit)                                   \
+  F(LikePatternMatch, likePatternMatch)                                 \
+  F(LikePatternFree, likePatternFree)                                   \
   F(DatePart, datePart)                                                 \
                                                                         \
   /* Thread State Container */                                          \
@@ -159,6 +162,7 @@ namespace noisepage::execution::ast {
   F(AggPartIterGetRowEntry, aggPartIterGetRowEntry)                     \
   F(AggInit, aggInit)                                                   \
   F(AggAdvance, aggAdvance)                                             \
+  F(AggAdvanceVector, aggAdvanceVector)                                 \
   F(AggMerge, aggMerge)                                                 \
   F(AggReset, aggReset)                                                 \
   F(AggResult, aggResult)                                               \
@@ -169,8 +173,12 @@ namespace noisepage::execution::ast {
   F(JoinHashTableInsert, joinHTInsert)                                  \
   F(JoinHashTableBuild, joinHTBuild)                                    \
   F(JoinHashTableBuildParallel, joinHTBuildParallel)                    \
+  F(JoinHashTableMoveTuplesParallel, joinHTMoveTuplesParallel)          \
+  F(JoinHashTableBuildAndJoin, joinHTBuildAndJoin)                      \
+  F(JoinHashTableBuildAndJoinParallel, joinHTBuildAndJoinParallel)      \
   F(JoinHashTableGetTupleCount, joinHTGetTupleCount)                    \
   F(JoinHashTableLookup, joinHTLookup)                                  \
+  F(JoinHashTableParallelScan, joinHTParallelScan)                      \
   F(JoinHashTableFree, joinHTFree)                                      \
                                                                         \
   /* Hash Table Entry Iterator (for hash joins) */                      \
@@ -192,6 +200,7 @@ namespace noisepage::execution::ast {
   F(SorterSort, sorterSort)                                             \
   F(SorterSortParallel, sorterSortParallel)                             \
   F(SorterSortTopKParallel, sorterSortTopKParallel)                     \
+  F(SorterScanPartitionsParallel, sorterScanPartitionsParallel)         \
   F(SorterFree, sorterFree)                                             \
   F(SorterIterInit, sorterIterInit)                                     \
   F(SorterIterHasNext, sorterIterHasNext)                               \
@@ -200,6 +209,15 @@ namespace noisepage::execution::ast {
   F(SorterIterGetRow, sorterIterGetRow)                                 \
   F(SorterIterClose, sorterIterClose)                                   \
                                                                         \
+  /* Segment Tree */                                                    \
+  F(SegmentTreeInit, segTreeInit)                                       \
+  F(SegmentTreeAppend, segTreeAppend)                                   \
+  F(SegmentTreeBuild, segTreeBuild)                                     \
+  F(SegmentTreeQueryInt, segTreeQueryInt)                               \
+  F(SegmentTreeQueryReal, segTreeQueryReal)                             \
+  F(SegmentTreeReset, segTreeReset)                                     \
+  F(SegmentTreeFree, segTreeFree)                                       \
+                                                                        \
   /* Output */                                                          \
   F(ResultBufferNew, resultBufferNew)                                   \
   F(ResultBufferAllocOutRow, resultBufferAllocRow)                      \
@@ -210,7 +228,11 @@ namespace noisepage::execution::ast {
   F(IndexIteratorInit, indexIteratorInit)                               \
   F(IndexIteratorGetSize, indexIteratorGetSize)                         \
   F(IndexIteratorScanKey, indexIteratorScanKey)                         \
+  F(IndexIteratorAddBatchKey, indexIteratorAddBatchKey)                 \
+  F(IndexIteratorScanKeyBatch, indexIteratorScanKeyBatch)               \
+  F(IndexIteratorSelectBatchResult, indexIteratorSelectBatchResult)     \
   F(IndexIteratorScanAscending, indexIteratorScanAscending)             \
+  F(IndexIteratorScanAscendingKeys, indexIteratorScanAscendingKeys)     \
   F(IndexIteratorScanDescending, indexIteratorScanDescending)           \
   F(IndexIteratorScanLimitDescending, indexIteratorScanLimitDescending) \
   F(IndexIteratorAdvance, indexIteratorAdvance)                         \
@@ -219,6 +241,7 @@ namespace noisepage::execution::ast {
   F(IndexIteratorGetHiPR, indexIteratorGetHiPR)                         \
   F(IndexIteratorGetSlot, indexIteratorGetSlot)                         \
   F(IndexIteratorGetTablePR, indexIteratorGetTablePR)                   \
+  F(IndexIteratorGetKeyPR, indexIteratorGetKeyPR)                       \
   F(IndexIteratorFree, indexIteratorFree)                               \
                                                                         \
   /* Projected Row Operations */                                        \
@@ -268,6 +291,11 @@ namespace noisepage::execution::ast {
   F(CSVReaderGetField, csvReaderGetField)                               \
   F(CSVReaderGetRecordNumber, csvReaderGetRecordNumber)                 \
   F(CSVReaderClose, csvReaderClose)                                     \
+  F(CSVScanInit, csvScanInit)                                           \
+  F(CSVScanAdvance, csvScanAdvance)                                     \
+  F(CSVScanGetVPI, csvScanGetVPI)                                       \
+  F(CSVScanClose, csvScanClose)                                         \
+  F(CSVScanParallel, iterateCSVParallel)                                \
                                                                         \
   /* SQL Table Calls */                                                 \
   F(StorageInterfaceInit, storageInterfaceInit)                         \
@@ -281,6 +309,11 @@ namespace noisepage::execution::ast {
   F(IndexInsert, indexInsert)                                           \
   F(IndexInsertUnique, indexInsertUnique)                               \
   F(IndexInsertWithSlot, indexInsertWithSlot)                           \
+  F(IndexInsertBatch, indexInsertBatch)                                 \
+  F(IndexDeleteBatch, indexDeleteBatch)                                 \
+  F(IndexFlushBatches, indexFlushBatches)                               \
+  F(IndexBulkLoadStage, indexBulkLoadStage)                             \
+  F(IndexBulkLoad, indexBulkLoad)                                       \
   F(IndexDelete, indexDelete)                                           \
   F(StorageInterfaceFree, storageInterfaceFree)                         \
   /* Trig */                                                            \
@@ -60,6 +60,7 @@ class Context;
   NON_PRIM(AHTVectorIterator, noisepage::execution::sql::AHTVectorIterator)                       \
   NON_PRIM(AHTOverflowPartitionIterator, noisepage::execution::sql::AHTOverflowPartitionIterator) \
   /* NON_PRIM(CSVReader, noisepage::execution::util::CSVReader)                                */ \
+  NON_PRIM(CSVScanner, noisepage::execution::sql::CSVScanner)                                     \
   NON_PRIM(OutputBuffer, noisepage::execution::exec::OutputBuffer)                                \
   NON_PRIM(ExecutionContext, noisepage::execution::exec::ExecutionContext)                        \
   NON_PRIM(ExecOUFeatureVector, noisepage::selfdriving::ExecOUFeatureVector)                      \
@@ -68,9 +69,11 @@ class Context;
   NON_PRIM(HashTableEntryIterator, noisepage::execution::sql::HashTableEntryIterator)             \
   NON_PRIM(JoinHashTableIterator, noisepage::execution::sql::JoinHashTableIterator)               \
   NON_PRIM(JoinHashTable, noisepage::execution::sql::JoinHashTable)                               \
+  NON_PRIM(LikePattern, noisepage::execution::sql::LikePattern)                                   \
   NON_PRIM(MemoryPool, noisepage::execution::sql::MemoryPool)                                     \
   NON_PRIM(Sorter, noisepage::execution::sql::Sorter)                                             \
   NON_PRIM(SorterIterator, noisepage::execution::sql::SorterIterator)                             \
+  NON_PRIM(SegmentTree, noisepage::execution::sql::SegmentTree)                                   \
   NON_PRIM(TableVectorIterator, noisepage::execution::sql::TableVectorIterator)                   \
   NON_PRIM(ThreadStateContainer, noisepage::execution::sql::ThreadStateContainer)                 \
   NON_PRIM(TupleIdList, noisepage::execution::sql::TupleIdList)                                   \
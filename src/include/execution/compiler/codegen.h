@@ -15,6 +15,7 @@
 #include "execution/ast/identifier.h"
 #include "execution/ast/type.h"
 #include "execution/sql/runtime_types.h"
+#include "execution/sql/segment_tree.h"
 #include "execution/sql/sql.h"
 #include "parser/expression_defs.h"
 #include "planner/plannodes/plan_node_defs.h"
@@ -600,6 +601,52 @@ class CodeGen {
                                                 ast::Expr *query_state, ast::Expr *exec_ctx,
                                                 ast::Identifier worker_name);
 
+  /**
+   * Call \@csvScanInit(). Map a CSV file into memory and initialize a scanner over it.
+   * @param scanner The CSV scanner.
+   * @param exec_ctx The execution context that we are running in.
+   * @param file_name The path to the CSV file.
+   * @param num_cols The number of fields in every record.
+   * @param delimiter The character separating fields.
+   * @param quote The character quoting fields.
+   * @param escape The character escaping quotes within quoted fields.
+   * @return The call expression.
+   */
+  [[nodiscard]] ast::Expr *CSVScanInit(ast::Expr *scanner, ast::Expr *exec_ctx, std::string_view file_name,
+                                       uint32_t num_cols, char delimiter, char quote, char escape);
+
+  /**
+   * Call \@csvScanAdvance(). Attempt to advance the scanner to the next vector of records, returning true if
+   * successful and false otherwise.
+   * @param scanner The CSV scanner.
+   * @return The call expression.
+   */
+  [[nodiscard]] ast::Expr *CSVScanAdvance(ast::Expr *scanner);
+
+  /**
+   * Call \@csvScanGetVPI(). Retrieve the iterator over the current vector of records of a CSV scanner.
+   * @param scanner The CSV scanner.
+   * @return The call expression.
+   */
+  [[nodiscard]] ast::Expr *CSVScanGetVPI(ast::Expr *scanner);
+
+  /**
+   * Call \@csvScanClose(). Unmap the file of a CSV scanner.
+   * @param scanner The CSV scanner.
+   * @return The call expression.
+   */
+  [[nodiscard]] ast::Expr *CSVScanClose(ast::Expr *scanner);
+
+  /**
+   * Call \@iterateCSVParallel(). Parses all records of the CSV scanner in parallel, calling the provided scan
+   * function on every vector of records.
+   * @param scanner The CSV scanner.
+   * @param query_state The query state pointer.
+   * @param worker_name The work function name.
+   * @return The call.
+   */
+  [[nodiscard]] ast::Expr *IterateCSVParallel(ast::Expr *scanner, ast::Expr *query_state, ast::Identifier worker_name);
+
   /**
    * Call \@abortTxn(exec_ctx).
    * @param exec_ctx The execution context that we are running in.
@@ -647,9 +694,11 @@ class CodeGen {
    * @param iter_ptr Pointer to the index iterator.
    * @param scan_type The type of scan to perform.
    * @param limit The limit of the scan in case of limited scans.
+   * @param with_keys Whether an ascending scan also returns the index keys, for index-only scans.
    * @return The expression corresponding to the builtin call.
    */
-  [[nodiscard]] ast::Expr *IndexIteratorScan(ast::Expr *iter_ptr, planner::IndexScanType scan_type, uint32_t limit);
+  [[nodiscard]] ast::Expr *IndexIteratorScan(ast::Expr *iter_ptr, planner::IndexScanType scan_type, uint32_t limit,
+                                             bool with_keys = false);
 
   // -------------------------------------------------------
   //
@@ -942,6 +991,48 @@ class CodeGen {
   [[nodiscard]] ast::Expr *JoinHashTableBuildParallel(ast::Expr *join_hash_table, ast::Expr *thread_state_container,
                                                       ast::Expr *offset);
 
+  /**
+   * Call \@joinHTMoveTuplesParallel(). Moves the tuples in all thread-local join hash tables stored
+   * in the thread state container at the given offset into the global join hash table, without
+   * building it.
+   * @param join_hash_table The global join hash table.
+   * @param thread_state_container The thread state container.
+   * @param offset The offset in the thread state container where thread-local tables are.
+   * @return The call.
+   */
+  [[nodiscard]] ast::Expr *JoinHashTableMoveTuplesParallel(ast::Expr *join_hash_table,
+                                                           ast::Expr *thread_state_container, ast::Expr *offset);
+
+  /**
+   * Call \@joinHTBuildAndJoin(). Builds the join hash table and joins it with the tuples
+   * materialized in the probe join hash table, invoking the provided join function on every pair of
+   * build and probe tuples with equal hash values.
+   * @param join_hash_table The join hash table of build tuples.
+   * @param probe_join_hash_table The join hash table of probe tuples.
+   * @param query_state A pointer to the query state.
+   * @param pipeline_state A pointer to the pipeline state passed to the join function.
+   * @param join_fn The name of the function invoked on every pair of matching tuples.
+   * @return The call.
+   */
+  [[nodiscard]] ast::Expr *JoinHashTableBuildAndJoin(ast::Expr *join_hash_table, ast::Expr *probe_join_hash_table,
+                                                     ast::Expr *query_state, ast::Expr *pipeline_state,
+                                                     ast::Identifier join_fn);
+
+  /**
+   * Call \@joinHTBuildAndJoinParallel(). Like \@joinHTBuildAndJoin(), but partitions, builds, and
+   * joins in parallel, invoking the join function with the thread state of the thread it runs in.
+   * @param join_hash_table The join hash table of build tuples.
+   * @param probe_join_hash_table The join hash table of probe tuples.
+   * @param query_state A pointer to the query state.
+   * @param thread_state_container A pointer to the thread state container.
+   * @param join_fn The name of the function invoked on every pair of matching tuples.
+   * @return The call.
+   */
+  [[nodiscard]] ast::Expr *JoinHashTableBuildAndJoinParallel(ast::Expr *join_hash_table,
+                                                             ast::Expr *probe_join_hash_table, ast::Expr *query_state,
+                                                             ast::Expr *thread_state_container,
+                                                             ast::Identifier join_fn);
+
   /**
    * Call \@joinHTLookup(). Performs a single lookup into the hash table with a tuple with the
    * provided hash value. The provided iterator will provide tuples in the hash table that match the
@@ -954,6 +1045,18 @@ class CodeGen {
    */
   [[nodiscard]] ast::Expr *JoinHashTableLookup(ast::Expr *join_hash_table, ast::Expr *entry_iter, ast::Expr *hash_val);
 
+  /**
+   * Call \@joinHTParallelScan(). Performs a parallel scan over all tuples in a built join hash
+   * table, using the provided worker function as a callback on each morsel of tuples.
+   * @param join_hash_table A pointer to the global join hash table.
+   * @param query_state A pointer to the query state.
+   * @param thread_state_container A pointer to the thread state.
+   * @param worker_fn The name of the function used to scan over a morsel of the hash table.
+   * @return The call.
+   */
+  [[nodiscard]] ast::Expr *JoinHashTableParallelScan(ast::Expr *join_hash_table, ast::Expr *query_state,
+                                                     ast::Expr *thread_state_container, ast::Identifier worker_fn);
+
   /**
    * Call \@joinHTFree(). Cleanup and destroy the provided join hash table instance.
    * @param join_hash_table The join hash table.
@@ -1030,6 +1133,18 @@ class CodeGen {
    */
   [[nodiscard]] ast::Expr *AggHashTableInit(ast::Expr *agg_ht, ast::Expr *exec_ctx, ast::Identifier agg_payload_type);
 
+  /**
+   * Call \@aggHTInit(). Initializes an aggregation hash table sized up-front to hold the given number of groups without
+   * growing.
+   * @param agg_ht A pointer to the aggregation hash table.
+   * @param exec_ctx The execution context.
+   * @param agg_payload_type The name of the struct representing the aggregation payload.
+   * @param initial_size The expected number of groups.
+   * @return The call.
+   */
+  [[nodiscard]] ast::Expr *AggHashTableInit(ast::Expr *agg_ht, ast::Expr *exec_ctx, ast::Identifier agg_payload_type,
+                                            uint32_t initial_size);
+
   /**
    * Call \@aggHTLookup(). Performs a single key lookup in an aggregation hash table. The hash value
    * is provided, as is a key check function to resolve hash collisions. The result of the lookup
@@ -1189,6 +1304,24 @@ class CodeGen {
    */
   [[nodiscard]] ast::Expr *AggregatorAdvance(ast::Expr *agg, ast::Expr *val);
 
+  /**
+   * Call \@aggAdvanceVector(). Advance an aggregator with a column of the current vector projection of a VPI.
+   * @param agg A pointer to the aggregator.
+   * @param vpi The vector projection iterator.
+   * @param col_idx The index of the column in the vector projection.
+   * @return The call.
+   */
+  [[nodiscard]] ast::Expr *AggregatorAdvanceVector(ast::Expr *agg, ast::Expr *vpi, uint32_t col_idx);
+
+  /**
+   * Call \@aggAdvanceVector(). Advance a COUNT aggregator by the number of selected tuples in the current vector
+   * projection of a VPI, i.e., compute COUNT(*).
+   * @param agg A pointer to the aggregator.
+   * @param vpi The vector projection iterator.
+   * @return The call.
+   */
+  [[nodiscard]] ast::Expr *AggregatorAdvanceVector(ast::Expr *agg, ast::Expr *vpi);
+
   /**
    * Call \@aggMerge(). Merges two aggregators storing the result in the first argument.
    * @param agg1 A pointer to the aggregator.
@@ -1287,6 +1420,18 @@ class CodeGen {
    */
   [[nodiscard]] ast::Expr *SortTopKParallel(ast::Expr *sorter, ast::Expr *tls, ast::Expr *offset, std::size_t top_k);
 
+  /**
+   * Call \@sorterScanPartitionsParallel(). Scan the partitions of a sorted sorter in parallel.
+   * @param sorter The sorted sorter instance.
+   * @param query_state The query state pointer.
+   * @param tls The thread-state container.
+   * @param same_partition_fn The name of the function checking if two rows are in the same partition.
+   * @param scan_fn The name of the function scanning a range of partitions.
+   * @return The call.
+   */
+  [[nodiscard]] ast::Expr *SorterScanPartitionsParallel(ast::Expr *sorter, ast::Expr *query_state, ast::Expr *tls,
+                                                        ast::Identifier same_partition_fn, ast::Identifier scan_fn);
+
   /**
    * Call \@sorterFree(). Destroy the provided sorter instance.
    * @param sorter The sorter instance.
@@ -1340,6 +1485,60 @@ class CodeGen {
    */
   [[nodiscard]] ast::Expr *SorterIterClose(ast::Expr *iter);
 
+  // -------------------------------------------------------
+  //
+  // Segment trees
+  //
+  // -------------------------------------------------------
+
+  /**
+   * Call \@segTreeInit(). Initialize the provided segment tree.
+   * @param tree The segment tree instance.
+   * @param exec_ctx The execution context that we are running in.
+   * @param kind The aggregate the tree computes over ranges.
+   * @return The call.
+   */
+  [[nodiscard]] ast::Expr *SegmentTreeInit(ast::Expr *tree, ast::Expr *exec_ctx, sql::SegmentTree::AggregateKind kind);
+
+  /**
+   * Call \@segTreeAppend(). Append a SQL integer or real value to the provided segment tree.
+   * @param tree The segment tree instance.
+   * @param val The value to append.
+   * @return The call.
+   */
+  [[nodiscard]] ast::Expr *SegmentTreeAppend(ast::Expr *tree, ast::Expr *val);
+
+  /**
+   * Call \@segTreeBuild(). Build the provided segment tree over its appended values.
+   * @param tree The segment tree instance.
+   * @return The call.
+   */
+  [[nodiscard]] ast::Expr *SegmentTreeBuild(ast::Expr *tree);
+
+  /**
+   * Call \@segTreeQueryInt() or \@segTreeQueryReal(). Compute the aggregate over a range of the provided tree.
+   * @param tree The segment tree instance.
+   * @param begin The 64-bit index of the first value in the range.
+   * @param end The 64-bit index one past the last value in the range.
+   * @param real_result True if the aggregate is a SQL real, false if it is a SQL integer.
+   * @return The call.
+   */
+  [[nodiscard]] ast::Expr *SegmentTreeQuery(ast::Expr *tree, ast::Expr *begin, ast::Expr *end, bool real_result);
+
+  /**
+   * Call \@segTreeReset(). Remove all values from the provided segment tree.
+   * @param tree The segment tree instance.
+   * @return The call.
+   */
+  [[nodiscard]] ast::Expr *SegmentTreeReset(ast::Expr *tree);
+
+  /**
+   * Call \@segTreeFree(). Destroy the provided segment tree.
+   * @param tree The segment tree instance.
+   * @return The call.
+   */
+  [[nodiscard]] ast::Expr *SegmentTreeFree(ast::Expr *tree);
+
   /**
    * Call \@like(). Implements the SQL LIKE() operation.
    * @param str The input string.
@@ -1356,6 +1555,29 @@ class CodeGen {
    */
   [[nodiscard]] ast::Expr *NotLike(ast::Expr *str, ast::Expr *pattern);
 
+  /**
+   * Call \@likePatternInit(). Analyze a LIKE pattern once, so that it can be matched against many strings.
+   * @param like_pattern A pointer to the LikePattern to initialize.
+   * @param pattern The pattern. It must not be NULL.
+   * @return The call.
+   */
+  [[nodiscard]] ast::Expr *LikePatternInit(ast::Expr *like_pattern, ast::Expr *pattern);
+
+  /**
+   * Call \@likePatternMatch(). Implements the SQL LIKE() operation against an analyzed pattern.
+   * @param str The input string.
+   * @param like_pattern A pointer to the analyzed pattern.
+   * @return The call.
+   */
+  [[nodiscard]] ast::Expr *LikePatternMatch(ast::Expr *str, ast::Expr *like_pattern);
+
+  /**
+   * Call \@likePatternFree(). Destroy an analyzed LIKE pattern.
+   * @param like_pattern A pointer to the analyzed pattern.
+   * @return The call.
+   */
+  [[nodiscard]] ast::Expr *LikePatternFree(ast::Expr *like_pattern);
+
   /**
    * Call \@csvReaderInit(). Initialize a CSV reader for the given file name.
    * @param reader The reader.
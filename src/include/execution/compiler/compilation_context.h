@@ -127,12 +127,21 @@ class CompilationContext {
   /** @return True if we should collect counters in TPL, used for Lin's models. */
   bool IsCountersEnabled() const { return counters_enabled_; }
 
+  /** @return The execution settings that the query is compiled with. */
+  const exec::ExecutionSettings &GetExecutionSettings() const { return query_->GetExecutionSettings(); }
+
   /** @return True if we should record pipeline metrics */
   bool IsPipelineMetricsEnabled() const { return pipeline_metrics_enabled_; }
 
   /** @return Query Id associated with the query */
   query_id_t GetQueryId() const { return query_id_; }
 
+  /**
+   * @return The optimizer's meta data for the plan being compiled, including the estimated cardinality of every plan
+   *         node; null if the plan was not produced by the optimizer.
+   */
+  common::ManagedPointer<planner::PlanMetaData> GetPlanMetaData() const { return plan_meta_data_; }
+
  private:
   // Private to force use of static Compile() function.
   explicit CompilationContext(ExecutableQuery *query, query_id_t query_id_, catalog::CatalogAccessor *accessor,
@@ -182,6 +191,9 @@ class CompilationContext {
   // The pipelines in this context in no specific order.
   std::vector<Pipeline *> pipelines_;
 
+  // The optimizer's meta data for the plan, if any.
+  common::ManagedPointer<planner::PlanMetaData> plan_meta_data_;
+
   // Whether counters are enabled.
   bool counters_enabled_;
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "execution/compiler/expression/expression_translator.h"
+#include "execution/compiler/state_descriptor.h"
 
 namespace noisepage::parser {
 class ComparisonExpression;
@@ -27,6 +28,25 @@ class ComparisonTranslator : public ExpressionTranslator {
    * @return The value of the expression.
    */
   ast::Expr *DeriveValue(WorkContext *ctx, const ColumnValueProvider *provider) const override;
+
+  /**
+   * Analyze a constant LIKE pattern, if there is one.
+   * @param function The function being built.
+   */
+  void InitializeQueryState(FunctionBuilder *function) const override;
+
+  /**
+   * Destroy the analyzed LIKE pattern, if there is one.
+   * @param function The function being built.
+   */
+  void TearDownQueryState(FunctionBuilder *function) const override;
+
+ private:
+  // True if this is a (NOT) LIKE against a non-NULL constant pattern, which is analyzed once in the query state.
+  bool HasConstantLikePattern() const;
+
+  // The analyzed pattern of a (NOT) LIKE against a constant pattern.
+  StateDescriptor::Entry like_pattern_;
 };
 
 }  // namespace noisepage::execution::compiler
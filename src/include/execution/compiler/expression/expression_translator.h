@@ -14,6 +14,7 @@ namespace noisepage::execution::compiler {
 
 class CodeGen;
 class CompilationContext;
+class FunctionBuilder;
 class WorkContext;
 class Pipeline;
 
@@ -47,6 +48,18 @@ class ExpressionTranslator {
    */
   virtual ast::Expr *DeriveValue(WorkContext *ctx, const ColumnValueProvider *provider) const = 0;
 
+  /**
+   * Initialize any query state the expression declared, e.g., values computed once per query.
+   * @param function The function being built.
+   */
+  virtual void InitializeQueryState(FunctionBuilder *function) const {}
+
+  /**
+   * Tear down any query state the expression declared.
+   * @param function The function being built.
+   */
+  virtual void TearDownQueryState(FunctionBuilder *function) const {}
+
   /**
    * @return The expression being translated.
    */
@@ -23,10 +23,18 @@ class CSVScanTranslator : public OperatorTranslator, public PipelineDriver {
   CSVScanTranslator(const planner::CSVScanPlanNode &plan, CompilationContext *compilation_context, Pipeline *pipeline);
 
   /**
-   * Define the base row type this scan produces.
-   * @param decls The top-level declaration list.
+   * Initialize the flag that tracks whether the pipeline's scanner has to be closed.
+   * @param pipeline The current pipeline.
+   * @param function The pipeline generating function.
    */
-  void DefineHelperStructs(util::RegionVector<ast::StructDecl *> *decls) override;
+  void InitializePipelineState(const Pipeline &pipeline, FunctionBuilder *function) const override;
+
+  /**
+   * Close the pipeline's scanner, if it is still open.
+   * @param pipeline The current pipeline.
+   * @param function The pipeline generating function.
+   */
+  void TearDownPipelineState(const Pipeline &pipeline, FunctionBuilder *function) const override;
 
   /**
    * Generate the CSV scan logic.
@@ -36,18 +44,16 @@ class CSVScanTranslator : public OperatorTranslator, public PipelineDriver {
   void PerformPipelineWork(WorkContext *context, FunctionBuilder *function) const override;
 
   /**
-   * CSV Scans are always serial, so should never launch work.
+   * @return The pipeline work function parameters. Just the *VectorProjectionIterator over the parsed records.
    */
-  util::RegionVector<ast::FieldDecl *> GetWorkerParams() const override {
-    UNREACHABLE("CSV scans are always serial ... for now.");
-  }
+  util::RegionVector<ast::FieldDecl *> GetWorkerParams() const override;
 
   /**
-   * CSV Scans are always serial, so should never launch work.
+   * Launch a parallel scan of the CSV file.
+   * @param function The pipeline generating function.
+   * @param work_func_name The name of the work function that implements the pipeline logic.
    */
-  void LaunchWork(FunctionBuilder *function, ast::Identifier work_func_name) const override {
-    UNREACHABLE("CSV scans are always serial ... for now.");
-  }
+  void LaunchWork(FunctionBuilder *function, ast::Identifier work_func_name) const override;
 
   /**
    * Access a column from the base CSV.
@@ -56,19 +62,32 @@ class CSVScanTranslator : public OperatorTranslator, public PipelineDriver {
    */
   ast::Expr *GetTableColumn(catalog::col_oid_t col_oid) const override;
 
+  /**
+   * CSV scans have no children; the output schema of the plan refers to the fields of the CSV file instead.
+   * @param context The context of work.
+   * @param child_idx The index of the child, which is always 0.
+   * @param attr_idx The index of the field in the CSV file.
+   * @return The value of the field, converted to the type of the output column.
+   */
+  ast::Expr *GetChildOutput(WorkContext *context, uint32_t child_idx, uint32_t attr_idx) const override;
+
  private:
   // Return the plan.
   const planner::CSVScanPlanNode &GetCSVPlan() const { return GetPlanAs<planner::CSVScanPlanNode>(); }
 
-  // Access the given field in the CSV row.
-  ast::Expr *GetField(uint32_t field_index) const;
-  // Access a pointer to the field in the CSV row.
-  ast::Expr *GetFieldPtr(uint32_t field_index) const;
+  // Initialize the scanner in the pipeline state.
+  void InitScanner(FunctionBuilder *function) const;
+
+  // Call the consumers on every record of the current vector.
+  void ScanVPI(WorkContext *context, FunctionBuilder *function) const;
 
  private:
-  // The name of the base row variable.
-  ast::Identifier base_row_type_;
-  StateDescriptor::Entry base_row_;
+  // The name of the variable holding the iterator over the current vector of records.
+  ast::Identifier vpi_var_;
+
+  // The scanner, and whether it has to be closed.
+  StateDescriptor::Entry csv_scanner_base_;
+  StateDescriptor::Entry csv_scanner_needs_free_;
 };
 
 }  // namespace noisepage::execution::compiler
@@ -141,9 +141,14 @@ class HashAggregationTranslator : public OperatorTranslator, public PipelineDriv
   ast::FunctionDecl *GenerateMergeOverflowPartitionsFunction();
   void MergeOverflowPartitions(FunctionBuilder *function, ast::Expr *agg_ht, ast::Expr *iter);
 
+  // The optimizer's estimate of the number of groups to pre-size the global
+  // hash table for, or zero if there is no usable estimate.
+  uint32_t EstimateNumGroups() const;
+
   // Initialize and destroy the input aggregation hash table. These are called
-  // from InitializeQueryState() and InitializePipelineState().
-  void InitializeAggregationHashTable(FunctionBuilder *function, ast::Expr *agg_ht) const;
+  // from InitializeQueryState() and InitializePipelineState(). The table is
+  // pre-sized for the given number of groups if it exceeds the default size.
+  void InitializeAggregationHashTable(FunctionBuilder *function, ast::Expr *agg_ht, uint32_t num_groups) const;
   void TearDownAggregationHashTable(FunctionBuilder *function, ast::Expr *agg_ht) const;
 
   // Access an attribute at the given index in the provided aggregate row.
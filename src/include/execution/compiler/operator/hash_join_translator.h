@@ -23,6 +23,11 @@ class FunctionBuilder;
 
 /**
  * A translator for hash joins.
+ *
+ * Inner joins whose build side the optimizer estimates to be larger than the cache are partitioned:
+ * the probe pipeline materializes its rows into a second join hash table instead of probing, and
+ * when it finishes, both sides are radix-partitioned and joined partition by partition through
+ * JoinHashTable::BuildAndJoin(), in parallel if the probe pipeline is parallel.
  */
 class HashJoinTranslator : public OperatorTranslator {
  public:
@@ -38,7 +43,7 @@ class HashJoinTranslator : public OperatorTranslator {
 
   /**
    * Declare the build-row struct used to materialize tuples from the build side of the join. In the
-   * case of left outer joins additionally declare a probe-row struct which lets us
+   * case of outer and partitioned joins additionally declare a probe-row struct which lets us
    * materialize tuples from the probe side of the join.
    * @param decls The top-level declarations for the query. The declared structs will be registered
    *              here after they've been constructed.
@@ -46,14 +51,16 @@ class HashJoinTranslator : public OperatorTranslator {
   void DefineHelperStructs(util::RegionVector<ast::StructDecl *> *decls) override;
 
   /**
-   * Only for left outer joins - declare a function joinConsumer which encapsulates the parent translator's
-   * functionality
+   * Only for outer joins - declare a function joinConsumer which encapsulates the parent translator's
+   * functionality. Only for partitioned joins - declare the function invoked on every pair of build
+   * and probe rows with equal hash values.
    * @param decls
    */
   void DefineHelperFunctions(util::RegionVector<ast::FunctionDecl *> *decls) override;
 
   /**
-   * Define all hook functions
+   * Define all hook functions, and for left and full outer joins with a parallel probe pipeline, the
+   * function that emits the unmatched build rows of a morsel of the join hash table.
    * @param pipeline Pipeline that helper functions are being generated for.
    * @param decls Query-level declarations.
    */
@@ -89,7 +96,8 @@ class HashJoinTranslator : public OperatorTranslator {
   /**
    * Implement main join logic. If the context is coming from the left pipeline, the input tuples
    * are materialized into the join hash table. If the context is coming from the right pipeline,
-   * the input tuples are probed in the join hash table.
+   * the input tuples are probed in the join hash table, or materialized into the probe join hash
+   * table if the join is partitioned.
    * @param ctx The context of the work.
    * @param function The pipeline generating function.
    */
@@ -97,7 +105,11 @@ class HashJoinTranslator : public OperatorTranslator {
 
   /**
    * If the pipeline context represents the left pipeline and the left pipeline is parallel, we'll
-   * issue a parallel join hash table construction at this point.
+   * issue a parallel join hash table construction at this point, or only move the thread-local
+   * tuples into the global table if the join is partitioned. If it represents the right pipeline of
+   * a partitioned join, both sides are built and joined here. If it represents the right pipeline
+   * of a left or full outer join, the unmatched build rows are emitted here. Both happen in
+   * parallel if the right pipeline is parallel.
    * @param pipeline The current pipeline.
    * @param function The pipeline generating function.
    */
@@ -129,8 +141,21 @@ class HashJoinTranslator : public OperatorTranslator {
   // Is the given pipeline this join's right pipeline?
   bool IsRightPipeline(const Pipeline &pipeline) const { return GetPipeline() == &pipeline; }
 
-  // Initialize the given join hash table instance, provided as a *JHT.
-  void InitializeJoinHashTable(FunctionBuilder *function, ast::Expr *jht_ptr) const;
+  // Is this a left, right, or full outer join? Their output goes through joinConsumer.
+  bool IsOuterJoin() const;
+
+  // Does the join output the build rows that found no match?
+  bool EmitsUnmatchedBuildRows() const;
+
+  // Does the join output the probe rows that found no match?
+  bool EmitsUnmatchedProbeRows() const;
+
+  // Should the probe side be materialized and both sides joined partition by partition? Chosen for
+  // inner joins whose estimated build side doesn't fit in cache.
+  bool UsePartitionedJoin() const;
+
+  // Initialize the given join hash table instance, provided as a *JHT, of the given row type.
+  void InitializeJoinHashTable(FunctionBuilder *function, ast::Expr *jht_ptr, ast::Identifier row_type) const;
 
   // Clean up and destroy the given join hash table instance, provided as a *JHT.
   void TearDownJoinHashTable(FunctionBuilder *function, ast::Expr *jht_ptr) const;
@@ -149,21 +174,47 @@ class HashJoinTranslator : public OperatorTranslator {
   // Fill the probe row with the columns from the given context.
   void FillProbeRow(WorkContext *ctx, FunctionBuilder *function, ast::Expr *probe_row) const;
 
+  // Fill the row with NULLs for all columns of the child at the given index.
+  void FillNullRow(FunctionBuilder *function, ast::Expr *row, uint32_t child_idx) const;
+
+  // Call joinConsumer with the given build and probe rows.
+  void CallJoinConsumer(FunctionBuilder *function, ast::Expr *build_row, ast::Expr *probe_row) const;
+
   // Input the tuple(s) in the provided context into the join hash table.
   void InsertIntoJoinHashTable(WorkContext *ctx, FunctionBuilder *function) const;
 
+  // Only for partitioned joins - input the tuple(s) in the provided context into the probe join
+  // hash table.
+  void InsertIntoProbeJoinHashTable(WorkContext *ctx, FunctionBuilder *function) const;
+
   // Probe the join hash table with the input tuple(s).
   void ProbeJoinHashTable(WorkContext *ctx, FunctionBuilder *function) const;
 
   // Check the right mark.
   void CheckRightMark(WorkContext *ctx, FunctionBuilder *function, ast::Identifier right_mark) const;
 
-  // Check the join predicate.
-  void CheckJoinPredicate(WorkContext *ctx, FunctionBuilder *function) const;
+  // Check the join predicate. If the probe row's matches are tracked, @em probe_matched is set
+  // on a match.
+  void CheckJoinPredicate(WorkContext *ctx, FunctionBuilder *function, ast::Expr *probe_matched) const;
+
+  // Only for right and full outer joins - output the probe row padded with NULLs.
+  void EmitUnmatchedProbeRow(FunctionBuilder *function) const;
 
-  // Only for left outer joins - iterate the hash table and output unmatched left rows
+  // Only for left and full outer joins - output the build row at the iterator's position, padded
+  // with NULLs, if it never found a match.
+  void EmitUnmatchedBuildRow(FunctionBuilder *function, ast::Expr *jht_iter) const;
+
+  // Only for left and full outer joins - iterate the hash table and output unmatched left rows
   void CollectUnmatchedLeftRows(FunctionBuilder *function) const;
 
+  // Only for left and full outer joins - generate the function that outputs the unmatched left
+  // rows of a morsel of the hash table in a parallel scan.
+  ast::FunctionDecl *GenerateUnmatchedLeftRowsScanFunction() const;
+
+  // Only for partitioned joins - generate the function that checks the join predicate on a pair of
+  // build and probe rows with equal hash values, and pushes them to the parent on a match.
+  ast::FunctionDecl *GeneratePartitionedJoinFunction();
+
   /** @return The struct that was declared, used for the minirunner. */
   ast::StructDecl *GetStructDecl() const { return struct_decl_; }
 
@@ -174,9 +225,13 @@ class HashJoinTranslator : public OperatorTranslator {
   ast::FunctionDecl *GenerateEndHookFunction() const;
 
  private:
-  // Flag to indicate whether or not we are in the joinConsumer function
+  // Flag to indicate whether or not we are in the joinConsumer function, or in the partitioned join
+  // function. Both read the probe side from the materialized probe row.
   bool join_consumer_flag_;
 
+  // Whether the probe side is materialized and joined with the build side partition by partition.
+  const bool partitioned_;
+
   // The name of the materialized row when inserting into join hash table.
   ast::Identifier build_row_var_;
   ast::Identifier build_row_type_;
@@ -190,6 +245,12 @@ class HashJoinTranslator : public OperatorTranslator {
   // The name of the function which encapuslates the join conumser
   ast::Identifier join_consumer_;
 
+  // The name of the function which outputs unmatched left rows in a parallel scan.
+  ast::Identifier unmatched_left_rows_scan_fn_;
+
+  // The name of the function invoked on pairs of rows in a partitioned join.
+  ast::Identifier partitioned_join_fn_;
+
   // The left build-side pipeline.
   Pipeline left_pipeline_;
 
@@ -198,6 +259,11 @@ class HashJoinTranslator : public OperatorTranslator {
   StateDescriptor::Entry global_join_ht_;
   StateDescriptor::Entry local_join_ht_;
 
+  // The slots in the global and thread-local state where a partitioned join materializes the probe
+  // side.
+  StateDescriptor::Entry global_probe_join_ht_;
+  StateDescriptor::Entry local_probe_join_ht_;
+
   // The number of rows that are inserted into the hash table.
   StateDescriptor::Entry num_build_rows_;
   // The number of probes that are performed.
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <unordered_map>
 #include <vector>
 
 #include "execution/compiler/operator/operator_translator.h"
@@ -20,7 +21,8 @@ namespace noisepage::execution::compiler {
 class FunctionBuilder;
 
 /**
- * A translator for sequential table scans.
+ * A translator for CREATE INDEX, which scans the table and stages the key of every tuple in the index, and then bulk
+ * loads the index. The scan is parallel unless disabled by the execution settings.
  */
 class IndexCreateTranslator : public OperatorTranslator, public PipelineDriver {
  public:
@@ -48,6 +50,14 @@ class IndexCreateTranslator : public OperatorTranslator, public PipelineDriver {
    */
   void TearDownQueryState(FunctionBuilder *function) const override{};
 
+  /**
+   * @param exec_settings The execution settings used for query compilation.
+   * @return True if parallel execution is enabled, or if parallel index builds are enabled on their own.
+   */
+  bool IsParallelExecutionEnabled(const exec::ExecutionSettings &exec_settings) const override {
+    return exec_settings.GetIsParallelQueryExecutionEnabled() || exec_settings.GetIsParallelIndexBuildEnabled();
+  }
+
   /**
    * Initilize a thread local storage interface and index pr, work for both serial and parallel
    * @param pipeline The current pipeline.
@@ -77,13 +87,23 @@ class IndexCreateTranslator : public OperatorTranslator, public PipelineDriver {
    */
   void PerformPipelineWork(WorkContext *context, FunctionBuilder *function) const override;
 
+  /**
+   * Bulk load the staged index entries after a parallel scan, unless the EndHook already did so.
+   * @param pipeline The current pipeline.
+   * @param function The pipeline generating function.
+   */
+  void FinishPipelineWork(const Pipeline &pipeline, FunctionBuilder *function) const override;
+
   /** @return This translator doesn't have a child */
   ast::Expr *GetChildOutput(WorkContext *context, uint32_t child_idx, uint32_t attr_idx) const override {
     UNREACHABLE("index create doesn't have child");
   };
 
-  /** @return Not implemented */
-  ast::Expr *GetTableColumn(catalog::col_oid_t col_oid) const override { UNREACHABLE("Not implemented"); };
+  /**
+   * @param col_oid The column to read.
+   * @return The value of the column in the tuple of the VPI that is currently scanned.
+   */
+  ast::Expr *GetTableColumn(catalog::col_oid_t col_oid) const override;
 
   /** @return a collection of parameters for the scan function */
   util::RegionVector<ast::FieldDecl *> GetWorkerParams() const override;
@@ -113,6 +133,8 @@ class IndexCreateTranslator : public OperatorTranslator, public PipelineDriver {
   // Generate a scan over the VPI.
   void ScanVPI(WorkContext *ctx, FunctionBuilder *function, ast::Expr *vpi) const;
   void IndexInsert(WorkContext *ctx, FunctionBuilder *function) const;
+  // Build the index from every entry that IndexInsert() staged.
+  void IndexBulkLoad(FunctionBuilder *function) const;
 
   std::vector<catalog::col_oid_t> AllColOids(const catalog::Schema &table_schema) const;
 
@@ -139,6 +161,8 @@ class IndexCreateTranslator : public OperatorTranslator, public PipelineDriver {
 
   // All the oids that we are inserting on.
   std::vector<catalog::col_oid_t> all_oids_;
+  // The offset of every oid in all_oids_, which is its offset in the VPI.
+  std::unordered_map<catalog::col_oid_t, uint16_t> oid_offset_;
 
   catalog::index_oid_t index_oid_;
 
@@ -21,8 +21,12 @@ class IndexJoinPlanNode;
 
 namespace noisepage::execution::compiler {
 
+class SeqScanTranslator;
+
 /**
- * Index join translator.
+ * Index join translator. When the outer child is a sequential scan and the join probes the index with exact keys, the
+ * pipeline is vectorized: the scan hands over whole vector projections, and the keys of all their tuples are probed at
+ * once through the batched index lookup, instead of one lookup per outer tuple.
  */
 class IndexJoinTranslator : public OperatorTranslator, public PipelineDriver {
  public:
@@ -64,6 +68,10 @@ class IndexJoinTranslator : public OperatorTranslator, public PipelineDriver {
   void SetOids(FunctionBuilder *builder) const;
   void FillKey(WorkContext *context, FunctionBuilder *builder, ast::Identifier pr,
                const std::unordered_map<catalog::indexkeycol_oid_t, planner::IndexExpression> &index_exprs) const;
+  // Join every outer tuple, with the result of its key in the iterator.
+  void JoinOuterTuple(WorkContext *context, FunctionBuilder *builder, ast::Expr *scan_call) const;
+  // Probe the index with the keys of the whole VPI of the outer scan at once, then join each outer tuple.
+  void PerformVectorizedWork(WorkContext *context, FunctionBuilder *builder) const;
   void FreeIterator(FunctionBuilder *builder) const;
   void DeclareIndexPR(FunctionBuilder *builder) const;
   void DeclareTablePR(FunctionBuilder *builder) const;
@@ -90,5 +98,8 @@ class IndexJoinTranslator : public OperatorTranslator, public PipelineDriver {
   StateDescriptor::Entry num_scans_index_;
   // The number of outer loop iterations.
   StateDescriptor::Entry num_loops_;
+
+  // For vectorized joins, the outer scan whose VPI is probed at once.
+  const SeqScanTranslator *vectorized_scan_{nullptr};
 };
 }  // namespace noisepage::execution::compiler
@@ -68,6 +68,7 @@ class IndexScanTranslator : public OperatorTranslator, public PipelineDriver {
   void FreeIterator(FunctionBuilder *builder) const;
   void DeclareIndexPR(FunctionBuilder *builder) const;
   void DeclareTablePR(FunctionBuilder *builder) const;
+  void DeclareKeyPR(FunctionBuilder *builder) const;
   void DeclareSlot(FunctionBuilder *builder) const;
 
  private:
@@ -76,6 +77,8 @@ class IndexScanTranslator : public OperatorTranslator, public PipelineDriver {
   storage::ProjectionMap table_pm_;
   const catalog::IndexSchema &index_schema_;
   const std::unordered_map<catalog::indexkeycol_oid_t, uint16_t> &index_pm_;
+  // For index-only scans, the offset of every scanned column in the projected row of the index key
+  std::unordered_map<catalog::col_oid_t, uint16_t> key_pm_;
 
   // Structs and local variables
   StateDescriptor::Entry index_iter_;
@@ -84,6 +87,7 @@ class IndexScanTranslator : public OperatorTranslator, public PipelineDriver {
   ast::Identifier lo_index_pr_;
   ast::Identifier hi_index_pr_;
   ast::Identifier table_pr_;
+  ast::Identifier key_pr_;
   ast::Identifier slot_;
 
   // The number of scans on the index that are performed.
@@ -59,6 +59,13 @@ class InsertTranslator : public OperatorTranslator, public PipelineDriver {
    */
   void PerformPipelineWork(WorkContext *context, FunctionBuilder *function) const override;
 
+  /**
+   * Insert the index entries that were staged by the pipeline.
+   * @param pipeline The current pipeline.
+   * @param function The pipeline generating function.
+   */
+  void FinishPipelineWork(const Pipeline &pipeline, FunctionBuilder *function) const override;
+
   /**
    * Implement main insertion logic
    * @param context The context of the work.
@@ -111,9 +118,12 @@ class InsertTranslator : public OperatorTranslator, public PipelineDriver {
   /** Insert into the table. */
   void GenTableInsert(FunctionBuilder *builder) const;
 
-  /** Insert into an index of this table. */
+  /** Stage an insert into an index of this table. */
   void GenIndexInsert(WorkContext *context, FunctionBuilder *builder, const catalog::index_oid_t &index_oid) const;
 
+  /** Insert the staged entries into the indexes of this table. */
+  void GenIndexFlushBatches(FunctionBuilder *builder) const;
+
   /** Gets all the column oids in a schema. */
   static std::vector<catalog::col_oid_t> AllColOids(const catalog::Schema &table_schema);
 
@@ -92,10 +92,14 @@ class SeqScanTranslator : public OperatorTranslator, public PipelineDriver {
   /** @return The expression representing the current VPI. */
   ast::Expr *GetVPI() const;
 
- private:
-  // Does the scan have a predicate?
+  /** @return The index of the given column OID inside the col_oids that the plan is scanning over. */
+  uint32_t GetColOidIndex(catalog::col_oid_t col_oid) const;
+
+  /** @return True if the scan has a predicate, which filters the current VPI. */
   bool HasPredicate() const;
 
+ private:
+
   // Get the OID of the table being scanned.
   catalog::table_oid_t GetTableOid() const;
 
@@ -126,9 +130,6 @@ class SeqScanTranslator : public OperatorTranslator, public PipelineDriver {
   static std::vector<catalog::col_oid_t> MakeInputOids(const catalog::Schema &schema,
                                                        const planner::SeqScanPlanNode &op);
 
-  /** @return The index of the given column OID inside the col_oids that the plan is scanning over. */
-  uint32_t GetColOidIndex(catalog::col_oid_t col_oid) const;
-
   StateDescriptor::Entry tvi_base_;        ///< The TVI is declared at pipeline setup/teardown.
   StateDescriptor::Entry tvi_needs_free_;  ///< If true, \@tableIterClose(&tviBase) needs to be called.
   ast::Identifier tvi_var_;                ///< If it exists, the name of the declared TVI. Holds a pointer to TVI base.
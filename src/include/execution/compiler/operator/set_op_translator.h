@@ -0,0 +1,172 @@
+#pragma once
+
+#include "execution/compiler/operator/operator_translator.h"
+#include "execution/compiler/pipeline.h"
+#include "execution/compiler/pipeline_driver.h"
+
+namespace noisepage::planner {
+class SetOpPlanNode;
+}  // namespace noisepage::planner
+
+namespace noisepage::execution::compiler {
+
+class FunctionBuilder;
+
+/**
+ * A translator for hash-based set operations: UNION, INTERSECT and EXCEPT, with or without ALL.
+ *
+ * Both inputs are materialized into one aggregation hash table keyed on the full row. Every row in the table tracks
+ * how many times it was seen on each side, and the final scan over the table decides how many copies of the row to
+ * emit. The left input is consumed first, so serial INTERSECT and EXCEPT only look up rows on the right side. In
+ * parallel mode, both sides build thread-local partitioned tables whose partitions are merged by the final
+ * partitioned scan, just like a parallel hash aggregation. UNION ALL never looks up a row: every input row gets its
+ * own entry and is emitted exactly once. This materialization is a fallback; streaming both inputs into the parent
+ * needs the parent's operators to be generated in two pipelines, which a translator cannot do yet.
+ */
+class SetOpTranslator : public OperatorTranslator, public PipelineDriver {
+ public:
+  /**
+   * Create a new translator for the given set operation plan.
+   * @param plan The plan.
+   * @param compilation_context The context of compilation this translation is occurring in.
+   * @param pipeline The pipeline this operator is participating in.
+   */
+  SetOpTranslator(const planner::SetOpPlanNode &plan, CompilationContext *compilation_context, Pipeline *pipeline);
+
+  /**
+   * Define the row structure stored in the hash table.
+   * @param decls Where the defined structure will be registered.
+   */
+  void DefineHelperStructs(util::RegionVector<ast::StructDecl *> *decls) override;
+
+  /**
+   * Define the key-check function and, if the build is partitioned, the partition-merging function.
+   * @param decls Where the defined functions will be registered.
+   */
+  void DefineHelperFunctions(util::RegionVector<ast::FunctionDecl *> *decls) override;
+
+  /**
+   * Initialize the global hash table.
+   */
+  void InitializeQueryState(FunctionBuilder *function) const override;
+
+  /**
+   * Destroy the global hash table.
+   */
+  void TearDownQueryState(FunctionBuilder *function) const override;
+
+  /**
+   * Initialize the thread-local hash table, if needed.
+   * @param pipeline Current pipeline.
+   * @param function The pipeline generating function.
+   */
+  void InitializePipelineState(const Pipeline &pipeline, FunctionBuilder *function) const override;
+
+  /**
+   * Tear-down and destroy the thread-local hash table, if needed.
+   * @param pipeline Current pipeline.
+   * @param function The pipeline generating function.
+   */
+  void TearDownPipelineState(const Pipeline &pipeline, FunctionBuilder *function) const override;
+
+  /**
+   * If the context pipeline is one of the two input pipelines, count the input row in the hash table. Otherwise, scan
+   * the hash table and emit every row as many times as the set operation requires.
+   * @param context The context.
+   * @param function The pipeline generating function.
+   */
+  void PerformPipelineWork(WorkContext *context, FunctionBuilder *function) const override;
+
+  /**
+   * If the build is partitioned, move the thread-local partitions of the finished input pipeline into the global hash
+   * table.
+   * @param pipeline Current pipeline.
+   * @param function The pipeline generating function.
+   */
+  void FinishPipelineWork(const Pipeline &pipeline, FunctionBuilder *function) const override;
+
+  /**
+   * We'll issue a parallel partitioned scan over the hash table. In this case, the last argument to the worker
+   * function will be the hash table partition we're scanning.
+   * @return The set of additional worker parameters.
+   */
+  util::RegionVector<ast::FieldDecl *> GetWorkerParams() const override;
+
+  /**
+   * If the build is partitioned, launch a parallel partitioned scan over the hash table.
+   * @param function The pipeline generating function.
+   * @param work_func_name The name of the worker function to invoke.
+   */
+  void LaunchWork(FunctionBuilder *function, ast::Identifier work_func_name) const override;
+
+  /**
+   * @return The value (vector) of the attribute at the given index (@em attr_idx) produced by the
+   *         child at the given index (@em child_idx).
+   */
+  ast::Expr *GetChildOutput(WorkContext *context, uint32_t child_idx, uint32_t attr_idx) const override;
+
+  /**
+   * Set operations do not produce columns from base tables.
+   */
+  ast::Expr *GetTableColumn(catalog::col_oid_t col_oid) const override {
+    UNREACHABLE("Set operations do not produce columns from base tables.");
+  }
+
+ private:
+  // Access the plan.
+  const planner::SetOpPlanNode &GetSetOpPlan() const { return GetPlanAs<planner::SetOpPlanNode>(); }
+
+  // Check if the input pipeline is either one of the input sides or the producer side.
+  bool IsLeftPipeline(const Pipeline &pipeline) const { return &left_pipeline_ == &pipeline; }
+  bool IsRightPipeline(const Pipeline &pipeline) const { return &right_pipeline_ == &pipeline; }
+  bool IsProducePipeline(const Pipeline &pipeline) const { return GetPipeline() == &pipeline; }
+
+  // True if the set operation is UNION ALL.
+  bool IsUnionAll() const;
+  // True if the rows track how many times they were seen on each side. Only INTERSECT and EXCEPT need the counts.
+  bool TracksCounts() const;
+
+  // Declare the row structure. Called from DefineHelperStructs().
+  ast::StructDecl *GenerateRowStruct();
+
+  // Generate the key-check function and the overflow partition merging function.
+  ast::FunctionDecl *GenerateKeyCheckFunction();
+  ast::FunctionDecl *GenerateMergeOverflowPartitionsFunction();
+  void MergeOverflowPartitions(FunctionBuilder *function, ast::Expr *set_op_ht, ast::Expr *iter);
+
+  // Access an attribute or one of the side counts in the provided row.
+  ast::Expr *GetRowAttribute(ast::Identifier row, uint32_t attr_idx) const;
+  ast::Expr *GetRowCount(ast::Identifier row, bool left) const;
+
+  // Count the current input row of the given pipeline in the provided hash table.
+  void InsertInputRow(WorkContext *context, FunctionBuilder *function, ast::Expr *set_op_ht) const;
+
+  // Emit the current row of the hash table as many times as the set operation requires.
+  void EmitRow(WorkContext *context, FunctionBuilder *function) const;
+
+  // Scan the final hash table.
+  void ScanHashTable(WorkContext *context, FunctionBuilder *function, ast::Expr *set_op_ht) const;
+
+ private:
+  // The name of the variable used to read from an iterator when iterating over all rows.
+  ast::Identifier row_var_;
+  // The name of the row struct.
+  ast::Identifier row_type_;
+  // The names of the key-check function and the overflow partition merging function.
+  ast::Identifier key_check_fn_;
+  ast::Identifier merge_partitions_fn_;
+
+  // The pipelines reading the left and right inputs.
+  Pipeline left_pipeline_;
+  Pipeline right_pipeline_;
+
+  // Whether both inputs build thread-local partitioned tables. If either input is parallel, both are partitioned.
+  bool partitioned_;
+
+  // The global hash table and the thread-local hash tables of each input pipeline.
+  StateDescriptor::Entry global_ht_;
+  StateDescriptor::Entry left_local_ht_;
+  StateDescriptor::Entry right_local_ht_;
+};
+
+}  // namespace noisepage::execution::compiler
@@ -15,9 +15,14 @@ class AggregatePlanNode;
 namespace noisepage::execution::compiler {
 
 class FunctionBuilder;
+class SeqScanTranslator;
 
 /**
  * A translator for static aggregations.
+ *
+ * When the input comes straight from a sequential scan and every aggregate is a COUNT(*), or a non-distinct COUNT,
+ * SUM, MIN, MAX or AVG of a numeric column of the scanned table, the build pipeline is vectorized: the aggregates are
+ * advanced once per vector projection of the scan, using vectorized kernels, instead of once per tuple.
  */
 class StaticAggregationTranslator : public OperatorTranslator, public PipelineDriver {
  public:
@@ -128,6 +133,13 @@ class StaticAggregationTranslator : public OperatorTranslator, public PipelineDr
 
   void UpdateGlobalAggregate(WorkContext *ctx, FunctionBuilder *function) const;
 
+  // Check if the aggregates can be advanced one vector projection of the child scan at a time. If so, record the scan
+  // and the index of the input column of every aggregate in the scanned vector projections.
+  bool PrepareVectorizedAggregation();
+
+  // Advance the aggregates by the current vector projection of the child scan.
+  void UpdateGlobalAggregateVectorized(FunctionBuilder *function) const;
+
   // For minirunners.
   ast::StructDecl *GetStructDecl() const { return struct_decl_; }
 
@@ -153,6 +165,12 @@ class StaticAggregationTranslator : public OperatorTranslator, public PipelineDr
 
   // For distinct aggregations
   std::unordered_map<size_t, DistinctAggregationFilter> distinct_filters_;
+
+  // For vectorized aggregations, the child scan and the index of the input column of every aggregate in its vector
+  // projections. COUNT(*) has no input column.
+  const SeqScanTranslator *vectorized_scan_{nullptr};
+  std::vector<uint32_t> vectorized_col_idxs_;
+
   // The number of input rows to the aggregation.
   StateDescriptor::Entry num_agg_inputs_;
 
@@ -56,7 +56,7 @@ class UpdateTranslator : public OperatorTranslator, public PipelineDriver {
   /** Tear down the storage interface. */
   void TearDownPipelineState(const Pipeline &pipeline, FunctionBuilder *function) const override;
 
-  /** Record the counters for Lin's models. */
+  /** Apply the index entries that were staged by the pipeline, and record the counters for Lin's models. */
   void FinishPipelineWork(const Pipeline &pipeline, FunctionBuilder *function) const override;
 
   /**
@@ -103,13 +103,16 @@ class UpdateTranslator : public OperatorTranslator, public PipelineDriver {
   // Inserts this projected row into the table (used for indexed updates).
   void GenTableInsert(FunctionBuilder *builder) const;
 
-  // Inserts into all indexes.
+  // Stages an insert into an index.
   void GenIndexInsert(WorkContext *context, FunctionBuilder *builder, const catalog::index_oid_t &index_oid) const;
 
+  // Applies the staged index inserts and deletes.
+  void GenIndexFlushBatches(FunctionBuilder *builder) const;
+
   // Deletes from the table (used for indexed updates).
   void GenTableDelete(FunctionBuilder *builder) const;
 
-  // Deletes from all indexes.
+  // Stages a delete from an index.
   void GenIndexDelete(FunctionBuilder *builder, WorkContext *context, const catalog::index_oid_t &index_oid) const;
 
   static std::vector<catalog::col_oid_t> CollectOids(const catalog::Schema &schema);
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <vector>
+
+#include "execution/compiler/operator/operator_translator.h"
+#include "execution/compiler/pipeline.h"
+#include "execution/compiler/pipeline_driver.h"
+
+namespace noisepage::planner {
+class WindowPlanNode;
+}  // namespace noisepage::planner
+
+namespace noisepage::execution::compiler {
+
+class FunctionBuilder;
+
+/**
+ * A translator for window plans.
+ *
+ * The build pipeline materializes every input row into a sorter, ordered by the partition keys followed by the sort
+ * keys, so that the rows of a partition are contiguous and in window order. In parallel mode, every thread sorts its
+ * own rows and the runs are merged by the sorter's parallel sort. The produce pipeline walks the sorted rows one
+ * partition at a time: a look-ahead iterator finds the end of the partition while appending the arguments of the
+ * aggregate window functions to one segment tree per function, and the main iterator then emits every row of the
+ * partition. Ranking functions are computed from the peers of the row, and every aggregate over a frame is a
+ * logarithmic range query on its segment tree. In parallel mode, the sorted rows are split into ranges of whole
+ * partitions that are scanned by concurrent tasks, each with its own segment trees in the thread-local pipeline state.
+ */
+class WindowTranslator : public OperatorTranslator, public PipelineDriver {
+ public:
+  /**
+   * Create a translator for the given window plan node.
+   * @param plan The plan.
+   * @param compilation_context The context this translator belongs to.
+   * @param pipeline The pipeline this translator is participating in.
+   */
+  WindowTranslator(const planner::WindowPlanNode &plan, CompilationContext *compilation_context, Pipeline *pipeline);
+
+  /**
+   * Define the row structure that's materialized in the sorter.
+   * @param decls The top-level declarations.
+   */
+  void DefineHelperStructs(util::RegionVector<ast::StructDecl *> *decls) override;
+
+  /**
+   * Define the sorting function and the functions that check whether two rows are in the same partition or are peers.
+   * @param decls The top-level declarations.
+   */
+  void DefineHelperFunctions(util::RegionVector<ast::FunctionDecl *> *decls) override;
+
+  /**
+   * Initialize the sorter instance.
+   */
+  void InitializeQueryState(FunctionBuilder *function) const override;
+
+  /**
+   * Tear-down the sorter instance.
+   */
+  void TearDownQueryState(FunctionBuilder *function) const override;
+
+  /**
+   * If the given pipeline is the parallel build pipeline, initialize the thread-local sorter. If it is the produce
+   * pipeline, initialize the segment trees.
+   * @param pipeline The current pipeline.
+   * @param function The pipeline generating function.
+   */
+  void InitializePipelineState(const Pipeline &pipeline, FunctionBuilder *function) const override;
+
+  /**
+   * If the given pipeline is the parallel build pipeline, destroy the thread-local sorter. If it is the produce
+   * pipeline, destroy the segment trees.
+   * @param pipeline The current pipeline.
+   * @param function The pipeline generating function.
+   */
+  void TearDownPipelineState(const Pipeline &pipeline, FunctionBuilder *function) const override;
+
+  /**
+   * Implement either the build-side or the produce-side of the window depending on the pipeline this context
+   * contains.
+   * @param ctx The context of the work.
+   * @param function The pipeline function generator.
+   */
+  void PerformPipelineWork(WorkContext *ctx, FunctionBuilder *function) const override;
+
+  /**
+   * If the given pipeline is the build pipeline, sort the rows, in parallel if the pipeline is parallel.
+   * @param pipeline The current pipeline.
+   * @param function The pipeline generating function.
+   */
+  void FinishPipelineWork(const Pipeline &pipeline, FunctionBuilder *function) const override;
+
+  /**
+   * @return The iterators over a range of partitions passed to the parallel produce function.
+   */
+  util::RegionVector<ast::FieldDecl *> GetWorkerParams() const override;
+
+  /**
+   * Launch a parallel scan of the partitions of the sorted rows.
+   * @param function The pipeline generating function.
+   * @param work_func_name The name of the function scanning a range of partitions.
+   */
+  void LaunchWork(FunctionBuilder *function, ast::Identifier work_func_name) const override;
+
+  /**
+   * @return The value (vector) of the attribute at the given index (@em attr_idx) produced by the
+   *         child at the given index (@em child_idx). In the produce pipeline, a child index of 1 refers to the value
+   *         of the window function at the given index.
+   */
+  ast::Expr *GetChildOutput(WorkContext *context, uint32_t child_idx, uint32_t attr_idx) const override;
+
+  /**
+   * Window operators do not produce columns from base tables.
+   */
+  ast::Expr *GetTableColumn(catalog::col_oid_t col_oid) const override {
+    UNREACHABLE("Window operators do not produce columns from base tables");
+  }
+
+ private:
+  // Access the plan.
+  const planner::WindowPlanNode &GetWindowPlan() const { return GetPlanAs<planner::WindowPlanNode>(); }
+
+  // Check if the given pipelines are build or produce.
+  bool IsBuildPipeline(const Pipeline &pipeline) const { return &build_pipeline_ == &pipeline; }
+  bool IsProducePipeline(const Pipeline &pipeline) const { return GetPipeline() == &pipeline; }
+
+  // True if the window function at the given index is evaluated with a segment tree.
+  bool UsesSegmentTree(uint32_t func_idx) const;
+  // True if the aggregate of the window function at the given index is a SQL real.
+  bool HasRealResult(uint32_t func_idx) const;
+
+  // Access a field of the provided window row.
+  ast::Expr *GetRowField(ast::Identifier row, const char *prefix, uint32_t idx) const;
+
+  // Generate the comparison function and the partition and peer equality functions.
+  ast::FunctionDecl *GenerateComparisonFunction();
+  ast::FunctionDecl *GenerateEqualityFunction(ast::Identifier name, bool partition_keys);
+
+  // Insert the tuple in the context into the provided sorter.
+  void InsertIntoSorter(WorkContext *ctx, FunctionBuilder *function, ast::Expr *sorter_ptr) const;
+
+  // Read the next partition with the look-ahead iterator, filling the segment trees, and declare its size.
+  void ReadPartition(FunctionBuilder *function, ast::Expr *peek_iter, ast::Identifier part_first,
+                     ast::Identifier part_size) const;
+
+  // Compute the window functions of the current row and push it to the next operator.
+  void EmitPartition(WorkContext *ctx, FunctionBuilder *function, ast::Expr *iter, ast::Identifier part_first,
+                     ast::Identifier part_size) const;
+
+  // Called to scan the global sorter instance, or the worker's range of it, one partition at a time.
+  void ScanPartitions(WorkContext *ctx, FunctionBuilder *function) const;
+
+ private:
+  // The name of the window row when inserting into the sorter or reading from an iterator.
+  ast::Identifier row_var_;
+  ast::Identifier row_type_;
+  ast::Identifier lhs_row_, rhs_row_;
+  ast::Identifier compare_func_;
+  ast::Identifier same_partition_func_;
+  ast::Identifier same_peers_func_;
+
+  // The names of the variables holding the window function values of the current row.
+  std::vector<ast::Identifier> window_vars_;
+
+  // Build-side pipeline.
+  Pipeline build_pipeline_;
+
+  // Where the global and thread-local sorter instances are.
+  StateDescriptor::Entry global_sorter_;
+  StateDescriptor::Entry local_sorter_;
+
+  // The segment tree of every window function, in the produce pipeline's state. Ranking functions and COUNT(*) need no
+  // tree, so their entries are left empty.
+  std::vector<StateDescriptor::Entry> segment_trees_;
+};
+
+}  // namespace noisepage::execution::compiler
@@ -94,6 +94,23 @@ class Pipeline {
    */
   void SetParallelCheck(bool check);
 
+  /**
+   * Update the vectorization of this pipeline. The operators of a vectorized pipeline are handed whole vector
+   * projections rather than single tuples, so only enable it when every operator in the pipeline supports it.
+   * @param vectorization The desired vectorization.
+   */
+  void UpdateVectorization(Vectorization vectorization);
+
+  /**
+   * Defer the parallel end-of-work logic of every operator after the provided one until the provided operator has
+   * finished its pipeline work. The deferred logic runs once for each thread state, after the provided operator's
+   * FinishPipelineWork(). This lets an operator emit tuples from FinishPipelineWork() in parallel, e.g., the build
+   * rows an outer hash join never matched, before the operators above it end their work. If several operators defer,
+   * the logic of every operator after the first of them runs after the last of them has finished.
+   * @param op The operator whose FinishPipelineWork() still emits tuples into the pipeline.
+   */
+  void DeferEndParallelPipelineWork(const OperatorTranslator *op);
+
   /**
    * Register an expression in this pipeline. This expression may or may not create/destroy state.
    * @param expression The expression to register.
@@ -143,7 +160,7 @@ class Pipeline {
   /**
    * @return True if this pipeline is fully vectorized; false otherwise.
    */
-  bool IsVectorized() const { return false; }
+  bool IsVectorized() const { return vectorization_ == Vectorization::Enabled; }
 
   /**
    * Typedef used to specify an iterator over the steps in a pipeline.
@@ -214,6 +231,13 @@ class Pipeline {
   ast::Identifier GetSetupPipelineStateFunctionName() const;
   ast::Identifier GetTearDownPipelineStateFunctionName() const;
   ast::Identifier GetWorkFunctionName() const;
+  ast::Identifier GetDeferredEndWorkFunctionName() const;
+
+  // Return true if the parallel end-of-work logic of the given operator is deferred.
+  bool IsEndParallelPipelineWorkDeferred(const OperatorTranslator *op) const;
+
+  // Return the last operator, in pipeline order, that deferred the parallel end-of-work logic.
+  const OperatorTranslator *GetLastDeferringOperator() const;
 
   // Generate the pipeline state initialization logic.
   ast::FunctionDecl *GenerateSetupPipelineStateFunction() const;
@@ -227,6 +251,9 @@ class Pipeline {
   // Generate the main pipeline work function.
   ast::FunctionDecl *GeneratePipelineWorkFunction() const;
 
+  // Generate the deferred end-of-work logic run on each thread state.
+  ast::FunctionDecl *GenerateDeferredEndWorkFunction() const;
+
   // Generate the main pipeline logic.
   ast::FunctionDecl *GenerateRunPipelineFunction() const;
 
@@ -258,6 +285,10 @@ class Pipeline {
   Parallelism parallelism_;
   // Whether to check for parallelism in new pipeline elements.
   bool check_parallelism_;
+  // Configured vectorization.
+  Vectorization vectorization_;
+  // The operators the parallel end-of-work logic of all later operators waits for, if any.
+  std::vector<const OperatorTranslator *> deferred_end_ops_;
   // All pipelines this one depends on completion of.
   std::vector<Pipeline *> dependencies_;
   // Cache of common identifiers.
@@ -2,6 +2,7 @@
 
 #include "execution/ast/identifier.h"
 #include "execution/compiler/ast_fwd.h"
+#include "execution/exec/execution_settings.h"
 #include "execution/util/region_containers.h"
 
 namespace noisepage::execution::compiler {
@@ -32,6 +33,14 @@ class PipelineDriver {
    * @param work_func_name The name of the work function that implements the pipeline logic.
    */
   virtual void LaunchWork(FunctionBuilder *function, ast::Identifier work_func_name) const = 0;
+
+  /**
+   * @param exec_settings The execution settings used for query compilation.
+   * @return True if the execution settings allow the pipeline of this driver to run in parallel.
+   */
+  virtual bool IsParallelExecutionEnabled(const exec::ExecutionSettings &exec_settings) const {
+    return exec_settings.GetIsParallelQueryExecutionEnabled();
+  }
 };
 
 }  // namespace noisepage::execution::compiler
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <thread>  // NOLINT
 #include <utility>
 
 #include "common/constants.h"
@@ -91,6 +93,15 @@ class EXPORT ExecutionSettings {
   /** @return number of threads used for parallel execution. */
   int GetNumberOfParallelExecutionThreads() const { return number_of_parallel_execution_threads_; }
 
+  /** @return True if CREATE INDEX scans the table in parallel, regardless of GetIsParallelQueryExecutionEnabled(). */
+  bool GetIsParallelIndexBuildEnabled() const { return is_parallel_index_build_enabled_; }
+
+  /** @return number of threads that scan the table for CREATE INDEX, one per hardware thread unless configured. */
+  int GetNumberOfIndexBuildThreads() const {
+    if (number_of_index_build_threads_ > 0) return number_of_index_build_threads_;
+    return std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+  }
+
   /** @return True if static partitioner is enabled. */
   constexpr bool GetIsStaticPartitionerEnabled() const { return is_static_partitioner_enabled_; }
 
@@ -103,6 +114,8 @@ class EXPORT ExecutionSettings {
   bool is_counters_enabled_{common::Constants::IS_COUNTERS_ENABLED};
   bool is_pipeline_metrics_enabled_{common::Constants::IS_PIPELINE_METRICS_ENABLED};
   int number_of_parallel_execution_threads_{common::Constants::NUM_PARALLEL_EXECUTION_THREADS};
+  bool is_parallel_index_build_enabled_{common::Constants::IS_PARALLEL_INDEX_BUILD_ENABLED};
+  int number_of_index_build_threads_{common::Constants::NUM_INDEX_BUILD_THREADS};
   bool is_static_partitioner_enabled_{common::Constants::IS_STATIC_PARTITIONER_ENABLED};
   compiler::CompilerSettings compiler_settings_{};  ///< The settings for compiling the TPL input.
 
@@ -81,6 +81,10 @@ namespace sema {
     "hook function must have type (*QueryState, *TLS, *)->nil, "                                                      \
     "received '%0'",                                                                                                  \
     (ast::Type *))                                                                                                    \
+  F(BadJoinFunction,                                                                                                  \
+    "join function must have type (*QueryState, *TLS, *BuildRow, *ProbeRow)->nil, "                                   \
+    "received '%0'",                                                                                                  \
+    (ast::Type *))                                                                                                    \
   F(BadKeyEqualityCheckFunctionForJoinTableLookup,                                                                    \
     "key equality check function must have type: (*,*,*)->bool, received '%0'", (ast::Type *))                        \
   F(BadArgToIndexIteratorInit,                                                                                        \
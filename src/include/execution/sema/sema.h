@@ -118,6 +118,7 @@ class Sema : public ast::AstVisitor<Sema> {
   void CheckSqlConversionCall(ast::CallExpr *call, ast::Builtin builtin);
   void CheckNullValueCall(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinStringLikeCall(ast::CallExpr *call);
+  void CheckBuiltinLikePatternCall(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinDateFunctionCall(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinAggHashTableCall(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinAggHashTableIterCall(ast::CallExpr *call, ast::Builtin builtin);
@@ -127,7 +128,9 @@ class Sema : public ast::AstVisitor<Sema> {
   void CheckBuiltinJoinHashTableInsert(ast::CallExpr *call);
   void CheckBuiltinJoinHashTableGetTupleCount(ast::CallExpr *call);
   void CheckBuiltinJoinHashTableBuild(ast::CallExpr *call, ast::Builtin builtin);
+  void CheckBuiltinJoinHashTableBuildAndJoin(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinJoinHashTableLookup(ast::CallExpr *call);
+  void CheckBuiltinJoinHashTableParallelScan(ast::CallExpr *call);
   void CheckBuiltinJoinHashTableFree(ast::CallExpr *call);
   void CheckBuiltinHashTableEntryIterCall(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinJoinHashTableIterCall(ast::CallExpr *call, ast::Builtin builtin);
@@ -135,8 +138,10 @@ class Sema : public ast::AstVisitor<Sema> {
   void CheckBuiltinSorterGetTupleCount(ast::CallExpr *call);
   void CheckBuiltinSorterInsert(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinSorterSort(ast::CallExpr *call, ast::Builtin builtin);
+  void CheckBuiltinSorterScanPartitionsParallel(ast::CallExpr *call);
   void CheckBuiltinSorterFree(ast::CallExpr *call);
   void CheckBuiltinSorterIterCall(ast::CallExpr *call, ast::Builtin builtin);
+  void CheckBuiltinSegmentTreeCall(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinExecutionContextCall(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinExecOUFeatureVectorCall(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinThreadStateContainerCall(ast::CallExpr *call, ast::Builtin builtin);
@@ -148,6 +153,8 @@ class Sema : public ast::AstVisitor<Sema> {
   void CheckBuiltinPtrCastCall(ast::CallExpr *call);
   void CheckBuiltinTableIterCall(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinTableIterParCall(ast::CallExpr *call);
+  void CheckBuiltinCSVScanCall(ast::CallExpr *call, ast::Builtin builtin);
+  void CheckBuiltinCSVScanParCall(ast::CallExpr *call);
   void CheckBuiltinVPICall(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinFilterManagerCall(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinVectorFilterCall(ast::CallExpr *call);
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "catalog/schema.h"
+#include "common/constants.h"
 #include "common/managed_pointer.h"
 #include "execution/sql/chaining_hash_table.h"
 #include "execution/sql/memory_pool.h"
@@ -64,6 +65,18 @@ class EXPORT AggregationHashTable {
   /** The default precision used to configure the HyperLogLog instances. Set to optimize accuracy and space manually. */
   static constexpr uint32_t DEFAULT_HLL_PRECISION = 10;
 
+  /**
+   * The minimum reduction factor, i.e., the number of input tuples per group, that the main table must achieve when
+   * pre-aggregating batches in partitioned mode. Below it, input batches bypass the table.
+   */
+  static constexpr const float MIN_PREAGGREGATION_REDUCTION = 1.5f;
+
+  /** The number of batches that bypass pre-aggregation before the main table is tried again. */
+  static constexpr uint32_t NUM_BYPASS_BATCHES = 64;
+
+  /** The number of tuples inserted one at a time that bypass pre-aggregation before the main table is tried again. */
+  static constexpr uint64_t NUM_BYPASS_TUPLES = uint64_t{NUM_BYPASS_BATCHES} * common::Constants::K_DEFAULT_VECTOR_SIZE;
+
   // -------------------------------------------------------
   // Callback functions to customize aggregations
   // -------------------------------------------------------
@@ -114,6 +127,8 @@ class EXPORT AggregationHashTable {
     uint64_t num_flushes_ = 0;
     /** Number of times that the hash table has been inserted into. */
     uint64_t num_inserts_ = 0;
+    /** Number of tuples that bypassed pre-aggregation straight into the overflow partitions. */
+    uint64_t num_bypassed_ = 0;
   };
 
   // -------------------------------------------------------
@@ -161,6 +176,13 @@ class EXPORT AggregationHashTable {
 
   /**
    * Insert a new element with hash value @em hash into this partitioned aggregation hash table.
+   *
+   * This is the tuple-at-a-time counterpart of ProcessBatch() in partitioned mode, and adapts in the same way: the
+   * reduction achieved by the main table is measured at every flush against the number of lookups since the previous
+   * one. If it is too low, the next tuples bypass the table: each new element is linked directly into its overflow
+   * partition, so subsequent lookups for its key miss and create another partial aggregate that the partition merge
+   * combines.
+   *
    * @param hash The hash value of the element to insert.
    * @return A pointer to a memory area where the input element can be written.
    */
@@ -185,6 +207,13 @@ class EXPORT AggregationHashTable {
 
   /**
    * Ingest and process a batch of input into the aggregation table.
+   *
+   * In partitioned mode, the main table is a cache-sized pre-aggregation table that is flushed into the overflow
+   * partitions whenever it fills up. At every flush, the table checks how much it reduced its input. If the group keys
+   * are close to unique, pre-aggregation only adds a lookup to every tuple, so the next batches bypass the table: every
+   * tuple becomes its own partial aggregate linked directly into the overflow partitions, where the partition merge
+   * combines them. After a number of batches, the table is tried again in case the input has changed.
+   *
    * @param input_batch The vector projection to process.
    * @param key_indexes The ordered list of key indexes in the input batch.
    * @param init_agg_fn Function to initialize a new aggregate.
@@ -306,9 +335,17 @@ class EXPORT AggregationHashTable {
   // partitions.
   void FlushToOverflowPartitions();
 
+  // Flush the full pre-aggregation table into the overflow partitions. Returns
+  // true if it didn't absorb enough of its input since the last flush to pay
+  // for the lookups, in which case the upcoming input should bypass it.
+  bool FlushPreAggregationTable();
+
   // Allocate all overflow partition information if unallocated
   void AllocateOverflowPartitions();
 
+  // Link the given entry into the overflow partition selected by its hash.
+  void LinkIntoOverflowPartition(HashTableEntry *entry);
+
   // Called from ProcessBatch() to compute hash values for tuples in batch.
   void ComputeHash(VectorProjectionIterator *input_batch, const std::vector<uint32_t> &key_indexes);
 
@@ -334,6 +371,11 @@ class EXPORT AggregationHashTable {
   // found matching group.
   void AdvanceGroups(VectorProjectionIterator *input_batch, VectorAdvanceAggFn advance_agg_fn);
 
+  // Called from ProcessBatch() in partitioned mode to turn every tuple in the
+  // batch into its own aggregate, linked directly into the overflow partitions.
+  void BypassBatch(VectorProjectionIterator *input_batch, VectorInitAggFn init_agg_fn,
+                   VectorAdvanceAggFn advance_agg_fn);
+
   // Called during partitioned (parallel) scan to build an aggregation hash
   // table over a single partition.
   AggregationHashTable *GetOrBuildTableOverPartition(void *query_state, uint32_t partition_idx);
@@ -427,6 +469,13 @@ class EXPORT AggregationHashTable {
   // The number of bits to shift the hash value to determine the overflow
   // partition an entry is linked into.
   uint64_t partition_shift_bits_;
+  // The number of input tuples pre-aggregated into the main table since it was
+  // last flushed in partitioned mode, either in batches or one lookup at a
+  // time, and the number of upcoming batches or tuple insertions that bypass
+  // the main table.
+  uint64_t num_preaggregated_tuples_;
+  uint32_t num_bypass_batches_left_;
+  uint64_t num_bypass_tuples_left_;
 
   // Runtime stats.
   Stats stats_;
@@ -453,6 +502,9 @@ inline HashTableEntry *AggregationHashTable::LookupEntryInternal(hash_t hash, Ag
 
 inline byte *AggregationHashTable::Lookup(hash_t hash, AggregationHashTable::KeyEqFn key_eq_fn,
                                           const void *probe_tuple) {
+  // Every tuple-at-a-time input is looked up once, so this counts the input
+  // that AllocInputTuplePartitioned() measures the table's reduction against.
+  num_preaggregated_tuples_++;
   auto *entry = LookupEntryInternal(hash, key_eq_fn, probe_tuple);
   return (entry == nullptr ? nullptr : entry->payload_);
 }
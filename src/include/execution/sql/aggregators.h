@@ -6,6 +6,8 @@
 #include "common/macros.h"
 #include "execution/exec/execution_context.h"
 #include "execution/sql/value.h"
+#include "execution/sql/vector.h"
+#include "execution/sql/vector_operations/vector_operations.h"
 #include "optimizer/statistics/histogram.h"
 #include "optimizer/statistics/top_k_elements.h"
 
@@ -29,6 +31,16 @@ class CountAggregate {
    */
   void Advance(const Val &val) { count_ += static_cast<uint64_t>(!val.is_null_); }
 
+  /**
+   * Advance the count by the number of active, non-NULL elements in the input vector @em input.
+   */
+  void AdvanceVector(const Vector &input) { count_ += VectorOps::Count(input); }
+
+  /**
+   * Advance the count by @em num_values non-NULL values, e.g., the tuples of a whole vector for COUNT(*).
+   */
+  void AdvanceVector(uint64_t num_values) { count_ += num_values; }
+
   /**
    * Merge this count with the @em that count.
    */
@@ -66,6 +78,11 @@ class CountStarAggregate {
    */
   void Advance(UNUSED_ATTRIBUTE const Val &val) { count_++; }
 
+  /**
+   * Advance the count by a whole vector of @em num_tuples tuples.
+   */
+  void AdvanceVector(uint64_t num_tuples) { count_ += num_tuples; }
+
   /**
    * Merge this count with the @em that count.
    */
@@ -114,6 +131,20 @@ class SumAggregate {
     sum_.val_ += val.val_;
   }
 
+  /**
+   * Advance the aggregate by the active, non-NULL elements of the input vector @em input.
+   * If every element is NULL, no change is applied to the aggregate.
+   * @param input The vector of values to advance the sum by.
+   */
+  void AdvanceVector(const Vector &input) {
+    decltype(T::val_) sum;
+    if (VectorOps::Sum(input, &sum) == 0) {
+      return;
+    }
+    sum_.is_null_ = false;
+    sum_.val_ += sum;
+  }
+
   /**
    * Merge a partial sum aggregate into this aggregate.
    * If the partial sum is NULL, no change is applied to this aggregate.
@@ -183,6 +214,18 @@ class MaxAggregate {
     max_.is_null_ = false;
   }
 
+  /**
+   * Advance the aggregate by the active, non-NULL elements of the input vector @em input.
+   */
+  void AdvanceVector(const Vector &input) {
+    decltype(T::val_) max;
+    if (VectorOps::Max(input, &max) == 0) {
+      return;
+    }
+    max_.val_ = max_.is_null_ ? max : std::max(max, max_.val_);
+    max_.is_null_ = false;
+  }
+
   /**
    * Merge a partial max aggregate into this aggregate.
    */
@@ -263,6 +306,18 @@ class MinAggregate {
     min_.is_null_ = false;
   }
 
+  /**
+   * Advance the aggregate by the active, non-NULL elements of the input vector @em input.
+   */
+  void AdvanceVector(const Vector &input) {
+    decltype(T::val_) min;
+    if (VectorOps::Min(input, &min) == 0) {
+      return;
+    }
+    min_.val_ = min_.is_null_ ? min : std::min(min, min_.val_);
+    min_.is_null_ = false;
+  }
+
   /**
    * Merge a partial min aggregate into this aggregate.
    */
@@ -336,6 +391,25 @@ class AvgAggregate {
     count_++;
   }
 
+  /**
+   * Advance the aggregate by the active, non-NULL elements of the numeric input vector @em input.
+   */
+  void AdvanceVector(const Vector &input) {
+    if (IsTypeFloatingPoint(input.GetTypeId())) {
+      double sum;
+      if (const uint64_t count = VectorOps::Sum(input, &sum); count != 0) {
+        sum_ += sum;
+        count_ += count;
+      }
+    } else {
+      int64_t sum;
+      if (const uint64_t count = VectorOps::Sum(input, &sum); count != 0) {
+        sum_ += static_cast<double>(sum);
+        count_ += count;
+      }
+    }
+  }
+
   /**
    * Merge a partial average aggregate into this aggregate.
    */
@@ -310,6 +310,19 @@ class ChainingHashTable : public ChainingHashTableBase {
   template <bool Concurrent, typename Allocator>
   void InsertBatch(util::ChunkedVector<Allocator> *entries);
 
+  /**
+   * Insert the entries in the range [begin, end) of the given vector. All entries must have their
+   * hash values already computed. Ranges can be inserted concurrently without any synchronization
+   * as long as no two ranges have entries that land in the same bucket, e.g., if the entries were
+   * partitioned by the bucket they land in.
+   * @tparam Allocator The allocator the vector uses. Templated to allow different vectors.
+   * @param entries The list of entries.
+   * @param begin The index of the first entry to insert.
+   * @param end The index one past the last entry to insert.
+   */
+  template <typename Allocator>
+  void InsertRange(util::ChunkedVector<Allocator> *entries, uint64_t begin, uint64_t end);
+
   /**
    * Return the head of the bucket chain for a key with the provided hash value. Probing assumes no
    * concurrent modifications to the hash table. Thus, is suitable for WORM based workloads.
@@ -404,6 +417,23 @@ inline void ChainingHashTable<UseTags>::InsertBatch(util::ChunkedVector<Allocato
   AddElementCount(entries->size());
 }
 
+template <bool UseTags>
+template <typename Allocator>
+inline void ChainingHashTable<UseTags>::InsertRange(util::ChunkedVector<Allocator> *entries, const uint64_t begin,
+                                                   const uint64_t end) {
+  for (uint64_t idx = begin; idx < end; idx++) {
+    auto *entry = reinterpret_cast<HashTableEntry *>((*entries)[idx]);
+    if constexpr (UseTags) {  // NOLINT
+      InsertTagged<false>(entry, entry->hash_);
+    } else {
+      InsertUntagged<false>(entry, entry->hash_);
+    }
+  }
+
+  // Update element count.
+  AddElementCount(end - begin);
+}
+
 template <bool UseTags>
 inline HashTableEntry *ChainingHashTable<UseTags>::FindChainHead(hash_t hash) const {
   if constexpr (UseTags) {  // NOLINT
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "common/macros.h"
+#include "execution/sql/vector_projection.h"
+#include "execution/sql/vector_projection_iterator.h"
+
+namespace noisepage::execution::exec {
+class ExecutionContext;
+}  // namespace noisepage::execution::exec
+
+namespace noisepage::execution::sql {
+
+/**
+ * A vector-at-a-time scanner over a memory-mapped CSV file. Every record is produced as a row of a vector projection
+ * with one Varchar column per field. Fields reference the mapped file directly unless they have to be unescaped. An
+ * unquoted empty field is NULL, and blank lines are skipped.
+ *
+ * The file is split into chunks that begin at record boundaries, so that every chunk can be parsed on its own. The
+ * boundaries come from one parallel pass over the file, which records for every fixed-size piece of the file its
+ * number of quotes (mod 2), and its first newline in either quoting state that the piece might begin in. A serial
+ * prefix over the quote parities then tells which of the two newlines ends a record.
+ *
+ * Both passes classify the file 64 bytes at a time into bitmaps of its quote, delimiter and newline characters. The
+ * bytes within quotes are the prefix XOR of the quote bitmap, so parsing only visits the delimiters and newlines that
+ * are outside of quotes. With an escape character other than the quote, escaped quotes are removed from the quote
+ * bitmap first; the escape character is honored outside of quotes too.
+ */
+class EXPORT CSVScanner {
+ public:
+  /** The number of bytes in the pieces that the file is split into, before they are aligned to records. */
+  static constexpr std::size_t K_CHUNK_SIZE = 256 * 1024;
+
+  /**
+   * Map the given file into memory, and split it into chunks that begin at record boundaries.
+   * @param exec_ctx The execution context of the query, whose settings give the number of threads to parse with.
+   * @param file_name The path to the CSV file.
+   * @param num_cols The number of fields in every record.
+   * @param delimiter The character separating fields.
+   * @param quote The character quoting fields.
+   * @param escape The character escaping quotes within quoted fields.
+   * @throw ExecutionException if the file can't be mapped.
+   */
+  CSVScanner(exec::ExecutionContext *exec_ctx, std::string_view file_name, uint32_t num_cols, char delimiter,
+             char quote, char escape);
+
+  /**
+   * Unmap the file.
+   */
+  ~CSVScanner();
+
+  /**
+   * This class cannot be copied or moved.
+   */
+  DISALLOW_COPY_AND_MOVE(CSVScanner);
+
+  /**
+   * Advance the scanner to the next vector of records. Whenever the scanner runs out of parsed vectors, it parses as
+   * many of the next chunks as there are threads in parallel, and returns their vectors in the order of the file.
+   * @return True if there is another vector of records; false otherwise.
+   * @throw ExecutionException if a record doesn't have the expected number of fields.
+   */
+  bool Advance();
+
+  /**
+   * @return The iterator over the current vector of records.
+   */
+  VectorProjectionIterator *GetVectorProjectionIterator() { return &vector_projection_iterator_; }
+
+  /**
+   * Scan function callback used to consume the vectors of records of a chunk.
+   * Convention: First argument is the opaque query state (that must contain execCtx as a member),
+   *             second argument is the thread state,
+   *             third argument is the iterator over the vector of records.
+   */
+  using ScanFn = void (*)(void *, void *, VectorProjectionIterator *);
+
+  /**
+   * Parse all chunks of the file in parallel, and invoke @em scan_fn on every vector of records in the thread that
+   * parsed it. This call is blocking. The order in which vectors are consumed is non-deterministic.
+   * @param query_state An opaque pointer to some query-specific state. Passed to scan functions.
+   * @param scan_fn The callback function invoked for every vector of records.
+   * @param num_threads The number of threads to scan with, or 0 for the number of parallel execution threads in the
+   *                    execution settings.
+   * @throw ExecutionException if a record doesn't have the expected number of fields.
+   */
+  void ParallelScan(void *query_state, ScanFn scan_fn, uint32_t num_threads = 0);
+
+  /** @return The number of record-aligned chunks in the file. */
+  std::size_t GetNumChunks() const { return chunk_starts_.size() - 1; }
+
+ private:
+  // The number of threads to use if the caller asked for num_threads.
+  uint32_t GetNumThreads(uint32_t num_threads) const;
+
+  // Split the file into chunks that begin at record boundaries.
+  void FindChunks();
+
+  // Parse the next batch of chunks into parsed_.
+  void ParseNextChunks();
+
+ private:
+  exec::ExecutionContext *exec_ctx_;
+  const uint32_t num_cols_;
+  const char delimiter_;
+  const char quote_;
+  const char escape_;
+
+  // The mapped file.
+  const char *data_{nullptr};
+  std::size_t size_{0};
+
+  // Chunk i spans the bytes [chunk_starts_[i], chunk_starts_[i + 1]) of the file.
+  std::vector<std::size_t> chunk_starts_;
+
+  // The first chunk that Advance() hasn't parsed yet.
+  std::size_t next_chunk_{0};
+  // The vectors that Advance() has parsed, and the next one to return.
+  std::vector<std::unique_ptr<VectorProjection>> parsed_;
+  std::size_t next_parsed_{0};
+
+  // An iterator over the current vector of records.
+  VectorProjectionIterator vector_projection_iterator_;
+};
+
+}  // namespace noisepage::execution::sql
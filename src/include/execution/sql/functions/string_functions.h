@@ -11,6 +11,8 @@ class ExecutionContext;
 
 namespace noisepage::execution::sql {
 
+class LikePattern;
+
 /**
  * Utility class to handle SQL string manipulations.
  */
@@ -104,6 +106,9 @@ class StringFunctions {
   /** Compute LIKE(string, pattern). */
   static void Like(BoolVal *result, exec::ExecutionContext *ctx, const StringVal &string, const StringVal &pattern);
 
+  /** Compute LIKE(string, pattern) for an already-analyzed pattern. */
+  static void Like(BoolVal *result, exec::ExecutionContext *ctx, const StringVal &string, const LikePattern &pattern);
+
   /** Compute POSITION(search_str, search_sub_str). */
   static void Position(Integer *result, exec::ExecutionContext *ctx, const StringVal &search_str,
                        const StringVal &search_sub_str);
@@ -45,6 +45,23 @@ class EXPORT IndexIterator {
    */
   void ScanKey();
 
+  /**
+   * Append a copy of the key in LoPR() to the keys that the next ScanKeyBatch() probes.
+   */
+  void AddBatchKey();
+
+  /**
+   * Probe the index with every key that AddBatchKey() appended since the last ScanKeyBatch(), with a single call to the
+   * index's ScanKeyBatch, which interleaves the lookups. SelectBatchResult() then picks the tuples of one of the keys.
+   */
+  void ScanKeyBatch();
+
+  /**
+   * Iterate over the tuples that the last ScanKeyBatch() found for one of its keys, as if ScanKey() had probed it.
+   * @param key_idx The position of the key in the batch.
+   */
+  void SelectBatchResult(uint32_t key_idx);
+
   /**
    * Perform an ascending scan
    * @param scan_type Type of Scan
@@ -52,6 +69,13 @@ class EXPORT IndexIterator {
    */
   void ScanAscending(storage::index::ScanType scan_type, uint32_t limit);
 
+  /**
+   * Perform an ascending scan that also returns the key of every tuple, which KeyPR() reads for index-only scans
+   * @param scan_type Type of Scan
+   * @param limit number of tuples to limit
+   */
+  void ScanAscendingKeys(storage::index::ScanType scan_type, uint32_t limit);
+
   /**
    * Perfrom a descending scan
    */
@@ -89,6 +113,12 @@ class EXPORT IndexIterator {
    */
   storage::ProjectedRow *TablePR();
 
+  /**
+   * Write the key of the current tuple of a ScanAscendingKeys() into a projected row with the layout of PR().
+   * @return The projected row of the key, whose varlens are valid until the next call.
+   */
+  storage::ProjectedRow *KeyPR();
+
   /**
    * @return The current tuple slot of the iterator.
    */
@@ -115,6 +145,18 @@ class EXPORT IndexIterator {
   storage::ProjectedRow *hi_index_pr_;
   storage::ProjectedRow *table_pr_;
   std::vector<storage::TupleSlot> tuples_{};
+
+  // Only allocated if the index can return its keys
+  uint16_t key_size_ = 0;
+  void *key_buffer_ = nullptr;
+  byte *key_varlen_buffer_ = nullptr;
+  storage::ProjectedRow *key_pr_ = nullptr;
+  std::vector<byte> keys_{};
+
+  // Keys appended by AddBatchKey(), each a copy of the lo PR that is padded to 8 bytes, and their results
+  std::vector<byte> batch_keys_{};
+  uint32_t num_batch_keys_ = 0;
+  std::vector<std::vector<storage::TupleSlot>> batch_results_{};
 };
 
 }  // namespace noisepage::execution::sql
@@ -23,6 +23,7 @@ class ExecutionContext;
 
 namespace noisepage::execution::sql {
 
+class JoinHashTableIterator;
 class ThreadStateContainer;
 class Vector;
 
@@ -46,6 +47,16 @@ class Vector;
  * In parallel mode, thread-local join hash tables are lazily built and merged in parallel into a
  * global join hash table through a call to JoinHashTable::MergeParallel(). After this call, the
  * global table takes ownership of all thread-local allocated memory and hash index.
+ *
+ * When the whole probe side is materialized in another (unbuilt) join hash table,
+ * JoinHashTable::BuildAndJoin() builds the table and joins it with the probe tuples in one step.
+ * If the build tuples don't fit in cache, both sides are radix-partitioned by the buckets their
+ * tuples land in, and each partition of the table is built and then probed while it is
+ * cache-resident. The hash join translator materializes the probe side this way when the
+ * optimizer estimates the build side to be larger than the cache.
+ *
+ * Once built, all tuples in the table can be scanned in parallel through
+ * JoinHashTable::ExecuteParallelScan(), e.g., to find the build tuples an outer join never matched.
  */
 class EXPORT JoinHashTable {
  public:
@@ -63,6 +74,37 @@ class EXPORT JoinHashTable {
   /** Minimum number of expected elements to merge before triggering a parallel merge. */
   static constexpr uint32_t DEFAULT_MIN_SIZE_FOR_PARALLEL_MERGE = 1024;
 
+  /** The maximum number of bits of the bucket position to radix-partition large joins by. */
+  static constexpr uint32_t MAX_RADIX_BITS = 10;
+
+  /** The number of tuples in each morsel of a parallel scan. */
+  static constexpr uint32_t PARALLEL_SCAN_MORSEL_SIZE = 16384;
+
+  /**
+   * A list of materialized tuples. Every element is a HashTableEntry, with its hash value set,
+   * followed by the tuple.
+   */
+  using EntryList = util::ChunkedVector<MemoryPoolAllocator<byte>>;
+
+  /**
+   * Function called on every pair of build and probe tuples with equal hash values in
+   * JoinHashTable::BuildAndJoin(). It is the responsibility of the function to resolve hash
+   * collisions.
+   * Convention: First argument is the opaque query state,
+   *             second argument is the thread state,
+   *             third argument is the build tuple,
+   *             fourth argument is the probe tuple.
+   */
+  using JoinFn = void (*)(void *, void *, const byte *, const byte *);
+
+  /**
+   * Function called on each morsel of tuples in JoinHashTable::ExecuteParallelScan().
+   * Convention: First argument is the opaque query state,
+   *             second argument is the thread state,
+   *             third argument is an iterator over the tuples in the morsel.
+   */
+  using ScanFn = void (*)(void *, void *, JoinHashTableIterator *);
+
   /**
    * Construct a join hash table. All memory allocations are sourced from the injected @em memory,
    * and thus, are ephemeral.
@@ -126,6 +168,57 @@ class EXPORT JoinHashTable {
    */
   void MergeParallel(ThreadStateContainer *thread_state_container, std::size_t jht_offset);
 
+  /**
+   * Take ownership of the tuples in all thread-local hash tables stored in the state container,
+   * without building the table. The table can then be built through JoinHashTable::Build(), or
+   * built and joined through JoinHashTable::BuildAndJoin().
+   * @param thread_state_container The container for all thread-local tables.
+   * @param jht_offset The offset in the state where the hash table is.
+   */
+  void MoveTuplesParallel(ThreadStateContainer *thread_state_container, std::size_t jht_offset);
+
+  /**
+   * Build the table, and join it with the tuples materialized in @em probe_table by invoking
+   * @em join_fn on every pair of build and probe tuples with equal hash values. If the build tuples
+   * don't fit in cache, both sides are radix-partitioned and joined partition by partition.
+   * Otherwise, the table is built as in JoinHashTable::Build() and probed one tuple at a time.
+   * @param probe_table The unbuilt table holding the probe tuples.
+   * @param query_state An opaque pointer to some query-specific state. Passed to the join function.
+   * @param thread_state The thread state passed to the join function.
+   * @param join_fn The function invoked on every pair of matching tuples.
+   */
+  void BuildAndJoin(JoinHashTable *probe_table, void *query_state, void *thread_state, JoinFn join_fn);
+
+  /**
+   * Like JoinHashTable::BuildAndJoin(), but partition, build, and join in parallel. The join
+   * function is invoked with the thread state of the thread it runs in.
+   * @param probe_table The unbuilt table holding the probe tuples.
+   * @param query_state An opaque pointer to some query-specific state. Passed to the join function.
+   * @param thread_state_container The container for the thread states passed to the join function.
+   * @param join_fn The function invoked on every pair of matching tuples.
+   */
+  void BuildAndJoinParallel(JoinHashTable *probe_table, void *query_state,
+                            ThreadStateContainer *thread_state_container, JoinFn join_fn);
+
+  /**
+   * @param num_tuples The estimated number of build tuples.
+   * @param tuple_size The size of each build tuple, excluding its HashTableEntry header.
+   * @return True if a join with the given build side should be radix-partitioned, i.e., its
+   *         tuples and directory don't fit in the last-level cache; false otherwise.
+   */
+  static bool ShouldPartitionJoin(uint64_t num_tuples, std::size_t tuple_size);
+
+  /**
+   * Scan all tuples in the table in parallel. The tuples are split into morsels of at most
+   * JoinHashTable::PARALLEL_SCAN_MORSEL_SIZE tuples, and @em scan_fn is invoked on each morsel with
+   * the thread state of the thread it runs in.
+   * @pre The table must have been built.
+   * @param query_state An opaque pointer to some query-specific state. Passed to the scan function.
+   * @param thread_state_container The container for the thread states passed to the scan function.
+   * @param scan_fn The function invoked on each morsel.
+   */
+  void ExecuteParallelScan(void *query_state, ThreadStateContainer *thread_state_container, ScanFn scan_fn) const;
+
   /**
    * @return The total number of bytes used to materialize tuples. This excludes space required for
    *         the join index.
@@ -163,15 +256,11 @@ class EXPORT JoinHashTable {
     // acquire the lock before checking the owned entries vector. This isn't a
     // performance critical function, so locking should be okay ...
     common::SpinLatch::ScopedSpinLatch latch(&owned_latch_);
-    if (!owned_.empty()) {
-      uint64_t count = 0;
-      for (const auto &entries : owned_) {
-        count += entries.size();
-      }
-      return count;
+    uint64_t count = entries_.size();
+    for (const auto &entries : owned_) {
+      count += entries.size();
     }
-
-    return entries_.size();
+    return count;
   }
 
   /**
@@ -193,6 +282,7 @@ class EXPORT JoinHashTable {
   friend class JoinHashTableIterator;
   FRIEND_TEST(JoinHashTableTest, LazyInsertionTest);
   FRIEND_TEST(JoinHashTableTest, PerfTest);
+  FRIEND_TEST(JoinHashTableTest, PartitionedJoinTest);
 
   // Access a stored entry by index
   HashTableEntry *EntryAt(const uint64_t idx) { return reinterpret_cast<HashTableEntry *>(entries_[idx]); }
@@ -201,6 +291,17 @@ class EXPORT JoinHashTable {
     return reinterpret_cast<const HashTableEntry *>(entries_[idx]);
   }
 
+  // The non-empty lists of tuples in this table, whether inserted or moved from other tables.
+  std::vector<EntryList *> GetEntryLists();
+
+  // Shared by BuildAndJoin() and BuildAndJoinParallel(). The container is null in serial mode.
+  void BuildAndJoinInternal(JoinHashTable *probe_table, void *query_state, void *thread_state,
+                            ThreadStateContainer *thread_state_container, JoinFn join_fn);
+
+  // Dispatched from BuildAndJoinInternal() to join partition by partition.
+  void BuildAndJoinPartitioned(const std::vector<EntryList *> &probe_entries, void *query_state, void *thread_state,
+                               ThreadStateContainer *thread_state_container, JoinFn join_fn);
+
   // Dispatched from Build() to build either a chaining or concise hash table.
   void BuildChainingHashTable();
   void BuildConciseHashTable();
@@ -221,6 +322,10 @@ class EXPORT JoinHashTable {
   void LookupBatchInChainingHashTable(const Vector &hashes, Vector *results) const;
   void LookupBatchInConciseHashTable(const Vector &hashes, Vector *results) const;
 
+  // Called once the table is built to decide whether batched lookups should
+  // prefetch, i.e., whether the table is too large to fit in cache.
+  void ChooseProbePrefetching();
+
   // Merge the source hash table (which isn't built yet) into this one
   template <bool Concurrent>
   void MergeIncomplete(JoinHashTable *source);
@@ -232,7 +337,7 @@ class EXPORT JoinHashTable {
   exec::ExecutionContext *exec_ctx_;
 
   // The vector where we store the build-side input.
-  util::ChunkedVector<MemoryPoolAllocator<byte>> entries_;
+  EntryList entries_;
 
   // To protect concurrent access to 'owned_entries_'.
   mutable common::SpinLatch owned_latch_;
@@ -259,6 +364,9 @@ class EXPORT JoinHashTable {
   // Should we use a concise hash table?
   bool use_concise_ht_;
 
+  // Should batched lookups prefetch? Set when the table is built.
+  bool prefetch_probes_;
+
   // MemoryTracker
   common::ManagedPointer<MemoryTracker> tracker_;
 };
@@ -314,6 +422,7 @@ class JoinHashTableIterator {
    * @param table The join hash table to iterate.
    */
   explicit JoinHashTableIterator(const JoinHashTable &table);
+
   /**
    * @return True if there is more data in the iterator; false otherwise.
    */
@@ -352,6 +461,13 @@ class JoinHashTableIterator {
   }
 
  private:
+  friend class JoinHashTable;
+
+  // Construct an iterator over the entries in [begin, end) of one of the
+  // table's entry lists. Used to scan the table in morsels.
+  JoinHashTableIterator(const JoinHashTable &table, const JoinHashTable::EntryList &entries, uint64_t begin,
+                        uint64_t end);
+
   // Advance past any empty entry lists.
   void FindNextNonEmptyList();
 
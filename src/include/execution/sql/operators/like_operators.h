@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstdlib>
+#include <string>
+#include <string_view>
 
 #include "execution/sql/runtime_types.h"
 
@@ -8,6 +10,82 @@ namespace noisepage::execution::sql {
 
 static constexpr const char DEFAULT_ESCAPE = '\\';
 
+/**
+ * A LIKE pattern that has been analyzed once, so that it can be matched against many strings. Patterns whose only
+ * wildcards are leading or trailing '%'s are matched with a specialized kernel; contains-search uses SIMD first/last
+ * character filtering. All other patterns fall back to the general matcher in Like::Impl().
+ *
+ * The pattern is copied, so a LikePattern can be freely copied or moved, and it can outlive the string it was built
+ * from. Constant patterns in a query are analyzed once and kept in the query state.
+ */
+class LikePattern {
+ public:
+  /** The shapes of patterns that have a specialized kernel. */
+  enum class Kind : uint8_t {
+    /** 'abc': the string equals the literal. */
+    Exact,
+    /** 'abc%': the string begins with the literal. */
+    Prefix,
+    /** '%abc': the string ends with the literal. */
+    Suffix,
+    /** '%abc%': the string contains the literal. */
+    Contains,
+    /** Any other pattern. */
+    General,
+  };
+
+  /**
+   * Analyze the given pattern.
+   * @param pattern The pattern.
+   * @param pattern_len The length of the pattern in bytes.
+   * @param escape The escape character of the pattern.
+   */
+  LikePattern(const char *pattern, std::size_t pattern_len, char escape = DEFAULT_ESCAPE);
+
+  /**
+   * Analyze the given pattern.
+   * @param pattern The pattern.
+   * @param escape The escape character of the pattern.
+   */
+  explicit LikePattern(const storage::VarlenEntry &pattern, char escape = DEFAULT_ESCAPE)
+      : LikePattern(reinterpret_cast<const char *>(pattern.Content()), pattern.Size(), escape) {}
+
+  /** @return The shape of the pattern. */
+  Kind GetKind() const { return kind_; }
+
+  /** @return The literal that the string is compared with, if the pattern isn't Kind::General. */
+  std::string_view GetLiteral() const {
+    if (has_escapes_) return unescaped_;
+    return std::string_view(pattern_).substr(literal_begin_, literal_len_);
+  }
+
+  /** @return True if the string is like the pattern. */
+  bool Matches(const char *str, std::size_t str_len) const;
+
+  /** @return True if the string is like the pattern. */
+  bool Matches(const storage::VarlenEntry &str) const {
+    return Matches(reinterpret_cast<const char *>(str.Content()), str.Size());
+  }
+
+  /**
+   * @return True if @em haystack contains @em needle. Candidate positions are found 16 or 32 bytes at a time by
+   *         comparing against both the first and the last byte of the needle, and only then verified.
+   */
+  static bool Contains(const char *haystack, std::size_t haystack_len, const char *needle, std::size_t needle_len);
+
+ private:
+  // The original pattern, for the general matcher.
+  std::string pattern_;
+  char escape_;
+  Kind kind_{Kind::General};
+  // The literal part of the pattern is [literal_begin_, literal_begin_ + literal_len_) of the pattern, unless the
+  // pattern has escapes, in which case it is unescaped_. Positions rather than views keep copies and moves valid.
+  std::size_t literal_begin_{0};
+  std::size_t literal_len_{0};
+  bool has_escapes_{false};
+  std::string unescaped_;
+};
+
 /**
  * Functor implementing the SQL LIKE() operator
  */
@@ -22,6 +100,9 @@ struct Like {
     return Impl(reinterpret_cast<const char *>(str.Content()), str.Size(),
                 reinterpret_cast<const char *>(pattern.Content()), pattern.Size(), escape);
   }
+
+  /** @return True if str is LIKE the already-analyzed pattern. */
+  bool operator()(const storage::VarlenEntry &str, const LikePattern &pattern) const { return pattern.Matches(str); }
 };
 
 /**
@@ -33,6 +114,9 @@ struct NotLike {
                   char escape = DEFAULT_ESCAPE) const {
     return !Like{}(str, pattern, escape);  // NOLINT
   }
+
+  /** @return True if str is NOT LIKE the already-analyzed pattern. */
+  bool operator()(const storage::VarlenEntry &str, const LikePattern &pattern) const { return !pattern.Matches(str); }
 };
 
 }  // namespace noisepage::execution::sql
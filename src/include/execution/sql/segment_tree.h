@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstdint>
+
+#include "common/macros.h"
+#include "execution/sql/memory_pool.h"
+
+namespace noisepage::execution::exec {
+class ExecutionContext;
+}  // namespace noisepage::execution::exec
+
+namespace noisepage::execution::sql {
+
+struct Integer;
+struct Real;
+
+/**
+ * A segment tree computes an aggregate over any contiguous range of a sequence of values in logarithmic time. Window
+ * operators use it to evaluate aggregates over the frames of a partition: the values of the partition are appended
+ * in order, the tree is built once, and every frame is then a range query. A sliding frame of width w over n rows
+ * costs O(n log n) instead of O(n * w).
+ *
+ * @code
+ * SegmentTree tree(exec_ctx, SegmentTree::AggregateKind::Sum);
+ * for (...) {
+ *   tree.Append(value);
+ * }
+ * tree.Build();
+ * Integer result(0);
+ * tree.Query(begin, end, &result);
+ * // Start the next partition
+ * tree.Reset();
+ * @endcode
+ *
+ * NULL values are skipped, as in SQL aggregates. All values appended between two resets must have the same type.
+ */
+class EXPORT SegmentTree {
+ public:
+  /** The aggregates that can be computed over a range. */
+  enum class AggregateKind : uint32_t { Count = 0, Sum = 1, Min = 2, Max = 3, Avg = 4 };
+
+  /**
+   * Create an empty segment tree.
+   * @param exec_ctx The execution context whose memory pool the tree is allocated from.
+   * @param kind The aggregate computed over the ranges.
+   */
+  SegmentTree(exec::ExecutionContext *exec_ctx, AggregateKind kind);
+
+  /**
+   * This class cannot be copied or moved.
+   */
+  DISALLOW_COPY_AND_MOVE(SegmentTree);
+
+  /**
+   * Append an integer value. Must not be called after Build() until the next Reset().
+   * @param val The value to append.
+   */
+  void Append(const Integer &val);
+
+  /**
+   * Append a real value. Must not be called after Build() until the next Reset().
+   * @param val The value to append.
+   */
+  void Append(const Real &val);
+
+  /**
+   * Build the inner nodes of the tree over all appended values.
+   */
+  void Build();
+
+  /**
+   * Remove all values, so that the tree can be reused for another sequence.
+   */
+  void Reset();
+
+  /**
+   * Compute the aggregate over the values in the range [begin, end). COUNT is never NULL. SUM, MIN and MAX are NULL
+   * if the range has no non-NULL values. Only valid for COUNT, or for SUM, MIN and MAX over integer values.
+   * @param begin The index of the first value in the range.
+   * @param end The index one past the last value in the range.
+   * @param[out] result Where the aggregate is written.
+   */
+  void Query(uint64_t begin, uint64_t end, Integer *result) const;
+
+  /**
+   * Compute the aggregate over the values in the range [begin, end). The result is NULL if the range has no non-NULL
+   * values. Only valid for AVG, or for SUM, MIN and MAX over real values.
+   * @param begin The index of the first value in the range.
+   * @param end The index one past the last value in the range.
+   * @param[out] result Where the aggregate is written.
+   */
+  void Query(uint64_t begin, uint64_t end, Real *result) const;
+
+  /**
+   * @return The number of values appended since the last reset.
+   */
+  uint64_t GetNumValues() const noexcept { return num_values_; }
+
+  /**
+   * @return The aggregate computed over the ranges.
+   */
+  AggregateKind GetAggregateKind() const noexcept { return kind_; }
+
+ private:
+  // A node holds the aggregate of its range and the number of non-NULL values in it. Leaves of NULL values have a
+  // count of zero.
+  struct Node {
+    union {
+      int64_t int_val_;
+      double real_val_;
+    };
+    uint64_t count_;
+  };
+
+  // Combine two nodes into their parent.
+  Node Combine(const Node &lhs, const Node &rhs) const;
+
+  // Combine all leaves in the range [begin, end).
+  Node QueryRange(uint64_t begin, uint64_t end) const;
+
+ private:
+  // The aggregate.
+  AggregateKind kind_;
+  // Whether the values are reals.
+  bool is_real_;
+  // Whether the inner nodes have been built.
+  bool built_;
+  // The number of values.
+  uint64_t num_values_;
+  // Before Build(), the leaves. After Build(), the tree: the root is at index 1, the children of node i at 2i and
+  // 2i+1, and the leaves at [num_values_, 2 * num_values_).
+  MemPoolVector<Node> nodes_;
+};
+
+}  // namespace noisepage::execution::sql
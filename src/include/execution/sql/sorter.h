@@ -15,6 +15,7 @@ class ExecutionContext;
 
 namespace noisepage::execution::sql {
 
+class SorterIterator;
 class ThreadStateContainer;
 class VectorProjection;
 class VectorProjectionIterator;
@@ -66,7 +67,8 @@ class VectorProjectionIterator;
  * instances managed by a tpl::sql::ThreadStatesContainer. Each thread will insert into their
  * thread-local Sorter, but <b>without calling</b> Sorter::Sort(). When all insertions are complete
  * across all threads, the primary thread uses Sorter::SortParallel() or Sorter::SortTopKParallel()
- * for parallel sort and parallel Top-K, respectively.
+ * for parallel sort and parallel Top-K, respectively. A sorted sorter can then be scanned in
+ * parallel, one range of whole partitions per task, through Sorter::ScanPartitionsParallel().
  */
 class EXPORT Sorter {
  public:
@@ -96,6 +98,24 @@ class EXPORT Sorter {
    */
   using ComparisonFunction = int32_t (*)(const void *lhs, const void *rhs);
 
+  /**
+   * The function used to check whether two sorted tuples belong to the same partition.
+   */
+  using PartitionEqualityFn = bool (*)(const void *lhs, const void *rhs);
+
+  /**
+   * The function used to scan a range of whole partitions of a sorted sorter. It receives an opaque query state, the
+   * thread state of the executing thread and two iterators over the range: one to read rows and one to peek ahead.
+   */
+  using ScanPartitionsFn = void (*)(void *query_state, void *thread_state, SorterIterator *iter,
+                                    SorterIterator *peek_iter);
+
+  /**
+   * Number of ranges of partitions to create per thread in Sorter::ScanPartitionsParallel(). Using more ranges than
+   * threads balances the load when partitions have different sizes.
+   */
+  static constexpr uint64_t PARTITION_RANGES_PER_THREAD = 4;
+
   /**
    * Construct a sorter using @em memory as the memory allocator, storing tuples @em tuple_size
    * size in bytes, and using the comparison function @em cmp_fn.
@@ -165,6 +185,18 @@ class EXPORT Sorter {
    */
   void SortTopKParallel(ThreadStateContainer *thread_state_container, uint32_t sorter_offset, uint64_t top_k);
 
+  /**
+   * Scan the sorted contents of this sorter in parallel. The tuples are split into ranges that never cut a partition
+   * in two, and each range is scanned by invoking @em scan_fn in a separate task. Partitions are thus scanned in no
+   * particular order. This sorter must be sorted so that tuples of a partition are adjacent.
+   * @param query_state The (opaque) query state.
+   * @param thread_states The container holding the thread-local state passed to @em scan_fn.
+   * @param same_partition_fn The function checking whether two tuples belong to the same partition.
+   * @param scan_fn The function scanning a range of partitions.
+   */
+  void ScanPartitionsParallel(void *query_state, ThreadStateContainer *thread_states,
+                              PartitionEqualityFn same_partition_fn, ScanPartitionsFn scan_fn) const;
+
   /**
    * @return The number of tuples currently in this sorter.
    */
@@ -225,6 +257,14 @@ class SorterIterator {
    */
   explicit SorterIterator(const Sorter &sorter);
 
+  /**
+   * Create an iterator over the tuples of the provided sorter in the range [begin, end).
+   * @param sorter The sorter instance.
+   * @param begin The index of the first tuple.
+   * @param end The index past the last tuple.
+   */
+  SorterIterator(const Sorter &sorter, uint64_t begin, uint64_t end);
+
   /**
    * @return True if the iterator has more data; false otherwise.
    */
@@ -30,6 +30,12 @@ namespace sql {
  */
 class EXPORT StorageInterface {
  public:
+  /**
+   * Number of index entries staged for one index by IndexInsertBatch() or IndexDeleteBatch() before they are applied to
+   * the index without waiting for IndexFlushBatches().
+   */
+  static constexpr uint32_t INDEX_BATCH_SIZE = 1024;
+
   /**
    * Constructor
    * @param exec_ctx The execution context.
@@ -106,6 +112,39 @@ class EXPORT StorageInterface {
    */
   bool IndexInsertWithTuple(storage::TupleSlot table_tuple_slot, bool unique);
 
+  /**
+   * Stage the current index PR for an insert into the current index, which is done together with the other staged
+   * entries of the index by IndexFlushBatches(), or once INDEX_BATCH_SIZE entries are staged.
+   * @return False if staged entries were inserted and the index found a constraint violation, true otherwise.
+   */
+  bool IndexInsertBatch();
+
+  /**
+   * Stage the current index PR for a delete from the current index, which is done together with the other staged entries
+   * of the index by IndexFlushBatches(), or once INDEX_BATCH_SIZE entries are staged.
+   * @param table_tuple_slot slot corresponding to the item.
+   */
+  void IndexDeleteBatch(storage::TupleSlot table_tuple_slot);
+
+  /**
+   * Apply every entry that was staged by IndexInsertBatch() or IndexDeleteBatch() to its index.
+   * @return False if an index found a constraint violation, true otherwise.
+   */
+  bool IndexFlushBatches();
+
+  /**
+   * Stage the current index PR for a bulk load of the current index, which is done by IndexBulkLoad(). Thread-safe.
+   * @param table_tuple_slot tuple slot
+   * @return Whether staging was successful.
+   */
+  bool IndexBulkLoadStage(storage::TupleSlot table_tuple_slot);
+
+  /**
+   * Bulk load every entry that was staged for the current index.
+   * @return Whether the bulk load was successful, i.e., false if a unique index would have duplicate keys.
+   */
+  bool IndexBulkLoad();
+
   /**
    * @returns index heap size
    */
@@ -162,6 +201,36 @@ class EXPORT StorageInterface {
    * Current index being accessed.
    */
   common::ManagedPointer<storage::index::Index> curr_index_{nullptr};
+
+ private:
+  /** Index entries staged by IndexInsertBatch() and IndexDeleteBatch() for one index. */
+  struct IndexBatch {
+    /** Index that the entries belong to. */
+    common::ManagedPointer<storage::index::Index> index_;
+    /** Size of each staged index PR in 8-byte words. */
+    uint32_t pr_words_;
+    /** Copies of the index PRs staged for insertion. */
+    std::vector<uint64_t> insert_keys_;
+    /** Slots staged for insertion, one for every index PR. */
+    std::vector<storage::TupleSlot> insert_slots_;
+    /** Copies of the index PRs staged for deletion. */
+    std::vector<uint64_t> delete_keys_;
+    /** Slots staged for deletion, one for every index PR. */
+    std::vector<storage::TupleSlot> delete_slots_;
+  };
+
+  /** @return the staged entries of the current index, which are created on first use */
+  IndexBatch *CurrentIndexBatch();
+
+  /**
+   * Apply the staged entries of an index, deletes first, and clear them.
+   * @param batch the staged entries
+   * @return False if the index found a constraint violation, true otherwise.
+   */
+  bool FlushIndexBatch(IndexBatch *batch);
+
+  /** Staged entries of every index that IndexInsertBatch() or IndexDeleteBatch() was called for. */
+  std::vector<IndexBatch> index_batches_;
 };
 }  // namespace sql
 }  // namespace noisepage::execution
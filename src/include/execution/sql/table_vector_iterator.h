@@ -117,10 +117,12 @@ class EXPORT TableVectorIterator {
    *                 container has been configured for size, construction, and destruction
    *                 before this invocation.
    * @param scan_fn The callback function invoked for vectors of table input.
+   * @param num_threads The number of threads to scan with, or 0 for the number of parallel execution threads in the
+   *                    execution settings.
    * @param min_grain_size The minimum number of blocks to give a scan task.
    */
   static bool ParallelScan(uint32_t table_oid, uint32_t *col_oids, uint32_t num_oids, void *query_state,
-                           exec::ExecutionContext *exec_ctx, ScanFn scan_fn,
+                           exec::ExecutionContext *exec_ctx, ScanFn scan_fn, uint32_t num_threads = 0,
                            uint32_t min_grain_size = K_MIN_BLOCK_RANGE_SIZE);
 
  private:
@@ -423,6 +423,65 @@ class EXPORT VectorOps {
    */
   static void Sort(const Vector &input, sel_t result[]);
 
+  // -------------------------------------------------------
+  //
+  // Aggregation
+  //
+  // -------------------------------------------------------
+
+  /**
+   * @return The number of active, non-NULL elements in the input vector @em input.
+   */
+  static uint64_t Count(const Vector &input);
+
+  /**
+   * Sum the active, non-NULL elements in the integer input vector @em input.
+   * @param input The TinyInt, SmallInt, Integer or BigInt vector to sum.
+   * @param[out] result The sum. Left untouched if no element was summed.
+   * @return The number of elements that were summed.
+   */
+  static uint64_t Sum(const Vector &input, int64_t *result);
+
+  /**
+   * Sum the active, non-NULL elements in the floating point input vector @em input.
+   * @param input The Float or Double vector to sum.
+   * @param[out] result The sum. Left untouched if no element was summed.
+   * @return The number of elements that were summed.
+   */
+  static uint64_t Sum(const Vector &input, double *result);
+
+  /**
+   * Compute the minimum of the active, non-NULL elements in the integer input vector @em input.
+   * @param input The TinyInt, SmallInt, Integer or BigInt vector.
+   * @param[out] result The minimum. Left untouched if there was no element to aggregate.
+   * @return The number of elements that were aggregated.
+   */
+  static uint64_t Min(const Vector &input, int64_t *result);
+
+  /**
+   * Compute the minimum of the active, non-NULL elements in the floating point input vector @em input.
+   * @param input The Float or Double vector.
+   * @param[out] result The minimum. Left untouched if there was no element to aggregate.
+   * @return The number of elements that were aggregated.
+   */
+  static uint64_t Min(const Vector &input, double *result);
+
+  /**
+   * Compute the maximum of the active, non-NULL elements in the integer input vector @em input.
+   * @param input The TinyInt, SmallInt, Integer or BigInt vector.
+   * @param[out] result The maximum. Left untouched if there was no element to aggregate.
+   * @return The number of elements that were aggregated.
+   */
+  static uint64_t Max(const Vector &input, int64_t *result);
+
+  /**
+   * Compute the maximum of the active, non-NULL elements in the floating point input vector @em input.
+   * @param input The Float or Double vector.
+   * @param[out] result The maximum. Left untouched if there was no element to aggregate.
+   * @return The number of elements that were aggregated.
+   */
+  static uint64_t Max(const Vector &input, double *result);
+
   // -------------------------------------------------------
   //
   // Vector Iteration Logic
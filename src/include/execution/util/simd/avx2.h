@@ -2,6 +2,11 @@
 
 #include <immintrin.h>
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
 #include "common/macros.h"
 #include "execution/util/execution_common.h"
 #include "execution/util/simd/types.h"
@@ -960,4 +965,191 @@ static inline uint32_t FilterVectorByVector(const T *RESTRICT in_1, const T *RES
   return out_pos;
 }
 
+// ---------------------------------------------------------
+// Aggregate
+// ---------------------------------------------------------
+
+/**
+ * The type elements of type T are widened to when aggregated: 64-bit integers for integers, doubles for floats.
+ */
+template <typename T>
+using AggregateType = std::conditional_t<std::is_floating_point_v<T>, double, int64_t>;
+
+/**
+ * Load four 8-bit integers, sign-extended to four 64-bit integers.
+ */
+ALWAYS_INLINE inline __m256i LoadWidened(const int8_t *ptr) {
+  int32_t bytes;
+  std::memcpy(&bytes, ptr, sizeof(bytes));
+  return _mm256_cvtepi8_epi64(_mm_cvtsi32_si128(bytes));
+}
+
+/**
+ * Load four 16-bit integers, sign-extended to four 64-bit integers.
+ */
+ALWAYS_INLINE inline __m256i LoadWidened(const int16_t *ptr) {
+  return _mm256_cvtepi16_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(ptr)));
+}
+
+/**
+ * Load four 32-bit integers, sign-extended to four 64-bit integers.
+ */
+ALWAYS_INLINE inline __m256i LoadWidened(const int32_t *ptr) {
+  return _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr)));
+}
+
+/**
+ * Load four 64-bit integers.
+ */
+ALWAYS_INLINE inline __m256i LoadWidened(const int64_t *ptr) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr));
+}
+
+/**
+ * Load four floats, converted to four doubles.
+ */
+ALWAYS_INLINE inline __m256d LoadWidened(const float *ptr) { return _mm256_cvtps_pd(_mm_loadu_ps(ptr)); }
+
+/**
+ * Load four doubles.
+ */
+ALWAYS_INLINE inline __m256d LoadWidened(const double *ptr) { return _mm256_loadu_pd(ptr); }
+
+/**
+ * Select the lanes of @em val whose mask lane is set, and the lanes of @em otherwise everywhere else.
+ */
+ALWAYS_INLINE inline __m256i Select(const __m256i &mask, const __m256i &val, const __m256i &otherwise) {
+  return _mm256_blendv_epi8(otherwise, val, mask);
+}
+
+/**
+ * Select the lanes of @em val whose mask lane is set, and the lanes of @em otherwise everywhere else.
+ */
+ALWAYS_INLINE inline __m256d Select(const __m256i &mask, const __m256d &val, const __m256d &otherwise) {
+  return _mm256_blendv_pd(otherwise, val, _mm256_castsi256_pd(mask));
+}
+
+/**
+ * Summation.
+ */
+struct AggregateSum {
+  /** @return The identity of the summation. */
+  template <typename T>
+  static constexpr T Identity() {
+    return T(0);
+  }
+  /** @return The sum of the two values. */
+  template <typename T>
+  static T Apply(T a, T b) {
+    return a + b;
+  }
+  /** @return The lane-wise sum of the two vectors. */
+  static __m256i Apply(const __m256i &a, const __m256i &b) { return _mm256_add_epi64(a, b); }
+  /** @return The lane-wise sum of the two vectors. */
+  static __m256d Apply(const __m256d &a, const __m256d &b) { return _mm256_add_pd(a, b); }
+};
+
+/**
+ * Minimum.
+ */
+struct AggregateMin {
+  /** @return The identity of the minimum. */
+  template <typename T>
+  static constexpr T Identity() {
+    if constexpr (std::numeric_limits<T>::has_infinity) {
+      return std::numeric_limits<T>::infinity();
+    } else {
+      return std::numeric_limits<T>::max();
+    }
+  }
+  /** @return The minimum of the two values. */
+  template <typename T>
+  static T Apply(T a, T b) {
+    return std::min(a, b);
+  }
+  /** @return The lane-wise minimum of the two vectors. */
+  static __m256i Apply(const __m256i &a, const __m256i &b) { return Select(_mm256_cmpgt_epi64(a, b), b, a); }
+  /** @return The lane-wise minimum of the two vectors. */
+  static __m256d Apply(const __m256d &a, const __m256d &b) { return _mm256_min_pd(a, b); }
+};
+
+/**
+ * Maximum.
+ */
+struct AggregateMax {
+  /** @return The identity of the maximum. */
+  template <typename T>
+  static constexpr T Identity() {
+    if constexpr (std::numeric_limits<T>::has_infinity) {
+      return -std::numeric_limits<T>::infinity();
+    } else {
+      return std::numeric_limits<T>::lowest();
+    }
+  }
+  /** @return The maximum of the two values. */
+  template <typename T>
+  static T Apply(T a, T b) {
+    return std::max(a, b);
+  }
+  /** @return The lane-wise maximum of the two vectors. */
+  static __m256i Apply(const __m256i &a, const __m256i &b) { return Select(_mm256_cmpgt_epi64(b, a), b, a); }
+  /** @return The lane-wise maximum of the two vectors. */
+  static __m256d Apply(const __m256d &a, const __m256d &b) { return _mm256_max_pd(a, b); }
+};
+
+/**
+ * Aggregate the elements of the input array @em in with the aggregate @em Op, four at a time. Only the elements whose
+ * bit is set in the bitmap @em active are aggregated; a null bitmap aggregates every element. Elements are widened to
+ * AggregateType<T> before they're aggregated.
+ *
+ * Like the filters above, the input is processed in full SIMD vectors only. On return, @em in_pos holds the position
+ * of the first element that wasn't processed; the caller aggregates the tail from there.
+ *
+ * @return The aggregate of the processed elements, or the identity of @em Op if none were.
+ */
+template <typename T, typename Op>
+static inline AggregateType<T> AggregateVector(const T *RESTRICT in, uint32_t in_count,
+                                               const uint64_t *RESTRICT active, uint32_t *RESTRICT in_pos) {
+  using Agg = AggregateType<T>;
+  using Reg = decltype(LoadWidened(in));
+  constexpr uint32_t lanes = 4;
+
+  Reg identity;
+  if constexpr (std::is_floating_point_v<T>) {
+    identity = _mm256_set1_pd(Op::template Identity<Agg>());
+  } else {
+    identity = _mm256_set1_epi64x(Op::template Identity<Agg>());
+  }
+
+  Reg acc = identity;
+  if (active == nullptr) {
+    for (*in_pos = 0; *in_pos + lanes <= in_count; *in_pos += lanes) {
+      acc = Op::Apply(acc, LoadWidened(in + *in_pos));
+    }
+  } else {
+    const __m256i lane_bits = _mm256_setr_epi64x(1, 2, 4, 8);
+    for (*in_pos = 0; *in_pos + lanes <= in_count; *in_pos += lanes) {
+      const uint64_t bits = (active[*in_pos / 64] >> (*in_pos % 64)) & 0xF;
+      if (bits == 0) {
+        continue;
+      }
+      const __m256i mask =
+          _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x(static_cast<int64_t>(bits)), lane_bits), lane_bits);
+      acc = Op::Apply(acc, Select(mask, LoadWidened(in + *in_pos), identity));
+    }
+  }
+
+  alignas(32) Agg partials[lanes];
+  if constexpr (std::is_floating_point_v<T>) {
+    _mm256_store_pd(partials, acc);
+  } else {
+    _mm256_store_si256(reinterpret_cast<__m256i *>(partials), acc);
+  }
+  Agg result = Op::template Identity<Agg>();
+  for (const auto partial : partials) {
+    result = Op::Apply(result, partial);
+  }
+  return result;
+}
+
 }  // namespace noisepage::execution::util::simd
@@ -2,6 +2,10 @@
 
 #include <immintrin.h>
 
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
 #include "common/macros.h"
 #include "execution/util/execution_common.h"
 #include "execution/util/simd/types.h"
@@ -1042,4 +1046,177 @@ static inline uint32_t FilterVectorByVector(const T *RESTRICT in_1, const T *RES
   return out_pos;
 }
 
+// ---------------------------------------------------------
+// Aggregate
+// ---------------------------------------------------------
+
+/**
+ * The type elements of type T are widened to when aggregated: 64-bit integers for integers, doubles for floats.
+ */
+template <typename T>
+using AggregateType = std::conditional_t<std::is_floating_point_v<T>, double, int64_t>;
+
+/**
+ * Load eight 8-bit integers, sign-extended to eight 64-bit integers.
+ */
+ALWAYS_INLINE inline __m512i LoadWidened(const int8_t *ptr) {
+  return _mm512_cvtepi8_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(ptr)));
+}
+
+/**
+ * Load eight 16-bit integers, sign-extended to eight 64-bit integers.
+ */
+ALWAYS_INLINE inline __m512i LoadWidened(const int16_t *ptr) {
+  return _mm512_cvtepi16_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr)));
+}
+
+/**
+ * Load eight 32-bit integers, sign-extended to eight 64-bit integers.
+ */
+ALWAYS_INLINE inline __m512i LoadWidened(const int32_t *ptr) {
+  return _mm512_cvtepi32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr)));
+}
+
+/**
+ * Load eight 64-bit integers.
+ */
+ALWAYS_INLINE inline __m512i LoadWidened(const int64_t *ptr) { return _mm512_loadu_si512(ptr); }
+
+/**
+ * Load eight floats, converted to eight doubles.
+ */
+ALWAYS_INLINE inline __m512d LoadWidened(const float *ptr) { return _mm512_cvtps_pd(_mm256_loadu_ps(ptr)); }
+
+/**
+ * Load eight doubles.
+ */
+ALWAYS_INLINE inline __m512d LoadWidened(const double *ptr) { return _mm512_loadu_pd(ptr); }
+
+/**
+ * Summation.
+ */
+struct AggregateSum {
+  /** @return The identity of the summation. */
+  template <typename T>
+  static constexpr T Identity() {
+    return T(0);
+  }
+  /** @return The sum of the two values. */
+  template <typename T>
+  static T Apply(T a, T b) {
+    return a + b;
+  }
+  /** @return The lane-wise sum of the two vectors, in the lanes of @em mask; the lanes of @em a elsewhere. */
+  static __m512i Apply(const __m512i &a, __mmask8 mask, const __m512i &b) {
+    return _mm512_mask_add_epi64(a, mask, a, b);
+  }
+  /** @return The lane-wise sum of the two vectors, in the lanes of @em mask; the lanes of @em a elsewhere. */
+  static __m512d Apply(const __m512d &a, __mmask8 mask, const __m512d &b) { return _mm512_mask_add_pd(a, mask, a, b); }
+  /** @return The sum of the lanes of the vector. */
+  static int64_t Reduce(const __m512i &a) { return _mm512_reduce_add_epi64(a); }
+  /** @return The sum of the lanes of the vector. */
+  static double Reduce(const __m512d &a) { return _mm512_reduce_add_pd(a); }
+};
+
+/**
+ * Minimum.
+ */
+struct AggregateMin {
+  /** @return The identity of the minimum. */
+  template <typename T>
+  static constexpr T Identity() {
+    if constexpr (std::numeric_limits<T>::has_infinity) {
+      return std::numeric_limits<T>::infinity();
+    } else {
+      return std::numeric_limits<T>::max();
+    }
+  }
+  /** @return The minimum of the two values. */
+  template <typename T>
+  static T Apply(T a, T b) {
+    return std::min(a, b);
+  }
+  /** @return The lane-wise minimum of the two vectors, in the lanes of @em mask; the lanes of @em a elsewhere. */
+  static __m512i Apply(const __m512i &a, __mmask8 mask, const __m512i &b) {
+    return _mm512_mask_min_epi64(a, mask, a, b);
+  }
+  /** @return The lane-wise minimum of the two vectors, in the lanes of @em mask; the lanes of @em a elsewhere. */
+  static __m512d Apply(const __m512d &a, __mmask8 mask, const __m512d &b) { return _mm512_mask_min_pd(a, mask, a, b); }
+  /** @return The minimum of the lanes of the vector. */
+  static int64_t Reduce(const __m512i &a) { return _mm512_reduce_min_epi64(a); }
+  /** @return The minimum of the lanes of the vector. */
+  static double Reduce(const __m512d &a) { return _mm512_reduce_min_pd(a); }
+};
+
+/**
+ * Maximum.
+ */
+struct AggregateMax {
+  /** @return The identity of the maximum. */
+  template <typename T>
+  static constexpr T Identity() {
+    if constexpr (std::numeric_limits<T>::has_infinity) {
+      return -std::numeric_limits<T>::infinity();
+    } else {
+      return std::numeric_limits<T>::lowest();
+    }
+  }
+  /** @return The maximum of the two values. */
+  template <typename T>
+  static T Apply(T a, T b) {
+    return std::max(a, b);
+  }
+  /** @return The lane-wise maximum of the two vectors, in the lanes of @em mask; the lanes of @em a elsewhere. */
+  static __m512i Apply(const __m512i &a, __mmask8 mask, const __m512i &b) {
+    return _mm512_mask_max_epi64(a, mask, a, b);
+  }
+  /** @return The lane-wise maximum of the two vectors, in the lanes of @em mask; the lanes of @em a elsewhere. */
+  static __m512d Apply(const __m512d &a, __mmask8 mask, const __m512d &b) { return _mm512_mask_max_pd(a, mask, a, b); }
+  /** @return The maximum of the lanes of the vector. */
+  static int64_t Reduce(const __m512i &a) { return _mm512_reduce_max_epi64(a); }
+  /** @return The maximum of the lanes of the vector. */
+  static double Reduce(const __m512d &a) { return _mm512_reduce_max_pd(a); }
+};
+
+/**
+ * Aggregate the elements of the input array @em in with the aggregate @em Op, eight at a time. Only the elements whose
+ * bit is set in the bitmap @em active are aggregated; a null bitmap aggregates every element. Elements are widened to
+ * AggregateType<T> before they're aggregated.
+ *
+ * Like the filters above, the input is processed in full SIMD vectors only. On return, @em in_pos holds the position
+ * of the first element that wasn't processed; the caller aggregates the tail from there.
+ *
+ * @return The aggregate of the processed elements, or the identity of @em Op if none were.
+ */
+template <typename T, typename Op>
+static inline AggregateType<T> AggregateVector(const T *RESTRICT in, uint32_t in_count,
+                                               const uint64_t *RESTRICT active, uint32_t *RESTRICT in_pos) {
+  using Agg = AggregateType<T>;
+  using Reg = decltype(LoadWidened(in));
+  constexpr uint32_t lanes = 8;
+
+  Reg acc;
+  if constexpr (std::is_floating_point_v<T>) {
+    acc = _mm512_set1_pd(Op::template Identity<Agg>());
+  } else {
+    acc = _mm512_set1_epi64(Op::template Identity<Agg>());
+  }
+
+  if (active == nullptr) {
+    const __mmask8 all(~static_cast<uint8_t>(0));
+    for (*in_pos = 0; *in_pos + lanes <= in_count; *in_pos += lanes) {
+      acc = Op::Apply(acc, all, LoadWidened(in + *in_pos));
+    }
+  } else {
+    for (*in_pos = 0; *in_pos + lanes <= in_count; *in_pos += lanes) {
+      const auto mask = static_cast<__mmask8>(active[*in_pos / 64] >> (*in_pos % 64));
+      if (mask != 0) {
+        acc = Op::Apply(acc, mask, LoadWidened(in + *in_pos));
+      }
+    }
+  }
+
+  return Op::Reduce(acc);
+}
+
 }  // namespace noisepage::execution::util::simd
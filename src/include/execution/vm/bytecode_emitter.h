@@ -319,9 +319,16 @@ class BytecodeEmitter {
   void EmitTableIterInit(Bytecode bytecode, LocalVar iter, LocalVar exec_ctx, LocalVar table_oid, LocalVar col_oids,
                          uint32_t num_oids);
 
-  /** Emit a parallel table scan. */
+  /** Emit a parallel table scan with the given number of threads, where 0 uses the execution settings. */
   void EmitParallelTableScan(LocalVar table_oid, LocalVar col_oids, uint32_t num_oids, LocalVar query_state,
-                             LocalVar exec_ctx, FunctionId scan_fn);
+                             LocalVar exec_ctx, FunctionId scan_fn, uint32_t num_threads);
+
+  /** Initialize a CSV scanner over the file whose name is the given static string. */
+  void EmitCSVScannerInit(LocalVar scanner, LocalVar exec_ctx, LocalVar file_name, uint32_t file_name_len,
+                          uint32_t num_cols, uint32_t delimiter, uint32_t quote, uint32_t escape);
+
+  /** Emit a parallel scan of the given CSV scanner. */
+  void EmitParallelCSVScan(LocalVar scanner, LocalVar query_state, FunctionId scan_fn);
 
   /** Emit a register hook function. */
   void EmitRegisterHook(LocalVar exec_ctx, LocalVar hook_idx, FunctionId hook_fn);
@@ -349,9 +356,20 @@ class BytecodeEmitter {
   void EmitAggHashTableParallelPartitionedScan(LocalVar agg_ht, LocalVar context, LocalVar tls,
                                                FunctionId scan_part_fn);
 
+  /** Emit code to build a join hash table and join it with materialized probe tuples. */
+  void EmitJoinHashTableBuildAndJoin(Bytecode bytecode, LocalVar join_ht, LocalVar probe_join_ht, LocalVar context,
+                                     LocalVar state, FunctionId join_fn);
+
+  /** Emit code to scan a join hash table in parallel. */
+  void EmitJoinHashTableParallelScan(LocalVar join_ht, LocalVar context, LocalVar tls, FunctionId scan_fn);
+
   /** Initialize a sorter instance. */
   void EmitSorterInit(Bytecode bytecode, LocalVar sorter, LocalVar exec_ctx, FunctionId cmp_fn, LocalVar tuple_size);
 
+  /** Emit code to scan the partitions of a sorter in parallel. */
+  void EmitSorterScanPartitionsParallel(LocalVar sorter, LocalVar context, LocalVar tls, FunctionId same_partition_fn,
+                                        FunctionId scan_fn);
+
   /** Initialize a CSV reader. */
   // void EmitCSVReaderInit(LocalVar creader, LocalVar file_name, uint32_t file_name_len);
 
@@ -81,9 +81,12 @@ class BytecodeGenerator final : public ast::AstVisitor<BytecodeGenerator> {
   void VisitSqlConversionCall(ast::CallExpr *call, ast::Builtin builtin);
   void VisitNullValueCall(ast::CallExpr *call, ast::Builtin builtin);
   void VisitSqlStringLikeCall(ast::CallExpr *call);
+  void VisitLikePatternCall(ast::CallExpr *call, ast::Builtin builtin);
   void VisitBuiltinDateFunctionCall(ast::CallExpr *call, ast::Builtin builtin);
   void VisitBuiltinTableIterCall(ast::CallExpr *call, ast::Builtin builtin);
   void VisitBuiltinTableIterParallelCall(ast::CallExpr *call);
+  void VisitBuiltinCSVScanCall(ast::CallExpr *call, ast::Builtin builtin);
+  void VisitBuiltinCSVScanParallelCall(ast::CallExpr *call);
   void VisitBuiltinVPICall(ast::CallExpr *call, ast::Builtin builtin);
   void VisitBuiltinHashCall(ast::CallExpr *call);
   void VisitBuiltinFilterManagerCall(ast::CallExpr *call, ast::Builtin builtin);
@@ -97,6 +100,7 @@ class BytecodeGenerator final : public ast::AstVisitor<BytecodeGenerator> {
   void VisitBuiltinJoinHashTableIteratorCall(ast::CallExpr *call, ast::Builtin builtin);
   void VisitBuiltinSorterCall(ast::CallExpr *call, ast::Builtin builtin);
   void VisitBuiltinSorterIterCall(ast::CallExpr *call, ast::Builtin builtin);
+  void VisitBuiltinSegmentTreeCall(ast::CallExpr *call, ast::Builtin builtin);
   void VisitResultBufferCall(ast::CallExpr *call, ast::Builtin builtin);
   void VisitCSVReaderCall(ast::CallExpr *call, ast::Builtin builtin);
   void VisitExecutionContextCall(ast::CallExpr *call, ast::Builtin builtin);
@@ -8,6 +8,7 @@
 #include "execution/exec/execution_context.h"
 #include "execution/sql/aggregation_hash_table.h"
 #include "execution/sql/aggregators.h"
+#include "execution/sql/csv_scanner.h"
 #include "execution/sql/filter_manager.h"
 #include "execution/sql/functions/arithmetic_functions.h"
 #include "execution/sql/functions/casting_functions.h"
@@ -19,6 +20,8 @@
 #include "execution/sql/index_iterator.h"
 #include "execution/sql/join_hash_table.h"
 #include "execution/sql/operators/hash_operators.h"
+#include "execution/sql/operators/like_operators.h"
+#include "execution/sql/segment_tree.h"
 #include "execution/sql/sorter.h"
 #include "execution/sql/sql_def.h"
 #include "execution/sql/storage_interface.h"
@@ -321,9 +324,34 @@ VM_OP_HOT void OpTableVectorIteratorGetVPI(noisepage::execution::sql::VectorProj
 
 VM_OP_HOT void OpParallelScanTable(uint32_t table_oid, uint32_t *col_oids, uint32_t num_oids, void *const query_state,
                                    noisepage::execution::exec::ExecutionContext *exec_ctx,
-                                   const noisepage::execution::sql::TableVectorIterator::ScanFn scanner) {
+                                   const noisepage::execution::sql::TableVectorIterator::ScanFn scanner,
+                                   uint32_t num_threads) {
   noisepage::execution::sql::TableVectorIterator::ParallelScan(table_oid, col_oids, num_oids, query_state, exec_ctx,
-                                                               scanner);
+                                                               scanner, num_threads);
+}
+
+// ---------------------------------------------------------
+// CSV Scanner
+// ---------------------------------------------------------
+
+VM_OP void OpCSVScannerInit(noisepage::execution::sql::CSVScanner *scanner,
+                            noisepage::execution::exec::ExecutionContext *exec_ctx, const uint8_t *file_name,
+                            uint32_t len, uint32_t num_cols, uint32_t delimiter, uint32_t quote, uint32_t escape);
+
+VM_OP_HOT void OpCSVScannerNext(bool *has_more, noisepage::execution::sql::CSVScanner *scanner) {
+  *has_more = scanner->Advance();
+}
+
+VM_OP_HOT void OpCSVScannerGetVPI(noisepage::execution::sql::VectorProjectionIterator **vpi,
+                                  noisepage::execution::sql::CSVScanner *scanner) {
+  *vpi = scanner->GetVectorProjectionIterator();
+}
+
+VM_OP void OpCSVScannerFree(noisepage::execution::sql::CSVScanner *scanner);
+
+VM_OP_HOT void OpParallelScanCSV(noisepage::execution::sql::CSVScanner *scanner, void *const query_state,
+                                 const noisepage::execution::sql::CSVScanner::ScanFn scan_fn) {
+  scanner->ParallelScan(query_state, scan_fn);
 }
 
 // ---------------------------------------------------------
@@ -804,6 +832,10 @@ VM_OP_HOT void OpModReal(noisepage::execution::sql::Real *const result,
 VM_OP void OpAggregationHashTableInit(noisepage::execution::sql::AggregationHashTable *agg_hash_table,
                                       noisepage::execution::exec::ExecutionContext *exec_ctx, uint32_t payload_size);
 
+VM_OP void OpAggregationHashTableInitWithSize(noisepage::execution::sql::AggregationHashTable *agg_hash_table,
+                                              noisepage::execution::exec::ExecutionContext *exec_ctx,
+                                              uint32_t payload_size, uint32_t initial_size);
+
 VM_OP void OpAggregationHashTableGetTupleCount(uint32_t *result,
                                                noisepage::execution::sql::AggregationHashTable *agg_hash_table);
 
@@ -923,6 +955,17 @@ VM_OP_HOT void OpCountAggregateAdvance(noisepage::execution::sql::CountAggregate
   agg->Advance(*val);
 }
 
+VM_OP_HOT void OpCountAggregateAdvanceVector(noisepage::execution::sql::CountAggregate *agg,
+                                             const noisepage::execution::sql::VectorProjectionIterator *vpi,
+                                             uint32_t col_idx) {
+  agg->AdvanceVector(*vpi->GetVectorProjection()->GetColumn(col_idx));
+}
+
+VM_OP_HOT void OpCountAggregateAdvanceVectorRows(noisepage::execution::sql::CountAggregate *agg,
+                                                 const noisepage::execution::sql::VectorProjectionIterator *vpi) {
+  agg->AdvanceVector(vpi->GetSelectedTupleCount());
+}
+
 VM_OP_HOT void OpCountAggregateMerge(noisepage::execution::sql::CountAggregate *agg_1,
                                      const noisepage::execution::sql::CountAggregate *agg_2) {
   agg_1->Merge(*agg_2);
@@ -950,6 +993,11 @@ VM_OP_HOT void OpCountStarAggregateAdvance(noisepage::execution::sql::CountStarA
   agg->Advance(*val);
 }
 
+VM_OP_HOT void OpCountStarAggregateAdvanceVector(noisepage::execution::sql::CountStarAggregate *agg,
+                                                 const noisepage::execution::sql::VectorProjectionIterator *vpi) {
+  agg->AdvanceVector(vpi->GetSelectedTupleCount());
+}
+
 VM_OP_HOT void OpCountStarAggregateMerge(noisepage::execution::sql::CountStarAggregate *agg_1,
                                          const noisepage::execution::sql::CountStarAggregate *agg_2) {
   agg_1->Merge(*agg_2);
@@ -979,6 +1027,12 @@ VM_OP_HOT void OpIntegerSumAggregateAdvance(noisepage::execution::sql::IntegerSu
   agg->Advance(*val);
 }
 
+VM_OP_HOT void OpIntegerSumAggregateAdvanceVector(noisepage::execution::sql::IntegerSumAggregate *agg,
+                                                  const noisepage::execution::sql::VectorProjectionIterator *vpi,
+                                                  uint32_t col_idx) {
+  agg->AdvanceVector(*vpi->GetVectorProjection()->GetColumn(col_idx));
+}
+
 VM_OP_HOT void OpIntegerSumAggregateMerge(noisepage::execution::sql::IntegerSumAggregate *agg_1,
                                           const noisepage::execution::sql::IntegerSumAggregate *agg_2) {
   agg_1->Merge(*agg_2);
@@ -1004,6 +1058,12 @@ VM_OP_HOT void OpRealSumAggregateAdvance(noisepage::execution::sql::RealSumAggre
   agg->Advance(*val);
 }
 
+VM_OP_HOT void OpRealSumAggregateAdvanceVector(noisepage::execution::sql::RealSumAggregate *agg,
+                                               const noisepage::execution::sql::VectorProjectionIterator *vpi,
+                                               uint32_t col_idx) {
+  agg->AdvanceVector(*vpi->GetVectorProjection()->GetColumn(col_idx));
+}
+
 VM_OP_HOT void OpRealSumAggregateMerge(noisepage::execution::sql::RealSumAggregate *agg_1,
                                        const noisepage::execution::sql::RealSumAggregate *agg_2) {
   agg_1->Merge(*agg_2);
@@ -1031,6 +1091,12 @@ VM_OP_HOT void OpIntegerMaxAggregateAdvance(noisepage::execution::sql::IntegerMa
   agg->Advance(*val);
 }
 
+VM_OP_HOT void OpIntegerMaxAggregateAdvanceVector(noisepage::execution::sql::IntegerMaxAggregate *agg,
+                                                  const noisepage::execution::sql::VectorProjectionIterator *vpi,
+                                                  uint32_t col_idx) {
+  agg->AdvanceVector(*vpi->GetVectorProjection()->GetColumn(col_idx));
+}
+
 VM_OP_HOT void OpIntegerMaxAggregateMerge(noisepage::execution::sql::IntegerMaxAggregate *agg_1,
                                           const noisepage::execution::sql::IntegerMaxAggregate *agg_2) {
   agg_1->Merge(*agg_2);
@@ -1056,6 +1122,12 @@ VM_OP_HOT void OpRealMaxAggregateAdvance(noisepage::execution::sql::RealMaxAggre
   agg->Advance(*val);
 }
 
+VM_OP_HOT void OpRealMaxAggregateAdvanceVector(noisepage::execution::sql::RealMaxAggregate *agg,
+                                               const noisepage::execution::sql::VectorProjectionIterator *vpi,
+                                               uint32_t col_idx) {
+  agg->AdvanceVector(*vpi->GetVectorProjection()->GetColumn(col_idx));
+}
+
 VM_OP_HOT void OpRealMaxAggregateMerge(noisepage::execution::sql::RealMaxAggregate *agg_1,
                                        const noisepage::execution::sql::RealMaxAggregate *agg_2) {
   agg_1->Merge(*agg_2);
@@ -1131,6 +1203,12 @@ VM_OP_HOT void OpIntegerMinAggregateAdvance(noisepage::execution::sql::IntegerMi
   agg->Advance(*val);
 }
 
+VM_OP_HOT void OpIntegerMinAggregateAdvanceVector(noisepage::execution::sql::IntegerMinAggregate *agg,
+                                                  const noisepage::execution::sql::VectorProjectionIterator *vpi,
+                                                  uint32_t col_idx) {
+  agg->AdvanceVector(*vpi->GetVectorProjection()->GetColumn(col_idx));
+}
+
 VM_OP_HOT void OpIntegerMinAggregateMerge(noisepage::execution::sql::IntegerMinAggregate *agg_1,
                                           const noisepage::execution::sql::IntegerMinAggregate *agg_2) {
   agg_1->Merge(*agg_2);
@@ -1156,6 +1234,12 @@ VM_OP_HOT void OpRealMinAggregateAdvance(noisepage::execution::sql::RealMinAggre
   agg->Advance(*val);
 }
 
+VM_OP_HOT void OpRealMinAggregateAdvanceVector(noisepage::execution::sql::RealMinAggregate *agg,
+                                               const noisepage::execution::sql::VectorProjectionIterator *vpi,
+                                               uint32_t col_idx) {
+  agg->AdvanceVector(*vpi->GetVectorProjection()->GetColumn(col_idx));
+}
+
 VM_OP_HOT void OpRealMinAggregateMerge(noisepage::execution::sql::RealMinAggregate *agg_1,
                                        const noisepage::execution::sql::RealMinAggregate *agg_2) {
   agg_1->Merge(*agg_2);
@@ -1236,6 +1320,12 @@ VM_OP_HOT void OpAvgAggregateAdvanceReal(noisepage::execution::sql::AvgAggregate
   agg->Advance(*val);
 }
 
+VM_OP_HOT void OpAvgAggregateAdvanceVector(noisepage::execution::sql::AvgAggregate *agg,
+                                           const noisepage::execution::sql::VectorProjectionIterator *vpi,
+                                           uint32_t col_idx) {
+  agg->AdvanceVector(*vpi->GetVectorProjection()->GetColumn(col_idx));
+}
+
 VM_OP_HOT void OpAvgAggregateMerge(noisepage::execution::sql::AvgAggregate *agg_1,
                                    const noisepage::execution::sql::AvgAggregate *agg_2) {
   agg_1->Merge(*agg_2);
@@ -1318,12 +1408,38 @@ VM_OP void OpJoinHashTableBuildParallel(noisepage::execution::sql::JoinHashTable
                                         noisepage::execution::sql::ThreadStateContainer *thread_state_container,
                                         uint32_t jht_offset);
 
+VM_OP void OpJoinHashTableMoveTuplesParallel(noisepage::execution::sql::JoinHashTable *join_hash_table,
+                                             noisepage::execution::sql::ThreadStateContainer *thread_state_container,
+                                             uint32_t jht_offset);
+
+VM_OP_HOT void OpJoinHashTableBuildAndJoin(noisepage::execution::sql::JoinHashTable *const join_hash_table,
+                                           noisepage::execution::sql::JoinHashTable *const probe_join_hash_table,
+                                           void *const query_state, void *const pipeline_state,
+                                           const noisepage::execution::sql::JoinHashTable::JoinFn join_fn) {
+  join_hash_table->BuildAndJoin(probe_join_hash_table, query_state, pipeline_state, join_fn);
+}
+
+VM_OP_HOT void OpJoinHashTableBuildAndJoinParallel(
+    noisepage::execution::sql::JoinHashTable *const join_hash_table,
+    noisepage::execution::sql::JoinHashTable *const probe_join_hash_table, void *const query_state,
+    noisepage::execution::sql::ThreadStateContainer *const thread_state_container,
+    const noisepage::execution::sql::JoinHashTable::JoinFn join_fn) {
+  join_hash_table->BuildAndJoinParallel(probe_join_hash_table, query_state, thread_state_container, join_fn);
+}
+
 VM_OP_HOT void OpJoinHashTableLookup(noisepage::execution::sql::JoinHashTable *join_hash_table,
                                      noisepage::execution::sql::HashTableEntryIterator *ht_entry_iter,
                                      const noisepage::hash_t hash_val) {
   *ht_entry_iter = join_hash_table->Lookup<false>(hash_val);
 }
 
+VM_OP_HOT void OpJoinHashTableParallelScan(
+    noisepage::execution::sql::JoinHashTable *const join_hash_table, void *const query_state,
+    noisepage::execution::sql::ThreadStateContainer *const thread_state_container,
+    const noisepage::execution::sql::JoinHashTable::ScanFn scan_fn) {
+  join_hash_table->ExecuteParallelScan(query_state, thread_state_container, scan_fn);
+}
+
 VM_OP void OpJoinHashTableFree(noisepage::execution::sql::JoinHashTable *join_hash_table);
 
 VM_OP_HOT void OpHashTableEntryIteratorHasNext(bool *has_next,
@@ -1387,6 +1503,12 @@ VM_OP void OpSorterSortTopKParallel(noisepage::execution::sql::Sorter *sorter,
                                     noisepage::execution::sql::ThreadStateContainer *thread_state_container,
                                     uint32_t sorter_offset, uint64_t top_k);
 
+VM_OP void OpSorterScanPartitionsParallel(
+    const noisepage::execution::sql::Sorter *sorter, void *query_state,
+    noisepage::execution::sql::ThreadStateContainer *thread_state_container,
+    noisepage::execution::sql::Sorter::PartitionEqualityFn same_partition_fn,
+    noisepage::execution::sql::Sorter::ScanPartitionsFn scan_fn);
+
 VM_OP void OpSorterFree(noisepage::execution::sql::Sorter *sorter);
 
 VM_OP void OpSorterIteratorInit(noisepage::execution::sql::SorterIterator *iter,
@@ -1408,6 +1530,41 @@ VM_OP_WARM void OpSorterIteratorSkipRows(noisepage::execution::sql::SorterIterat
 
 VM_OP void OpSorterIteratorFree(noisepage::execution::sql::SorterIterator *iter);
 
+// ---------------------------------------------------------
+// Segment Tree
+// ---------------------------------------------------------
+
+VM_OP void OpSegmentTreeInit(noisepage::execution::sql::SegmentTree *tree,
+                             noisepage::execution::exec::ExecutionContext *exec_ctx, uint32_t kind);
+
+VM_OP_HOT void OpSegmentTreeAppendInteger(noisepage::execution::sql::SegmentTree *tree,
+                                          const noisepage::execution::sql::Integer *val) {
+  tree->Append(*val);
+}
+
+VM_OP_HOT void OpSegmentTreeAppendReal(noisepage::execution::sql::SegmentTree *tree,
+                                       const noisepage::execution::sql::Real *val) {
+  tree->Append(*val);
+}
+
+VM_OP_WARM void OpSegmentTreeBuild(noisepage::execution::sql::SegmentTree *tree) { tree->Build(); }
+
+VM_OP_HOT void OpSegmentTreeQueryInteger(noisepage::execution::sql::Integer *result,
+                                         const noisepage::execution::sql::SegmentTree *tree, const uint64_t begin,
+                                         const uint64_t end) {
+  tree->Query(begin, end, result);
+}
+
+VM_OP_HOT void OpSegmentTreeQueryReal(noisepage::execution::sql::Real *result,
+                                      const noisepage::execution::sql::SegmentTree *tree, const uint64_t begin,
+                                      const uint64_t end) {
+  tree->Query(begin, end, result);
+}
+
+VM_OP_WARM void OpSegmentTreeReset(noisepage::execution::sql::SegmentTree *tree) { tree->Reset(); }
+
+VM_OP void OpSegmentTreeFree(noisepage::execution::sql::SegmentTree *tree);
+
 // ---------------------------------------------------------
 // Output
 // ---------------------------------------------------------
@@ -1709,6 +1866,17 @@ VM_OP_WARM void OpLike(noisepage::execution::sql::BoolVal *result, const noisepa
   noisepage::execution::sql::StringFunctions::Like(result, nullptr, *str, *pattern);
 }
 
+VM_OP void OpLikePatternInit(noisepage::execution::sql::LikePattern *pattern,
+                             const noisepage::execution::sql::StringVal *str);
+
+VM_OP_HOT void OpLikePatternMatch(noisepage::execution::sql::BoolVal *result,
+                                  const noisepage::execution::sql::StringVal *str,
+                                  const noisepage::execution::sql::LikePattern *pattern) {
+  noisepage::execution::sql::StringFunctions::Like(result, nullptr, *str, *pattern);
+}
+
+VM_OP void OpLikePatternFree(noisepage::execution::sql::LikePattern *pattern);
+
 VM_OP_WARM void OpLength(noisepage::execution::sql::Integer *result, noisepage::execution::exec::ExecutionContext *ctx,
                          const noisepage::execution::sql::StringVal *str) {
   noisepage::execution::sql::StringFunctions::Length(result, ctx, *str);
@@ -1863,11 +2031,24 @@ VM_OP void OpIndexIteratorPerformInit(noisepage::execution::sql::IndexIterator *
 
 VM_OP_WARM void OpIndexIteratorScanKey(noisepage::execution::sql::IndexIterator *iter) { iter->ScanKey(); }
 
+VM_OP_WARM void OpIndexIteratorAddBatchKey(noisepage::execution::sql::IndexIterator *iter) { iter->AddBatchKey(); }
+
+VM_OP_WARM void OpIndexIteratorScanKeyBatch(noisepage::execution::sql::IndexIterator *iter) { iter->ScanKeyBatch(); }
+
+VM_OP_WARM void OpIndexIteratorSelectBatchResult(noisepage::execution::sql::IndexIterator *iter, uint32_t key_idx) {
+  iter->SelectBatchResult(key_idx);
+}
+
 VM_OP_WARM void OpIndexIteratorScanAscending(noisepage::execution::sql::IndexIterator *iter,
                                              noisepage::storage::index::ScanType scan_type, uint32_t limit) {
   iter->ScanAscending(scan_type, limit);
 }
 
+VM_OP_WARM void OpIndexIteratorScanAscendingKeys(noisepage::execution::sql::IndexIterator *iter,
+                                                 noisepage::storage::index::ScanType scan_type, uint32_t limit) {
+  iter->ScanAscendingKeys(scan_type, limit);
+}
+
 VM_OP_WARM void OpIndexIteratorScanDescending(noisepage::execution::sql::IndexIterator *iter) {
   iter->ScanDescending();
 }
@@ -1900,6 +2081,11 @@ VM_OP_WARM void OpIndexIteratorGetTablePR(noisepage::storage::ProjectedRow **pr,
   *pr = iter->TablePR();
 }
 
+VM_OP_WARM void OpIndexIteratorGetKeyPR(noisepage::storage::ProjectedRow **pr,
+                                        noisepage::execution::sql::IndexIterator *iter) {
+  *pr = iter->KeyPR();
+}
+
 VM_OP_WARM void OpIndexIteratorGetSlot(noisepage::storage::TupleSlot *slot,
                                        noisepage::execution::sql::IndexIterator *iter) {
   *slot = iter->CurrentSlot();
@@ -2094,6 +2280,22 @@ VM_OP void OpStorageInterfaceIndexInsertWithSlot(bool *result,
                                                  noisepage::execution::sql::StorageInterface *storage_interface,
                                                  noisepage::storage::TupleSlot *tuple_slot, bool unique);
 
+VM_OP void OpStorageInterfaceIndexInsertBatch(bool *result,
+                                              noisepage::execution::sql::StorageInterface *storage_interface);
+
+VM_OP void OpStorageInterfaceIndexDeleteBatch(noisepage::execution::sql::StorageInterface *storage_interface,
+                                              noisepage::storage::TupleSlot *tuple_slot);
+
+VM_OP void OpStorageInterfaceIndexFlushBatches(bool *result,
+                                               noisepage::execution::sql::StorageInterface *storage_interface);
+
+VM_OP void OpStorageInterfaceIndexBulkLoadStage(bool *result,
+                                                noisepage::execution::sql::StorageInterface *storage_interface,
+                                                noisepage::storage::TupleSlot *tuple_slot);
+
+VM_OP void OpStorageInterfaceIndexBulkLoad(bool *result,
+                                           noisepage::execution::sql::StorageInterface *storage_interface);
+
 VM_OP void OpStorageInterfaceIndexDelete(noisepage::execution::sql::StorageInterface *storage_interface,
                                          noisepage::storage::TupleSlot *tuple_slot);
 
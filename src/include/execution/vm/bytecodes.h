@@ -136,7 +136,15 @@ namespace noisepage::execution::vm {
   F(TableVectorIteratorGetVPINumTuples, OperandType::Local, OperandType::Local)                                       \
   F(TableVectorIteratorGetVPI, OperandType::Local, OperandType::Local)                                                \
   F(ParallelScanTable, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Local,                \
-    OperandType::Local, OperandType::FunctionId)                                                                      \
+    OperandType::Local, OperandType::FunctionId, OperandType::UImm4)                                                  \
+                                                                                                                      \
+  /* CSV Scanner */                                                                                                   \
+  F(CSVScannerInit, OperandType::Local, OperandType::Local, OperandType::StaticLocal, OperandType::UImm4,             \
+    OperandType::UImm4, OperandType::UImm4, OperandType::UImm4, OperandType::UImm4)                                   \
+  F(CSVScannerNext, OperandType::Local, OperandType::Local)                                                           \
+  F(CSVScannerGetVPI, OperandType::Local, OperandType::Local)                                                         \
+  F(CSVScannerFree, OperandType::Local)                                                                               \
+  F(ParallelScanCSV, OperandType::Local, OperandType::Local, OperandType::FunctionId)                                 \
                                                                                                                       \
   /* Vector Projection Iterator (VPI) */                                                                              \
   F(VPIInit, OperandType::Local, OperandType::Local)                                                                  \
@@ -337,6 +345,7 @@ namespace noisepage::execution::vm {
                                                                                                                       \
   /* Aggregation Hash Table */                                                                                        \
   F(AggregationHashTableInit, OperandType::Local, OperandType::Local, OperandType::Local)                             \
+  F(AggregationHashTableInitWithSize, OperandType::Local, OperandType::Local, OperandType::Local, OperandType::Local) \
   F(AggregationHashTableGetTupleCount, OperandType::Local, OperandType::Local)                                        \
   F(AggregationHashTableGetInsertCount, OperandType::Local, OperandType::Local)                                       \
   F(AggregationHashTableAllocTuple, OperandType::Local, OperandType::Local, OperandType::Local)                       \
@@ -368,12 +377,15 @@ namespace noisepage::execution::vm {
   /* COUNT Aggregates */                                                                                              \
   F(CountAggregateInit, OperandType::Local)                                                                           \
   F(CountAggregateAdvance, OperandType::Local, OperandType::Local)                                                    \
+  F(CountAggregateAdvanceVector, OperandType::Local, OperandType::Local, OperandType::Local)                          \
+  F(CountAggregateAdvanceVectorRows, OperandType::Local, OperandType::Local)                                          \
   F(CountAggregateMerge, OperandType::Local, OperandType::Local)                                                      \
   F(CountAggregateReset, OperandType::Local)                                                                          \
   F(CountAggregateGetResult, OperandType::Local, OperandType::Local)                                                  \
   F(CountAggregateFree, OperandType::Local)                                                                           \
   F(CountStarAggregateInit, OperandType::Local)                                                                       \
   F(CountStarAggregateAdvance, OperandType::Local, OperandType::Local)                                                \
+  F(CountStarAggregateAdvanceVector, OperandType::Local, OperandType::Local)                                          \
   F(CountStarAggregateMerge, OperandType::Local, OperandType::Local)                                                  \
   F(CountStarAggregateReset, OperandType::Local)                                                                      \
   F(CountStarAggregateGetResult, OperandType::Local, OperandType::Local)                                              \
@@ -381,12 +393,14 @@ namespace noisepage::execution::vm {
   /* SUM Aggregates */                                                                                                \
   F(IntegerSumAggregateInit, OperandType::Local)                                                                      \
   F(IntegerSumAggregateAdvance, OperandType::Local, OperandType::Local)                                               \
+  F(IntegerSumAggregateAdvanceVector, OperandType::Local, OperandType::Local, OperandType::Local)                     \
   F(IntegerSumAggregateMerge, OperandType::Local, OperandType::Local)                                                 \
   F(IntegerSumAggregateReset, OperandType::Local)                                                                     \
   F(IntegerSumAggregateGetResult, OperandType::Local, OperandType::Local)                                             \
   F(IntegerSumAggregateFree, OperandType::Local)                                                                      \
   F(RealSumAggregateInit, OperandType::Local)                                                                         \
   F(RealSumAggregateAdvance, OperandType::Local, OperandType::Local)                                                  \
+  F(RealSumAggregateAdvanceVector, OperandType::Local, OperandType::Local, OperandType::Local)                        \
   F(RealSumAggregateMerge, OperandType::Local, OperandType::Local)                                                    \
   F(RealSumAggregateReset, OperandType::Local)                                                                        \
   F(RealSumAggregateGetResult, OperandType::Local, OperandType::Local)                                                \
@@ -394,12 +408,14 @@ namespace noisepage::execution::vm {
   /* MAX Aggregates */                                                                                                \
   F(IntegerMaxAggregateInit, OperandType::Local)                                                                      \
   F(IntegerMaxAggregateAdvance, OperandType::Local, OperandType::Local)                                               \
+  F(IntegerMaxAggregateAdvanceVector, OperandType::Local, OperandType::Local, OperandType::Local)                     \
   F(IntegerMaxAggregateMerge, OperandType::Local, OperandType::Local)                                                 \
   F(IntegerMaxAggregateReset, OperandType::Local)                                                                     \
   F(IntegerMaxAggregateGetResult, OperandType::Local, OperandType::Local)                                             \
   F(IntegerMaxAggregateFree, OperandType::Local)                                                                      \
   F(RealMaxAggregateInit, OperandType::Local)                                                                         \
   F(RealMaxAggregateAdvance, OperandType::Local, OperandType::Local)                                                  \
+  F(RealMaxAggregateAdvanceVector, OperandType::Local, OperandType::Local, OperandType::Local)                        \
   F(RealMaxAggregateMerge, OperandType::Local, OperandType::Local)                                                    \
   F(RealMaxAggregateReset, OperandType::Local)                                                                        \
   F(RealMaxAggregateGetResult, OperandType::Local, OperandType::Local)                                                \
@@ -419,12 +435,14 @@ namespace noisepage::execution::vm {
   /* MIN Aggregates */                                                                                                \
   F(IntegerMinAggregateInit, OperandType::Local)                                                                      \
   F(IntegerMinAggregateAdvance, OperandType::Local, OperandType::Local)                                               \
+  F(IntegerMinAggregateAdvanceVector, OperandType::Local, OperandType::Local, OperandType::Local)                     \
   F(IntegerMinAggregateMerge, OperandType::Local, OperandType::Local)                                                 \
   F(IntegerMinAggregateReset, OperandType::Local)                                                                     \
   F(IntegerMinAggregateGetResult, OperandType::Local, OperandType::Local)                                             \
   F(IntegerMinAggregateFree, OperandType::Local)                                                                      \
   F(RealMinAggregateInit, OperandType::Local)                                                                         \
   F(RealMinAggregateAdvance, OperandType::Local, OperandType::Local)                                                  \
+  F(RealMinAggregateAdvanceVector, OperandType::Local, OperandType::Local, OperandType::Local)                        \
   F(RealMinAggregateMerge, OperandType::Local, OperandType::Local)                                                    \
   F(RealMinAggregateReset, OperandType::Local)                                                                        \
   F(RealMinAggregateGetResult, OperandType::Local, OperandType::Local)                                                \
@@ -445,6 +463,7 @@ namespace noisepage::execution::vm {
   F(AvgAggregateInit, OperandType::Local)                                                                             \
   F(AvgAggregateAdvanceInteger, OperandType::Local, OperandType::Local)                                               \
   F(AvgAggregateAdvanceReal, OperandType::Local, OperandType::Local)                                                  \
+  F(AvgAggregateAdvanceVector, OperandType::Local, OperandType::Local, OperandType::Local)                            \
   F(AvgAggregateMerge, OperandType::Local, OperandType::Local)                                                        \
   F(AvgAggregateReset, OperandType::Local)                                                                            \
   F(AvgAggregateGetResult, OperandType::Local, OperandType::Local)                                                    \
@@ -542,7 +561,13 @@ namespace noisepage::execution::vm {
   F(JoinHashTableGetTupleCount, OperandType::Local, OperandType::Local)                                               \
   F(JoinHashTableBuild, OperandType::Local)                                                                           \
   F(JoinHashTableBuildParallel, OperandType::Local, OperandType::Local, OperandType::Local)                           \
+  F(JoinHashTableMoveTuplesParallel, OperandType::Local, OperandType::Local, OperandType::Local)                      \
+  F(JoinHashTableBuildAndJoin, OperandType::Local, OperandType::Local, OperandType::Local, OperandType::Local,        \
+    OperandType::FunctionId)                                                                                          \
+  F(JoinHashTableBuildAndJoinParallel, OperandType::Local, OperandType::Local, OperandType::Local,                    \
+    OperandType::Local, OperandType::FunctionId)                                                                      \
   F(JoinHashTableLookup, OperandType::Local, OperandType::Local, OperandType::Local)                                  \
+  F(JoinHashTableParallelScan, OperandType::Local, OperandType::Local, OperandType::Local, OperandType::FunctionId)   \
   F(JoinHashTableFree, OperandType::Local)                                                                            \
   F(HashTableEntryIteratorHasNext, OperandType::Local, OperandType::Local)                                            \
   F(HashTableEntryIteratorGetRow, OperandType::Local, OperandType::Local)                                             \
@@ -561,6 +586,8 @@ namespace noisepage::execution::vm {
   F(SorterSort, OperandType::Local)                                                                                   \
   F(SorterSortParallel, OperandType::Local, OperandType::Local, OperandType::Local)                                   \
   F(SorterSortTopKParallel, OperandType::Local, OperandType::Local, OperandType::Local, OperandType::Local)           \
+  F(SorterScanPartitionsParallel, OperandType::Local, OperandType::Local, OperandType::Local, OperandType::FunctionId, \
+    OperandType::FunctionId)                                                                                          \
   F(SorterFree, OperandType::Local)                                                                                   \
   F(SorterIteratorInit, OperandType::Local, OperandType::Local)                                                       \
   F(SorterIteratorGetRow, OperandType::Local, OperandType::Local)                                                     \
@@ -569,6 +596,16 @@ namespace noisepage::execution::vm {
   F(SorterIteratorSkipRows, OperandType::Local, OperandType::Local)                                                   \
   F(SorterIteratorFree, OperandType::Local)                                                                           \
                                                                                                                       \
+  /* Segment Tree */                                                                                                  \
+  F(SegmentTreeInit, OperandType::Local, OperandType::Local, OperandType::Local)                                      \
+  F(SegmentTreeAppendInteger, OperandType::Local, OperandType::Local)                                                 \
+  F(SegmentTreeAppendReal, OperandType::Local, OperandType::Local)                                                    \
+  F(SegmentTreeBuild, OperandType::Local)                                                                             \
+  F(SegmentTreeQueryInteger, OperandType::Local, OperandType::Local, OperandType::Local, OperandType::Local)          \
+  F(SegmentTreeQueryReal, OperandType::Local, OperandType::Local, OperandType::Local, OperandType::Local)             \
+  F(SegmentTreeReset, OperandType::Local)                                                                             \
+  F(SegmentTreeFree, OperandType::Local)                                                                              \
+                                                                                                                      \
   /* Output */                                                                                                        \
   F(ResultBufferNew, OperandType::Local, OperandType::Local)                                                          \
   F(ResultBufferAllocOutputRow, OperandType::Local, OperandType::Local)                                               \
@@ -581,7 +618,11 @@ namespace noisepage::execution::vm {
   F(IndexIteratorGetSize, OperandType::Local, OperandType::Local)                                                     \
   F(IndexIteratorPerformInit, OperandType::Local)                                                                     \
   F(IndexIteratorScanKey, OperandType::Local)                                                                         \
+  F(IndexIteratorAddBatchKey, OperandType::Local)                                                                     \
+  F(IndexIteratorScanKeyBatch, OperandType::Local)                                                                    \
+  F(IndexIteratorSelectBatchResult, OperandType::Local, OperandType::Local)                                           \
   F(IndexIteratorScanAscending, OperandType::Local, OperandType::Local, OperandType::Local)                           \
+  F(IndexIteratorScanAscendingKeys, OperandType::Local, OperandType::Local, OperandType::Local)                       \
   F(IndexIteratorScanDescending, OperandType::Local)                                                                  \
   F(IndexIteratorScanLimitDescending, OperandType::Local, OperandType::Local)                                         \
   F(IndexIteratorFree, OperandType::Local)                                                                            \
@@ -590,6 +631,7 @@ namespace noisepage::execution::vm {
   F(IndexIteratorGetLoPR, OperandType::Local, OperandType::Local)                                                     \
   F(IndexIteratorGetHiPR, OperandType::Local, OperandType::Local)                                                     \
   F(IndexIteratorGetTablePR, OperandType::Local, OperandType::Local)                                                  \
+  F(IndexIteratorGetKeyPR, OperandType::Local, OperandType::Local)                                                    \
   F(IndexIteratorGetSlot, OperandType::Local, OperandType::Local)                                                     \
                                                                                                                       \
   /* CSV Reader */                                                                                                    \
@@ -658,6 +700,11 @@ namespace noisepage::execution::vm {
   F(StorageInterfaceIndexInsertUnique, OperandType::Local, OperandType::Local)                                        \
   F(StorageInterfaceIndexInsertWithSlot, OperandType::Local, OperandType::Local, OperandType::Local,                  \
     OperandType::Local)                                                                                               \
+  F(StorageInterfaceIndexInsertBatch, OperandType::Local, OperandType::Local)                                         \
+  F(StorageInterfaceIndexDeleteBatch, OperandType::Local, OperandType::Local)                                         \
+  F(StorageInterfaceIndexFlushBatches, OperandType::Local, OperandType::Local)                                        \
+  F(StorageInterfaceIndexBulkLoadStage, OperandType::Local, OperandType::Local, OperandType::Local)                   \
+  F(StorageInterfaceIndexBulkLoad, OperandType::Local, OperandType::Local)                                            \
   F(StorageInterfaceIndexDelete, OperandType::Local, OperandType::Local)                                              \
   F(StorageInterfaceFree, OperandType::Local)                                                                         \
                                                                                                                       \
@@ -714,6 +761,9 @@ namespace noisepage::execution::vm {
   F(Left, OperandType::Local, OperandType::Local, OperandType::Local, OperandType::Local)                             \
   F(Length, OperandType::Local, OperandType::Local, OperandType::Local)                                               \
   F(Like, OperandType::Local, OperandType::Local, OperandType::Local)                                                 \
+  F(LikePatternInit, OperandType::Local, OperandType::Local)                                                          \
+  F(LikePatternMatch, OperandType::Local, OperandType::Local, OperandType::Local)                                     \
+  F(LikePatternFree, OperandType::Local)                                                                              \
   F(Lower, OperandType::Local, OperandType::Local, OperandType::Local)                                                \
   F(LPad3Arg, OperandType::Local, OperandType::Local, OperandType::Local, OperandType::Local, OperandType::Local)     \
   F(LPad2Arg, OperandType::Local, OperandType::Local, OperandType::Local, OperandType::Local)                         \
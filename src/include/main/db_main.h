@@ -413,7 +413,8 @@ class DBMain {
         if (network_identity_ == "primary") {
           replication_manager = std::make_unique<replication::PrimaryReplicationManager>(
               messenger_layer->GetMessenger(), network_identity_, replication_port_, replication_hosts_path_,
-              common::ManagedPointer(empty_buffer_queue));
+              common::ManagedPointer(empty_buffer_queue), replication_compression_enable_, replication_send_window_,
+              std::chrono::milliseconds(replication_send_window_timeout_ms_));
         } else {
           replication_manager = std::make_unique<replication::ReplicaReplicationManager>(
               messenger_layer->GetMessenger(), network_identity_, replication_port_, replication_hosts_path_,
@@ -427,11 +428,14 @@ class DBMain {
                                    ? common::ManagedPointer(replication_manager)
                                          .CastManagedPointerTo<replication::PrimaryReplicationManager>()
                                    : nullptr;
+        const auto wal_io_backend = !wal_io_uring_enable_   ? storage::LogIoBackend::POSIX
+                                    : wal_direct_io_enable_ ? storage::LogIoBackend::IO_URING_DIRECT
+                                                            : storage::LogIoBackend::IO_URING;
         log_manager = std::make_unique<storage::LogManager>(
             wal_file_path_, wal_num_buffers_, std::chrono::microseconds{wal_serialization_interval_},
             std::chrono::microseconds{wal_persist_interval_}, wal_persist_threshold_,
             common::ManagedPointer(buffer_segment_pool), common::ManagedPointer(empty_buffer_queue), rep_manager_ptr,
-            common::ManagedPointer(thread_registry));
+            common::ManagedPointer(thread_registry), wal_segment_size_, wal_io_backend);
         log_manager->Start();
       }
 
@@ -486,7 +490,8 @@ class DBMain {
         recovery_manager = std::make_unique<storage::RecoveryManager>(
             log_provider, catalog_layer->GetCatalog(), txn_layer->GetTransactionManager(),
             txn_layer->GetDeferredActionManager(), common::ManagedPointer(replication_manager),
-            common::ManagedPointer(thread_registry), common::ManagedPointer(storage_layer->GetBlockStore()));
+            common::ManagedPointer(thread_registry), common::ManagedPointer(storage_layer->GetBlockStore()),
+            replication_apply_threads_);
         recovery_manager->StartRecovery();
       }
 
@@ -514,7 +519,7 @@ class DBMain {
             txn_layer->GetTransactionManager(), catalog_layer->GetCatalog(),
             common::ManagedPointer(replication_manager), common::ManagedPointer(recovery_manager),
             common::ManagedPointer(settings_manager), common::ManagedPointer(stats_storage), optimizer_timeout_,
-            use_query_cache_, execution_mode_);
+            use_query_cache_, execution_mode_, park_connection_on_commit_);
       }
 
       std::unique_ptr<NetworkLayer> network_layer = DISABLED;
@@ -708,6 +713,33 @@ class DBMain {
       return *this;
     }
 
+    /**
+     * @param value LogManager argument
+     * @return self reference for chaining
+     */
+    Builder &SetWalSegmentSize(const uint64_t value) {
+      wal_segment_size_ = value;
+      return *this;
+    }
+
+    /**
+     * @param value LogManager argument
+     * @return self reference for chaining
+     */
+    Builder &SetWalIoUringEnable(const bool value) {
+      wal_io_uring_enable_ = value;
+      return *this;
+    }
+
+    /**
+     * @param value LogManager argument
+     * @return self reference for chaining
+     */
+    Builder &SetWalDirectIoEnable(const bool value) {
+      wal_direct_io_enable_ = value;
+      return *this;
+    }
+
     /**
      * @param value use component
      * @return self reference for chaining
@@ -861,6 +893,15 @@ class DBMain {
       return *this;
     }
 
+    /**
+     * @param value whether connections are parked instead of blocked while their commits become durable
+     * @return self reference for chaining
+     */
+    Builder &SetParkConnectionOnCommit(const bool value) {
+      park_connection_on_commit_ = value;
+      return *this;
+    }
+
     /**
      * @param value use component
      * @return self reference for chaining
@@ -929,6 +970,9 @@ class DBMain {
     uint64_t record_buffer_segment_reuse_ = 1e4;
     uint64_t wal_num_buffers_ = 100;
     uint64_t wal_persist_threshold_ = static_cast<uint64_t>(1 << 20);
+    uint64_t wal_segment_size_ = 0;
+    bool wal_io_uring_enable_ = false;
+    bool wal_direct_io_enable_ = false;
     uint64_t pilot_interval_ = 1e7;
     uint64_t forecast_train_interval_ = 120e7;
     uint64_t workload_forecast_interval_ = 1e6;
@@ -991,10 +1035,15 @@ class DBMain {
     bool use_execution_ = false;
     bool use_traffic_cop_ = false;
     bool use_query_cache_ = true;
+    bool park_connection_on_commit_ = true;
     bool use_network_ = false;
     bool use_messenger_ = false;
     bool use_replication_ = false;
     bool async_replication_enable_ = false;
+    bool replication_compression_enable_ = false;
+    uint64_t replication_send_window_ = 64;
+    uint32_t replication_send_window_timeout_ms_ = 1000;
+    uint32_t replication_apply_threads_ = 1;
     bool use_model_server_ = false;
     bool model_server_enable_python_coverage_ = false;
     bool use_pilot_thread_ = false;
@@ -1025,6 +1074,9 @@ class DBMain {
         wal_persist_interval_ = settings_manager->GetInt(settings::Param::wal_persist_interval);
         wal_persist_threshold_ =
             static_cast<uint64_t>(settings_manager->GetInt64(settings::Param::wal_persist_threshold));
+        wal_segment_size_ = static_cast<uint64_t>(settings_manager->GetInt64(settings::Param::wal_segment_size));
+        wal_io_uring_enable_ = settings_manager->GetBool(settings::Param::wal_io_uring_enable);
+        wal_direct_io_enable_ = settings_manager->GetBool(settings::Param::wal_direct_io_enable);
       }
 
       use_metrics_ = settings_manager->GetBool(settings::Param::metrics);
@@ -1053,6 +1105,7 @@ class DBMain {
           static_cast<uint16_t>(settings_manager->GetInt(settings::Param::connection_thread_count));
       optimizer_timeout_ = static_cast<uint64_t>(settings_manager->GetInt(settings::Param::task_execution_timeout));
       use_query_cache_ = settings_manager->GetBool(settings::Param::use_query_cache);
+      park_connection_on_commit_ = settings_manager->GetBool(settings::Param::park_connection_on_commit);
 
       execution_mode_ = settings_manager->GetBool(settings::Param::compiled_query_execution)
                             ? execution::vm::ExecutionMode::Compiled
@@ -1078,6 +1131,10 @@ class DBMain {
       async_replication_enable_ = settings_manager->GetBool(settings::Param::async_replication_enable);
       replication_port_ = settings_manager->GetInt(settings::Param::replication_port);
       replication_hosts_path_ = settings_manager->GetString(settings::Param::replication_hosts_path);
+      replication_compression_enable_ = settings_manager->GetBool(settings::Param::replication_compression_enable);
+      replication_send_window_ = settings_manager->GetInt(settings::Param::replication_send_window);
+      replication_send_window_timeout_ms_ = settings_manager->GetInt(settings::Param::replication_send_window_timeout);
+      replication_apply_threads_ = settings_manager->GetInt(settings::Param::replication_apply_threads);
       use_model_server_ = settings_manager->GetBool(settings::Param::model_server_enable);
       model_server_path_ = settings_manager->GetString(settings::Param::model_server_path);
 
@@ -36,6 +36,7 @@ class ConnectionContext {
     accessor_ = nullptr;
     callback_ = nullptr;
     callback_arg_ = nullptr;
+    commit_pending_ = false;
     catalog_cache_.Reset(transaction::INITIAL_TXN_TIMESTAMP);
   }
 
@@ -151,16 +152,28 @@ class ConnectionContext {
 
   /**
    * @return handle to the ConnectionHandle callback to issue a libevent wakeup in the event of WAIT_ON_NOISEPAGE
-   * state. Currently not used, but may in the future for asynchronous execution.
+   * state, e.g., once a commit that the connection is parked on is durable. May be invoked from any thread.
    */
   network::NetworkCallback Callback() const { return callback_; }
 
   /**
    * @return args to the ConnectionHandle callback to issue a libevent wakeup in the event of WAIT_ON_NOISEPAGE
-   * state. Currently not used, but may in the future for asynchronous execution.
+   * state
    */
   void *CallbackArg() const { return callback_arg_; }
 
+  /**
+   * @return true if the TrafficCop committed this connection's last txn without waiting for it to become durable. The
+   * connection must hold back its results until the callback wakes it up.
+   */
+  bool CommitPending() const { return commit_pending_; }
+
+  /**
+   * @param commit_pending new value
+   * @warning this should only be used by TrafficCop::EndTransaction and ConnectionHandle
+   */
+  void SetCommitPending(const bool commit_pending) { commit_pending_ = commit_pending; }
+
   /**
    * @return CatalogCache to be injected into requests for CatalogAcessors
    */
@@ -208,12 +221,17 @@ class ConnectionContext {
   std::unique_ptr<catalog::CatalogAccessor> accessor_ = nullptr;
 
   /**
-   * ConnectionHandle callback stuff to issue a libevent wakeup in the event of WAIT_ON_NOISEPAGE state. Currently
-   * not used, but may in the future for asynchronous execution.
+   * ConnectionHandle callback stuff to issue a libevent wakeup in the event of WAIT_ON_NOISEPAGE state.
    */
   network::NetworkCallback callback_;
   void *callback_arg_;
 
+  /**
+   * Set by TrafficCop::EndTransaction if the connection has to wait for the callback before it can reply. Only ever
+   * accessed by the connection's network thread.
+   */
+  bool commit_pending_ = false;
+
   catalog::CatalogCache catalog_cache_;
 };
 
@@ -106,7 +106,7 @@ class ConnectionHandle {
   void StopReceivingNetworkEvent();
 
   /**
-   * issues a libevent to wake up the state machine in the WAIT_ON_NOISEPAGE state
+   * issues a libevent to wake up the state machine in the WAIT_ON_NOISEPAGE state. Safe to call from any thread.
    * @param callback_args this for a ConnectionHandle in WAIT_ON_NOISEPAGE state
    */
   static void Callback(void *callback_args);
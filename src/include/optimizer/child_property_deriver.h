@@ -187,6 +187,18 @@ class ChildPropertyDeriver : public OperatorVisitor {
    */
   void Visit(const Aggregate *op) override;
 
+  /**
+   * Visitor function for HashSetOp
+   * @param op HashSetOp operator to visit
+   */
+  void Visit(const HashSetOp *op) override;
+
+  /**
+   * Visitor function for Window
+   * @param op Window operator to visit
+   */
+  void Visit(const Window *op) override;
+
   /**
    * Visitor function for ExportExternalFile
    * @param op ExportExternalFile operator to visit
@@ -22,6 +22,12 @@ class TrivialCostModel : public AbstractCostModel {
    */
   static constexpr double SCAN_COST = 1000000.f;
 
+  /**
+   * Discount of an INDEX_SCAN whose index keys contain all of its predicate columns, since the scan can then avoid
+   * fetching the tuples from the table. Less than one so that it only breaks ties between indexes.
+   */
+  static constexpr double INDEX_ONLY_DISCOUNT = 0.5f;
+
   /**
    * Cost of performing a NLJoin
    */
@@ -174,6 +180,18 @@ class TrivialCostModel : public AbstractCostModel {
    */
   void Visit(UNUSED_ATTRIBUTE const Aggregate *op) override { output_cost_ = 0.f; }
 
+  /**
+   * Visit a HashSetOp operator
+   * @param op operator
+   */
+  void Visit(UNUSED_ATTRIBUTE const HashSetOp *op) override { output_cost_ = 0.f; }
+
+  /**
+   * Visit a Window operator
+   * @param op operator
+   */
+  void Visit(UNUSED_ATTRIBUTE const Window *op) override { output_cost_ = 0.f; }
+
  private:
   /**
    * GroupExpression to cost
@@ -88,6 +88,29 @@ class IndexUtil {
       planner::IndexScanType *scan_type,
       std::unordered_map<catalog::indexkeycol_oid_t, std::vector<planner::IndexExpression>> *bounds);
 
+  /**
+   * Checks whether the keys of an index contain all of the given columns, in which case an index scan can read the
+   * columns from the keys instead of the table.
+   * @param accessor CatalogAccessor
+   * @param tbl_oid OID of the table that the index is built on
+   * @param idx_oid OID of the index to check
+   * @param col_oids columns that the scan reads
+   * @returns TRUE if every column is a key attribute of the index
+   */
+  static bool CoversColumnsWithIndex(catalog::CatalogAccessor *accessor, catalog::table_oid_t tbl_oid,
+                                     catalog::index_oid_t idx_oid, const std::vector<catalog::col_oid_t> &col_oids);
+
+  /**
+   * Checks whether a scan with the given predicates only needs tuples that an index contains. This is always the case
+   * for a regular index. A partial index qualifies if every conjunct of its predicate is implied by one of the
+   * predicates, e.g., "a > 10" by "a = 15".
+   * @param schema IndexSchema to evaluate
+   * @param predicates List of predicates of the scan
+   * @returns TRUE if the predicates imply the predicate of the index
+   */
+  static bool SatisfiesPartialIndexPredicate(const catalog::IndexSchema &schema,
+                                             const std::vector<AnnotatedExpression> &predicates);
+
  private:
   friend class selfdriving::OperatingUnitRecorder;
 
@@ -145,6 +168,26 @@ class IndexUtil {
     return true;
   }
 
+  /**
+   * Checks whether an expression implies another one, which is true if they are the same expression, or if both are
+   * comparisons of the same column with a constant and the first one is the stricter one.
+   * @param expr expression that is known to be true
+   * @param implied expression to check
+   * @returns TRUE if expr implies implied
+   */
+  static bool ImpliesPredicate(common::ManagedPointer<parser::AbstractExpression> expr,
+                               common::ManagedPointer<parser::AbstractExpression> implied);
+
+  /**
+   * Checks whether two expressions compute the same value. Unlike AbstractExpression::operator==, this ignores the
+   * names and aliases of the expressions, and compares columns by their OIDs.
+   * @param lhs first expression
+   * @param rhs second expression
+   * @returns TRUE if the expressions are equivalent
+   */
+  static bool EquivalentExpressions(common::ManagedPointer<parser::AbstractExpression> lhs,
+                                    common::ManagedPointer<parser::AbstractExpression> rhs);
+
   /**
    * Checks whether a given expression is a "base column".
    * A base column, as used and defined by Peloton, is where expr is a ColumnValueExpression
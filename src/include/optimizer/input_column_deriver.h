@@ -197,6 +197,18 @@ class InputColumnDeriver : public OperatorVisitor {
    */
   void Visit(const Aggregate *op) override;
 
+  /**
+   * Visit function to derive input/output columns for HashSetOp
+   * @param op HashSetOp operator to visit
+   */
+  void Visit(const HashSetOp *op) override;
+
+  /**
+   * Visit function to derive input/output columns for Window
+   * @param op Window operator to visit
+   */
+  void Visit(const Window *op) override;
+
   /**
    * Visit function to derive input/output columns for ExportExternalFile
    * @param op ExportExternalFile operator to visit
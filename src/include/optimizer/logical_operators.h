@@ -897,6 +897,100 @@ class LogicalLimit : public OperatorNodeContents<LogicalLimit> {
   std::vector<optimizer::OrderByOrderingType> sort_directions_;
 };
 
+/**
+ * Logical operator for a set operation (UNION, INTERSECT or EXCEPT) on two inputs
+ */
+class LogicalSetOp : public OperatorNodeContents<LogicalSetOp> {
+ public:
+  /**
+   * @param set_op the set operation
+   * @param left_columns the output columns of the left input, which are also the output columns of the set operation
+   * @param right_columns the output columns of the right input, matched to left_columns by position
+   * @return
+   */
+  static Operator Make(planner::SetOpType set_op,
+                       std::vector<common::ManagedPointer<parser::AbstractExpression>> &&left_columns,
+                       std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_columns);
+
+  /**
+   * Copy
+   * @returns copy of this
+   */
+  BaseOperatorNodeContents *Copy() const override;
+
+  bool operator==(const BaseOperatorNodeContents &r) override;
+  common::hash_t Hash() const override;
+
+  /**
+   * @return the set operation
+   */
+  planner::SetOpType GetSetOp() const { return set_op_; }
+
+  /**
+   * @return the output columns of the left input
+   */
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetLeftColumns() const {
+    return left_columns_;
+  }
+
+  /**
+   * @return the output columns of the right input
+   */
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetRightColumns() const {
+    return right_columns_;
+  }
+
+ private:
+  /**
+   * The set operation
+   */
+  planner::SetOpType set_op_;
+
+  /**
+   * The output columns of the left input, i.e., the select list of the left select statement
+   */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> left_columns_;
+
+  /**
+   * The output columns of the right input, i.e., the select list of the right select statement
+   */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> right_columns_;
+};
+
+/**
+ * Logical operator for the window functions that share one window (PARTITION BY and ORDER BY)
+ */
+class LogicalWindow : public OperatorNodeContents<LogicalWindow> {
+ public:
+  /**
+   * @param window_exprs the window functions to compute, which all have the same PARTITION BY and ORDER BY
+   * @return
+   */
+  static Operator Make(std::vector<common::ManagedPointer<parser::AbstractExpression>> &&window_exprs);
+
+  /**
+   * Copy
+   * @returns copy of this
+   */
+  BaseOperatorNodeContents *Copy() const override;
+
+  bool operator==(const BaseOperatorNodeContents &r) override;
+  common::hash_t Hash() const override;
+
+  /**
+   * @return the window functions to compute
+   */
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetWindowExprs() const {
+    return window_exprs_;
+  }
+
+ private:
+  /**
+   * The window functions to compute. Each is a parser::WindowExpression.
+   */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> window_exprs_;
+};
+
 /**
  * Logical operator for Delete
  */
@@ -1278,12 +1372,14 @@ class LogicalCreateIndex : public OperatorNodeContents<LogicalCreateIndex> {
    * @param unique If the index to be created should be unique
    * @param index_name Name of the index
    * @param index_attrs Attributes of the index
+   * @param index_predicate Predicate of a partial index, or nullptr if the index contains every row
    * @return
    */
   static Operator Make(catalog::db_oid_t database_oid, catalog::namespace_oid_t namespace_oid,
                        catalog::table_oid_t table_oid, parser::IndexType index_type, bool unique,
                        std::string index_name,
-                       std::vector<common::ManagedPointer<parser::AbstractExpression>> index_attrs);
+                       std::vector<common::ManagedPointer<parser::AbstractExpression>> index_attrs,
+                       common::ManagedPointer<parser::AbstractExpression> index_predicate = nullptr);
 
   /**
    * Copy
@@ -1329,6 +1425,11 @@ class LogicalCreateIndex : public OperatorNodeContents<LogicalCreateIndex> {
    */
   const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetIndexAttr() const { return index_attrs_; }
 
+  /**
+   * @return Predicate of a partial index, or nullptr if the index contains every row
+   */
+  common::ManagedPointer<parser::AbstractExpression> GetIndexPredicate() const { return index_predicate_; }
+
  private:
   /**
    * OID of the database
@@ -1364,6 +1465,11 @@ class LogicalCreateIndex : public OperatorNodeContents<LogicalCreateIndex> {
    * Index attributes
    */
   std::vector<common::ManagedPointer<parser::AbstractExpression>> index_attrs_;
+
+  /**
+   * Predicate of a partial index
+   */
+  common::ManagedPointer<parser::AbstractExpression> index_predicate_;
 };
 
 /**
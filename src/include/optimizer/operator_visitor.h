@@ -27,6 +27,8 @@ class Update;
 class HashGroupBy;
 class SortGroupBy;
 class Aggregate;
+class HashSetOp;
+class Window;
 class ExportExternalFile;
 class CreateDatabase;
 class CreateFunction;
@@ -61,6 +63,8 @@ class LogicalInsertSelect;
 class LogicalDelete;
 class LogicalUpdate;
 class LogicalLimit;
+class LogicalSetOp;
+class LogicalWindow;
 class LogicalExportExternalFile;
 class LogicalCreateDatabase;
 class LogicalCreateFunction;
@@ -234,6 +238,18 @@ class OperatorVisitor {
    */
   virtual void Visit(const Aggregate *aggregate) {}
 
+  /**
+   * Visit a HashSetOp operator
+   * @param hash_set_op operator
+   */
+  virtual void Visit(const HashSetOp *hash_set_op) {}
+
+  /**
+   * Visit a Window operator
+   * @param window operator
+   */
+  virtual void Visit(const Window *window) {}
+
   /**
    * Visit a ExportExternalFile operator
    * @param export_ext_file operator
@@ -437,6 +453,18 @@ class OperatorVisitor {
    */
   virtual void Visit(const LogicalLimit *logical_limit) {}
 
+  /**
+   * Visit a LogicalSetOp operator
+   * @param logical_set_op operator
+   */
+  virtual void Visit(const LogicalSetOp *logical_set_op) {}
+
+  /**
+   * Visit a LogicalWindow operator
+   * @param logical_window operator
+   */
+  virtual void Visit(const LogicalWindow *logical_window) {}
+
   /**
    * Visit a LogicalExportExternalFile operator
    * @param logical_export_external_file operator
@@ -64,6 +64,8 @@ enum class OpType {
   LOGICALDELETE,
   LOGICALUPDATE,
   LOGICALLIMIT,
+  LOGICALSETOP,
+  LOGICALWINDOW,
   LOGICALEXPORTEXTERNALFILE,
   LOGICALCREATEDATABASE,
   LOGICALCREATEFUNCTION,
@@ -108,6 +110,8 @@ enum class OpType {
   AGGREGATE,
   HASHGROUPBY,
   SORTGROUPBY,
+  HASHSETOP,
+  WINDOW,
   EXPORTEXTERNALFILE,
   CREATEDATABASE,
   CREATEFUNCTION,
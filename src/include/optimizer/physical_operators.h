@@ -859,10 +859,14 @@ class LeftHashJoin : public OperatorNodeContents<LeftHashJoin> {
 class RightHashJoin : public OperatorNodeContents<RightHashJoin> {
  public:
   /**
-   * @param join_predicate predicate for join
+   * @param join_predicates predicates for join
+   * @param left_keys left keys to join
+   * @param right_keys right keys to join
    * @return a RightHashJoin operator
    */
-  static Operator Make(common::ManagedPointer<parser::AbstractExpression> join_predicate);
+  static Operator Make(std::vector<AnnotatedExpression> &&join_predicates,
+                       std::vector<common::ManagedPointer<parser::AbstractExpression>> &&left_keys,
+                       std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_keys);
 
   /**
    * Copy
@@ -875,15 +879,35 @@ class RightHashJoin : public OperatorNodeContents<RightHashJoin> {
   common::hash_t Hash() const override;
 
   /**
-   * @return Predicate for the join
+   * @return Left join keys
    */
-  const common::ManagedPointer<parser::AbstractExpression> &GetJoinPredicate() const { return join_predicate_; }
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetLeftKeys() const { return left_keys_; }
+
+  /**
+   * @return Right join keys
+   */
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetRightKeys() const { return right_keys_; }
+
+  /**
+   * @return Predicates for the Join
+   */
+  const std::vector<AnnotatedExpression> &GetJoinPredicates() const { return join_predicates_; }
 
  private:
+  /**
+   * Left join keys
+   */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> left_keys_;
+
+  /**
+   * Right join keys
+   */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> right_keys_;
+
   /**
    * Predicate for join
    */
-  common::ManagedPointer<parser::AbstractExpression> join_predicate_;
+  std::vector<AnnotatedExpression> join_predicates_;
 };
 
 /**
@@ -892,10 +916,14 @@ class RightHashJoin : public OperatorNodeContents<RightHashJoin> {
 class OuterHashJoin : public OperatorNodeContents<OuterHashJoin> {
  public:
   /**
-   * @param join_predicate predicate for join
-   * @return a OuterHashJoin operator
+   * @param join_predicates predicates for join
+   * @param left_keys left keys to join
+   * @param right_keys right keys to join
+   * @return an OuterHashJoin operator
    */
-  static Operator Make(common::ManagedPointer<parser::AbstractExpression> join_predicate);
+  static Operator Make(std::vector<AnnotatedExpression> &&join_predicates,
+                       std::vector<common::ManagedPointer<parser::AbstractExpression>> &&left_keys,
+                       std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_keys);
 
   /**
    * Copy
@@ -908,15 +936,35 @@ class OuterHashJoin : public OperatorNodeContents<OuterHashJoin> {
   common::hash_t Hash() const override;
 
   /**
-   * @return Predicate for the join
+   * @return Left join keys
    */
-  const common::ManagedPointer<parser::AbstractExpression> &GetJoinPredicate() const { return join_predicate_; }
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetLeftKeys() const { return left_keys_; }
+
+  /**
+   * @return Right join keys
+   */
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetRightKeys() const { return right_keys_; }
+
+  /**
+   * @return Predicates for the Join
+   */
+  const std::vector<AnnotatedExpression> &GetJoinPredicates() const { return join_predicates_; }
 
  private:
+  /**
+   * Left join keys
+   */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> left_keys_;
+
+  /**
+   * Right join keys
+   */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> right_keys_;
+
   /**
    * Predicate for join
    */
-  common::ManagedPointer<parser::AbstractExpression> join_predicate_;
+  std::vector<AnnotatedExpression> join_predicates_;
 };
 
 /**
@@ -1346,6 +1394,100 @@ class Aggregate : public OperatorNodeContents<Aggregate> {
   common::hash_t Hash() const override;
 };
 
+/**
+ * Physical operator for a set operation that matches the rows of its two inputs in a hash table
+ */
+class HashSetOp : public OperatorNodeContents<HashSetOp> {
+ public:
+  /**
+   * @param set_op the set operation
+   * @param left_columns the output columns of the left input, which are also the output columns of the set operation
+   * @param right_columns the output columns of the right input, matched to left_columns by position
+   * @return
+   */
+  static Operator Make(planner::SetOpType set_op,
+                       std::vector<common::ManagedPointer<parser::AbstractExpression>> &&left_columns,
+                       std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_columns);
+
+  /**
+   * Copy
+   * @returns copy of this
+   */
+  BaseOperatorNodeContents *Copy() const override;
+
+  bool operator==(const BaseOperatorNodeContents &r) override;
+  common::hash_t Hash() const override;
+
+  /**
+   * @return the set operation
+   */
+  planner::SetOpType GetSetOp() const { return set_op_; }
+
+  /**
+   * @return the output columns of the left input
+   */
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetLeftColumns() const {
+    return left_columns_;
+  }
+
+  /**
+   * @return the output columns of the right input
+   */
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetRightColumns() const {
+    return right_columns_;
+  }
+
+ private:
+  /**
+   * The set operation
+   */
+  planner::SetOpType set_op_;
+
+  /**
+   * The output columns of the left input, i.e., the select list of the left select statement
+   */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> left_columns_;
+
+  /**
+   * The output columns of the right input, i.e., the select list of the right select statement
+   */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> right_columns_;
+};
+
+/**
+ * Physical operator that sorts its input on a window and computes the window functions over it
+ */
+class Window : public OperatorNodeContents<Window> {
+ public:
+  /**
+   * @param window_exprs the window functions to compute, which all have the same PARTITION BY and ORDER BY
+   * @return
+   */
+  static Operator Make(std::vector<common::ManagedPointer<parser::AbstractExpression>> &&window_exprs);
+
+  /**
+   * Copy
+   * @returns copy of this
+   */
+  BaseOperatorNodeContents *Copy() const override;
+
+  bool operator==(const BaseOperatorNodeContents &r) override;
+  common::hash_t Hash() const override;
+
+  /**
+   * @return the window functions to compute
+   */
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetWindowExprs() const {
+    return window_exprs_;
+  }
+
+ private:
+  /**
+   * The window functions to compute. Each is a parser::WindowExpression.
+   */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> window_exprs_;
+};
+
 /**
  * Physical operator for CreateDatabase
  */
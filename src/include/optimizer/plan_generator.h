@@ -220,6 +220,18 @@ class PlanGenerator : public OperatorVisitor {
    */
   void Visit(const Aggregate *op) override;
 
+  /**
+   * Visitor function for a HashSetOp operator
+   * @param op HashSetOp operator being visited
+   */
+  void Visit(const HashSetOp *op) override;
+
+  /**
+   * Visitor function for a Window operator
+   * @param op Window operator being visited
+   */
+  void Visit(const Window *op) override;
+
   /**
    * Visitor function for a ExportExternalFile operator
    * @param op ExportExternalFile operator being visited
@@ -38,8 +38,12 @@ enum class RuleType : uint32_t {
   SEMI_JOIN_TO_HASH_JOIN,
   INNER_JOIN_TO_HASH_JOIN,
   LEFT_JOIN_TO_HASH_JOIN,
+  RIGHT_JOIN_TO_HASH_JOIN,
+  OUTER_JOIN_TO_HASH_JOIN,
   IMPLEMENT_DISTINCT,
   IMPLEMENT_LIMIT,
+  SET_OP_TO_HASH_SET_OP,
+  IMPLEMENT_WINDOW,
   EXPORT_EXTERNAL_FILE_TO_PHYSICAL,
   ANALYZE_TO_PHYSICAL,
 
@@ -62,6 +62,18 @@ class StatsCalculator : public OperatorVisitor {
    */
   void Visit(const LogicalLimit *op) override;
 
+  /**
+   * Visit a LogicalSetOp
+   * @param op Operator being visited
+   */
+  void Visit(const LogicalSetOp *op) override;
+
+  /**
+   * Visit a LogicalWindow
+   * @param op Operator being visited
+   */
+  void Visit(const LogicalWindow *op) override;
+
   /**
    * Visit a LogicalInsert
    * @param op Operator being visited
@@ -411,15 +411,18 @@ class CreateStatement : public TableRefStatement {
    * @param unique true if index should be unique, false otherwise
    * @param index_name index name
    * @param index_attrs index attributes
+   * @param index_predicate WHERE clause of a partial index, or nullptr if the index contains every row
    */
   CreateStatement(std::unique_ptr<TableInfo> table_info, IndexType index_type, bool unique, std::string index_name,
-                  std::vector<IndexAttr> index_attrs)
+                  std::vector<IndexAttr> index_attrs,
+                  common::ManagedPointer<AbstractExpression> index_predicate = nullptr)
       : TableRefStatement(StatementType::CREATE, std::move(table_info)),
         create_type_(kIndex),
         index_type_(index_type),
         unique_index_(unique),
         index_name_(std::move(index_name)),
-        index_attrs_(std::move(index_attrs)) {}
+        index_attrs_(std::move(index_attrs)),
+        index_predicate_(index_predicate) {}
 
   /**
    * CREATE SCHEMA
@@ -504,6 +507,9 @@ class CreateStatement : public TableRefStatement {
   /** @return index attributes for [CREATE INDEX] */
   const std::vector<IndexAttr> &GetIndexAttributes() const { return index_attrs_; }
 
+  /** @return WHERE clause of a partial index for [CREATE INDEX], nullptr if the index contains every row */
+  common::ManagedPointer<AbstractExpression> GetIndexPredicate() { return index_predicate_; }
+
   /** @return true if "IF NOT EXISTS" for [CREATE SCHEMA], false otherwise */
   bool IsIfNotExists() { return if_not_exists_; }
 
@@ -544,6 +550,8 @@ class CreateStatement : public TableRefStatement {
   const bool unique_index_ = false;
   const std::string index_name_;
   const std::vector<IndexAttr> index_attrs_;
+  const common::ManagedPointer<AbstractExpression> index_predicate_ =
+      common::ManagedPointer<AbstractExpression>(nullptr);
 
   // CREATE SCHEMA
   const bool if_not_exists_ = false;
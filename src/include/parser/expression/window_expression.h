@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "common/managed_pointer.h"
+#include "optimizer/optimizer_defs.h"
+#include "parser/expression/abstract_expression.h"
+#include "parser/expression_defs.h"
+#include "planner/plannodes/plan_node_defs.h"
+
+namespace noisepage::parser {
+
+/**
+ * WindowExpression represents a function call with an OVER clause. Like AggregateExpression, it is only used for
+ * parsing, planning and optimizing: the optimizer computes it in a window operator and turns it into a
+ * planner::WindowFunction.
+ *
+ * The children are the argument of the function, if it has one, followed by the PARTITION BY expressions and then the
+ * ORDER BY expressions of the window. The frame is counted in rows, as in planner::WindowFunction.
+ */
+class WindowExpression : public AbstractExpression {
+ public:
+  /**
+   * Instantiates a new window expression.
+   * @param function_type the window function
+   * @param children the argument, if any, followed by the partition keys and the sort keys
+   * @param num_partition_by_keys number of partition keys in children
+   * @param sort_orders ordering of each sort key, which are the last children
+   */
+  WindowExpression(planner::WindowFunctionType function_type,
+                   std::vector<std::unique_ptr<AbstractExpression>> &&children, size_t num_partition_by_keys,
+                   std::vector<optimizer::OrderByOrderingType> sort_orders)
+      : AbstractExpression(ExpressionType::WINDOW_FUNCTION, type::TypeId::INVALID, std::move(children)),
+        function_type_(function_type),
+        num_partition_by_keys_(num_partition_by_keys),
+        sort_orders_(std::move(sort_orders)) {
+    NOISEPAGE_ASSERT(GetChildrenSize() >= num_partition_by_keys_ + sort_orders_.size(), "Missing window keys");
+  }
+
+  /** Default constructor for deserialization. */
+  WindowExpression() = default;
+
+  /**
+   * Creates a copy of the current AbstractExpression
+   * @returns Copy of this
+   */
+  std::unique_ptr<AbstractExpression> Copy() const override;
+
+  /**
+   * Creates a copy of the current AbstractExpression with new children implanted.
+   * The children should not be owned by any other AbstractExpression.
+   * @param children New children to be owned by the copy
+   * @returns copy of this with new children
+   */
+  std::unique_ptr<AbstractExpression> CopyWithChildren(
+      std::vector<std::unique_ptr<AbstractExpression>> &&children) const override;
+
+  common::hash_t Hash() const override;
+
+  bool operator==(const AbstractExpression &rhs) const override;
+
+  /** @return the window function */
+  planner::WindowFunctionType GetFunctionType() const { return function_type_; }
+
+  /** @return the argument of the function, or nullptr for ranking functions and COUNT(*) */
+  common::ManagedPointer<AbstractExpression> GetArgument() const {
+    return HasArgument() ? GetChild(0) : common::ManagedPointer<AbstractExpression>(nullptr);
+  }
+
+  /** @return the expressions that split the input into partitions */
+  std::vector<common::ManagedPointer<AbstractExpression>> GetPartitionByKeys() const {
+    return GetChildRange(GetArgumentCount(), num_partition_by_keys_);
+  }
+
+  /** @return the expressions that order the rows of a partition */
+  std::vector<common::ManagedPointer<AbstractExpression>> GetSortKeys() const {
+    return GetChildRange(GetChildrenSize() - sort_orders_.size(), sort_orders_.size());
+  }
+
+  /** @return the ordering of each sort key */
+  const std::vector<optimizer::OrderByOrderingType> &GetSortOrders() const { return sort_orders_; }
+
+  /**
+   * Set the frame of the function. By default, the frame is the whole partition.
+   * @param start_unbounded whether the frame starts at the first row of the partition
+   * @param start_preceding if the start isn't unbounded, the number of rows the frame starts before the current row
+   * @param end_unbounded whether the frame ends at the last row of the partition
+   * @param end_following if the end isn't unbounded, the number of rows the frame ends after the current row
+   */
+  void SetFrame(bool start_unbounded, uint64_t start_preceding, bool end_unbounded, uint64_t end_following) {
+    start_unbounded_ = start_unbounded;
+    start_preceding_ = start_unbounded ? 0 : start_preceding;
+    end_unbounded_ = end_unbounded;
+    end_following_ = end_unbounded ? 0 : end_following;
+  }
+
+  /** @return true if the frame starts at the first row of the partition */
+  bool IsStartUnbounded() const { return start_unbounded_; }
+
+  /** @return the number of rows the frame starts before the current row, if the start isn't unbounded */
+  uint64_t GetStartPreceding() const { return start_preceding_; }
+
+  /** @return true if the frame ends at the last row of the partition */
+  bool IsEndUnbounded() const { return end_unbounded_; }
+
+  /** @return the number of rows the frame ends after the current row, if the end isn't unbounded */
+  uint64_t GetEndFollowing() const { return end_following_; }
+
+  /**
+   * Derive the expression type of the current expression.
+   */
+  void DeriveReturnValueType() override;
+
+  void Accept(common::ManagedPointer<binder::SqlNodeVisitor> v) override;
+
+  /** @return expression serialized to json */
+  nlohmann::json ToJson() const override;
+
+  /**
+   * @param j json to deserialize
+   */
+  std::vector<std::unique_ptr<AbstractExpression>> FromJson(const nlohmann::json &j) override;
+
+ private:
+  /** @return true if the first child is the argument of the function */
+  bool HasArgument() const { return GetArgumentCount() != 0; }
+  size_t GetArgumentCount() const { return GetChildrenSize() - num_partition_by_keys_ - sort_orders_.size(); }
+  std::vector<common::ManagedPointer<AbstractExpression>> GetChildRange(size_t begin, size_t count) const;
+
+  /** The window function. */
+  planner::WindowFunctionType function_type_{planner::WindowFunctionType::INVALID};
+  /** Number of partition keys, which follow the argument in the children. */
+  size_t num_partition_by_keys_{0};
+  /** Ordering of each sort key. The sort keys are the last children. */
+  std::vector<optimizer::OrderByOrderingType> sort_orders_;
+  /** The frame, as in planner::WindowFunction. */
+  bool start_unbounded_{true};
+  uint64_t start_preceding_{0};
+  bool end_unbounded_{true};
+  uint64_t end_following_{0};
+};
+
+DEFINE_JSON_HEADER_DECLARATIONS(WindowExpression);
+
+}  // namespace noisepage::parser
@@ -55,6 +55,8 @@ namespace noisepage::parser {
   T(ExpressionType, AGGREGATE_TOP_K)                  \
   T(ExpressionType, AGGREGATE_HISTOGRAM)              \
                                                       \
+  T(ExpressionType, WINDOW_FUNCTION)                  \
+                                                      \
   T(ExpressionType, FUNCTION)                         \
                                                       \
   T(ExpressionType, HASH_RANGE)                       \
@@ -21,6 +21,7 @@
 #include "parser/expression/operator_expression.h"
 #include "parser/expression/parameter_value_expression.h"
 #include "parser/expression/type_cast_expression.h"
+#include "parser/expression/window_expression.h"
 
 namespace noisepage::parser {
 
@@ -95,6 +96,29 @@ class ExpressionUtil {
     }
   }
 
+  /**
+   * Checks whether the AbstractExpression is a window function
+   * @param expr expression to check
+   * @returns whether expr is a window function
+   */
+  static bool IsWindowExpression(common::ManagedPointer<AbstractExpression> expr) {
+    return expr->GetExpressionType() == ExpressionType::WINDOW_FUNCTION;
+  }
+
+  /**
+   * Walks an expression tree and finds all WindowExpression subtrees, in the order they are found in.
+   * @param window_exprs vector to store found WindowExpressions
+   * @param expr Expression to walk
+   */
+  static void GetWindowExprs(std::vector<common::ManagedPointer<AbstractExpression>> *window_exprs,
+                             common::ManagedPointer<AbstractExpression> expr) {
+    if (IsWindowExpression(expr)) {
+      window_exprs->push_back(expr);
+    } else {
+      for (const auto &child : expr->GetChildren()) GetWindowExprs(window_exprs, child);
+    }
+  }
+
   /**
    * Checks whether the ExpressionType represents an operation
    * @param type ExpressionType to check
@@ -344,10 +368,17 @@ class ExpressionUtil {
    * ColumnValueExpressions are added to a expr_map to preserve order they are found in.
    * The expr_map is updated in post-order traversal order.
    *
+   * A WindowExpression is computed by a window operator and read like a column above it, so it is added as a whole.
+   *
    * @param expr_map map to place found ColumnValueExpressions for order-preserving
    * @param expr Expression to walk
    */
   static void GetTupleValueExprs(optimizer::ExprMap *expr_map, common::ManagedPointer<AbstractExpression> expr) {
+    if (IsWindowExpression(expr)) {
+      expr_map->emplace(expr, expr_map->size());
+      return;
+    }
+
     size_t children_size = expr->GetChildrenSize();
     for (size_t i = 0; i < children_size; i++) {
       GetTupleValueExprs(expr_map, expr->GetChild(i));
@@ -362,11 +393,17 @@ class ExpressionUtil {
   /**
    * Walks an expression trees and find all ColumnValueExpressions in the tree
    * ColumnValueExpressions are added to the expr_set in post-order traversal.
+   * WindowExpressions are added as a whole.
    *
    * @param expr_set set to place found ColumnValueExpressions
    * @param expr Expression to walk
    */
   static void GetTupleValueExprs(optimizer::ExprSet *expr_set, common::ManagedPointer<AbstractExpression> expr) {
+    if (IsWindowExpression(expr)) {
+      expr_set->insert(expr);
+      return;
+    }
+
     size_t children_size = expr->GetChildrenSize();
     for (size_t i = 0; i < children_size; i++) {
       GetTupleValueExprs(expr_set, expr->GetChild(i));
@@ -442,6 +479,17 @@ class ExpressionUtil {
         ++tuple_idx;
       }
 
+    } else if (IsWindowExpression(expr)) {
+      // A window function computed by a window operator below is read from its output, like an aggregate.
+      int tuple_idx = 0;
+      for (auto &expr_map : expr_maps) {
+        auto iter = expr_map.find(expr);
+        if (iter != expr_map.end()) {
+          return std::make_unique<DerivedValueExpression>(expr->GetReturnValueType(), tuple_idx, iter->second);
+        }
+        ++tuple_idx;
+      }
+
     } else if (expr->GetExpressionType() == ExpressionType::FUNCTION) {
       /*
       TODO(wz2): Uncomment and fix this when Functions exist
@@ -57,11 +57,14 @@ enum class JoinType {
   SEMI = 5  // IN+Subquery is SEMI
 };
 
+enum class SetOperationType { INVALID = INVALID_TYPE_ID, UNION = 1, INTERSECT = 2, EXCEPT = 3 };
+
 enum class IndexType {
   INVALID = INVALID_TYPE_ID,
   BWTREE = 1,
   HASH = 2,
   BPLUSTREE = 3,
+  ART = 4,
 };
 
 enum class InsertType { INVALID = INVALID_TYPE_ID, VALUES = 1, SELECT = 2 };
@@ -105,6 +105,8 @@ class PostgresParser {
                                                                 char *alias);
   static std::unique_ptr<AbstractExpression> ConstTransform(ParseResult *parse_result, A_Const *root);
   static std::unique_ptr<AbstractExpression> FuncCallTransform(ParseResult *parse_result, FuncCall *root);
+  static std::unique_ptr<AbstractExpression> WindowFuncTransform(ParseResult *parse_result, FuncCall *root,
+                                                                 const std::string &func_name);
   static std::unique_ptr<AbstractExpression> NullTestTransform(ParseResult *parse_result, NullTest *root);
   static std::unique_ptr<AbstractExpression> ParamRefTransform(ParseResult *parse_result, ParamRef *root);
   static std::unique_ptr<AbstractExpression> SubqueryExprTransform(ParseResult *parse_result, SubLink *node);
@@ -341,7 +341,9 @@ class SelectStatement : public SQLStatement {
         group_by_(std::move(group_by)),
         order_by_(std::move(order_by)),
         limit_(std::move(limit)),
-        union_select_(nullptr) {}
+        set_op_type_(SetOperationType::INVALID),
+        set_op_all_(false),
+        set_op_select_(nullptr) {}
 
   /** Default constructor for deserialization. */
   SelectStatement() = default;
@@ -376,10 +378,25 @@ class SelectStatement : public SQLStatement {
   int GetDepth() { return depth_; }
 
   /**
-   * Adds a select statement child as a union target.
-   * @param select_stmt select statement to union with
+   * Combines this select statement with another one through a set operation, e.g., this UNION select_stmt.
+   * @param set_op_type the set operation
+   * @param set_op_all true if ALL was specified, i.e., the set operation keeps duplicates
+   * @param select_stmt select statement that is the right input of the set operation
    */
-  void SetUnionSelect(std::unique_ptr<SelectStatement> select_stmt) { union_select_ = std::move(select_stmt); }
+  void SetSetOpSelect(SetOperationType set_op_type, bool set_op_all, std::unique_ptr<SelectStatement> select_stmt) {
+    set_op_type_ = set_op_type;
+    set_op_all_ = set_op_all;
+    set_op_select_ = std::move(select_stmt);
+  }
+
+  /** @return the right input of the set operation on this select statement, or nullptr if there is none */
+  common::ManagedPointer<SelectStatement> GetSetOpSelect() { return common::ManagedPointer(set_op_select_); }
+
+  /** @return the set operation combining this select statement with GetSetOpSelect() */
+  SetOperationType GetSetOpType() const { return set_op_type_; }
+
+  /** @return true if the set operation keeps duplicates, i.e., ALL was specified */
+  bool IsSetOpAll() const { return set_op_all_; }
 
   /**
    * @return the hashed value of this select statement
@@ -415,7 +432,9 @@ class SelectStatement : public SQLStatement {
   std::unique_ptr<GroupByDescription> group_by_;
   std::unique_ptr<OrderByDescription> order_by_;
   std::unique_ptr<LimitDescription> limit_;
-  std::unique_ptr<SelectStatement> union_select_;
+  SetOperationType set_op_type_ = SetOperationType::INVALID;
+  bool set_op_all_ = false;
+  std::unique_ptr<SelectStatement> set_op_select_;
   int depth_ = -1;
 
   /** @param select List of select columns */
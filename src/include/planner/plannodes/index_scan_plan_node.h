@@ -119,6 +119,15 @@ class IndexScanPlanNode : public AbstractScanPlanNode {
       return *this;
     }
 
+    /**
+     * @param index_only whether the scanned columns are all index key attributes, so that they are read from the keys
+     * @return builder object
+     */
+    Builder &SetIndexOnly(bool index_only) {
+      index_only_ = index_only;
+      return *this;
+    }
+
     /**
      * Build the Index scan plan node
      * @return plan node
@@ -135,6 +144,7 @@ class IndexScanPlanNode : public AbstractScanPlanNode {
     std::unordered_map<catalog::indexkeycol_oid_t, IndexExpression> hi_index_cols_{};
     uint64_t index_size_{0};
     bool cover_all_columns_{false};
+    bool index_only_{false};
   };
 
  private:
@@ -152,6 +162,7 @@ class IndexScanPlanNode : public AbstractScanPlanNode {
    * @param hi_index_cols upper bound of the scan
    * @param index_size number of tuples in index
    * @param cover_all_columns whether the index covers all predicate columns
+   * @param index_only whether the scanned columns are read from the index keys instead of the table
    * @param plan_node_id Plan node id
    */
   IndexScanPlanNode(std::vector<std::unique_ptr<AbstractPlanNode>> &&children,
@@ -162,7 +173,8 @@ class IndexScanPlanNode : public AbstractScanPlanNode {
                     std::unordered_map<catalog::indexkeycol_oid_t, IndexExpression> &&lo_index_cols,
                     std::unordered_map<catalog::indexkeycol_oid_t, IndexExpression> &&hi_index_cols,
                     uint32_t scan_limit, bool scan_has_limit, uint32_t scan_offset, bool scan_has_offset,
-                    uint64_t index_size, uint64_t table_num_tuple, bool cover_all_columns, plan_node_id_t plan_node_id);
+                    uint64_t index_size, uint64_t table_num_tuple, bool cover_all_columns, bool index_only,
+                    plan_node_id_t plan_node_id);
 
  public:
   /**
@@ -233,6 +245,11 @@ class IndexScanPlanNode : public AbstractScanPlanNode {
    */
   bool GetCoverAllColumns() const { return cover_all_columns_; }
 
+  /**
+   * @return whether the scanned columns are read from the index keys instead of the table
+   */
+  bool GetIndexOnly() const { return index_only_; }
+
   /**
    * @return the hashed value of this plan node
    */
@@ -254,6 +271,7 @@ class IndexScanPlanNode : public AbstractScanPlanNode {
   uint64_t table_num_tuple_;
   uint64_t index_size_;
   bool cover_all_columns_;
+  bool index_only_;
 };
 
 DEFINE_JSON_HEADER_DECLARATIONS(IndexScanPlanNode);
@@ -69,6 +69,12 @@ class PlanMetaData {
     plan_node_meta_data_[plan_node_id] = meta_data;
   }
 
+  /**
+   * @param plan_node_id plan node id
+   * @return true if there is meta data for the plan node
+   */
+  bool HasPlanNodeMetaData(plan_node_id_t plan_node_id) const { return plan_node_meta_data_.count(plan_node_id) != 0; }
+
   /**
    * Get the meta data for a plan node
    * @param plan_node_id plan node id
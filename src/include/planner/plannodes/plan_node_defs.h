@@ -74,6 +74,7 @@ enum class PlanNodeType {
   DISTINCT,
   HASH,
   SETOP,
+  WINDOW,
 
   // Utility
   EXPORT_EXTERNAL_FILE,
@@ -123,7 +124,32 @@ std::string JoinTypeToString(LogicalJoinType type);
 // Set Operation Types
 //===--------------------------------------------------------------------===//
 
-enum class SetOpType { INVALID = INVALID_TYPE_ID, INTERSECT = 1, INTERSECT_ALL = 2, EXCEPT = 3, EXCEPT_ALL = 4 };
+enum class SetOpType {
+  INVALID = INVALID_TYPE_ID,
+  INTERSECT = 1,
+  INTERSECT_ALL = 2,
+  EXCEPT = 3,
+  EXCEPT_ALL = 4,
+  UNION = 5,
+  UNION_ALL = 6
+};
+
+//===--------------------------------------------------------------------===//
+// Window Function Types
+//===--------------------------------------------------------------------===//
+
+enum class WindowFunctionType {
+  INVALID = INVALID_TYPE_ID,
+  ROW_NUMBER = 1,
+  RANK = 2,
+  DENSE_RANK = 3,
+  COUNT = 4,
+  COUNT_STAR = 5,
+  SUM = 6,
+  MIN = 7,
+  MAX = 8,
+  AVG = 9
+};
 
 //===--------------------------------------------------------------------===//
 // External File defaults
@@ -31,6 +31,7 @@ class ProjectionPlanNode;
 class SeqScanPlanNode;
 class UpdatePlanNode;
 class SetOpPlanNode;
+class WindowPlanNode;
 class ResultPlanNode;
 
 /**
@@ -214,6 +215,12 @@ class PlanVisitor {
    */
   virtual void Visit(UNUSED_ATTRIBUTE const SetOpPlanNode *plan) {}
 
+  /**
+   * Visit an WindowPlanNode
+   * @param plan WindowPlanNode
+   */
+  virtual void Visit(UNUSED_ATTRIBUTE const WindowPlanNode *plan) {}
+
   /**
    * Visit an ResultPlanNode
    * @param plan ResultPlanNode
@@ -13,9 +13,10 @@ namespace noisepage::planner {
 
 /**
  * Plan node for set operation:
- * INTERSECT/INTERSECT ALL/EXPECT/EXCEPT ALL
+ * UNION/UNION ALL/INTERSECT/INTERSECT ALL/EXCEPT/EXCEPT ALL
  *
- * @warning UNION (ALL) is handled differently.
+ * The first child is the left input and the second child the right input of the operation. The output schema refers
+ * to the columns of the first child.
  * IMPORTANT: Both children must have the same physical schema.
  */
 class SetOpPlanNode : public AbstractPlanNode {
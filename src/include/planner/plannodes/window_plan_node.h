@@ -0,0 +1,185 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "optimizer/optimizer_defs.h"
+#include "planner/plannodes/abstract_plan_node.h"
+#include "planner/plannodes/order_by_plan_node.h"
+#include "planner/plannodes/plan_visitor.h"
+
+namespace noisepage::planner {
+
+/**
+ * A window function evaluated over the partition of every input row, with a frame of rows around the current row.
+ * Frames are counted in rows (SQL's ROWS mode): the frame of the i-th row of a partition is the rows from
+ * max(0, i - start_preceding) to min(partition size - 1, i + end_following), where an unbounded side extends to the
+ * start or the end of the partition. The default frame is the whole partition. Ranking functions ignore the frame.
+ */
+struct WindowFunction {
+  /** The function. */
+  WindowFunctionType type_{WindowFunctionType::INVALID};
+  /** The argument of aggregate functions. Null for ranking functions and COUNT(*). */
+  common::ManagedPointer<parser::AbstractExpression> argument_{nullptr};
+  /** Whether the frame starts at the first row of the partition. */
+  bool start_unbounded_{true};
+  /** If the start isn't unbounded, the number of rows the frame starts before the current row. */
+  uint64_t start_preceding_{0};
+  /** Whether the frame ends at the last row of the partition. */
+  bool end_unbounded_{true};
+  /** If the end isn't unbounded, the number of rows the frame ends after the current row. */
+  uint64_t end_following_{0};
+
+  /**
+   * @return True if the function is ROW_NUMBER, RANK or DENSE_RANK.
+   */
+  bool IsRanking() const {
+    return type_ == WindowFunctionType::ROW_NUMBER || type_ == WindowFunctionType::RANK ||
+           type_ == WindowFunctionType::DENSE_RANK;
+  }
+};
+
+/**
+ * Plan node for window functions. Every input row is emitted once, together with the values of all window functions
+ * for that row. The rows of a partition are emitted in the order of the sort keys, but partitions are emitted in no
+ * particular order and may be produced concurrently.
+ *
+ * The output schema refers to the columns of the child with a tuple index of 0, and to the value of the j-th window
+ * function with a tuple index of 1 and a value index of j.
+ */
+class WindowPlanNode : public AbstractPlanNode {
+ public:
+  /**
+   * Builder for a window plan node
+   */
+  class Builder : public AbstractPlanNode::Builder<Builder> {
+   public:
+    Builder() = default;
+
+    /**
+     * Don't allow builder to be copied or moved
+     */
+    DISALLOW_COPY_AND_MOVE(Builder);
+
+    /**
+     * @param key expression to PARTITION BY
+     * @return builder object
+     */
+    Builder &AddPartitionByKey(common::ManagedPointer<parser::AbstractExpression> key) {
+      partition_by_keys_.emplace_back(key);
+      return *this;
+    }
+
+    /**
+     * @param key expression to ORDER BY within a partition
+     * @param ordering ordering (ASC or DESC) for key
+     * @return builder object
+     */
+    Builder &AddSortKey(common::ManagedPointer<parser::AbstractExpression> key,
+                        optimizer::OrderByOrderingType ordering) {
+      sort_keys_.emplace_back(key, ordering);
+      return *this;
+    }
+
+    /**
+     * @param window_function window function to evaluate for every row
+     * @return builder object
+     */
+    Builder &AddWindowFunction(const WindowFunction &window_function) {
+      window_functions_.emplace_back(window_function);
+      return *this;
+    }
+
+    /**
+     * Build the window plan node
+     * @return plan node
+     */
+    std::unique_ptr<WindowPlanNode> Build();
+
+   protected:
+    /**
+     * Expressions that split the input into partitions
+     */
+    std::vector<common::ManagedPointer<parser::AbstractExpression>> partition_by_keys_;
+    /**
+     * Expressions and ordering types used (in order) to sort the rows of a partition
+     */
+    std::vector<SortKey> sort_keys_;
+    /**
+     * Window functions evaluated for every row
+     */
+    std::vector<WindowFunction> window_functions_;
+  };
+
+ private:
+  /**
+   * @param children child plan nodes
+   * @param output_schema Schema representing the structure of the output of this plan node
+   * @param partition_by_keys expressions that split the input into partitions
+   * @param sort_keys keys on which to sort the rows of a partition
+   * @param window_functions window functions evaluated for every row
+   * @param plan_node_id Plan node id
+   */
+  WindowPlanNode(std::vector<std::unique_ptr<AbstractPlanNode>> &&children, std::unique_ptr<OutputSchema> output_schema,
+                 std::vector<common::ManagedPointer<parser::AbstractExpression>> partition_by_keys,
+                 std::vector<SortKey> sort_keys, std::vector<WindowFunction> window_functions,
+                 plan_node_id_t plan_node_id);
+
+ public:
+  /**
+   * Default constructor used for deserialization
+   */
+  WindowPlanNode() = default;
+
+  DISALLOW_COPY_AND_MOVE(WindowPlanNode)
+
+  /**
+   * @return expressions that split the input into partitions
+   */
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetPartitionByKeys() const {
+    return partition_by_keys_;
+  }
+
+  /**
+   * @return keys to sort the rows of a partition on
+   */
+  const std::vector<SortKey> &GetSortKeys() const { return sort_keys_; }
+
+  /**
+   * @return window functions evaluated for every row
+   */
+  const std::vector<WindowFunction> &GetWindowFunctions() const { return window_functions_; }
+
+  /**
+   * @return the type of this plan node
+   */
+  PlanNodeType GetPlanNodeType() const override { return PlanNodeType::WINDOW; }
+
+  /**
+   * @return the hashed value of this plan node
+   */
+  common::hash_t Hash() const override;
+
+  bool operator==(const AbstractPlanNode &rhs) const override;
+
+  void Accept(common::ManagedPointer<PlanVisitor> v) const override { v->Visit(this); }
+
+  nlohmann::json ToJson() const override;
+  std::vector<std::unique_ptr<parser::AbstractExpression>> FromJson(const nlohmann::json &j) override;
+
+ private:
+  /* Expressions that split the input into partitions */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> partition_by_keys_;
+
+  /* Expressions and ordering types used (in order) to sort the rows of a partition */
+  std::vector<SortKey> sort_keys_;
+
+  /* Window functions evaluated for every row */
+  std::vector<WindowFunction> window_functions_;
+};
+
+DEFINE_JSON_HEADER_DECLARATIONS(WindowPlanNode);
+
+}  // namespace noisepage::planner
@@ -1,12 +1,17 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>  // NOLINT
+#include <mutex>   // NOLINT
 #include <queue>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "replication/replication_manager.h"
+#include "replication/send_window.h"
 #include "storage/write_ahead_log/log_io.h"
 #include "transaction/transaction_defs.h"
 
@@ -24,11 +29,18 @@ class PrimaryReplicationManager final : public ReplicationManager {
    * @param port                        The port to listen on.
    * @param replication_hosts_path      The path to the replication.config file.
    * @param empty_buffer_queue          A queue of empty buffers that the replication manager may return buffers to.
+   * @param compress_batches            True to compress batches of log records with LZ4 before sending them.
+   * @param send_window                 Maximum number of batches that a replica may not have acknowledged yet before
+   *                                    sending blocks. 0 to never wait for acknowledgements.
+   * @param send_window_timeout         Maximum time that sending blocks before replicas that haven't acknowledged are
+   *                                    no longer waited for, until they catch up.
    */
   PrimaryReplicationManager(
       common::ManagedPointer<messenger::Messenger> messenger, const std::string &network_identity, uint16_t port,
       const std::string &replication_hosts_path,
-      common::ManagedPointer<common::ConcurrentBlockingQueue<storage::BufferedLogWriter *>> empty_buffer_queue);
+      common::ManagedPointer<common::ConcurrentBlockingQueue<storage::BufferedLogWriter *>> empty_buffer_queue,
+      bool compress_batches = false, uint64_t send_window = 0,
+      std::chrono::milliseconds send_window_timeout = std::chrono::milliseconds(1000));
 
   /** Destructor. */
   ~PrimaryReplicationManager() final;
@@ -59,6 +71,15 @@ class PrimaryReplicationManager final : public ReplicationManager {
   /** @return The ID of the last transaction that was sent to the replicas. */
   transaction::timestamp_t GetLastSentTransactionId() const { return newest_txn_sent_; }
 
+  /**
+   * Every transaction that started at or before the returned timestamp has finished, and has been applied by all the
+   * replicas if it was replicated synchronously. Asynchronously replicated transactions are never acknowledged, so they
+   * do not advance the watermark.
+   *
+   * @return The replicated transaction watermark, INVALID_TXN_TIMESTAMP if nothing has been acknowledged yet.
+   */
+  transaction::timestamp_t GetReplicatedTxnWatermark() const { return replicated_txn_watermark_.load(); }
+
  protected:
   /** The main event loop that the primary runs. This handles receiving messages. */
   void EventLoop(common::ManagedPointer<messenger::Messenger> messenger, const messenger::ZmqMessage &zmq_msg,
@@ -72,6 +93,7 @@ class PrimaryReplicationManager final : public ReplicationManager {
   record_batch_id_t GetNextBatchId();
 
   void Handle(const messenger::ZmqMessage &zmq_msg, const TxnAppliedMsg &msg);
+  void Handle(const messenger::ZmqMessage &zmq_msg, const RecordsBatchAckMsg &msg);
 
   /**
    * Queue of batches of commit callbacks. Each batch is tagged with whether there are corresponding commit records.
@@ -82,7 +104,23 @@ class PrimaryReplicationManager final : public ReplicationManager {
   std::queue<std::vector<storage::CommitCallback>> txn_callbacks_;
   /** Map from transaction start times (aka transaction ID) to list of replicas that have applied the transaction. */
   std::unordered_map<transaction::timestamp_t, std::unordered_set<std::string>> txns_applied_on_replicas_;
-  std::mutex callbacks_mutex_;  ///< Protecting txn_callbacks_ and txns_applied_on_replicas_.
+  /**
+   * OATs that were sent to the replicas, tagged with the number of batches of commit callbacks that were queued when
+   * the OAT was sent. Once that many batches have been processed, every transaction up to the OAT has been applied.
+   */
+  std::queue<std::pair<uint64_t, transaction::timestamp_t>> pending_oats_;
+  uint64_t num_callback_batches_queued_ = 0;     ///< Number of batches ever pushed to txn_callbacks_.
+  uint64_t num_callback_batches_processed_ = 0;  ///< Number of batches ever popped from txn_callbacks_.
+  /** See GetReplicatedTxnWatermark(). */
+  std::atomic<transaction::timestamp_t> replicated_txn_watermark_{transaction::INVALID_TXN_TIMESTAMP};
+  /** Protecting txn_callbacks_, txns_applied_on_replicas_, pending_oats_ and the callback batch counters. */
+  std::mutex callbacks_mutex_;
+
+  const bool compress_batches_;  ///< True if batches of log records are compressed before sending them.
+  /** Replicas ask for an acknowledgement every this many batches, so that the window keeps moving. 0 if no window. */
+  const uint64_t ack_interval_;
+  /** Limits the number of batches that the replicas have not acknowledged yet. */
+  SendWindow send_window_;
 
   /** ID of the next batch of log records to be sent out to all replicas. */
   record_batch_id_t next_batch_id_{1};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <set>
 #include <string>
 
 #include "replication/replication_manager.h"
@@ -55,9 +56,18 @@ class ReplicaReplicationManager final : public ReplicationManager {
 
  private:
   void Handle(const messenger::ZmqMessage &zmq_msg, const NotifyOATMsg &msg);
-  void Handle(const messenger::ZmqMessage &zmq_msg, const RecordsBatchMsg &msg);
+  /** Hands the batch to the log provider, which moves the contents out of the message. */
+  void Handle(const messenger::ZmqMessage &zmq_msg, RecordsBatchMsg *msg);
 
   storage::ReplicationLogProvider provider_;  ///< The log records being provided to recovery.
+
+  // The following are only accessed by the messenger thread that receives batches.
+  /** Every batch up to and including this one has been received. */
+  record_batch_id_t received_up_to_ = INVALID_RECORD_BATCH_ID;
+  /** Batches that were received out of order, after a batch that is still missing. */
+  std::set<record_batch_id_t> received_ahead_;
+  /** Newest batch that the primary asked to acknowledge and that has not been acknowledged yet, INVALID if none. */
+  record_batch_id_t ack_pending_ = INVALID_RECORD_BATCH_ID;
 };
 
 }  // namespace noisepage::replication
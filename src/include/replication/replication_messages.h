@@ -1,13 +1,15 @@
 #pragma once
 
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "common/enum_defs.h"
-#include "common/json_header.h"
 #include "common/macros.h"
 #include "messenger/messenger_defs.h"
 #include "replication/replication_defs.h"
@@ -19,76 +21,120 @@ class BufferedLogWriter;
 
 namespace noisepage::replication {
 
-#define REPLICATION_MESSAGE_TYPE_ENUM(T)                                                    \
-  /** Invalid message type (for uninitialized or invalid state only!). */                   \
-  T(ReplicationMessageType, INVALID)                                                        \
-  /** Primary notifying the replica of the oldest active txn time. */                       \
-  T(ReplicationMessageType, NOTIFY_OAT)                                                     \
-  /** Primary sending the replica a batch of log records.*/                                 \
-  T(ReplicationMessageType, RECORDS_BATCH)                                                  \
-  /** Replica notifying the primary that the replica has applied a specific transaction. */ \
+#define REPLICATION_MESSAGE_TYPE_ENUM(T)                                                      \
+  /** Invalid message type (for uninitialized or invalid state only!). */                     \
+  T(ReplicationMessageType, INVALID)                                                          \
+  /** Primary notifying the replica of the oldest active txn time. */                         \
+  T(ReplicationMessageType, NOTIFY_OAT)                                                       \
+  /** Primary sending the replica a batch of log records.*/                                   \
+  T(ReplicationMessageType, RECORDS_BATCH)                                                    \
+  /** Replica acknowledging that it has received every batch of log records up to a batch. */ \
+  T(ReplicationMessageType, RECORDS_BATCH_ACK)                                                \
+  /** Replica notifying the primary that the replica has applied a specific transaction. */   \
   T(ReplicationMessageType, TXN_APPLIED)
 
 /** The type of message that is being sent. */
 ENUM_DEFINE(ReplicationMessageType, uint8_t, REPLICATION_MESSAGE_TYPE_ENUM);
 #undef REPLICATION_MESSAGE_TYPE_ENUM
 
-/** Abstraction over the underlying format used to send replication messages over the network */
-class MessageWrapper {
+/**
+ * Writes the fields of a replication message in a compact binary format. Fields are written in host byte order, since
+ * the primary and the replicas run the same build. There is no per-field framing; readers have to read the fields back
+ * in the order that they were written.
+ */
+class MessageWriter {
  public:
-  /** The underlying format of messages used in replication */
-  using MessageFormat = common::json;
-
-  /** Default constructor */
-  MessageWrapper();
-
-  /** Constructor which parses a string */
-  explicit MessageWrapper(std::string_view str);
-
   /**
-   * Adds a value to the message with a specific key
-   *
-   * @tparam T type of value to add
-   * @param key key of value in message
-   * @param value value to add to message
+   * Append a trivially copyable value to the message.
+   * @tparam T type of value to append
+   * @param value value to append
    */
   template <typename T>
-  void Put(const char *key, T value);
+  void Write(const T value) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written directly.");
+    WriteBytes(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
 
   /**
-   * Get a value from the message with specific key
-   *
-   * @tparam T type of value to get
-   * @param key key of value
-   * @return value from message with specified key
+   * Overwrite a value that was written before, e.g., flags that are only known after compressing the payload.
+   * @tparam T type of value to overwrite
+   * @param offset offset of the value in the message
+   * @param value new value
    */
   template <typename T>
-  T Get(const char *key) const;
+  void WriteAt(const size_t offset, const T value) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written directly.");
+    NOISEPAGE_ASSERT(offset + sizeof(T) <= buffer_.size(), "Can only overwrite values that were written before.");
+    std::memcpy(buffer_.data() + offset, &value, sizeof(T));
+  }
 
   /**
-   * Serialize the message
-   *
-   * @return serialized version of message
+   * Append raw bytes to the message.
+   * @param data bytes to append
+   * @param size number of bytes to append
    */
-  std::string Serialize() const;
+  void WriteBytes(const char *data, size_t size) { buffer_.append(data, size); }
 
   /**
-   * Converts MessageWrapper to JSON
-   * @return JSON version of MessageWrapper
+   * Make room for bytes that are filled in by the caller, e.g., by a compressor.
+   * @param size number of bytes to reserve
+   * @return pointer to the reserved bytes, valid until the next write
    */
-  common::json ToJson() const;
+  char *Reserve(size_t size) {
+    const size_t offset = buffer_.size();
+    buffer_.resize(offset + size);
+    return buffer_.data() + offset;
+  }
 
   /**
-   * Converts JSON to MessageWrapper
-   * @param j JSON to convert
+   * Drop bytes from the end of the message, e.g., the unused part of a Reserve().
+   * @param size new size of the message
    */
-  void FromJson(const common::json &j);
+  void Truncate(size_t size) { buffer_.resize(size); }
+
+  /** @return the number of bytes written so far */
+  size_t Size() const { return buffer_.size(); }
+
+  /** @return the serialized message. The writer is empty afterwards. */
+  std::string Release() { return std::move(buffer_); }
 
  private:
-  std::unique_ptr<MessageFormat> underlying_message_;
+  std::string buffer_;
 };
 
-DEFINE_JSON_HEADER_DECLARATIONS(MessageWrapper);
+/** Reads the fields of a replication message that was written by a MessageWriter. */
+class MessageReader {
+ public:
+  /** @param str the serialized message, which must outlive the reader */
+  explicit MessageReader(std::string_view str) : str_(str) {}
+
+  /**
+   * Read the next value of the message.
+   * @tparam T type of value to read
+   * @return the value
+   */
+  template <typename T>
+  T Read() {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be read directly.");
+    T value;
+    std::memcpy(&value, ReadBytes(sizeof(T)).data(), sizeof(T));
+    return value;
+  }
+
+  /**
+   * Read the next bytes of the message without copying them.
+   * @param size number of bytes to read
+   * @return view of the bytes, valid as long as the serialized message
+   */
+  std::string_view ReadBytes(size_t size);
+
+  /** @return the number of bytes that have not been read yet */
+  size_t Remaining() const { return str_.size() - pos_; }
+
+ private:
+  std::string_view str_;
+  size_t pos_ = 0;
+};
 
 /** ReplicationMessageMetadata contains all of the metadata that every type of BaseReplicationMessage should contain. */
 class ReplicationMessageMetadata {
@@ -96,17 +142,16 @@ class ReplicationMessageMetadata {
   /** Constructor (to send). */
   explicit ReplicationMessageMetadata(msg_id_t msg_id);
   /** Constructor (to receive). */
-  explicit ReplicationMessageMetadata(const MessageWrapper &message);
+  explicit ReplicationMessageMetadata(MessageReader *reader);
 
-  /** @return     The MessageWrapper form of this metadata. */
-  MessageWrapper ToMessageWrapper() const;
+  /** Append this metadata to the message. */
+  void Serialize(MessageWriter *writer) const;
 
   /** @return     The ID of the message. */
   msg_id_t GetMessageId() const { return msg_id_; }
 
  private:
-  static const char *key_message_id;  ///< JSON key for the message ID.
-  msg_id_t msg_id_;                   ///< The ID of this message.
+  msg_id_t msg_id_;  ///< The ID of this message.
 };
 
 /** Base class for all replicated messages. */
@@ -133,15 +178,12 @@ class BaseReplicationMessage {
  protected:
   /** Constructor (to send). */
   explicit BaseReplicationMessage(ReplicationMessageType type, ReplicationMessageMetadata metadata);
-  /** Constructor (to receive). */
-  explicit BaseReplicationMessage(const MessageWrapper &message);
-  /** Converts message into MessageWrapper form */
-  virtual MessageWrapper ToMessageWrapper() const;
+  /** Constructor (to receive). The message type has already been read by ParseFromString(). */
+  BaseReplicationMessage(ReplicationMessageType type, MessageReader *reader);
+  /** Append the fields of the derived message, which follow the type and the metadata. */
+  virtual void SerializeFields(MessageWriter *writer) const = 0;
 
  private:
-  static const char *key_message_type;  ///< JSON key for the message type.
-  static const char *key_metadata;      ///< JSON key for the message metadata.
-
   ReplicationMessageType type_;          ///< The type of this message.
   ReplicationMessageMetadata metadata_;  ///< The metadata for this message.
 };
@@ -162,7 +204,7 @@ class NotifyOATMsg : public BaseReplicationMessage {
   NotifyOATMsg(ReplicationMessageMetadata metadata, record_batch_id_t batch_id,
                transaction::timestamp_t oldest_active_txn);
   /** Constructor (to receive). */
-  explicit NotifyOATMsg(const MessageWrapper &message);
+  explicit NotifyOATMsg(MessageReader *reader);
   /** Destructor. */
   ~NotifyOATMsg() override = default;
 
@@ -175,12 +217,9 @@ class NotifyOATMsg : public BaseReplicationMessage {
   transaction::timestamp_t GetOldestActiveTxn() const { return oldest_active_txn_; }
 
  protected:
-  MessageWrapper ToMessageWrapper() const override;
+  void SerializeFields(MessageWriter *writer) const override;
 
  private:
-  static const char *key_batch_id;           ///< JSON key for the batch ID.
-  static const char *key_oldest_active_txn;  ///< JSON key for the oldest active transaction.
-
   record_batch_id_t batch_id_;  ///< The batch ID identifies the batch that must be received before applying this OAT.
   transaction::timestamp_t oldest_active_txn_;  ///< Oldest active transaction.
 };
@@ -188,6 +227,10 @@ class NotifyOATMsg : public BaseReplicationMessage {
 /**
  * RecordsBatchMsg is sent from primary -> replica, containing a batch of log records to be applied.
  * Note that the log records in the same batch are not necessarily from the same transaction.
+ *
+ * The serialized BufferedLogWriter contents are the payload of the message as they are, optionally compressed with
+ * LZ4. A message that is being sent refers to the buffer instead of copying it, so the buffer must not be reused before
+ * the message has been serialized.
  */
 class RecordsBatchMsg : public BaseReplicationMessage {
  public:
@@ -197,10 +240,18 @@ class RecordsBatchMsg : public BaseReplicationMessage {
    * @param metadata            The metadata of the message.
    * @param batch_id            The ID for this batch of log records.
    * @param buffer              The contents of this batch of log records.
+   * @param compress            True to compress the contents if that makes the message smaller. Ignored if NoisePage
+   *                            was built without NOISEPAGE_USE_LZ4.
+   * @param ack_requested       True if the replica should acknowledge this batch, see RecordsBatchAckMsg.
    */
-  RecordsBatchMsg(ReplicationMessageMetadata metadata, record_batch_id_t batch_id, storage::BufferedLogWriter *buffer);
-  /** Constructor (to receive). */
-  explicit RecordsBatchMsg(const MessageWrapper &message);
+  RecordsBatchMsg(ReplicationMessageMetadata metadata, record_batch_id_t batch_id, storage::BufferedLogWriter *buffer,
+                  bool compress = false, bool ack_requested = false);
+  /** Constructor (to receive). The contents are decompressed if necessary. */
+  explicit RecordsBatchMsg(MessageReader *reader);
+  /** Move constructor, used to hand received batches to the log provider without copying them. */
+  RecordsBatchMsg(RecordsBatchMsg &&other) = default;
+  /** Move assignment, used to hand received batches to the log provider without copying them. */
+  RecordsBatchMsg &operator=(RecordsBatchMsg &&other) = default;
   /** Destructor. */
   ~RecordsBatchMsg() override = default;
 
@@ -209,8 +260,14 @@ class RecordsBatchMsg : public BaseReplicationMessage {
   /** @return The ID of this batch of log records. */
   record_batch_id_t GetBatchId() const { return batch_id_; }
 
-  /** @return The contents of this batch of log records. */
-  std::string GetContents() const { return contents_; }
+  /** @return True if the replica should acknowledge this batch. */
+  bool IsAckRequested() const { return ack_requested_; }
+
+  /** @return The contents of this batch, valid as long as this message and the buffer that it is sent from. */
+  std::string_view GetContents() const;
+
+  /** @return The contents of a received batch of log records. The message is empty afterwards. */
+  std::string ReleaseContents() { return std::move(contents_); }
 
   /** @return The batch ID that should appear after the given batch ID. */
   static record_batch_id_t NextBatchId(record_batch_id_t batch_id) {
@@ -221,14 +278,44 @@ class RecordsBatchMsg : public BaseReplicationMessage {
   }
 
  protected:
-  MessageWrapper ToMessageWrapper() const override;
+  void SerializeFields(MessageWriter *writer) const override;
 
  private:
-  static const char *key_batch_id;  ///< JSON key for the batch ID.
-  static const char *key_contents;  ///< JSON key for the contents.
+  /** Flags of a serialized batch. */
+  enum Flags : uint8_t { NONE = 0, LZ4_COMPRESSED = 1U << 0U, ACK_REQUESTED = 1U << 1U };
 
   record_batch_id_t batch_id_;  ///< The batch ID identifies the order of records sent by the remote origin.
-  std::string contents_;        ///< The actual contents of the buffer.
+  bool compress_ = false;       ///< True if the contents should be compressed when sending.
+  bool ack_requested_ = false;  ///< True if the replica should acknowledge this batch.
+  storage::BufferedLogWriter *buffer_ = nullptr;  ///< The buffer that is being sent, nullptr for received batches.
+  std::string contents_;                          ///< The contents of a received batch.
+};
+
+/**
+ * RecordsBatchAckMsg is sent from replica -> primary, indicating that the replica has received every batch of log
+ * records up to and including the given batch. The primary limits the number of batches that are not acknowledged yet,
+ * so that it can pipeline batches without flooding slow replicas. Replicas only acknowledge the batches that the
+ * primary asked them to acknowledge.
+ */
+class RecordsBatchAckMsg : public BaseReplicationMessage {
+ public:
+  /** Constructor (to send). */
+  RecordsBatchAckMsg(ReplicationMessageMetadata metadata, record_batch_id_t received_batch_id);
+  /** Constructor (to receive). */
+  explicit RecordsBatchAckMsg(MessageReader *reader);
+  /** Destructor. */
+  ~RecordsBatchAckMsg() override = default;
+
+  ReplicationMessageType GetMessageType() const override { return ReplicationMessageType::RECORDS_BATCH_ACK; }
+
+  /** @return The ID of the newest batch such that the replica has received every batch up to it. */
+  record_batch_id_t GetReceivedBatchId() const { return received_batch_id_; }
+
+ protected:
+  void SerializeFields(MessageWriter *writer) const override;
+
+ private:
+  record_batch_id_t received_batch_id_;  ///< Every batch up to this one has been received.
 };
 
 /** TxnAppliedMsg is sent from replica -> primary, indicating that a given transaction has been successfully applied. */
@@ -237,7 +324,7 @@ class TxnAppliedMsg : public BaseReplicationMessage {
   /** Constructor (to send). */
   explicit TxnAppliedMsg(ReplicationMessageMetadata metadata, transaction::timestamp_t applied_txn_id);
   /** Constructor (to receive). */
-  explicit TxnAppliedMsg(const MessageWrapper &message);
+  explicit TxnAppliedMsg(MessageReader *reader);
   /** Destructor. */
   ~TxnAppliedMsg() override = default;
 
@@ -247,10 +334,9 @@ class TxnAppliedMsg : public BaseReplicationMessage {
   transaction::timestamp_t GetAppliedTxnId() const { return applied_txn_id_; }
 
  protected:
-  MessageWrapper ToMessageWrapper() const override;
+  void SerializeFields(MessageWriter *writer) const override;
 
  private:
-  static const char *key_applied_txn_id;     ///< JSON key for the applied transaction ID.
   transaction::timestamp_t applied_txn_id_;  ///< The ID of the transaction that was applied on the replica.
 };
 
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <chrono>              // NOLINT
+#include <condition_variable>  // NOLINT
+#include <mutex>               // NOLINT
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "replication/replication_defs.h"
+
+namespace noisepage::replication {
+
+/**
+ * Flow control for the batches of log records that the primary pipelines to its replicas.
+ *
+ * A batch may be sent once every replica has acknowledged all but the last size batches before it. A replica that
+ * doesn't acknowledge in time, e.g., because it is dead or disconnected, is dropped from the window so that it can't
+ * stall the log serializer, and thus every commit on the primary. It rejoins the window once its acknowledgements
+ * catch up with the batches being sent.
+ */
+class SendWindow {
+ public:
+  /**
+   * Create a send window.
+   *
+   * @param replicas    The names of the replicas that batches are sent to.
+   * @param size        Maximum number of batches that a replica may not have acknowledged yet. 0 to never wait.
+   * @param timeout     Maximum time to wait for the replicas before dropping the lagging ones from the window.
+   */
+  SendWindow(std::vector<std::string> replicas, uint64_t size, std::chrono::milliseconds timeout);
+
+  /**
+   * Block until sending the given batch keeps every replica in the window within it. Replicas that are still lagging
+   * once the timeout expires are dropped from the window.
+   *
+   * @param batch_id    The batch that is about to be sent.
+   */
+  void WaitToSend(record_batch_id_t batch_id);
+
+  /**
+   * Record that the given replica received every batch up to the given one, and wake up the sender if it is waiting.
+   *
+   * @param replica     The name of the replica.
+   * @param batch_id    The newest batch such that the replica received every batch up to it.
+   */
+  void Acknowledge(const std::string &replica, record_batch_id_t batch_id);
+
+  /** @return True if the given replica was dropped from the window and hasn't caught up since. */
+  bool IsLagging(const std::string &replica) const;
+
+ private:
+  // True if the replica acknowledged enough batches to receive the given one. Requires holding mutex_.
+  bool IsWithinWindow(const std::string &replica, record_batch_id_t batch_id) const;
+
+  const std::vector<std::string> replicas_;
+  const uint64_t size_;
+  const std::chrono::milliseconds timeout_;
+
+  /** Map from replica name to the newest batch such that the replica has received every batch up to it. */
+  std::unordered_map<std::string, record_batch_id_t> received_batches_;
+  /** Replicas that were dropped from the window. They are not waited for until they catch up. */
+  std::unordered_set<std::string> lagging_replicas_;
+  /** The newest batch that was about to be sent. */
+  record_batch_id_t newest_batch_id_ = INVALID_RECORD_BATCH_ID;
+  /** Protecting received_batches_, lagging_replicas_ and newest_batch_id_. */
+  mutable std::mutex mutex_;
+  /** Signalled whenever a replica acknowledges batches. */
+  std::condition_variable cv_;
+};
+
+}  // namespace noisepage::replication
@@ -32,6 +32,7 @@ class CompilerTest_SimpleHashJoinTest_Test;
 class CompilerTest_MultiWayHashJoinTest_Test;
 class CompilerTest_SimpleNestedLoopJoinTest_Test;
 class CompilerTest_SimpleIndexNestedLoopJoinTest_Test;
+class CompilerTest_BatchedIndexNestedLoopJoinTest_Test;
 class CompilerTest_SimpleIndexNestedLoopJoinMultiColumnTest_Test;
 class CompilerTest_SimpleDeleteTest_Test;
 class CompilerTest_SimpleUpdateTest_Test;
@@ -370,6 +371,7 @@ class PipelineOperatingUnits {
   friend class noisepage::execution::compiler::test::CompilerTest_MultiWayHashJoinTest_Test;
   friend class noisepage::execution::compiler::test::CompilerTest_SimpleNestedLoopJoinTest_Test;
   friend class noisepage::execution::compiler::test::CompilerTest_SimpleIndexNestedLoopJoinTest_Test;
+  friend class noisepage::execution::compiler::test::CompilerTest_BatchedIndexNestedLoopJoinTest_Test;
   friend class noisepage::execution::compiler::test::CompilerTest_SimpleIndexNestedLoopJoinMultiColumnTest_Test;
   friend class noisepage::execution::compiler::test::CompilerTest_SimpleDeleteTest_Test;
   friend class noisepage::execution::compiler::test::CompilerTest_SimpleUpdateTest_Test;
@@ -181,6 +181,24 @@ SETTING_bool(
     noisepage::settings::Callbacks::NoOp
 )
 
+SETTING_bool(
+    parallel_index_build,
+    "Whether CREATE INDEX scans the table in parallel, even if parallel_execution is disabled (default: false)",
+    false,
+    true,
+    noisepage::settings::Callbacks::NoOp
+)
+
+SETTING_int(
+    num_index_build_threads,
+    "Number of threads that scan the table for CREATE INDEX, 0 for one per hardware thread (default: 0)",
+    0,
+    0,
+    128,
+    true,
+    noisepage::settings::Callbacks::NoOp
+)
+
 // Log file persisting threshold
 SETTING_int64(
     wal_persist_threshold,
@@ -192,6 +210,35 @@ SETTING_int64(
     noisepage::settings::Callbacks::NoOp
 )
 
+// Log segment size
+SETTING_int64(
+    wal_segment_size,
+    "Size (bytes) after which the WAL is cut into a new segment file, 0 to write a single log file (default: 0)",
+    0,
+    0,
+    (1LL << 34) /* 16GB */,
+    false,
+    noisepage::settings::Callbacks::NoOp
+)
+
+// Write the WAL through io_uring
+SETTING_bool(
+    wal_io_uring_enable,
+    "Write the WAL through io_uring instead of blocking write and fdatasync calls, if available. (default: false)",
+    false,
+    false,
+    noisepage::settings::Callbacks::NoOp
+)
+
+// Bypass the page cache when writing the WAL through io_uring
+SETTING_bool(
+    wal_direct_io_enable,
+    "Open the WAL with O_DIRECT when writing it through io_uring. (default: false)",
+    false,
+    false,
+    noisepage::settings::Callbacks::NoOp
+)
+
 SETTING_int(
     extra_float_digits,
     "Sets the number of digits displayed for floating-point values. (default : 1)",
@@ -405,6 +452,14 @@ SETTING_bool(
     noisepage::settings::Callbacks::NoOp
 )
 
+SETTING_bool(
+    park_connection_on_commit,
+    "Connections wait for their commits to become durable without blocking a network thread, which serves other connections meanwhile.",
+    true,
+    false,
+    noisepage::settings::Callbacks::NoOp
+)
+
 SETTING_bool(
     compiled_query_execution,
     "Compile queries to native machine code using LLVM, rather than relying on TPL interpretation (default: false).",
@@ -491,6 +546,44 @@ SETTING_string(
     noisepage::settings::Callbacks::NoOp
 )
 
+SETTING_bool(
+    replication_compression_enable,
+    "Compress batches of log records with LZ4 before sending them to the replicas, if built with LZ4 (default: false)",
+    false,
+    false,
+    noisepage::settings::Callbacks::NoOp
+)
+
+SETTING_int(
+    replication_send_window,
+    "Maximum number of batches of log records that a replica may not have acknowledged yet before the primary waits. 0 to never wait (default: 64)",
+    64,
+    0,
+    1048576,
+    false,
+    noisepage::settings::Callbacks::NoOp
+)
+
+SETTING_int(
+    replication_send_window_timeout,
+    "Maximum time in milliseconds that the primary waits for a replica to acknowledge batches of log records before it stops waiting for that replica until it catches up (default: 1000)",
+    1000,
+    1,
+    3600000,
+    false,
+    noisepage::settings::Callbacks::NoOp
+)
+
+SETTING_int(
+    replication_apply_threads,
+    "Number of threads that apply replicated transactions on a replica. With more than one thread, transactions that modify disjoint sets of user tables are applied in parallel (default: 1)",
+    1,
+    1,
+    256,
+    false,
+    noisepage::settings::Callbacks::NoOp
+)
+
 SETTING_bool(
     model_server_enable,
     "Whether to enable the ModelServerManager (default: false)",
@@ -33,6 +33,8 @@ template <typename KeyType>
 class HashIndex;
 template <typename KeyType>
 class BPlusTreeIndex;
+template <typename KeyType>
+class ARTIndex;
 }  // namespace index
 
 /**
@@ -320,6 +322,8 @@ class DataTable {
   friend class index::HashIndex;
   template <typename KeyType>
   friend class index::BPlusTreeIndex;
+  template <typename KeyType>
+  friend class index::ARTIndex;
   // The block compactor elides transactional protection in the gather/compression phase and
   // needs raw access to the underlying table.
   friend class BlockCompactor;
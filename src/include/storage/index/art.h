@@ -0,0 +1,1020 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "common/macros.h"
+#include "common/optimistic_latch.h"
+#include "common/strong_typedef.h"
+#include "storage/index/epoch_manager.h"
+
+namespace noisepage::storage::index {
+
+/**
+ * Adaptive Radix Tree (ART), following "The Adaptive Radix Tree: ARTful Indexing for Main-Memory Databases" by Leis et
+ * al., and synchronized with optimistic lock coupling, following "The ART of Practical Synchronization" by the same
+ * authors.
+ *
+ * Keys are indexed by their binary-comparable form (see KeyType::ToBinaryComparable()), one byte per level. Inner
+ * nodes come in four sizes, with up to 4, 16, 48 and 256 children, and grow and shrink as children come and go. Paths
+ * without branches are compressed into the prefix of the node below them, and a leaf hangs off the first level where
+ * its key differs from all others, so that the tree stays shallow for sparse keys. A leaf keeps the full key and the
+ * list of values of the key.
+ *
+ * Read: Lookups and scans do not latch. They read the version of every node that they pass, and restart if a writer
+ * held the node in the meantime (see common::OptimisticLatch). Before moving to a child, the version of the child is
+ * read and then the version of the parent is validated, so that the child was still reachable when its version was
+ * read.
+ *
+ * Write: Writers traverse the same way and only latch the nodes that they change, by upgrading the versions that they
+ * read. Adding a child to a node or changing the values of a key latches the node. Replacing a node by a larger or
+ * smaller one, or splitting its prefix, also latches the parent. Latches are always taken top-down.
+ *
+ * Since readers do not latch, nodes, leaves and value lists that writers unlink are retired to an EpochManager instead
+ * of being freed, and value lists are replaced instead of being modified in place.
+ *
+ * @tparam KeyType type of the keys, which must provide ToBinaryComparable() and BINARY_COMPARABLE_SIZE. The
+ * binary-comparable form of a key must not be a prefix of the form of another key.
+ * @tparam ValueType type of the values
+ * @tparam ValueEqualityChecker compares values for equality
+ */
+template <typename KeyType, typename ValueType, typename ValueEqualityChecker = std::equal_to<ValueType>>
+class AdaptiveRadixTree {
+ public:
+  /** Values of a key */
+  using ValueList = std::vector<ValueType>;
+
+ private:
+  /** Maximum length of the binary-comparable form of a key */
+  static constexpr uint16_t MAX_KEY_LENGTH = KeyType::BINARY_COMPARABLE_SIZE;
+
+  /** A child is either a node or, if the lowest bit is set, a leaf */
+  using Child = uintptr_t;
+
+  /** Number of keys whose lookups FindValuesBatch() interleaves, i.e., the number of cache misses that overlap */
+  static constexpr uint32_t BATCH_LOOKUP_GROUP_SIZE = 16;
+
+  /** Outcome of a single attempt at an operation, or of a single step of a lookup */
+  enum class Outcome : uint8_t { SUCCESS, FAILURE, RESTART, PENDING };
+
+  /** Binary-comparable form of a key */
+  struct EncodedKey {
+    std::array<uint8_t, MAX_KEY_LENGTH> bytes_;
+    uint16_t length_ = 0;
+
+    void Assign(const KeyType &key) { length_ = key.ToBinaryComparable(reinterpret_cast<byte *>(bytes_.data())); }
+
+    void Assign(const uint8_t *const bytes, const uint16_t length) {
+      std::memcpy(bytes_.data(), bytes, length);
+      length_ = length;
+    }
+  };
+
+  /** A key and its values. The binary-comparable form of the key is stored right after the leaf. */
+  struct Leaf {
+    Leaf(const KeyType &key, const uint16_t length, const ValueList *const values)
+        : key_(key), values_(values), length_(length) {}
+
+    const uint8_t *Bytes() const { return reinterpret_cast<const uint8_t *>(this + 1); }
+    uint8_t *Bytes() { return reinterpret_cast<uint8_t *>(this + 1); }
+
+    const KeyType key_;
+    std::atomic<const ValueList *> values_;  // replaced under the latch of the node that holds the leaf
+    const uint16_t length_;
+  };
+
+  enum class NodeType : uint8_t { NODE4, NODE16, NODE48, NODE256 };
+
+  /** Header of all inner nodes. The prefix is stored right after the node. */
+  struct Node {
+    Node(const NodeType type, const uint32_t prefix_length)
+        : type_(type), prefix_length_(prefix_length), prefix_capacity_(prefix_length) {}
+
+    common::OptimisticLatch latch_;
+    const NodeType type_;
+    uint16_t num_children_ = 0;
+    uint32_t prefix_length_;  // only ever shrinks, when a new node branches off above this one
+    const uint32_t prefix_capacity_;
+  };
+
+  /** Node with up to 4 children, sorted by key byte */
+  struct Node4 : Node {
+    static constexpr uint16_t CAPACITY = 4;
+    explicit Node4(const uint32_t prefix_length) : Node(NodeType::NODE4, prefix_length) {}
+    std::array<uint8_t, CAPACITY> keys_{};
+    std::array<Child, CAPACITY> children_{};
+  };
+
+  /** Node with up to 16 children, sorted by key byte */
+  struct Node16 : Node {
+    static constexpr uint16_t CAPACITY = 16;
+    explicit Node16(const uint32_t prefix_length) : Node(NodeType::NODE16, prefix_length) {}
+    std::array<uint8_t, CAPACITY> keys_{};
+    std::array<Child, CAPACITY> children_{};
+  };
+
+  /** Node with up to 48 children, indexed by key byte */
+  struct Node48 : Node {
+    static constexpr uint16_t CAPACITY = 48;
+    static constexpr uint8_t EMPTY = 0xFF;
+    explicit Node48(const uint32_t prefix_length) : Node(NodeType::NODE48, prefix_length) { child_index_.fill(EMPTY); }
+    std::array<uint8_t, 256> child_index_;
+    std::array<Child, CAPACITY> children_{};
+  };
+
+  /** Node with a child for every key byte */
+  struct Node256 : Node {
+    static constexpr uint16_t CAPACITY = 256;
+    explicit Node256(const uint32_t prefix_length) : Node(NodeType::NODE256, prefix_length) {}
+    std::array<Child, CAPACITY> children_{};
+  };
+
+  /** State of a lookup that is advanced one node at a time by StepProbe() */
+  struct Probe {
+    const EncodedKey *key_;
+    const Node *node_;  // last node that was searched
+    uint64_t version_;  // version of node_
+    Child next_;        // child of node_ that the lookup visits next, 0 before the root is searched
+    uint32_t depth_;    // number of key bytes consumed up to node_, excluding its prefix
+  };
+
+ public:
+  AdaptiveRadixTree() { root_ = static_cast<Node256 *>(NewNode(NodeType::NODE256, nullptr, 0)); }
+
+  /**
+   * Frees all nodes, leaves and value lists. No other thread may access the tree at this point.
+   */
+  ~AdaptiveRadixTree() { FreeSubtree(reinterpret_cast<Child>(root_)); }
+
+  DISALLOW_COPY_AND_MOVE(AdaptiveRadixTree)
+
+  /**
+   * Insert a value for a key, unless the key already has the value or the predicate holds for one of its values.
+   * @param key key
+   * @param value value
+   * @param predicate checked against the existing values of the key, under the latch of the node that holds the key
+   * @return true if the value was inserted
+   */
+  bool Insert(const KeyType &key, const ValueType &value, const std::function<bool(const ValueType)> &predicate) {
+    EncodedKey encoded;
+    encoded.Assign(key);
+    EpochManager::Guard guard(&epoch_manager_);
+    while (true) {
+      const Outcome outcome = TryInsert(key, encoded, value, predicate);
+      if (outcome != Outcome::RESTART) return outcome == Outcome::SUCCESS;
+    }
+  }
+
+  /**
+   * Delete a value of a key. The key is removed along with its last value.
+   * @param key key
+   * @param value value
+   * @return true if the value was found and deleted
+   */
+  bool Delete(const KeyType &key, const ValueType &value) {
+    EncodedKey encoded;
+    encoded.Assign(key);
+    EpochManager::Guard guard(&epoch_manager_);
+    while (true) {
+      const Outcome outcome = TryDelete(encoded, value);
+      if (outcome != Outcome::RESTART) return outcome == Outcome::SUCCESS;
+    }
+  }
+
+  /**
+   * Find the values of a key. This does not latch.
+   * @param key key
+   * @param[out] values the values of the key are appended to this
+   */
+  void FindValues(const KeyType &key, std::vector<ValueType> *const values) {
+    EncodedKey encoded;
+    encoded.Assign(key);
+    EpochManager::Guard guard(&epoch_manager_);
+    while (TryFind(encoded, values) == Outcome::RESTART) {
+    }
+  }
+
+  /**
+   * Find the values of a batch of keys, like FindValues() for every key. This does not latch. The lookups of a group of
+   * keys take turns descending one node each, and every lookup prefetches the node it visits next, so that the cache
+   * misses of the group overlap instead of stalling one after the other.
+   * @param keys keys
+   * @param num_keys number of keys
+   * @param[out] values array of num_keys vectors, the values of every key are appended to the vector of the key
+   */
+  void FindValuesBatch(const KeyType *const keys, const uint32_t num_keys, std::vector<ValueType> *const values) {
+    std::array<EncodedKey, BATCH_LOOKUP_GROUP_SIZE> encoded;
+    std::array<Probe, BATCH_LOOKUP_GROUP_SIZE> probes;
+    std::array<uint32_t, BATCH_LOOKUP_GROUP_SIZE> active;  // keys of the group whose lookup is still running
+    EpochManager::Guard guard(&epoch_manager_);
+    for (uint32_t group_begin = 0; group_begin < num_keys; group_begin += BATCH_LOOKUP_GROUP_SIZE) {
+      const uint32_t group_size = std::min(BATCH_LOOKUP_GROUP_SIZE, num_keys - group_begin);
+      uint32_t num_active = 0;
+      for (uint32_t i = 0; i < group_size; i++) {
+        encoded[i].Assign(keys[group_begin + i]);
+        StartProbe(encoded[i], &probes[i]);
+        active[num_active++] = i;
+      }
+      while (num_active > 0) {
+        uint32_t num_remaining = 0;
+        for (uint32_t j = 0; j < num_active; j++) {
+          const uint32_t i = active[j];
+          const Outcome outcome = StepProbe(&probes[i], &values[group_begin + i]);
+          if (outcome == Outcome::RESTART) StartProbe(encoded[i], &probes[i]);
+          if (outcome == Outcome::RESTART || outcome == Outcome::PENDING) active[num_remaining++] = i;
+        }
+        num_active = num_remaining;
+      }
+    }
+  }
+
+  /**
+   * Visit keys in order, starting at the given key. This does not latch. If a writer gets in the way, the scan
+   * continues after the last visited key, so that every key is visited at most once. A key that is present during the
+   * whole scan is visited exactly once.
+   * @tparam Visitor callable as bool(const KeyType &, const ValueList &), which returns false to end the scan
+   * @param start_key first key to visit if present, nullptr to start at the smallest (ascending) or largest key
+   * @param ascending true to visit keys in ascending order, false for descending order
+   * @param visitor called for every key, along with its values
+   */
+  template <typename Visitor>
+  void Scan(const KeyType *const start_key, const bool ascending, Visitor visitor) {
+    EpochManager::Guard guard(&epoch_manager_);
+    ScanState state{ascending, start_key != nullptr, true, {}, {}};
+    if (start_key != nullptr) state.bound_.Assign(*start_key);
+    while (true) {
+      const uint64_t version = root_->latch_.ReadVersion();
+      if (ScanNode(root_, version, 0, state.bounded_, &state, &visitor) != Outcome::RESTART) return;
+    }
+  }
+
+  /**
+   * Free the retired nodes, leaves and value lists that no reader can see anymore.
+   */
+  void PerformGarbageCollection() { epoch_manager_.Reclaim(); }
+
+  /** @return number of keys in the tree */
+  uint64_t GetSize() const { return num_keys_; }
+
+  /** @return number of bytes that the nodes, leaves and value lists of the tree take on the heap */
+  size_t EstimateHeapUsage() const { return heap_usage_; }
+
+ private:
+  /** State of a scan, which survives restarts */
+  struct ScanState {
+    const bool ascending_;
+    bool bounded_;    // whether to skip keys before bound_
+    bool inclusive_;  // whether bound_ itself is visited
+    EncodedKey bound_;
+    std::vector<std::pair<uint8_t, Child>> children_;  // children of the nodes on the current path
+  };
+
+  static bool IsLeaf(const Child child) { return (child & 1U) != 0; }
+  static Leaf *AsLeaf(const Child child) { return reinterpret_cast<Leaf *>(child & ~Child{1}); }
+  static Node *AsNode(const Child child) { return reinterpret_cast<Node *>(child); }
+  static Child LeafChild(Leaf *const leaf) { return reinterpret_cast<Child>(leaf) | 1U; }
+  static Child NodeChild(Node *const node) { return reinterpret_cast<Child>(node); }
+
+  static size_t NodeSize(const NodeType type) {
+    switch (type) {
+      case NodeType::NODE4:
+        return sizeof(Node4);
+      case NodeType::NODE16:
+        return sizeof(Node16);
+      case NodeType::NODE48:
+        return sizeof(Node48);
+      default:
+        return sizeof(Node256);
+    }
+  }
+
+  static const uint8_t *Prefix(const Node *const node) {
+    return reinterpret_cast<const uint8_t *>(node) + NodeSize(node->type_);
+  }
+  static uint8_t *Prefix(Node *const node) { return reinterpret_cast<uint8_t *>(node) + NodeSize(node->type_); }
+
+  /** @return prefix length of a node, which may be read without the latch */
+  static uint32_t PrefixLength(const Node *const node) {
+    return std::min(node->prefix_length_, node->prefix_capacity_);
+  }
+
+  /**
+   * @return std::memcmp semantics for the two binary-comparable forms
+   */
+  static int CompareBytes(const uint8_t *const lhs, const uint16_t lhs_length, const uint8_t *const rhs,
+                          const uint16_t rhs_length) {
+    const int result = std::memcmp(lhs, rhs, std::min(lhs_length, rhs_length));
+    return result != 0 ? result : static_cast<int>(lhs_length) - static_cast<int>(rhs_length);
+  }
+
+  static bool LeafMatches(const Leaf *const leaf, const EncodedKey &key) {
+    return leaf->length_ == key.length_ && std::memcmp(leaf->Bytes(), key.bytes_.data(), key.length_) == 0;
+  }
+
+  // ---------------------------------------------------------------------------------------------------------------
+  // Allocation
+  // ---------------------------------------------------------------------------------------------------------------
+
+  Node *NewNode(const NodeType type, const uint8_t *const prefix, const uint32_t prefix_length) {
+    const size_t size = NodeSize(type) + prefix_length;
+    void *const memory = ::operator new(size);
+    Node *node;
+    switch (type) {
+      case NodeType::NODE4:
+        node = new (memory) Node4(prefix_length);
+        break;
+      case NodeType::NODE16:
+        node = new (memory) Node16(prefix_length);
+        break;
+      case NodeType::NODE48:
+        node = new (memory) Node48(prefix_length);
+        break;
+      default:
+        node = new (memory) Node256(prefix_length);
+        break;
+    }
+    if (prefix_length > 0) std::memcpy(Prefix(node), prefix, prefix_length);
+    heap_usage_ += size;
+    return node;
+  }
+
+  static void FreeNode(void *const ptr) {
+    auto *const node = static_cast<Node *>(ptr);
+    switch (node->type_) {
+      case NodeType::NODE4:
+        static_cast<Node4 *>(node)->~Node4();
+        break;
+      case NodeType::NODE16:
+        static_cast<Node16 *>(node)->~Node16();
+        break;
+      case NodeType::NODE48:
+        static_cast<Node48 *>(node)->~Node48();
+        break;
+      default:
+        static_cast<Node256 *>(node)->~Node256();
+        break;
+    }
+    ::operator delete(ptr);
+  }
+
+  ValueList *NewValueList(ValueList &&values) {
+    heap_usage_ += sizeof(ValueList) + values.capacity() * sizeof(ValueType);
+    return new ValueList(std::move(values));
+  }
+
+  Leaf *NewLeaf(const KeyType &key, const EncodedKey &encoded, const ValueType &value) {
+    const size_t size = sizeof(Leaf) + encoded.length_;
+    auto *const leaf = new (::operator new(size)) Leaf(key, encoded.length_, NewValueList(ValueList{value}));
+    std::memcpy(leaf->Bytes(), encoded.bytes_.data(), encoded.length_);
+    heap_usage_ += size;
+    return leaf;
+  }
+
+  /** Frees a leaf and its value list */
+  static void FreeLeaf(void *const ptr) {
+    auto *const leaf = static_cast<Leaf *>(ptr);
+    delete leaf->values_.load();
+    leaf->~Leaf();
+    ::operator delete(ptr);
+  }
+
+  void RetireNode(Node *const node) {
+    heap_usage_ -= NodeSize(node->type_) + node->prefix_capacity_;
+    epoch_manager_.Retire(node, FreeNode);
+  }
+
+  void RetireValueList(const ValueList *const values) {
+    heap_usage_ -= sizeof(ValueList) + values->capacity() * sizeof(ValueType);
+    epoch_manager_.Retire(const_cast<ValueList *>(values));
+  }
+
+  void RetireLeaf(Leaf *const leaf) {
+    const ValueList *const values = leaf->values_.load();
+    heap_usage_ -= sizeof(Leaf) + leaf->length_ + sizeof(ValueList) + values->capacity() * sizeof(ValueType);
+    epoch_manager_.Retire(leaf, FreeLeaf);
+  }
+
+  void FreeSubtree(const Child child) {
+    if (IsLeaf(child)) {
+      FreeLeaf(AsLeaf(child));
+      return;
+    }
+    Node *const node = AsNode(child);
+    ForEachChild(node, [this](uint8_t /*unused*/, const Child grandchild) { FreeSubtree(grandchild); });
+    FreeNode(node);
+  }
+
+  // ---------------------------------------------------------------------------------------------------------------
+  // Node operations. Readers may call FindChild() and ForEachChild() without the latch, and have to validate the
+  // version of the node before they act on the result. All other operations require the exclusive latch, or a node that
+  // is not reachable yet.
+  // ---------------------------------------------------------------------------------------------------------------
+
+  static Child FindChild(const Node *const node, const uint8_t key_byte) {
+    switch (node->type_) {
+      case NodeType::NODE4:
+        return FindSortedChild(static_cast<const Node4 *>(node), key_byte);
+      case NodeType::NODE16:
+        return FindSortedChild(static_cast<const Node16 *>(node), key_byte);
+      case NodeType::NODE48: {
+        const auto *const node48 = static_cast<const Node48 *>(node);
+        const uint8_t index = node48->child_index_[key_byte];
+        return index < Node48::CAPACITY ? node48->children_[index] : 0;
+      }
+      default:
+        return static_cast<const Node256 *>(node)->children_[key_byte];
+    }
+  }
+
+  template <typename SortedNode>
+  static Child FindSortedChild(const SortedNode *const node, const uint8_t key_byte) {
+    const uint16_t num_children = std::min(node->num_children_, SortedNode::CAPACITY);
+    for (uint16_t i = 0; i < num_children; i++) {
+      if (node->keys_[i] == key_byte) return node->children_[i];
+    }
+    return 0;
+  }
+
+  /** Calls the visitor with the key byte and child of every child of the node, in key byte order */
+  template <typename ChildVisitor>
+  static void ForEachChild(const Node *const node, ChildVisitor visitor) {
+    switch (node->type_) {
+      case NodeType::NODE4:
+        ForEachSortedChild(static_cast<const Node4 *>(node), visitor);
+        break;
+      case NodeType::NODE16:
+        ForEachSortedChild(static_cast<const Node16 *>(node), visitor);
+        break;
+      case NodeType::NODE48: {
+        const auto *const node48 = static_cast<const Node48 *>(node);
+        for (uint16_t key_byte = 0; key_byte < 256; key_byte++) {
+          const uint8_t index = node48->child_index_[key_byte];
+          if (index < Node48::CAPACITY && node48->children_[index] != 0) {
+            visitor(static_cast<uint8_t>(key_byte), node48->children_[index]);
+          }
+        }
+        break;
+      }
+      default: {
+        const auto *const node256 = static_cast<const Node256 *>(node);
+        for (uint16_t key_byte = 0; key_byte < 256; key_byte++) {
+          if (node256->children_[key_byte] != 0) visitor(static_cast<uint8_t>(key_byte), node256->children_[key_byte]);
+        }
+        break;
+      }
+    }
+  }
+
+  template <typename SortedNode, typename ChildVisitor>
+  static void ForEachSortedChild(const SortedNode *const node, ChildVisitor visitor) {
+    const uint16_t num_children = std::min(node->num_children_, SortedNode::CAPACITY);
+    for (uint16_t i = 0; i < num_children; i++) visitor(node->keys_[i], node->children_[i]);
+  }
+
+  static bool IsFull(const Node *const node) {
+    switch (node->type_) {
+      case NodeType::NODE4:
+        return node->num_children_ == Node4::CAPACITY;
+      case NodeType::NODE16:
+        return node->num_children_ == Node16::CAPACITY;
+      case NodeType::NODE48:
+        return node->num_children_ == Node48::CAPACITY;
+      default:
+        return false;
+    }
+  }
+
+  /**
+   * @return true if removing a child leaves the node with few enough children to be replaced by the next smaller type.
+   * For a Node4, the last child then replaces the node itself. The gap to the capacity of the smaller type keeps nodes
+   * from going back and forth between two types.
+   */
+  static bool ShrinksOnRemove(const Node *const node) {
+    switch (node->type_) {
+      case NodeType::NODE4:
+        return node->num_children_ <= 2;
+      case NodeType::NODE16:
+        return node->num_children_ <= Node4::CAPACITY;
+      case NodeType::NODE48:
+        return node->num_children_ <= Node16::CAPACITY - 3;
+      default:
+        return node->num_children_ <= Node48::CAPACITY - 10;
+    }
+  }
+
+  static void AddChild(Node *const node, const uint8_t key_byte, const Child child) {
+    NOISEPAGE_ASSERT(!IsFull(node), "Node must have room for another child.");
+    switch (node->type_) {
+      case NodeType::NODE4:
+        AddSortedChild(static_cast<Node4 *>(node), key_byte, child);
+        break;
+      case NodeType::NODE16:
+        AddSortedChild(static_cast<Node16 *>(node), key_byte, child);
+        break;
+      case NodeType::NODE48: {
+        auto *const node48 = static_cast<Node48 *>(node);
+        uint8_t index = 0;
+        while (node48->children_[index] != 0) index++;
+        node48->children_[index] = child;
+        node48->child_index_[key_byte] = index;
+        node48->num_children_++;
+        break;
+      }
+      default:
+        static_cast<Node256 *>(node)->children_[key_byte] = child;
+        node->num_children_++;
+        break;
+    }
+  }
+
+  template <typename SortedNode>
+  static void AddSortedChild(SortedNode *const node, const uint8_t key_byte, const Child child) {
+    uint16_t position = 0;
+    while (position < node->num_children_ && node->keys_[position] < key_byte) position++;
+    for (uint16_t i = node->num_children_; i > position; i--) {
+      node->keys_[i] = node->keys_[i - 1];
+      node->children_[i] = node->children_[i - 1];
+    }
+    node->keys_[position] = key_byte;
+    node->children_[position] = child;
+    node->num_children_++;
+  }
+
+  static void ReplaceChild(Node *const node, const uint8_t key_byte, const Child child) {
+    switch (node->type_) {
+      case NodeType::NODE4:
+        ReplaceSortedChild(static_cast<Node4 *>(node), key_byte, child);
+        break;
+      case NodeType::NODE16:
+        ReplaceSortedChild(static_cast<Node16 *>(node), key_byte, child);
+        break;
+      case NodeType::NODE48: {
+        auto *const node48 = static_cast<Node48 *>(node);
+        node48->children_[node48->child_index_[key_byte]] = child;
+        break;
+      }
+      default:
+        static_cast<Node256 *>(node)->children_[key_byte] = child;
+        break;
+    }
+  }
+
+  template <typename SortedNode>
+  static void ReplaceSortedChild(SortedNode *const node, const uint8_t key_byte, const Child child) {
+    for (uint16_t i = 0; i < node->num_children_; i++) {
+      if (node->keys_[i] == key_byte) {
+        node->children_[i] = child;
+        return;
+      }
+    }
+    NOISEPAGE_ASSERT(false, "Child to replace must exist.");
+  }
+
+  static void RemoveChild(Node *const node, const uint8_t key_byte) {
+    switch (node->type_) {
+      case NodeType::NODE4:
+        RemoveSortedChild(static_cast<Node4 *>(node), key_byte);
+        break;
+      case NodeType::NODE16:
+        RemoveSortedChild(static_cast<Node16 *>(node), key_byte);
+        break;
+      case NodeType::NODE48: {
+        auto *const node48 = static_cast<Node48 *>(node);
+        node48->children_[node48->child_index_[key_byte]] = 0;
+        node48->child_index_[key_byte] = Node48::EMPTY;
+        node48->num_children_--;
+        break;
+      }
+      default:
+        static_cast<Node256 *>(node)->children_[key_byte] = 0;
+        node->num_children_--;
+        break;
+    }
+  }
+
+  template <typename SortedNode>
+  static void RemoveSortedChild(SortedNode *const node, const uint8_t key_byte) {
+    uint16_t position = 0;
+    while (node->keys_[position] != key_byte) position++;
+    NOISEPAGE_ASSERT(position < node->num_children_, "Child to remove must exist.");
+    // Shrink first, so that readers never see the duplicate that shifting leaves at the end.
+    node->num_children_--;
+    for (uint16_t i = position; i < node->num_children_; i++) {
+      node->keys_[i] = node->keys_[i + 1];
+      node->children_[i] = node->children_[i + 1];
+    }
+  }
+
+  /**
+   * @return a new node of the given type with the given prefix and the children of the node, except for the child with
+   * the given key byte if skip_key_byte is set
+   */
+  Node *CopyNode(const Node *const node, const NodeType type, const uint8_t *const prefix, const uint32_t prefix_length,
+                 const bool skip_key_byte, const uint8_t key_byte) {
+    Node *const copy = NewNode(type, prefix, prefix_length);
+    ForEachChild(node, [&](const uint8_t child_key_byte, const Child child) {
+      if (!skip_key_byte || child_key_byte != key_byte) AddChild(copy, child_key_byte, child);
+    });
+    return copy;
+  }
+
+  static NodeType LargerType(const NodeType type) {
+    return type == NodeType::NODE4 ? NodeType::NODE16 : type == NodeType::NODE16 ? NodeType::NODE48 : NodeType::NODE256;
+  }
+
+  static NodeType SmallerType(const NodeType type) {
+    return type == NodeType::NODE256 ? NodeType::NODE48 : type == NodeType::NODE48 ? NodeType::NODE16 : NodeType::NODE4;
+  }
+
+  // ---------------------------------------------------------------------------------------------------------------
+  // Operations. Every attempt returns RESTART as soon as it observes a version change, before it acts on anything it
+  // read since.
+  // ---------------------------------------------------------------------------------------------------------------
+
+  Outcome TryFind(const EncodedKey &key, std::vector<ValueType> *const values) {
+    Probe probe;
+    StartProbe(key, &probe);
+    Outcome outcome;
+    while ((outcome = StepProbe(&probe, values)) == Outcome::PENDING) {
+    }
+    return outcome;
+  }
+
+  void StartProbe(const EncodedKey &key, Probe *const probe) const {
+    probe->key_ = &key;
+    probe->node_ = root_;
+    probe->version_ = root_->latch_.ReadVersion();
+    probe->next_ = 0;
+    probe->depth_ = 0;
+  }
+
+  /**
+   * Moves a lookup to the child it found in the previous step, and searches that child for the next one, which is
+   * prefetched. A step reads the child's memory only after the previous step prefetched it.
+   * @return PENDING if the lookup needs another step, and the outcome of the lookup otherwise
+   */
+  Outcome StepProbe(Probe *const probe, std::vector<ValueType> *const values) const {
+    const EncodedKey &key = *probe->key_;
+    if (probe->next_ != 0) {
+      if (IsLeaf(probe->next_)) {
+        const Leaf *const leaf = AsLeaf(probe->next_);
+        if (!LeafMatches(leaf, key)) return Outcome::FAILURE;
+        // Value lists are never modified once published, and retired lists outlive the guard of this reader.
+        const ValueList *const leaf_values = leaf->values_.load();
+        values->insert(values->end(), leaf_values->cbegin(), leaf_values->cend());
+        return Outcome::SUCCESS;
+      }
+
+      const Node *const next = AsNode(probe->next_);
+      const uint64_t next_version = next->latch_.ReadVersion();
+      if (!probe->node_->latch_.Validate(probe->version_)) return Outcome::RESTART;
+      probe->node_ = next;
+      probe->version_ = next_version;
+      probe->depth_++;
+    }
+
+    const Node *const node = probe->node_;
+    const uint32_t prefix_length = PrefixLength(node);
+    if (probe->depth_ + prefix_length >= key.length_ ||
+        std::memcmp(Prefix(node), key.bytes_.data() + probe->depth_, prefix_length) != 0) {
+      return node->latch_.Validate(probe->version_) ? Outcome::FAILURE : Outcome::RESTART;
+    }
+    probe->depth_ += prefix_length;
+
+    const Child child = FindChild(node, key.bytes_[probe->depth_]);
+    if (!node->latch_.Validate(probe->version_)) return Outcome::RESTART;
+    if (child == 0) return Outcome::FAILURE;
+    probe->next_ = child;
+    if (IsLeaf(child)) {
+      __builtin_prefetch(AsLeaf(child));
+    } else {
+      __builtin_prefetch(AsNode(child));
+    }
+    return Outcome::PENDING;
+  }
+
+  Outcome TryInsert(const KeyType &key, const EncodedKey &encoded, const ValueType &value,
+                    const std::function<bool(const ValueType)> &predicate) {
+    Node *parent = nullptr;
+    uint64_t parent_version = 0;
+    uint8_t parent_key_byte = 0;
+    Node *node = root_;
+    uint64_t version = node->latch_.ReadVersion();
+    uint32_t depth = 0;
+
+    while (true) {
+      const uint32_t prefix_length = PrefixLength(node);
+      const uint8_t *const prefix = Prefix(node);
+      uint32_t matched = 0;
+      while (matched < prefix_length && depth + matched < encoded.length_ &&
+             prefix[matched] == encoded.bytes_[depth + matched]) {
+        matched++;
+      }
+
+      if (matched < prefix_length) {
+        // The key leaves the prefix of the node, so a new node branches off between the parent and the node. The root
+        // has no prefix, so there always is a parent here.
+        if (depth + matched >= encoded.length_) return Outcome::RESTART;  // only possible with a stale prefix
+        NOISEPAGE_ASSERT(parent != nullptr, "The root has no prefix.");
+        if (!parent->latch_.UpgradeToExclusive(parent_version)) return Outcome::RESTART;
+        if (!node->latch_.UpgradeToExclusive(version)) {
+          parent->latch_.UnlockExclusive();
+          return Outcome::RESTART;
+        }
+        Node *const branch = NewNode(NodeType::NODE4, prefix, matched);
+        AddChild(branch, encoded.bytes_[depth + matched], LeafChild(NewLeaf(key, encoded, value)));
+        AddChild(branch, prefix[matched], NodeChild(node));
+        // The node keeps what follows the byte that it now hangs off.
+        node->prefix_length_ = prefix_length - matched - 1;
+        std::memmove(Prefix(node), prefix + matched + 1, node->prefix_length_);
+        ReplaceChild(parent, parent_key_byte, NodeChild(branch));
+        node->latch_.UnlockExclusive();
+        parent->latch_.UnlockExclusive();
+        num_keys_++;
+        return Outcome::SUCCESS;
+      }
+
+      depth += prefix_length;
+      if (depth >= encoded.length_) return node->latch_.Validate(version) ? Outcome::FAILURE : Outcome::RESTART;
+      const uint8_t key_byte = encoded.bytes_[depth];
+      const Child child = FindChild(node, key_byte);
+      if (!node->latch_.Validate(version)) return Outcome::RESTART;
+
+      if (child == 0) {
+        if (IsFull(node)) {
+          // Replace the node by a larger one, which needs the parent. The root never is full.
+          NOISEPAGE_ASSERT(parent != nullptr, "The root never is full.");
+          if (!parent->latch_.UpgradeToExclusive(parent_version)) return Outcome::RESTART;
+          if (!node->latch_.UpgradeToExclusive(version)) {
+            parent->latch_.UnlockExclusive();
+            return Outcome::RESTART;
+          }
+          Node *const larger = CopyNode(node, LargerType(node->type_), prefix, prefix_length, false, 0);
+          AddChild(larger, key_byte, LeafChild(NewLeaf(key, encoded, value)));
+          ReplaceChild(parent, parent_key_byte, NodeChild(larger));
+          node->latch_.UnlockExclusive();
+          parent->latch_.UnlockExclusive();
+          RetireNode(node);
+        } else {
+          if (!node->latch_.UpgradeToExclusive(version)) return Outcome::RESTART;
+          AddChild(node, key_byte, LeafChild(NewLeaf(key, encoded, value)));
+          node->latch_.UnlockExclusive();
+        }
+        num_keys_++;
+        return Outcome::SUCCESS;
+      }
+
+      if (IsLeaf(child)) {
+        Leaf *const leaf = AsLeaf(child);
+        if (LeafMatches(leaf, encoded)) {
+          // The values of the key only change under the latch of this node.
+          if (!node->latch_.UpgradeToExclusive(version)) return Outcome::RESTART;
+          const ValueList *const values = leaf->values_.load();
+          for (const auto &existing : *values) {
+            if (value_equal_(existing, value) || predicate(existing)) {
+              node->latch_.UnlockExclusive();
+              return Outcome::FAILURE;
+            }
+          }
+          ValueList new_values;
+          new_values.reserve(values->size() + 1);
+          new_values.insert(new_values.end(), values->cbegin(), values->cend());
+          new_values.push_back(value);
+          leaf->values_.store(NewValueList(std::move(new_values)));
+          node->latch_.UnlockExclusive();
+          RetireValueList(values);
+          return Outcome::SUCCESS;
+        }
+
+        // Another key ends here, so a new node takes the place of the leaf, with the bytes that both keys share after
+        // this level as its prefix. Keys are not prefixes of each other, so they differ before either one ends.
+        if (!node->latch_.UpgradeToExclusive(version)) return Outcome::RESTART;
+        const uint8_t *const leaf_bytes = leaf->Bytes();
+        const uint32_t max_shared = std::min(leaf->length_, encoded.length_) - depth - 1;
+        uint32_t shared = 0;
+        while (shared < max_shared && leaf_bytes[depth + 1 + shared] == encoded.bytes_[depth + 1 + shared]) shared++;
+        NOISEPAGE_ASSERT(shared < max_shared, "Binary-comparable keys must not be prefixes of each other.");
+        Node *const branch = NewNode(NodeType::NODE4, encoded.bytes_.data() + depth + 1, shared);
+        AddChild(branch, leaf_bytes[depth + 1 + shared], child);
+        AddChild(branch, encoded.bytes_[depth + 1 + shared], LeafChild(NewLeaf(key, encoded, value)));
+        ReplaceChild(node, key_byte, NodeChild(branch));
+        node->latch_.UnlockExclusive();
+        num_keys_++;
+        return Outcome::SUCCESS;
+      }
+
+      Node *const next = AsNode(child);
+      const uint64_t next_version = next->latch_.ReadVersion();
+      if (!node->latch_.Validate(version)) return Outcome::RESTART;
+      parent = node;
+      parent_version = version;
+      parent_key_byte = key_byte;
+      node = next;
+      version = next_version;
+      depth++;
+    }
+  }
+
+  Outcome TryDelete(const EncodedKey &encoded, const ValueType &value) {
+    Node *parent = nullptr;
+    uint64_t parent_version = 0;
+    uint8_t parent_key_byte = 0;
+    Node *node = root_;
+    uint64_t version = node->latch_.ReadVersion();
+    uint32_t depth = 0;
+
+    while (true) {
+      const uint32_t prefix_length = PrefixLength(node);
+      if (depth + prefix_length >= encoded.length_ ||
+          std::memcmp(Prefix(node), encoded.bytes_.data() + depth, prefix_length) != 0) {
+        return node->latch_.Validate(version) ? Outcome::FAILURE : Outcome::RESTART;
+      }
+      depth += prefix_length;
+
+      const uint8_t key_byte = encoded.bytes_[depth];
+      const Child child = FindChild(node, key_byte);
+      if (!node->latch_.Validate(version)) return Outcome::RESTART;
+      if (child == 0) return Outcome::FAILURE;
+
+      if (IsLeaf(child)) {
+        Leaf *const leaf = AsLeaf(child);
+        if (!LeafMatches(leaf, encoded)) return Outcome::FAILURE;
+        // If the node does not change before it is latched, neither does this list.
+        const ValueList *const values = leaf->values_.load();
+        const auto found = std::find_if(values->cbegin(), values->cend(),
+                                        [&](const ValueType &existing) { return value_equal_(existing, value); });
+        if (found == values->cend()) return node->latch_.Validate(version) ? Outcome::FAILURE : Outcome::RESTART;
+
+        if (values->size() > 1) {
+          if (!node->latch_.UpgradeToExclusive(version)) return Outcome::RESTART;
+          ValueList new_values;
+          new_values.reserve(values->size() - 1);
+          new_values.insert(new_values.end(), values->cbegin(), found);
+          new_values.insert(new_values.end(), found + 1, values->cend());
+          leaf->values_.store(NewValueList(std::move(new_values)));
+          node->latch_.UnlockExclusive();
+          RetireValueList(values);
+          return Outcome::SUCCESS;
+        }
+
+        // The last value goes, and the leaf with it.
+        if (parent == nullptr || !ShrinksOnRemove(node)) {
+          if (!node->latch_.UpgradeToExclusive(version)) return Outcome::RESTART;
+          RemoveChild(node, key_byte);
+          node->latch_.UnlockExclusive();
+        } else {
+          if (!parent->latch_.UpgradeToExclusive(parent_version)) return Outcome::RESTART;
+          if (!node->latch_.UpgradeToExclusive(version)) {
+            parent->latch_.UnlockExclusive();
+            return Outcome::RESTART;
+          }
+          if (node->type_ == NodeType::NODE4) {
+            CollapseNode4(parent, parent_key_byte, node, key_byte);
+          } else {
+            Node *const smaller =
+                CopyNode(node, SmallerType(node->type_), Prefix(node), node->prefix_length_, true, key_byte);
+            ReplaceChild(parent, parent_key_byte, NodeChild(smaller));
+          }
+          node->latch_.UnlockExclusive();
+          parent->latch_.UnlockExclusive();
+          RetireNode(node);
+        }
+        RetireLeaf(leaf);
+        num_keys_--;
+        return Outcome::SUCCESS;
+      }
+
+      Node *const next = AsNode(child);
+      const uint64_t next_version = next->latch_.ReadVersion();
+      if (!node->latch_.Validate(version)) return Outcome::RESTART;
+      parent = node;
+      parent_version = version;
+      parent_key_byte = key_byte;
+      node = next;
+      version = next_version;
+      depth++;
+    }
+  }
+
+  /**
+   * Replace a Node4 that is about to lose its second to last child by its last child. An inner node takes over the
+   * prefix of the Node4 and the byte that it hung off, which needs a copy since prefixes only ever shrink in place.
+   * Both the parent and the Node4 must be latched exclusively.
+   */
+  void CollapseNode4(Node *const parent, const uint8_t parent_key_byte, Node *const node,
+                     const uint8_t removed_key_byte) {
+    Child last_child = 0;
+    uint8_t last_key_byte = 0;
+    ForEachChild(node, [&](const uint8_t key_byte, const Child child) {
+      if (key_byte != removed_key_byte) {
+        last_key_byte = key_byte;
+        last_child = child;
+      }
+    });
+    NOISEPAGE_ASSERT(last_child != 0, "A Node4 always has at least two children.");
+
+    if (IsLeaf(last_child)) {
+      // Leaves hold their full key, so they can move up as they are.
+      ReplaceChild(parent, parent_key_byte, last_child);
+      return;
+    }
+
+    Node *const last_node = AsNode(last_child);
+    last_node->latch_.LockExclusive();
+    std::vector<uint8_t> prefix(Prefix(node), Prefix(node) + node->prefix_length_);
+    prefix.push_back(last_key_byte);
+    prefix.insert(prefix.end(), Prefix(last_node), Prefix(last_node) + last_node->prefix_length_);
+    Node *const merged = CopyNode(last_node, last_node->type_, prefix.data(), static_cast<uint32_t>(prefix.size()),
+                                  false, 0);
+    ReplaceChild(parent, parent_key_byte, NodeChild(merged));
+    last_node->latch_.UnlockExclusive();
+    RetireNode(last_node);
+  }
+
+  /**
+   * Visit the keys below a node in scan order, starting at the bound of the scan if the subtree is bounded.
+   * @return FAILURE if the visitor ended the scan, RESTART if a writer got in the way, SUCCESS otherwise
+   */
+  template <typename Visitor>
+  Outcome ScanNode(const Node *const node, const uint64_t version, uint32_t depth, bool bounded,
+                   ScanState *const state, Visitor *const visitor) {
+    const EncodedKey &bound = state->bound_;
+    const uint32_t prefix_length = PrefixLength(node);
+    if (bounded) {
+      const uint32_t comparable = std::min(prefix_length, bound.length_ > depth ? bound.length_ - depth : 0);
+      int compared = std::memcmp(Prefix(node), bound.bytes_.data() + depth, comparable);
+      if (compared == 0 && comparable < prefix_length) compared = 1;
+      if (!node->latch_.Validate(version)) return Outcome::RESTART;
+      if (compared != 0) {
+        // The whole subtree is on one side of the bound.
+        if (state->ascending_ ? compared < 0 : compared > 0) return Outcome::SUCCESS;
+        bounded = false;
+      }
+    }
+    depth += prefix_length;
+    if (depth >= bound.length_) bounded = false;
+
+    // Take a snapshot of the children, so that the node can change while its subtrees are visited.
+    auto &children = state->children_;
+    const size_t begin = children.size();
+    ForEachChild(node, [&](const uint8_t key_byte, const Child child) { children.emplace_back(key_byte, child); });
+    const size_t end = children.size();
+    if (!node->latch_.Validate(version)) {
+      children.resize(begin);
+      return Outcome::RESTART;
+    }
+
+    Outcome outcome = Outcome::SUCCESS;
+    const uint8_t bound_byte = bounded ? bound.bytes_[depth] : 0;
+    for (size_t i = 0; i < end - begin && outcome == Outcome::SUCCESS; i++) {
+      const auto [key_byte, child] = children[state->ascending_ ? begin + i : end - 1 - i];
+      bool child_bounded = false;
+      if (bounded) {
+        if (state->ascending_ ? key_byte < bound_byte : key_byte > bound_byte) continue;
+        child_bounded = key_byte == bound_byte;
+      }
+
+      if (IsLeaf(child)) {
+        outcome = VisitLeaf(AsLeaf(child), child_bounded, state, visitor);
+      } else {
+        const Node *const next = AsNode(child);
+        const uint64_t next_version = next->latch_.ReadVersion();
+        outcome = node->latch_.Validate(version)
+                      ? ScanNode(next, next_version, depth + 1, child_bounded, state, visitor)
+                      : Outcome::RESTART;
+      }
+    }
+    children.resize(begin);
+    return outcome;
+  }
+
+  template <typename Visitor>
+  Outcome VisitLeaf(const Leaf *const leaf, const bool bounded, ScanState *const state, Visitor *const visitor) {
+    if (bounded) {
+      const int compared =
+          CompareBytes(leaf->Bytes(), leaf->length_, state->bound_.bytes_.data(), state->bound_.length_);
+      if (state->ascending_ ? compared < 0 : compared > 0) return Outcome::SUCCESS;
+      if (compared == 0 && !state->inclusive_) return Outcome::SUCCESS;
+    }
+    const ValueList *const values = leaf->values_.load();
+    // A restart continues after this key.
+    state->bounded_ = true;
+    state->inclusive_ = false;
+    state->bound_.Assign(leaf->Bytes(), leaf->length_);
+    return (*visitor)(leaf->key_, *values) ? Outcome::SUCCESS : Outcome::FAILURE;
+  }
+
+  Node256 *root_;  // never replaced, and has no prefix
+  std::atomic<uint64_t> num_keys_ = 0;
+  std::atomic<size_t> heap_usage_ = 0;
+  const ValueEqualityChecker value_equal_{};
+  EpochManager epoch_manager_;
+};
+
+}  // namespace noisepage::storage::index
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "common/managed_pointer.h"
+#include "storage/index/index.h"
+#include "storage/index/index_defs.h"
+
+namespace noisepage::storage::index {
+template <typename KeyType, typename ValueType, typename ValueEqualityChecker>
+class AdaptiveRadixTree;
+template <uint8_t KeySize>
+class CompactIntsKey;
+template <uint16_t KeySize>
+class GenericKey;
+
+/**
+ * Wrapper around the Adaptive Radix Tree.
+ * @tparam KeyType the type of keys stored in the tree, which must provide a binary-comparable encoding
+ */
+template <typename KeyType>
+class ARTIndex final : public Index {
+  friend class IndexBuilder;
+
+ private:
+  explicit ARTIndex(IndexMetadata &&metadata);
+
+  // NOLINTNEXTLINE transparent functors can't figure out template
+  const std::unique_ptr<AdaptiveRadixTree<KeyType, TupleSlot, std::equal_to<TupleSlot>>> art_;
+
+ public:
+  /**
+   * @return type of the index. Note that this is the physical type, not extracted from the underlying schema or other
+   * catalog metadata. This is mostly used for debugging purposes.
+   */
+  IndexType Type() const final { return IndexType::ART; }
+
+  /**
+   * Invoke garbage collection on the index, which frees the nodes, leaves and value lists that readers no longer see.
+   */
+  void PerformGarbageCollection() final;
+
+  /**
+   * @return approximate number of bytes allocated on the heap for this index data structure
+   */
+  size_t EstimateHeapUsage() const final;
+
+  /**
+   * Inserts a new key-value pair into the index, used for non-unique key indexes.
+   * @param txn txn context for the calling txn, used to register abort actions
+   * @param tuple key
+   * @param location value
+   * @return false if the value already exists, true otherwise
+   */
+  bool Insert(common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &tuple,
+              TupleSlot location) final;
+
+  /**
+   * Inserts a key-value pair only if any matching keys have TupleSlots that don't conflict with the calling txn
+   * @param txn txn context for the calling txn, used for visibility and write-write, and to register abort actions
+   * @param tuple key
+   * @param location value
+   * @return true if the value was inserted, false otherwise
+   *         (either because value exists, or predicate returns true for one of the existing values)
+   */
+  bool InsertUnique(common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &tuple,
+                    TupleSlot location) final;
+
+  /**
+   * Doesn't immediately call delete on the index. Registers a commit action in the txn that will eventually register a
+   * deferred action for the GC to safely call delete on the index when no more transactions need to access the key.
+   * @param txn txn context for the calling txn, used to register commit actions for deferred GC actions
+   * @param tuple key
+   * @param location value
+   */
+  void Delete(common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &tuple,
+              TupleSlot location) final;
+
+  /**
+   * Finds all the values associated with the given key in our index.
+   * @param txn txn context for the calling txn, used for visibility checks
+   * @param key the key to look for
+   * @param[out] value_list the values associated with the key
+   */
+  void ScanKey(const transaction::TransactionContext &txn, const ProjectedRow &key,
+               std::vector<TupleSlot> *value_list) final;
+
+  /**
+   * Finds all the values associated with each of the given keys, interleaving the lookups of the keys.
+   * @param txn txn context for the calling txn, used for visibility checks
+   * @param keys the keys to look for
+   * @param[out] value_lists the values associated with each key, in the order of the keys
+   */
+  void ScanKeyBatch(const transaction::TransactionContext &txn, const std::vector<const ProjectedRow *> &keys,
+                    std::vector<std::vector<TupleSlot>> *value_lists) final;
+
+  /**
+   * Finds all the values between the given keys in our index, sorted in ascending order.
+   * @param txn txn context for the calling txn, used for visibility checks
+   * @param scan_type Scan Type
+   * @param num_attrs Number of attributes to compare
+   * @param low_key the key to start at
+   * @param high_key the key to end at
+   * @param limit if any
+   * @param[out] value_list the values associated with the keys
+   */
+  void ScanAscending(const transaction::TransactionContext &txn, ScanType scan_type, uint32_t num_attrs,
+                     ProjectedRow *low_key, ProjectedRow *high_key, uint32_t limit,
+                     std::vector<TupleSlot> *value_list) final;
+
+  /**
+   * Finds all the values between the given keys in our index, sorted in ascending order, along with their keys.
+   * @param txn txn context for the calling txn, used for visibility checks
+   * @param scan_type Scan Type
+   * @param num_attrs Number of attributes to compare
+   * @param low_key the key to start at
+   * @param high_key the key to end at
+   * @param limit if any
+   * @param[out] value_list the values associated with the keys
+   * @param[out] key_list the keys of the values, or nullptr
+   */
+  void ScanAscendingWithKeys(const transaction::TransactionContext &txn, ScanType scan_type, uint32_t num_attrs,
+                             ProjectedRow *low_key, ProjectedRow *high_key, uint32_t limit,
+                             std::vector<TupleSlot> *value_list, std::vector<byte> *key_list) final;
+
+  /** @return size of the KeyType, which ScanAscendingWithKeys() copies into the key_list */
+  uint16_t KeyListEntrySize() const final { return sizeof(KeyType); }
+
+  /**
+   * Writes the attributes of a key returned by ScanAscendingWithKeys() into a ProjectedRow.
+   * @param key pointer to the entry of the key in the key_list
+   * @param[out] to ProjectedRow initialized from GetProjectedRowInitializer()
+   * @param varlen_buffer buffer of KeyListEntrySize() bytes for varlens that can't be inlined
+   */
+  void KeyToProjectedRow(const byte *key, ProjectedRow *to, byte *varlen_buffer) const final;
+
+  /**
+   * Finds all the values between the given keys in our index, sorted in descending order.
+   * @param txn txn context for the calling txn, used for visibility checks
+   * @param low_key the key to end at
+   * @param high_key the key to start at
+   * @param[out] value_list the values associated with the keys
+   */
+  void ScanDescending(const transaction::TransactionContext &txn, const ProjectedRow &low_key,
+                      const ProjectedRow &high_key, std::vector<TupleSlot> *value_list) final;
+
+  /**
+   * Finds the first limit # of values between the given keys in our index, sorted in descending order.
+   * @param txn txn context for the calling txn, used for visibility checks
+   * @param low_key the key to end at
+   * @param high_key the key to start at
+   * @param[out] value_list the values associated with the keys
+   * @param limit upper bound of number of values to return
+   */
+  void ScanLimitDescending(const transaction::TransactionContext &txn, const ProjectedRow &low_key,
+                           const ProjectedRow &high_key, std::vector<TupleSlot> *value_list, uint32_t limit) final;
+
+  /** @return The number of keys in the index. */
+  uint64_t GetSize() const final;
+};
+
+extern template class ARTIndex<CompactIntsKey<8>>;
+extern template class ARTIndex<CompactIntsKey<16>>;
+extern template class ARTIndex<CompactIntsKey<24>>;
+extern template class ARTIndex<CompactIntsKey<32>>;
+
+extern template class ARTIndex<GenericKey<64>>;
+extern template class ARTIndex<GenericKey<128>>;
+extern template class ARTIndex<GenericKey<256>>;
+extern template class ARTIndex<GenericKey<512>>;
+
+}  // namespace noisepage::storage::index
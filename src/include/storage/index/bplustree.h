@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstring>
 #include <functional>
 #include <iostream>
@@ -10,8 +13,9 @@
 #include <utility>
 #include <vector>
 
-#include "common/shared_latch.h"
+#include "common/optimistic_latch.h"
 #include "loggers/index_logger.h"
+#include "storage/index/epoch_manager.h"
 #include "storage/index/index.h"
 #include "storage/index/index_defs.h"
 
@@ -93,7 +97,7 @@ class BPlusTreeBase {
 };
 
 /**
- * Implementation of a B+ Tree index using latch crabbing.
+ * Implementation of a B+ Tree index using optimistic lock coupling for reads and latch crabbing for writes.
  *
  * Concurrency:
  *  Each node (leaf and inner) contains one shared latch to gain access to the node.
@@ -105,15 +109,22 @@ class BPlusTreeBase {
  *  top to bottom. Thus, before accessing a child node pointer, it is ensured that the pointer cannot be
  *  deleted no matter what (the parent latch is also being held at that point).
  *
- * Optimistic latch crabbing is used to acquire node latches for reads and writes.
+ * Every latch also carries a version that is bumped whenever the latch is acquired or released exclusively. This lets
+ * lookups and scans read nodes without writing to them (optimistic lock coupling).
  *  Read:
- *    Acquire latches starting from root, in the path to find the key. Release shared latch of parent
- *    once the latch on current node is obtained and so on...
+ *    Read the version of the root, then of every node in the path to find the key. A child is only visited after the
+ *    version of its parent was validated again, and the result is only used once the version of the leaf node was
+ *    validated. If a version changed in between, the read restarts from the root. Scans copy the elements out of one
+ *    leaf node at a time, validate it, and move on to its sibling. Since readers hold no latches, nodes and value lists
+ *    are never freed while a reader might see them: they are retired to an epoch manager instead. For the same reason,
+ *    value lists are never modified in place, but replaced by a modified copy.
+ *    Iterators are the exception: they crab shared latches down to the leaf node, and keep it latched while in use.
  *
  *  Write:
  *    Happens in 2 phases:
- *    1) Shared latches acquired throughout the path expect in leaf node (exclusive lock needed here). If the leaf node
- *    is safe for insertion/deletion (no overflow/underflow), perform the operation else move to step 2.
+ *    1) The leaf node is found the same way as in a read, and latched exclusively if its version did not change in the
+ *    meantime. If the leaf node is safe for insertion/deletion (no overflow/underflow), perform the operation else
+ *    move to step 2.
  *
  *    2) Exclusive latches are acquired from root to the corresponding leaf. A queue of locks acquired is maintained.
  *    If the current node is safe (no overflow/underflow), release all parent locks are released.
@@ -217,8 +228,8 @@ class BPlusTree : public BPlusTreeBase {
     /** This counts the total number of items in the node */
     int item_count_;
 
-    /** Latch for each node */
-    common::SharedLatch node_latch_;
+    /** Latch for each node, whose version is read by optimistic readers */
+    common::OptimisticLatch node_latch_;
 
     /**
      * Constructor
@@ -329,7 +340,22 @@ class BPlusTree : public BPlusTreeBase {
     /**
      * GetLatchPointer() - Get the Latch Pointer of current node's latch
      */
-    common::SharedLatch *GetLatchPointer() { return &(metadata_.node_latch_); }
+    common::OptimisticLatch *GetLatchPointer() { return &(metadata_.node_latch_); }
+
+    /**
+     * ReadNodeVersion() - Start an optimistic read of the current node, waits while the node is latched exclusively
+     */
+    uint64_t ReadNodeVersion() const { return metadata_.node_latch_.ReadVersion(); }
+
+    /**
+     * ValidateNodeVersion() - Returns true if the node was not latched exclusively since the version was read
+     */
+    bool ValidateNodeVersion(const uint64_t version) const { return metadata_.node_latch_.Validate(version); }
+
+    /**
+     * UpgradeNodeLatch() - Obtain the exclusive lock if the node did not change since the version was read
+     */
+    bool UpgradeNodeLatch(const uint64_t version) { return metadata_.node_latch_.UpgradeToExclusive(version); }
 
     /**
      * TryExclusiveLock() - Try to get the exclusive lock
@@ -743,10 +769,22 @@ class BPlusTree : public BPlusTreeBase {
   const ValueEqualityChecker value_eq_obj_;
 
  private:
-  BaseNode *root_;
-  common::SharedLatch root_latch_;
+  /** Number of keys whose lookups FindValuesOfKeys() interleaves, i.e., the number of cache misses that overlap */
+  static constexpr uint32_t BATCH_LOOKUP_GROUP_SIZE = 16;
+
+  /** Outcome of an insert or delete that only modifies a single, latched leaf node */
+  enum class LeafUpdateResult : uint8_t {
+    SUCCESS,     // the leaf was modified
+    FAILURE,     // the pair is already present or was rejected by the predicate (insert), or is not present (delete)
+    RESTRUCTURE  // the leaf would have to be split or merged, which takes the pessimistic path
+  };
+
+  std::atomic<BaseNode *> root_;
+  common::OptimisticLatch root_latch_;
   std::atomic_uint64_t num_keys_;
   std::atomic_uint64_t num_values_;
+  /** Nodes and value lists that were unlinked while optimistic readers might still see them */
+  EpochManager epoch_manager_;
 
  public:
   /**
@@ -862,6 +900,193 @@ class BPlusTree : public BPlusTreeBase {
     return current_node;
   }
 
+  /**
+   * This function returns the leaf node that a descent from the root ends up in, without taking any latches. Every node
+   * is read between reading and validating its version, and a child is only visited after the version of its parent
+   * was validated again, so the descent notices if a writer changed the path in between. It restarts from the root in
+   * that case.
+   *
+   * NOTE: The caller must hold an epoch guard, which keeps the nodes in the path from being freed. The leaf node is
+   * not latched upon return, so anything that is read from it has to be validated against the returned version.
+   *
+   * @tparam ChildSelector callable that returns the child of an inner node to descend into
+   * @param select_child picks the child to descend into
+   * @param[out] version version of the leaf node
+   * @return Pointer to LeafNode if tree is not empty, nullptr otherwise
+   */
+  template <typename ChildSelector>
+  ElasticNode<KeyValuePair> *OptimisticFindLeafNode(ChildSelector select_child, uint64_t *const version) {
+    while (true) {
+      const uint64_t root_version = root_latch_.ReadVersion();
+      BaseNode *current_node = root_;
+      if (current_node == nullptr) {
+        if (root_latch_.Validate(root_version)) return nullptr;
+        continue;
+      }
+      uint64_t current_version = current_node->ReadNodeVersion();
+      if (!root_latch_.Validate(root_version)) continue;
+
+      // Traversing Down to the right leaf node
+      bool restart = false;
+      while (current_node->GetType() != NodeType::LeafType) {
+        BaseNode *child = select_child(reinterpret_cast<ElasticNode<KeyNodePointerPair> *>(current_node));
+        // The child pointer may be garbage if a writer modified the node concurrently.
+        if (!current_node->ValidateNodeVersion(current_version)) {
+          restart = true;
+          break;
+        }
+        const uint64_t child_version = child->ReadNodeVersion();
+        // The child's version only counts if the child was still linked from its parent when it was read.
+        if (!current_node->ValidateNodeVersion(current_version)) {
+          restart = true;
+          break;
+        }
+        current_node = child;
+        current_version = child_version;
+      }
+
+      if (!restart) {
+        *version = current_version;
+        return reinterpret_cast<ElasticNode<KeyValuePair> *>(current_node);
+      }
+    }
+  }
+
+  /**
+   * This function returns the leaf node that may contain a particular key, without taking any latches.
+   * See OptimisticFindLeafNode(ChildSelector, uint64_t *) for the protocol.
+   *
+   * @param key Key to be searched for.
+   * @param[out] version version of the leaf node
+   * @return Pointer to LeafNode if tree is not empty, nullptr otherwise
+   */
+  ElasticNode<KeyValuePair> *OptimisticFindLeafNode(const KeyType &key, uint64_t *const version) {
+    return OptimisticFindLeafNode(
+        [&](ElasticNode<KeyNodePointerPair> *node) -> BaseNode * {
+          // Note that Find Location returns the location of first element that compare greater than, thus we have to
+          // go in the left side of location which will be the pointer of the previous location.
+          auto index_pointer = static_cast<InnerNode *>(node)->FindLocation(key, this);
+          return index_pointer != node->Begin() ? (index_pointer - 1)->second : node->GetLowKeyPair().second;
+        },
+        version);
+  }
+
+  /**
+   * This function returns the first or last leaf node of the tree, without taking any latches.
+   * See OptimisticFindLeafNode(ChildSelector, uint64_t *) for the protocol.
+   *
+   * @param first whether to return the first (holding the smallest key) or the last (holding the largest key) leaf node
+   * @param[out] version version of the leaf node
+   * @return Pointer to LeafNode if tree is not empty, nullptr otherwise
+   */
+  ElasticNode<KeyValuePair> *OptimisticFindEdgeLeafNode(const bool first, uint64_t *const version) {
+    return OptimisticFindLeafNode(
+        [first](ElasticNode<KeyNodePointerPair> *node) -> BaseNode * {
+          return first || node->GetSize() == 0 ? node->GetLowKeyPair().second : node->RBegin()->second;
+        },
+        version);
+  }
+
+  /**
+   * Prefetches the elements of a node that a binary search over them reads first. The size of the node is read without
+   * validation, which is fine for a prefetch.
+   */
+  static void PrefetchSearchPath(BaseNode *const node) {
+    if (node->GetType() == NodeType::LeafType) {
+      PrefetchSearchPath(reinterpret_cast<ElasticNode<KeyValuePair> *>(node));
+    } else {
+      PrefetchSearchPath(reinterpret_cast<ElasticNode<KeyNodePointerPair> *>(node));
+    }
+  }
+
+  /**
+   * Prefetches the middle and the quartiles of the elements of a node.
+   */
+  template <typename ElementType>
+  static void PrefetchSearchPath(ElasticNode<ElementType> *const node) {
+    const ElementType *const begin = node->Begin();
+    const int64_t size = node->End() - begin;
+    __builtin_prefetch(begin + size / 2);
+    __builtin_prefetch(begin + size / 4);
+    __builtin_prefetch(begin + 3 * size / 4);
+  }
+
+  /**
+   * Returns the first element of a leaf node whose key compares greater than (or, if inclusive, equal to) the key.
+   */
+  KeyValuePair *LeafLowerBound(ElasticNode<KeyValuePair> *node, const KeyType &key, const bool inclusive) {
+    KeyValuePair *element_p = static_cast<LeafNode *>(node)->FindLocation(key, this);
+    if (inclusive && element_p != node->Begin() && KeyCmpEqual((element_p - 1)->first, key)) element_p--;
+    return element_p;
+  }
+
+  /**
+   * Visits the elements of the tree in key order without taking any latches. The elements of one leaf node at a time
+   * are copied out and validated against the version of the node before they are visited, and the scan moves on to
+   * the sibling of the node. If a writer modified the node in the meantime, the scan descends from the root again and
+   * resumes after the last key that it visited, so that no element is visited twice.
+   *
+   * @tparam Visitor callable with (const KeyType &, const ValueList &) that returns false to end the scan
+   * @param start_key key to start at (inclusive), or nullptr to start at the smallest (ascending) or largest
+   * (descending) key
+   * @param ascending whether to visit the keys in ascending or descending order
+   * @param visitor called for every key and its values
+   */
+  template <typename Visitor>
+  void OptimisticScan(const KeyType *const start_key, const bool ascending, Visitor visitor) {
+    EpochManager::Guard guard(&epoch_manager_);
+
+    // Where the scan (re)starts, and whether the key itself still has to be visited
+    const KeyType *resume_key = start_key;
+    bool inclusive = true;
+    KeyType last_key;
+
+    uint64_t version = 0;
+    const auto find_leaf = [&]() {
+      return resume_key == nullptr ? OptimisticFindEdgeLeafNode(ascending, &version)
+                                   : OptimisticFindLeafNode(*resume_key, &version);
+    };
+
+    std::vector<KeyValuePair> elements;
+    ElasticNode<KeyValuePair> *node = find_leaf();
+    while (node != nullptr) {
+      KeyValuePair *begin = node->Begin();
+      KeyValuePair *end = node->End();
+      if (resume_key != nullptr) {
+        if (ascending) {
+          begin = LeafLowerBound(node, *resume_key, inclusive);
+        } else {
+          end = LeafLowerBound(node, *resume_key, !inclusive);
+        }
+      }
+      elements.clear();
+      if (begin < end) elements.assign(begin, end);
+
+      // Leaf nodes link to their siblings through the pointers of their high and low keys.
+      BaseNode *sibling = ascending ? node->GetHighKeyPair().second : node->GetLowKeyPair().second;
+      uint64_t sibling_version = 0;
+      if (sibling != nullptr && node->ValidateNodeVersion(version)) sibling_version = sibling->ReadNodeVersion();
+      if (!node->ValidateNodeVersion(version)) {
+        node = find_leaf();
+        continue;
+      }
+
+      // The copied elements are consistent, and their value lists are never modified in place.
+      if (!ascending) std::reverse(elements.begin(), elements.end());
+      for (const auto &element : elements) {
+        if (!visitor(element.first, *element.second)) return;
+      }
+      if (!elements.empty()) {
+        last_key = elements.back().first;
+        resume_key = &last_key;
+        inclusive = false;
+      }
+
+      node = reinterpret_cast<ElasticNode<KeyValuePair> *>(sibling);
+      version = sibling_version;
+    }
+  }
+
   /**
    * This class implements a bi-directional iterator for the B+ Tree. In order to
    * fetch an element to start iteration, Begin() function can be used. Then, ++ or --
@@ -1302,68 +1527,171 @@ class BPlusTree : public BPlusTreeBase {
    * Returns false if not found
    */
   bool IsPresent(KeyType key) {
-    if (root_ == nullptr) {
-      return false;
-    }
-
-    BaseNode *current_node = root_;
-
-    // Traversing Down to the right leaf node
-    while (current_node->GetType() != NodeType::LeafType) {
-      auto node = reinterpret_cast<ElasticNode<KeyNodePointerPair> *>(current_node);
-      // Note that Find Location returns the location of first element
-      // that compare greater than
-      auto index_pointer = static_cast<InnerNode *>(node)->FindLocation(key, this);
-      // Thus we have to go in the left side of location which will be the
-      // pointer of the previous location.
-      if (index_pointer != node->Begin()) {
-        index_pointer -= 1;
-        current_node = index_pointer->second;
-      } else {
-        current_node = node->GetLowKeyPair().second;
+    EpochManager::Guard guard(&epoch_manager_);
+    while (true) {
+      uint64_t version;
+      auto node = OptimisticFindLeafNode(key, &version);
+      if (node == nullptr) {
+        return false;
       }
-    }
 
-    auto node = reinterpret_cast<ElasticNode<KeyValuePair> *>(current_node);
-    for (KeyValuePair *element_p = node->Begin(); element_p != node->End(); element_p++) {
-      if (KeyCmpEqual(element_p->first, key)) {
-        return true;
+      KeyValuePair *element_p = LeafLowerBound(node, key, true);
+      const bool found = element_p != node->End() && KeyCmpEqual(element_p->first, key);
+      if (node->ValidateNodeVersion(version)) {
+        return found;
       }
     }
-
-    return false;
   }
 
   /**
    * Tries to find key by Traversing down the BplusTree
    * Returns the list of values of the key from leaf if found in result vector
    * Returns null if not found
+   *
+   * NOTE: This function does not acquire any latches. See OptimisticFindLeafNode().
    */
   void FindValueOfKey(KeyType key, std::vector<ValueType> *result) {
-    // Fetch Leaf Node containing the key
-    auto current_node = FindLeafNode(key);
-    if (current_node == nullptr) {
-      // Empty tree
-      return;
-    }
+    EpochManager::Guard guard(&epoch_manager_);
+    while (true) {
+      // Fetch Leaf Node containing the key
+      uint64_t version;
+      auto node = OptimisticFindLeafNode(key, &version);
+      if (node == nullptr) {
+        // Empty tree
+        return;
+      }
 
-    auto node = reinterpret_cast<ElasticNode<KeyValuePair> *>(current_node);
-    for (KeyValuePair *element_p = node->Begin(); element_p != node->End(); element_p++) {
-      if (KeyCmpEqual(element_p->first, key)) {
-        auto itr_list = element_p->second->begin();
-        while (itr_list != element_p->second->end()) {
-          (*result).push_back(*itr_list);
-          itr_list++;
-        }
+      KeyValuePair *element_p = LeafLowerBound(node, key, true);
+      const ValueList *values = nullptr;
+      if (element_p != node->End() && KeyCmpEqual(element_p->first, key)) {
+        values = element_p->second;
+      }
 
-        // Release the Leaf shared latch
-        current_node->ReleaseNodeSharedLatch();
+      // The value list may only be read once the node is known to be unchanged, after which it stays untouched.
+      if (node->ValidateNodeVersion(version)) {
+        if (values != nullptr) {
+          result->insert(result->end(), values->begin(), values->end());
+        }
         return;
       }
     }
+  }
 
-    // Release the Leaf shared latch
-    current_node->ReleaseNodeSharedLatch();
+  /**
+   * Finds the values of a batch of keys, like FindValueOfKey() for every key. The descents of a group of keys are
+   * interleaved one level at a time: while the child of one key's node is being fetched, the nodes of the other keys
+   * are searched, so that the cache misses of the group overlap. Every descent follows the protocol of
+   * OptimisticFindLeafNode(), split in two halves per level. The first half searches the node and prefetches the child,
+   * and the second half reads the child's version and prefetches the elements that a binary search over it reads first.
+   * A key whose descent has to restart is looked up on its own with FindValueOfKey().
+   *
+   * NOTE: This function does not acquire any latches.
+   *
+   * @param keys keys to search for
+   * @param num_keys number of keys
+   * @param[out] results array of num_keys vectors, the values of every key are appended to the vector of the key
+   */
+  void FindValuesOfKeys(const KeyType *const keys, const uint32_t num_keys, std::vector<ValueType> *const results) {
+    EpochManager::Guard guard(&epoch_manager_);
+    for (uint32_t group_begin = 0; group_begin < num_keys; group_begin += BATCH_LOOKUP_GROUP_SIZE) {
+      const uint32_t group_size = std::min(BATCH_LOOKUP_GROUP_SIZE, num_keys - group_begin);
+      const KeyType *const group_keys = keys + group_begin;
+      std::vector<ValueType> *const group_results = results + group_begin;
+
+      std::array<BaseNode *, BATCH_LOOKUP_GROUP_SIZE> nodes;
+      std::array<uint64_t, BATCH_LOOKUP_GROUP_SIZE> versions;
+      std::array<BaseNode *, BATCH_LOOKUP_GROUP_SIZE> children;
+      std::array<uint32_t, BATCH_LOOKUP_GROUP_SIZE> active;  // keys of the group that are still descending
+      std::array<uint32_t, BATCH_LOOKUP_GROUP_SIZE> restarted;
+      uint32_t num_active = 0, num_restarted = 0;
+
+      const uint64_t root_version = root_latch_.ReadVersion();
+      BaseNode *const root = root_;
+      if (root == nullptr) {
+        if (root_latch_.Validate(root_version)) return;  // Empty tree
+        for (uint32_t i = 0; i < group_size; i++) FindValueOfKey(group_keys[i], &group_results[i]);
+        continue;
+      }
+      const uint64_t version = root->ReadNodeVersion();
+      if (!root_latch_.Validate(root_version)) {
+        for (uint32_t i = 0; i < group_size; i++) FindValueOfKey(group_keys[i], &group_results[i]);
+        continue;
+      }
+      for (uint32_t i = 0; i < group_size; i++) {
+        nodes[i] = root;
+        versions[i] = version;
+        active[num_active++] = i;
+      }
+
+      std::array<uint32_t, BATCH_LOOKUP_GROUP_SIZE> at_leaf;  // keys of the group whose descent reached a leaf
+      uint32_t num_at_leaf = 0;
+      while (num_active > 0) {
+        uint32_t num_searched = 0;
+        for (uint32_t j = 0; j < num_active; j++) {
+          const uint32_t i = active[j];
+          if (nodes[i]->GetType() == NodeType::LeafType) {
+            at_leaf[num_at_leaf++] = i;
+            continue;
+          }
+          auto *const node = static_cast<InnerNode *>(nodes[i]);
+          auto index_pointer = node->FindLocation(group_keys[i], this);
+          BaseNode *const child =
+              index_pointer != node->Begin() ? (index_pointer - 1)->second : node->GetLowKeyPair().second;
+          // The child pointer may be garbage if a writer modified the node concurrently.
+          if (!node->ValidateNodeVersion(versions[i])) {
+            restarted[num_restarted++] = i;
+            continue;
+          }
+          __builtin_prefetch(child);
+          children[i] = child;
+          active[num_searched++] = i;
+        }
+
+        num_active = 0;
+        for (uint32_t j = 0; j < num_searched; j++) {
+          const uint32_t i = active[j];
+          BaseNode *const child = children[i];
+          const uint64_t child_version = child->ReadNodeVersion();
+          // The child's version only counts if the child was still linked from its parent when it was read.
+          if (!nodes[i]->ValidateNodeVersion(versions[i])) {
+            restarted[num_restarted++] = i;
+            continue;
+          }
+          PrefetchSearchPath(child);
+          nodes[i] = child;
+          versions[i] = child_version;
+          active[num_active++] = i;
+        }
+      }
+
+      std::array<const ValueList *, BATCH_LOOKUP_GROUP_SIZE> values;
+      uint32_t num_found = 0;
+      for (uint32_t j = 0; j < num_at_leaf; j++) {
+        const uint32_t i = at_leaf[j];
+        auto *const node = reinterpret_cast<ElasticNode<KeyValuePair> *>(nodes[i]);
+        KeyValuePair *element_p = LeafLowerBound(node, group_keys[i], true);
+        const ValueList *const key_values =
+            element_p != node->End() && KeyCmpEqual(element_p->first, group_keys[i]) ? element_p->second : nullptr;
+        if (!node->ValidateNodeVersion(versions[i])) {
+          restarted[num_restarted++] = i;
+          continue;
+        }
+        if (key_values == nullptr) continue;
+        // The value list stays untouched from here on, so it is only prefetched now and copied in another pass.
+        __builtin_prefetch(key_values);
+        values[i] = key_values;
+        at_leaf[num_found++] = i;
+      }
+      for (uint32_t j = 0; j < num_found; j++) {
+        const uint32_t i = at_leaf[j];
+        group_results[i].insert(group_results[i].end(), values[i]->begin(), values[i]->end());
+      }
+
+      for (uint32_t j = 0; j < num_restarted; j++) {
+        const uint32_t i = restarted[j];
+        FindValueOfKey(group_keys[i], &group_results[i]);
+      }
+    }
   }
 
   /**
@@ -1684,6 +2012,8 @@ class BPlusTree : public BPlusTreeBase {
    * Scan Ascending - Scans keys starting at low key and moves till high key or limit, and populates
    * the value_list vector with the values found, if they are visible to the transaction.
    *
+   * NOTE: This function does not acquire any latches. See OptimisticScan().
+   *
    * @param index_low_key Key to start at
    * @param index_high_key Key to end at
    * @param low_key_exists Whether low_key exists in the scan operation
@@ -1693,86 +2023,109 @@ class BPlusTree : public BPlusTreeBase {
    * @param value_list List of values scanned
    * @param metadata Index metadata
    * @param predicate Predicate to be satisfied to add a value to the result
+   * @param key_list if not nullptr, the bytes of the key of every value in value_list are appended to it
    */
-  bool ScanAscending(KeyType index_low_key, KeyType index_high_key, bool low_key_exists, uint32_t num_attrs,
+  void ScanAscending(KeyType index_low_key, KeyType index_high_key, bool low_key_exists, uint32_t num_attrs,
                      bool high_key_exists, uint32_t limit, std::vector<TupleSlot> *value_list,
-                     const IndexMetadata *metadata, std::function<bool(const ValueType)> predicate) {
-    BPlusTreeIterator iterator;
-    if (low_key_exists) {
-      iterator = Begin(index_low_key);
-    } else {
-      iterator = Begin();
-    }
-
-    while ((limit == 0 || value_list->size() < limit) && (iterator != End()) && (iterator != Retry()) &&
-           (!high_key_exists || iterator.Key().PartialLessThan(index_high_key, metadata, num_attrs))) {
-      if (!predicate(iterator.Value())) {
-        ++iterator;
-        continue;
+                     const IndexMetadata *metadata, std::function<bool(const ValueType)> predicate,
+                     std::vector<byte> *key_list = nullptr) {
+    OptimisticScan(low_key_exists ? &index_low_key : nullptr, true, [&](const KeyType &key, const ValueList &values) {
+      if (high_key_exists && !key.PartialLessThan(index_high_key, metadata, num_attrs)) return false;
+      for (const auto &value : values) {
+        if (!predicate(value)) continue;
+        value_list->push_back(value);
+        if (key_list != nullptr) {
+          const auto *const key_bytes = reinterpret_cast<const byte *>(&key);
+          key_list->insert(key_list->end(), key_bytes, key_bytes + sizeof(KeyType));
+        }
+        if (limit != 0 && value_list->size() >= limit) return false;
       }
-      value_list->push_back(iterator.Value());
-      if (!(limit == 0 || value_list->size() < limit)) break;
-      ++iterator;
-    }
-
-    return (iterator != Retry());
+      return true;
+    });
   }
 
   /**
    * Scan Descending - Scan keys starting from high key and moves till low key, and populates a vector
-   * with the values found, if they are visible to the transaction. Since there is a possibility of
-   * deadlock with a ScanAscending and concurrent delete/insert, if shared latch on a node is not
-   * available, the entire operation is forfeited, and false is returned. The caller is expected to
-   * retry the operation till it succeeds, returning true.
+   * with the values found, if they are visible to the transaction.
+   *
+   * NOTE: This function does not acquire any latches. See OptimisticScan().
    *
    * @param index_low_key Key to end at
    * @param index_high_key Key to start at
    * @param value_list List to be populated with results
-   * @return true on success, false on failure
    */
-  bool ScanDescending(KeyType index_low_key, KeyType index_high_key, std::vector<TupleSlot> *value_list) {
-    BPlusTreeIterator iterator = RBegin(index_high_key);
-
-    while ((iterator != REnd()) && (iterator != Retry()) && KeyCmpGreaterEqual(iterator.Key(), index_low_key)) {
-      value_list->push_back(iterator.Value());
-      --iterator;
-    }
-
-    return (iterator != Retry());
+  void ScanDescending(KeyType index_low_key, KeyType index_high_key, std::vector<TupleSlot> *value_list) {
+    OptimisticScan(&index_high_key, false, [&](const KeyType &key, const ValueList &values) {
+      if (KeyCmpLess(key, index_low_key)) return false;
+      value_list->insert(value_list->end(), values.begin(), values.end());
+      return true;
+    });
   }
 
   /**
    * Scan keys starting from high key and moves till low key or till limit, and populates a vector
-   * with the values found, if they are visible to the transaction. Since there is a possibility of
-   * deadlock with a ScanAscending and concurrent delete/insert, if shared latch on a node is not
-   * available, the entire operation is forfeited, and false is returned. The caller is expected to
-   * retry the operation till it succeeds, returning true.
+   * with the values found, if they are visible to the transaction.
+   *
+   * NOTE: This function does not acquire any latches. See OptimisticScan().
    *
    * @param index_low_key Key to end at
    * @param index_high_key Key to start at
    * @param value_list List to be populated with results
    * @param limit Upper bound of number of values to return
    * @param predicate Predicate to be satisfied to add a value to the result
-   * @return true on success, false on failure
    */
-  bool ScanLimitDescending(KeyType index_low_key, KeyType index_high_key, std::vector<TupleSlot> *value_list,
+  void ScanLimitDescending(KeyType index_low_key, KeyType index_high_key, std::vector<TupleSlot> *value_list,
                            uint32_t limit, std::function<bool(const ValueType)> predicate) {
-    BPlusTreeIterator iterator = RBegin(index_high_key);
-
-    while ((value_list->size() < limit) && KeyCmpGreaterEqual(iterator.Key(), index_low_key) && (iterator != REnd()) &&
-           (iterator != Retry())) {
-      if (!predicate(iterator.Value())) {
-        --iterator;
-        continue;
+    OptimisticScan(&index_high_key, false, [&](const KeyType &key, const ValueList &values) {
+      if (KeyCmpLess(key, index_low_key)) return false;
+      for (const auto &value : values) {
+        if (!predicate(value)) continue;
+        value_list->push_back(value);
+        if (value_list->size() >= limit) return false;
       }
-      value_list->push_back(iterator.Value());
-      if (value_list->size() >= limit) break;
-      --iterator;
-    }
+      return true;
+    });
+  }
+
+  /**
+   * AppendValue - Appends a value to the value list of a leaf element. Optimistic readers copy value lists without
+   * latches, so a list is never modified in place: the element gets a modified copy, and the old list is retired.
+   *
+   * NOTE: The leaf node of the element must be latched exclusively.
+   */
+  void AppendValue(KeyValuePair *element_p, const ValueType &value) {
+    auto *new_values = new ValueList(*element_p->second);
+    new_values->push_back(value);
+    epoch_manager_.Retire(element_p->second);
+    element_p->second = new_values;
+  }
+
+  /**
+   * RemoveValue - Removes a value from the value list of a leaf element, which must hold more than just that value.
+   * Like AppendValue(), the element gets a modified copy of the list.
+   *
+   * NOTE: The leaf node of the element must be latched exclusively.
+   */
+  void RemoveValue(KeyValuePair *element_p, typename ValueList::const_iterator value) {
+    auto *new_values = new ValueList(element_p->second->cbegin(), value);
+    new_values->insert(new_values->cend(), std::next(value), element_p->second->cend());
+    epoch_manager_.Retire(element_p->second);
+    element_p->second = new_values;
+  }
 
-    return (iterator != Retry());
+  /**
+   * RetireNode - Frees a node that was unlinked from the tree, once no optimistic reader can see it anymore
+   */
+  template <typename ElementType>
+  void RetireNode(ElasticNode<ElementType> *node) {
+    epoch_manager_.Retire(node, [](void *ptr) { static_cast<ElasticNode<ElementType> *>(ptr)->FreeElasticNode(); });
   }
 
+  /**
+   * Frees the nodes and value lists that were removed from the tree, as far as no reader can see them anymore.
+   */
+  void PerformGarbageCollection() { epoch_manager_.Reclaim(); }
+
   /**
    * ReleaseAllLocks - This function releases all locks currently held, according to the list
    * passed.
@@ -1791,6 +2144,178 @@ class BPlusTree : public BPlusTreeBase {
     return got_root_latch;
   }
 
+  /**
+   * InsertIntoLeaf - Inserts a key-value pair into a leaf node, unless this would split the leaf node.
+   *
+   * NOTE: The leaf node must be latched exclusively, and must be the leaf node that the key belongs into.
+   */
+  LeafUpdateResult InsertIntoLeaf(ElasticNode<KeyValuePair> *node, const KeyElementPair &element,
+                                  const std::function<bool(const ValueType)> &predicate) {
+    auto location_greater_key_leaf = static_cast<LeafNode *>(node)->FindLocation(element.first, this);
+    if (location_greater_key_leaf != node->Begin() &&
+        KeyCmpEqual((location_greater_key_leaf - 1)->first, element.first)) {
+      // Key present in tree => insert into value list
+      for (const auto &value : *(location_greater_key_leaf - 1)->second) {
+        if (ValueCmpEqual(value, element.second) || predicate(value)) return LeafUpdateResult::FAILURE;
+      }
+      AppendValue(location_greater_key_leaf - 1, element.second);
+      num_values_++;
+      return LeafUpdateResult::SUCCESS;
+    }
+
+    // Key is not present
+    auto value_list = new std::list<ValueType>();
+    value_list->push_back(element.second);
+    if (!node->InsertElementIfPossible(KeyValuePair(element.first, value_list), location_greater_key_leaf)) {
+      delete value_list;
+      return LeafUpdateResult::RESTRUCTURE;
+    }
+    num_keys_++;
+    num_values_++;
+    return LeafUpdateResult::SUCCESS;
+  }
+
+  /**
+   * DeleteFromLeaf - Deletes a key-value pair from a leaf node, unless this would leave the leaf node underfull.
+   *
+   * NOTE: The leaf node must be latched exclusively, and must be the leaf node that the key belongs into.
+   */
+  LeafUpdateResult DeleteFromLeaf(ElasticNode<KeyValuePair> *node, const KeyElementPair &element) {
+    auto location_greater_key_leaf = static_cast<LeafNode *>(node)->FindLocation(element.first, this);
+    if (location_greater_key_leaf == node->Begin() ||
+        !KeyCmpEqual((location_greater_key_leaf - 1)->first, element.first)) {
+      // Key is not present
+      return LeafUpdateResult::FAILURE;
+    }
+
+    // Key present in tree => check if value present & delete from value list
+    KeyValuePair *element_p = location_greater_key_leaf - 1;
+    const ValueList &values = *element_p->second;
+    auto value = std::find_if(values.cbegin(), values.cend(),
+                              [&](const ValueType &v) { return ValueCmpEqual(v, element.second); });
+    if (value == values.cend()) {
+      // Value not in tree
+      return LeafUpdateResult::FAILURE;
+    }
+
+    if (values.size() > 1) {
+      // Other values remain, the key stays in the tree
+      RemoveValue(element_p, value);
+      num_values_--;
+      return LeafUpdateResult::SUCCESS;
+    }
+
+    if (node->GetSize() > GetLeafNodeSizeLowerThreshold()) {
+      // The list is now empty, delete key-emptylist from the tree, which won't trigger rebalance
+      epoch_manager_.Retire(element_p->second);
+      node->Erase(element_p - node->Begin());
+      num_keys_--;
+      num_values_--;
+      return LeafUpdateResult::SUCCESS;
+    }
+    return LeafUpdateResult::RESTRUCTURE;
+  }
+
+  /**
+   * LeafOwnsKey - Returns whether a key belongs into a leaf node, given that the keys of a batch are visited in order
+   * and an earlier key of the batch was found to belong into it. A key that is not larger than the largest key of the
+   * leaf node lies between two of its keys, and the rightmost leaf node takes every larger key.
+   *
+   * NOTE: The leaf node must be latched exclusively, so that its keys and its right sibling stay the same.
+   */
+  bool LeafOwnsKey(ElasticNode<KeyValuePair> *node, const KeyType &key) const {
+    if (node->GetHighKeyPair().second == nullptr) return true;
+    return node->GetSize() > 0 && KeyCmpLessEqual(key, (node->End() - 1)->first);
+  }
+
+  /**
+   * Splits num_elements elements into nodes of roughly fill_factor * max_node_size elements each. Nodes are never
+   * larger than max_node_size, and unless there is only a single node, never smaller than half of it.
+   * @param num_elements number of elements to distribute
+   * @param max_node_size maximum number of elements per node
+   * @param fill_factor fraction of max_node_size to fill each node with, between 0.5 and 1
+   * @return the number of elements of each node, from left to right
+   */
+  static std::vector<int> BulkLoadNodeSizes(const size_t num_elements, const int max_node_size,
+                                            const double fill_factor) {
+    const auto target_size = static_cast<size_t>(
+        std::max(1.0, static_cast<double>(max_node_size) * std::clamp(fill_factor, 0.5, 1.0)));
+    const auto max_size = static_cast<size_t>(max_node_size);
+    const size_t num_nodes =
+        std::max({num_elements / target_size, (num_elements + max_size - 1) / max_size, static_cast<size_t>(1)});
+    // Spread the remainder over the first nodes, so that the last node does not end up nearly empty.
+    std::vector<int> sizes(num_nodes, static_cast<int>(num_elements / num_nodes));
+    for (size_t i = 0; i < num_elements % num_nodes; i++) sizes[i]++;
+    return sizes;
+  }
+
+  /**
+   * Builds the tree bottom-up from key-value pairs sorted by key. The leaves are filled from left to right, and every
+   * level of inner nodes is built from the lowest keys of the level below it. This avoids the root-to-leaf traversal,
+   * latching and splits of inserting the pairs one at a time.
+   *
+   * NOTE: This function does not acquire any node latches, and must not run concurrently with other operations.
+   *
+   * @param sorted key-value pairs, sorted by key
+   * @param fill_factor fraction of each node to fill, between 0.5 and 1. The rest is left for later inserts.
+   * @return true on success, false if the tree is not empty, in which case nothing is loaded
+   */
+  bool BulkLoad(const std::vector<KeyElementPair> &sorted, const double fill_factor) {
+    if (root_ != nullptr) return false;
+    if (sorted.empty()) return true;
+
+    // Each leaf element holds all the values of one key.
+    std::vector<KeyValuePair> elements;
+    for (const auto &pair : sorted) {
+      if (elements.empty() || !KeyCmpEqual(elements.back().first, pair.first)) {
+        elements.emplace_back(pair.first, new std::list<ValueType>());
+      }
+      elements.back().second->push_back(pair.second);
+    }
+
+    // The lowest key and the node of every node on the level that was built last
+    std::vector<KeyNodePointerPair> level;
+    ElasticNode<KeyValuePair> *prev_leaf = nullptr;
+    const KeyValuePair *element = elements.data();
+    for (const int size : BulkLoadNodeSizes(elements.size(), leaf_node_size_upper_threshold_, fill_factor)) {
+      // Leaves link to their siblings through the pointers of their low and high keys.
+      const KeyNodePointerPair low_key{element->first, prev_leaf};
+      const KeyNodePointerPair high_key{(element + size - 1)->first, nullptr};
+      auto *leaf = ElasticNode<KeyValuePair>::Get(leaf_node_size_upper_threshold_, NodeType::LeafType, 0,
+                                                  leaf_node_size_upper_threshold_, low_key, high_key);
+      leaf->PushBack(element, element + size);
+      if (prev_leaf != nullptr) prev_leaf->GetElasticHighKeyPair()->second = leaf;
+      level.emplace_back(element->first, leaf);
+      prev_leaf = leaf;
+      element += size;
+    }
+
+    int depth = 0;
+    while (level.size() > 1) {
+      depth++;
+      std::vector<KeyNodePointerPair> parents;
+      const KeyNodePointerPair *child = level.data();
+      // An inner node of n elements has n + 1 children, the first of which is the pointer of its low key.
+      const auto node_sizes = BulkLoadNodeSizes(level.size(), inner_node_size_upper_threshold_ + 1, fill_factor);
+      for (const int num_children : node_sizes) {
+        const KeyNodePointerPair high_key{(child + num_children - 1)->first, nullptr};
+        auto *inner = ElasticNode<KeyNodePointerPair>::Get(inner_node_size_upper_threshold_, NodeType::InnerType, depth,
+                                                           inner_node_size_upper_threshold_, *child, high_key);
+        inner->PushBack(child + 1, child + num_children);
+        parents.emplace_back(child->first, inner);
+        child += num_children;
+      }
+      level = std::move(parents);
+    }
+
+    root_latch_.LockExclusive();
+    root_ = level.front().second;
+    num_keys_ = elements.size();
+    num_values_ = sorted.size();
+    root_latch_.UnlockExclusive();
+    return true;
+  }
+
   /**
    * This function adds an element in the tree
    * The structure followed in the code is the lowKeyPointerPair's pointer represents
@@ -1801,134 +2326,48 @@ class BPlusTree : public BPlusTreeBase {
    * @return true on successful insertion, false otherwise
    */
   bool Insert(const KeyElementPair element, std::function<bool(const ValueType)> predicate) {
+    EpochManager::Guard guard(&epoch_manager_);
+
     /*
      * Try Optimistic Insert
-     * Assuming insert will not cause any overflows, get shared latch for all nodes except the
-     * leaf node. For the leaf node where insert occurs, get exclusive access.
-     */
-
-    // Get access to the Tree
-    root_latch_.LockExclusive();
-
-    if (root_ == nullptr) {
-      // If root is nullptr then we make a Leaf Node.
-      KeyNodePointerPair p1, p2;
-      p1.first = element.first;
-      p2.first = element.first;
-      p1.second = nullptr;
-      p2.second = nullptr;
-
-      root_ = ElasticNode<KeyValuePair>::Get(leaf_node_size_upper_threshold_, NodeType::LeafType, 0,
-                                             leaf_node_size_upper_threshold_, p1, p2);
-    }
-
-    // NOTE: At this point, exclusive lock to tree (root_latch_) is held.
-
-    BaseNode *current_node = root_;
-    BaseNode *parent_node = nullptr;
-
-    // Get shared latch on root node
-    current_node->GetNodeSharedLatch();
-
-    // Traversing Down and maintaining a stack of pointers
-    while (current_node->GetType() != NodeType::LeafType) {
-      auto node = reinterpret_cast<ElasticNode<KeyNodePointerPair> *>(current_node);
-
-      // Release parent's shared lock
-      if (parent_node != nullptr) {
-        parent_node->ReleaseNodeSharedLatch();
-      } else {
-        // Release the exclusive lock on the tree
+     * Assuming insert will not cause any overflows, find the leaf node without latches like a reader does, and only
+     * get exclusive access to the leaf node where insert occurs. The latch is only granted if the leaf node did not
+     * change since the descent validated it, i.e., if it is still the right leaf node for the key.
+     */
+    BaseNode *current_node;
+    while (true) {
+      uint64_t version;
+      current_node = OptimisticFindLeafNode(element.first, &version);
+      if (current_node == nullptr) {
+        // If root is nullptr then we make a Leaf Node.
+        root_latch_.LockExclusive();
+        if (root_ == nullptr) {
+          KeyNodePointerPair p1, p2;
+          p1.first = element.first;
+          p2.first = element.first;
+          p1.second = nullptr;
+          p2.second = nullptr;
+          root_ = ElasticNode<KeyValuePair>::Get(leaf_node_size_upper_threshold_, NodeType::LeafType, 0,
+                                                 leaf_node_size_upper_threshold_, p1, p2);
+        }
         root_latch_.UnlockExclusive();
+        continue;
       }
 
-      // NOTE: FindLocation returns the location of first element that compares greater than
-      auto index_pointer = static_cast<InnerNode *>(node)->FindLocation(element.first, this);
-      // Thus we have to go in the left side of location which will be the
-      // pointer of the previous location.
-      if (index_pointer != node->Begin()) {
-        index_pointer -= 1;
-        parent_node = current_node;
-        current_node = index_pointer->second;
-      } else {
-        parent_node = current_node;
-        current_node = node->GetLowKeyPair().second;
+      if (current_node->UpgradeNodeLatch(version)) {
+        break;
       }
-
-      // Get current node's shared lock
-      current_node->GetNodeSharedLatch();
-    }
-
-    // Try optimistic insertion into the leaf node, if insertion without splitting is possible.
-
-    // Get current node's exclusive lock and release lock on the parent
-    current_node->ReleaseNodeSharedLatch();
-    current_node->GetNodeExclusiveLatch();
-    if (parent_node != nullptr) {
-      parent_node->ReleaseNodeSharedLatch();
-    } else {
-      root_latch_.UnlockExclusive();
     }
 
     // Beyond this we only have exclusive latch on the current_node
-
-    bool finished_insertion = false;
-    // We maintain the element that we have to recursively insert up.
-    // This is the element that has to be inserted into the inner nodes.
-    auto node = reinterpret_cast<ElasticNode<KeyValuePair> *>(current_node);
-
-    auto location_greater_key_leaf = static_cast<LeafNode *>(node)->FindLocation(element.first, this);
-    if (location_greater_key_leaf != node->Begin()) {
-      if (KeyCmpEqual((location_greater_key_leaf - 1)->first, element.first)) {
-        // Key present in tree => insert into value list
-        auto itr_list = (location_greater_key_leaf - 1)->second->begin();
-        while (itr_list != (location_greater_key_leaf - 1)->second->end()) {
-          if (ValueCmpEqual(*itr_list, element.second) || predicate(*itr_list)) {
-            // Release all locks if the value is already present
-            current_node->ReleaseNodeLatch();
-            return false;
-          }
-          itr_list++;
-        }
-        (location_greater_key_leaf - 1)->second->push_back(element.second);
-
-        // Release the latch, insertion is complete
-        current_node->ReleaseNodeLatch();
-
-        num_values_++;
-        finished_insertion = true;
-      }
-    }
-
-    // Insertion not done yet as key is not present
-    if (!finished_insertion) {
-      auto value_list = new std::list<ValueType>();
-      value_list->push_back(element.second);
-      KeyValuePair key_list_value;
-      key_list_value.first = element.first;
-      key_list_value.second = value_list;
-      if (node->InsertElementIfPossible(key_list_value,
-                                        static_cast<LeafNode *>(node)->FindLocation(element.first, this))) {
-        // If you can directly insert in the leaf - Insertion is over
-        finished_insertion = true;
-        // Insertion is done, release the latch
-        current_node->ReleaseNodeLatch();
-        num_keys_++;
-        num_values_++;
-      } else {
-        delete value_list;
-      }
-      // Otherwise, split the node
-      // Optimistic approach failed
-    }
-
-    if (!finished_insertion) {
-      // Optimistic approach failed. Release the latch, and start grabbing
-      // exclusive latches.
-      current_node->ReleaseNodeLatch();
-    } else {
-      return true;
+    const LeafUpdateResult result =
+        InsertIntoLeaf(reinterpret_cast<ElasticNode<KeyValuePair> *>(current_node), element, predicate);
+    current_node->ReleaseNodeLatch();
+    if (result != LeafUpdateResult::RESTRUCTURE) {
+      return result == LeafUpdateResult::SUCCESS;
     }
+    // Otherwise, split the node
+    // Optimistic approach failed. Start grabbing exclusive latches.
 
     /*
      ****************************************
@@ -1986,13 +2425,13 @@ class BPlusTree : public BPlusTreeBase {
       current_node->GetNodeExclusiveLatch();
     }
 
-    finished_insertion = false;
+    bool finished_insertion = false;
     // We maintain the element that we have to recursively insert up.
     // This is the element that has to be inserted into the inner nodes.
     KeyNodePointerPair inner_node_element;
-    node = reinterpret_cast<ElasticNode<KeyValuePair> *>(current_node);
+    auto node = reinterpret_cast<ElasticNode<KeyValuePair> *>(current_node);
 
-    location_greater_key_leaf = static_cast<LeafNode *>(node)->FindLocation(element.first, this);
+    auto location_greater_key_leaf = static_cast<LeafNode *>(node)->FindLocation(element.first, this);
     if (location_greater_key_leaf != node->Begin()) {
       if (KeyCmpEqual((location_greater_key_leaf - 1)->first, element.first)) {
         auto itr_list = (location_greater_key_leaf - 1)->second->begin();
@@ -2006,7 +2445,7 @@ class BPlusTree : public BPlusTreeBase {
           }
           itr_list++;
         }
-        (location_greater_key_leaf - 1)->second->push_back(element.second);
+        AppendValue(location_greater_key_leaf - 1, element.second);
 
         // Insertion is complete, release all locks
         current_node->ReleaseNodeLatch();
@@ -2109,17 +2548,18 @@ class BPlusTree : public BPlusTreeBase {
     // Remember the root must have been split by now.
     if (!finished_insertion) {
       NOISEPAGE_ASSERT(got_root_latch, "Root Latch should be held here");
-      auto old_root = root_;
+      BaseNode *old_root = root_;
       KeyNodePointerPair p1, p2;
       p1.first = inner_node_element.first; /* This is a dummy initialization */
       p2.first = inner_node_element.first; /* This is a dummy initialization */
       p1.second = old_root;                /* This initialization matters */
       p2.second = nullptr;                 /* This is a dummy initialization */
-      root_ = ElasticNode<KeyNodePointerPair>::Get(inner_node_size_upper_threshold_, NodeType::InnerType,
-                                                   root_->GetDepth() + 1, inner_node_size_upper_threshold_, p1, p2);
-      auto new_root_node = reinterpret_cast<ElasticNode<KeyNodePointerPair> *>(root_);
+      auto new_root_node = ElasticNode<KeyNodePointerPair>::Get(
+          inner_node_size_upper_threshold_, NodeType::InnerType, old_root->GetDepth() + 1,
+          inner_node_size_upper_threshold_, p1, p2);
       new_root_node->InsertElementIfPossible(
           inner_node_element, static_cast<InnerNode *>(new_root_node)->FindLocation(inner_node_element.first, this));
+      root_ = new_root_node;
     }
 
     if (got_root_latch) {
@@ -2362,7 +2802,7 @@ class BPlusTree : public BPlusTreeBase {
       input_child_pointer->ReleaseNodeLatch();
       left_sibling_base_node->ReleaseNodeLatch();
 
-      child->FreeElasticNode();
+      RetireNode(child);
       parent->Erase(index);
 
     } else {
@@ -2409,7 +2849,7 @@ class BPlusTree : public BPlusTreeBase {
       input_child_pointer->ReleaseNodeLatch();
       right_sibling_base_node->ReleaseNodeLatch();
 
-      right_sibling->FreeElasticNode();
+      RetireNode(right_sibling);
       parent->Erase(index + 1);
     }
   }
@@ -2417,7 +2857,7 @@ class BPlusTree : public BPlusTreeBase {
   /**
    * RelaseLastLocksDelete - Releases the node's latch and pops it from the list
    */
-  void RelaseLastLocksDelete(std::vector<common::SharedLatch *> *lock_list) {
+  void RelaseLastLocksDelete(std::vector<common::OptimisticLatch *> *lock_list) {
     if (!lock_list->empty()) {
       (*lock_list->rbegin())->UnlockExclusive();
       lock_list->pop_back();
@@ -2431,136 +2871,38 @@ class BPlusTree : public BPlusTreeBase {
    * @return true on success, false on failure
    */
   bool DeleteElement(const KeyElementPair &element) {
+    EpochManager::Guard guard(&epoch_manager_);
+
     /*
      ****************************
       Try optimistic delete
      ****************************
     */
-    // If root is nullptr then we return false.
-    root_latch_.LockExclusive();
-
-    if (root_ == nullptr) {
-      root_latch_.UnlockExclusive();
-      return false;
-    }
-    // Beyond this point we'll have exclusive_lock on tree lock
-
-    BaseNode *current_node = root_;
-    BaseNode *parent_node = nullptr;
-
-    // Get Shared Latch on the root
-    current_node->GetNodeSharedLatch();
-
-    // Traversing Down
-    while (current_node->GetType() != NodeType::LeafType) {
-      auto node = reinterpret_cast<ElasticNode<KeyNodePointerPair> *>(current_node);
-
-      // Release parent shared latch
-      if (parent_node != nullptr) {
-        parent_node->ReleaseNodeSharedLatch();
-      } else {
-        root_latch_.UnlockExclusive();
+    // Find the leaf node like a reader does, and get exclusive lock on it if it did not change in the meantime.
+    BaseNode *current_node;
+    while (true) {
+      uint64_t version;
+      current_node = OptimisticFindLeafNode(element.first, &version);
+      // If root is nullptr then we return false.
+      if (current_node == nullptr) {
+        return false;
       }
 
-      // Note that Find Location returns the location of first element
-      // that compare greater than
-      auto index_pointer = static_cast<InnerNode *>(node)->FindLocation(element.first, this);
-      // Thus we have to go in the left side of location which will be the
-      // pointer of the previous location.
-      if (index_pointer != node->Begin()) {
-        index_pointer -= 1;
-        parent_node = current_node;
-        current_node = index_pointer->second;
-      } else {
-        parent_node = current_node;
-        current_node = node->GetLowKeyPair().second;
+      if (current_node->UpgradeNodeLatch(version)) {
+        break;
       }
-
-      // Acquire shared latch on the current node
-      current_node->GetNodeSharedLatch();
     }
 
     // Now we try deletion from the found leaf node
     // only if without sharing or merge is possible
-
-    // Get exclusive lock on the leaf node for deletion
-    current_node->ReleaseNodeSharedLatch();
-    current_node->GetNodeExclusiveLatch();
-    if (parent_node != nullptr) {
-      parent_node->ReleaseNodeSharedLatch();
-    } else {
-      root_latch_.UnlockExclusive();
+    const LeafUpdateResult result =
+        DeleteFromLeaf(reinterpret_cast<ElasticNode<KeyValuePair> *>(current_node), element);
+    current_node->ReleaseNodeLatch();
+    if (result != LeafUpdateResult::RESTRUCTURE) {
+      return result == LeafUpdateResult::SUCCESS;
     }
 
-    bool finished_deletion = false;
-    auto node = reinterpret_cast<ElasticNode<KeyValuePair> *>(current_node);
-    auto location_greater_key_leaf = static_cast<LeafNode *>(node)->FindLocation(element.first, this);
-    if (location_greater_key_leaf != node->Begin()) {
-      if (KeyCmpEqual((location_greater_key_leaf - 1)->first, element.first)) {
-        // Key present in tree => check if value present & delete from value list
-        bool found_value = false;
-        auto itr_list = (location_greater_key_leaf - 1)->second->begin();
-        while (itr_list != (location_greater_key_leaf - 1)->second->end()) {
-          if (ValueCmpEqual(*itr_list, element.second)) {
-            // Value fround => Delete element from list if won't trigger rebalance
-            found_value = true;
-            if (((location_greater_key_leaf - 1)->second->size() > 1) ||
-                (node->GetSize() > GetLeafNodeSizeLowerThreshold())) {
-              (location_greater_key_leaf - 1)->second->erase(itr_list);
-              finished_deletion = true;
-              break;
-            }
-          }
-          itr_list++;
-        }
-
-        if (!found_value) {
-          // Value not in tree
-          // Release the latch and return
-          current_node->ReleaseNodeLatch();
-          return false;
-        }
-
-        if (found_value) {
-          if (finished_deletion) {
-            // If now the list is empty delete key-emptylist from the tree
-            bool key_deleted = false;
-            if ((location_greater_key_leaf - 1)->second->empty()) {
-              delete (location_greater_key_leaf - 1)->second;
-              key_deleted = node->Erase((location_greater_key_leaf - 1) - node->Begin());
-            }
-
-            // Release the latch and return
-            current_node->ReleaseNodeLatch();
-
-            if (key_deleted) {
-              num_keys_--;
-            }
-
-            num_values_--;
-            return true;
-          }
-
-          if (!finished_deletion) {
-            // Need to continue with pessimistic delete
-            // Release the latch
-            current_node->ReleaseNodeLatch();
-          }
-        }
-      } else {
-        // Deletion not done yet as key is not present
-        // Release the lock and return
-        current_node->ReleaseNodeLatch();
-
-        return false;
-      }
-    } else {
-      // Deletion not done yet as key is not present
-      // Release the lock and return
-      current_node->ReleaseNodeLatch();
-
-      return false;
-    }
+    // Need to continue with pessimistic delete
 
     /*
      ****************************************
@@ -2568,7 +2910,7 @@ class BPlusTree : public BPlusTreeBase {
      ****************************************
     */
 
-    std::vector<common::SharedLatch *> lock_list;
+    std::vector<common::OptimisticLatch *> lock_list;
     root_latch_.LockExclusive();
     lock_list.push_back(&root_latch_);
     bool is_deleted = Delete(root_, element, &lock_list);
@@ -2576,6 +2918,83 @@ class BPlusTree : public BPlusTreeBase {
     return is_deleted;
   }
 
+  /**
+   * Inserts key-value pairs sorted by key, like Insert() for every pair. Instead of a descent and a latch per pair,
+   * every run of pairs that belongs into the same leaf node is inserted under a single latch of the leaf node, after a
+   * single descent. A pair that would split the leaf node is inserted with Insert(), and the next pair descends again.
+   * @param sorted key-value pairs, sorted by key
+   * @param predicate checked like for Insert()
+   * @param[out] inserted the pairs that were inserted are appended to this
+   * @return true if every pair was inserted
+   */
+  bool InsertBatch(const std::vector<KeyElementPair> &sorted, const std::function<bool(const ValueType)> &predicate,
+                   std::vector<KeyElementPair> *const inserted) {
+    EpochManager::Guard guard(&epoch_manager_);
+    bool all_inserted = true;
+    size_t i = 0;
+    while (i < sorted.size()) {
+      uint64_t version;
+      auto *const node = OptimisticFindLeafNode(sorted[i].first, &version);
+      LeafUpdateResult result = LeafUpdateResult::RESTRUCTURE;
+      if (node != nullptr) {
+        if (!node->UpgradeNodeLatch(version)) continue;
+        do {
+          result = InsertIntoLeaf(node, sorted[i], predicate);
+          if (result == LeafUpdateResult::RESTRUCTURE) break;
+          if (result == LeafUpdateResult::SUCCESS) inserted->push_back(sorted[i]);
+          all_inserted = all_inserted && result == LeafUpdateResult::SUCCESS;
+          i++;
+        } while (i < sorted.size() && LeafOwnsKey(node, sorted[i].first));
+        node->ReleaseNodeLatch();
+      }
+
+      // The tree is empty or the leaf node is full
+      if (result == LeafUpdateResult::RESTRUCTURE) {
+        if (Insert(sorted[i], predicate)) {
+          inserted->push_back(sorted[i]);
+        } else {
+          all_inserted = false;
+        }
+        i++;
+      }
+    }
+    return all_inserted;
+  }
+
+  /**
+   * Deletes key-value pairs sorted by key, like DeleteElement() for every pair. Every run of pairs that belongs into
+   * the same leaf node is deleted under a single latch of the leaf node, after a single descent. A pair whose deletion
+   * would leave the leaf node underfull is deleted with DeleteElement(), and the next pair descends again.
+   * @param sorted key-value pairs, sorted by key
+   * @return the number of pairs that were found and deleted
+   */
+  size_t DeleteBatch(const std::vector<KeyElementPair> &sorted) {
+    EpochManager::Guard guard(&epoch_manager_);
+    size_t num_deleted = 0;
+    size_t i = 0;
+    while (i < sorted.size()) {
+      uint64_t version;
+      auto *const node = OptimisticFindLeafNode(sorted[i].first, &version);
+      if (node == nullptr) break;  // Empty tree
+      if (!node->UpgradeNodeLatch(version)) continue;
+      LeafUpdateResult result;
+      do {
+        result = DeleteFromLeaf(node, sorted[i]);
+        if (result == LeafUpdateResult::RESTRUCTURE) break;
+        if (result == LeafUpdateResult::SUCCESS) num_deleted++;
+        i++;
+      } while (i < sorted.size() && LeafOwnsKey(node, sorted[i].first));
+      node->ReleaseNodeLatch();
+
+      // The leaf node has to be merged or rebalanced
+      if (result == LeafUpdateResult::RESTRUCTURE) {
+        if (DeleteElement(sorted[i])) num_deleted++;
+        i++;
+      }
+    }
+    return num_deleted;
+  }
+
   /**
    * Delete() - Remove a key-value pair from the tree
    *
@@ -2583,7 +3002,8 @@ class BPlusTree : public BPlusTreeBase {
    * exist. Return true if delete succeeds
    *
    */
-  bool Delete(BaseNode *current_node, const KeyElementPair &element, std::vector<common::SharedLatch *> *lock_list) {
+  bool Delete(BaseNode *current_node, const KeyElementPair &element,
+              std::vector<common::OptimisticLatch *> *lock_list) {
     // If tree is empty, return false
     if (current_node == nullptr) {
       return false;
@@ -2631,38 +3051,31 @@ class BPlusTree : public BPlusTreeBase {
       if (leaf_position != node->Begin()) {
         leaf_position -= 1;
         if (KeyCmpEqual(leaf_position->first, element.first)) {
-          bool element_present = false;
-          auto itr_list = (leaf_position)->second->begin();
-          while (itr_list != (leaf_position)->second->end()) {
-            if (ValueCmpEqual(*itr_list, element.second)) {
-              // Delete element from list
-              (leaf_position)->second->erase(itr_list);
-              element_present = true;
-              break;
-            }
-            itr_list++;
-          }
+          const ValueList &values = *leaf_position->second;
+          auto value = std::find_if(values.cbegin(), values.cend(),
+                                    [&](const ValueType &v) { return ValueCmpEqual(v, element.second); });
 
           // Not Found - Return false
-          if (!element_present) {
+          if (value == values.cend()) {
             // Release the lock and return
             RelaseLastLocksDelete(lock_list);
             return false;
           }
 
-          if (!leaf_position->second->empty()) {
-            // Release the lock and return
+          if (values.size() > 1) {
+            // Delete element from list, release the lock and return
+            RemoveValue(leaf_position, value);
             RelaseLastLocksDelete(lock_list);
             num_values_--;
             return true;
           }
 
           // If now the list is empty delete key-emptylist from the tree
-          delete leaf_position->second;
+          epoch_manager_.Retire(leaf_position->second);
           bool is_deleted = node->Erase(leaf_position - node->Begin());
           if (is_deleted && node->GetSize() == 0) {
             // All elements of tree are now deleted
-            node->FreeElasticNode();  // Important - we need to free node
+            RetireNode(node);  // Important - we need to free node
             root_ = nullptr;
           }
 
@@ -2716,7 +3129,7 @@ class BPlusTree : public BPlusTreeBase {
 
           // Release the lock and free the node
           RelaseLastLocksDelete(lock_list);
-          node->FreeElasticNode();
+          RetireNode(node);
           return true;
         }
 
@@ -2747,11 +3160,13 @@ class BPlusTree : public BPlusTreeBase {
    */
   size_t EstimateHeapUsage() {
     // To estimate the heap usage, on an average, assume that the B+ Tree is always half full.
-    if (root_ == nullptr) {
+    EpochManager::Guard guard(&epoch_manager_);
+    BaseNode *root = root_;
+    if (root == nullptr) {
       return 0;
     }
 
-    auto depth = root_->GetDepth();
+    auto depth = root->GetDepth();
     size_t heap_usage = (depth * GetInnerNodeSizeLowerThreshold() *
                          sizeof(KeyNodePointerPair)) +  // InnerNode size (assuming half full)
                         (num_keys_ * sizeof(KeyType)) +
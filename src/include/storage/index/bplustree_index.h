@@ -13,6 +13,8 @@ namespace noisepage::storage::index {
 template <typename KeyType, typename ValueType, typename KeyComparator, typename KeyEqualityChecker,
           typename ValueEqualityChecker>
 class BPlusTree;
+template <typename KeyType>
+class BulkLoadBuffer;
 template <uint8_t KeySize>
 class CompactIntsKey;
 template <uint16_t KeySize>
@@ -34,8 +36,18 @@ class BPlusTreeIndex final : public Index {
                                   std::equal_to<KeyType>,  // NOLINT transparent functors can't figure out template
                                   std::equal_to<TupleSlot>>>
       bplustree_;
+  const std::unique_ptr<BulkLoadBuffer<KeyType>> bulk_load_buffer_;  // key-value pairs staged for BulkLoad()
   mutable common::SpinLatch transaction_context_latch_;  // latch used to protect transaction context
 
+  /**
+   * Builds the index keys of a batch of key-value pairs, and sorts the pairs by key.
+   * @param tuples keys
+   * @param locations values, one for every key
+   * @return the key-value pairs sorted by key, with equal keys in the order of the batch
+   */
+  std::vector<std::pair<KeyType, TupleSlot>> SortedElements(const std::vector<const ProjectedRow *> &tuples,
+                                                            const std::vector<TupleSlot> &locations) const;
+
  public:
   /**
    * @return type of the index. Note that this is the physical type, not extracted from the underlying schema or other
@@ -43,6 +55,11 @@ class BPlusTreeIndex final : public Index {
    */
   IndexType Type() const final { return IndexType::BPLUSTREE; }
 
+  /**
+   * Invoke garbage collection on the index, which frees the nodes and value lists that lookups no longer see.
+   */
+  void PerformGarbageCollection() final;
+
   /**
    * @return approximate number of bytes allocated on the heap for this index data structure
    */
@@ -69,6 +86,24 @@ class BPlusTreeIndex final : public Index {
   bool InsertUnique(common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &tuple,
                     TupleSlot location) final;
 
+  /**
+   * Stages a key-value pair for the next BulkLoad(). Thread-safe.
+   * @param txn txn context for the calling txn
+   * @param tuple key
+   * @param location value
+   * @return true
+   */
+  bool StageForBulkLoad(common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &tuple,
+                        TupleSlot location) final;
+
+  /**
+   * Sorts the staged key-value pairs in parallel and builds the B+ Tree bottom-up from them.
+   * @param txn txn context for the calling txn, used to register abort actions if the index is not empty
+   * @param fill_factor fraction of each node to fill, between 0.5 and 1
+   * @return false if a unique index would contain duplicate keys, in which case the txn must abort
+   */
+  bool BulkLoad(common::ManagedPointer<transaction::TransactionContext> txn, double fill_factor) final;
+
   /**
    * Doesn't immediately call delete on the index. Registers a commit action in the txn that will eventually register a
    * deferred action for the GC to safely call delete on the index when no more transactions need to access the key.
@@ -79,6 +114,26 @@ class BPlusTreeIndex final : public Index {
   void Delete(common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &tuple,
               TupleSlot location) final;
 
+  /**
+   * Sorts the key-value pairs by key and inserts every run of pairs that belongs into the same leaf node at once.
+   * @param txn txn context for the calling txn, used for visibility and write-write, and to register abort actions
+   * @param tuples keys
+   * @param locations values, one for every key
+   * @return true if every pair was inserted. Otherwise, the index found a constraint violation and the txn must abort.
+   */
+  bool InsertBatch(common::ManagedPointer<transaction::TransactionContext> txn,
+                   const std::vector<const ProjectedRow *> &tuples, const std::vector<TupleSlot> &locations) final;
+
+  /**
+   * Registers a single commit action for the batch, which eventually sorts the key-value pairs by key and deletes every
+   * run of pairs that belongs into the same leaf node at once.
+   * @param txn txn context for the calling txn, used to register commit actions for deferred GC actions
+   * @param tuples keys
+   * @param locations values, one for every key
+   */
+  void DeleteBatch(common::ManagedPointer<transaction::TransactionContext> txn,
+                   const std::vector<const ProjectedRow *> &tuples, const std::vector<TupleSlot> &locations) final;
+
   /**
    * Finds all the values associated with the given key in our index.
    * @param txn txn context for the calling txn, used for visibility checks
@@ -88,6 +143,15 @@ class BPlusTreeIndex final : public Index {
   void ScanKey(const transaction::TransactionContext &txn, const ProjectedRow &key,
                std::vector<TupleSlot> *value_list) final;
 
+  /**
+   * Finds all the values associated with each of the given keys, interleaving the lookups of the keys.
+   * @param txn txn context for the calling txn, used for visibility checks
+   * @param keys the keys to look for
+   * @param[out] value_lists the values associated with each key, in the order of the keys
+   */
+  void ScanKeyBatch(const transaction::TransactionContext &txn, const std::vector<const ProjectedRow *> &keys,
+                    std::vector<std::vector<TupleSlot>> *value_lists) final;
+
   /**
    * Finds all the values between the given keys in our index, sorted in ascending order.
    * @param txn txn context for the calling txn, used for visibility checks
@@ -102,6 +166,32 @@ class BPlusTreeIndex final : public Index {
                      ProjectedRow *low_key, ProjectedRow *high_key, uint32_t limit,
                      std::vector<TupleSlot> *value_list) final;
 
+  /**
+   * Finds all the values between the given keys in our index, sorted in ascending order, along with their keys.
+   * @param txn txn context for the calling txn, used for visibility checks
+   * @param scan_type Scan Type
+   * @param num_attrs Number of attributes to compare
+   * @param low_key the key to start at
+   * @param high_key the key to end at
+   * @param limit if any
+   * @param[out] value_list the values associated with the keys
+   * @param[out] key_list the keys of the values, or nullptr
+   */
+  void ScanAscendingWithKeys(const transaction::TransactionContext &txn, ScanType scan_type, uint32_t num_attrs,
+                             ProjectedRow *low_key, ProjectedRow *high_key, uint32_t limit,
+                             std::vector<TupleSlot> *value_list, std::vector<byte> *key_list) final;
+
+  /** @return size of the KeyType, which ScanAscendingWithKeys() copies into the key_list */
+  uint16_t KeyListEntrySize() const final { return sizeof(KeyType); }
+
+  /**
+   * Writes the attributes of a key returned by ScanAscendingWithKeys() into a ProjectedRow.
+   * @param key pointer to the entry of the key in the key_list
+   * @param[out] to ProjectedRow initialized from GetProjectedRowInitializer()
+   * @param varlen_buffer buffer of KeyListEntrySize() bytes for varlens that can't be inlined
+   */
+  void KeyToProjectedRow(const byte *key, ProjectedRow *to, byte *varlen_buffer) const final;
+
   /**
    * Finds all the values between the given keys in our index, sorted in descending order.
    * @param txn txn context for the calling txn, used for visibility checks
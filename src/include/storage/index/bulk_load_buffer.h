@@ -0,0 +1,75 @@
+#pragma once
+
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "storage/storage_defs.h"
+
+namespace noisepage::storage::index {
+
+/**
+ * Collects the key-value pairs of an index build, e.g., from the parallel table scan of CREATE INDEX. Every thread
+ * stages into its own buffer, so staging does not contend. Once the scan is done, the buffers are merged and handed
+ * to the index. Trees sort the pairs by key in parallel, so that they can build their leaves bottom-up instead of
+ * inserting every pair through a root-to-leaf traversal, and hash tables size themselves for the pairs up front.
+ * @tparam KeyType the type of keys stored in the index
+ */
+template <typename KeyType>
+class BulkLoadBuffer {
+ public:
+  /** A key and the TupleSlot that it points to */
+  using KeyValuePair = std::pair<KeyType, TupleSlot>;
+
+  /**
+   * Stage a key-value pair. Thread-safe.
+   * @param key key
+   * @param location value
+   */
+  void Stage(const KeyType &key, const TupleSlot location) { staged_.local().emplace_back(key, location); }
+
+  /**
+   * Remove all staged pairs from the buffer. Must not be called concurrently with Stage().
+   * @return the staged pairs, in no particular order
+   */
+  std::vector<KeyValuePair> Take() {
+    size_t size = 0;
+    for (const auto &local : staged_) size += local.size();
+    std::vector<KeyValuePair> pairs;
+    pairs.reserve(size);
+    for (const auto &local : staged_) pairs.insert(pairs.end(), local.cbegin(), local.cend());
+    staged_.clear();
+    return pairs;
+  }
+
+  /**
+   * Remove all staged pairs from the buffer and sort them by key. Must not be called concurrently with Stage().
+   * @return the staged pairs, sorted by key
+   */
+  std::vector<KeyValuePair> TakeSorted() {
+    std::vector<KeyValuePair> sorted = Take();
+    tbb::parallel_sort(sorted.begin(), sorted.end(), [](const KeyValuePair &lhs, const KeyValuePair &rhs) {
+      return std::less<KeyType>()(lhs.first, rhs.first);  // NOLINT transparent functors can't figure out template
+    });
+    return sorted;
+  }
+
+  /**
+   * @param sorted key-value pairs sorted by key
+   * @return true if any key appears more than once, i.e., a unique index cannot be built from the pairs
+   */
+  static bool HasDuplicateKey(const std::vector<KeyValuePair> &sorted) {
+    return std::adjacent_find(sorted.cbegin(), sorted.cend(), [](const KeyValuePair &lhs, const KeyValuePair &rhs) {
+             return std::equal_to<KeyType>()(lhs.first, rhs.first);  // NOLINT transparent functors can't figure out
+           }) != sorted.cend();
+  }
+
+ private:
+  tbb::enumerable_thread_specific<std::vector<KeyValuePair>> staged_;
+};
+
+}  // namespace noisepage::storage::index
@@ -20,6 +20,8 @@ class BwTree;
 }
 
 namespace noisepage::storage::index {
+template <typename KeyType>
+class BulkLoadBuffer;
 template <uint8_t KeySize>
 class CompactIntsKey;
 template <uint16_t KeySize>
@@ -41,6 +43,7 @@ class BwTreeIndex final : public Index {
       std::equal_to<KeyType>,                  // NOLINT transparent functors can't figure out template
       std::hash<KeyType>, std::equal_to<TupleSlot>, std::hash<TupleSlot>>>
       bwtree_;
+  const std::unique_ptr<BulkLoadBuffer<KeyType>> bulk_load_buffer_;  // key-value pairs staged for BulkLoad()
   mutable common::SpinLatch transaction_context_latch_;  // latch used to protect transaction context
 
  public:
@@ -81,6 +84,24 @@ class BwTreeIndex final : public Index {
   bool InsertUnique(common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &tuple,
                     TupleSlot location) final;
 
+  /**
+   * Stages a key-value pair for the next BulkLoad(). Thread-safe.
+   * @param txn txn context for the calling txn
+   * @param tuple key
+   * @param location value
+   * @return true
+   */
+  bool StageForBulkLoad(common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &tuple,
+                        TupleSlot location) final;
+
+  /**
+   * Sorts the staged key-value pairs in parallel and builds the BwTree bottom-up from them.
+   * @param txn txn context for the calling txn, used to register abort actions if the index is not empty
+   * @param fill_factor fraction of each node to fill, between 0.5 and 1
+   * @return false if a unique index would contain duplicate keys, in which case the txn must abort
+   */
+  bool BulkLoad(common::ManagedPointer<transaction::TransactionContext> txn, double fill_factor) final;
+
   /**
    * Doesn't immediately call delete on the index. Registers a commit action in the txn that will eventually register a
    * deferred action for the GC to safely call delete on the index when no more transactions need to access the key.
@@ -114,6 +135,32 @@ class BwTreeIndex final : public Index {
                      ProjectedRow *low_key, ProjectedRow *high_key, uint32_t limit,
                      std::vector<TupleSlot> *value_list) final;
 
+  /**
+   * Finds all the values between the given keys in our index, sorted in ascending order, along with their keys.
+   * @param txn txn context for the calling txn, used for visibility checks
+   * @param scan_type Scan Type
+   * @param num_attrs Number of attributes to compare
+   * @param low_key the key to start at
+   * @param high_key the key to end at
+   * @param limit if any
+   * @param[out] value_list the values associated with the keys
+   * @param[out] key_list the keys of the values, or nullptr
+   */
+  void ScanAscendingWithKeys(const transaction::TransactionContext &txn, ScanType scan_type, uint32_t num_attrs,
+                             ProjectedRow *low_key, ProjectedRow *high_key, uint32_t limit,
+                             std::vector<TupleSlot> *value_list, std::vector<byte> *key_list) final;
+
+  /** @return size of the KeyType, which ScanAscendingWithKeys() copies into the key_list */
+  uint16_t KeyListEntrySize() const final { return sizeof(KeyType); }
+
+  /**
+   * Writes the attributes of a key returned by ScanAscendingWithKeys() into a ProjectedRow.
+   * @param key pointer to the entry of the key in the key_list
+   * @param[out] to ProjectedRow initialized from GetProjectedRowInitializer()
+   * @param varlen_buffer buffer of KeyListEntrySize() bytes for varlens that can't be inlined
+   */
+  void KeyToProjectedRow(const byte *key, ProjectedRow *to, byte *varlen_buffer) const final;
+
   /**
    * Finds all the values between the given keys in our index, sorted in descending order.
    * @param txn txn context for the calling txn, used for visibility checks
@@ -42,11 +42,25 @@ class CompactIntsKey {
   static_assert(KeySize > 0 && KeySize <= COMPACTINTSKEY_MAX_SIZE);  // size must be no greater than 256-bits
   static_assert(KeySize % sizeof(uintptr_t) == 0);                   // size must be multiple of 8 bytes
 
+  /** Number of bytes that ToBinaryComparable() writes */
+  static constexpr uint16_t BINARY_COMPARABLE_SIZE = KeySize;
+
   /**
    * @return underlying byte array, exposed for hasher and comparators
    */
   const byte *KeyData() const { return key_data_; }
 
+  /**
+   * Write the binary-comparable form of the key, i.e., comparing the forms of two keys with std::memcmp orders the keys
+   * the same way as std::less. The key data already is in that form, so this is a plain copy.
+   * @param[out] buffer buffer of at least BINARY_COMPARABLE_SIZE bytes
+   * @return number of bytes written
+   */
+  uint16_t ToBinaryComparable(byte *const buffer) const {
+    std::memcpy(buffer, key_data_, KeySize);
+    return KeySize;
+  }
+
   /**
    * Set the CompactIntsKey's data based on a ProjectedRow and associated index metadata
    * @param from ProjectedRow to generate CompactIntsKey representation of
@@ -140,6 +154,40 @@ class CompactIntsKey {
     return true;
   }
 
+  /**
+   * Write the attributes of the key into a ProjectedRow, i.e., the inverse of SetFromProjectedRow()
+   * @param metadata index information, primarily attribute sizes and the precomputed offsets to translate
+   * CompactIntsKey layout to PR
+   * @param[out] to ProjectedRow with the layout of the ProjectedRows that keys are set from
+   * @param varlen_buffer unused, since CompactIntsKey has no varlen attributes
+   */
+  void ToProjectedRow(const IndexMetadata &metadata, storage::ProjectedRow *const to,
+                      UNUSED_ATTRIBUTE byte *const varlen_buffer) const {
+    const auto &attr_sizes = metadata.GetAttributeSizes();
+    const auto &compact_ints_offsets = metadata.GetCompactIntsOffsets();
+    NOISEPAGE_ASSERT(attr_sizes.size() == to->NumColumns(), "attr_sizes and ProjectedRow must be equal in size.");
+
+    for (uint8_t i = 0; i < attr_sizes.size(); i++) {
+      byte *const attr = to->AccessForceNotNull(to->ColumnIds()[i].UnderlyingValue());
+      switch (attr_sizes[i]) {
+        case sizeof(int8_t):
+          *reinterpret_cast<int8_t *>(attr) = GetInteger<int8_t>(compact_ints_offsets[i]);
+          break;
+        case sizeof(int16_t):
+          *reinterpret_cast<int16_t *>(attr) = GetInteger<int16_t>(compact_ints_offsets[i]);
+          break;
+        case sizeof(int32_t):
+          *reinterpret_cast<int32_t *>(attr) = GetInteger<int32_t>(compact_ints_offsets[i]);
+          break;
+        case sizeof(int64_t):
+          *reinterpret_cast<int64_t *>(attr) = GetInteger<int64_t>(compact_ints_offsets[i]);
+          break;
+        default:
+          throw std::runtime_error("Invalid attribute size.");
+      }
+    }
+  }
+
  private:
   byte key_data_[KeySize];
 
@@ -0,0 +1,665 @@
+#pragma once
+
+#include <emmintrin.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#include "common/constants.h"
+#include "common/macros.h"
+#include "common/optimistic_latch.h"
+#include "common/spin_latch.h"
+#include "storage/index/epoch_manager.h"
+
+namespace noisepage::storage::index {
+
+/**
+ * Concurrent hash multimap, laid out like a Swiss table: open addressing over groups of 16 slots, where every slot has
+ * a control byte that is either empty, deleted (a tombstone), or holds 7 bits of the hash of the key in the slot.
+ *
+ * Probe: A key hashes to a home group, and its probe sequence visits the groups after that one in triangular steps.
+ * At every group, the tag of the key is compared against all 16 control bytes at once with SSE2, and only the slots
+ * whose tags match compare their keys. A probe ends at the first group with an empty slot, since an insert would have
+ * taken that slot instead of moving on.
+ *
+ * Values: The first INLINE_VALUES values of a key live in its slot, so that unique keys and keys with few duplicates
+ * allocate nothing. Further values live in a list of fixed-size chunks, newest chunk first. Values are appended to
+ * the newest chunk, and a deleted value is replaced by the last one, so that a key with many values takes one chunk
+ * allocation per CHUNK_SIZE values instead of a node per value.
+ *
+ * Read: Lookups do not latch. They read the version of every group that they visit, and redo the group if a writer
+ * held it in the meantime (see common::OptimisticLatch).
+ *
+ * Write: Writers of the same key are serialized by the write latch of the home group of the key, which keeps the
+ * decision whether the key exists stable. They latch the groups on the probe sequence shared while looking, and latch
+ * the group that they change exclusively. Since readers do not latch, chunks and tables that writers unlink are retired
+ * to an EpochManager instead of being freed.
+ *
+ * Resize: Once the slots in use (keys and tombstones) exceed MAX_LOAD_FACTOR of the table, a new table is allocated
+ * and the groups of the old table move over incrementally. Every writer first moves the groups on the probe sequence
+ * of its own key and then MIGRATION_BATCH_SIZE more, so that no writer ever waits for the whole table. Until the last
+ * group has moved, lookups look in the old table first and then in the new one, skipping the contents of groups that
+ * moved. Keys keep their chunks when they move.
+ *
+ * @tparam KeyType type of the keys
+ * @tparam ValueType type of the values, which lookups copy without latching
+ * @tparam KeyHash hashes keys
+ * @tparam KeyEqualityChecker compares keys for equality
+ * @tparam ValueEqualityChecker compares values for equality
+ */
+template <typename KeyType, typename ValueType, typename KeyHash = std::hash<KeyType>,
+          typename KeyEqualityChecker = std::equal_to<KeyType>,
+          typename ValueEqualityChecker = std::equal_to<ValueType>>
+class ConcurrentHashMap {
+  static_assert(std::is_trivially_copyable_v<ValueType>, "Lookups copy values while writers may change them.");
+
+  /** Number of slots in a group, i.e., the number of control bytes in an SSE2 register */
+  static constexpr uint32_t GROUP_SIZE = 16;
+  /** Number of groups of a new map */
+  static constexpr uint64_t INITIAL_NUM_GROUPS = 16;
+  /** Fraction of the slots of a table that may be in use, by keys or tombstones, before the table grows */
+  static constexpr double MAX_LOAD_FACTOR = 0.875;
+  /** Number of groups that every writer moves to the new table while a resize is running, besides its own */
+  static constexpr uint32_t MIGRATION_BATCH_SIZE = 8;
+  /** Number of values of a key that are stored in its slot */
+  static constexpr uint32_t INLINE_VALUES = 3;
+  /** Number of values in an overflow chunk */
+  static constexpr uint32_t CHUNK_SIZE = 31;
+  /** Number of keys whose lookups FindValuesBatch() prefetches before it starts them */
+  static constexpr uint32_t BATCH_LOOKUP_GROUP_SIZE = 16;
+
+  /** Control byte of a slot that was never used since the group was cleared, which ends every probe */
+  static constexpr int8_t EMPTY = -128;
+  /** Control byte of a slot whose key was deleted, which probes pass */
+  static constexpr int8_t DELETED = -2;
+
+  /** Outcome of a single attempt at an operation */
+  enum class Outcome : uint8_t { SUCCESS, FAILURE, RESTART, FULL };
+
+  /** Values of a key beyond the inline ones */
+  struct ValueChunk {
+    std::array<ValueType, CHUNK_SIZE> values_;
+    ValueChunk *next_;  // older, full chunk
+  };
+
+  /** A key and its values */
+  struct Entry {
+    KeyType key_;
+    uint64_t hash_;
+    uint32_t num_values_;
+    std::array<ValueType, INLINE_VALUES> inline_values_;
+    ValueChunk *overflow_;  // newest chunk, holding the last values
+  };
+
+  /** Slots that share a word of control bytes, and the latches of the slots */
+  struct alignas(common::Constants::CACHELINE_SIZE) Group {
+    Group() { ctrl_.fill(EMPTY); }
+
+    common::OptimisticLatch latch_;     // latches the slots of the group
+    common::SpinLatch write_latch_;     // serializes the writers of keys whose probe sequence starts at this group
+    std::atomic<bool> migrated_{false};  // whether the slots moved to the next table, set under latch_
+    alignas(16) std::array<int8_t, GROUP_SIZE> ctrl_;
+    std::array<Entry, GROUP_SIZE> entries_;
+  };
+
+  /** Array of groups, along with the state of its migration to the next table */
+  struct Table {
+    explicit Table(const uint64_t num_groups) : groups_(new Group[num_groups]), mask_(num_groups - 1) {}
+
+    ~Table() { delete[] groups_; }
+
+    DISALLOW_COPY_AND_MOVE(Table)
+
+    Group *const groups_;
+    const uint64_t mask_;                      // number of groups - 1, which is a power of two - 1
+    std::atomic<uint64_t> num_used_{0};        // slots that are not empty
+    std::atomic<Table *> next_{nullptr};       // table that the groups move to once set
+    std::atomic<uint64_t> migration_cursor_{0};  // next group that MigrateBatch() claims
+    std::atomic<uint64_t> num_migrated_{0};    // groups that moved
+  };
+
+  /** Position of a key */
+  struct SlotRef {
+    Group *group_ = nullptr;
+    uint32_t slot_ = 0;
+  };
+
+ public:
+  ConcurrentHashMap() : table_(NewTable(INITIAL_NUM_GROUPS)) {}
+
+  /**
+   * Frees all tables and chunks. No other thread may access the map at this point.
+   */
+  ~ConcurrentHashMap() {
+    Table *const table = table_.load();
+    Table *const next = table->next_.load();
+    FreeTable(table);
+    if (next != nullptr) FreeTable(next);
+  }
+
+  DISALLOW_COPY_AND_MOVE(ConcurrentHashMap)
+
+  /**
+   * Insert a value for a key. This does not look for the value among the values of the key, so the caller must never
+   * insert a value that the key already has.
+   * @param key key
+   * @param value value
+   */
+  void Insert(const KeyType &key, const ValueType &value) {
+    const bool UNUSED_ATTRIBUTE result = InsertValue(key, value, nullptr);
+    NOISEPAGE_ASSERT(result, "Insert without a predicate can't fail.");
+  }
+
+  /**
+   * Insert a value for a key, unless the predicate holds for one of its values.
+   * @param key key
+   * @param value value
+   * @param predicate checked against the existing values of the key, under the latch of the group that holds the key
+   * @return true if the value was inserted
+   */
+  bool InsertUnique(const KeyType &key, const ValueType &value,
+                    const std::function<bool(const ValueType)> &predicate) {
+    return InsertValue(key, value, &predicate);
+  }
+
+  /**
+   * Delete a value of a key. The key is removed along with its last value.
+   * @param key key
+   * @param value value
+   * @return true if the value was found and deleted
+   */
+  bool Delete(const KeyType &key, const ValueType &value) {
+    const uint64_t hash = key_hasher_(key);
+    EpochManager::Guard guard(&epoch_manager_);
+    while (true) {
+      Table *const table = WritableTable(hash);
+      const Outcome outcome = TryDelete(table, key, hash, value);
+      if (outcome != Outcome::RESTART) return outcome == Outcome::SUCCESS;
+    }
+  }
+
+  /**
+   * Find the values of a key. This does not latch.
+   * @param key key
+   * @param[out] values the values of the key are appended to this
+   */
+  void FindValues(const KeyType &key, std::vector<ValueType> *const values) {
+    const uint64_t hash = key_hasher_(key);
+    EpochManager::Guard guard(&epoch_manager_);
+    FindInTables(key, hash, values);
+  }
+
+  /**
+   * Find the values of a batch of keys, like FindValues() for every key. This does not latch. The home groups of a
+   * group of keys are prefetched before any of their lookups starts, so that the cache misses of the group overlap.
+   * @param keys keys
+   * @param num_keys number of keys
+   * @param[out] values array of num_keys vectors, the values of every key are appended to the vector of the key
+   */
+  void FindValuesBatch(const KeyType *const keys, const uint32_t num_keys, std::vector<ValueType> *const values) {
+    std::array<uint64_t, BATCH_LOOKUP_GROUP_SIZE> hashes;
+    EpochManager::Guard guard(&epoch_manager_);
+    for (uint32_t group_begin = 0; group_begin < num_keys; group_begin += BATCH_LOOKUP_GROUP_SIZE) {
+      const uint32_t group_size = std::min(BATCH_LOOKUP_GROUP_SIZE, num_keys - group_begin);
+      const Table *const table = table_.load();
+      for (uint32_t i = 0; i < group_size; i++) {
+        hashes[i] = key_hasher_(keys[group_begin + i]);
+        __builtin_prefetch(&table->groups_[HomeGroup(*table, hashes[i])]);
+      }
+      for (uint32_t i = 0; i < group_size; i++) {
+        FindInTables(keys[group_begin + i], hashes[i], &values[group_begin + i]);
+      }
+    }
+  }
+
+  /**
+   * Finish a running resize, and free the retired chunks and tables that no reader can see anymore.
+   */
+  void PerformGarbageCollection() {
+    {
+      EpochManager::Guard guard(&epoch_manager_);
+      Table *const table = table_.load();
+      if (table->next_.load() != nullptr) FinishMigration(table);
+    }
+    epoch_manager_.Reclaim();
+  }
+
+  /**
+   * Replace the table of an empty map by one that holds the given number of keys without resizing, e.g., before a bulk
+   * load. Does nothing if the map has keys or is resizing. Must not be called concurrently with writers.
+   * @param num_keys number of keys that the map is about to get
+   */
+  void Reserve(const uint64_t num_keys) {
+    Table *const table = table_.load();
+    if (num_keys_ != 0 || table->next_.load() != nullptr) return;
+    uint64_t num_groups = table->mask_ + 1;
+    while (static_cast<double>(num_groups * GROUP_SIZE) * MAX_LOAD_FACTOR < static_cast<double>(num_keys)) {
+      num_groups *= 2;
+    }
+    if (num_groups == table->mask_ + 1) return;
+    EpochManager::Guard guard(&epoch_manager_);
+    table_ = NewTable(num_groups);
+    // The old table only has tombstones left, but lookups may still be probing it
+    RetireTable(table);
+  }
+
+  /** @return number of keys in the map */
+  uint64_t GetSize() const { return num_keys_; }
+
+  /** @return number of bytes that the tables and chunks of the map take on the heap */
+  size_t EstimateHeapUsage() const { return heap_usage_; }
+
+ private:
+  static int8_t Tag(const uint64_t hash) { return static_cast<int8_t>(hash & 0x7FU); }
+
+  static uint64_t HomeGroup(const Table &table, const uint64_t hash) { return (hash >> 7U) & table.mask_; }
+
+  static __m128i LoadControl(const Group &group) {
+    return _mm_load_si128(reinterpret_cast<const __m128i *>(group.ctrl_.data()));
+  }
+
+  /** @return bit mask of the slots whose control byte equals the given one */
+  static uint32_t MatchByte(const Group &group, const int8_t byte) {
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(LoadControl(group), _mm_set1_epi8(byte))));
+  }
+
+  /** @return bit mask of the slots that are empty */
+  static uint32_t MatchEmpty(const Group &group) { return MatchByte(group, EMPTY); }
+
+  /** @return bit mask of the slots that are empty or deleted, whose control bytes are the negative ones */
+  static uint32_t MatchFree(const Group &group) {
+    return static_cast<uint32_t>(_mm_movemask_epi8(LoadControl(group)));
+  }
+
+  /** @return bit mask of the slots that hold keys */
+  static uint32_t MatchFull(const Group &group) { return ~MatchFree(group) & ((1U << GROUP_SIZE) - 1); }
+
+  static uint32_t LowestSlot(const uint32_t mask) { return static_cast<uint32_t>(__builtin_ctz(mask)); }
+
+  static uint64_t TableSize(const Table &table) { return sizeof(Table) + (table.mask_ + 1) * sizeof(Group); }
+
+  static uint64_t MaxUsed(const Table &table) {
+    return static_cast<uint64_t>(static_cast<double>((table.mask_ + 1) * GROUP_SIZE) * MAX_LOAD_FACTOR);
+  }
+
+  Table *NewTable(const uint64_t num_groups) {
+    auto *const table = new Table(num_groups);
+    heap_usage_ += TableSize(*table);
+    return table;
+  }
+
+  /** Free a table and the chunks of the keys that did not move out of it */
+  void FreeTable(Table *const table) {
+    for (uint64_t i = 0; i <= table->mask_; i++) {
+      const Group &group = table->groups_[i];
+      if (group.migrated_.load()) continue;
+      for (uint32_t full = MatchFull(group); full != 0; full &= full - 1) {
+        for (ValueChunk *chunk = group.entries_[LowestSlot(full)].overflow_; chunk != nullptr;) {
+          ValueChunk *const next = chunk->next_;
+          delete chunk;
+          chunk = next;
+        }
+      }
+    }
+    heap_usage_ -= TableSize(*table);
+    delete table;
+  }
+
+  /** Retire a table whose keys all moved to the next table */
+  void RetireTable(Table *const table) {
+    heap_usage_ -= TableSize(*table);
+    epoch_manager_.Retire(table);
+  }
+
+  /** @return slot of the key in the group, or -1 */
+  int32_t FindKey(const Group &group, const KeyType &key, const uint64_t hash) const {
+    for (uint32_t match = MatchByte(group, Tag(hash)); match != 0; match &= match - 1) {
+      const uint32_t slot = LowestSlot(match);
+      const Entry &entry = group.entries_[slot];
+      if (entry.hash_ == hash && key_equal_(entry.key_, key)) return static_cast<int32_t>(slot);
+    }
+    return -1;
+  }
+
+  /**
+   * Copy the values of a key, which a writer may change at the same time.
+   * @return false if the values were changed in a way that the caller must detect by validating the group
+   */
+  static bool CopyValues(const Entry &entry, std::vector<ValueType> *const values) {
+    const uint32_t num_values = entry.num_values_;
+    const ValueChunk *chunk = entry.overflow_;
+    const uint32_t num_inline = std::min(num_values, INLINE_VALUES);
+    values->insert(values->end(), entry.inline_values_.begin(), entry.inline_values_.begin() + num_inline);
+    if (num_values <= INLINE_VALUES) return true;
+    uint32_t remaining = num_values - INLINE_VALUES;
+    uint32_t num_in_chunk = (remaining - 1) % CHUNK_SIZE + 1;
+    while (remaining > 0) {
+      if (chunk == nullptr) return false;
+      values->insert(values->end(), chunk->values_.begin(), chunk->values_.begin() + num_in_chunk);
+      remaining -= num_in_chunk;
+      chunk = chunk->next_;
+      num_in_chunk = CHUNK_SIZE;
+    }
+    return true;
+  }
+
+  /** @return whether the predicate holds for one of the values of the key. The caller latches the group. */
+  static bool AnyValue(const Entry &entry, const std::function<bool(const ValueType)> &predicate) {
+    const uint32_t num_inline = std::min(entry.num_values_, INLINE_VALUES);
+    if (std::any_of(entry.inline_values_.begin(), entry.inline_values_.begin() + num_inline, predicate)) return true;
+    if (entry.num_values_ <= INLINE_VALUES) return false;
+    uint32_t num_in_chunk = (entry.num_values_ - INLINE_VALUES - 1) % CHUNK_SIZE + 1;
+    for (const ValueChunk *chunk = entry.overflow_; chunk != nullptr; chunk = chunk->next_) {
+      if (std::any_of(chunk->values_.begin(), chunk->values_.begin() + num_in_chunk, predicate)) return true;
+      num_in_chunk = CHUNK_SIZE;
+    }
+    return false;
+  }
+
+  /** Append a value to the values of a key. The caller latches the group. */
+  void AppendValue(Entry *const entry, const ValueType &value) {
+    const uint32_t index = entry->num_values_;
+    if (index < INLINE_VALUES) {
+      entry->inline_values_[index] = value;
+    } else {
+      const uint32_t offset = (index - INLINE_VALUES) % CHUNK_SIZE;
+      if (offset == 0) {
+        auto *const chunk = new ValueChunk;
+        chunk->next_ = entry->overflow_;
+        heap_usage_ += sizeof(ValueChunk);
+        chunk->values_[0] = value;
+        entry->overflow_ = chunk;
+      } else {
+        entry->overflow_->values_[offset] = value;
+      }
+    }
+    entry->num_values_ = index + 1;
+  }
+
+  /**
+   * Remove a value from the values of a key by replacing it with the last value. The caller latches the group.
+   * @return true if the key had the value
+   */
+  bool RemoveValue(Entry *const entry, const ValueType &value) {
+    const uint32_t num_values = entry->num_values_;
+    ValueType *last = nullptr;
+    ValueType *found = nullptr;
+    if (num_values > INLINE_VALUES) {
+      // Look in the newest chunk first, where the values of aborted inserts are
+      uint32_t num_in_chunk = (num_values - INLINE_VALUES - 1) % CHUNK_SIZE + 1;
+      last = &entry->overflow_->values_[num_in_chunk - 1];
+      for (ValueChunk *chunk = entry->overflow_; chunk != nullptr && found == nullptr; chunk = chunk->next_) {
+        found = FindValue(chunk->values_.data(), num_in_chunk, value);
+        num_in_chunk = CHUNK_SIZE;
+      }
+    } else {
+      last = &entry->inline_values_[num_values - 1];
+    }
+    if (found == nullptr) found = FindValue(entry->inline_values_.data(), std::min(num_values, INLINE_VALUES), value);
+    if (found == nullptr) return false;
+
+    *found = *last;
+    entry->num_values_ = num_values - 1;
+    if (num_values > INLINE_VALUES && (num_values - 1 - INLINE_VALUES) % CHUNK_SIZE == 0) {
+      // The last value was the only one in the newest chunk
+      ValueChunk *const chunk = entry->overflow_;
+      entry->overflow_ = chunk->next_;
+      heap_usage_ -= sizeof(ValueChunk);
+      epoch_manager_.Retire(chunk);
+    }
+    return true;
+  }
+
+  ValueType *FindValue(ValueType *const values, const uint32_t num_values, const ValueType &value) const {
+    ValueType *const end = values + num_values;
+    ValueType *const found =
+        std::find_if(values, end, [&](const ValueType &existing) { return value_equal_(existing, value); });
+    return found == end ? nullptr : found;
+  }
+
+  /** Look for a key in the tables, starting at the current one, until a table has the key */
+  void FindInTables(const KeyType &key, const uint64_t hash, std::vector<ValueType> *const values) const {
+    for (const Table *table = table_.load(); table != nullptr; table = table->next_.load()) {
+      if (FindInTable(*table, key, hash, values)) return;
+    }
+  }
+
+  /** @return true if the table has the key, whose values were appended */
+  bool FindInTable(const Table &table, const KeyType &key, const uint64_t hash,
+                   std::vector<ValueType> *const values) const {
+    uint64_t group_index = HomeGroup(table, hash);
+    for (uint64_t step = 1; step <= table.mask_ + 1; group_index = (group_index + step++) & table.mask_) {
+      const Group &group = table.groups_[group_index];
+      while (true) {
+        const uint64_t version = group.latch_.ReadVersion();
+        const size_t num_values = values->size();
+        // The slots of a group that moved are stale, but its control bytes still end the probe sequence
+        const int32_t slot = group.migrated_.load(std::memory_order_relaxed) ? -1 : FindKey(group, key, hash);
+        const bool copied = slot < 0 || CopyValues(group.entries_[slot], values);
+        const bool last = MatchEmpty(group) != 0;
+        if (copied && group.latch_.Validate(version)) {
+          if (slot >= 0) return true;
+          if (last) return false;
+          break;
+        }
+        values->erase(values->begin() + num_values, values->end());
+      }
+    }
+    return false;
+  }
+
+  /**
+   * Look for a key along its probe sequence, latching one group at a time. The caller holds the write latch of the
+   * home group of the key, so the answer stays valid, but any free slot may be taken by the time the caller latches it.
+   * @param[out] found position of the key, if any
+   * @param[out] free_group first group with a free slot on the probe sequence, if any
+   * @return RESTART if a group on the probe sequence moved to the next table
+   */
+  Outcome FindSlot(Table *const table, const KeyType &key, const uint64_t hash, SlotRef *const found,
+                   Group **const free_group) const {
+    uint64_t group_index = HomeGroup(*table, hash);
+    for (uint64_t step = 1; step <= table->mask_ + 1; group_index = (group_index + step++) & table->mask_) {
+      Group *const group = &table->groups_[group_index];
+      group->latch_.LockShared();
+      if (group->migrated_.load(std::memory_order_relaxed)) {
+        group->latch_.UnlockShared();
+        return Outcome::RESTART;
+      }
+      const int32_t slot = FindKey(*group, key, hash);
+      if (slot >= 0) {
+        *found = {group, static_cast<uint32_t>(slot)};
+        group->latch_.UnlockShared();
+        return Outcome::SUCCESS;
+      }
+      if (*free_group == nullptr && MatchFree(*group) != 0) *free_group = group;
+      const bool last = MatchEmpty(*group) != 0;
+      group->latch_.UnlockShared();
+      if (last) break;
+    }
+    return Outcome::SUCCESS;
+  }
+
+  bool InsertValue(const KeyType &key, const ValueType &value,
+                   const std::function<bool(const ValueType)> *const predicate) {
+    const uint64_t hash = key_hasher_(key);
+    EpochManager::Guard guard(&epoch_manager_);
+    while (true) {
+      Table *const table = WritableTable(hash);
+      const Outcome outcome = TryInsert(table, key, hash, value, predicate);
+      if (outcome == Outcome::FULL) Grow(table);
+      if (outcome == Outcome::RESTART || outcome == Outcome::FULL) continue;
+      if (table->num_used_.load() > MaxUsed(*table)) Grow(table);
+      return outcome == Outcome::SUCCESS;
+    }
+  }
+
+  Outcome TryInsert(Table *const table, const KeyType &key, const uint64_t hash, const ValueType &value,
+                    const std::function<bool(const ValueType)> *const predicate) {
+    common::SpinLatch::ScopedSpinLatch write_guard(&table->groups_[HomeGroup(*table, hash)].write_latch_);
+    SlotRef found;
+    Group *free_group = nullptr;
+    if (FindSlot(table, key, hash, &found, &free_group) == Outcome::RESTART) return Outcome::RESTART;
+
+    if (found.group_ != nullptr) {
+      Group *const group = found.group_;
+      group->latch_.LockExclusive();
+      if (group->migrated_.load(std::memory_order_relaxed)) {
+        group->latch_.UnlockExclusive();
+        return Outcome::RESTART;
+      }
+      Entry *const entry = &group->entries_[found.slot_];
+      const bool conflict = predicate != nullptr && AnyValue(*entry, *predicate);
+      if (!conflict) AppendValue(entry, value);
+      group->latch_.UnlockExclusive();
+      return conflict ? Outcome::FAILURE : Outcome::SUCCESS;
+    }
+
+    if (free_group == nullptr) return Outcome::FULL;
+    Group *const group = free_group;
+    group->latch_.LockExclusive();
+    const uint32_t free_slots = MatchFree(*group);
+    if (group->migrated_.load(std::memory_order_relaxed) || free_slots == 0) {
+      group->latch_.UnlockExclusive();
+      return Outcome::RESTART;
+    }
+    const uint32_t slot = LowestSlot(free_slots);
+    Entry *const entry = &group->entries_[slot];
+    entry->key_ = key;
+    entry->hash_ = hash;
+    entry->num_values_ = 0;
+    entry->overflow_ = nullptr;
+    AppendValue(entry, value);
+    if (group->ctrl_[slot] == EMPTY) table->num_used_++;
+    group->ctrl_[slot] = Tag(hash);
+    group->latch_.UnlockExclusive();
+    num_keys_++;
+    return Outcome::SUCCESS;
+  }
+
+  Outcome TryDelete(Table *const table, const KeyType &key, const uint64_t hash, const ValueType &value) {
+    common::SpinLatch::ScopedSpinLatch write_guard(&table->groups_[HomeGroup(*table, hash)].write_latch_);
+    SlotRef found;
+    Group *free_group = nullptr;
+    if (FindSlot(table, key, hash, &found, &free_group) == Outcome::RESTART) return Outcome::RESTART;
+    if (found.group_ == nullptr) return Outcome::FAILURE;
+
+    Group *const group = found.group_;
+    group->latch_.LockExclusive();
+    if (group->migrated_.load(std::memory_order_relaxed)) {
+      group->latch_.UnlockExclusive();
+      return Outcome::RESTART;
+    }
+    Entry *const entry = &group->entries_[found.slot_];
+    const bool removed = RemoveValue(entry, value);
+    if (removed && entry->num_values_ == 0) {
+      // No probe sequence passes a group with an empty slot, so the slot can become empty again instead of a tombstone
+      if (MatchEmpty(*group) != 0) {
+        group->ctrl_[found.slot_] = EMPTY;
+        table->num_used_--;
+      } else {
+        group->ctrl_[found.slot_] = DELETED;
+      }
+      num_keys_--;
+    }
+    group->latch_.UnlockExclusive();
+    return removed ? Outcome::SUCCESS : Outcome::FAILURE;
+  }
+
+  /**
+   * @return the table that writers of the key change. While a resize is running, this moves the probe sequence of the
+   * key and a batch of other groups to the new table first, and returns the new table.
+   */
+  Table *WritableTable(const uint64_t hash) {
+    Table *const table = table_.load();
+    Table *const next = table->next_.load();
+    if (next == nullptr) return table;
+    uint64_t group_index = HomeGroup(*table, hash);
+    for (uint64_t step = 1; step <= table->mask_ + 1; group_index = (group_index + step++) & table->mask_) {
+      Group *const group = &table->groups_[group_index];
+      MigrateGroup(table, group);
+      // The control bytes of a group that moved don't change anymore
+      if (MatchEmpty(*group) != 0) break;
+    }
+    for (uint32_t i = 0; i < MIGRATION_BATCH_SIZE; i++) {
+      const uint64_t claimed = table->migration_cursor_++;
+      if (claimed > table->mask_) break;
+      MigrateGroup(table, &table->groups_[claimed]);
+    }
+    return next;
+  }
+
+  /** Start a resize of the table, or finish the resize that moves into the table */
+  void Grow(Table *const table) {
+    Table *const current = table_.load();
+    if (current == table) {
+      if (table->next_.load() != nullptr) return;
+      // Tombstones count towards the load too, so a table with few keys is rebuilt at the same size to drop them
+      const uint64_t num_groups = table->mask_ + 1;
+      Table *const next = NewTable(num_keys_ * 2 >= MaxUsed(*table) ? 2 * num_groups : num_groups);
+      Table *expected = nullptr;
+      if (!table->next_.compare_exchange_strong(expected, next)) FreeTable(next);
+    } else if (current->next_.load() == table) {
+      FinishMigration(current);
+    }
+  }
+
+  void FinishMigration(Table *const table) {
+    for (uint64_t i = 0; i <= table->mask_; i++) MigrateGroup(table, &table->groups_[i]);
+  }
+
+  /** Move the keys of a group to the next table, unless they moved already */
+  void MigrateGroup(Table *const table, Group *const group) {
+    if (group->migrated_.load(std::memory_order_acquire)) return;
+    group->latch_.LockExclusive();
+    if (!group->migrated_.load(std::memory_order_relaxed)) {
+      Table *const next = table->next_.load();
+      for (uint32_t full = MatchFull(*group); full != 0; full &= full - 1) {
+        MoveEntry(next, group->entries_[LowestSlot(full)]);
+      }
+      group->migrated_.store(true, std::memory_order_release);
+      if (table->num_migrated_++ == table->mask_) {
+        // This was the last group, so new operations start at the next table from now on
+        table_.store(next);
+        RetireTable(table);
+      }
+    }
+    group->latch_.UnlockExclusive();
+  }
+
+  /**
+   * Insert a key that moves from the previous table. No writer changes the key in the meantime: writers move the probe
+   * sequence of their key first, which waits for the latch of the group that the key moves out of.
+   */
+  void MoveEntry(Table *const table, const Entry &entry) {
+    uint64_t group_index = HomeGroup(*table, entry.hash_);
+    for (uint64_t step = 1; step <= table->mask_ + 1; group_index = (group_index + step++) & table->mask_) {
+      Group *const group = &table->groups_[group_index];
+      group->latch_.LockExclusive();
+      const uint32_t free_slots = MatchFree(*group);
+      if (free_slots != 0) {
+        const uint32_t slot = LowestSlot(free_slots);
+        group->entries_[slot] = entry;
+        if (group->ctrl_[slot] == EMPTY) table->num_used_++;
+        group->ctrl_[slot] = Tag(entry.hash_);
+        group->latch_.UnlockExclusive();
+        return;
+      }
+      group->latch_.UnlockExclusive();
+    }
+    NOISEPAGE_ASSERT(false, "The next table is at least as large as the previous one, so it can't be full.");
+  }
+
+  const KeyHash key_hasher_{};
+  const KeyEqualityChecker key_equal_{};
+  const ValueEqualityChecker value_equal_{};
+  std::atomic<uint64_t> heap_usage_{0};
+  std::atomic<Table *> table_;  // the table that new operations start at
+  std::atomic<uint64_t> num_keys_{0};
+  EpochManager epoch_manager_;
+};
+
+}  // namespace noisepage::storage::index
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "common/constants.h"
+#include "common/macros.h"
+#include "common/spin_latch.h"
+
+namespace noisepage::storage::index {
+
+/**
+ * Epoch-based memory reclamation for index structures whose readers do not latch, e.g., the optimistic read path of
+ * the B+ tree. A reader enters an epoch with a Guard before it follows any pointer into the index, and leaves it once
+ * it holds no more such pointers. A writer that unlinks an object retires it instead of freeing it, and the object is
+ * freed once every reader that could still see it has left.
+ *
+ * Readers announce themselves in one of a fixed number of slots, picked per thread, so that they do not all write to
+ * the same cache line. The global epoch only advances once no reader of the epoch before the current one is left.
+ * Thus, an object that was retired in epoch e cannot be seen by anyone once the global epoch reaches e + 2.
+ */
+class EpochManager {
+ public:
+  /** Number of slots that readers and retired objects are spread over */
+  static constexpr uint32_t NUM_SLOTS = 64;
+  /** Number of objects that a slot collects before retiring another one tries to free them */
+  static constexpr size_t RECLAIM_THRESHOLD = 256;
+
+  /** Frees a retired object */
+  using Deleter = void (*)(void *);
+
+ private:
+  /** An object that waits to be freed */
+  struct RetiredObject {
+    void *object_;
+    Deleter deleter_;
+    uint64_t epoch_;
+  };
+
+  /** Readers and retired objects of the threads that map to this slot */
+  struct alignas(common::Constants::CACHELINE_SIZE) Slot {
+    std::array<std::atomic<uint64_t>, 2> readers_{};  // readers per epoch parity
+    common::SpinLatch retired_latch_;
+    std::vector<RetiredObject> retired_;
+  };
+
+ public:
+  /**
+   * Keeps the objects that the calling thread can reach from being freed for as long as it is alive.
+   */
+  class Guard {
+   public:
+    /**
+     * Enter the current epoch.
+     * @param manager epoch manager of the index that is about to be read
+     */
+    explicit Guard(EpochManager *const manager) : slot_(&manager->slots_[ThreadSlot()]) {
+      // The reader only counts as part of the epoch if the epoch did not advance while it announced itself.
+      while (true) {
+        epoch_ = manager->global_epoch_.load();
+        slot_->readers_[epoch_ & 1U].fetch_add(1);
+        if (manager->global_epoch_.load() == epoch_) break;
+        slot_->readers_[epoch_ & 1U].fetch_sub(1);
+      }
+    }
+
+    /**
+     * Leave the epoch.
+     */
+    ~Guard() { slot_->readers_[epoch_ & 1U].fetch_sub(1, std::memory_order_release); }
+
+    DISALLOW_COPY_AND_MOVE(Guard)
+
+   private:
+    Slot *const slot_;
+    uint64_t epoch_;
+  };
+
+  EpochManager() : slots_(new Slot[NUM_SLOTS]) {}
+
+  /**
+   * Frees all retired objects. No reader may be left at this point.
+   */
+  ~EpochManager();
+
+  DISALLOW_COPY_AND_MOVE(EpochManager)
+
+  /**
+   * Hand over an object that was unlinked from the index, and free it once no reader can see it anymore.
+   * @param object object to free
+   * @param deleter function that frees the object
+   */
+  void Retire(void *object, Deleter deleter);
+
+  /**
+   * Hand over an object that was unlinked from the index, and delete it once no reader can see it anymore.
+   * @tparam T type of the object
+   * @param object object to delete
+   */
+  template <typename T>
+  void Retire(T *object) {
+    Retire(object, [](void *ptr) { delete static_cast<T *>(ptr); });
+  }
+
+  /**
+   * Free all retired objects that no reader can see anymore.
+   */
+  void Reclaim();
+
+  /**
+   * @return number of retired objects that have not been freed yet
+   */
+  size_t NumRetired();
+
+ private:
+  /** @return slot of the calling thread */
+  static uint32_t ThreadSlot();
+
+  /** Advance the global epoch if no reader of the previous epoch is left. */
+  void TryAdvance();
+
+  /** Free the retired objects of the slot that no reader can see anymore. */
+  void ReclaimSlot(Slot *slot);
+
+  std::atomic<uint64_t> global_epoch_ = 0;
+  // Allocated separately, so that the alignment of the slots does not carry over to the index that owns the manager.
+  const std::unique_ptr<Slot[]> slots_;
+};
+
+}  // namespace noisepage::storage::index
@@ -5,10 +5,16 @@
 #include <functional>
 #include <vector>
 
+#include "catalog/index_schema.h"
+#include "common/error/error_code.h"
+#include "common/error/exception.h"
 #include "common/hash_util.h"
+#include "portable_endian/portable_endian.h"
+#include "spdlog/fmt/fmt.h"
 #include "storage/index/index_metadata.h"
 #include "storage/projected_row.h"
 #include "storage/storage_defs.h"
+#include "type/type_util.h"
 #include "xxHash/xxh3.h"
 
 namespace noisepage::storage::index {
@@ -17,247 +23,326 @@ namespace noisepage::storage::index {
 // be increased if 512 bytes is too small for future workloads.
 constexpr uint16_t GENERICKEY_MAX_SIZE = 512;
 
+// Varlens are encoded in groups of this many bytes, each followed by a byte that tells whether the varlen continues.
+constexpr uint16_t GENERICKEY_VARLEN_GROUP_SIZE = 8;
+
+/**
+ * @param varlen_size number of bytes of a varlen
+ * @return the number of bytes that the binary-comparable form of the varlen takes in a GenericKey
+ */
+constexpr uint32_t GenericKeyVarlenSize(const uint32_t varlen_size) {
+  const uint32_t num_groups = (varlen_size + GENERICKEY_VARLEN_GROUP_SIZE - 1) / GENERICKEY_VARLEN_GROUP_SIZE;
+  return (num_groups == 0 ? 1 : num_groups) * (GENERICKEY_VARLEN_GROUP_SIZE + 1);
+}
+
+/**
+ * @param key_schema schema of the index
+ * @return the maximum number of bytes that the binary-comparable form of a GenericKey for the schema takes
+ */
+inline uint16_t GenericKeySize(const catalog::IndexSchema &key_schema) {
+  uint32_t size = 0;
+  for (const auto &key_col : key_schema.GetColumns()) {
+    // Every attribute starts with a byte that tells whether it is NULL.
+    size++;
+    switch (key_col.Type()) {
+      case type::TypeId::VARCHAR:
+      case type::TypeId::VARBINARY: {
+        // Varlens without a maximum size are sized as if they fit inline, like IndexMetadata assumes for
+        // MustInlineVarlen. Longer values are rejected by GenericKey::SetFromProjectedRow.
+        const auto max_varlen_size =
+            std::max(static_cast<uint32_t>(std::max(key_col.TypeModifier(), 0)), VarlenEntry::InlineThreshold());
+        size += GenericKeyVarlenSize(max_varlen_size);
+        break;
+      }
+      default:
+        size += type::TypeUtil::GetTypeSize(key_col.Type());
+        break;
+    }
+  }
+  return static_cast<uint16_t>(std::min(size, static_cast<uint32_t>(UINT16_MAX)));
+}
+
 /**
  * GenericKey is a slower key type than CompactIntsKey for use when the constraints of CompactIntsKey make it
  * unsuitable. For example, GenericKey supports VARLEN and NULLable attributes.
- * @tparam KeySize number of bytes for the key's internal buffer
+ *
+ * The key is stored in its binary-comparable form, i.e., comparing the forms of two keys with std::memcmp orders
+ * them the same way as comparing their attributes one by one. Every attribute starts with a byte that sorts NULL
+ * first. Integers follow in big-endian order with their sign bit flipped, and REALs with their sign bit flipped if
+ * positive and all bits flipped if negative. Varlens follow in groups of GENERICKEY_VARLEN_GROUP_SIZE bytes padded
+ * with 0x00, and every group is followed by GENERICKEY_VARLEN_GROUP_SIZE + 1 if the varlen continues, or by the number
+ * of bytes of the varlen in the group otherwise. Thus a varlen sorts before all longer varlens that it is a prefix of,
+ * and no key's form is a prefix of another key's form. Comparisons are a single std::memcmp, after comparing the first
+ * 8 bytes of the forms, which are cached as an integer.
+ * @tparam KeySize number of bytes for the key's binary-comparable form
  */
 template <uint16_t KeySize>
 class GenericKey {
  public:
   static_assert(KeySize > 0 && KeySize <= GENERICKEY_MAX_SIZE);
 
+  /** Upper bound on the number of bytes that ToBinaryComparable() writes */
+  static constexpr uint16_t BINARY_COMPARABLE_SIZE = KeySize;
+
   /**
    * Set the GenericKey's data based on a ProjectedRow and associated index metadata
    * @param from ProjectedRow to generate GenericKey representation of
    * @param metadata index information, key_schema used to interpret PR data correctly
    * @param num_attrs Number of attributes
+   * @throw ExecutionException if the binary-comparable form doesn't fit the key, e.g., for a long value of a varlen
+   * without a maximum size. Nothing has been written to the index at this point, so the operation fails cleanly.
    */
   void SetFromProjectedRow(const storage::ProjectedRow &from, const IndexMetadata &metadata, size_t num_attrs) {
     NOISEPAGE_ASSERT(from.NumColumns() == metadata.GetSchema().GetColumns().size(),
                      "ProjectedRow should have the same number of columns at the original key schema.");
-    metadata_ = &metadata;
+    const auto &key_cols = metadata.GetSchema().GetColumns();
+    NOISEPAGE_ASSERT(num_attrs > 0 && num_attrs <= key_cols.size(), "Number of attributes violates invariant");
+    NOISEPAGE_ASSERT(GenericKeySize(metadata.GetSchema()) <= KeySize, "Binary-comparable form may not fit the key.");
     std::memset(key_data_, 0, KeySize);
+    size_ = 0;
 
-    if (metadata.MustInlineVarlen()) {
-      const auto &key_schema = metadata.GetSchema();
-      const auto &inlined_attr_sizes = metadata.GetInlinedAttributeSizes();
-
-      const ProjectedRowInitializer &generic_key_initializer = metadata.GetInlinedPRInitializer();
-
-      auto *const pr = GetProjectedRow();
-      generic_key_initializer.InitializeRow(pr);
-
-      UNUSED_ATTRIBUTE const auto &key_cols = key_schema.GetColumns();
-      NOISEPAGE_ASSERT(num_attrs > 0 && num_attrs <= key_cols.size(), "Number of attributes violates invariant");
-
-      for (uint16_t i = 0; i < num_attrs; i++) {
-        const auto offset = from.ColumnIds()[i].UnderlyingValue();
-        NOISEPAGE_ASSERT(offset == pr->ColumnIds()[i].UnderlyingValue(), "PRs must have the same comparison order!");
-        const byte *const from_attr = from.AccessWithNullCheck(offset);
-        if (from_attr == nullptr) {
-          pr->SetNull(offset);
-        } else {
-          const auto inlined_attr_size = inlined_attr_sizes[i];
-          // TODO(Gus): Magic number
-          if (inlined_attr_size <= 16) {
-            std::memcpy(pr->AccessForceNotNull(offset), from_attr, inlined_attr_sizes[i]);
-          } else {
-            // Convert the VarlenEntry to be inlined
-            const auto varlen = *reinterpret_cast<const VarlenEntry *const>(from_attr);
-            byte *const to_attr = pr->AccessForceNotNull(offset);
-            const auto varlen_size = varlen.Size();
-            *reinterpret_cast<uint32_t *const>(to_attr) = varlen_size;
-            NOISEPAGE_ASSERT(reinterpret_cast<uintptr_t>(to_attr) + sizeof(uint32_t) + varlen_size <=
-                                 reinterpret_cast<uintptr_t>(this) + KeySize,
-                             "ProjectedRow will access out of bounds.");
-            std::memcpy(to_attr + sizeof(uint32_t), varlen.Content(), varlen_size);
+    for (uint16_t i = 0; i < key_cols.size(); i++) {
+      // Attributes past num_attrs are left NULL, i.e., at their minimum, if the varlens had to be inlined into the key.
+      // This matches the ProjectedRow that keys used to be stored as.
+      const byte *const attr = i < num_attrs || !metadata.MustInlineVarlen()
+                                   ? from.AccessWithNullCheck(from.ColumnIds()[i].UnderlyingValue())
+                                   : nullptr;
+      if (attr == nullptr) {
+        CheckFits(1);
+        key_data_[size_++] = static_cast<byte>(0);
+        continue;
+      }
+
+      const auto type = key_cols[i].Type();
+      CheckFits(1 + (type == type::TypeId::VARCHAR || type == type::TypeId::VARBINARY
+                         ? GenericKeyVarlenSize(reinterpret_cast<const VarlenEntry *>(attr)->Size())
+                         : type::TypeUtil::GetTypeSize(type)));
+      key_data_[size_++] = static_cast<byte>(1);
+
+      switch (type) {
+        case type::TypeId::BOOLEAN:
+        case type::TypeId::TINYINT:
+          AppendBigEndian(static_cast<uint8_t>(*reinterpret_cast<const uint8_t *>(attr) ^ 0x80U));
+          break;
+        case type::TypeId::SMALLINT:
+          AppendBigEndian(static_cast<uint16_t>(*reinterpret_cast<const uint16_t *>(attr) ^ 0x8000U));
+          break;
+        case type::TypeId::INTEGER:
+          AppendBigEndian(*reinterpret_cast<const uint32_t *>(attr) ^ 0x80000000U);
+          break;
+        case type::TypeId::DATE:
+          AppendBigEndian(*reinterpret_cast<const uint32_t *>(attr));
+          break;
+        case type::TypeId::BIGINT:
+          AppendBigEndian(*reinterpret_cast<const uint64_t *>(attr) ^ (uint64_t{1} << 63U));
+          break;
+        case type::TypeId::TIMESTAMP:
+          AppendBigEndian(*reinterpret_cast<const uint64_t *>(attr));
+          break;
+        case type::TypeId::REAL: {
+          double value = *reinterpret_cast<const double *>(attr);
+          // -0.0 and 0.0 are equal, so they must have the same form.
+          if (value == 0.0) value = 0.0;
+          uint64_t bits;
+          std::memcpy(&bits, &value, sizeof(bits));
+          bits = (bits >> 63U) != 0 ? ~bits : bits | (uint64_t{1} << 63U);
+          AppendBigEndian(bits);
+          break;
+        }
+        case type::TypeId::VARCHAR:
+        case type::TypeId::VARBINARY: {
+          const auto &varlen = *reinterpret_cast<const VarlenEntry *>(attr);
+          const byte *content = varlen.Content();
+          uint32_t remaining = varlen.Size();
+          // The key was zeroed, which pads the last group. CheckFits() made sure that every group fits.
+          while (true) {
+            const auto group_size = std::min(remaining, static_cast<uint32_t>(GENERICKEY_VARLEN_GROUP_SIZE));
+            std::memcpy(key_data_ + size_, content, group_size);
+            size_ = static_cast<uint16_t>(size_ + GENERICKEY_VARLEN_GROUP_SIZE);
+            content += group_size;
+            remaining -= group_size;
+            if (remaining == 0) {
+              key_data_[size_++] = static_cast<byte>(group_size);
+              break;
+            }
+            key_data_[size_++] = static_cast<byte>(GENERICKEY_VARLEN_GROUP_SIZE + 1);
           }
+          break;
         }
+        default:
+          throw std::runtime_error("Unknown TypeId in noisepage::storage::index::GenericKey::SetFromProjectedRow.");
       }
-    } else {
-      NOISEPAGE_ASSERT(
-          reinterpret_cast<uintptr_t>(GetProjectedRow()) + from.Size() <= reinterpret_cast<uintptr_t>(this) + KeySize,
-          "ProjectedRow will access out of bounds.");
-      // We recast GetProjectedRow() as a workaround for -Wclass-memaccess
-      std::memcpy(static_cast<void *>(GetProjectedRow()), &from, from.Size());
     }
-  }
 
-  /**
-   * @return Aligned pointer to the key's internal ProjectedRow, exposed for hasher and comparators
-   */
-  const ProjectedRow *GetProjectedRow() const {
-    const auto *pr = reinterpret_cast<const ProjectedRow *>(StorageUtil::AlignedPtr(sizeof(uint64_t), key_data_));
-    NOISEPAGE_ASSERT(reinterpret_cast<uintptr_t>(pr) % sizeof(uint64_t) == 0,
-                     "ProjectedRow must be aligned to 8 bytes for atomicity guarantees.");
-    NOISEPAGE_ASSERT(reinterpret_cast<uintptr_t>(pr) + pr->Size() <= reinterpret_cast<uintptr_t>(this) + KeySize,
-                     "ProjectedRow will access out of bounds.");
-    return pr;
+    uint64_t prefix;
+    std::memcpy(&prefix, key_data_, sizeof(prefix));
+    prefix_ = be64toh(prefix);
   }
 
   /**
-   * @return metadata of the index for this key, exposed for hasher and comparators
+   * Write the attributes of the key into a ProjectedRow, i.e., the inverse of SetFromProjectedRow(). Since -0.0 and 0.0
+   * have the same form, REALs that were -0.0 come back as 0.0.
+   * @param metadata index information, key_schema used to interpret the key
+   * @param[out] to ProjectedRow with the layout of the ProjectedRows that keys are set from
+   * @param varlen_buffer buffer of at least KeySize bytes for the contents of varlens that are too long to be inlined
+   * into their VarlenEntry. The VarlenEntries point into the buffer, and are valid until it is overwritten.
    */
-  const IndexMetadata &GetIndexMetadata() const {
-    NOISEPAGE_ASSERT(metadata_ != nullptr, "This key has no metadata.");
-    return *metadata_;
-  }
+  void ToProjectedRow(const IndexMetadata &metadata, storage::ProjectedRow *const to, byte *varlen_buffer) const {
+    const auto &key_cols = metadata.GetSchema().GetColumns();
+    NOISEPAGE_ASSERT(to->NumColumns() == key_cols.size(), "ProjectedRow should have the same number of columns.");
+    uint16_t offset = 0;
 
-  /**
-   * Utility class to evaluate comparisons of embedded types within a ProjectedRow. This is not exposed somewhere like
-   * type/type_util.h becauase these do not enforce SQL comparison semantics (i.e. NULL comparisons evaluate to NULL).
-   * These comparisons are merely for ordering semantics. If it makes sense for this to be moved somewhere more general
-   * purpose in the future, feel free to do so, but for now the only use is in GenericKey and I don't want to encourage
-   * their misuse elsewhere in the system.
-   */
-  struct TypeComparators {
-    TypeComparators() = delete;
-
-    /**
-     * @param lhs_attr first VarlenEntry to be compared
-     * @param rhs_attr second VarlenEntry to be compared
-     * @return std::memcmp semantics: < 0 means first is less than second, 0 means equal, > 0 means first is greater
-     * than second
-     */
-    static int CompareVarlens(const byte *const lhs_attr, const byte *const rhs_attr) {
-      const uint32_t lhs_size = *reinterpret_cast<const uint32_t *const>(lhs_attr);
-      const uint32_t rhs_size = *reinterpret_cast<const uint32_t *const>(rhs_attr);
-      const auto smallest_size = std::min(lhs_size, rhs_size);
-
-      // get the pointers to the content
-      const byte *const lhs_content = lhs_attr + sizeof(uint32_t);
-      const byte *const rhs_content = rhs_attr + sizeof(uint32_t);
-      auto result = std::memcmp(lhs_content, rhs_content, smallest_size);
-      if (result == 0 && lhs_size != rhs_size) {
-        // strings compared as equal, but they have different lengths. Decide based on length
-        result = lhs_size - rhs_size;
+    for (uint16_t i = 0; i < key_cols.size(); i++) {
+      const uint16_t projection_list_offset = to->ColumnIds()[i].UnderlyingValue();
+      if (key_data_[offset++] == static_cast<byte>(0)) {
+        to->SetNull(projection_list_offset);
+        continue;
+      }
+      byte *const attr = to->AccessForceNotNull(projection_list_offset);
+
+      switch (key_cols[i].Type()) {
+        case type::TypeId::BOOLEAN:
+        case type::TypeId::TINYINT:
+          *reinterpret_cast<uint8_t *>(attr) = static_cast<uint8_t>(ReadBigEndian<uint8_t>(&offset) ^ 0x80U);
+          break;
+        case type::TypeId::SMALLINT:
+          *reinterpret_cast<uint16_t *>(attr) = static_cast<uint16_t>(ReadBigEndian<uint16_t>(&offset) ^ 0x8000U);
+          break;
+        case type::TypeId::INTEGER:
+          *reinterpret_cast<uint32_t *>(attr) = ReadBigEndian<uint32_t>(&offset) ^ 0x80000000U;
+          break;
+        case type::TypeId::DATE:
+          *reinterpret_cast<uint32_t *>(attr) = ReadBigEndian<uint32_t>(&offset);
+          break;
+        case type::TypeId::BIGINT:
+          *reinterpret_cast<uint64_t *>(attr) = ReadBigEndian<uint64_t>(&offset) ^ (uint64_t{1} << 63U);
+          break;
+        case type::TypeId::TIMESTAMP:
+          *reinterpret_cast<uint64_t *>(attr) = ReadBigEndian<uint64_t>(&offset);
+          break;
+        case type::TypeId::REAL: {
+          uint64_t bits = ReadBigEndian<uint64_t>(&offset);
+          bits = (bits >> 63U) != 0 ? bits & ~(uint64_t{1} << 63U) : ~bits;
+          std::memcpy(attr, &bits, sizeof(bits));
+          break;
+        }
+        case type::TypeId::VARCHAR:
+        case type::TypeId::VARBINARY: {
+          uint32_t size = 0;
+          while (true) {
+            const auto marker = static_cast<uint8_t>(key_data_[offset + GENERICKEY_VARLEN_GROUP_SIZE]);
+            const uint8_t group_size = marker > GENERICKEY_VARLEN_GROUP_SIZE ? GENERICKEY_VARLEN_GROUP_SIZE : marker;
+            std::memcpy(varlen_buffer + size, key_data_ + offset, group_size);
+            size += group_size;
+            offset = static_cast<uint16_t>(offset + GENERICKEY_VARLEN_GROUP_SIZE + 1);
+            if (marker <= GENERICKEY_VARLEN_GROUP_SIZE) break;
+          }
+          *reinterpret_cast<VarlenEntry *>(attr) = size <= VarlenEntry::InlineThreshold()
+                                                       ? VarlenEntry::CreateInline(varlen_buffer, size)
+                                                       : VarlenEntry::Create(varlen_buffer, size, false);
+          varlen_buffer += size;
+          break;
+        }
+        default:
+          throw std::runtime_error("Unknown TypeId in noisepage::storage::index::GenericKey::ToProjectedRow.");
       }
-      return result;
     }
-
-#define COMPARE_FUNC(OP)                                                                                              \
-  switch (type_id) {                                                                                                  \
-    case type::TypeId::BOOLEAN:                                                                                       \
-    case type::TypeId::TINYINT:                                                                                       \
-      return *reinterpret_cast<const int8_t *const>(lhs_attr) OP * reinterpret_cast<const int8_t *const>(rhs_attr);   \
-    case type::TypeId::SMALLINT:                                                                                      \
-      return *reinterpret_cast<const int16_t *const>(lhs_attr) OP * reinterpret_cast<const int16_t *const>(rhs_attr); \
-    case type::TypeId::INTEGER:                                                                                       \
-      return *reinterpret_cast<const int32_t *const>(lhs_attr) OP * reinterpret_cast<const int32_t *const>(rhs_attr); \
-    case type::TypeId::DATE:                                                                                          \
-      return *reinterpret_cast<const uint32_t *const>(lhs_attr) OP *                                                  \
-             reinterpret_cast<const uint32_t *const>(rhs_attr);                                                       \
-    case type::TypeId::BIGINT:                                                                                        \
-      return *reinterpret_cast<const int64_t *const>(lhs_attr) OP * reinterpret_cast<const int64_t *const>(rhs_attr); \
-    case type::TypeId::REAL:                                                                                          \
-      return *reinterpret_cast<const double *const>(lhs_attr) OP * reinterpret_cast<const double *const>(rhs_attr);   \
-    case type::TypeId::TIMESTAMP:                                                                                     \
-      return *reinterpret_cast<const uint64_t *const>(lhs_attr) OP *                                                  \
-             reinterpret_cast<const uint64_t *const>(rhs_attr);                                                       \
-    case type::TypeId::VARCHAR:                                                                                       \
-    case type::TypeId::VARBINARY: {                                                                                   \
-      return CompareVarlens(lhs_attr, rhs_attr) OP 0;                                                                 \
-    }                                                                                                                 \
-    default:                                                                                                          \
-      throw std::runtime_error("Unknown TypeId in noisepage::storage::index::GenericKey::TypeComparators.");          \
   }
 
-    /**
-     * @param type_id TypeId to interpret both pointers as
-     * @param lhs_attr first value to be compared
-     * @param rhs_attr second value to be compared
-     * @return true if first is less than second
-     */
-    static bool CompareLessThan(const type::TypeId type_id, const byte *const lhs_attr, const byte *const rhs_attr) {
-      COMPARE_FUNC(<)  // NOLINT
-    }
-
-    /**
-     * @param type_id TypeId to interpret both pointers as
-     * @param lhs_attr first value to be compared
-     * @param rhs_attr second value to be compared
-     * @return true if first is greater than second
-     */
-    static bool CompareGreaterThan(const type::TypeId type_id, const byte *const lhs_attr, const byte *const rhs_attr) {
-      COMPARE_FUNC(>)  // NOLINT
-    }
-
-    /**
-     * @param type_id TypeId to interpret both pointers as
-     * @param lhs_attr first value to be compared
-     * @param rhs_attr second value to be compared
-     * @return true if first is equal to second
-     */
-    static bool CompareEquals(const type::TypeId type_id, const byte *const lhs_attr, const byte *const rhs_attr) {
-      COMPARE_FUNC(==)
-    }
-  };
-
   /**
-   * Returns whether this key is less than another key up to num_attrs for comparison.
+   * Returns whether this key is less than or equal to another key up to num_attrs for comparison.
    * @param rhs other key to compare against
    * @param metadata IndexMetadata
    * @param num_attrs attributes to compare against
-   * @returns whether this is less than other
+   * @returns whether this is less than or equal to other
    */
-  bool PartialLessThan(const GenericKey<KeySize> &rhs, UNUSED_ATTRIBUTE const IndexMetadata *metadata,
-                       size_t num_attrs) const {
-    const auto &key_schema = GetIndexMetadata().GetSchema();
-    UNUSED_ATTRIBUTE const auto &key_cols = key_schema.GetColumns();
-    NOISEPAGE_ASSERT(num_attrs > 0 && num_attrs <= key_cols.size(), "Invalid num_attrs for generic key");
-
-    for (uint16_t i = 0; i < num_attrs; i++) {
-      const auto *const lhs_pr = GetProjectedRow();
-      const auto *const rhs_pr = rhs.GetProjectedRow();
-
-      const auto offset = lhs_pr->ColumnIds()[i].UnderlyingValue();
-      NOISEPAGE_ASSERT(lhs_pr->ColumnIds()[i] == rhs_pr->ColumnIds()[i], "Comparison orders should be the same.");
+  bool PartialLessThan(const GenericKey<KeySize> &rhs, const IndexMetadata *metadata, size_t num_attrs) const {
+    NOISEPAGE_ASSERT(num_attrs > 0 && num_attrs <= metadata->GetSchema().GetColumns().size(),
+                     "Invalid num_attrs for generic key");
+    // Since the attributes' forms are not prefixes of each other, the first difference decides.
+    const uint16_t size = std::min(PrefixSize(*metadata, num_attrs), rhs.PrefixSize(*metadata, num_attrs));
+    return std::memcmp(key_data_, rhs.key_data_, size) <= 0;
+  }
 
-      const byte *const lhs_attr = lhs_pr->AccessWithNullCheck(offset);
-      const byte *const rhs_attr = rhs_pr->AccessWithNullCheck(offset);
+  /**
+   * Write the binary-comparable form of the key, i.e., comparing the forms of two keys with std::memcmp orders the keys
+   * the same way as std::less.
+   * @param[out] buffer buffer of at least BINARY_COMPARABLE_SIZE bytes
+   * @return number of bytes written
+   */
+  uint16_t ToBinaryComparable(byte *const buffer) const {
+    std::memcpy(buffer, key_data_, size_);
+    return size_;
+  }
 
-      if (lhs_attr == nullptr) {
-        if (rhs_attr == nullptr) {
-          // attributes are both NULL (equal), continue
-          continue;
-        }
-        // lhs is NULL, rhs is non-NULL, lhs is less than
-        return true;
-      }
+  /** @return true if this key is equal to the other key */
+  bool Equals(const GenericKey<KeySize> &rhs) const {
+    return prefix_ == rhs.prefix_ && size_ == rhs.size_ && std::memcmp(key_data_, rhs.key_data_, size_) == 0;
+  }
 
-      if (rhs_attr == nullptr) {
-        // lhs is non-NULL, rhs is NULL, lhs is greater than
-        return false;
-      }
+  /** @return true if this key is less than the other key */
+  bool LessThan(const GenericKey<KeySize> &rhs) const {
+    if (prefix_ != rhs.prefix_) return prefix_ < rhs.prefix_;
+    // The first 8 bytes are equal, and the bytes past the forms are zeroed.
+    const uint16_t size = std::max(std::min(size_, rhs.size_), static_cast<uint16_t>(sizeof(prefix_)));
+    const int result = std::memcmp(key_data_ + sizeof(prefix_), rhs.key_data_ + sizeof(prefix_),
+                                   size - sizeof(prefix_));
+    return result < 0 || (result == 0 && size_ < rhs.size_);
+  }
 
-      const noisepage::type::TypeId type_id = key_schema.GetColumns()[i].Type();
+  /** @return hash of the key's binary-comparable form */
+  uint64_t Hash() const { return XXH3_64bits(key_data_, size_); }
 
-      if (noisepage::storage::index::GenericKey<KeySize>::TypeComparators::CompareLessThan(type_id, lhs_attr, rhs_attr))
-        return true;
-      if (noisepage::storage::index::GenericKey<KeySize>::TypeComparators::CompareGreaterThan(type_id, lhs_attr,
-                                                                                              rhs_attr))
-        return false;
+ private:
+  // Throw if the next num_bytes bytes of the binary-comparable form don't fit the key.
+  void CheckFits(const uint32_t num_bytes) const {
+    if (size_ + num_bytes > KeySize) {
+      throw EXECUTION_EXCEPTION(fmt::format("Index key needs at least {} bytes, which exceeds the maximum of {} bytes.",
+                                            size_ + num_bytes, KeySize),
+                                common::ErrorCode::ERRCODE_PROGRAM_LIMIT_EXCEEDED);
+    }
+  }
 
-      // attributes are equal, continue
+  template <typename UIntType>
+  void AppendBigEndian(const UIntType value) {
+    for (uint8_t i = 0; i < sizeof(UIntType); i++) {
+      key_data_[size_++] = static_cast<byte>(static_cast<uint8_t>(value >> (8U * (sizeof(UIntType) - 1 - i))));
     }
+  }
 
-    // keys are equal
-    return true;
+  template <typename UIntType>
+  UIntType ReadBigEndian(uint16_t *const offset) const {
+    UIntType value = 0;
+    for (uint8_t i = 0; i < sizeof(UIntType); i++) {
+      value = static_cast<UIntType>((value << 8U) | static_cast<uint8_t>(key_data_[(*offset)++]));
+    }
+    return value;
   }
 
- private:
-  ProjectedRow *GetProjectedRow() {
-    auto *pr = reinterpret_cast<ProjectedRow *>(StorageUtil::AlignedPtr(sizeof(uint64_t), key_data_));
-    NOISEPAGE_ASSERT(reinterpret_cast<uintptr_t>(pr) % sizeof(uint64_t) == 0,
-                     "ProjectedRow must be aligned to 8 bytes for atomicity guarantees.");
-    NOISEPAGE_ASSERT(reinterpret_cast<uintptr_t>(pr) + pr->Size() < reinterpret_cast<uintptr_t>(this) + KeySize,
-                     "ProjectedRow will access out of bounds.");
-    return pr;
+  // Number of bytes that the forms of the first num_attrs attributes take
+  uint16_t PrefixSize(const IndexMetadata &metadata, size_t num_attrs) const {
+    const auto &key_cols = metadata.GetSchema().GetColumns();
+    uint16_t size = 0;
+    for (uint16_t i = 0; i < num_attrs; i++) {
+      if (key_data_[size++] == static_cast<byte>(0)) continue;
+      switch (key_cols[i].Type()) {
+        case type::TypeId::VARCHAR:
+        case type::TypeId::VARBINARY:
+          do {
+            size = static_cast<uint16_t>(size + GENERICKEY_VARLEN_GROUP_SIZE + 1);
+          } while (key_data_[size - 1] == static_cast<byte>(GENERICKEY_VARLEN_GROUP_SIZE + 1));
+          break;
+        default:
+          size = static_cast<uint16_t>(size + type::TypeUtil::GetTypeSize(key_cols[i].Type()));
+          break;
+      }
+    }
+    return size;
   }
 
+  uint64_t prefix_ = 0;  // first 8 bytes of key_data_ in host byte order, so that most comparisons end here
+  uint16_t size_ = 0;    // number of bytes of key_data_ that the binary-comparable form takes
   byte key_data_[KeySize];
-  const IndexMetadata *metadata_ = nullptr;
 };
 
 extern template class GenericKey<64>;
@@ -270,7 +355,7 @@ namespace std {
 
 /**
  * Implements std::hash for GenericKey. Allows the class to be used with STL containers and the BwTree index.
- * @tparam KeySize number of bytes for the key's internal buffer
+ * @tparam KeySize number of bytes for the key's binary-comparable form
  */
 template <uint16_t KeySize>
 struct hash<noisepage::storage::index::GenericKey<KeySize>> {
@@ -279,34 +364,12 @@ struct hash<noisepage::storage::index::GenericKey<KeySize>> {
    * @param key key to be hashed
    * @return hash of the key's underlying data
    */
-  size_t operator()(noisepage::storage::index::GenericKey<KeySize> const &key) const {
-    const auto &metadata = key.GetIndexMetadata();
-
-    const auto &key_schema = metadata.GetSchema();
-    const auto &inlined_attr_sizes = metadata.GetInlinedAttributeSizes();
-
-    uint64_t running_hash = 0;
-
-    const auto *const pr = key.GetProjectedRow();
-
-    const auto &key_cols = key_schema.GetColumns();
-    for (uint16_t i = 0; i < key_cols.size(); i++) {
-      const auto offset = pr->ColumnIds()[i].UnderlyingValue();
-      const byte *const attr = pr->AccessWithNullCheck(offset);
-      if (attr == nullptr) {
-        continue;
-      }
-
-      running_hash = XXH3_64bits_withSeed(reinterpret_cast<const void *>(attr), inlined_attr_sizes[i], running_hash);
-    }
-
-    return running_hash;
-  }
+  size_t operator()(noisepage::storage::index::GenericKey<KeySize> const &key) const { return key.Hash(); }
 };
 
 /**
  * Implements std::equal_to for GenericKey. Allows the class to be used with containers that expect STL interface.
- * @tparam KeySize number of bytes for the key's internal buffer
+ * @tparam KeySize number of bytes for the key's binary-comparable form
  */
 template <uint16_t KeySize>
 struct equal_to<noisepage::storage::index::GenericKey<KeySize>> {
@@ -317,52 +380,13 @@ struct equal_to<noisepage::storage::index::GenericKey<KeySize>> {
    */
   bool operator()(const noisepage::storage::index::GenericKey<KeySize> &lhs,
                   const noisepage::storage::index::GenericKey<KeySize> &rhs) const {
-    const auto &key_schema = lhs.GetIndexMetadata().GetSchema();
-
-    const auto &key_cols = key_schema.GetColumns();
-    for (uint16_t i = 0; i < key_cols.size(); i++) {
-      const auto *const lhs_pr = lhs.GetProjectedRow();
-      const auto *const rhs_pr = rhs.GetProjectedRow();
-
-      const auto offset = lhs_pr->ColumnIds()[i].UnderlyingValue();
-      NOISEPAGE_ASSERT(lhs_pr->ColumnIds()[i] == rhs_pr->ColumnIds()[i], "Comparison orders should be the same.");
-
-      const byte *const lhs_attr = lhs_pr->AccessWithNullCheck(offset);
-      const byte *const rhs_attr = rhs_pr->AccessWithNullCheck(offset);
-
-      if (lhs_attr == nullptr) {
-        if (rhs_attr == nullptr) {
-          // attributes are both NULL (equal), continue
-          continue;
-        }
-        // lhs is NULL, rhs is non-NULL, return non-equal
-        return false;
-      }
-
-      if (rhs_attr == nullptr) {
-        // lhs is non-NULL, rhs is NULL, return non-equal
-        return false;
-      }
-
-      const noisepage::type::TypeId type_id = key_schema.GetColumns()[i].Type();
-
-      if (!noisepage::storage::index::GenericKey<KeySize>::TypeComparators::CompareEquals(type_id, lhs_attr,
-                                                                                          rhs_attr)) {
-        // one of the attrs didn't match, return non-equal
-        return false;
-      }
-
-      // attributes are equal, continue
-    }
-
-    // keys are equal
-    return true;
+    return lhs.Equals(rhs);
   }
 };
 
 /**
  * Implements std::less for GenericKey. Allows the class to be used with containers that expect STL interface.
- * @tparam KeySize number of bytes for the key's internal buffer
+ * @tparam KeySize number of bytes for the key's binary-comparable form
  */
 template <uint16_t KeySize>
 struct less<noisepage::storage::index::GenericKey<KeySize>> {
@@ -373,46 +397,7 @@ struct less<noisepage::storage::index::GenericKey<KeySize>> {
    */
   bool operator()(const noisepage::storage::index::GenericKey<KeySize> &lhs,
                   const noisepage::storage::index::GenericKey<KeySize> &rhs) const {
-    const auto &key_schema = lhs.GetIndexMetadata().GetSchema();
-    const auto &key_cols = key_schema.GetColumns();
-
-    for (uint16_t i = 0; i < key_cols.size(); i++) {
-      const auto *const lhs_pr = lhs.GetProjectedRow();
-      const auto *const rhs_pr = rhs.GetProjectedRow();
-
-      const auto offset = lhs_pr->ColumnIds()[i].UnderlyingValue();
-      NOISEPAGE_ASSERT(lhs_pr->ColumnIds()[i] == rhs_pr->ColumnIds()[i], "Comparison orders should be the same.");
-
-      const byte *const lhs_attr = lhs_pr->AccessWithNullCheck(offset);
-      const byte *const rhs_attr = rhs_pr->AccessWithNullCheck(offset);
-
-      if (lhs_attr == nullptr) {
-        if (rhs_attr == nullptr) {
-          // attributes are both NULL (equal), continue
-          continue;
-        }
-        // lhs is NULL, rhs is non-NULL, lhs is less than
-        return true;
-      }
-
-      if (rhs_attr == nullptr) {
-        // lhs is non-NULL, rhs is NULL, lhs is greater than
-        return false;
-      }
-
-      const noisepage::type::TypeId type_id = key_schema.GetColumns()[i].Type();
-
-      if (noisepage::storage::index::GenericKey<KeySize>::TypeComparators::CompareLessThan(type_id, lhs_attr, rhs_attr))
-        return true;
-      if (noisepage::storage::index::GenericKey<KeySize>::TypeComparators::CompareGreaterThan(type_id, lhs_attr,
-                                                                                              rhs_attr))
-        return false;
-
-      // attributes are equal, continue
-    }
-
-    // keys are equal
-    return false;
+    return lhs.LessThan(rhs);
   }
 };
 }  // namespace std
@@ -2,13 +2,10 @@
 
 #include <functional>
 #include <memory>
-#include <unordered_set>
 #include <utility>
-#include <variant>  // NOLINT (Matt): lint thinks this C++17 header is a C header because it only knows C++11
 #include <vector>
 
 #include "common/managed_pointer.h"
-#include "libcuckoo/cuckoohash_config.hh"
 #include "storage/index/index.h"
 #include "storage/index/index_defs.h"
 
@@ -16,21 +13,20 @@ namespace noisepage::transaction {
 class TransactionContext;
 }
 
-template <class Key, class T, class Hash, class KeyEqual, class Allocator, std::size_t SLOT_PER_BUCKET>
-class cuckoohash_map;
-
 namespace noisepage::storage::index {
+template <typename KeyType, typename ValueType, typename KeyHash, typename KeyEqualityChecker,
+          typename ValueEqualityChecker>
+class ConcurrentHashMap;
 
+template <typename KeyType>
+class BulkLoadBuffer;
 template <uint16_t KeySize>
 class HashKey;
 template <uint16_t KeySize>
 class GenericKey;
 
 /**
- * Wrapper around libcuckoo's hash map. The MVCC is logic is similar to our reference index (BwTreeIndex). Much of the
- * logic here is related to the cuckoohash_map not being a multimap. We get around this by making the value type a
- * std::variant that can either be a TupleSlot if there's only a single value for a given key, or a std::unordered_set
- * of TupleSlots if a single key needs to map to multiple TupleSlots.
+ * Wrapper around ConcurrentHashMap. The MVCC is logic is similar to our reference index (BwTreeIndex).
  * @tparam KeyType the type of keys stored in the map
  */
 template <typename KeyType>
@@ -38,21 +34,14 @@ class HashIndex final : public Index {
   friend class IndexBuilder;
 
  private:
-  // TODO(Matt): unclear at the moment if we would want this to be tunable via the SettingsManager. Alternatively, it
-  // might be something that is a per-index hint based on the table size (cardinality?), rather than a global setting
-  static constexpr uint16_t INITIAL_CUCKOOHASH_MAP_SIZE = 256;
-  struct TupleSlotHash;
-
-  using ValueMap = std::unordered_set<TupleSlot, TupleSlotHash>;
-  using ValueType = std::variant<TupleSlot, ValueMap>;
-
   explicit HashIndex(IndexMetadata metadata);
 
   const std::unique_ptr<
-      cuckoohash_map<KeyType, ValueType, std::hash<KeyType>,
-                     std::equal_to<KeyType>,  // NOLINT transparent functors can't figure out template
-                     std::allocator<std::pair<const KeyType, ValueType>>, LIBCUCKOO_DEFAULT_SLOT_PER_BUCKET>>
+      ConcurrentHashMap<KeyType, TupleSlot, std::hash<KeyType>,
+                        std::equal_to<KeyType>,  // NOLINT transparent functors can't figure out template
+                        std::equal_to<TupleSlot>>>
       hash_map_;
+  const std::unique_ptr<BulkLoadBuffer<KeyType>> bulk_load_buffer_;  // key-value pairs staged for BulkLoad()
   mutable common::SpinLatch transaction_context_latch_;  // latch used to protect transaction context
 
  public:
@@ -62,6 +51,12 @@ class HashIndex final : public Index {
    */
   IndexType Type() const final { return IndexType::HASHMAP; }
 
+  /**
+   * Invoke garbage collection on the index, which finishes a running resize and frees the tables and value chunks that
+   * lookups no longer see.
+   */
+  void PerformGarbageCollection() final;
+
   /**
    * @return approximate number of bytes allocated on the heap for this index data structure
    */
@@ -88,6 +83,25 @@ class HashIndex final : public Index {
   bool InsertUnique(common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &tuple,
                     TupleSlot location) final;
 
+  /**
+   * Stages a key-value pair for the next BulkLoad(). Thread-safe.
+   * @param txn txn context for the calling txn
+   * @param tuple key
+   * @param location value
+   * @return true
+   */
+  bool StageForBulkLoad(common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &tuple,
+                        TupleSlot location) final;
+
+  /**
+   * Sizes the hash map for the staged key-value pairs, so that it doesn't resize during the load, and inserts the pairs
+   * in parallel.
+   * @param txn txn context for the calling txn, used to register abort actions if the index is not empty
+   * @param fill_factor unused, since the hash map has a fixed maximum load factor
+   * @return false if a unique index would contain duplicate keys, in which case the txn must abort
+   */
+  bool BulkLoad(common::ManagedPointer<transaction::TransactionContext> txn, double fill_factor) final;
+
   /**
    * Doesn't immediately call delete on the index. Registers a commit action in the txn that will eventually register a
    * deferred action for the GC to safely call delete on the index when no more transactions need to access the key.
@@ -107,6 +121,15 @@ class HashIndex final : public Index {
   void ScanKey(const transaction::TransactionContext &txn, const ProjectedRow &key,
                std::vector<TupleSlot> *value_list) final;
 
+  /**
+   * Finds all the values associated with each of the given keys, prefetching the buckets of the keys.
+   * @param txn txn context for the calling txn, used for visibility checks
+   * @param keys the keys to look for
+   * @param[out] value_lists the values associated with each key, in the order of the keys
+   */
+  void ScanKeyBatch(const transaction::TransactionContext &txn, const std::vector<const ProjectedRow *> &keys,
+                    std::vector<std::vector<TupleSlot>> *value_lists) final;
+
   /** @return The number of keys in the index. */
   uint64_t GetSize() const final;
 };
@@ -96,6 +96,32 @@ class Index {
   virtual bool InsertUnique(common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &tuple,
                             TupleSlot location) = 0;
 
+  /**
+   * Stages a key-value pair for the next BulkLoad(), which is much cheaper than inserting the pairs one at a time when
+   * building an index on an existing table. Thread-safe. Indexes that do not support bulk loading insert the pair right
+   * away, and enforce uniqueness like InsertUnique.
+   * @param txn txn context for the calling txn, used to register abort actions
+   * @param tuple key
+   * @param location value
+   * @return false if the pair could not be staged, in which case the txn must abort
+   */
+  virtual bool StageForBulkLoad(common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &tuple,
+                                TupleSlot location) {
+    return metadata_.GetSchema().Unique() ? InsertUnique(txn, tuple, location) : Insert(txn, tuple, location);
+  }
+
+  /**
+   * Sorts the staged key-value pairs and builds the index from them bottom-up. No abort actions are registered for the
+   * loaded pairs, since the index is expected to have been created by the calling txn, and is dropped as a whole if it
+   * aborts. If something was already inserted into the index, the pairs are inserted one at a time in key order.
+   * @param txn txn context for the calling txn
+   * @param fill_factor fraction of each node to fill, between 0.5 and 1
+   * @return false if a unique index would contain duplicate keys, in which case the txn must abort
+   */
+  virtual bool BulkLoad(common::ManagedPointer<transaction::TransactionContext> txn, double fill_factor) {
+    return true;
+  }
+
   /**
    * Doesn't immediately call delete on the index. Registers a commit action in the txn that will eventually register a
    * deferred action for the GC to safely call delete on the index when no more transactions need to access the key.
@@ -106,6 +132,36 @@ class Index {
   virtual void Delete(common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &tuple,
                       TupleSlot location) = 0;
 
+  /**
+   * Inserts a batch of key-value pairs, as if InsertUnique() (for unique indexes) or Insert() was called for every pair
+   * in order. Indexes that support it sort the pairs by key, and insert all the pairs that belong into the same node at
+   * once instead of traversing the index for every pair.
+   * @param txn txn context for the calling txn, used for visibility and write-write, and to register abort actions
+   * @param tuples keys
+   * @param locations values, one for every key
+   * @return true if every pair was inserted. Otherwise, the index found a constraint violation and the txn must abort.
+   */
+  virtual bool InsertBatch(common::ManagedPointer<transaction::TransactionContext> txn,
+                           const std::vector<const ProjectedRow *> &tuples, const std::vector<TupleSlot> &locations) {
+    const bool unique = metadata_.GetSchema().Unique();
+    for (uint32_t i = 0; i < tuples.size(); i++) {
+      if (!(unique ? InsertUnique(txn, *tuples[i], locations[i]) : Insert(txn, *tuples[i], locations[i]))) return false;
+    }
+    return true;
+  }
+
+  /**
+   * Deletes a batch of key-value pairs, as if Delete() was called for every pair. Indexes that support it sort the
+   * pairs by key once the deletes are safe to perform, and delete all the pairs that belong into the same node at once.
+   * @param txn txn context for the calling txn, used to register commit actions for deferred GC actions
+   * @param tuples keys
+   * @param locations values, one for every key
+   */
+  virtual void DeleteBatch(common::ManagedPointer<transaction::TransactionContext> txn,
+                           const std::vector<const ProjectedRow *> &tuples, const std::vector<TupleSlot> &locations) {
+    for (uint32_t i = 0; i < tuples.size(); i++) Delete(txn, *tuples[i], locations[i]);
+  }
+
   /**
    * Finds all the values associated with the given key in our index.
    * @param txn txn context for the calling txn, used for visibility checks
@@ -115,6 +171,23 @@ class Index {
   virtual void ScanKey(const transaction::TransactionContext &txn, const ProjectedRow &key,
                        std::vector<TupleSlot> *value_list) = 0;
 
+  /**
+   * Finds all the values associated with each of the given keys, as if ScanKey() was called for every key. Indexes
+   * that support it interleave the lookups and prefetch the node that each lookup visits next, so that the cache misses
+   * of different lookups overlap instead of stalling one after the other.
+   * @param txn txn context for the calling txn, used for visibility checks
+   * @param keys the keys to look for
+   * @param[out] value_lists the values associated with each key, in the order of the keys
+   */
+  virtual void ScanKeyBatch(const transaction::TransactionContext &txn, const std::vector<const ProjectedRow *> &keys,
+                            std::vector<std::vector<TupleSlot>> *value_lists) {
+    value_lists->resize(keys.size());
+    for (uint32_t i = 0; i < keys.size(); i++) {
+      (*value_lists)[i].clear();
+      ScanKey(txn, *keys[i], &(*value_lists)[i]);
+    }
+  }
+
   /**
    * Finds all the values between the given keys in our index, sorted in ascending order.
    * @param txn txn context for the calling txn, used for visibility checks
@@ -131,6 +204,42 @@ class Index {
     NOISEPAGE_ASSERT(false, "You called a method on an index type that hasn't implemented it.");
   }
 
+  /**
+   * Finds all the values between the given keys in our index, sorted in ascending order, and also copies out the key of
+   * every value so that index-only scans can read the key attributes without going to the table.
+   * @param txn txn context for the calling txn, used for visibility checks
+   * @param scan_type Scan Type
+   * @param num_attrs Number of attributes to compare
+   * @param low_key the key to start at
+   * @param high_key the key to end at
+   * @param limit if any
+   * @param[out] value_list the values associated with the keys
+   * @param[out] key_list the keys of the values, KeyListEntrySize() bytes each, in the order of value_list. Can be
+   * nullptr if the keys are not needed.
+   */
+  virtual void ScanAscendingWithKeys(const transaction::TransactionContext &txn, ScanType scan_type, uint32_t num_attrs,
+                                     ProjectedRow *low_key, ProjectedRow *high_key, uint32_t limit,
+                                     std::vector<TupleSlot> *value_list, std::vector<byte> *key_list) {
+    NOISEPAGE_ASSERT(false, "You called a method on an index type that hasn't implemented it.");
+  }
+
+  /**
+   * @return size in bytes of the entries that ScanAscendingWithKeys() writes to its key_list, or 0 if this index type
+   * can't return its keys
+   */
+  virtual uint16_t KeyListEntrySize() const { return 0; }
+
+  /**
+   * Writes the attributes of a key returned by ScanAscendingWithKeys() into a ProjectedRow.
+   * @param key pointer to the entry of the key in the key_list
+   * @param[out] to ProjectedRow initialized from GetProjectedRowInitializer()
+   * @param varlen_buffer buffer of KeyListEntrySize() bytes for the varlens of the key that can't be inlined into their
+   * VarlenEntry. The varlens of the ProjectedRow are valid until the buffer is reused.
+   */
+  virtual void KeyToProjectedRow(const byte *key, ProjectedRow *to, byte *varlen_buffer) const {
+    NOISEPAGE_ASSERT(false, "You called a method on an index type that hasn't implemented it.");
+  }
+
   /**
    * Finds all the values between the given keys in our index, sorted in descending order.
    * @param txn txn context for the calling txn, used for visibility checks
@@ -37,6 +37,10 @@ class IndexBuilder {
 
   Index *BuildBPlusTreeGenericKey(IndexMetadata metadata) const;
 
+  Index *BuildARTIntsKey(IndexMetadata metadata) const;
+
+  Index *BuildARTGenericKey(IndexMetadata metadata) const;
+
   Index *BuildHashIntsKey(IndexMetadata metadata) const;
 
   Index *BuildHashGenericKey(IndexMetadata metadata) const;
@@ -9,7 +9,7 @@ namespace noisepage::storage::index {
  * This enum indicates the backing implementation that should be used for the index.  It is a character enum in order
  * to better match PostgreSQL's look and feel when persisted through the catalog.
  */
-enum class IndexType : char { BWTREE = 'B', HASHMAP = 'H', BPLUSTREE = 'P' };
+enum class IndexType : char { BWTREE = 'B', HASHMAP = 'H', BPLUSTREE = 'P', ART = 'A' };
 
 /**
  * Internal enum to stash with the index to represent its key type. We don't need to persist this.
@@ -22,6 +22,11 @@ enum class IndexKeyKind : uint8_t { COMPACTINTSKEY, GENERICKEY, HASHKEY };
 constexpr std::array<type::TypeId, 4> NUMERIC_KEY_TYPES{type::TypeId::TINYINT, type::TypeId::SMALLINT,
                                                         type::TypeId::INTEGER, type::TypeId::BIGINT};
 
+/**
+ * Fraction of each node that bulk loading fills, which leaves room for some inserts before the first splits.
+ */
+constexpr double BULK_LOAD_FILL_FACTOR = 0.9;
+
 enum class ScanType : uint8_t {
   Closed,   /* [low, high] range scan */
   OpenLow,  /* [begin(), high] range scan */
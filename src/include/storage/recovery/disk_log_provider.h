@@ -1,42 +1,63 @@
 #pragma once
 
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "storage/recovery/abstract_log_provider.h"
 #include "storage/write_ahead_log/log_io.h"
+#include "storage/write_ahead_log/log_segment.h"
 
 namespace noisepage::storage {
 
 /**
  * @brief Log provider for logs stored on disk
  * Provides logs to the recovery manager from logs persisted on disk. The log file is read in using the
- * BufferedLogReader.
+ * BufferedLogReader. If the log was written as segments (see LogSegmentManager), the segments are read in order.
  */
 class DiskLogProvider : public AbstractLogProvider {
  public:
   /**
    * @param log_file_path path to log file to read logs from
    */
-  explicit DiskLogProvider(const std::string &log_file_path) : in_(BufferedLogReader(log_file_path.c_str())) {}
+  explicit DiskLogProvider(const std::string &log_file_path)
+      : DiskLogProvider(log_file_path, transaction::INVALID_TXN_TIMESTAMP) {}
+
+  /**
+   * @param log_file_path path to log file to read logs from
+   * @param replay_after only transactions that started after this timestamp have to be replayed, e.g., because the
+   *                     rest is covered by a checkpoint. Log segments without such transactions are skipped.
+   */
+  DiskLogProvider(const std::string &log_file_path, transaction::timestamp_t replay_after);
 
   LogProviderType GetType() const override { return LogProviderType::DISK; }
 
  private:
-  // Buffered log file reader
-  storage::BufferedLogReader in_;
+  // Buffered log file reader, for either the log file or the current log segment. nullptr before the first segment
+  std::unique_ptr<storage::BufferedLogReader> in_;
+  // Log segments to read, empty if the log is not segmented
+  std::vector<LogSegmentInfo> segments_;
+  // Position of the next log segment to read
+  uint64_t next_segment_ = 0;
+
+  /**
+   * Open the next log segment for reading and skip past its header
+   */
+  void OpenNextSegment();
 
   /**
    * @return true if log file contains more records, false otherwise
    */
-  bool HasMoreRecords() override { return in_.HasMore(); }
+  bool HasMoreRecords() override;
 
   /**
-   * Read data from the log file into the destination provided
+   * Read data from the log file into the destination provided. Segments are always cut at record boundaries, so a read
+   * never spans multiple segments.
    * @param dest pointer to location to read into
    * @param size number of bytes to read
    * @return true if we read the given number of bytes
    */
-  bool Read(void *dest, uint32_t size) override { return in_.Read(dest, size); }
+  bool Read(void *dest, uint32_t size) override { return in_->Read(dest, size); }
 };
 
 }  // namespace noisepage::storage
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -18,6 +20,8 @@
 #include "catalog/postgres/pg_namespace.h"
 #include "catalog/postgres/pg_type.h"
 #include "common/dedicated_thread_owner.h"
+#include "common/shared_latch.h"
+#include "common/spin_latch.h"
 #include "storage/recovery/abstract_log_provider.h"
 #include "storage/sql_table.h"
 
@@ -83,6 +87,8 @@ class RecoveryManager : public common::DedicatedThreadOwner {
    * @param replication_manager replication manager to acknowledge applied changes
    * @param thread_registry thread registry to register tasks
    * @param store block store used for SQLTable creation during recovery
+   * @param apply_threads number of threads that apply committed transactions. With more than one thread, transactions
+   *                      that only modify user tables are applied in parallel, partitioned by the tables they modify.
    */
   explicit RecoveryManager(const common::ManagedPointer<AbstractLogProvider> log_provider,
                            const common::ManagedPointer<catalog::Catalog> catalog,
@@ -90,14 +96,15 @@ class RecoveryManager : public common::DedicatedThreadOwner {
                            const common::ManagedPointer<transaction::DeferredActionManager> deferred_action_manager,
                            const common::ManagedPointer<replication::ReplicationManager> replication_manager,
                            const common::ManagedPointer<noisepage::common::DedicatedThreadRegistry> thread_registry,
-                           const common::ManagedPointer<BlockStore> store)
+                           const common::ManagedPointer<BlockStore> store, const uint32_t apply_threads = 1)
       : DedicatedThreadOwner(thread_registry),
         log_provider_(log_provider),
         catalog_(catalog),
         txn_manager_(txn_manager),
         deferred_action_manager_(deferred_action_manager),
         replication_manager_(replication_manager),
-        block_store_(store) {
+        block_store_(store),
+        apply_threads_(std::max(apply_threads, 1U)) {
     // Initialize catalog_table_schemas_ map
     catalog_table_schemas_[catalog::postgres::PgClass::CLASS_TABLE_OID] =
         catalog::postgres::Builder::GetClassTableSchema();
@@ -122,8 +129,19 @@ class RecoveryManager : public common::DedicatedThreadOwner {
   /** @return True if the recovery task is still running. */
   bool IsRecoveryTaskRunning() const { return recovery_task_ != nullptr; }
 
-  /** @return The ID of the last transaction that was applied. */
-  transaction::timestamp_t GetLastAppliedTransactionId() const { return last_applied_txn_id_; }
+  /**
+   * @return The ID of the last transaction that was applied. Every transaction that committed before it on the primary
+   *         has been applied as well.
+   */
+  transaction::timestamp_t GetLastAppliedTransactionId() const { return last_applied_txn_id_.load(); }
+
+  /**
+   * Begin a transaction that reads the applied transactions as of GetLastAppliedTransactionId(), e.g., for a read-only
+   * query on a replica. Unlike a transaction from TransactionManager::BeginTransaction(), it never sees some but not
+   * all of the transactions that are applied in parallel.
+   * @return the new transaction, which is finished through the transaction manager as usual
+   */
+  transaction::TransactionContext *BeginSnapshotTransaction();
 
  private:
   FRIEND_TEST(RecoveryTests, DoubleRecoveryTest);
@@ -154,6 +172,9 @@ class RecoveryManager : public common::DedicatedThreadOwner {
   // TODO(Gus): This map may get huge, benchmark whether this becomes a problem and if we need a more sophisticated data
   // structure
   std::unordered_map<TupleSlot, TupleSlot> tuple_slot_map_;
+  // Guards tuple_slot_map_ while transactions are applied in parallel. Special case catalog records are only ever
+  // replayed by the recovery thread itself, so their direct accesses to the map are not latched.
+  common::SpinLatch tuple_slot_map_latch_;
 
   // Used during recovery from log. Stores deferred transactions in sorted sorted order to be able to execute them in
   // serial order. Transactions are defered when there is an older active transaction at the time it committed. Even
@@ -182,9 +203,27 @@ class RecoveryManager : public common::DedicatedThreadOwner {
   // them here
   std::unordered_map<catalog::table_oid_t, catalog::Schema> catalog_table_schemas_;
 
-  transaction::timestamp_t last_applied_txn_id_ = transaction::INITIAL_TXN_TIMESTAMP;  ///< The last applied txn's ID.
+  /** The last applied txn's ID. Only updated while holding snapshot_latch_ exclusively. */
+  std::atomic<transaction::timestamp_t> last_applied_txn_id_{transaction::INITIAL_TXN_TIMESTAMP};
   uint32_t recovered_txns_ = 0;  ///< The number of recovered committed txns.
 
+  const uint32_t apply_threads_;  ///< Number of threads that apply transactions, 1 to apply them serially.
+  /**
+   * Applied transactions are committed while holding this latch exclusively, and snapshot transactions begin while
+   * holding it shared. A snapshot transaction thus either sees all transactions that are committed together or none.
+   */
+  common::SharedLatch snapshot_latch_;
+
+  /** Changes of a committed transaction that are applied as part of a group of transactions. */
+  struct ApplyGroup {
+    /** Start timestamps of the transactions on the primary, in the order in which they are applied. */
+    std::vector<transaction::timestamp_t> txn_ids_;
+    /** Buffered changes of each transaction, in the same order as txn_ids_. */
+    std::vector<std::vector<std::pair<LogRecord *, std::vector<byte *>>>> changes_;
+    /** Transaction that applies the changes of the whole group. */
+    transaction::TransactionContext *txn_ = nullptr;
+  };
+
   /**
    * Recovers the databases using the provided log provider
    */
@@ -205,12 +244,44 @@ class RecoveryManager : public common::DedicatedThreadOwner {
    */
   uint32_t ProcessCommittedTransaction(transaction::timestamp_t txn_id);
 
+  /**
+   * @param txn_id start timestamp for committed transaction
+   * @return true if the transaction only modifies user tables, in which case it can be applied in parallel with
+   *         transactions that modify other tables
+   */
+  bool CanApplyInParallel(transaction::timestamp_t txn_id);
+
+  /**
+   * Replay the given committed transactions, which can all be applied in parallel. The transactions are grouped such
+   * that transactions which modify the same table end up in the same group. Each group is applied by a single
+   * transaction in the original order, and the groups are applied in parallel. All groups are committed together.
+   * @param txn_ids start timestamps for the committed transactions, in the order in which they would be applied
+   * @return number of records replayed
+   */
+  uint32_t ProcessCommittedTransactionsInParallel(const std::vector<transaction::timestamp_t> &txn_ids);
+
+  /**
+   * Let the primary know that a transaction has been applied, if this is a replica.
+   * @param txn_id start timestamp for the applied transaction
+   */
+  void NotifyTransactionApplied(transaction::timestamp_t txn_id);
+
   /**
    * Defers log records deletes with the transaction manager
    * @param txn_id txn_id for txn who's records to delete
    * @param delete_varlens true if we should delete varlens allocated for txn
    */
-  void DeferRecordDeletes(transaction::timestamp_t txn_id, bool delete_varlens);
+  void DeferRecordDeletes(transaction::timestamp_t txn_id, bool delete_varlens) {
+    DeferRecordDeletes(std::move(buffered_changes_map_[txn_id]), delete_varlens);
+  }
+
+  /**
+   * Defers log records deletes with the transaction manager
+   * @param buffered_changes buffered changes of the txn whose records to delete
+   * @param delete_varlens true if we should delete varlens allocated for txn
+   */
+  void DeferRecordDeletes(std::vector<std::pair<LogRecord *, std::vector<byte *>>> &&buffered_changes,
+                          bool delete_varlens);
 
   /**
    * Replay any transaction who's txn start time is less than upper_bound. If upper_bound == transaction::NO_ACTIVE_TXN,
@@ -226,6 +297,7 @@ class RecoveryManager : public common::DedicatedThreadOwner {
    * @return new tuple slot
    */
   TupleSlot GetTupleSlotMapping(TupleSlot slot) {
+    common::SpinLatch::ScopedSpinLatch guard(&tuple_slot_map_latch_);
     NOISEPAGE_ASSERT(tuple_slot_map_.find(slot) != tuple_slot_map_.end(), "No tuple slot mapping exists");
     return tuple_slot_map_[slot];
   }
@@ -234,17 +306,29 @@ class RecoveryManager : public common::DedicatedThreadOwner {
    * Wrapper over GetDatabaseCatalog method that asserts the database exists
    * @param txn txn for catalog lookup
    * @param database oid for database we want
+   * @param lock true to take the DDL lock of the database, which is needed to modify catalog tables. Transactions that
+   *             are applied in parallel only modify user tables, and must not take the lock.
    * @return pointer to database catalog
    */
   common::ManagedPointer<catalog::DatabaseCatalog> GetDatabaseCatalog(transaction::TransactionContext *txn,
-                                                                      catalog::db_oid_t db_oid) {
+                                                                      catalog::db_oid_t db_oid, bool lock = true) {
     auto db_catalog_ptr = catalog_->GetDatabaseCatalog(common::ManagedPointer(txn), db_oid);
     NOISEPAGE_ASSERT(db_catalog_ptr != nullptr, "No catalog for given database oid");
-    auto result UNUSED_ATTRIBUTE = db_catalog_ptr->TryLock(common::ManagedPointer(txn));
-    NOISEPAGE_ASSERT(result, "There should not be concurrent DDL changes during recovery.");
+    if (lock) {
+      auto result UNUSED_ATTRIBUTE = db_catalog_ptr->TryLock(common::ManagedPointer(txn));
+      NOISEPAGE_ASSERT(result, "There should not be concurrent DDL changes during recovery.");
+    }
     return db_catalog_ptr;
   }
 
+  /**
+   * @param table_oid oid of a table
+   * @return true if the table is a catalog table
+   */
+  static bool IsCatalogTable(catalog::table_oid_t table_oid) {
+    return table_oid.UnderlyingValue() < catalog::START_OID;
+  }
+
   /**
    * @param txn transaction to use for catalog lookup
    * @param db_oid database oid for requested table
@@ -315,7 +399,8 @@ class RecoveryManager : public common::DedicatedThreadOwner {
    * @param record record we want to determine redo type of
    * @return true if record is an insert redo, false if it is an update redo
    */
-  bool IsInsertRecord(const RedoRecord *record) const {
+  bool IsInsertRecord(const RedoRecord *record) {
+    common::SpinLatch::ScopedSpinLatch guard(&tuple_slot_map_latch_);
     return tuple_slot_map_.find(record->GetTupleSlot()) == tuple_slot_map_.end();
   }
 
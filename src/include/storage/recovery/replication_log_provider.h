@@ -1,12 +1,16 @@
 #pragma once
 
+#include <algorithm>
+#include <condition_variable>  // NOLINT
+#include <cstring>
+#include <functional>
 #include <memory>
+#include <mutex>  // NOLINT
 #include <queue>
 #include <string>
 #include <utility>
 #include <vector>
 
-#include "network/network_io_utils.h"
 #include "replication/replication_messages.h"
 #include "storage/recovery/abstract_log_provider.h"
 #include "storage/write_ahead_log/log_io.h"
@@ -35,23 +39,23 @@ class ReplicationLogProvider final : public AbstractLogProvider {
     replication_cv_.notify_all();
   }
 
-  /** Add the batch of records to the log provider. */
-  void AddBatchOfRecords(const replication::RecordsBatchMsg &msg) {
+  /** Add the batch of records to the log provider. The contents of the batch are moved, not copied. */
+  void AddBatchOfRecords(replication::RecordsBatchMsg &&msg) {
     {
       std::unique_lock<std::mutex> lock(replication_latch_);
-      received_batch_queue_.emplace(msg);
+      received_batch_queue_.emplace(std::move(msg));
     }
     replication_cv_.notify_all();
   }
 
   /** @return True if there are more records. False otherwise. */
   bool NonBlockingHasMoreRecords() const {
-    return (curr_buffer_ != nullptr && curr_buffer_->HasMore()) || !received_batch_queue_.empty();
+    return CurrentBatchHasMore() || !received_batch_queue_.empty();
   }
 
   /** @return True if there is an unprocessed OAT that is ready to be applied. See docs/design_replication.md. */
   bool OATReady() const {
-    bool currently_reading_buffer = curr_buffer_ != nullptr && curr_buffer_->HasMore();
+    bool currently_reading_buffer = CurrentBatchHasMore();
     bool all_batches_popped = !oats_.empty() && oats_.top().batch_id_ <= last_batch_popped_;
     return !currently_reading_buffer && all_batches_popped;
   }
@@ -107,6 +111,9 @@ class ReplicationLogProvider final : public AbstractLogProvider {
     return left.GetBatchId() > right.GetBatchId();
   }
 
+  /** @return True if the batch that is currently being read has unread records. */
+  bool CurrentBatchHasMore() const { return curr_offset_ < curr_contents_.size(); }
+
   /** A pair of OAT and associated batch ID that must be processed before the OAT. */
   struct OATPair {
     transaction::timestamp_t oat_;             ///< The last transaction inclusive that is safe to be applied.
@@ -147,7 +154,7 @@ class ReplicationLogProvider final : public AbstractLogProvider {
    * @return        True if the given number of bytes were read. False otherwise.
    */
   bool Read(void *dest, uint32_t size) override {
-    if (curr_buffer_ == nullptr || !curr_buffer_->HasMore()) {
+    if (!CurrentBatchHasMore()) {
       std::unique_lock<std::mutex> lock(replication_latch_);
       replication_cv_.wait(lock, [&] { return !replication_active_ || NextBatchReady(); });
       // Check if replication has shut down.
@@ -155,38 +162,37 @@ class ReplicationLogProvider final : public AbstractLogProvider {
 
       // Pop the next batch of records off into curr_buffer_.
       {
-        const replication::RecordsBatchMsg &msg = received_batch_queue_.top();
-        std::string contents = msg.GetContents();
-        std::vector<unsigned char> bytes(contents.begin(), contents.end());
-        network::ReadBufferView view(bytes.size(), bytes.begin());
-        auto buffer = std::make_unique<network::ReadBuffer>();
-        buffer->FillBufferFrom(view, bytes.size());
+        // The batch is about to be popped, so its contents can be moved out of the queue.
+        auto &msg = const_cast<replication::RecordsBatchMsg &>(received_batch_queue_.top());  // NOLINT
 
         NOISEPAGE_ASSERT((last_batch_popped_ == replication::INVALID_RECORD_BATCH_ID) ||
                              (msg.GetBatchId() == replication::RecordsBatchMsg::NextBatchId(last_batch_popped_)),
                          "Batches are being added out of order?");
 
         last_batch_popped_ = msg.GetBatchId();
-        curr_buffer_ = std::move(buffer);
+        curr_contents_ = msg.ReleaseContents();
+        curr_offset_ = 0;
         received_batch_queue_.pop();
         replication_cv_.notify_one();
       }
     }
 
-    // Read in as much as is available in this buffer.
-    auto readable_size = curr_buffer_->HasMore(size) ? size : curr_buffer_->BytesAvailable();
-    curr_buffer_->ReadIntoView(readable_size).Read(readable_size, dest);
+    // Read in as much as is available in this batch.
+    const auto readable_size = static_cast<uint32_t>(std::min<size_t>(size, curr_contents_.size() - curr_offset_));
+    std::memcpy(dest, curr_contents_.data() + curr_offset_, readable_size);
+    curr_offset_ += readable_size;
 
     // If there is more data to read, recursively call Read until all of the data is read.
     return (readable_size < size) ? Read(static_cast<char *>(dest) + readable_size, size - readable_size) : true;
   }
 
   bool replication_active_ = true;  ///< True if replication is currently active. False otherwise.
-  std::unique_ptr<network::ReadBuffer> curr_buffer_ = nullptr;  ///< Current buffer to read logs from.
+  std::string curr_contents_;  ///< Contents of the batch that logs are currently read from.
+  size_t curr_offset_ = 0;     ///< Offset of the next unread byte in curr_contents_.
 
   /** The batches received from replication. */
   std::priority_queue<replication::RecordsBatchMsg, std::vector<replication::RecordsBatchMsg>,
-                      std::function<bool(replication::RecordsBatchMsg, replication::RecordsBatchMsg)>>
+                      std::function<bool(const replication::RecordsBatchMsg &, const replication::RecordsBatchMsg &)>>
       received_batch_queue_{CompareBatches};
   replication::record_batch_id_t last_batch_popped_ = replication::INVALID_RECORD_BATCH_ID;
   std::priority_queue<OATPair, std::vector<OATPair>, std::function<bool(OATPair, OATPair)>> oats_{CompareOATs};
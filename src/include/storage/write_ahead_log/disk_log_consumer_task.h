@@ -1,17 +1,26 @@
 #pragma once
 
 #include <condition_variable>  // NOLINT
+#include <queue>
 #include <utility>
 #include <vector>
 
 #include "common/container/concurrent_blocking_queue.h"
 #include "common/container/concurrent_queue.h"
 #include "common/dedicated_thread_task.h"
+#include "common/managed_pointer.h"
 #include "storage/storage_defs.h"
 #include "storage/write_ahead_log/log_io.h"
 
+namespace noisepage::replication {
+class PrimaryReplicationManager;
+}  // namespace noisepage::replication
+
 namespace noisepage::storage {
 
+class LogSegmentManager;
+class UringLogWriter;
+
 /**
  * A DiskLogConsumerTask is responsible for writing serialized log records out to disk by processing buffers in the log
  * manager's filled buffer queue
@@ -25,18 +34,26 @@ class DiskLogConsumerTask : public common::DedicatedThreadTask {
    * @param buffers pointer to list of all buffers used by log manager, used to persist log file
    * @param empty_buffer_queue pointer to queue to push empty buffers to
    * @param filled_buffer_queue pointer to queue to pop filled buffers from
+   * @param log_segments pointer to the segments to write the log to, or nullptr to write to the buffers' log file
+   * @param uring_log_writer pointer to the io_uring writer of the log file, or nullptr to write through the buffers
+   * @param primary_replication_manager replication manager whose acknowledgements allow deleting old log segments
    */
   explicit DiskLogConsumerTask(const std::chrono::microseconds persist_interval, uint64_t persist_threshold,
                                std::vector<BufferedLogWriter> *buffers,
                                common::ConcurrentBlockingQueue<BufferedLogWriter *> *empty_buffer_queue,
-                               common::ConcurrentQueue<storage::SerializedLogs> *filled_buffer_queue)
+                               common::ConcurrentQueue<storage::SerializedLogs> *filled_buffer_queue,
+                               LogSegmentManager *log_segments, UringLogWriter *uring_log_writer,
+                               common::ManagedPointer<replication::PrimaryReplicationManager> primary_replication_manager)
       : run_task_(false),
         persist_interval_(persist_interval),
         persist_threshold_(persist_threshold),
         current_data_written_(0),
         buffers_(buffers),
         empty_buffer_queue_(empty_buffer_queue),
-        filled_buffer_queue_(filled_buffer_queue) {}
+        filled_buffer_queue_(filled_buffer_queue),
+        log_segments_(log_segments),
+        uring_log_writer_(uring_log_writer),
+        primary_replication_manager_(primary_replication_manager) {}
 
   /**
    * Runs main disk log writer loop. Called by thread registry upon initialization of thread
@@ -68,6 +85,16 @@ class DiskLogConsumerTask : public common::DedicatedThreadTask {
   common::ConcurrentBlockingQueue<BufferedLogWriter *> *empty_buffer_queue_;
   // The queue containing filled buffers. Task should dequeue filled buffers from this queue to flush
   common::ConcurrentQueue<SerializedLogs> *filled_buffer_queue_;
+  // The segments that the log is written to, or nullptr if the log is a single file written through the buffers
+  LogSegmentManager *log_segments_;
+  // Writes the log file through io_uring, or nullptr if the log is written with blocking writes
+  UringLogWriter *uring_log_writer_;
+  // Sequence number of the last sync queued with uring_log_writer_
+  uint64_t last_queued_sync_ = 0;
+  // Callbacks of commit records written to the log file, waiting for the uring_log_writer_ sync with the given sequence number
+  std::queue<std::pair<uint64_t, std::vector<storage::CommitCallback>>> pending_commit_callbacks_;
+  // Used to find log segments that every replica has applied, DISABLED if replication is off
+  common::ManagedPointer<replication::PrimaryReplicationManager> primary_replication_manager_;
 
   // Flag used by the serializer thread to signal the disk log consumer task thread to persist the data on disk
   volatile bool force_flush_;
@@ -90,9 +117,22 @@ class DiskLogConsumerTask : public common::DedicatedThreadTask {
    */
   void WriteBuffersToLogFile();
 
+  /**
+   * Close the current log segment and start a new one, then delete old segments that the replicas have applied
+   */
+  void RotateLogSegment();
+
+  /**
+   * Invoke the callbacks of the commit records whose io_uring sync has finished
+   * @param wait true to wait for every sync queued so far
+   * @return number of callbacks invoked
+   */
+  uint64_t InvokePersistedCallbacks(bool wait);
+
   /*
    * Persists the log file on disk by calling fsync, as well as calling callbacks for all committed transactions that
-   * were persisted
+   * were persisted. With an UringLogWriter, the sync is only queued and the callbacks are invoked once it has
+   * finished, unless the persist was forced or the task is shutting down.
    * @return number of buffers persisted, used for metrics
    */
   uint64_t PersistLogFile();
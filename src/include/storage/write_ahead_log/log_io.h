@@ -25,6 +25,13 @@ class RecordsBatchMsg;
 
 namespace noisepage::storage {
 
+/** The I/O interface that the disk log consumer writes the log file with. */
+enum class LogIoBackend : uint8_t {
+  POSIX = 0,       ///< write() and fdatasync() on the log consumer thread, see BufferedLogWriter.
+  IO_URING,        ///< io_uring with registered buffers, so that writes and syncs overlap, see UringLogWriter.
+  IO_URING_DIRECT  ///< Like IO_URING, but the log file is opened with O_DIRECT to bypass the page cache.
+};
+
 // TODO(Tianyu):  we need control over when and what to flush as the log manager. Thus, we need to write our
 // own wrapper around lower level I/O functions. I could be wrong, and in that case we should
 // revert to using STL.
@@ -42,6 +49,12 @@ class BufferedLogWriter {
   explicit BufferedLogWriter(const char *const log_file_path)
       : out_(PosixIoWrappers::Open(log_file_path, O_WRONLY | O_APPEND | O_CREAT, S_IRUSR | S_IWUSR)) {}
 
+  /**
+   * Instantiates a new BufferedLogWriter that is not backed by a log file of its own. The buffered contents must be
+   * written out with FlushBuffer(int), e.g., by a LogSegmentManager that decides which segment file they belong to.
+   */
+  BufferedLogWriter() : out_(-1) {}
+
   /**
    * Move constructor.
    *
@@ -53,13 +66,17 @@ class BufferedLogWriter {
   BufferedLogWriter(BufferedLogWriter &&other) noexcept : out_(other.out_) {
     memcpy(buffer_, other.buffer_, common::Constants::LOG_BUFFER_SIZE);
     buffer_size_ = other.buffer_size_;
+    newest_txn_begin_ = other.newest_txn_begin_;
+    ends_on_record_boundary_ = other.ends_on_record_boundary_;
     serialize_refcount_.store(other.serialize_refcount_.load());
   }
 
   /**
    * Must call before object is destructed
    */
-  void Close() { PosixIoWrappers::Close(out_); }
+  void Close() {
+    if (out_ != -1) PosixIoWrappers::Close(out_);
+  }
 
   /**
    * Write to the log file the given amount of bytes from the given location in memory, but buffer the write so the
@@ -107,11 +124,40 @@ class BufferedLogWriter {
     return size;
   }
 
+  /**
+   * Flush any buffered writes to the given file descriptor instead of the writer's own log file.
+   * @param fd file descriptor to write the buffered contents to
+   * @return amount of data flushed
+   */
+  uint64_t FlushBuffer(const int fd) {
+    const auto size = buffer_size_;
+    PosixIoWrappers::WriteFully(fd, buffer_, buffer_size_);
+    buffer_size_ = 0;
+    return size;
+  }
+
   /**
    * @return if the buffer is full
    */
   bool IsBufferFull() const { return buffer_size_ == common::Constants::LOG_BUFFER_SIZE; }
 
+  /**
+   * Record metadata about the batch of logs in this buffer. Set by the serializer when the buffer is handed over.
+   * @param newest_txn_begin start timestamp of the newest transaction that has been serialized so far (inclusive)
+   * @param ends_on_record_boundary true if the last record in the buffer is complete, i.e., does not continue in the
+   *                                next buffer
+   */
+  void SetBatchMetadata(const transaction::timestamp_t newest_txn_begin, const bool ends_on_record_boundary) {
+    newest_txn_begin_ = newest_txn_begin;
+    ends_on_record_boundary_ = ends_on_record_boundary;
+  }
+
+  /** @return start timestamp of the newest transaction serialized up to and including this buffer */
+  transaction::timestamp_t NewestTxnBegin() const { return newest_txn_begin_; }
+
+  /** @return true if no log record straddles the end of this buffer */
+  bool EndsOnRecordBoundary() const { return ends_on_record_boundary_; }
+
   /**
    * Mark that the BufferedLogWriter is now ready to be persisted and sent to different destinations.
    * Note that the BufferedLogWriter represents a batch of different logs.
@@ -157,11 +203,14 @@ class BufferedLogWriter {
 
  private:
   friend class replication::RecordsBatchMsg;
+  friend class UringLogWriter;
 
-  const int out_;  // fd of the output files
+  const int out_;  // fd of the output files, or -1 if the writer is not backed by a file of its own
   char buffer_[common::Constants::LOG_BUFFER_SIZE];
 
   uint32_t buffer_size_ = 0;
+  transaction::timestamp_t newest_txn_begin_ = transaction::INITIAL_TXN_TIMESTAMP;
+  bool ends_on_record_boundary_ = true;
   std::atomic<int8_t> serialize_refcount_ = 0;  ///< The number of would-be serializers that haven't serialized yet.
 
   bool CanBuffer(uint32_t size) { return common::Constants::LOG_BUFFER_SIZE - buffer_size_ >= size; }
@@ -204,6 +253,15 @@ class BufferedLogReader {
    */
   bool Read(void *dest, uint32_t size);
 
+  /**
+   * Copy the specified number of bytes from the write ahead log into the target location without consuming them, so
+   * that the next Read returns the same bytes.
+   * @param dest pointer location to copy into
+   * @param size number of bytes to copy, at most LOG_BUFFER_SIZE
+   * @return whether the log has the given number of bytes left
+   */
+  bool Peek(void *dest, uint32_t size);
+
   /**
    * Read a value of the specified type from the log. An exception is thrown if the log file does not
    * have enough bytes left for a well formed value
@@ -234,10 +292,11 @@ class BufferedLogReader {
 
 /** A commit callback is of the form fn_(arg_), and is invoked when the corresponding commit record is persisted. */
 struct CommitCallback {
-  transaction::callback_fn fn_;              ///< The commit callback to invoke.
-  void *arg_;                                ///< The argument to invoke the commit callback with.
-  transaction::timestamp_t txn_start_time_;  ///< (Metadata) The transaction ID that generated this commit callback.
-  bool is_from_read_only_;                   ///< True if the commit callback was from a read only commit record.
+  transaction::callback_fn fn_;               ///< The commit callback to invoke.
+  void *arg_;                                 ///< The argument to invoke the commit callback with.
+  transaction::timestamp_t txn_start_time_;   ///< (Metadata) The transaction ID that generated this commit callback.
+  transaction::timestamp_t txn_commit_time_;  ///< (Metadata) The commit timestamp of the transaction.
+  bool is_from_read_only_;                    ///< True if the commit callback was from a read only commit record.
 };
 
 /**
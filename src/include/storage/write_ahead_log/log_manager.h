@@ -16,6 +16,8 @@
 #include "storage/record_buffer.h"
 #include "storage/write_ahead_log/log_io.h"
 #include "storage/write_ahead_log/log_record.h"
+#include "storage/write_ahead_log/log_segment.h"
+#include "storage/write_ahead_log/uring_log_writer.h"
 
 namespace noisepage::replication {
 class PrimaryReplicationManager;
@@ -61,13 +63,18 @@ class LogManager : public common::DedicatedThreadOwner {
    * @param primary_replication_manager     The replication manager that handles shipping logs over the network.
    *                                        Currently only the primary does this.
    * @param thread_registry                 DedicatedThreadRegistry dependency injection
+   * @param segment_size                    Size in bytes after which the log is cut into a new segment file, see
+   *                                        LogSegmentManager. If 0, the log is written to a single file instead.
+   * @param io_backend                      I/O interface to write the log file with. io_uring falls back to POSIX if
+   *                                        it is not available, and is not used for segmented logs.
    */
   LogManager(std::string log_file_path, uint64_t num_buffers, std::chrono::microseconds serialization_interval,
              std::chrono::microseconds persist_interval, uint64_t persist_threshold,
              common::ManagedPointer<RecordBufferSegmentPool> buffer_pool,
              common::ManagedPointer<common::ConcurrentBlockingQueue<BufferedLogWriter *>> empty_buffer_queue,
              common::ManagedPointer<replication::PrimaryReplicationManager> primary_replication_manager,
-             common::ManagedPointer<common::DedicatedThreadRegistry> thread_registry)
+             common::ManagedPointer<common::DedicatedThreadRegistry> thread_registry, uint64_t segment_size = 0,
+             LogIoBackend io_backend = LogIoBackend::POSIX)
       : DedicatedThreadOwner(thread_registry),
         run_log_manager_(false),
         log_file_path_(std::move(log_file_path)),
@@ -77,6 +84,8 @@ class LogManager : public common::DedicatedThreadOwner {
         serialization_interval_(serialization_interval),
         persist_interval_(persist_interval),
         persist_threshold_(persist_threshold),
+        segment_size_(segment_size),
+        io_backend_(io_backend),
         primary_replication_manager_(primary_replication_manager) {}
 
   /**
@@ -131,7 +140,7 @@ class LogManager : public common::DedicatedThreadOwner {
     if (new_num_buffers >= num_buffers_) {
       // Add in new buffers
       for (size_t i = 0; i < new_num_buffers - num_buffers_; i++) {
-        buffers_.emplace_back(log_file_path_.c_str());
+        AddBuffer();
         empty_buffer_queue_->Enqueue(&buffers_[num_buffers_ + i]);
       }
       num_buffers_ = new_num_buffers;
@@ -152,6 +161,21 @@ class LogManager : public common::DedicatedThreadOwner {
   /** Stop performing actions related to replication. Currently works around circular DBMain dependencies. */
   void EndReplication();
 
+  /**
+   * Delete the log segments that are no longer needed for recovery, e.g., because a checkpoint covers them. The segment
+   * that is currently being written to is never deleted. Does nothing if the log is not segmented.
+   * @param covered_txn every transaction that started at or before this timestamp has finished and is durable elsewhere
+   * @return number of log segments deleted
+   */
+  uint64_t RemoveCoveredLogSegments(transaction::timestamp_t covered_txn) {
+    return log_segments_ == nullptr ? 0 : log_segments_->RemoveCoveredSegments(covered_txn);
+  }
+
+  /** @return a snapshot of the log segment index, empty if the log is not segmented */
+  std::vector<LogSegmentInfo> GetLogSegments() const {
+    return log_segments_ == nullptr ? std::vector<LogSegmentInfo>{} : log_segments_->GetSegments();
+  }
+
  private:
   // Flag to tell us when the log manager is running or during termination
   bool run_log_manager_;
@@ -186,9 +210,26 @@ class LogManager : public common::DedicatedThreadOwner {
   const std::chrono::microseconds persist_interval_;
   // Threshold used by disk consumer task
   uint64_t persist_threshold_;
+  // Size after which the log is cut into a new segment, 0 if the log is written to a single file
+  const uint64_t segment_size_;
+  // Segments that the log is written to, nullptr if the log is written to a single file
+  std::unique_ptr<LogSegmentManager> log_segments_;
+  // I/O interface requested for writing the log file
+  const LogIoBackend io_backend_;
+  // Writes the log file through io_uring, nullptr if the log is written with blocking writes
+  std::unique_ptr<UringLogWriter> uring_log_writer_;
 
   common::ManagedPointer<replication::PrimaryReplicationManager> primary_replication_manager_;
 
+  /** Add a buffer for serializing logs, backed by the log file unless the log is segmented or written by io_uring. */
+  void AddBuffer() {
+    if (log_segments_ != nullptr || uring_log_writer_ != nullptr) {
+      buffers_.emplace_back();
+    } else {
+      buffers_.emplace_back(log_file_path_.c_str());
+    }
+  }
+
   /**
    * If the central registry wants to removes our thread used for the disk log consumer task, we only allow removal if
    * we are in shut down, else we need to keep the task, so we reject the removal
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "common/macros.h"
+#include "common/spin_latch.h"
+#include "storage/write_ahead_log/log_io.h"
+#include "transaction/transaction_defs.h"
+
+namespace noisepage::storage {
+
+/**
+ * Header at the start of every log segment file. The header is written when the segment is created, and its timestamp
+ * fields are patched in place as the segment fills up and when it is closed.
+ */
+struct LogSegmentHeader {
+  /** Magic number identifying a NoisePage log segment ("NPWL"). */
+  static constexpr uint32_t MAGIC = 0x4C57504E;
+  /** Current version of the segment format, bumped whenever the header or log record serialization changes. */
+  static constexpr uint16_t FORMAT_VERSION = 1;
+
+  uint32_t magic_;         ///< Must be MAGIC.
+  uint16_t version_;       ///< Format version that the segment was written with.
+  uint16_t header_size_;   ///< Size of the header in bytes. Log records start right after the header.
+  uint64_t segment_id_;    ///< Sequence number of the segment, starting at 1.
+  transaction::timestamp_t first_commit_time_;  ///< Commit timestamp of the first commit, INVALID if none yet.
+  transaction::timestamp_t newest_txn_begin_;   ///< Newest txn start in the segment, INVALID until closed.
+};
+
+static_assert(sizeof(LogSegmentHeader) == 32, "The on-disk segment header should not have padding.");
+
+/** An entry in the log segment index. */
+struct LogSegmentInfo {
+  uint64_t segment_id_;                         ///< Sequence number of the segment.
+  std::string path_;                            ///< Path to the segment file.
+  transaction::timestamp_t first_commit_time_;  ///< Commit timestamp of the first commit, INVALID if none.
+  /**
+   * Start timestamp of the newest transaction that may have records in this segment or any earlier segment.
+   * INVALID if unknown, e.g., for the last segment written before a crash.
+   */
+  transaction::timestamp_t newest_txn_begin_;
+  uint64_t size_;  ///< Size of the segment file in bytes, including the header.
+
+  /**
+   * @param covered_txn every transaction that started at or before this timestamp has finished and is durable elsewhere
+   * @return true if no record in this segment is needed to replay transactions newer than covered_txn
+   */
+  bool IsCoveredBy(const transaction::timestamp_t covered_txn) const {
+    return newest_txn_begin_ != transaction::INVALID_TXN_TIMESTAMP && newest_txn_begin_ <= covered_txn;
+  }
+};
+
+/**
+ * A LogSegmentManager splits the write ahead log into a sequence of segment files named
+ * "<log_file_path>.<segment id>". Segments are rotated once they exceed the configured size, but only at record
+ * boundaries so that every segment can be replayed on its own. Each segment begins with a LogSegmentHeader, and the
+ * manager keeps an index of all segments so that log providers can seek to the segments they need, and so that
+ * segments covered by a checkpoint or by replicas can be deleted.
+ *
+ * Append(), Persist() and Rotate() must only be called from the log consumer thread. The index may be read and
+ * truncated concurrently from any thread.
+ */
+class LogSegmentManager {
+ public:
+  /**
+   * @param log_file_path   Base path of the log. Segment files are created next to it.
+   * @param segment_size    Size in bytes after which the current segment is rotated.
+   */
+  LogSegmentManager(std::string log_file_path, uint64_t segment_size);
+
+  DISALLOW_COPY_AND_MOVE(LogSegmentManager)
+
+  /** Closes the current segment if it is still open. */
+  ~LogSegmentManager();
+
+  /**
+   * Index the segments that already exist on disk and start a new segment after them. Existing segments are never
+   * appended to, since the last one may end in a torn record after a crash.
+   */
+  void Open();
+
+  /** Persist and close the current segment. */
+  void Close();
+
+  /**
+   * Write the contents of the buffer to the current segment.
+   * @param buffer buffer of serialized log records, emptied by this call
+   * @param commits commit callbacks for the commit records in the buffer
+   * @return number of bytes written
+   */
+  uint64_t Append(BufferedLogWriter *buffer, const std::vector<CommitCallback> &commits);
+
+  /**
+   * @param last_buffer the last buffer that was appended to the current segment
+   * @return true if the current segment is full and the log can be cut after last_buffer
+   */
+  bool ShouldRotate(const BufferedLogWriter &last_buffer) const {
+    return current_size_ >= segment_size_ && last_buffer.EndsOnRecordBoundary();
+  }
+
+  /** Persist and close the current segment, and start a new one. */
+  void Rotate();
+
+  /** Force everything written to the current segment to disk. */
+  void Persist();
+
+  /**
+   * Delete every closed segment that is covered by the given timestamp.
+   * @param covered_txn every transaction that started at or before this timestamp has finished and is durable elsewhere
+   * @return number of segments deleted
+   */
+  uint64_t RemoveCoveredSegments(transaction::timestamp_t covered_txn);
+
+  /** @return a snapshot of the segment index, ordered by segment id */
+  std::vector<LogSegmentInfo> GetSegments() const;
+
+  /** @return the configured segment size in bytes */
+  uint64_t GetSegmentSize() const { return segment_size_; }
+
+  /**
+   * @param log_file_path base path of the log
+   * @param segment_id sequence number of the segment
+   * @return path to the segment file
+   */
+  static std::string SegmentPath(const std::string &log_file_path, uint64_t segment_id);
+
+  /**
+   * Build the segment index for the segments of the given log that exist on disk.
+   * @param log_file_path base path of the log
+   * @return the segments ordered by segment id, empty if the log is not segmented
+   */
+  static std::vector<LogSegmentInfo> ListSegments(const std::string &log_file_path);
+
+  /**
+   * @param segments segment index ordered by segment id
+   * @param replay_after only transactions that started after this timestamp have to be replayed
+   * @return position of the first segment that has to be replayed, segments.size() if none
+   */
+  static uint64_t FirstSegmentToReplay(const std::vector<LogSegmentInfo> &segments,
+                                       transaction::timestamp_t replay_after);
+
+ private:
+  const std::string log_file_path_;
+  const uint64_t segment_size_;
+
+  int out_ = -1;              // fd of the current segment, or -1 if closed
+  uint64_t current_size_ = 0;  // bytes written to the current segment, including the header
+  LogSegmentHeader current_header_;
+
+  // Protects segments_ and segment_open_, which are read and truncated by threads other than the log consumer
+  mutable common::SpinLatch segments_latch_;
+  std::vector<LogSegmentInfo> segments_;
+  bool segment_open_ = false;  // true if the last entry in segments_ is the segment being written to
+
+  void OpenSegment(uint64_t segment_id);
+  void CloseSegment();
+  void SyncDirectory() const;
+};
+
+}  // namespace noisepage::storage
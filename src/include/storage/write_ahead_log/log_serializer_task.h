@@ -192,7 +192,8 @@ class LogSerializerTask : public common::DedicatedThreadTask {
 
   /**
    * Hand over the current buffer and commit callbacks for commit records in that buffer to the log consumer task
+   * @param ends_on_record_boundary false if the last record in the buffer may continue in the next buffer
    */
-  void HandFilledBufferToWriter();
+  void HandFilledBufferToWriter(bool ends_on_record_boundary = true);
 };
 }  // namespace noisepage::storage
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/macros.h"
+#include "storage/write_ahead_log/log_io.h"
+
+struct io_uring;
+
+namespace noisepage::storage {
+
+/**
+ * An UringLogWriter writes the log file through io_uring instead of blocking write() and fdatasync() calls.
+ *
+ * Appended buffers are copied into a small ring of page-aligned staging chunks that are registered with the kernel, so
+ * the BufferedLogWriter can be handed back to the serializer right away. Full chunks are written in the background,
+ * and Persist() queues an fdatasync behind all outstanding writes without waiting for it. The log consumer thread thus
+ * only blocks when every staging chunk is still being written, or when it explicitly waits for a persist.
+ *
+ * If the log file is opened with O_DIRECT, every write has to cover whole blocks. The partially filled tail of the log
+ * is then written padded with zeros, and rewritten once more records are appended to it. The padding is truncated when
+ * the writer is closed. After a crash, recovery treats a record size of 0 as the end of the log.
+ *
+ * Only the log consumer thread may use an UringLogWriter.
+ */
+class UringLogWriter {
+ public:
+  /** Block size that O_DIRECT writes are aligned to. */
+  static constexpr uint64_t DIRECT_IO_ALIGNMENT = 4096;
+  /** Size of each staging chunk. */
+  static constexpr uint64_t STAGING_CHUNK_SIZE = 64 * common::Constants::LOG_BUFFER_SIZE;
+  /** Number of staging chunks, i.e., the maximum number of chunks that can be written concurrently. */
+  static constexpr uint32_t NUM_STAGING_CHUNKS = 8;
+
+  /**
+   * Open the given log file for writing through io_uring. New entries are appended to the end of the file.
+   * @param log_file_path path to the log file
+   * @param direct_io true to bypass the page cache with O_DIRECT. Falls back to buffered I/O if the file system does
+   *                  not support O_DIRECT.
+   * @return the writer, or nullptr if io_uring is not available, in which case the caller should fall back to
+   *         BufferedLogWriter
+   */
+  static std::unique_ptr<UringLogWriter> Open(const std::string &log_file_path, bool direct_io);
+
+  DISALLOW_COPY_AND_MOVE(UringLogWriter)
+
+  /** Closes the log file if Close() has not been called yet. */
+  ~UringLogWriter();
+
+  /**
+   * Copy the contents of the buffer into the log. The buffer is empty afterwards and may be reused immediately.
+   * @param buffer buffer of serialized log records
+   * @return number of bytes appended
+   */
+  uint64_t Append(BufferedLogWriter *buffer);
+
+  /**
+   * Write out everything appended so far and queue an fdatasync behind it. Does not wait for the sync to finish.
+   * @return sequence number of the sync, which is done once PersistedUpTo() reaches it
+   */
+  uint64_t Persist();
+
+  /**
+   * Process the completed writes and syncs.
+   * @param wait true to block until every sync queued so far has finished
+   * @return sequence number of the newest finished sync. Everything appended before that sync was queued is durable.
+   */
+  uint64_t PersistedUpTo(bool wait);
+
+  /** Wait for all outstanding I/O, truncate the O_DIRECT padding, persist and close the log file. */
+  void Close();
+
+  /** @return true if the log file is opened with O_DIRECT */
+  bool IsDirectIo() const { return direct_io_; }
+
+ private:
+  /** A page-aligned buffer that is registered with the ring and written to a fixed offset of the log file. */
+  struct StagingChunk {
+    char *data_;                // STAGING_CHUNK_SIZE bytes of registered memory
+    uint64_t file_offset_;      // offset in the log file that data_ is written to
+    uint64_t filled_ = 0;       // bytes of data_ that hold log records
+    uint64_t submitted_ = 0;    // bytes of data_ that have been submitted for writing
+    uint32_t num_pending_ = 0;  // number of writes of this chunk that have not completed yet
+  };
+
+  UringLogWriter(io_uring *ring, int out, bool direct_io, uint64_t file_size);
+
+  io_uring *const ring_;  // owned, set up by Open()
+  int out_;               // fd of the log file, or -1 if closed
+  const bool direct_io_;
+  bool registered_buffers_ = false;  // false if the staging chunks could not be registered, e.g., due to RLIMIT_MEMLOCK
+  std::vector<StagingChunk> chunks_;
+  uint32_t current_chunk_ = 0;  // chunk that is currently appended to
+
+  uint64_t syncs_queued_ = 0;     // number of syncs submitted so far
+  uint64_t syncs_completed_ = 0;  // number of syncs completed so far, which complete in order
+
+  /** Submit a write of the appended but not yet submitted part of the current chunk. */
+  void SubmitCurrentChunk();
+
+  /** Start appending to the next chunk, waiting for its previous writes to complete if necessary. */
+  void AdvanceChunk();
+
+  /**
+   * Process completion events.
+   * @param min_completions number of completions to block for
+   */
+  void ProcessCompletions(uint32_t min_completions);
+};
+
+}  // namespace noisepage::storage
@@ -79,6 +79,8 @@ class TrafficCop {
    * @param optimizer_timeout for optimizer calls
    * @param use_query_cache whether to cache physical plans and generated code for Extended Query protocol
    * @param execution_mode how to run executable queries after code generation
+   * @param park_connection_on_commit whether connections wait for their commits to become durable without blocking
+   *                                  their network thread, @see EndTransaction
    */
   TrafficCop(common::ManagedPointer<transaction::TransactionManager> txn_manager,
              common::ManagedPointer<catalog::Catalog> catalog,
@@ -86,7 +88,8 @@ class TrafficCop {
              common::ManagedPointer<storage::RecoveryManager> recovery_manager,
              common::ManagedPointer<settings::SettingsManager> settings_manager,
              common::ManagedPointer<optimizer::StatsStorage> stats_storage, uint64_t optimizer_timeout,
-             bool use_query_cache, const execution::vm::ExecutionMode execution_mode)
+             bool use_query_cache, const execution::vm::ExecutionMode execution_mode,
+             bool park_connection_on_commit)
       : txn_manager_(txn_manager),
         catalog_(catalog),
         replication_manager_(replication_manager),
@@ -95,7 +98,8 @@ class TrafficCop {
         stats_storage_(stats_storage),
         optimizer_timeout_(optimizer_timeout),
         use_query_cache_(use_query_cache),
-        execution_mode_(execution_mode) {}
+        execution_mode_(execution_mode),
+        park_connection_on_commit_(park_connection_on_commit) {}
 
   virtual ~TrafficCop() = default;
 
@@ -148,7 +152,12 @@ class TrafficCop {
   void BeginTransaction(common::ManagedPointer<network::ConnectionContext> connection_ctx) const;
 
   /**
-   * Calls to txn manager to end txn, and updates ConnectionContext state
+   * Calls to txn manager to end txn, and updates ConnectionContext state.
+   *
+   * A commit only returns once the client may be told that the commit is complete, unless the connection can be parked.
+   * In that case the commit returns right away with the connection context's CommitPending() flag set, and the
+   * connection context's callback is invoked once the commit is durable (and replicated, if needed). The caller must
+   * not send anything to the client until then.
    * @param connection_ctx context to release its txn
    * @param query_type if the txn is being ended with COMMIT or ROLLBACK
    */
@@ -275,6 +284,7 @@ class TrafficCop {
   uint64_t optimizer_timeout_;
   const bool use_query_cache_;
   const execution::vm::ExecutionMode execution_mode_;
+  const bool park_connection_on_commit_;
 };
 
 }  // namespace noisepage::trafficcop
@@ -104,6 +104,9 @@ class TransactionManager {
   /** @return The default transaction policy. */
   const TransactionPolicy &GetDefaultTransactionPolicy() const { return default_txn_policy_; }
 
+  /** @return True if committed transactions are logged, i.e., they are recovered and may be replicated. */
+  bool IsLoggingEnabled() const { return log_manager_ != DISABLED; }
+
  private:
   const common::ManagedPointer<TimestampManager> timestamp_manager_;
   const common::ManagedPointer<DeferredActionManager> deferred_action_manager_;
@@ -181,13 +181,20 @@ Transition ConnectionHandle::TryWrite() {
 Transition ConnectionHandle::Process() {
   auto transition = protocol_interpreter_->Process(io_wrapper_->GetReadBuffer(), io_wrapper_->GetWriteQueue(),
                                                    traffic_cop_, common::ManagedPointer(&context_));
+  if (context_.CommitPending()) {
+    // The results are queued up, but they must not reach the client before the commit is durable. Stop listening to
+    // the client until the commit callback wakes us up, so that this thread can serve other connections meanwhile.
+    NOISEPAGE_ASSERT(transition == Transition::PROCEED, "A parked connection must be resumed after the wakeup.");
+    context_.SetCommitPending(false);
+    return Transition::NEED_RESULT;
+  }
   return transition;
 }
 
 Transition ConnectionHandle::GetResult() {
-  // Wait until a network event happens.
+  // The connection was woken up after waiting for the system, e.g., for a commit to become durable. Listen to the client
+  // again, and let the protocol interpreter queue up whatever it held back. The queued results are written next.
   EventUtil::EventAdd(network_event_, EventUtil::WAIT_FOREVER);
-  // TODO(WAN): It is not clear to me what this function is doing. If someone figures it out, please update comment.
   protocol_interpreter_->GetResult(io_wrapper_->GetWriteQueue());
   return Transition::PROCEED;
 }
@@ -234,10 +241,9 @@ void ConnectionHandle::UpdateEventFlags(int16_t flags, int timeout_secs) {
 void ConnectionHandle::StopReceivingNetworkEvent() { EventUtil::EventDel(network_event_); }
 
 void ConnectionHandle::Callback(void *callback_args) {
-  // TODO(WAN): this is currently unused.
+  // This is invoked from other threads, e.g., the log consumer, so the state machine must not be touched here. The
+  // wakeup is handled by the connection's own thread once it is done processing, see Process().
   auto *const handle = reinterpret_cast<ConnectionHandle *>(callback_args);
-  NOISEPAGE_ASSERT(handle->state_machine_.CurrentState() == ConnState::PROCESS,
-                   "Should be waking up a ConnectionHandle that's in PROCESS state waiting on query result.");
   event_active(handle->workpool_event_, EV_WRITE, 0);
 }
 
@@ -252,6 +258,7 @@ void ConnectionHandle::ResetForReuse(connection_id_t connection_id, common::Mana
   network_event_ = nullptr;
   workpool_event_ = nullptr;
   context_.Reset();
+  context_.SetCallback(Callback, this);
   context_.SetConnectionID(connection_id);
 }
 
@@ -89,6 +89,16 @@ void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const Aggregate *op) {
   output_.emplace_back(new PropertySet(), std::vector<PropertySet *>{new PropertySet()});
 }
 
+void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const HashSetOp *op) {
+  // The hash table does not keep any order, so neither input has to provide one
+  output_.emplace_back(new PropertySet(), std::vector<PropertySet *>{new PropertySet(), new PropertySet()});
+}
+
+void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const Window *op) {
+  // The window sorts its input itself, and emits the partitions in no particular order
+  output_.emplace_back(new PropertySet(), std::vector<PropertySet *>{new PropertySet()});
+}
+
 void ChildPropertyDeriver::Visit(const Limit *op) {
   // Limit fulfill the internal sort property
   std::vector<PropertySet *> child_input_properties{new PropertySet()};
@@ -115,8 +125,11 @@ void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const OuterNLJoin *op) {}
 void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const InnerHashJoin *op) { DeriveForJoin(); }
 
 void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const LeftHashJoin *op) { DeriveForJoin(); }
-void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const RightHashJoin *op) {}
-void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const OuterHashJoin *op) {}
+void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const RightHashJoin *op) { DeriveForJoin(); }
+void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const OuterHashJoin *op) {
+  // Unmatched build rows are emitted after the probe finishes, so a sort on the probe side cannot be pushed down
+  output_.emplace_back(new PropertySet(), std::vector<PropertySet *>{new PropertySet(), new PropertySet()});
+}
 void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const LeftSemiHashJoin *op) { DeriveForJoin(); }
 
 void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const Insert *op) {
@@ -20,6 +20,7 @@ void TrivialCostModel::Visit(const IndexScan *op) {
   // This heuristic is not really good --- it merely picks the index based on
   // how many of those index's keys are set (op->GetBounds())
   output_cost_ = SCAN_COST - op->GetBounds().size();
+  if (!op->GetBounds().empty() && op->GetCoverAllColumns()) output_cost_ -= INDEX_ONLY_DISCOUNT;
 }
 
 void TrivialCostModel::Visit(const InnerIndexJoin *op) {
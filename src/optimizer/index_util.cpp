@@ -1,5 +1,6 @@
 #include "optimizer/index_util.h"
 
+#include <algorithm>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -9,10 +10,102 @@
 #include "catalog/catalog_accessor.h"
 #include "catalog/index_schema.h"
 #include "optimizer/properties.h"
+#include "parser/expression/column_value_expression.h"
+#include "parser/expression/constant_value_expression.h"
 #include "parser/expression_util.h"
 
 namespace noisepage::optimizer {
 
+namespace {
+
+/** Compares two non-NULL constants of comparable types, and stores -1, 0, or 1 into cmp. */
+bool CompareConstants(const parser::ConstantValueExpression &lhs, const parser::ConstantValueExpression &rhs,
+                      int *cmp) {
+  if (lhs.IsNull() || rhs.IsNull()) return false;
+
+  auto is_numeric = [](type::TypeId type) {
+    return type == type::TypeId::TINYINT || type == type::TypeId::SMALLINT || type == type::TypeId::INTEGER ||
+           type == type::TypeId::BIGINT || type == type::TypeId::REAL;
+  };
+  auto compare = [cmp](const auto &l, const auto &r) {
+    *cmp = l < r ? -1 : (r < l ? 1 : 0);
+    return true;
+  };
+
+  auto ltype = lhs.GetReturnValueType();
+  auto rtype = rhs.GetReturnValueType();
+  if (is_numeric(ltype) && is_numeric(rtype)) {
+    if (ltype == type::TypeId::REAL || rtype == type::TypeId::REAL) {
+      auto as_double = [](const parser::ConstantValueExpression &value) {
+        return value.GetReturnValueType() == type::TypeId::REAL ? value.Peek<double>()
+                                                                 : static_cast<double>(value.Peek<int64_t>());
+      };
+      return compare(as_double(lhs), as_double(rhs));
+    }
+    return compare(lhs.Peek<int64_t>(), rhs.Peek<int64_t>());
+  }
+
+  if (ltype != rtype) return false;
+  switch (ltype) {
+    case type::TypeId::VARCHAR:
+      return compare(lhs.Peek<std::string_view>(), rhs.Peek<std::string_view>());
+    case type::TypeId::DATE:
+      return compare(lhs.Peek<execution::sql::Date>(), rhs.Peek<execution::sql::Date>());
+    case type::TypeId::TIMESTAMP:
+      return compare(lhs.Peek<execution::sql::Timestamp>(), rhs.Peek<execution::sql::Timestamp>());
+    default:
+      return false;
+  }
+}
+
+/** Normalizes a [column] (=/!=/>/>=/</<=) [constant] comparison, so that the column is on the left side. */
+bool GetColumnComparison(common::ManagedPointer<parser::AbstractExpression> expr, parser::ExpressionType *type,
+                         common::ManagedPointer<parser::ColumnValueExpression> *column,
+                         common::ManagedPointer<parser::ConstantValueExpression> *value) {
+  *type = expr->GetExpressionType();
+  switch (*type) {
+    case parser::ExpressionType::COMPARE_EQUAL:
+    case parser::ExpressionType::COMPARE_NOT_EQUAL:
+    case parser::ExpressionType::COMPARE_LESS_THAN:
+    case parser::ExpressionType::COMPARE_GREATER_THAN:
+    case parser::ExpressionType::COMPARE_LESS_THAN_OR_EQUAL_TO:
+    case parser::ExpressionType::COMPARE_GREATER_THAN_OR_EQUAL_TO:
+      break;
+    default:
+      return false;
+  }
+
+  auto lhs = expr->GetChild(0);
+  auto rhs = expr->GetChild(1);
+  if (rhs->GetExpressionType() == parser::ExpressionType::COLUMN_VALUE &&
+      lhs->GetExpressionType() == parser::ExpressionType::VALUE_CONSTANT) {
+    std::swap(lhs, rhs);
+    *type = parser::ExpressionUtil::ReverseComparisonExpressionType(*type);
+  }
+  if (lhs->GetExpressionType() != parser::ExpressionType::COLUMN_VALUE ||
+      rhs->GetExpressionType() != parser::ExpressionType::VALUE_CONSTANT) {
+    return false;
+  }
+
+  *column = lhs.CastManagedPointerTo<parser::ColumnValueExpression>();
+  *value = rhs.CastManagedPointerTo<parser::ConstantValueExpression>();
+  return true;
+}
+
+/** Collects the conjuncts of an expression. */
+void SplitConjuncts(common::ManagedPointer<parser::AbstractExpression> expr,
+                    std::vector<common::ManagedPointer<parser::AbstractExpression>> *conjuncts) {
+  if (expr->GetExpressionType() == parser::ExpressionType::CONJUNCTION_AND) {
+    for (const auto &child : expr->GetChildren()) {
+      SplitConjuncts(child, conjuncts);
+    }
+  } else {
+    conjuncts->emplace_back(expr);
+  }
+}
+
+}  // namespace
+
 bool IndexUtil::SatisfiesSortWithIndex(catalog::CatalogAccessor *accessor, const PropertySort *prop,
                                        catalog::table_oid_t tbl_oid, catalog::index_oid_t idx_oid) {
   auto &index_schema = accessor->GetIndexSchema(idx_oid);
@@ -58,7 +151,7 @@ std::pair<bool, bool> IndexUtil::SatisfiesPredicateWithIndex(
     planner::IndexScanType *scan_type,
     std::unordered_map<catalog::indexkeycol_oid_t, std::vector<planner::IndexExpression>> *bounds) {
   auto &index_schema = accessor->GetIndexSchema(index_oid);
-  if (!SatisfiesBaseColumnRequirement(index_schema)) {
+  if (!SatisfiesBaseColumnRequirement(index_schema) || !SatisfiesPartialIndexPredicate(index_schema, predicates)) {
     return std::make_pair(false, false);
   }
 
@@ -241,6 +334,152 @@ std::pair<bool, bool> IndexUtil::CheckPredicates(
   return std::make_pair(!bounds->empty(), covered_all_columns);
 }
 
+bool IndexUtil::CoversColumnsWithIndex(catalog::CatalogAccessor *accessor, catalog::table_oid_t tbl_oid,
+                                       catalog::index_oid_t idx_oid,
+                                       const std::vector<catalog::col_oid_t> &col_oids) {
+  auto &index_schema = accessor->GetIndexSchema(idx_oid);
+  if (!SatisfiesBaseColumnRequirement(index_schema)) {
+    return false;
+  }
+
+  std::vector<catalog::col_oid_t> mapped_cols;
+  std::unordered_map<catalog::col_oid_t, catalog::indexkeycol_oid_t> lookup;
+  if (!ConvertIndexKeyOidToColOid(accessor, tbl_oid, index_schema, &lookup, &mapped_cols)) {
+    return false;
+  }
+
+  return std::all_of(col_oids.begin(), col_oids.end(),
+                     [&lookup](catalog::col_oid_t col_oid) { return lookup.find(col_oid) != lookup.end(); });
+}
+
+bool IndexUtil::SatisfiesPartialIndexPredicate(const catalog::IndexSchema &schema,
+                                               const std::vector<AnnotatedExpression> &predicates) {
+  if (!schema.Partial()) {
+    return true;
+  }
+
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> index_conjuncts;
+  SplitConjuncts(common::ManagedPointer(const_cast<parser::AbstractExpression *>(schema.Predicate().Get())),
+                 &index_conjuncts);
+  return std::all_of(index_conjuncts.begin(), index_conjuncts.end(), [&predicates](auto index_conjunct) {
+    return std::any_of(predicates.begin(), predicates.end(), [index_conjunct](const AnnotatedExpression &pred) {
+      auto expr = pred.GetExpr();
+      return !expr->HasSubquery() &&
+             ImpliesPredicate(expr, index_conjunct);
+    });
+  });
+}
+
+bool IndexUtil::ImpliesPredicate(common::ManagedPointer<parser::AbstractExpression> expr,
+                                 common::ManagedPointer<parser::AbstractExpression> implied) {
+  if (EquivalentExpressions(expr, implied)) {
+    return true;
+  }
+
+  parser::ExpressionType type;
+  common::ManagedPointer<parser::ColumnValueExpression> column;
+  common::ManagedPointer<parser::ConstantValueExpression> value;
+  if (!GetColumnComparison(expr, &type, &column, &value)) {
+    return false;
+  }
+
+  // A comparison with a constant is never true for NULL.
+  if (implied->GetExpressionType() == parser::ExpressionType::OPERATOR_IS_NOT_NULL) {
+    return !value->IsNull() &&
+           EquivalentExpressions(column.CastManagedPointerTo<parser::AbstractExpression>(), implied->GetChild(0));
+  }
+
+  parser::ExpressionType implied_type;
+  common::ManagedPointer<parser::ColumnValueExpression> implied_column;
+  common::ManagedPointer<parser::ConstantValueExpression> implied_value;
+  if (!GetColumnComparison(implied, &implied_type, &implied_column, &implied_value) ||
+      column->GetColumnOid() != implied_column->GetColumnOid() ||
+      column->GetTableOid() != implied_column->GetTableOid()) {
+    return false;
+  }
+
+  // cmp is the sign of (value - implied_value).
+  int cmp;
+  if (!CompareConstants(*value, *implied_value, &cmp)) {
+    return false;
+  }
+
+  switch (implied_type) {
+    case parser::ExpressionType::COMPARE_EQUAL:
+      return type == parser::ExpressionType::COMPARE_EQUAL && cmp == 0;
+    case parser::ExpressionType::COMPARE_NOT_EQUAL:
+      switch (type) {
+        case parser::ExpressionType::COMPARE_EQUAL:
+          return cmp != 0;
+        case parser::ExpressionType::COMPARE_NOT_EQUAL:
+          return cmp == 0;
+        case parser::ExpressionType::COMPARE_LESS_THAN:
+          return cmp <= 0;
+        case parser::ExpressionType::COMPARE_LESS_THAN_OR_EQUAL_TO:
+          return cmp < 0;
+        case parser::ExpressionType::COMPARE_GREATER_THAN:
+          return cmp >= 0;
+        case parser::ExpressionType::COMPARE_GREATER_THAN_OR_EQUAL_TO:
+          return cmp > 0;
+        default:
+          return false;
+      }
+    case parser::ExpressionType::COMPARE_LESS_THAN:
+      return (type == parser::ExpressionType::COMPARE_EQUAL && cmp < 0) ||
+             (type == parser::ExpressionType::COMPARE_LESS_THAN && cmp <= 0) ||
+             (type == parser::ExpressionType::COMPARE_LESS_THAN_OR_EQUAL_TO && cmp < 0);
+    case parser::ExpressionType::COMPARE_LESS_THAN_OR_EQUAL_TO:
+      return (type == parser::ExpressionType::COMPARE_EQUAL || type == parser::ExpressionType::COMPARE_LESS_THAN ||
+              type == parser::ExpressionType::COMPARE_LESS_THAN_OR_EQUAL_TO) &&
+             cmp <= 0;
+    case parser::ExpressionType::COMPARE_GREATER_THAN:
+      return (type == parser::ExpressionType::COMPARE_EQUAL && cmp > 0) ||
+             (type == parser::ExpressionType::COMPARE_GREATER_THAN && cmp >= 0) ||
+             (type == parser::ExpressionType::COMPARE_GREATER_THAN_OR_EQUAL_TO && cmp > 0);
+    case parser::ExpressionType::COMPARE_GREATER_THAN_OR_EQUAL_TO:
+      return (type == parser::ExpressionType::COMPARE_EQUAL || type == parser::ExpressionType::COMPARE_GREATER_THAN ||
+              type == parser::ExpressionType::COMPARE_GREATER_THAN_OR_EQUAL_TO) &&
+             cmp >= 0;
+    default:
+      return false;
+  }
+}
+
+bool IndexUtil::EquivalentExpressions(common::ManagedPointer<parser::AbstractExpression> lhs,
+                                      common::ManagedPointer<parser::AbstractExpression> rhs) {
+  if (lhs->GetExpressionType() != rhs->GetExpressionType()) return false;
+
+  switch (lhs->GetExpressionType()) {
+    case parser::ExpressionType::COLUMN_VALUE: {
+      auto lhs_col = lhs.CastManagedPointerTo<parser::ColumnValueExpression>();
+      auto rhs_col = rhs.CastManagedPointerTo<parser::ColumnValueExpression>();
+      return lhs_col->GetTableOid() == rhs_col->GetTableOid() && lhs_col->GetColumnOid() == rhs_col->GetColumnOid();
+    }
+    case parser::ExpressionType::VALUE_CONSTANT: {
+      int cmp;
+      const auto &lhs_val = *lhs.CastManagedPointerTo<parser::ConstantValueExpression>();
+      const auto &rhs_val = *rhs.CastManagedPointerTo<parser::ConstantValueExpression>();
+      if (lhs_val.IsNull() || rhs_val.IsNull()) return lhs_val.IsNull() && rhs_val.IsNull();
+      return CompareConstants(lhs_val, rhs_val, &cmp) && cmp == 0;
+    }
+    case parser::ExpressionType::FUNCTION:
+    case parser::ExpressionType::VALUE_PARAMETER:
+    case parser::ExpressionType::ROW_SUBQUERY:
+      // Functions are compared by name, and parameters are only known at execution time.
+      return *lhs == *rhs;
+    default:
+      break;
+  }
+
+  if (lhs->GetChildrenSize() != rhs->GetChildrenSize()) return false;
+  for (size_t i = 0; i < lhs->GetChildrenSize(); i++) {
+    if (!EquivalentExpressions(lhs->GetChild(i), rhs->GetChild(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool IndexUtil::ConvertIndexKeyOidToColOid(catalog::CatalogAccessor *accessor, catalog::table_oid_t tbl_oid,
                                            const catalog::IndexSchema &schema,
                                            std::unordered_map<catalog::col_oid_t, catalog::indexkeycol_oid_t> *key_map,
@@ -132,6 +132,56 @@ void InputColumnDeriver::Visit(const SortGroupBy *op) { AggregateHelper(op); }
 
 void InputColumnDeriver::Visit(const Aggregate *op) { AggregateHelper(op); }
 
+void InputColumnDeriver::Visit(const HashSetOp *op) {
+  // A set operation outputs whole rows of its inputs, so each input produces its select list in order and the set
+  // operation outputs the left one. Nothing above the set operation can ask for any other column.
+  auto output_cols = op->GetLeftColumns();
+  PT2 child_cols = PT2{op->GetLeftColumns(), op->GetRightColumns()};
+  output_input_cols_ = std::make_pair(std::move(output_cols), std::move(child_cols));
+}
+
+void InputColumnDeriver::Visit(const Window *op) {
+  // The window outputs the window functions it computes and passes through whatever else is required, which
+  // includes the window functions computed by windows below it. Its own window functions need the columns their
+  // arguments and keys refer to.
+  ExprSet window_exprs;
+  for (const auto &window_expr : op->GetWindowExprs()) {
+    window_exprs.insert(window_expr);
+  }
+
+  ExprMap output_cols_map;
+  for (auto expr : required_cols_) {
+    parser::ExpressionUtil::GetTupleValueExprs(&output_cols_map, expr);
+  }
+  for (const auto &window_expr : op->GetWindowExprs()) {
+    if (output_cols_map.count(window_expr) == 0U) {
+      output_cols_map.emplace(window_expr, output_cols_map.size());
+    }
+  }
+
+  ExprSet input_cols_set;
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> output_cols(output_cols_map.size());
+  for (auto &entry : output_cols_map) {
+    output_cols[entry.second] = entry.first;
+    if (window_exprs.count(entry.first) == 0U) {
+      input_cols_set.insert(entry.first);
+    }
+  }
+  for (const auto &window_expr : op->GetWindowExprs()) {
+    for (const auto &child : window_expr->GetChildren()) {
+      parser::ExpressionUtil::GetTupleValueExprs(&input_cols_set, child);
+    }
+  }
+
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> input_cols;
+  for (auto &col : input_cols_set) {
+    input_cols.push_back(col);
+  }
+
+  PT2 child_cols = PT2{input_cols};
+  output_input_cols_ = std::make_pair(std::move(output_cols), std::move(child_cols));
+}
+
 void InputColumnDeriver::Visit(const InnerIndexJoin *op) {
   ExprSet input_cols_set;
   for (auto &join_keys : op->GetJoinKeys()) {
@@ -221,13 +271,9 @@ void InputColumnDeriver::Visit(const LeftSemiHashJoin *op) { JoinHelper(op); }
 
 void InputColumnDeriver::Visit(const LeftHashJoin *op) { JoinHelper(op); }
 
-void InputColumnDeriver::Visit(UNUSED_ATTRIBUTE const RightHashJoin *op) {
-  NOISEPAGE_ASSERT(0, "RightHashJoin not supported");
-}
+void InputColumnDeriver::Visit(const RightHashJoin *op) { JoinHelper(op); }
 
-void InputColumnDeriver::Visit(UNUSED_ATTRIBUTE const OuterHashJoin *op) {
-  NOISEPAGE_ASSERT(0, "OuterHashJoin not supported");
-}
+void InputColumnDeriver::Visit(const OuterHashJoin *op) { JoinHelper(op); }
 
 void InputColumnDeriver::Visit(UNUSED_ATTRIBUTE const Insert *op) {
   auto input = std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>>{};
@@ -376,6 +422,16 @@ void InputColumnDeriver::JoinHelper(const BaseOperatorNodeContents *op) {
     join_conds = join_op->GetJoinPredicates();
     left_keys = join_op->GetLeftKeys();
     right_keys = join_op->GetRightKeys();
+  } else if (op->GetOpType() == OpType::RIGHTHASHJOIN) {
+    auto join_op = reinterpret_cast<const RightHashJoin *>(op);
+    join_conds = join_op->GetJoinPredicates();
+    left_keys = join_op->GetLeftKeys();
+    right_keys = join_op->GetRightKeys();
+  } else if (op->GetOpType() == OpType::OUTERHASHJOIN) {
+    auto join_op = reinterpret_cast<const OuterHashJoin *>(op);
+    join_conds = join_op->GetJoinPredicates();
+    left_keys = join_op->GetLeftKeys();
+    right_keys = join_op->GetRightKeys();
   } else if (op->GetOpType() == OpType::INNERNLJOIN) {
     auto join_op = reinterpret_cast<const InnerNLJoin *>(op);
     join_conds = join_op->GetJoinPredicates();
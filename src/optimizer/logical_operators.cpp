@@ -319,6 +319,62 @@ common::hash_t LogicalLimit::Hash() const {
   return hash;
 }
 
+//===--------------------------------------------------------------------===//
+// LogicalSetOp
+//===--------------------------------------------------------------------===//
+BaseOperatorNodeContents *LogicalSetOp::Copy() const { return new LogicalSetOp(*this); }
+
+Operator LogicalSetOp::Make(planner::SetOpType set_op,
+                            std::vector<common::ManagedPointer<parser::AbstractExpression>> &&left_columns,
+                            std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_columns) {
+  NOISEPAGE_ASSERT(left_columns.size() == right_columns.size(), "Set operation inputs must have the same columns");
+  auto *op = new LogicalSetOp();
+  op->set_op_ = set_op;
+  op->left_columns_ = std::move(left_columns);
+  op->right_columns_ = std::move(right_columns);
+  return Operator(common::ManagedPointer<BaseOperatorNodeContents>(op));
+}
+
+bool LogicalSetOp::operator==(const BaseOperatorNodeContents &r) {
+  if (r.GetOpType() != OpType::LOGICALSETOP) return false;
+  const LogicalSetOp &node = *static_cast<const LogicalSetOp *>(&r);
+  if (set_op_ != node.set_op_) return false;
+  if (left_columns_ != node.left_columns_) return false;
+  return right_columns_ == node.right_columns_;
+}
+
+common::hash_t LogicalSetOp::Hash() const {
+  common::hash_t hash = BaseOperatorNodeContents::Hash();
+  hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(set_op_));
+  hash = common::HashUtil::CombineHashInRange(hash, left_columns_.begin(), left_columns_.end());
+  hash = common::HashUtil::CombineHashInRange(hash, right_columns_.begin(), right_columns_.end());
+  return hash;
+}
+
+//===--------------------------------------------------------------------===//
+// LogicalWindow
+//===--------------------------------------------------------------------===//
+BaseOperatorNodeContents *LogicalWindow::Copy() const { return new LogicalWindow(*this); }
+
+Operator LogicalWindow::Make(std::vector<common::ManagedPointer<parser::AbstractExpression>> &&window_exprs) {
+  NOISEPAGE_ASSERT(!window_exprs.empty(), "Window operator without window functions");
+  auto *op = new LogicalWindow();
+  op->window_exprs_ = std::move(window_exprs);
+  return Operator(common::ManagedPointer<BaseOperatorNodeContents>(op));
+}
+
+bool LogicalWindow::operator==(const BaseOperatorNodeContents &r) {
+  if (r.GetOpType() != OpType::LOGICALWINDOW) return false;
+  const LogicalWindow &node = *static_cast<const LogicalWindow *>(&r);
+  return window_exprs_ == node.window_exprs_;
+}
+
+common::hash_t LogicalWindow::Hash() const {
+  common::hash_t hash = BaseOperatorNodeContents::Hash();
+  hash = common::HashUtil::CombineHashInRange(hash, window_exprs_.begin(), window_exprs_.end());
+  return hash;
+}
+
 //===--------------------------------------------------------------------===//
 // LogicalDelete
 //===--------------------------------------------------------------------===//
@@ -852,7 +908,8 @@ BaseOperatorNodeContents *LogicalCreateIndex::Copy() const { return new LogicalC
 Operator LogicalCreateIndex::Make(catalog::db_oid_t database_oid, catalog::namespace_oid_t namespace_oid,
                                   catalog::table_oid_t table_oid, parser::IndexType index_type, bool unique,
                                   std::string index_name,
-                                  std::vector<common::ManagedPointer<parser::AbstractExpression>> index_attrs) {
+                                  std::vector<common::ManagedPointer<parser::AbstractExpression>> index_attrs,
+                                  common::ManagedPointer<parser::AbstractExpression> index_predicate) {
   auto *op = new LogicalCreateIndex();
   op->database_oid_ = database_oid;
   op->namespace_oid_ = namespace_oid;
@@ -861,6 +918,7 @@ Operator LogicalCreateIndex::Make(catalog::db_oid_t database_oid, catalog::names
   op->unique_index_ = unique;
   op->index_name_ = std::move(index_name);
   op->index_attrs_ = std::move(index_attrs);
+  op->index_predicate_ = index_predicate;
   return Operator(common::ManagedPointer<BaseOperatorNodeContents>(op));
 }
 
@@ -875,6 +933,7 @@ common::hash_t LogicalCreateIndex::Hash() const {
   for (const auto &attr : index_attrs_) {
     hash = common::HashUtil::CombineHashes(hash, attr->Hash());
   }
+  if (index_predicate_ != nullptr) hash = common::HashUtil::CombineHashes(hash, index_predicate_->Hash());
   return hash;
 }
 
@@ -891,7 +950,8 @@ bool LogicalCreateIndex::operator==(const BaseOperatorNodeContents &r) {
   for (size_t i = 0; i < index_attrs_.size(); i++) {
     if (*(index_attrs_[i]) != *(node.index_attrs_[i])) return false;
   }
-  return (true);
+  if (index_predicate_ == nullptr) return node.index_predicate_ == nullptr;
+  return node.index_predicate_ != nullptr && *index_predicate_ == *node.index_predicate_;
 }
 
 //===--------------------------------------------------------------------===//
@@ -1270,6 +1330,10 @@ const char *OperatorNodeContents<LogicalDelete>::name = "LogicalDelete";
 template <>
 const char *OperatorNodeContents<LogicalLimit>::name = "LogicalLimit";
 template <>
+const char *OperatorNodeContents<LogicalSetOp>::name = "LogicalSetOp";
+template <>
+const char *OperatorNodeContents<LogicalWindow>::name = "LogicalWindow";
+template <>
 const char *OperatorNodeContents<LogicalExportExternalFile>::name = "LogicalExportExternalFile";
 template <>
 const char *OperatorNodeContents<LogicalCreateDatabase>::name = "LogicalCreateDatabase";
@@ -1342,6 +1406,10 @@ OpType OperatorNodeContents<LogicalDelete>::type = OpType::LOGICALDELETE;
 template <>
 OpType OperatorNodeContents<LogicalLimit>::type = OpType::LOGICALLIMIT;
 template <>
+OpType OperatorNodeContents<LogicalSetOp>::type = OpType::LOGICALSETOP;
+template <>
+OpType OperatorNodeContents<LogicalWindow>::type = OpType::LOGICALWINDOW;
+template <>
 OpType OperatorNodeContents<LogicalExportExternalFile>::type = OpType::LOGICALEXPORTEXTERNALFILE;
 template <>
 OpType OperatorNodeContents<LogicalCreateDatabase>::type = OpType::LOGICALCREATEDATABASE;
@@ -589,22 +589,44 @@ bool LeftHashJoin::operator==(const BaseOperatorNodeContents &r) {
 //===--------------------------------------------------------------------===//
 BaseOperatorNodeContents *RightHashJoin::Copy() const { return new RightHashJoin(*this); }
 
-Operator RightHashJoin::Make(common::ManagedPointer<parser::AbstractExpression> join_predicate) {
+Operator RightHashJoin::Make(std::vector<AnnotatedExpression> &&join_predicates,
+                             std::vector<common::ManagedPointer<parser::AbstractExpression>> &&left_keys,
+                             std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_keys) {
   auto *join = new RightHashJoin();
-  join->join_predicate_ = join_predicate;
+  join->join_predicates_ = std::move(join_predicates);
+  join->left_keys_ = std::move(left_keys);
+  join->right_keys_ = std::move(right_keys);
   return Operator(common::ManagedPointer<BaseOperatorNodeContents>(join));
 }
 
 common::hash_t RightHashJoin::Hash() const {
   common::hash_t hash = BaseOperatorNodeContents::Hash();
-  hash = common::HashUtil::CombineHashes(hash, join_predicate_->Hash());
+  for (auto &expr : left_keys_) hash = common::HashUtil::CombineHashes(hash, expr->Hash());
+  for (auto &expr : right_keys_) hash = common::HashUtil::CombineHashes(hash, expr->Hash());
+  for (auto &pred : join_predicates_) {
+    auto expr = pred.GetExpr();
+    if (expr)
+      hash = common::HashUtil::SumHashes(hash, expr->Hash());
+    else
+      hash = common::HashUtil::SumHashes(hash, BaseOperatorNodeContents::Hash());
+  }
   return hash;
 }
 
 bool RightHashJoin::operator==(const BaseOperatorNodeContents &r) {
   if (r.GetOpType() != OpType::RIGHTHASHJOIN) return false;
-  const RightHashJoin &node = *static_cast<const RightHashJoin *>(&r);
-  return (*join_predicate_ == *(node.join_predicate_));
+  const RightHashJoin &node = *dynamic_cast<const RightHashJoin *>(&r);
+  if (left_keys_.size() != node.left_keys_.size() || right_keys_.size() != node.right_keys_.size() ||
+      join_predicates_.size() != node.join_predicates_.size())
+    return false;
+  if (join_predicates_ != node.join_predicates_) return false;
+  for (size_t i = 0; i < left_keys_.size(); i++) {
+    if (*(left_keys_[i]) != *(node.left_keys_[i])) return false;
+  }
+  for (size_t i = 0; i < right_keys_.size(); i++) {
+    if (*(right_keys_[i]) != *(node.right_keys_[i])) return false;
+  }
+  return true;
 }
 
 //===--------------------------------------------------------------------===//
@@ -612,22 +634,44 @@ bool RightHashJoin::operator==(const BaseOperatorNodeContents &r) {
 //===--------------------------------------------------------------------===//
 BaseOperatorNodeContents *OuterHashJoin::Copy() const { return new OuterHashJoin(*this); }
 
-Operator OuterHashJoin::Make(common::ManagedPointer<parser::AbstractExpression> join_predicate) {
+Operator OuterHashJoin::Make(std::vector<AnnotatedExpression> &&join_predicates,
+                             std::vector<common::ManagedPointer<parser::AbstractExpression>> &&left_keys,
+                             std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_keys) {
   auto *join = new OuterHashJoin();
-  join->join_predicate_ = join_predicate;
+  join->join_predicates_ = std::move(join_predicates);
+  join->left_keys_ = std::move(left_keys);
+  join->right_keys_ = std::move(right_keys);
   return Operator(common::ManagedPointer<BaseOperatorNodeContents>(join));
 }
 
 common::hash_t OuterHashJoin::Hash() const {
   common::hash_t hash = BaseOperatorNodeContents::Hash();
-  hash = common::HashUtil::CombineHashes(hash, join_predicate_->Hash());
+  for (auto &expr : left_keys_) hash = common::HashUtil::CombineHashes(hash, expr->Hash());
+  for (auto &expr : right_keys_) hash = common::HashUtil::CombineHashes(hash, expr->Hash());
+  for (auto &pred : join_predicates_) {
+    auto expr = pred.GetExpr();
+    if (expr)
+      hash = common::HashUtil::SumHashes(hash, expr->Hash());
+    else
+      hash = common::HashUtil::SumHashes(hash, BaseOperatorNodeContents::Hash());
+  }
   return hash;
 }
 
 bool OuterHashJoin::operator==(const BaseOperatorNodeContents &r) {
   if (r.GetOpType() != OpType::OUTERHASHJOIN) return false;
-  const OuterHashJoin &node = *static_cast<const OuterHashJoin *>(&r);
-  return (*join_predicate_ == *(node.join_predicate_));
+  const OuterHashJoin &node = *dynamic_cast<const OuterHashJoin *>(&r);
+  if (left_keys_.size() != node.left_keys_.size() || right_keys_.size() != node.right_keys_.size() ||
+      join_predicates_.size() != node.join_predicates_.size())
+    return false;
+  if (join_predicates_ != node.join_predicates_) return false;
+  for (size_t i = 0; i < left_keys_.size(); i++) {
+    if (*(left_keys_[i]) != *(node.left_keys_[i])) return false;
+  }
+  for (size_t i = 0; i < right_keys_.size(); i++) {
+    if (*(right_keys_[i]) != *(node.right_keys_[i])) return false;
+  }
+  return true;
 }
 
 //===--------------------------------------------------------------------===//
@@ -900,6 +944,62 @@ common::hash_t Aggregate::Hash() const {
   return hash;
 }
 
+//===--------------------------------------------------------------------===//
+// HashSetOp
+//===--------------------------------------------------------------------===//
+BaseOperatorNodeContents *HashSetOp::Copy() const { return new HashSetOp(*this); }
+
+Operator HashSetOp::Make(planner::SetOpType set_op,
+                         std::vector<common::ManagedPointer<parser::AbstractExpression>> &&left_columns,
+                         std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_columns) {
+  NOISEPAGE_ASSERT(left_columns.size() == right_columns.size(), "Set operation inputs must have the same columns");
+  auto *op = new HashSetOp();
+  op->set_op_ = set_op;
+  op->left_columns_ = std::move(left_columns);
+  op->right_columns_ = std::move(right_columns);
+  return Operator(common::ManagedPointer<BaseOperatorNodeContents>(op));
+}
+
+bool HashSetOp::operator==(const BaseOperatorNodeContents &r) {
+  if (r.GetOpType() != OpType::HASHSETOP) return false;
+  const HashSetOp &node = *static_cast<const HashSetOp *>(&r);
+  if (set_op_ != node.set_op_) return false;
+  if (left_columns_ != node.left_columns_) return false;
+  return right_columns_ == node.right_columns_;
+}
+
+common::hash_t HashSetOp::Hash() const {
+  common::hash_t hash = BaseOperatorNodeContents::Hash();
+  hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(set_op_));
+  hash = common::HashUtil::CombineHashInRange(hash, left_columns_.begin(), left_columns_.end());
+  hash = common::HashUtil::CombineHashInRange(hash, right_columns_.begin(), right_columns_.end());
+  return hash;
+}
+
+//===--------------------------------------------------------------------===//
+// Window
+//===--------------------------------------------------------------------===//
+BaseOperatorNodeContents *Window::Copy() const { return new Window(*this); }
+
+Operator Window::Make(std::vector<common::ManagedPointer<parser::AbstractExpression>> &&window_exprs) {
+  NOISEPAGE_ASSERT(!window_exprs.empty(), "Window operator without window functions");
+  auto *op = new Window();
+  op->window_exprs_ = std::move(window_exprs);
+  return Operator(common::ManagedPointer<BaseOperatorNodeContents>(op));
+}
+
+bool Window::operator==(const BaseOperatorNodeContents &r) {
+  if (r.GetOpType() != OpType::WINDOW) return false;
+  const Window &node = *static_cast<const Window *>(&r);
+  return window_exprs_ == node.window_exprs_;
+}
+
+common::hash_t Window::Hash() const {
+  common::hash_t hash = BaseOperatorNodeContents::Hash();
+  hash = common::HashUtil::CombineHashInRange(hash, window_exprs_.begin(), window_exprs_.end());
+  return hash;
+}
+
 //===--------------------------------------------------------------------===//
 // CreateDatabase
 //===--------------------------------------------------------------------===//
@@ -974,7 +1074,8 @@ BaseOperatorNodeContents *CreateIndex::Copy() const {
     columns.emplace_back(col);
   }
   auto schema = std::make_unique<catalog::IndexSchema>(std::move(columns), schema_->Type(), schema_->Unique(),
-                                                       schema_->Primary(), schema_->Exclusion(), schema_->Immediate());
+                                                       schema_->Primary(), schema_->Exclusion(), schema_->Immediate(),
+                                                       schema_->Predicate());
 
   auto op = new CreateIndex();
   op->namespace_oid_ = namespace_oid_;
@@ -1411,6 +1512,10 @@ const char *OperatorNodeContents<SortGroupBy>::name = "SortGroupBy";
 template <>
 const char *OperatorNodeContents<Aggregate>::name = "Aggregate";
 template <>
+const char *OperatorNodeContents<HashSetOp>::name = "HashSetOp";
+template <>
+const char *OperatorNodeContents<Window>::name = "Window";
+template <>
 const char *OperatorNodeContents<ExportExternalFile>::name = "ExportExternalFile";
 template <>
 const char *OperatorNodeContents<CreateDatabase>::name = "CreateDatabase";
@@ -1491,6 +1596,10 @@ OpType OperatorNodeContents<SortGroupBy>::type = OpType::SORTGROUPBY;
 template <>
 OpType OperatorNodeContents<Aggregate>::type = OpType::AGGREGATE;
 template <>
+OpType OperatorNodeContents<HashSetOp>::type = OpType::HASHSETOP;
+template <>
+OpType OperatorNodeContents<Window>::type = OpType::WINDOW;
+template <>
 OpType OperatorNodeContents<ExportExternalFile>::type = OpType::EXPORTEXTERNALFILE;
 template <>
 OpType OperatorNodeContents<CreateDatabase>::type = OpType::CREATEDATABASE;
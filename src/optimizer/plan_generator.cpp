@@ -10,6 +10,7 @@
 #include "common/error/exception.h"
 #include "execution/sql/value.h"
 #include "optimizer/abstract_optimizer_node.h"
+#include "optimizer/index_util.h"
 #include "optimizer/operator_node.h"
 #include "optimizer/physical_operators.h"
 #include "optimizer/properties.h"
@@ -45,8 +46,11 @@
 #include "planner/plannodes/order_by_plan_node.h"
 #include "planner/plannodes/projection_plan_node.h"
 #include "planner/plannodes/seq_scan_plan_node.h"
+#include "planner/plannodes/set_op_plan_node.h"
 #include "planner/plannodes/update_plan_node.h"
+#include "planner/plannodes/window_plan_node.h"
 #include "settings/settings_manager.h"
+#include "storage/index/index.h"
 #include "storage/sql_table.h"
 #include "transaction/transaction_context.h"
 
@@ -225,6 +229,15 @@ void PlanGenerator::Visit(const IndexScan *op) {
   // An IndexScan (for now at least) will output all columns of its table
   std::vector<catalog::col_oid_t> column_ids = GenerateColumnsForScan(predicate);
 
+  // The scan reads its columns from the index keys if the keys contain all of them. Range scans need an index that can
+  // return its keys, while exact scans read them from the probe key. Scans for updates need the table tuple.
+  auto type = op->GetIndexScanType();
+  bool index_only = !op->GetIsForUpdate() && type != planner::IndexScanType::Descending &&
+                    type != planner::IndexScanType::DescendingLimit &&
+                    (type == planner::IndexScanType::Exact ||
+                     accessor_->GetIndex(op->GetIndexOID())->KeyListEntrySize() > 0) &&
+                    IndexUtil::CoversColumnsWithIndex(accessor_, tbl_oid, op->GetIndexOID(), column_ids);
+
   auto builder = planner::IndexScanPlanNode::Builder();
   builder.SetOutputSchema(std::move(output_schema));
   builder.SetPlanNodeId(GetNextPlanNodeID());
@@ -237,8 +250,7 @@ void PlanGenerator::Visit(const IndexScan *op) {
   builder.SetTableNumTuple(table_num_tuple);
   builder.SetIndexSize(accessor_->GetTable(tbl_oid)->GetNumTuple());
   builder.SetCoverAllColumns(op->GetCoverAllColumns());
-
-  auto type = op->GetIndexScanType();
+  builder.SetIndexOnly(index_only);
   builder.SetScanType(type);
   for (auto bound : op->GetBounds()) {
     if (type == planner::IndexScanType::Exact) {
@@ -671,12 +683,70 @@ void PlanGenerator::Visit(const LeftHashJoin *op) {
   output_plan_ = builder.Build();
 }
 
-void PlanGenerator::Visit(UNUSED_ATTRIBUTE const RightHashJoin *op) {
-  NOISEPAGE_ASSERT(0, "RightHashJoin not implemented");
+void PlanGenerator::Visit(const RightHashJoin *op) {
+  auto proj_schema = GenerateProjectionForJoin();
+
+  auto comb_pred = parser::ExpressionUtil::JoinAnnotatedExprs(op->GetJoinPredicates());
+  auto eval_pred =
+      parser::ExpressionUtil::EvaluateExpression(children_expr_map_, common::ManagedPointer(comb_pred.get()));
+  auto join_predicate =
+      parser::ExpressionUtil::ConvertExprCVNodes(common::ManagedPointer(eval_pred.get()), children_expr_map_).release();
+  RegisterPointerCleanup<parser::AbstractExpression>(join_predicate, true, true);
+
+  auto builder = planner::HashJoinPlanNode::Builder();
+  builder.SetOutputSchema(std::move(proj_schema));
+  builder.SetPlanNodeId(GetNextPlanNodeID());
+
+  for (auto &expr : op->GetLeftKeys()) {
+    auto left_key = parser::ExpressionUtil::EvaluateExpression(children_expr_map_, expr).release();
+    RegisterPointerCleanup<parser::AbstractExpression>(left_key, true, true);
+    builder.AddLeftHashKey(common::ManagedPointer(left_key));
+  }
+
+  for (auto &expr : op->GetRightKeys()) {
+    auto right_key = parser::ExpressionUtil::EvaluateExpression(children_expr_map_, expr).release();
+    RegisterPointerCleanup<parser::AbstractExpression>(right_key, true, true);
+    builder.AddRightHashKey(common::ManagedPointer(right_key));
+  }
+
+  builder.AddChild(std::move(children_plans_[0]));
+  builder.AddChild(std::move(children_plans_[1]));
+  builder.SetJoinPredicate(common::ManagedPointer(join_predicate));
+  builder.SetJoinType(planner::LogicalJoinType::RIGHT);
+  output_plan_ = builder.Build();
 }
 
-void PlanGenerator::Visit(UNUSED_ATTRIBUTE const OuterHashJoin *op) {
-  NOISEPAGE_ASSERT(0, "OuterHashJoin not implemented");
+void PlanGenerator::Visit(const OuterHashJoin *op) {
+  auto proj_schema = GenerateProjectionForJoin();
+
+  auto comb_pred = parser::ExpressionUtil::JoinAnnotatedExprs(op->GetJoinPredicates());
+  auto eval_pred =
+      parser::ExpressionUtil::EvaluateExpression(children_expr_map_, common::ManagedPointer(comb_pred.get()));
+  auto join_predicate =
+      parser::ExpressionUtil::ConvertExprCVNodes(common::ManagedPointer(eval_pred.get()), children_expr_map_).release();
+  RegisterPointerCleanup<parser::AbstractExpression>(join_predicate, true, true);
+
+  auto builder = planner::HashJoinPlanNode::Builder();
+  builder.SetOutputSchema(std::move(proj_schema));
+  builder.SetPlanNodeId(GetNextPlanNodeID());
+
+  for (auto &expr : op->GetLeftKeys()) {
+    auto left_key = parser::ExpressionUtil::EvaluateExpression(children_expr_map_, expr).release();
+    RegisterPointerCleanup<parser::AbstractExpression>(left_key, true, true);
+    builder.AddLeftHashKey(common::ManagedPointer(left_key));
+  }
+
+  for (auto &expr : op->GetRightKeys()) {
+    auto right_key = parser::ExpressionUtil::EvaluateExpression(children_expr_map_, expr).release();
+    RegisterPointerCleanup<parser::AbstractExpression>(right_key, true, true);
+    builder.AddRightHashKey(common::ManagedPointer(right_key));
+  }
+
+  builder.AddChild(std::move(children_plans_[0]));
+  builder.AddChild(std::move(children_plans_[1]));
+  builder.SetJoinPredicate(common::ManagedPointer(join_predicate));
+  builder.SetJoinType(planner::LogicalJoinType::OUTER);
+  output_plan_ = builder.Build();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -813,6 +883,96 @@ void PlanGenerator::Visit(UNUSED_ATTRIBUTE const Aggregate *op) {
   BuildAggregatePlan(planner::AggregateStrategyType::PLAIN, nullptr, nullptr);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Set Operations
+///////////////////////////////////////////////////////////////////////////////
+
+void PlanGenerator::Visit(const HashSetOp *op) {
+  NOISEPAGE_ASSERT(children_plans_.size() == 2, "Set operation needs 2 child plans");
+
+  // InputColumnDeriver made each child output its select list in order, so the i-th output column of the set
+  // operation is the i-th column of both children.
+  std::vector<planner::OutputSchema::Column> columns;
+  const auto &left_columns = op->GetLeftColumns();
+  for (size_t idx = 0; idx < left_columns.size(); idx++) {
+    auto type = left_columns[idx]->GetReturnValueType();
+    auto dve = std::make_unique<parser::DerivedValueExpression>(type, 0, static_cast<int>(idx));
+    columns.emplace_back(left_columns[idx]->GetExpressionName(), type, std::move(dve));
+  }
+
+  output_plan_ = planner::SetOpPlanNode::Builder()
+                     .SetPlanNodeId(GetNextPlanNodeID())
+                     .SetOutputSchema(std::make_unique<planner::OutputSchema>(std::move(columns)))
+                     .SetSetOp(op->GetSetOp())
+                     .AddChild(std::move(children_plans_[0]))
+                     .AddChild(std::move(children_plans_[1]))
+                     .Build();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Window
+///////////////////////////////////////////////////////////////////////////////
+
+void PlanGenerator::Visit(const Window *op) {
+  NOISEPAGE_ASSERT(children_plans_.size() == 1, "Window needs 1 child plan");
+  NOISEPAGE_ASSERT(children_expr_map_.size() == 1, "Window needs 1 child expr map");
+  auto &child_expr_map = children_expr_map_[0];
+
+  // Keys and arguments are evaluated against the child's output.
+  const auto evaluate = [&](common::ManagedPointer<parser::AbstractExpression> expr) {
+    auto *eval_expr = parser::ExpressionUtil::EvaluateExpression({child_expr_map}, expr).release();
+    RegisterPointerCleanup<parser::AbstractExpression>(eval_expr, true, true);
+    return common::ManagedPointer(eval_expr);
+  };
+
+  // All window functions of the operator share the same window.
+  const auto &window_exprs = op->GetWindowExprs();
+  auto window = window_exprs[0].CastManagedPointerTo<parser::WindowExpression>();
+  auto builder = planner::WindowPlanNode::Builder();
+  for (const auto &key : window->GetPartitionByKeys()) {
+    builder.AddPartitionByKey(evaluate(key));
+  }
+  const auto sort_keys = window->GetSortKeys();
+  for (size_t idx = 0; idx < sort_keys.size(); idx++) {
+    builder.AddSortKey(evaluate(sort_keys[idx]), window->GetSortOrders()[idx]);
+  }
+
+  ExprMap window_expr_map;
+  for (const auto &expr : window_exprs) {
+    auto window_expr = expr.CastManagedPointerTo<parser::WindowExpression>();
+    planner::WindowFunction func;
+    func.type_ = window_expr->GetFunctionType();
+    if (window_expr->GetArgument() != nullptr) {
+      func.argument_ = evaluate(window_expr->GetArgument());
+    }
+    func.start_unbounded_ = window_expr->IsStartUnbounded();
+    func.start_preceding_ = window_expr->GetStartPreceding();
+    func.end_unbounded_ = window_expr->IsEndUnbounded();
+    func.end_following_ = window_expr->GetEndFollowing();
+    window_expr_map.emplace(expr, static_cast<unsigned int>(window_expr_map.size()));
+    builder.AddWindowFunction(func);
+  }
+
+  // The window functions are read with a tuple index of 1, the columns of the child with a tuple index of 0.
+  std::vector<planner::OutputSchema::Column> columns;
+  for (const auto &col : output_cols_) {
+    auto type = col->GetReturnValueType();
+    std::unique_ptr<parser::AbstractExpression> dve;
+    if (auto iter = window_expr_map.find(col); iter != window_expr_map.end()) {
+      dve = std::make_unique<parser::DerivedValueExpression>(type, 1, iter->second);
+    } else {
+      NOISEPAGE_ASSERT(child_expr_map.count(col) != 0U, "Window output column not provided by the child");
+      dve = std::make_unique<parser::DerivedValueExpression>(type, 0, child_expr_map[col]);
+    }
+    columns.emplace_back(col->GetExpressionName(), type, std::move(dve));
+  }
+
+  output_plan_ = builder.SetPlanNodeId(GetNextPlanNodeID())
+                     .SetOutputSchema(std::make_unique<planner::OutputSchema>(std::move(columns)))
+                     .AddChild(std::move(children_plans_[0]))
+                     .Build();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Insert/Update/Delete
 // To update or delete or select tuples, one must insert them first
@@ -902,6 +1062,11 @@ void PlanGenerator::Visit(const Update *op) {
       parser::ExpressionUtil::GetTupleValueExprs(
           &cves, common::ManagedPointer(const_cast<parser::AbstractExpression *>(column.StoredExpression().Get())));
     }
+    // Updating a column of the predicate of a partial index may move the tuple in or out of the index.
+    if (index.second.Partial()) {
+      parser::ExpressionUtil::GetTupleValueExprs(
+          &cves, common::ManagedPointer(const_cast<parser::AbstractExpression *>(index.second.Predicate().Get())));
+    }
   }
 
   std::unordered_set<std::string> update_column_names;
@@ -988,7 +1153,8 @@ void PlanGenerator::Visit(const CreateIndex *create_index) {
     cols.emplace_back(col);
   }
   auto idx_schema = std::make_unique<catalog::IndexSchema>(std::move(cols), schema->Type(), schema->Unique(),
-                                                           schema->Primary(), schema->Exclusion(), schema->Immediate());
+                                                           schema->Primary(), schema->Exclusion(), schema->Immediate(),
+                                                           schema->Predicate());
   auto out_schema = std::make_unique<planner::OutputSchema>();
 
   output_plan_ = planner::CreateIndexPlanNode::Builder()
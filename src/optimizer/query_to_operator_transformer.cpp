@@ -123,6 +123,49 @@ void QueryToOperatorTransformer::Visit(common::ManagedPointer<parser::SelectStat
         accessor_->GetTxn().Get());
   }
 
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> window_exprs;
+  for (auto &expr : op->GetSelectColumns()) {
+    parser::ExpressionUtil::GetWindowExprs(&window_exprs, expr);
+  }
+  if (!window_exprs.empty()) {
+    OPTIMIZER_LOG_DEBUG("Handling window functions in SelectStatement ...");
+    if (op->IsSelectDistinct() || QueryToOperatorTransformer::RequireAggregation(common::ManagedPointer(op))) {
+      throw NOT_IMPLEMENTED_EXCEPTION("Window functions together with aggregation or DISTINCT");
+    }
+
+    // Window functions that share a window are computed by the same window operator. Each operator computes its
+    // window functions over the output of the one below it.
+    const auto same_window = [](common::ManagedPointer<parser::WindowExpression> lhs,
+                                common::ManagedPointer<parser::WindowExpression> rhs) {
+      const auto same_keys = [](const std::vector<common::ManagedPointer<parser::AbstractExpression>> &l,
+                                const std::vector<common::ManagedPointer<parser::AbstractExpression>> &r) {
+        return std::equal(l.begin(), l.end(), r.begin(), r.end(), [](auto a, auto b) { return *a == *b; });
+      };
+      return same_keys(lhs->GetPartitionByKeys(), rhs->GetPartitionByKeys()) &&
+             same_keys(lhs->GetSortKeys(), rhs->GetSortKeys()) && lhs->GetSortOrders() == rhs->GetSortOrders();
+    };
+    std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>> windows;
+    for (const auto &expr : window_exprs) {
+      auto window_expr = expr.CastManagedPointerTo<parser::WindowExpression>();
+      auto window = std::find_if(windows.begin(), windows.end(), [&](const auto &window_group) {
+        return same_window(window_group[0].template CastManagedPointerTo<parser::WindowExpression>(), window_expr);
+      });
+      if (window == windows.end()) {
+        windows.push_back({expr});
+      } else if (std::none_of(window->begin(), window->end(), [&](auto other) { return *other == *expr; })) {
+        window->push_back(expr);
+      }
+    }
+
+    for (auto &window_group : windows) {
+      auto window_expr = std::make_unique<OperatorNode>(
+          LogicalWindow::Make(std::move(window_group)).RegisterWithTxnContext(txn_context),
+          std::vector<std::unique_ptr<AbstractOptimizerNode>>{}, txn_context);
+      window_expr->PushChild(std::move(output_expr_));
+      output_expr_ = std::move(window_expr);
+    }
+  }
+
   if (op->GetSelectLimit() != nullptr && op->GetSelectLimit()->GetLimit() != -1) {
     OPTIMIZER_LOG_DEBUG("Handling order by/limit/offset in SelectStatement ...");
     std::vector<common::ManagedPointer<parser::AbstractExpression>> sort_exprs;
@@ -149,6 +192,39 @@ void QueryToOperatorTransformer::Visit(common::ManagedPointer<parser::SelectStat
     output_expr_ = std::move(limit_expr);
   }
 
+  if (op->GetSetOpSelect() != nullptr) {
+    OPTIMIZER_LOG_DEBUG("Handling set operation in SelectStatement ...");
+    auto left_expr = std::move(output_expr_);
+    op->GetSetOpSelect()->Accept(common::ManagedPointer(this).CastManagedPointerTo<SqlNodeVisitor>());
+    auto right_expr = std::move(output_expr_);
+
+    planner::SetOpType set_op;
+    switch (op->GetSetOpType()) {
+      case parser::SetOperationType::UNION:
+        set_op = op->IsSetOpAll() ? planner::SetOpType::UNION_ALL : planner::SetOpType::UNION;
+        break;
+      case parser::SetOperationType::INTERSECT:
+        set_op = op->IsSetOpAll() ? planner::SetOpType::INTERSECT_ALL : planner::SetOpType::INTERSECT;
+        break;
+      case parser::SetOperationType::EXCEPT:
+        set_op = op->IsSetOpAll() ? planner::SetOpType::EXCEPT_ALL : planner::SetOpType::EXCEPT;
+        break;
+      default:
+        throw OPTIMIZER_EXCEPTION("Unknown set operation");
+    }
+
+    auto left_columns = op->GetSelectColumns();
+    auto right_columns = op->GetSetOpSelect()->GetSelectColumns();
+
+    std::vector<std::unique_ptr<AbstractOptimizerNode>> c;
+    c.emplace_back(std::move(left_expr));
+    c.emplace_back(std::move(right_expr));
+    output_expr_ = std::make_unique<OperatorNode>(
+        LogicalSetOp::Make(set_op, std::move(left_columns), std::move(right_columns))
+            .RegisterWithTxnContext(txn_context),
+        std::move(c), txn_context);
+  }
+
   predicates_ = std::move(pre_predicates);
 }
 
@@ -347,7 +423,7 @@ void QueryToOperatorTransformer::Visit(common::ManagedPointer<parser::CreateStat
       create_expr = std::make_unique<OperatorNode>(
           LogicalCreateIndex::Make(db_oid_, accessor_->GetDefaultNamespace(),
                                    accessor_->GetTableOid(op->GetTableName()), op->GetIndexType(), op->IsUniqueIndex(),
-                                   op->GetIndexName(), std::move(entries))
+                                   op->GetIndexName(), std::move(entries), op->GetIndexPredicate())
               .RegisterWithTxnContext(txn_context),
           std::vector<std::unique_ptr<AbstractOptimizerNode>>{}, txn_context);
       break;
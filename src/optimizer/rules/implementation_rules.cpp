@@ -1,5 +1,6 @@
 #include "optimizer/rules/implementation_rules.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -126,7 +127,9 @@ void LogicalGetToPhysicalIndexScan::Transform(common::ManagedPointer<AbstractOpt
     if (IndexUtil::CheckSortProperty(sort_prop)) {
       auto indexes = accessor->GetIndexOids(get->GetTableOid());
       for (auto index : indexes) {
-        if (IndexUtil::SatisfiesSortWithIndex(accessor, sort_prop, get->GetTableOid(), index)) {
+        // A partial index can only provide the sort order if the scan doesn't need any tuples that it skips.
+        if (IndexUtil::SatisfiesSortWithIndex(accessor, sort_prop, get->GetTableOid(), index) &&
+            IndexUtil::SatisfiesPartialIndexPredicate(accessor->GetIndexSchema(index), get->GetPredicates())) {
           std::vector<AnnotatedExpression> preds = get->GetPredicates();
           planner::IndexScanType scan_type;
           std::unordered_map<catalog::indexkeycol_oid_t, std::vector<planner::IndexExpression>> bounds;
@@ -739,6 +742,124 @@ void LogicalLeftJoinToPhysicalLeftHashJoin::Transform(common::ManagedPointer<Abs
   }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// LogicalRightJoinToPhysicalRightHashJoin
+///////////////////////////////////////////////////////////////////////////////
+LogicalRightJoinToPhysicalRightHashJoin::LogicalRightJoinToPhysicalRightHashJoin() {
+  type_ = RuleType::RIGHT_JOIN_TO_HASH_JOIN;
+
+  // Make three node types for pattern matching
+  auto left_child(new Pattern(OpType::LEAF));
+  auto right_child(new Pattern(OpType::LEAF));
+
+  // Initialize a pattern for optimizer to match
+  match_pattern_ = new Pattern(OpType::LOGICALRIGHTJOIN);
+
+  // Add node - we match join relation R and S as well as the predicate exp
+  match_pattern_->AddChild(left_child);
+  match_pattern_->AddChild(right_child);
+}
+
+bool LogicalRightJoinToPhysicalRightHashJoin::Check(common::ManagedPointer<AbstractOptimizerNode> plan,
+                                                    OptimizationContext *context) const {
+  (void)context;
+  (void)plan;
+  return true;
+}
+
+void LogicalRightJoinToPhysicalRightHashJoin::Transform(
+    common::ManagedPointer<AbstractOptimizerNode> input,
+    std::vector<std::unique_ptr<AbstractOptimizerNode>> *transformed,
+    UNUSED_ATTRIBUTE OptimizationContext *context) const {
+  // first build an expression representing hash join
+  const auto right_join = input->Contents()->GetContentsAs<LogicalRightJoin>();
+
+  auto children = input->GetChildren();
+  NOISEPAGE_ASSERT(children.size() == 2, "Right Join should have two child");
+
+  auto left_group_id = children[0]->Contents()->GetContentsAs<LeafOperator>()->GetOriginGroup();
+  auto right_group_id = children[1]->Contents()->GetContentsAs<LeafOperator>()->GetOriginGroup();
+  auto &left_group_alias = context->GetOptimizerContext()->GetMemo().GetGroupByID(left_group_id)->GetTableAliases();
+  auto &right_group_alias = context->GetOptimizerContext()->GetMemo().GetGroupByID(right_group_id)->GetTableAliases();
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> left_keys;
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> right_keys;
+
+  std::vector<AnnotatedExpression> join_preds = right_join->GetJoinPredicates();
+
+  OptimizerUtil::ExtractEquiJoinKeys(join_preds, &left_keys, &right_keys, left_group_alias, right_group_alias);
+
+  NOISEPAGE_ASSERT(right_keys.size() == left_keys.size(), "# left/right keys should equal");
+  std::vector<std::unique_ptr<AbstractOptimizerNode>> child;
+  child.emplace_back(children[0]->Copy());
+  child.emplace_back(children[1]->Copy());
+  if (!left_keys.empty()) {
+    auto result = std::make_unique<OperatorNode>(
+        RightHashJoin::Make(std::move(join_preds), std::move(left_keys), std::move(right_keys))
+            .RegisterWithTxnContext(context->GetOptimizerContext()->GetTxn()),
+        std::move(child), context->GetOptimizerContext()->GetTxn());
+    transformed->emplace_back(std::move(result));
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// LogicalOuterJoinToPhysicalOuterHashJoin
+///////////////////////////////////////////////////////////////////////////////
+LogicalOuterJoinToPhysicalOuterHashJoin::LogicalOuterJoinToPhysicalOuterHashJoin() {
+  type_ = RuleType::OUTER_JOIN_TO_HASH_JOIN;
+
+  // Make three node types for pattern matching
+  auto left_child(new Pattern(OpType::LEAF));
+  auto right_child(new Pattern(OpType::LEAF));
+
+  // Initialize a pattern for optimizer to match
+  match_pattern_ = new Pattern(OpType::LOGICALOUTERJOIN);
+
+  // Add node - we match join relation R and S as well as the predicate exp
+  match_pattern_->AddChild(left_child);
+  match_pattern_->AddChild(right_child);
+}
+
+bool LogicalOuterJoinToPhysicalOuterHashJoin::Check(common::ManagedPointer<AbstractOptimizerNode> plan,
+                                                    OptimizationContext *context) const {
+  (void)context;
+  (void)plan;
+  return true;
+}
+
+void LogicalOuterJoinToPhysicalOuterHashJoin::Transform(
+    common::ManagedPointer<AbstractOptimizerNode> input,
+    std::vector<std::unique_ptr<AbstractOptimizerNode>> *transformed,
+    UNUSED_ATTRIBUTE OptimizationContext *context) const {
+  // first build an expression representing hash join
+  const auto outer_join = input->Contents()->GetContentsAs<LogicalOuterJoin>();
+
+  auto children = input->GetChildren();
+  NOISEPAGE_ASSERT(children.size() == 2, "Outer Join should have two child");
+
+  auto left_group_id = children[0]->Contents()->GetContentsAs<LeafOperator>()->GetOriginGroup();
+  auto right_group_id = children[1]->Contents()->GetContentsAs<LeafOperator>()->GetOriginGroup();
+  auto &left_group_alias = context->GetOptimizerContext()->GetMemo().GetGroupByID(left_group_id)->GetTableAliases();
+  auto &right_group_alias = context->GetOptimizerContext()->GetMemo().GetGroupByID(right_group_id)->GetTableAliases();
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> left_keys;
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> right_keys;
+
+  std::vector<AnnotatedExpression> join_preds = outer_join->GetJoinPredicates();
+
+  OptimizerUtil::ExtractEquiJoinKeys(join_preds, &left_keys, &right_keys, left_group_alias, right_group_alias);
+
+  NOISEPAGE_ASSERT(right_keys.size() == left_keys.size(), "# left/right keys should equal");
+  std::vector<std::unique_ptr<AbstractOptimizerNode>> child;
+  child.emplace_back(children[0]->Copy());
+  child.emplace_back(children[1]->Copy());
+  if (!left_keys.empty()) {
+    auto result = std::make_unique<OperatorNode>(
+        OuterHashJoin::Make(std::move(join_preds), std::move(left_keys), std::move(right_keys))
+            .RegisterWithTxnContext(context->GetOptimizerContext()->GetTxn()),
+        std::move(child), context->GetOptimizerContext()->GetTxn());
+    transformed->emplace_back(std::move(result));
+  }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// LogicalLimitToPhysicalLimit
 ///////////////////////////////////////////////////////////////////////////////
@@ -776,6 +897,76 @@ void LogicalLimitToPhysicalLimit::Transform(common::ManagedPointer<AbstractOptim
   transformed->emplace_back(std::move(result_plan));
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// LogicalSetOpToPhysicalHashSetOp
+///////////////////////////////////////////////////////////////////////////////
+LogicalSetOpToPhysicalHashSetOp::LogicalSetOpToPhysicalHashSetOp() {
+  type_ = RuleType::SET_OP_TO_HASH_SET_OP;
+
+  match_pattern_ = new Pattern(OpType::LOGICALSETOP);
+  match_pattern_->AddChild(new Pattern(OpType::LEAF));
+  match_pattern_->AddChild(new Pattern(OpType::LEAF));
+}
+
+bool LogicalSetOpToPhysicalHashSetOp::Check(common::ManagedPointer<AbstractOptimizerNode> plan,
+                                            OptimizationContext *context) const {
+  (void)context;
+  (void)plan;
+  return true;
+}
+
+void LogicalSetOpToPhysicalHashSetOp::Transform(common::ManagedPointer<AbstractOptimizerNode> input,
+                                                std::vector<std::unique_ptr<AbstractOptimizerNode>> *transformed,
+                                                OptimizationContext *context) const {
+  const auto set_op = input->Contents()->GetContentsAs<LogicalSetOp>();
+  NOISEPAGE_ASSERT(input->GetChildren().size() == 2, "LogicalSetOp should have 2 children");
+
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> left_columns = set_op->GetLeftColumns();
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> right_columns = set_op->GetRightColumns();
+  std::vector<std::unique_ptr<AbstractOptimizerNode>> c;
+  c.emplace_back(input->GetChildren()[0]->Copy());
+  c.emplace_back(input->GetChildren()[1]->Copy());
+
+  auto result_plan = std::make_unique<OperatorNode>(
+      HashSetOp::Make(set_op->GetSetOp(), std::move(left_columns), std::move(right_columns))
+          .RegisterWithTxnContext(context->GetOptimizerContext()->GetTxn()),
+      std::move(c), context->GetOptimizerContext()->GetTxn());
+  transformed->emplace_back(std::move(result_plan));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// LogicalWindowToPhysicalWindow
+///////////////////////////////////////////////////////////////////////////////
+LogicalWindowToPhysicalWindow::LogicalWindowToPhysicalWindow() {
+  type_ = RuleType::IMPLEMENT_WINDOW;
+
+  match_pattern_ = new Pattern(OpType::LOGICALWINDOW);
+  match_pattern_->AddChild(new Pattern(OpType::LEAF));
+}
+
+bool LogicalWindowToPhysicalWindow::Check(common::ManagedPointer<AbstractOptimizerNode> plan,
+                                          OptimizationContext *context) const {
+  (void)context;
+  (void)plan;
+  return true;
+}
+
+void LogicalWindowToPhysicalWindow::Transform(common::ManagedPointer<AbstractOptimizerNode> input,
+                                              std::vector<std::unique_ptr<AbstractOptimizerNode>> *transformed,
+                                              OptimizationContext *context) const {
+  const auto window_op = input->Contents()->GetContentsAs<LogicalWindow>();
+  NOISEPAGE_ASSERT(input->GetChildren().size() == 1, "LogicalWindow should have 1 child");
+
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> window_exprs = window_op->GetWindowExprs();
+  std::vector<std::unique_ptr<AbstractOptimizerNode>> c;
+  c.emplace_back(input->GetChildren()[0]->Copy());
+
+  auto result_plan = std::make_unique<OperatorNode>(
+      Window::Make(std::move(window_exprs)).RegisterWithTxnContext(context->GetOptimizerContext()->GetTxn()),
+      std::move(c), context->GetOptimizerContext()->GetTxn());
+  transformed->emplace_back(std::move(result_plan));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// LogicalExport to Physical Export
 ///////////////////////////////////////////////////////////////////////////////
@@ -899,7 +1090,14 @@ void LogicalCreateIndexToPhysicalCreateIndex::Transform(
       nullable = col.Nullable();
       if (is_var) varlen_size = col.TypeModifier();
     } else {
-      // TODO(Matt): derive a unique name
+      // Key columns need distinct names in pg_attribute, so expressions are named "expr", "expr1", ... like Postgres.
+      auto name_taken = [&cols](const std::string &col_name) {
+        return std::any_of(cols.begin(), cols.end(), [&col_name](const auto &col) { return col.Name() == col_name; });
+      };
+      name = "expr";
+      for (uint32_t suffix = 1; name_taken(name); suffix++) {
+        name = "expr" + std::to_string(suffix);
+      }
       // TODO(wz2): Derive nullability/varlen from non ColumnValue
       nullable = true;
       varlen_size = UINT16_MAX;
@@ -922,6 +1120,9 @@ void LogicalCreateIndexToPhysicalCreateIndex::Transform(
     case parser::IndexType::BPLUSTREE:
       idx_type = storage::index::IndexType::BPLUSTREE;
       break;
+    case parser::IndexType::ART:
+      idx_type = storage::index::IndexType::ART;
+      break;
     default:
       NOISEPAGE_ASSERT(false, "Unsupported index type encountered");
       break;
@@ -930,7 +1131,9 @@ void LogicalCreateIndexToPhysicalCreateIndex::Transform(
   auto schema = std::make_unique<catalog::IndexSchema>(std::move(cols), idx_type, ci_op->IsUnique(),
                                                        false,   // is_primary
                                                        false,   // is_exclusion
-                                                       false);  // is_immediate
+                                                       false,   // is_immediate
+                                                       common::ManagedPointer<const parser::AbstractExpression>(
+                                                           ci_op->GetIndexPredicate().Get()));
 
   auto op = std::make_unique<OperatorNode>(
       CreateIndex::Make(ci_op->GetNamespaceOid(), ci_op->GetTableOid(), ci_op->GetIndexName(), std::move(schema))
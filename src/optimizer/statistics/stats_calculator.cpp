@@ -130,6 +130,36 @@ void StatsCalculator::Visit(const LogicalLimit *op) {
   group->SetNumRows(std::min(static_cast<size_t>(op->GetLimit()), child_group->GetNumRows()));
 }
 
+void StatsCalculator::Visit(const LogicalSetOp *op) {
+  NOISEPAGE_ASSERT(gexpr_->GetChildrenGroupsSize() == 2, "Set operation must have 2 children");
+  auto left_rows = context_->GetMemo().GetGroupByID(gexpr_->GetChildGroupId(0))->GetNumRows();
+  auto right_rows = context_->GetMemo().GetGroupByID(gexpr_->GetChildGroupId(1))->GetNumRows();
+  auto *group = context_->GetMemo().GetGroupByID(gexpr_->GetGroupID());
+
+  // Upper bounds, i.e., as if no row were a duplicate of another
+  switch (op->GetSetOp()) {
+    case planner::SetOpType::UNION:
+    case planner::SetOpType::UNION_ALL:
+      group->SetNumRows(left_rows + right_rows);
+      break;
+    case planner::SetOpType::INTERSECT:
+    case planner::SetOpType::INTERSECT_ALL:
+      group->SetNumRows(std::min(left_rows, right_rows));
+      break;
+    default:
+      group->SetNumRows(left_rows);
+      break;
+  }
+}
+
+void StatsCalculator::Visit(UNUSED_ATTRIBUTE const LogicalWindow *op) {
+  NOISEPAGE_ASSERT(gexpr_->GetChildrenGroupsSize() == 1, "Window must have 1 child");
+  // Every input row is emitted once
+  auto *child_group = context_->GetMemo().GetGroupByID(gexpr_->GetChildGroupId(0));
+  auto *group = context_->GetMemo().GetGroupByID(gexpr_->GetGroupID());
+  group->SetNumRows(child_group->GetNumRows());
+}
+
 void StatsCalculator::Visit(const LogicalInsert *op) {
   NOISEPAGE_ASSERT(gexpr_->GetChildrenGroupsSize() == 0, "Insert should not have children");
   auto *root_group = context_->GetMemo().GetGroupByID(gexpr_->GetGroupID());
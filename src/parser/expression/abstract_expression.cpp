@@ -21,6 +21,7 @@
 #include "parser/expression/subquery_expression.h"
 #include "parser/expression/table_star_expression.h"
 #include "parser/expression/type_cast_expression.h"
+#include "parser/expression/window_expression.h"
 
 namespace noisepage::parser {
 
@@ -223,6 +224,11 @@ JSONDeserializeExprIntermediate DeserializeExpression(const nlohmann::json &j) {
       break;
     }
 
+    case ExpressionType::WINDOW_FUNCTION: {
+      expr = std::make_unique<WindowExpression>();
+      break;
+    }
+
     default:
       throw std::runtime_error("Unknown expression type during deserialization");
   }
@@ -0,0 +1,116 @@
+#include "parser/expression/window_expression.h"
+
+#include "binder/sql_node_visitor.h"
+#include "common/hash_util.h"
+#include "common/json.h"
+#include "spdlog/fmt/fmt.h"
+
+namespace noisepage::parser {
+
+std::unique_ptr<AbstractExpression> WindowExpression::Copy() const {
+  std::vector<std::unique_ptr<AbstractExpression>> children;
+  for (const auto &child : GetChildren()) {
+    children.emplace_back(child->Copy());
+  }
+  return CopyWithChildren(std::move(children));
+}
+
+std::unique_ptr<AbstractExpression> WindowExpression::CopyWithChildren(
+    std::vector<std::unique_ptr<AbstractExpression>> &&children) const {
+  auto expr = std::make_unique<WindowExpression>(function_type_, std::move(children), num_partition_by_keys_,
+                                                 sort_orders_);
+  expr->SetFrame(start_unbounded_, start_preceding_, end_unbounded_, end_following_);
+  expr->SetMutableStateForCopy(*this);
+  return expr;
+}
+
+void WindowExpression::DeriveReturnValueType() {
+  switch (function_type_) {
+    case planner::WindowFunctionType::ROW_NUMBER:
+    case planner::WindowFunctionType::RANK:
+    case planner::WindowFunctionType::DENSE_RANK:
+    case planner::WindowFunctionType::COUNT:
+    case planner::WindowFunctionType::COUNT_STAR:
+      this->SetReturnValueType(type::TypeId::BIGINT);
+      break;
+    // keep the type of the argument
+    case planner::WindowFunctionType::SUM:
+    case planner::WindowFunctionType::MIN:
+    case planner::WindowFunctionType::MAX:
+      NOISEPAGE_ASSERT(HasArgument(), "No argument given.");
+      GetArgument()->DeriveReturnValueType();
+      this->SetReturnValueType(GetArgument()->GetReturnValueType());
+      break;
+    case planner::WindowFunctionType::AVG:
+      this->SetReturnValueType(type::TypeId::REAL);
+      break;
+    default:
+      throw PARSER_EXCEPTION(
+          fmt::format("Not a valid window function type: {}", static_cast<int>(function_type_)));
+  }
+}
+
+std::vector<common::ManagedPointer<AbstractExpression>> WindowExpression::GetChildRange(size_t begin,
+                                                                                         size_t count) const {
+  std::vector<common::ManagedPointer<AbstractExpression>> exprs;
+  exprs.reserve(count);
+  for (size_t i = begin; i < begin + count; i++) {
+    exprs.emplace_back(GetChild(i));
+  }
+  return exprs;
+}
+
+nlohmann::json WindowExpression::ToJson() const {
+  nlohmann::json j = AbstractExpression::ToJson();
+  j["function_type"] = function_type_;
+  j["num_partition_by_keys"] = num_partition_by_keys_;
+  j["sort_orders"] = sort_orders_;
+  j["start_unbounded"] = start_unbounded_;
+  j["start_preceding"] = start_preceding_;
+  j["end_unbounded"] = end_unbounded_;
+  j["end_following"] = end_following_;
+  return j;
+}
+
+std::vector<std::unique_ptr<AbstractExpression>> WindowExpression::FromJson(const nlohmann::json &j) {
+  std::vector<std::unique_ptr<AbstractExpression>> exprs;
+  auto e1 = AbstractExpression::FromJson(j);
+  exprs.insert(exprs.end(), std::make_move_iterator(e1.begin()), std::make_move_iterator(e1.end()));
+  function_type_ = j.at("function_type").get<planner::WindowFunctionType>();
+  num_partition_by_keys_ = j.at("num_partition_by_keys").get<size_t>();
+  sort_orders_ = j.at("sort_orders").get<std::vector<optimizer::OrderByOrderingType>>();
+  start_unbounded_ = j.at("start_unbounded").get<bool>();
+  start_preceding_ = j.at("start_preceding").get<uint64_t>();
+  end_unbounded_ = j.at("end_unbounded").get<bool>();
+  end_following_ = j.at("end_following").get<uint64_t>();
+  return exprs;
+}
+
+void WindowExpression::Accept(common::ManagedPointer<binder::SqlNodeVisitor> v) {
+  v->Visit(common::ManagedPointer(this));
+}
+
+common::hash_t WindowExpression::Hash() const {
+  common::hash_t hash = AbstractExpression::Hash();
+  hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(function_type_));
+  hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(num_partition_by_keys_));
+  hash = common::HashUtil::CombineHashInRange(hash, sort_orders_.begin(), sort_orders_.end());
+  hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(start_unbounded_));
+  hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(start_preceding_));
+  hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(end_unbounded_));
+  hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(end_following_));
+  return hash;
+}
+
+bool WindowExpression::operator==(const AbstractExpression &rhs) const {
+  if (!AbstractExpression::operator==(rhs)) return false;
+  auto const &other = dynamic_cast<const WindowExpression &>(rhs);
+  return function_type_ == other.function_type_ && num_partition_by_keys_ == other.num_partition_by_keys_ &&
+         sort_orders_ == other.sort_orders_ && start_unbounded_ == other.start_unbounded_ &&
+         start_preceding_ == other.start_preceding_ && end_unbounded_ == other.end_unbounded_ &&
+         end_following_ == other.end_following_;
+}
+
+DEFINE_JSON_BODY_DECLARATIONS(WindowExpression);
+
+}  // namespace noisepage::parser
@@ -27,8 +27,10 @@
 #include "parser/expression/subquery_expression.h"
 #include "parser/expression/table_star_expression.h"
 #include "parser/expression/type_cast_expression.h"
+#include "parser/expression/window_expression.h"
 #include "parser/pg_trigger.h"
 #include "parser/statements.h"
+#include "spdlog/fmt/fmt.h"
 
 /**
  * Log information about the error, then throw an exception
@@ -607,6 +609,10 @@ std::unique_ptr<AbstractExpression> PostgresParser::FuncCallTransform(ParseResul
   // TODO(WAN): Check if we need to change the case of this.
   std::string func_name = reinterpret_cast<value *>(root->funcname_->head->data.ptr_value)->val_.str_;
 
+  if (root->over_ != nullptr) {
+    return WindowFuncTransform(parse_result, root, func_name);
+  }
+
   std::unique_ptr<AbstractExpression> result;
   if (!IsAggregateFunction(func_name)) {
     // normal functions (built-in functions or UDFs)
@@ -641,6 +647,140 @@ std::unique_ptr<AbstractExpression> PostgresParser::FuncCallTransform(ParseResul
   return result;
 }
 
+// Postgres.FuncCall with an OVER clause -> noisepage.WindowExpression
+std::unique_ptr<AbstractExpression> PostgresParser::WindowFuncTransform(ParseResult *parse_result, FuncCall *root,
+                                                                        const std::string &func_name) {
+  auto window = root->over_;
+  if (window->refname_ != nullptr || window->name_ != nullptr) {
+    throw NOT_IMPLEMENTED_EXCEPTION("Named windows");
+  }
+  if (root->agg_distinct_ || root->agg_order_ != nullptr || root->agg_filter_ != nullptr) {
+    throw NOT_IMPLEMENTED_EXCEPTION("DISTINCT, ORDER BY or FILTER in window functions");
+  }
+
+  planner::WindowFunctionType function_type;
+  const bool is_ranking = func_name == "row_number" || func_name == "rank" || func_name == "dense_rank";
+  if (func_name == "row_number") {
+    function_type = planner::WindowFunctionType::ROW_NUMBER;
+  } else if (func_name == "rank") {
+    function_type = planner::WindowFunctionType::RANK;
+  } else if (func_name == "dense_rank") {
+    function_type = planner::WindowFunctionType::DENSE_RANK;
+  } else if (func_name == "count") {
+    function_type = root->agg_star_ ? planner::WindowFunctionType::COUNT_STAR : planner::WindowFunctionType::COUNT;
+  } else if (func_name == "sum") {
+    function_type = planner::WindowFunctionType::SUM;
+  } else if (func_name == "min") {
+    function_type = planner::WindowFunctionType::MIN;
+  } else if (func_name == "max") {
+    function_type = planner::WindowFunctionType::MAX;
+  } else if (func_name == "avg") {
+    function_type = planner::WindowFunctionType::AVG;
+  } else {
+    throw NOT_IMPLEMENTED_EXCEPTION(fmt::format("Window function {}", func_name));
+  }
+
+  // The argument, if any, comes first.
+  std::vector<std::unique_ptr<AbstractExpression>> children;
+  const auto num_args = root->args_ == nullptr ? 0 : root->args_->length;
+  const auto expected_args = is_ranking || function_type == planner::WindowFunctionType::COUNT_STAR ? 0 : 1;
+  if (num_args != expected_args) {
+    throw PARSER_EXCEPTION(fmt::format("WindowFuncTransform: {} takes {} argument(s)", func_name, expected_args));
+  }
+  if (num_args != 0) {
+    auto expr_node = reinterpret_cast<Node *>(root->args_->head->data.ptr_value);
+    children.emplace_back(ExprTransform(parse_result, expr_node, nullptr));
+  }
+
+  // Then the PARTITION BY keys.
+  size_t num_partition_by_keys = 0;
+  if (window->partition_clause_ != nullptr) {
+    for (auto cell = window->partition_clause_->head; cell != nullptr; cell = cell->next) {
+      auto expr_node = reinterpret_cast<Node *>(cell->data.ptr_value);
+      children.emplace_back(ExprTransform(parse_result, expr_node, nullptr));
+      num_partition_by_keys++;
+    }
+  }
+
+  // And finally the ORDER BY keys.
+  std::vector<optimizer::OrderByOrderingType> sort_orders;
+  if (window->order_clause_ != nullptr) {
+    for (auto cell = window->order_clause_->head; cell != nullptr; cell = cell->next) {
+      auto temp = reinterpret_cast<Node *>(cell->data.ptr_value);
+      if (temp->type != T_SortBy) {
+        PARSER_LOG_AND_THROW("WindowFuncTransform", "OrderBy type", temp->type);
+      }
+      auto sort = reinterpret_cast<SortBy *>(temp);
+      switch (sort->sortby_dir_) {
+        case SORTBY_DESC: {
+          sort_orders.emplace_back(optimizer::OrderByOrderingType::DESC);
+          break;
+        }
+        case SORTBY_ASC:  // fall through
+        case SORTBY_DEFAULT: {
+          sort_orders.emplace_back(optimizer::OrderByOrderingType::ASC);
+          break;
+        }
+        default: {
+          PARSER_LOG_AND_THROW("WindowFuncTransform", "Sortby type", sort->sortby_dir_);
+        }
+      }
+      children.emplace_back(ExprTransform(parse_result, sort->node_, nullptr));
+    }
+  }
+
+  const bool has_order_by = !sort_orders.empty();
+  auto result = std::make_unique<WindowExpression>(function_type, std::move(children), num_partition_by_keys,
+                                                   std::move(sort_orders));
+
+  // Frames are counted in rows. A RANGE frame, which is also the default, can only be evaluated when it covers the
+  // whole partition: all rows are peers without an ORDER BY. Ranking functions ignore the frame.
+  const int options = window->frame_options_;
+  if (is_ranking) {
+    return result;
+  }
+  if ((options & FRAMEOPTION_ROWS) == 0) {
+    if (has_order_by && (options & FRAMEOPTION_END_UNBOUNDED_FOLLOWING) == 0) {
+      throw NOT_IMPLEMENTED_EXCEPTION("RANGE frames that end before the end of the partition");
+    }
+    return result;
+  }
+
+  const auto frame_offset = [](Node *node) -> uint64_t {
+    if (node == nullptr || node->type != T_A_Const) {
+      throw NOT_IMPLEMENTED_EXCEPTION("Window frame offsets that are not integer constants");
+    }
+    const auto &val = reinterpret_cast<A_Const *>(node)->val_;
+    if (val.type_ != T_Integer || val.val_.ival_ < 0) {
+      throw PARSER_EXCEPTION("WindowFuncTransform: frame offset must be a non-negative integer");
+    }
+    return static_cast<uint64_t>(val.val_.ival_);
+  };
+
+  bool start_unbounded = false;
+  uint64_t start_preceding = 0;
+  if ((options & FRAMEOPTION_START_UNBOUNDED_PRECEDING) != 0) {
+    start_unbounded = true;
+  } else if ((options & FRAMEOPTION_START_VALUE_PRECEDING) != 0) {
+    start_preceding = frame_offset(window->start_offset_);
+  } else if ((options & FRAMEOPTION_START_CURRENT_ROW) == 0) {
+    throw NOT_IMPLEMENTED_EXCEPTION("Window frames that start after the current row");
+  }
+
+  bool end_unbounded = false;
+  uint64_t end_following = 0;
+  if ((options & FRAMEOPTION_END_UNBOUNDED_FOLLOWING) != 0) {
+    end_unbounded = true;
+  } else if ((options & FRAMEOPTION_END_VALUE_FOLLOWING) != 0) {
+    end_following = frame_offset(window->end_offset_);
+  } else if ((options & FRAMEOPTION_END_CURRENT_ROW) == 0) {
+    throw NOT_IMPLEMENTED_EXCEPTION("Window frames that end before the current row");
+  }
+
+  result->SetFrame(start_unbounded, start_preceding, end_unbounded, end_following);
+  return result;
+}
+
 // Postgres.NullTest -> noisepage.OperatorExpression
 std::unique_ptr<AbstractExpression> PostgresParser::NullTestTransform(ParseResult *parse_result, NullTest *root) {
   if (root == nullptr) {
@@ -805,9 +945,32 @@ std::unique_ptr<SelectStatement> PostgresParser::SelectTransform(ParseResult *pa
                                                  std::move(groupby), std::move(orderby), std::move(limit_desc));
       break;
     }
-    case SETOP_UNION: {
+    case SETOP_UNION:
+    case SETOP_INTERSECT:
+    case SETOP_EXCEPT: {
+      if (root->sort_clause_ != nullptr || root->limit_count_ != nullptr || root->limit_offset_ != nullptr) {
+        throw NOT_IMPLEMENTED_EXCEPTION("ORDER BY, LIMIT and OFFSET on the result of a set operation");
+      }
+      auto set_op_type = SetOperationType::UNION;
+      if (root->op_ == SETOP_INTERSECT) {
+        set_op_type = SetOperationType::INTERSECT;
+      } else if (root->op_ == SETOP_EXCEPT) {
+        set_op_type = SetOperationType::EXCEPT;
+      }
       result = SelectTransform(parse_result, root->larg_);
-      result->SetUnionSelect(SelectTransform(parse_result, root->rarg_));
+      auto right = SelectTransform(parse_result, root->rarg_);
+
+      // A select statement only has a right set operation input, so (A op B) op C is stored as A op (B op C). That
+      // is only the same query if every operation in the chain is the same and associative, which EXCEPT is not.
+      auto last = common::ManagedPointer(result);
+      while (last->GetSetOpSelect() != nullptr) {
+        if (last->GetSetOpType() != set_op_type || last->IsSetOpAll() != root->all_ ||
+            set_op_type == SetOperationType::EXCEPT) {
+          throw NOT_IMPLEMENTED_EXCEPTION("Set operations nested on the left of a different or EXCEPT operation");
+        }
+        last = last->GetSetOpSelect();
+      }
+      last->SetSetOpSelect(set_op_type, root->all_, std::move(right));
       break;
     }
     default: {
@@ -1387,13 +1550,17 @@ std::unique_ptr<SQLStatement> PostgresParser::CreateIndexTransform(ParseResult *
     index_type = IndexType::BPLUSTREE;
   } else if (strcmp(access_method, "hash") == 0) {
     index_type = IndexType::HASH;
+  } else if (strcmp(access_method, "art") == 0) {
+    index_type = IndexType::ART;
   } else {
     PARSER_LOG_DEBUG("CreateIndexTransform: IndexType {} not supported", access_method);
     throw NOT_IMPLEMENTED_EXCEPTION("CreateIndexTransform error");
   }
 
+  auto index_predicate = WhereTransform(parse_result, root->where_clause_);
+
   return std::make_unique<CreateStatement>(std::move(table_info), index_type, unique, index_name,
-                                           std::move(index_attrs));
+                                           std::move(index_attrs), index_predicate);
 }
 
 // Postgres.CreateSchemaStmt -> noisepage.CreateStatement
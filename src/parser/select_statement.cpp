@@ -106,7 +106,9 @@ nlohmann::json SelectStatement::ToJson() const {
   j["group_by"] = group_by_ == nullptr ? nlohmann::json(nullptr) : group_by_->ToJson();
   j["order_by"] = order_by_ == nullptr ? nlohmann::json(nullptr) : order_by_->ToJson();
   j["limit"] = limit_ == nullptr ? nlohmann::json(nullptr) : limit_->ToJson();
-  j["union_select"] = union_select_ == nullptr ? nlohmann::json(nullptr) : union_select_->ToJson();
+  j["set_op_type"] = set_op_type_;
+  j["set_op_all"] = set_op_all_;
+  j["set_op_select"] = set_op_select_ == nullptr ? nlohmann::json(nullptr) : set_op_select_->ToJson();
   return j;
 }
 
@@ -165,10 +167,12 @@ std::vector<std::unique_ptr<AbstractExpression>> SelectStatement::FromJson(const
     exprs.insert(exprs.end(), std::make_move_iterator(e1.begin()), std::make_move_iterator(e1.end()));
   }
 
-  // Deserialize select
-  if (!j.at("union_select").is_null()) {
-    union_select_ = std::make_unique<parser::SelectStatement>();
-    auto e1 = union_select_->FromJson(j.at("union_select"));
+  // Deserialize set operation
+  set_op_type_ = j.at("set_op_type").get<SetOperationType>();
+  set_op_all_ = j.at("set_op_all").get<bool>();
+  if (!j.at("set_op_select").is_null()) {
+    set_op_select_ = std::make_unique<parser::SelectStatement>();
+    auto e1 = set_op_select_->FromJson(j.at("set_op_select"));
     exprs.insert(exprs.end(), std::make_move_iterator(e1.begin()), std::make_move_iterator(e1.end()));
   }
 
@@ -179,15 +183,11 @@ DEFINE_JSON_BODY_DECLARATIONS(SelectStatement);
 
 std::unique_ptr<SelectStatement> SelectStatement::Copy() {
   auto select = std::make_unique<SelectStatement>(
-      select_, select_distinct_, from_->Copy(), where_, group_by_ == nullptr ? nullptr : group_by_->Copy(),
-      order_by_ == nullptr ? nullptr : order_by_->Copy(), limit_ == nullptr ? nullptr : limit_->Copy());
-  if (union_select_ != nullptr) {
-    auto union_copy = std::make_unique<SelectStatement>(
-        union_select_->select_, union_select_->select_distinct_, union_select_->from_->Copy(), union_select_->where_,
-        union_select_->group_by_ == nullptr ? nullptr : union_select_->group_by_->Copy(),
-        union_select_->order_by_ == nullptr ? nullptr : union_select_->order_by_->Copy(),
-        union_select_->limit_ == nullptr ? nullptr : union_select_->limit_->Copy());
-    select->SetUnionSelect(std::move(union_copy));
+      select_, select_distinct_, from_ == nullptr ? nullptr : from_->Copy(), where_,
+      group_by_ == nullptr ? nullptr : group_by_->Copy(), order_by_ == nullptr ? nullptr : order_by_->Copy(),
+      limit_ == nullptr ? nullptr : limit_->Copy());
+  if (set_op_select_ != nullptr) {
+    select->SetSetOpSelect(set_op_type_, set_op_all_, set_op_select_->Copy());
   }
   return select;
 }
@@ -195,7 +195,11 @@ std::unique_ptr<SelectStatement> SelectStatement::Copy() {
 common::hash_t SelectStatement::Hash() const {
   common::hash_t hash = common::HashUtil::Hash(GetType());
   hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(select_distinct_));
-  if (union_select_ != nullptr) hash = common::HashUtil::CombineHashes(hash, union_select_->Hash());
+  if (set_op_select_ != nullptr) {
+    hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(set_op_type_));
+    hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(set_op_all_));
+    hash = common::HashUtil::CombineHashes(hash, set_op_select_->Hash());
+  }
   if (limit_ != nullptr) hash = common::HashUtil::CombineHashes(hash, limit_->Hash());
   if (order_by_ != nullptr) hash = common::HashUtil::CombineHashes(hash, order_by_->Hash());
   if (group_by_ != nullptr) hash = common::HashUtil::CombineHashes(hash, group_by_->Hash());
@@ -234,10 +238,11 @@ bool SelectStatement::operator==(const SelectStatement &rhs) const {
   if (limit_ == nullptr && rhs.limit_ != nullptr) return false;
   if (limit_ != nullptr && rhs.limit_ != nullptr && *(limit_) != *(rhs.limit_)) return false;
 
-  if (union_select_ != nullptr && rhs.union_select_ == nullptr) return false;
-  if (union_select_ == nullptr && rhs.union_select_ != nullptr) return false;
-  if (union_select_ == nullptr && rhs.union_select_ == nullptr) return true;
-  return *(union_select_) == *(rhs.union_select_);
+  if (set_op_select_ != nullptr && rhs.set_op_select_ == nullptr) return false;
+  if (set_op_select_ == nullptr && rhs.set_op_select_ != nullptr) return false;
+  if (set_op_select_ == nullptr && rhs.set_op_select_ == nullptr) return true;
+  if (set_op_type_ != rhs.set_op_type_ || set_op_all_ != rhs.set_op_all_) return false;
+  return *(set_op_select_) == *(rhs.set_op_select_);
 }
 
 }  // namespace noisepage::parser
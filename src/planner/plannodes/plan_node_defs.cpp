@@ -68,6 +68,8 @@ std::string PlanNodeTypeToString(PlanNodeType type) {
       return "Hash";
     case PlanNodeType::SETOP:
       return "SetOperation";
+    case PlanNodeType::WINDOW:
+      return "Window";
     case PlanNodeType::EXPORT_EXTERNAL_FILE:
       return "ExportExternalFile";
     case PlanNodeType::RESULT:
@@ -0,0 +1,175 @@
+#include "planner/plannodes/window_plan_node.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "common/hash_util.h"
+#include "common/json.h"
+#include "planner/plannodes/output_schema.h"
+
+namespace noisepage::planner {
+
+namespace {
+
+// Deserialize an expression, collecting the expression and everything it owns into exprs.
+common::ManagedPointer<parser::AbstractExpression> DeserializeOwnedExpression(
+    const nlohmann::json &j, std::vector<std::unique_ptr<parser::AbstractExpression>> *exprs) {
+  auto deserialized = parser::DeserializeExpression(j);
+  auto expr = common::ManagedPointer(deserialized.result_);
+  exprs->emplace_back(std::move(deserialized.result_));
+  exprs->insert(exprs->end(), std::make_move_iterator(deserialized.non_owned_exprs_.begin()),
+                std::make_move_iterator(deserialized.non_owned_exprs_.end()));
+  return expr;
+}
+
+}  // namespace
+
+std::unique_ptr<WindowPlanNode> WindowPlanNode::Builder::Build() {
+  return std::unique_ptr<WindowPlanNode>(new WindowPlanNode(std::move(children_), std::move(output_schema_),
+                                                            std::move(partition_by_keys_), std::move(sort_keys_),
+                                                            std::move(window_functions_), plan_node_id_));
+}
+
+WindowPlanNode::WindowPlanNode(std::vector<std::unique_ptr<AbstractPlanNode>> &&children,
+                               std::unique_ptr<OutputSchema> output_schema,
+                               std::vector<common::ManagedPointer<parser::AbstractExpression>> partition_by_keys,
+                               std::vector<SortKey> sort_keys, std::vector<WindowFunction> window_functions,
+                               plan_node_id_t plan_node_id)
+    : AbstractPlanNode(std::move(children), std::move(output_schema), plan_node_id),
+      partition_by_keys_(std::move(partition_by_keys)),
+      sort_keys_(std::move(sort_keys)),
+      window_functions_(std::move(window_functions)) {}
+
+common::hash_t WindowPlanNode::Hash() const {
+  common::hash_t hash = AbstractPlanNode::Hash();
+
+  // Partition keys
+  for (const auto &key : partition_by_keys_) {
+    hash = common::HashUtil::CombineHashes(hash, key->Hash());
+  }
+
+  // Sort Keys
+  for (const auto &sort_key : sort_keys_) {
+    hash = common::HashUtil::CombineHashes(hash, sort_key.first->Hash());
+    hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(sort_key.second));
+  }
+
+  // Window functions
+  for (const auto &func : window_functions_) {
+    hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(func.type_));
+    if (func.argument_ != nullptr) {
+      hash = common::HashUtil::CombineHashes(hash, func.argument_->Hash());
+    }
+    hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(func.start_unbounded_));
+    hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(func.start_preceding_));
+    hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(func.end_unbounded_));
+    hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(func.end_following_));
+  }
+
+  return hash;
+}
+
+bool WindowPlanNode::operator==(const AbstractPlanNode &rhs) const {
+  if (!AbstractPlanNode::operator==(rhs)) return false;
+
+  auto &other = static_cast<const WindowPlanNode &>(rhs);
+
+  // Partition keys
+  if (partition_by_keys_.size() != other.partition_by_keys_.size()) return false;
+  for (auto i = 0U; i < partition_by_keys_.size(); i++) {
+    if (*partition_by_keys_[i] != *other.partition_by_keys_[i]) return false;
+  }
+
+  // Sort Keys
+  if (sort_keys_.size() != other.sort_keys_.size()) return false;
+  for (auto i = 0U; i < sort_keys_.size(); i++) {
+    if (sort_keys_[i].second != other.sort_keys_[i].second) return false;
+    if (*sort_keys_[i].first != *other.sort_keys_[i].first) return false;
+  }
+
+  // Window functions
+  if (window_functions_.size() != other.window_functions_.size()) return false;
+  for (auto i = 0U; i < window_functions_.size(); i++) {
+    const auto &func = window_functions_[i];
+    const auto &other_func = other.window_functions_[i];
+    if (func.type_ != other_func.type_) return false;
+    if ((func.argument_ == nullptr) != (other_func.argument_ == nullptr)) return false;
+    if (func.argument_ != nullptr && *func.argument_ != *other_func.argument_) return false;
+    if (func.start_unbounded_ != other_func.start_unbounded_) return false;
+    if (func.start_preceding_ != other_func.start_preceding_) return false;
+    if (func.end_unbounded_ != other_func.end_unbounded_) return false;
+    if (func.end_following_ != other_func.end_following_) return false;
+  }
+
+  return true;
+}
+
+nlohmann::json WindowPlanNode::ToJson() const {
+  nlohmann::json j = AbstractPlanNode::ToJson();
+
+  std::vector<nlohmann::json> partition_by_keys;
+  partition_by_keys.reserve(partition_by_keys_.size());
+  for (const auto &key : partition_by_keys_) {
+    partition_by_keys.emplace_back(key->ToJson());
+  }
+  j["partition_by_keys"] = partition_by_keys;
+
+  std::vector<std::pair<nlohmann::json, optimizer::OrderByOrderingType>> sort_keys;
+  sort_keys.reserve(sort_keys_.size());
+  for (const auto &key : sort_keys_) {
+    sort_keys.emplace_back(key.first->ToJson(), key.second);
+  }
+  j["sort_keys"] = sort_keys;
+
+  std::vector<nlohmann::json> window_functions;
+  window_functions.reserve(window_functions_.size());
+  for (const auto &func : window_functions_) {
+    nlohmann::json func_json;
+    func_json["type"] = func.type_;
+    func_json["argument"] = func.argument_ == nullptr ? nlohmann::json(nullptr) : func.argument_->ToJson();
+    func_json["start_unbounded"] = func.start_unbounded_;
+    func_json["start_preceding"] = func.start_preceding_;
+    func_json["end_unbounded"] = func.end_unbounded_;
+    func_json["end_following"] = func.end_following_;
+    window_functions.emplace_back(std::move(func_json));
+  }
+  j["window_functions"] = window_functions;
+  return j;
+}
+
+std::vector<std::unique_ptr<parser::AbstractExpression>> WindowPlanNode::FromJson(const nlohmann::json &j) {
+  std::vector<std::unique_ptr<parser::AbstractExpression>> exprs;
+  auto e1 = AbstractPlanNode::FromJson(j);
+  exprs.insert(exprs.end(), std::make_move_iterator(e1.begin()), std::make_move_iterator(e1.end()));
+
+  // Deserialize partition keys
+  for (const auto &key_json : j.at("partition_by_keys").get<std::vector<nlohmann::json>>()) {
+    partition_by_keys_.emplace_back(DeserializeOwnedExpression(key_json, &exprs));
+  }
+
+  // Deserialize sort keys
+  auto sort_keys = j.at("sort_keys").get<std::vector<std::pair<nlohmann::json, optimizer::OrderByOrderingType>>>();
+  for (const auto &key_json : sort_keys) {
+    sort_keys_.emplace_back(DeserializeOwnedExpression(key_json.first, &exprs), key_json.second);
+  }
+
+  // Deserialize window functions
+  for (const auto &func_json : j.at("window_functions").get<std::vector<nlohmann::json>>()) {
+    WindowFunction func;
+    func.type_ = func_json.at("type").get<WindowFunctionType>();
+    if (!func_json.at("argument").is_null()) {
+      func.argument_ = DeserializeOwnedExpression(func_json.at("argument"), &exprs);
+    }
+    func.start_unbounded_ = func_json.at("start_unbounded").get<bool>();
+    func.start_preceding_ = func_json.at("start_preceding").get<uint64_t>();
+    func.end_unbounded_ = func_json.at("end_unbounded").get<bool>();
+    func.end_following_ = func_json.at("end_following").get<uint64_t>();
+    window_functions_.emplace_back(func);
+  }
+  return exprs;
+}
+
+DEFINE_JSON_BODY_DECLARATIONS(WindowPlanNode);
+
+}  // namespace noisepage::planner
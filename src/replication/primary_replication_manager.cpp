@@ -1,16 +1,44 @@
 #include "replication/primary_replication_manager.h"
 
-#include "common/json.h"
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "loggers/replication_logger.h"
 #include "replication/replication_messages.h"
 
 namespace noisepage::replication {
 
+namespace {
+
+std::vector<std::string> ReplicaNames(const std::unordered_map<std::string, Replica> &replicas) {
+  std::vector<std::string> names;
+  names.reserve(replicas.size());
+  for (const auto &replica : replicas) {
+    names.emplace_back(replica.first);
+  }
+  return names;
+}
+
+}  // namespace
+
 PrimaryReplicationManager::PrimaryReplicationManager(
     common::ManagedPointer<messenger::Messenger> messenger, const std::string &network_identity, uint16_t port,
     const std::string &replication_hosts_path,
-    common::ManagedPointer<common::ConcurrentBlockingQueue<storage::BufferedLogWriter *>> empty_buffer_queue)
-    : ReplicationManager(messenger, network_identity, port, replication_hosts_path, empty_buffer_queue) {}
+    common::ManagedPointer<common::ConcurrentBlockingQueue<storage::BufferedLogWriter *>> empty_buffer_queue,
+    const bool compress_batches, const uint64_t send_window, const std::chrono::milliseconds send_window_timeout)
+    : ReplicationManager(messenger, network_identity, port, replication_hosts_path, empty_buffer_queue),
+      compress_batches_(compress_batches),
+      ack_interval_(send_window == 0 ? 0 : std::max<uint64_t>(1, send_window / 4)),
+      send_window_(ReplicaNames(replicas_), send_window, send_window_timeout) {
+#ifndef NOISEPAGE_USE_LZ4
+  if (compress_batches_) {
+    REPLICATION_LOG_WARN(
+        "NoisePage was built without NOISEPAGE_USE_LZ4, batches of log records are sent uncompressed.");
+  }
+#endif
+}
 
 PrimaryReplicationManager::~PrimaryReplicationManager() = default;
 
@@ -22,6 +50,10 @@ void PrimaryReplicationManager::EventLoop(common::ManagedPointer<messenger::Mess
       Handle(zmq_msg, *msg.CastManagedPointerTo<TxnAppliedMsg>());
       break;
     }
+    case ReplicationMessageType::RECORDS_BATCH_ACK: {
+      Handle(zmq_msg, *msg.CastManagedPointerTo<RecordsBatchAckMsg>());
+      break;
+    }
     default: {
       // Delegate to the common ReplicationManager event loop.
       ReplicationManager::EventLoop(messenger, zmq_msg, msg);
@@ -63,6 +95,7 @@ void PrimaryReplicationManager::ReplicateBatchOfRecords(storage::BufferedLogWrit
       // If there are currently no callbacks, execute everything that won't be sent over to the replica.
       bool was_empty = txn_callbacks_.empty();
       txn_callbacks_.emplace(commit_callbacks);
+      num_callback_batches_queued_++;
       if (was_empty) {
         // TODO(WAN): The log serializer task is then sometimes processing transaction callbacks, where normally
         //            this would be done by the Messenger's dedicated thread as part of the server-loop callback.
@@ -72,9 +105,13 @@ void PrimaryReplicationManager::ReplicateBatchOfRecords(storage::BufferedLogWrit
   }
 
   if (records_batch != nullptr) {
-    // Send the batch of records to all replicas.
+    // Send the batch of records to all replicas. Batches are pipelined, i.e., the next batch is sent without waiting
+    // for the replicas to receive this one, as long as no replica falls behind by more than the send window.
+    const record_batch_id_t batch_id = GetNextBatchId();
+    send_window_.WaitToSend(batch_id);
+    const bool ack_requested = ack_interval_ > 0 && batch_id.UnderlyingValue() % ack_interval_ == 0;
     ReplicationMessageMetadata metadata(GetNextMessageId());
-    RecordsBatchMsg msg(metadata, GetNextBatchId(), records_batch);
+    RecordsBatchMsg msg(metadata, batch_id, records_batch, compress_batches_, ack_requested);
     REPLICATION_LOG_TRACE(fmt::format("[SEND] BATCH {}", msg.GetBatchId()));
 
     messenger::callback_id_t destination_cb =
@@ -97,6 +134,12 @@ void PrimaryReplicationManager::ReplicateBatchOfRecords(storage::BufferedLogWrit
 }
 
 void PrimaryReplicationManager::NotifyReplicasOfOAT(transaction::timestamp_t oldest_active_txn) {
+  {
+    // The OAT is covered by the replicas once they have applied everything that was queued before it.
+    std::unique_lock lock(callbacks_mutex_);
+    pending_oats_.emplace(num_callback_batches_queued_, oldest_active_txn);
+  }
+
   ReplicationMessageMetadata metadata(GetNextMessageId());
   NotifyOATMsg msg(metadata, last_sent_batch_id_, oldest_active_txn);
   REPLICATION_LOG_TRACE(fmt::format("[SEND] BATCH {} OAT {}", msg.GetBatchId(), msg.GetOldestActiveTxn()));
@@ -140,6 +183,12 @@ void PrimaryReplicationManager::Handle(const messenger::ZmqMessage &zmq_msg, con
   }
 }
 
+void PrimaryReplicationManager::Handle(const messenger::ZmqMessage &zmq_msg, const RecordsBatchAckMsg &msg) {
+  REPLICATION_LOG_TRACE(fmt::format("[RECV] RecordsBatchAckMsg from {}: ID {} BATCH {}", zmq_msg.GetRoutingId(),
+                                    msg.GetMessageId(), msg.GetReceivedBatchId()));
+  send_window_.Acknowledge(std::string(zmq_msg.GetRoutingId()), msg.GetReceivedBatchId());
+}
+
 void PrimaryReplicationManager::ProcessTxnCallbacks() {
   while (!txn_callbacks_.empty()) {
     // Check that each respective callback's transaction has been applied on all the replicas.
@@ -164,6 +213,13 @@ void PrimaryReplicationManager::ProcessTxnCallbacks() {
     }
     // If all the callbacks in one batch have been exhausted, erase the exhausted batch.
     txn_callbacks_.pop();
+    num_callback_batches_processed_++;
+
+    // Advance the replicated watermark past every OAT whose preceding batches have now all been applied.
+    while (!pending_oats_.empty() && pending_oats_.front().first <= num_callback_batches_processed_) {
+      replicated_txn_watermark_.store(pending_oats_.front().second);
+      pending_oats_.pop();
+    }
   }
 }
 
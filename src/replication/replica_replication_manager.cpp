@@ -1,6 +1,5 @@
 #include "replication/replica_replication_manager.h"
 
-#include "common/json.h"
 #include "loggers/replication_logger.h"
 #include "replication/replication_messages.h"
 
@@ -21,11 +20,35 @@ void ReplicaReplicationManager::Handle(const messenger::ZmqMessage &zmq_msg, con
   provider_.UpdateOAT(msg.GetOldestActiveTxn(), msg.GetBatchId());
 }
 
-void ReplicaReplicationManager::Handle(const messenger::ZmqMessage &zmq_msg, const RecordsBatchMsg &msg) {
+void ReplicaReplicationManager::Handle(const messenger::ZmqMessage &zmq_msg, RecordsBatchMsg *msg) {
   REPLICATION_LOG_TRACE(fmt::format("[RECV] RecordsBatchMsg from {}: ID {} BATCH {}", zmq_msg.GetRoutingId(),
-                                    msg.GetMessageId(), msg.GetBatchId()));
+                                    msg->GetMessageId(), msg->GetBatchId()));
+  const record_batch_id_t batch_id = msg->GetBatchId();
+  const bool ack_requested = msg->IsAckRequested();
   // Add the batch of log records directly to the provider, which handles out of order batches.
-  provider_.AddBatchOfRecords(msg);
+  provider_.AddBatchOfRecords(std::move(*msg));
+
+  // Advance the contiguous prefix of received batches.
+  if (batch_id == RecordsBatchMsg::NextBatchId(received_up_to_)) {
+    received_up_to_ = batch_id;
+    while (!received_ahead_.empty() && *received_ahead_.begin() == RecordsBatchMsg::NextBatchId(received_up_to_)) {
+      received_up_to_ = *received_ahead_.begin();
+      received_ahead_.erase(received_ahead_.begin());
+    }
+  } else {
+    received_ahead_.emplace(batch_id);
+  }
+
+  // Acknowledge once every batch up to the newest batch that asked for an acknowledgement has been received.
+  if (ack_requested && (ack_pending_ == INVALID_RECORD_BATCH_ID || batch_id > ack_pending_)) ack_pending_ = batch_id;
+  if (ack_pending_ != INVALID_RECORD_BATCH_ID && received_up_to_ >= ack_pending_) {
+    ack_pending_ = INVALID_RECORD_BATCH_ID;
+    msg_id_t msg_id = GetNextMessageId();
+    REPLICATION_LOG_TRACE(fmt::format("[SEND] RecordsBatchAckMsg -> primary: ID {} BATCH {}", msg_id, received_up_to_));
+    RecordsBatchAckMsg ack(ReplicationMessageMetadata(msg_id), received_up_to_);
+    Send("primary", msg_id, ack.Serialize(), nullptr,
+         messenger::Messenger::GetBuiltinCallback(messenger::Messenger::BuiltinCallback::NOOP));
+  }
 }
 
 void ReplicaReplicationManager::EventLoop(common::ManagedPointer<messenger::Messenger> messenger,
@@ -37,7 +60,7 @@ void ReplicaReplicationManager::EventLoop(common::ManagedPointer<messenger::Mess
       break;
     }
     case ReplicationMessageType::RECORDS_BATCH: {
-      Handle(zmq_msg, *msg.CastManagedPointerTo<RecordsBatchMsg>());
+      Handle(zmq_msg, msg.CastManagedPointerTo<RecordsBatchMsg>().Get());
       break;
     }
     default: {
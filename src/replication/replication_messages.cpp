@@ -1,107 +1,59 @@
 #include "replication/replication_messages.h"
 
-#include "common/json.h"
+#ifdef NOISEPAGE_USE_LZ4
+#include <lz4.h>
+#endif
+
+#include "common/error/exception.h"
 #include "storage/write_ahead_log/log_io.h"
 
 namespace noisepage::replication {
 
-// All the string keys. Hopefully having them in one place minimizes conflict.
-
-const char *ReplicationMessageMetadata::key_message_id = "message_id";
-const char *BaseReplicationMessage::key_message_type = "message_type";
-const char *BaseReplicationMessage::key_metadata = "metadata";
-const char *NotifyOATMsg::key_batch_id = "oat_batch";
-const char *NotifyOATMsg::key_oldest_active_txn = "oat_ts";
-const char *RecordsBatchMsg::key_batch_id = "batch_id";
-const char *RecordsBatchMsg::key_contents = "contents";
-const char *TxnAppliedMsg::key_applied_txn_id = "applied_txn_id";
-
-// MessageWrapper
+// MessageReader
 
-MessageWrapper::MessageWrapper() : underlying_message_(std::make_unique<MessageFormat>()) {}
-
-MessageWrapper::MessageWrapper(std::string_view str)
-    : underlying_message_(std::make_unique<MessageFormat>(common::json::from_msgpack(str))) {}
-
-template <typename T>
-void MessageWrapper::Put(const char *key, T value) {
-  (*underlying_message_)[key] = value;
-}
-template void MessageWrapper::Put<std::string>(const char *key, std::string value);
-template void MessageWrapper::Put<std::vector<uint8_t>>(const char *key, std::vector<uint8_t> value);
-template void MessageWrapper::Put<MessageWrapper>(const char *key, MessageWrapper value);
-template void MessageWrapper::Put<record_batch_id_t>(const char *key, record_batch_id_t value);
-template void MessageWrapper::Put<msg_id_t>(const char *key, msg_id_t value);
-template void MessageWrapper::Put<transaction::timestamp_t>(const char *key, transaction::timestamp_t value);
-
-template <typename T>
-T MessageWrapper::Get(const char *key) const {
-  return underlying_message_->at(key).get<T>();
+std::string_view MessageReader::ReadBytes(const size_t size) {
+  if (size > Remaining()) throw REPLICATION_EXCEPTION("Truncated replication message.");
+  const auto bytes = str_.substr(pos_, size);
+  pos_ += size;
+  return bytes;
 }
-template std::string MessageWrapper::Get<std::string>(const char *key) const;
-template std::vector<uint8_t> MessageWrapper::Get<std::vector<uint8_t>>(const char *key) const;
-template MessageWrapper MessageWrapper::Get<MessageWrapper>(const char *key) const;
-template record_batch_id_t MessageWrapper::Get<record_batch_id_t>(const char *key) const;
-template msg_id_t MessageWrapper::Get<msg_id_t>(const char *key) const;
-template transaction::timestamp_t MessageWrapper::Get<transaction::timestamp_t>(const char *key) const;
-
-std::string MessageWrapper::Serialize() const {
-  const auto msg_pack = common::json::to_msgpack(*underlying_message_);
-  return std::string(reinterpret_cast<const char *>(msg_pack.data()), msg_pack.size());
-}
-
-common::json MessageWrapper::ToJson() const { return *underlying_message_; }
-
-void MessageWrapper::FromJson(const common::json &j) { *(this->underlying_message_) = j; }
 
 // ReplicationMessageMetadata
 
-MessageWrapper ReplicationMessageMetadata::ToMessageWrapper() const {
-  MessageWrapper message;
-  message.Put(key_message_id, msg_id_);
-  return message;
-}
+void ReplicationMessageMetadata::Serialize(MessageWriter *const writer) const { writer->Write(msg_id_); }
 
-ReplicationMessageMetadata::ReplicationMessageMetadata(const MessageWrapper &message)
-    : msg_id_(message.Get<msg_id_t>(key_message_id)) {}
+ReplicationMessageMetadata::ReplicationMessageMetadata(MessageReader *const reader)
+    : msg_id_(reader->Read<msg_id_t>()) {}
 
 ReplicationMessageMetadata::ReplicationMessageMetadata(msg_id_t msg_id) : msg_id_(msg_id) {}
 
 // BaseReplicationMessage
 
-MessageWrapper BaseReplicationMessage::ToMessageWrapper() const {
-  MessageWrapper message;
-  message.Put(key_message_type, ReplicationMessageTypeToString(type_));
-  // Nested fields need to be the same type as underlying message format because MessageWrapper isn't automatically
-  // serialized
-  message.Put(key_metadata, metadata_.ToMessageWrapper());
-  return message;
+std::string BaseReplicationMessage::Serialize() const {
+  MessageWriter writer;
+  writer.Write(type_);
+  metadata_.Serialize(&writer);
+  SerializeFields(&writer);
+  return writer.Release();
 }
 
-std::string BaseReplicationMessage::Serialize() const { return ToMessageWrapper().Serialize(); }
-
-BaseReplicationMessage::BaseReplicationMessage(const MessageWrapper &message)
-    : type_(ReplicationMessageTypeFromString(message.Get<std::string>(key_message_type))),
-      metadata_(ReplicationMessageMetadata(message.Get<MessageWrapper>(key_metadata))) {}
+BaseReplicationMessage::BaseReplicationMessage(ReplicationMessageType type, MessageReader *const reader)
+    : type_(type), metadata_(reader) {}
 
 BaseReplicationMessage::BaseReplicationMessage(ReplicationMessageType type, ReplicationMessageMetadata metadata)
     : type_(type), metadata_(metadata) {}
 
-DEFINE_JSON_BODY_DECLARATIONS(MessageWrapper);
-
 // NotifyOATMsg
 
-MessageWrapper NotifyOATMsg::ToMessageWrapper() const {
-  MessageWrapper message = BaseReplicationMessage::ToMessageWrapper();
-  message.Put(key_batch_id, batch_id_);
-  message.Put(key_oldest_active_txn, oldest_active_txn_);
-  return message;
+void NotifyOATMsg::SerializeFields(MessageWriter *const writer) const {
+  writer->Write(batch_id_);
+  writer->Write(oldest_active_txn_);
 }
 
-NotifyOATMsg::NotifyOATMsg(const MessageWrapper &message)
-    : BaseReplicationMessage(message),
-      batch_id_(message.Get<record_batch_id_t>(key_batch_id)),
-      oldest_active_txn_(message.Get<transaction::timestamp_t>(key_oldest_active_txn)) {}
+NotifyOATMsg::NotifyOATMsg(MessageReader *const reader)
+    : BaseReplicationMessage(ReplicationMessageType::NOTIFY_OAT, reader),
+      batch_id_(reader->Read<record_batch_id_t>()),
+      oldest_active_txn_(reader->Read<transaction::timestamp_t>()) {}
 
 NotifyOATMsg::NotifyOATMsg(ReplicationMessageMetadata metadata, record_batch_id_t batch_id,
                            transaction::timestamp_t oldest_active_txn)
@@ -111,53 +63,106 @@ NotifyOATMsg::NotifyOATMsg(ReplicationMessageMetadata metadata, record_batch_id_
 
 // RecordsBatchMsg
 
-MessageWrapper RecordsBatchMsg::ToMessageWrapper() const {
-  MessageWrapper message = BaseReplicationMessage::ToMessageWrapper();
-  message.Put(key_batch_id, batch_id_);
-  message.Put(key_contents, contents_);
-  return message;
+std::string_view RecordsBatchMsg::GetContents() const {
+  if (buffer_ != nullptr) return std::string_view(buffer_->buffer_, buffer_->buffer_size_);
+  return contents_;
 }
 
-RecordsBatchMsg::RecordsBatchMsg(const MessageWrapper &message)
-    : BaseReplicationMessage(message),
-      batch_id_(message.Get<record_batch_id_t>(key_batch_id)),
-      contents_(message.Get<std::string>(key_contents)) {}
+void RecordsBatchMsg::SerializeFields(MessageWriter *const writer) const {
+  const std::string_view contents = GetContents();
+  writer->Write(batch_id_);
+  UNUSED_ATTRIBUTE const size_t flags_offset = writer->Size();
+  const uint8_t flags = ack_requested_ ? ACK_REQUESTED : NONE;
+  writer->Write(flags);
+  writer->Write(static_cast<uint32_t>(contents.size()));
+#ifdef NOISEPAGE_USE_LZ4
+  if (compress_ && !contents.empty()) {
+    // Compress straight into the message, and fall back to the raw contents if that does not save anything.
+    const size_t payload_offset = writer->Size();
+    const auto bound = static_cast<size_t>(LZ4_compressBound(static_cast<int>(contents.size())));
+    const int compressed_size = LZ4_compress_default(contents.data(), writer->Reserve(bound),
+                                                     static_cast<int>(contents.size()), static_cast<int>(bound));
+    if (compressed_size > 0 && static_cast<size_t>(compressed_size) < contents.size()) {
+      writer->Truncate(payload_offset + compressed_size);
+      writer->WriteAt(flags_offset, static_cast<uint8_t>(flags | LZ4_COMPRESSED));
+      return;
+    }
+    writer->Truncate(payload_offset);
+  }
+#endif
+  writer->WriteBytes(contents.data(), contents.size());
+}
+
+RecordsBatchMsg::RecordsBatchMsg(MessageReader *const reader)
+    : BaseReplicationMessage(ReplicationMessageType::RECORDS_BATCH, reader),
+      batch_id_(reader->Read<record_batch_id_t>()) {
+  const auto flags = reader->Read<uint8_t>();
+  const auto size = reader->Read<uint32_t>();
+  ack_requested_ = (flags & ACK_REQUESTED) != 0;
+  if ((flags & LZ4_COMPRESSED) == 0) {
+    contents_ = std::string(reader->ReadBytes(size));
+    return;
+  }
+#ifdef NOISEPAGE_USE_LZ4
+  const auto payload = reader->ReadBytes(reader->Remaining());
+  contents_.resize(size);
+  const int decompressed_size = LZ4_decompress_safe(payload.data(), contents_.data(), static_cast<int>(payload.size()),
+                                                    static_cast<int>(size));
+  if (decompressed_size != static_cast<int>(size)) {
+    throw REPLICATION_EXCEPTION("Failed to decompress a batch of log records.");
+  }
+#else
+  throw REPLICATION_EXCEPTION("Received a compressed batch of log records, but NoisePage was built without LZ4.");
+#endif
+}
 
 RecordsBatchMsg::RecordsBatchMsg(ReplicationMessageMetadata metadata, record_batch_id_t batch_id,
-                                 storage::BufferedLogWriter *buffer)
+                                 storage::BufferedLogWriter *buffer, const bool compress, const bool ack_requested)
     : BaseReplicationMessage(ReplicationMessageType::RECORDS_BATCH, metadata),
       batch_id_(batch_id),
-      contents_(std::string(buffer->buffer_, buffer->buffer_size_)) {}
+      compress_(compress),
+      ack_requested_(ack_requested),
+      buffer_(buffer) {}
+
+// RecordsBatchAckMsg
+
+void RecordsBatchAckMsg::SerializeFields(MessageWriter *const writer) const { writer->Write(received_batch_id_); }
+
+RecordsBatchAckMsg::RecordsBatchAckMsg(MessageReader *const reader)
+    : BaseReplicationMessage(ReplicationMessageType::RECORDS_BATCH_ACK, reader),
+      received_batch_id_(reader->Read<record_batch_id_t>()) {}
+
+RecordsBatchAckMsg::RecordsBatchAckMsg(ReplicationMessageMetadata metadata, record_batch_id_t received_batch_id)
+    : BaseReplicationMessage(ReplicationMessageType::RECORDS_BATCH_ACK, metadata),
+      received_batch_id_(received_batch_id) {}
 
 // TxnAppliedMsg
 
-MessageWrapper TxnAppliedMsg::ToMessageWrapper() const {
-  MessageWrapper message = BaseReplicationMessage::ToMessageWrapper();
-  message.Put(key_applied_txn_id, applied_txn_id_);
-  return message;
-}
+void TxnAppliedMsg::SerializeFields(MessageWriter *const writer) const { writer->Write(applied_txn_id_); }
 
-TxnAppliedMsg::TxnAppliedMsg(const MessageWrapper &message)
-    : BaseReplicationMessage(message), applied_txn_id_(message.Get<transaction::timestamp_t>(key_applied_txn_id)) {}
+TxnAppliedMsg::TxnAppliedMsg(MessageReader *const reader)
+    : BaseReplicationMessage(ReplicationMessageType::TXN_APPLIED, reader),
+      applied_txn_id_(reader->Read<transaction::timestamp_t>()) {}
 
 TxnAppliedMsg::TxnAppliedMsg(ReplicationMessageMetadata metadata, transaction::timestamp_t applied_txn_id)
     : BaseReplicationMessage(ReplicationMessageType::TXN_APPLIED, metadata), applied_txn_id_(applied_txn_id) {}
 
 std::unique_ptr<BaseReplicationMessage> BaseReplicationMessage::ParseFromString(std::string_view str) {
-  MessageWrapper message(str);
-  // BaseReplicationMessage switches on the message's key_message_type to figure out what type of message to create.
-  ReplicationMessageType msg_type = ReplicationMessageTypeFromString(message.Get<std::string>(key_message_type));
+  MessageReader reader(str);
+  // BaseReplicationMessage switches on the message's type to figure out what type of message to create.
+  const auto msg_type = reader.Read<ReplicationMessageType>();
   switch (msg_type) {
     // clang-format off
-    case ReplicationMessageType::NOTIFY_OAT:          { return std::make_unique<NotifyOATMsg>(message); }
-    case ReplicationMessageType::RECORDS_BATCH:       { return std::make_unique<RecordsBatchMsg>(message); }
-    case ReplicationMessageType::TXN_APPLIED:         { return std::make_unique<TxnAppliedMsg>(message); }
+    case ReplicationMessageType::NOTIFY_OAT:          { return std::make_unique<NotifyOATMsg>(&reader); }
+    case ReplicationMessageType::RECORDS_BATCH:       { return std::make_unique<RecordsBatchMsg>(&reader); }
+    case ReplicationMessageType::RECORDS_BATCH_ACK:   { return std::make_unique<RecordsBatchAckMsg>(&reader); }
+    case ReplicationMessageType::TXN_APPLIED:         { return std::make_unique<TxnAppliedMsg>(&reader); }
     case ReplicationMessageType::INVALID:             // Fall-through.
     case ReplicationMessageType::NUM_ENUM_ENTRIES:
       throw REPLICATION_EXCEPTION("Got an INVALID ReplicationMessage?");
       // clang-format on
   }
-  throw REPLICATION_EXCEPTION("This case is impossible but GCC can't figure it out.");
+  throw REPLICATION_EXCEPTION("Got a ReplicationMessage of unknown type.");
 }
 
 }  // namespace noisepage::replication
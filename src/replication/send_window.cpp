@@ -0,0 +1,61 @@
+#include "replication/send_window.h"
+
+#include <utility>
+
+#include "loggers/replication_logger.h"
+
+namespace noisepage::replication {
+
+SendWindow::SendWindow(std::vector<std::string> replicas, const uint64_t size, const std::chrono::milliseconds timeout)
+    : replicas_(std::move(replicas)), size_(size), timeout_(timeout) {}
+
+void SendWindow::WaitToSend(const record_batch_id_t batch_id) {
+  if (size_ == 0) return;
+  std::unique_lock lock(mutex_);
+  newest_batch_id_ = batch_id;
+
+  const auto all_within_window = [&] {
+    for (const auto &replica : replicas_) {
+      if (lagging_replicas_.count(replica) == 0 && !IsWithinWindow(replica, batch_id)) return false;
+    }
+    return true;
+  };
+  if (cv_.wait_for(lock, timeout_, all_within_window)) return;
+
+  // Stop waiting for the replicas that are still behind, they rejoin the window once they catch up.
+  for (const auto &replica : replicas_) {
+    if (lagging_replicas_.count(replica) == 0 && !IsWithinWindow(replica, batch_id)) {
+      REPLICATION_LOG_WARN(fmt::format("Replica {} did not acknowledge batches within {} ms, no longer waiting for it.",
+                                       replica, timeout_.count()));
+      lagging_replicas_.emplace(replica);
+    }
+  }
+}
+
+void SendWindow::Acknowledge(const std::string &replica, const record_batch_id_t batch_id) {
+  {
+    std::unique_lock lock(mutex_);
+    // Acknowledgements may arrive out of order, only ever move the window forward.
+    auto &received = received_batches_[replica];
+    if (batch_id > received) received = batch_id;
+
+    if (lagging_replicas_.count(replica) != 0 && IsWithinWindow(replica, newest_batch_id_)) {
+      REPLICATION_LOG_INFO(fmt::format("Replica {} caught up, waiting for its acknowledgements again.", replica));
+      lagging_replicas_.erase(replica);
+    }
+  }
+  cv_.notify_all();
+}
+
+bool SendWindow::IsLagging(const std::string &replica) const {
+  std::unique_lock lock(mutex_);
+  return lagging_replicas_.count(replica) != 0;
+}
+
+bool SendWindow::IsWithinWindow(const std::string &replica, const record_batch_id_t batch_id) const {
+  const auto it = received_batches_.find(replica);
+  const uint64_t received = it == received_batches_.end() ? NULL_ID : it->second.UnderlyingValue();
+  return batch_id.UnderlyingValue() <= received + size_;
+}
+
+}  // namespace noisepage::replication
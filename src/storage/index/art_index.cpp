@@ -0,0 +1,258 @@
+#include "storage/index/art_index.h"
+
+#include "storage/index/art.h"
+#include "storage/index/compact_ints_key.h"
+#include "storage/index/generic_key.h"
+#include "transaction/deferred_action_manager.h"
+#include "transaction/transaction_context.h"
+
+namespace noisepage::storage::index {
+
+template <typename KeyType>
+ARTIndex<KeyType>::ARTIndex(IndexMetadata &&metadata)
+    : Index(std::move(metadata)), art_{new AdaptiveRadixTree<KeyType, TupleSlot, std::equal_to<TupleSlot>>} {}
+
+template <typename KeyType>
+void ARTIndex<KeyType>::PerformGarbageCollection() {
+  art_->PerformGarbageCollection();
+}
+
+template <typename KeyType>
+size_t ARTIndex<KeyType>::EstimateHeapUsage() const {
+  return art_->EstimateHeapUsage();
+}
+
+template <typename KeyType>
+bool ARTIndex<KeyType>::Insert(common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &tuple,
+                               TupleSlot location) {
+  NOISEPAGE_ASSERT(!(metadata_.GetSchema().Unique()),
+                   "This Insert is designed for secondary indexes with no uniqueness constraints.");
+  KeyType index_key;
+  index_key.SetFromProjectedRow(tuple, metadata_, metadata_.GetSchema().GetColumns().size());
+
+  auto predicate = [](const TupleSlot slot) -> bool { return false; };
+
+  const bool result = art_->Insert(index_key, location, predicate);
+
+  NOISEPAGE_ASSERT(result,
+                   "non-unique index shouldn't fail to insert. If it did, something went wrong deep inside the ART.");
+  // Register an abort action with the txn context in case of rollback
+  txn->RegisterAbortAction([=]() {
+    const bool UNUSED_ATTRIBUTE result = art_->Delete(index_key, location);
+    NOISEPAGE_ASSERT(result, "Delete on the index failed.");
+  });
+  return result;
+}
+
+template <typename KeyType>
+bool ARTIndex<KeyType>::InsertUnique(common::ManagedPointer<transaction::TransactionContext> txn,
+                                     const ProjectedRow &tuple, TupleSlot location) {
+  NOISEPAGE_ASSERT(metadata_.GetSchema().Unique(), "This Insert is designed for indexes with uniqueness constraints.");
+  KeyType index_key;
+  index_key.SetFromProjectedRow(tuple, metadata_, metadata_.GetSchema().GetColumns().size());
+
+  // The predicate checks if any matching keys have write-write conflicts or are still visible to the calling txn.
+  auto predicate = [txn](const TupleSlot slot) -> bool {
+    const auto *const data_table = slot.GetBlock()->data_table_;
+    const auto has_conflict = data_table->HasConflict(*txn, slot);
+    const auto is_visible = data_table->IsVisible(*txn, slot);
+    return has_conflict || is_visible;
+  };
+
+  // Insert a key-value pair
+  const bool result = art_->Insert(index_key, location, predicate);
+
+  if (result) {
+    // Register an abort action with the txn context in case of rollback
+    txn->RegisterAbortAction([=]() {
+      const bool UNUSED_ATTRIBUTE result = art_->Delete(index_key, location);
+      NOISEPAGE_ASSERT(result, "Delete on the index failed.");
+    });
+  } else {
+    // Presumably you've already made modifications to a DataTable (the source of the TupleSlot argument to this
+    // function) however, the index found a constraint violation and cannot allow that operation to succeed. For MVCC
+    // correctness, this txn must now abort for the GC to clean up the version chain in the DataTable correctly.
+    txn->SetMustAbort();
+  }
+
+  return result;
+}
+
+template <typename KeyType>
+void ARTIndex<KeyType>::Delete(common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &tuple,
+                               TupleSlot location) {
+  KeyType index_key;
+  index_key.SetFromProjectedRow(tuple, metadata_, metadata_.GetSchema().GetColumns().size());
+
+  NOISEPAGE_ASSERT(!(location.GetBlock()->data_table_->HasConflict(*txn, location)) &&
+                       !(location.GetBlock()->data_table_->IsVisible(*txn, location)),
+                   "Called index delete on a TupleSlot that has a conflict with this txn or is still visible.");
+
+  // Register a deferred action for the GC with txn manager. See base function comment.
+  txn->RegisterCommitAction([=](transaction::DeferredActionManager *deferred_action_manager) {
+    deferred_action_manager->RegisterDeferredAction([=]() {
+      const bool UNUSED_ATTRIBUTE result = art_->Delete(index_key, location);
+      NOISEPAGE_ASSERT(result, "Deferred delete on the index failed.");
+    });
+  });
+}
+
+template <typename KeyType>
+void ARTIndex<KeyType>::ScanKey(const transaction::TransactionContext &txn, const ProjectedRow &key,
+                                std::vector<TupleSlot> *value_list) {
+  NOISEPAGE_ASSERT(value_list->empty(), "Result set should begin empty.");
+
+  std::vector<TupleSlot> results;
+
+  // Build search key
+  KeyType index_key;
+  index_key.SetFromProjectedRow(key, metadata_, metadata_.GetSchema().GetColumns().size());
+
+  // Perform lookup in ART
+  art_->FindValues(index_key, &results);
+
+  // Avoid resizing our value_list, even if it means over-provisioning
+  value_list->reserve(results.size());
+
+  // Perform visibility check on result
+  for (const auto &result : results) {
+    if (IsVisible(txn, result)) value_list->emplace_back(result);
+  }
+
+  NOISEPAGE_ASSERT(!(metadata_.GetSchema().Unique()) || (metadata_.GetSchema().Unique() && value_list->size() <= 1),
+                   "Invalid number of results for unique index.");
+}
+
+template <typename KeyType>
+void ARTIndex<KeyType>::ScanKeyBatch(const transaction::TransactionContext &txn,
+                                     const std::vector<const ProjectedRow *> &keys,
+                                     std::vector<std::vector<TupleSlot>> *value_lists) {
+  // Build search keys
+  std::vector<KeyType> index_keys(keys.size());
+  for (uint32_t i = 0; i < keys.size(); i++) {
+    index_keys[i].SetFromProjectedRow(*keys[i], metadata_, metadata_.GetSchema().GetColumns().size());
+  }
+
+  value_lists->resize(keys.size());
+  for (auto &value_list : *value_lists) value_list.clear();
+  art_->FindValuesBatch(index_keys.data(), static_cast<uint32_t>(index_keys.size()), value_lists->data());
+
+  // Perform visibility check on results
+  for (auto &value_list : *value_lists) {
+    value_list.erase(std::remove_if(value_list.begin(), value_list.end(),
+                                    [&txn](const TupleSlot slot) { return !IsVisible(txn, slot); }),
+                     value_list.end());
+    NOISEPAGE_ASSERT(!(metadata_.GetSchema().Unique()) || value_list.size() <= 1,
+                     "Invalid number of results for unique index.");
+  }
+}
+
+template <typename KeyType>
+void ARTIndex<KeyType>::ScanAscending(const transaction::TransactionContext &txn, ScanType scan_type,
+                                      uint32_t num_attrs, ProjectedRow *low_key, ProjectedRow *high_key,
+                                      uint32_t limit, std::vector<TupleSlot> *value_list) {
+  ScanAscendingWithKeys(txn, scan_type, num_attrs, low_key, high_key, limit, value_list, nullptr);
+}
+
+template <typename KeyType>
+void ARTIndex<KeyType>::ScanAscendingWithKeys(const transaction::TransactionContext &txn, ScanType scan_type,
+                                              uint32_t num_attrs, ProjectedRow *low_key, ProjectedRow *high_key,
+                                              uint32_t limit, std::vector<TupleSlot> *value_list,
+                                              std::vector<byte> *key_list) {
+  NOISEPAGE_ASSERT(value_list->empty(), "Result set should begin empty.");
+  NOISEPAGE_ASSERT(key_list == nullptr || key_list->empty(), "Key list should begin empty.");
+  NOISEPAGE_ASSERT(scan_type == ScanType::Closed || scan_type == ScanType::OpenLow || scan_type == ScanType::OpenHigh ||
+                       scan_type == ScanType::OpenBoth,
+                   "Invalid scan_type passed into ARTIndex::Scan");
+
+  bool low_key_exists = (scan_type == ScanType::Closed || scan_type == ScanType::OpenHigh);
+  bool high_key_exists = (scan_type == ScanType::Closed || scan_type == ScanType::OpenLow);
+
+  // Build search keys. Attributes past num_attrs are left at their minimum, so a partial low key still starts the scan
+  // at the first key that matches its prefix.
+  KeyType index_low_key, index_high_key;
+  if (low_key_exists) index_low_key.SetFromProjectedRow(*low_key, metadata_, num_attrs);
+  if (high_key_exists) index_high_key.SetFromProjectedRow(*high_key, metadata_, num_attrs);
+
+  art_->Scan(low_key_exists ? &index_low_key : nullptr, true,
+             [&](const KeyType &key, const std::vector<TupleSlot> &values) {
+               if (high_key_exists && !key.PartialLessThan(index_high_key, &metadata_, num_attrs)) return false;
+               for (const auto &value : values) {
+                 if (!IsVisible(txn, value)) continue;
+                 value_list->push_back(value);
+                 if (key_list != nullptr) {
+                   const auto *const key_bytes = reinterpret_cast<const byte *>(&key);
+                   key_list->insert(key_list->end(), key_bytes, key_bytes + sizeof(KeyType));
+                 }
+                 if (limit != 0 && value_list->size() >= limit) return false;
+               }
+               return true;
+             });
+}
+
+template <typename KeyType>
+void ARTIndex<KeyType>::KeyToProjectedRow(const byte *const key, ProjectedRow *const to,
+                                          byte *const varlen_buffer) const {
+  reinterpret_cast<const KeyType *>(key)->ToProjectedRow(metadata_, to, varlen_buffer);
+}
+
+template <typename KeyType>
+void ARTIndex<KeyType>::ScanDescending(const transaction::TransactionContext &txn, const ProjectedRow &low_key,
+                                       const ProjectedRow &high_key, std::vector<TupleSlot> *value_list) {
+  NOISEPAGE_ASSERT(value_list->empty(), "Result set should begin empty.");
+
+  // Build search keys
+  KeyType index_low_key, index_high_key;
+  index_low_key.SetFromProjectedRow(low_key, metadata_, metadata_.GetSchema().GetColumns().size());
+  index_high_key.SetFromProjectedRow(high_key, metadata_, metadata_.GetSchema().GetColumns().size());
+
+  const std::less<KeyType> key_less;
+  art_->Scan(&index_high_key, false, [&](const KeyType &key, const std::vector<TupleSlot> &values) {
+    if (key_less(key, index_low_key)) return false;
+    for (const auto &value : values) {
+      if (IsVisible(txn, value)) value_list->emplace_back(value);
+    }
+    return true;
+  });
+}
+
+template <typename KeyType>
+void ARTIndex<KeyType>::ScanLimitDescending(const transaction::TransactionContext &txn, const ProjectedRow &low_key,
+                                            const ProjectedRow &high_key, std::vector<TupleSlot> *value_list,
+                                            uint32_t limit) {
+  NOISEPAGE_ASSERT(value_list->empty(), "Result set should begin empty.");
+  NOISEPAGE_ASSERT(limit > 0, "Limit must be greater than 0.");
+
+  // Build search keys
+  KeyType index_low_key, index_high_key;
+  index_low_key.SetFromProjectedRow(low_key, metadata_, metadata_.GetSchema().GetColumns().size());
+  index_high_key.SetFromProjectedRow(high_key, metadata_, metadata_.GetSchema().GetColumns().size());
+
+  const std::less<KeyType> key_less;
+  art_->Scan(&index_high_key, false, [&](const KeyType &key, const std::vector<TupleSlot> &values) {
+    if (key_less(key, index_low_key)) return false;
+    for (const auto &value : values) {
+      if (!IsVisible(txn, value)) continue;
+      value_list->push_back(value);
+      if (value_list->size() >= limit) return false;
+    }
+    return true;
+  });
+}
+
+template <typename KeyType>
+uint64_t ARTIndex<KeyType>::GetSize() const {
+  return art_->GetSize();
+}
+
+template class ARTIndex<CompactIntsKey<8>>;
+template class ARTIndex<CompactIntsKey<16>>;
+template class ARTIndex<CompactIntsKey<24>>;
+template class ARTIndex<CompactIntsKey<32>>;
+
+template class ARTIndex<GenericKey<64>>;
+template class ARTIndex<GenericKey<128>>;
+template class ARTIndex<GenericKey<256>>;
+template class ARTIndex<GenericKey<512>>;
+
+}  // namespace noisepage::storage::index
@@ -1,6 +1,7 @@
 #include "storage/index/bplustree_index.h"
 
 #include "storage/index/bplustree.h"
+#include "storage/index/bulk_load_buffer.h"
 #include "storage/index/compact_ints_key.h"
 #include "storage/index/generic_key.h"
 #include "transaction/deferred_action_manager.h"
@@ -10,7 +11,14 @@ namespace noisepage::storage::index {
 
 template <typename KeyType>
 BPlusTreeIndex<KeyType>::BPlusTreeIndex(IndexMetadata &&metadata)
-    : Index(std::move(metadata)), bplustree_{new BPlusTree<KeyType, TupleSlot>} {}
+    : Index(std::move(metadata)),
+      bplustree_{new BPlusTree<KeyType, TupleSlot>},
+      bulk_load_buffer_{new BulkLoadBuffer<KeyType>} {}
+
+template <typename KeyType>
+void BPlusTreeIndex<KeyType>::PerformGarbageCollection() {
+  bplustree_->PerformGarbageCollection();
+}
 
 template <typename KeyType>
 size_t BPlusTreeIndex<KeyType>::EstimateHeapUsage() const {
@@ -75,6 +83,48 @@ bool BPlusTreeIndex<KeyType>::InsertUnique(common::ManagedPointer<transaction::T
   return result;
 }
 
+template <typename KeyType>
+bool BPlusTreeIndex<KeyType>::StageForBulkLoad(common::ManagedPointer<transaction::TransactionContext> txn,
+                                               const ProjectedRow &tuple, TupleSlot location) {
+  KeyType index_key;
+  index_key.SetFromProjectedRow(tuple, metadata_, metadata_.GetSchema().GetColumns().size());
+  bulk_load_buffer_->Stage(index_key, location);
+  return true;
+}
+
+template <typename KeyType>
+bool BPlusTreeIndex<KeyType>::BulkLoad(common::ManagedPointer<transaction::TransactionContext> txn,
+                                       const double fill_factor) {
+  const auto sorted = bulk_load_buffer_->TakeSorted();
+  const bool unique = metadata_.GetSchema().Unique();
+  if (unique && BulkLoadBuffer<KeyType>::HasDuplicateKey(sorted)) {
+    // Same as a failed InsertUnique, the txn must abort for MVCC correctness.
+    txn->SetMustAbort();
+    return false;
+  }
+  if (bplustree_->BulkLoad(sorted, fill_factor)) return true;
+
+  // The index is not empty, so fall back to inserting the pairs one at a time. In key order, the inserts at least visit
+  // the leaves sequentially.
+  auto predicate = [txn, unique](const TupleSlot slot) -> bool {
+    if (!unique) return false;
+    const auto *const data_table = slot.GetBlock()->data_table_;
+    return data_table->HasConflict(*txn, slot) || data_table->IsVisible(*txn, slot);
+  };
+  for (const auto &element : sorted) {
+    if (!bplustree_->Insert(element, predicate)) {
+      NOISEPAGE_ASSERT(unique, "non-unique index shouldn't fail to insert.");
+      txn->SetMustAbort();
+      return false;
+    }
+    txn->RegisterAbortAction([=]() {
+      const bool UNUSED_ATTRIBUTE result = bplustree_->DeleteElement(element);
+      NOISEPAGE_ASSERT(result, "Delete on the index failed.");
+    });
+  }
+  return true;
+}
+
 template <typename KeyType>
 void BPlusTreeIndex<KeyType>::Delete(common::ManagedPointer<transaction::TransactionContext> txn,
                                      const ProjectedRow &tuple, TupleSlot location) {
@@ -95,6 +145,76 @@ void BPlusTreeIndex<KeyType>::Delete(common::ManagedPointer<transaction::Transac
   });
 }
 
+template <typename KeyType>
+bool BPlusTreeIndex<KeyType>::InsertBatch(common::ManagedPointer<transaction::TransactionContext> txn,
+                                          const std::vector<const ProjectedRow *> &tuples,
+                                          const std::vector<TupleSlot> &locations) {
+  const bool unique = metadata_.GetSchema().Unique();
+  const auto sorted = SortedElements(tuples, locations);
+
+  // The predicate checks if any matching keys have write-write conflicts or are still visible to the calling txn.
+  auto predicate = [txn, unique](const TupleSlot slot) -> bool {
+    if (!unique) return false;
+    const auto *const data_table = slot.GetBlock()->data_table_;
+    return data_table->HasConflict(*txn, slot) || data_table->IsVisible(*txn, slot);
+  };
+
+  std::vector<std::pair<KeyType, TupleSlot>> inserted;
+  inserted.reserve(sorted.size());
+  const bool result = bplustree_->InsertBatch(sorted, predicate, &inserted);
+
+  if (!inserted.empty()) {
+    // Register a single abort action with the txn context in case of rollback
+    txn->RegisterAbortAction([=]() {
+      const size_t UNUSED_ATTRIBUTE num_deleted = bplustree_->DeleteBatch(inserted);
+      NOISEPAGE_ASSERT(num_deleted == inserted.size(), "Delete on the index failed.");
+    });
+  }
+
+  if (!result) {
+    NOISEPAGE_ASSERT(unique, "non-unique index shouldn't fail to insert.");
+    // Same as a failed InsertUnique, the txn must abort for MVCC correctness.
+    txn->SetMustAbort();
+  }
+  return result;
+}
+
+template <typename KeyType>
+void BPlusTreeIndex<KeyType>::DeleteBatch(common::ManagedPointer<transaction::TransactionContext> txn,
+                                          const std::vector<const ProjectedRow *> &tuples,
+                                          const std::vector<TupleSlot> &locations) {
+  for (const auto location : locations) {
+    NOISEPAGE_ASSERT(!(location.GetBlock()->data_table_->HasConflict(*txn, location)) &&
+                         !(location.GetBlock()->data_table_->IsVisible(*txn, location)),
+                     "Called index delete on a TupleSlot that has a conflict with this txn or is still visible.");
+  }
+  auto sorted = SortedElements(tuples, locations);
+
+  // Register a single deferred action for the GC with txn manager. See base function comment.
+  txn->RegisterCommitAction([=, sorted = std::move(sorted)](transaction::DeferredActionManager *deferred_action_manager) {
+    deferred_action_manager->RegisterDeferredAction([=]() {
+      const size_t UNUSED_ATTRIBUTE num_deleted = bplustree_->DeleteBatch(sorted);
+      NOISEPAGE_ASSERT(num_deleted == sorted.size(), "Deferred delete on the index failed.");
+    });
+  });
+}
+
+template <typename KeyType>
+std::vector<std::pair<KeyType, TupleSlot>> BPlusTreeIndex<KeyType>::SortedElements(
+    const std::vector<const ProjectedRow *> &tuples, const std::vector<TupleSlot> &locations) const {
+  NOISEPAGE_ASSERT(tuples.size() == locations.size(), "Every key needs a value.");
+  std::vector<std::pair<KeyType, TupleSlot>> sorted(tuples.size());
+  for (uint32_t i = 0; i < tuples.size(); i++) {
+    sorted[i].first.SetFromProjectedRow(*tuples[i], metadata_, metadata_.GetSchema().GetColumns().size());
+    sorted[i].second = locations[i];
+  }
+  // Pairs with equal keys stay in the order of the batch, so that the first of them wins on a unique index.
+  std::stable_sort(sorted.begin(), sorted.end(), [](const auto &lhs, const auto &rhs) {
+    return std::less<KeyType>()(lhs.first, rhs.first);  // NOLINT transparent functors can't figure out template
+  });
+  return sorted;
+}
+
 template <typename KeyType>
 void BPlusTreeIndex<KeyType>::ScanKey(const transaction::TransactionContext &txn, const ProjectedRow &key,
                                       std::vector<TupleSlot> *value_list) {
@@ -121,11 +241,44 @@ void BPlusTreeIndex<KeyType>::ScanKey(const transaction::TransactionContext &txn
                    "Invalid number of results for unique index.");
 }
 
+template <typename KeyType>
+void BPlusTreeIndex<KeyType>::ScanKeyBatch(const transaction::TransactionContext &txn,
+                                           const std::vector<const ProjectedRow *> &keys,
+                                           std::vector<std::vector<TupleSlot>> *value_lists) {
+  // Build search keys
+  std::vector<KeyType> index_keys(keys.size());
+  for (uint32_t i = 0; i < keys.size(); i++) {
+    index_keys[i].SetFromProjectedRow(*keys[i], metadata_, metadata_.GetSchema().GetColumns().size());
+  }
+
+  value_lists->resize(keys.size());
+  for (auto &value_list : *value_lists) value_list.clear();
+  bplustree_->FindValuesOfKeys(index_keys.data(), static_cast<uint32_t>(index_keys.size()), value_lists->data());
+
+  // Perform visibility check on results
+  for (auto &value_list : *value_lists) {
+    value_list.erase(std::remove_if(value_list.begin(), value_list.end(),
+                                    [&txn](const TupleSlot slot) { return !IsVisible(txn, slot); }),
+                     value_list.end());
+    NOISEPAGE_ASSERT(!(metadata_.GetSchema().Unique()) || value_list.size() <= 1,
+                     "Invalid number of results for unique index.");
+  }
+}
+
 template <typename KeyType>
 void BPlusTreeIndex<KeyType>::ScanAscending(const transaction::TransactionContext &txn, ScanType scan_type,
                                             uint32_t num_attrs, ProjectedRow *low_key, ProjectedRow *high_key,
                                             uint32_t limit, std::vector<TupleSlot> *value_list) {
+  ScanAscendingWithKeys(txn, scan_type, num_attrs, low_key, high_key, limit, value_list, nullptr);
+}
+
+template <typename KeyType>
+void BPlusTreeIndex<KeyType>::ScanAscendingWithKeys(const transaction::TransactionContext &txn, ScanType scan_type,
+                                                    uint32_t num_attrs, ProjectedRow *low_key, ProjectedRow *high_key,
+                                                    uint32_t limit, std::vector<TupleSlot> *value_list,
+                                                    std::vector<byte> *key_list) {
   NOISEPAGE_ASSERT(value_list->empty(), "Result set should begin empty.");
+  NOISEPAGE_ASSERT(key_list == nullptr || key_list->empty(), "Key list should begin empty.");
   NOISEPAGE_ASSERT(scan_type == ScanType::Closed || scan_type == ScanType::OpenLow || scan_type == ScanType::OpenHigh ||
                        scan_type == ScanType::OpenBoth,
                    "Invalid scan_type passed into BPlusTreeIndex::Scan");
@@ -141,13 +294,14 @@ void BPlusTreeIndex<KeyType>::ScanAscending(const transaction::TransactionContex
   if (low_key_exists) index_low_key.SetFromProjectedRow(*low_key, metadata_, num_attrs);
   if (high_key_exists) index_high_key.SetFromProjectedRow(*high_key, metadata_, num_attrs);
 
-  bool scan_completed = false;
+  bplustree_->ScanAscending(index_low_key, index_high_key, low_key_exists, num_attrs, high_key_exists, limit,
+                            value_list, &metadata_, predicate, key_list);
+}
 
-  while (!scan_completed) {
-    value_list->clear();
-    scan_completed = bplustree_->ScanAscending(index_low_key, index_high_key, low_key_exists, num_attrs,
-                                               high_key_exists, limit, value_list, &metadata_, predicate);
-  }
+template <typename KeyType>
+void BPlusTreeIndex<KeyType>::KeyToProjectedRow(const byte *const key, ProjectedRow *const to,
+                                                byte *const varlen_buffer) const {
+  reinterpret_cast<const KeyType *>(key)->ToProjectedRow(metadata_, to, varlen_buffer);
 }
 
 template <typename KeyType>
@@ -160,13 +314,8 @@ void BPlusTreeIndex<KeyType>::ScanDescending(const transaction::TransactionConte
   index_low_key.SetFromProjectedRow(low_key, metadata_, metadata_.GetSchema().GetColumns().size());
   index_high_key.SetFromProjectedRow(high_key, metadata_, metadata_.GetSchema().GetColumns().size());
 
-  bool scan_completed = false;
   std::vector<TupleSlot> results;
-
-  while (!scan_completed) {
-    results.clear();
-    scan_completed = bplustree_->ScanDescending(index_low_key, index_high_key, &results);
-  }
+  bplustree_->ScanDescending(index_low_key, index_high_key, &results);
 
   for (const auto &result : results) {
     if (IsVisible(txn, result)) value_list->emplace_back(result);
@@ -188,11 +337,7 @@ void BPlusTreeIndex<KeyType>::ScanLimitDescending(const transaction::Transaction
   index_low_key.SetFromProjectedRow(low_key, metadata_, metadata_.GetSchema().GetColumns().size());
   index_high_key.SetFromProjectedRow(high_key, metadata_, metadata_.GetSchema().GetColumns().size());
 
-  bool scan_completed = false;
-  while (!scan_completed) {
-    value_list->clear();
-    scan_completed = bplustree_->ScanLimitDescending(index_low_key, index_high_key, value_list, limit, predicate);
-  }
+  bplustree_->ScanLimitDescending(index_low_key, index_high_key, value_list, limit, predicate);
 }
 
 template <typename KeyType>
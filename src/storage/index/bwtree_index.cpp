@@ -1,6 +1,7 @@
 #include "storage/index/bwtree_index.h"
 
 #include "bwtree/bwtree.h"
+#include "storage/index/bulk_load_buffer.h"
 #include "storage/index/compact_ints_key.h"
 #include "storage/index/generic_key.h"
 #include "transaction/deferred_action_manager.h"
@@ -10,7 +11,9 @@ namespace noisepage::storage::index {
 
 template <typename KeyType>
 BwTreeIndex<KeyType>::BwTreeIndex(IndexMetadata metadata)
-    : Index(std::move(metadata)), bwtree_(std::make_unique<third_party::bwtree::BwTree<KeyType, TupleSlot>>(false)) {}
+    : Index(std::move(metadata)),
+      bwtree_(std::make_unique<third_party::bwtree::BwTree<KeyType, TupleSlot>>(false)),
+      bulk_load_buffer_(std::make_unique<BulkLoadBuffer<KeyType>>()) {}
 
 template <typename KeyType>
 void BwTreeIndex<KeyType>::PerformGarbageCollection() {
@@ -108,6 +111,50 @@ bool BwTreeIndex<KeyType>::InsertUnique(const common::ManagedPointer<transaction
   return result;
 }
 
+template <typename KeyType>
+bool BwTreeIndex<KeyType>::StageForBulkLoad(const common::ManagedPointer<transaction::TransactionContext> txn,
+                                            const ProjectedRow &tuple, const TupleSlot location) {
+  KeyType index_key;
+  index_key.SetFromProjectedRow(tuple, metadata_, metadata_.GetSchema().GetColumns().size());
+  bulk_load_buffer_->Stage(index_key, location);
+  return true;
+}
+
+template <typename KeyType>
+bool BwTreeIndex<KeyType>::BulkLoad(const common::ManagedPointer<transaction::TransactionContext> txn,
+                                    const double fill_factor) {
+  const auto sorted = bulk_load_buffer_->TakeSorted();
+  const bool unique = metadata_.GetSchema().Unique();
+  if (unique && BulkLoadBuffer<KeyType>::HasDuplicateKey(sorted)) {
+    // Same as a failed InsertUnique, the txn must abort for MVCC correctness.
+    txn->SetMustAbort();
+    return false;
+  }
+  if (bwtree_->BulkLoad(sorted, fill_factor)) return true;
+
+  // The index is not empty, so fall back to inserting the pairs one at a time. In key order, the inserts at least visit
+  // the leaves sequentially.
+  auto predicate = [txn](const TupleSlot slot) -> bool {
+    const auto *const data_table = slot.GetBlock()->data_table_;
+    return data_table->HasConflict(*txn, slot) || data_table->IsVisible(*txn, slot);
+  };
+  for (const auto &[index_key, location] : sorted) {
+    bool predicate_satisfied = false;
+    const bool result = unique ? bwtree_->ConditionalInsert(index_key, location, predicate, &predicate_satisfied)
+                               : bwtree_->Insert(index_key, location, false);
+    if (!result) {
+      NOISEPAGE_ASSERT(unique, "non-unique index shouldn't fail to insert.");
+      txn->SetMustAbort();
+      return false;
+    }
+    txn->RegisterAbortAction([=, key = index_key, slot = location]() {
+      const bool UNUSED_ATTRIBUTE result = bwtree_->Delete(key, slot);
+      NOISEPAGE_ASSERT(result, "Delete on the index failed.");
+    });
+  }
+  return true;
+}
+
 template <typename KeyType>
 void BwTreeIndex<KeyType>::Delete(const common::ManagedPointer<transaction::TransactionContext> txn,
                                   const ProjectedRow &tuple, const TupleSlot location) {
@@ -157,7 +204,16 @@ template <typename KeyType>
 void BwTreeIndex<KeyType>::ScanAscending(const transaction::TransactionContext &txn, ScanType scan_type,
                                          uint32_t num_attrs, ProjectedRow *low_key, ProjectedRow *high_key,
                                          uint32_t limit, std::vector<TupleSlot> *value_list) {
+  ScanAscendingWithKeys(txn, scan_type, num_attrs, low_key, high_key, limit, value_list, nullptr);
+}
+
+template <typename KeyType>
+void BwTreeIndex<KeyType>::ScanAscendingWithKeys(const transaction::TransactionContext &txn, ScanType scan_type,
+                                                 uint32_t num_attrs, ProjectedRow *low_key, ProjectedRow *high_key,
+                                                 uint32_t limit, std::vector<TupleSlot> *value_list,
+                                                 std::vector<byte> *key_list) {
   NOISEPAGE_ASSERT(value_list->empty(), "Result set should begin empty.");
+  NOISEPAGE_ASSERT(key_list == nullptr || key_list->empty(), "Key list should begin empty.");
   NOISEPAGE_ASSERT(scan_type == ScanType::Closed || scan_type == ScanType::OpenLow || scan_type == ScanType::OpenHigh ||
                        scan_type == ScanType::OpenBoth,
                    "Invalid scan_type passed into BwTreeIndex::Scan");
@@ -177,11 +233,23 @@ void BwTreeIndex<KeyType>::ScanAscending(const transaction::TransactionContext &
   while ((limit == 0 || value_list->size() < limit) && !scan_itr.IsEnd() &&
          (!high_key_exists || scan_itr->first.PartialLessThan(index_high_key, &metadata_, num_attrs))) {
     // Perform visibility check on result
-    if (IsVisible(txn, scan_itr->second)) value_list->emplace_back(scan_itr->second);
+    if (IsVisible(txn, scan_itr->second)) {
+      value_list->emplace_back(scan_itr->second);
+      if (key_list != nullptr) {
+        const auto *const key_bytes = reinterpret_cast<const byte *>(&scan_itr->first);
+        key_list->insert(key_list->end(), key_bytes, key_bytes + sizeof(KeyType));
+      }
+    }
     scan_itr++;
   }
 }
 
+template <typename KeyType>
+void BwTreeIndex<KeyType>::KeyToProjectedRow(const byte *const key, ProjectedRow *const to,
+                                             byte *const varlen_buffer) const {
+  reinterpret_cast<const KeyType *>(key)->ToProjectedRow(metadata_, to, varlen_buffer);
+}
+
 template <typename KeyType>
 void BwTreeIndex<KeyType>::BwTreeIndex::ScanDescending(const transaction::TransactionContext &txn,
                                                        const ProjectedRow &low_key, const ProjectedRow &high_key,
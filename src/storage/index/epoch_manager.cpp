@@ -0,0 +1,74 @@
+#include "storage/index/epoch_manager.h"
+
+#include <algorithm>
+
+namespace noisepage::storage::index {
+
+EpochManager::~EpochManager() {
+  for (uint32_t i = 0; i < NUM_SLOTS; i++) {
+    for (const auto &retired : slots_[i].retired_) retired.deleter_(retired.object_);
+  }
+}
+
+uint32_t EpochManager::ThreadSlot() {
+  static std::atomic<uint32_t> next_slot = 0;
+  static thread_local const uint32_t slot = next_slot.fetch_add(1, std::memory_order_relaxed) % NUM_SLOTS;
+  return slot;
+}
+
+void EpochManager::Retire(void *const object, const Deleter deleter) {
+  Slot *const slot = &slots_[ThreadSlot()];
+  bool reclaim;
+  {
+    common::SpinLatch::ScopedSpinLatch guard(&slot->retired_latch_);
+    // The object was unlinked before the epoch is read, so readers of any later epoch cannot see it.
+    slot->retired_.push_back({object, deleter, global_epoch_.load()});
+    reclaim = slot->retired_.size() >= RECLAIM_THRESHOLD;
+  }
+  if (reclaim) {
+    TryAdvance();
+    ReclaimSlot(slot);
+  }
+}
+
+void EpochManager::Reclaim() {
+  // Two advances make everything that was retired before this call safe to free, unless readers are still around.
+  TryAdvance();
+  TryAdvance();
+  for (uint32_t i = 0; i < NUM_SLOTS; i++) ReclaimSlot(&slots_[i]);
+}
+
+size_t EpochManager::NumRetired() {
+  size_t num_retired = 0;
+  for (uint32_t i = 0; i < NUM_SLOTS; i++) {
+    common::SpinLatch::ScopedSpinLatch guard(&slots_[i].retired_latch_);
+    num_retired += slots_[i].retired_.size();
+  }
+  return num_retired;
+}
+
+void EpochManager::TryAdvance() {
+  uint64_t epoch = global_epoch_.load();
+  // Readers are either in the current epoch or in the previous one, whose parity is the same as the next one's.
+  for (uint32_t i = 0; i < NUM_SLOTS; i++) {
+    if (slots_[i].readers_[(epoch + 1) & 1U].load() != 0) return;
+  }
+  global_epoch_.compare_exchange_strong(epoch, epoch + 1);
+}
+
+void EpochManager::ReclaimSlot(Slot *const slot) {
+  const uint64_t epoch = global_epoch_.load();
+  std::vector<RetiredObject> reclaimable;
+  {
+    common::SpinLatch::ScopedSpinLatch guard(&slot->retired_latch_);
+    auto &retired = slot->retired_;
+    const auto safe_end = std::partition(retired.begin(), retired.end(),
+                                         [epoch](const RetiredObject &object) { return object.epoch_ + 2 <= epoch; });
+    reclaimable.assign(retired.begin(), safe_end);
+    retired.erase(retired.begin(), safe_end);
+  }
+  // Free outside of the latch, so that other threads of the slot can keep retiring objects.
+  for (const auto &object : reclaimable) object.deleter_(object.object_);
+}
+
+}  // namespace noisepage::storage::index
@@ -0,0 +1,39 @@
+#include "storage/recovery/disk_log_provider.h"
+
+#include <string>
+
+namespace noisepage::storage {
+
+DiskLogProvider::DiskLogProvider(const std::string &log_file_path, const transaction::timestamp_t replay_after)
+    : segments_(LogSegmentManager::ListSegments(log_file_path)) {
+  if (segments_.empty()) {
+    in_ = std::make_unique<BufferedLogReader>(log_file_path.c_str());
+    return;
+  }
+  // Segments are opened lazily by HasMoreRecords().
+  next_segment_ = LogSegmentManager::FirstSegmentToReplay(segments_, replay_after);
+}
+
+void DiskLogProvider::OpenNextSegment() {
+  NOISEPAGE_ASSERT(next_segment_ < segments_.size(), "No more log segments to open.");
+  in_ = std::make_unique<BufferedLogReader>(segments_[next_segment_++].path_.c_str());
+  const auto header = in_->ReadValue<LogSegmentHeader>();
+  // Skip any header fields added by newer format versions.
+  for (uint32_t i = sizeof(LogSegmentHeader); i < header.header_size_; i++) in_->ReadValue<byte>();
+}
+
+bool DiskLogProvider::HasMoreRecords() {
+  while (true) {
+    if (in_ != nullptr && in_->HasMore()) {
+      // Log records are never empty, so a record size of 0 is the zero padding that a direct I/O log writer leaves at
+      // the end of a log file that was not closed cleanly (see UringLogWriter). Nothing follows the padding.
+      uint32_t record_size;
+      if (in_->Peek(&record_size, sizeof(record_size)) && record_size != 0) return true;
+      in_.reset();
+    }
+    if (next_segment_ == segments_.size()) return false;
+    OpenNextSegment();
+  }
+}
+
+}  // namespace noisepage::storage
@@ -1,6 +1,10 @@
 #include "storage/recovery/recovery_manager.h"
 
+#include <tbb/parallel_for_each.h>
+#include <tbb/task_arena.h>
+
 #include <algorithm>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -179,9 +183,110 @@ uint32_t RecoveryManager::ProcessCommittedTransaction(noisepage::transaction::ti
   buffered_changes_map_.erase(txn_id);
 
   // Commit the txn
-  txn_manager_->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+  {
+    common::SharedLatch::ScopedExclusiveLatch guard(&snapshot_latch_);
+    txn_manager_->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+    last_applied_txn_id_.store(std::max(last_applied_txn_id_.load(), txn_id));
+  }
+  NotifyTransactionApplied(txn_id);
+
+  return records_processed;
+}
+
+bool RecoveryManager::CanApplyInParallel(const transaction::timestamp_t txn_id) {
+  for (const auto &buffered_pair : buffered_changes_map_[txn_id]) {
+    const auto *record = buffered_pair.first;
+    const auto table_oid = record->RecordType() == LogRecordType::REDO
+                               ? record->GetUnderlyingRecordBodyAs<RedoRecord>()->GetTableOid()
+                               : record->GetUnderlyingRecordBodyAs<DeleteRecord>()->GetTableOid();
+    // Catalog changes are applied serially, as they may change which tables exist.
+    if (IsCatalogTable(table_oid)) return false;
+  }
+  return true;
+}
+
+uint32_t RecoveryManager::ProcessCommittedTransactionsInParallel(const std::vector<transaction::timestamp_t> &txn_ids) {
+  if (txn_ids.empty()) return 0;
+
+  // Group the transactions with a union-find over the transactions, where a transaction is joined with the previous
+  // transaction that modified each of its tables. Transactions in different groups thus modify disjoint sets of tables.
+  std::vector<uint32_t> parent(txn_ids.size());
+  const auto find = [&](uint32_t i) {
+    while (parent[i] != i) i = parent[i] = parent[parent[i]];
+    return i;
+  };
+  std::unordered_map<uint64_t, uint32_t> table_writer;
+  for (uint32_t i = 0; i < txn_ids.size(); i++) {
+    parent[i] = i;
+    for (const auto &buffered_pair : buffered_changes_map_[txn_ids[i]]) {
+      const auto *record = buffered_pair.first;
+      uint64_t table_key;
+      if (record->RecordType() == LogRecordType::REDO) {
+        const auto *redo = record->GetUnderlyingRecordBodyAs<RedoRecord>();
+        table_key = static_cast<uint64_t>(redo->GetDatabaseOid().UnderlyingValue()) << 32U |
+                    redo->GetTableOid().UnderlyingValue();
+      } else {
+        const auto *del = record->GetUnderlyingRecordBodyAs<DeleteRecord>();
+        table_key = static_cast<uint64_t>(del->GetDatabaseOid().UnderlyingValue()) << 32U |
+                    del->GetTableOid().UnderlyingValue();
+      }
+      const auto writer = table_writer.emplace(table_key, i).first->second;
+      parent[find(i)] = find(writer);
+    }
+  }
+
+  // Move the changes of each transaction into its group, keeping the original order within a group.
+  std::vector<ApplyGroup> groups;
+  std::unordered_map<uint32_t, uint32_t> group_of_root;
+  for (uint32_t i = 0; i < txn_ids.size(); i++) {
+    const auto group_idx = group_of_root.emplace(find(i), groups.size()).first->second;
+    if (group_idx == groups.size()) groups.emplace_back();
+    groups[group_idx].txn_ids_.push_back(txn_ids[i]);
+    groups[group_idx].changes_.emplace_back(std::move(buffered_changes_map_[txn_ids[i]]));
+    buffered_changes_map_.erase(txn_ids[i]);
+  }
+
+  // Apply the groups in parallel. None of the changes are special case catalog records.
+  std::atomic<uint32_t> records_processed = 0;
+  tbb::task_arena arena(static_cast<int>(std::min(apply_threads_, static_cast<uint32_t>(groups.size()))));
+  arena.execute([&] {
+    tbb::parallel_for_each(groups.begin(), groups.end(), [&](ApplyGroup &group) {
+      group.txn_ = txn_manager_->BeginTransaction();
+      for (auto &changes : group.changes_) {
+        for (auto &buffered_pair : changes) {
+          if (buffered_pair.first->RecordType() == LogRecordType::REDO) {
+            ReplayRedoRecord(group.txn_, buffered_pair.first);
+          } else {
+            ReplayDeleteRecord(group.txn_, buffered_pair.first);
+          }
+        }
+        records_processed += changes.size();
+      }
+    });
+  });
 
-  last_applied_txn_id_ = std::max(last_applied_txn_id_, txn_id);
+  // Commit all groups at once, so that snapshot transactions see either all or none of them.
+  {
+    common::SharedLatch::ScopedExclusiveLatch guard(&snapshot_latch_);
+    for (auto &group : groups) {
+      txn_manager_->Commit(group.txn_, transaction::TransactionUtil::EmptyCallback, nullptr);
+      last_applied_txn_id_.store(std::max(last_applied_txn_id_.load(), group.txn_ids_.back()));
+    }
+  }
+
+  for (auto &group : groups) {
+    for (auto &changes : group.changes_) DeferRecordDeletes(std::move(changes), false);
+    for (const auto txn_id : group.txn_ids_) NotifyTransactionApplied(txn_id);
+  }
+  return records_processed.load();
+}
+
+transaction::TransactionContext *RecoveryManager::BeginSnapshotTransaction() {
+  common::SharedLatch::ScopedSharedLatch guard(&snapshot_latch_);
+  return txn_manager_->BeginTransaction();
+}
+
+void RecoveryManager::NotifyTransactionApplied(const transaction::timestamp_t txn_id) {
   if (replication_manager_ != DISABLED) {
     // Replicas have to send back their list of deferred transactions that were processed, periodically.
     // TODO(WAN): Per Joe's comment, it may be worth sending back transaction IDs to the primary in batches.
@@ -191,13 +296,12 @@ uint32_t RecoveryManager::ProcessCommittedTransaction(noisepage::transaction::ti
       replication_manager_->GetAsReplica()->NotifyPrimaryTransactionApplied(txn_id);
     }
   }
-
-  return records_processed;
 }
 
-void RecoveryManager::DeferRecordDeletes(noisepage::transaction::timestamp_t txn_id, bool delete_varlens) {
+void RecoveryManager::DeferRecordDeletes(std::vector<std::pair<LogRecord *, std::vector<byte *>>> &&buffered_changes,
+                                         bool delete_varlens) {
   // Capture the changes by value except for changes which we can move
-  deferred_action_manager_->RegisterDeferredAction([=, buffered_changes{std::move(buffered_changes_map_[txn_id])}]() {
+  deferred_action_manager_->RegisterDeferredAction([=, buffered_changes{std::move(buffered_changes)}]() {
     for (auto &buffered_pair : buffered_changes) {
       delete[] reinterpret_cast<byte *>(buffered_pair.first);
       if (delete_varlens) {
@@ -219,10 +323,19 @@ std::pair<uint32_t, uint32_t> RecoveryManager::ProcessDeferredTransactions(
       (upper_bound_ts == transaction::INVALID_TXN_TIMESTAMP) ? transaction::timestamp_t(INT64_MAX) : upper_bound_ts;
   auto upper_bound_it = deferred_txns_.upper_bound(upper_bound_ts);
 
+  // Transactions that can be applied in parallel are collected until the next one that has to be applied serially.
+  std::vector<transaction::timestamp_t> parallel_txns;
   for (auto it = deferred_txns_.begin(); it != upper_bound_it; it++) {
-    records_processed += ProcessCommittedTransaction(*it);
+    if (apply_threads_ > 1 && CanApplyInParallel(*it)) {
+      parallel_txns.push_back(*it);
+    } else {
+      records_processed += ProcessCommittedTransactionsInParallel(parallel_txns);
+      parallel_txns.clear();
+      records_processed += ProcessCommittedTransaction(*it);
+    }
     txns_processed++;
   }
+  records_processed += ProcessCommittedTransactionsInParallel(parallel_txns);
 
   // If we actually processed some txns, remove them from the set
   if (txns_processed > 0) deferred_txns_.erase(deferred_txns_.begin(), upper_bound_it);
@@ -250,9 +363,10 @@ void RecoveryManager::ReplayRedoRecord(transaction::TransactionContext *txn, Log
     NOISEPAGE_ASSERT(staged_record->GetTupleSlot() == new_tuple_slot,
                      "Insert should update redo record with new tuple slot");
     // Create a mapping of the old to new tuple. The new tuple slot should be used for future updates and deletes.
+    common::SpinLatch::ScopedSpinLatch guard(&tuple_slot_map_latch_);
     tuple_slot_map_[old_tuple_slot] = new_tuple_slot;
   } else {
-    auto new_tuple_slot = tuple_slot_map_[redo_record->GetTupleSlot()];
+    auto new_tuple_slot = GetTupleSlotMapping(redo_record->GetTupleSlot());
     redo_record->SetTupleSlot(new_tuple_slot);
     // Stage the write. This way the recovery operation is logged if logging is enabled
     auto staged_record = txn->StageRecoveryWrite(record);
@@ -266,7 +380,8 @@ void RecoveryManager::ReplayDeleteRecord(transaction::TransactionContext *txn, L
   auto *delete_record = record->GetUnderlyingRecordBodyAs<DeleteRecord>();
   // Get tuple slot
   auto new_tuple_slot = GetTupleSlotMapping(delete_record->GetTupleSlot());
-  auto db_catalog_ptr = GetDatabaseCatalog(txn, delete_record->GetDatabaseOid());
+  auto db_catalog_ptr =
+      GetDatabaseCatalog(txn, delete_record->GetDatabaseOid(), IsCatalogTable(delete_record->GetTableOid()));
   auto sql_table_ptr = db_catalog_ptr->GetTable(common::ManagedPointer(txn), delete_record->GetTableOid());
   const auto &schema = GetTableSchema(txn, db_catalog_ptr, delete_record->GetTableOid());
 
@@ -291,7 +406,10 @@ void RecoveryManager::ReplayDeleteRecord(transaction::TransactionContext *txn, L
   UpdateIndexesOnTable(txn, delete_record->GetDatabaseOid(), delete_record->GetTableOid(), sql_table_ptr,
                        new_tuple_slot, pr, false /* delete */);
   // We can delete the TupleSlot from the map
-  tuple_slot_map_.erase(delete_record->GetTupleSlot());
+  {
+    common::SpinLatch::ScopedSpinLatch guard(&tuple_slot_map_latch_);
+    tuple_slot_map_.erase(delete_record->GetTupleSlot());
+  }
   delete[] buffer;
 }
 
@@ -299,7 +417,7 @@ void RecoveryManager::UpdateIndexesOnTable(transaction::TransactionContext *txn,
                                            catalog::table_oid_t table_oid,
                                            common::ManagedPointer<storage::SqlTable> table_ptr,
                                            const TupleSlot &tuple_slot, ProjectedRow *table_pr, const bool insert) {
-  auto db_catalog_ptr = GetDatabaseCatalog(txn, db_oid);
+  auto db_catalog_ptr = GetDatabaseCatalog(txn, db_oid, IsCatalogTable(table_oid));
 
   // Stores index objects and schemas
   std::vector<std::pair<common::ManagedPointer<index::Index>, const catalog::IndexSchema &>> index_objects;
@@ -418,6 +536,18 @@ void RecoveryManager::UpdateIndexesOnTable(transaction::TransactionContext *txn,
     const auto &schema = index_obj.second;
     const auto &indexed_attributes = schema.GetIndexedColOids();
 
+    // The same holds for the predicates of partial indexes, without which we can't tell the rows that belong in the
+    // index. The traffic cop refuses to create partial and expression indexes while logging is enabled, so we should
+    // never get here. Copying the raw columns would silently build wrong keys, hence the checks in release builds.
+    if (schema.Partial()) {
+      throw std::runtime_error("Recovery and replication of tables with partial indexes are not supported");
+    }
+    for (const auto &col : schema.GetColumns()) {
+      if (col.StoredExpression()->GetExpressionType() != parser::ExpressionType::COLUMN_VALUE) {
+        throw std::runtime_error("Recovery and replication of tables with expression indexes are not supported");
+      }
+    }
+
     // Build the index PR
     auto *index_pr = index->GetProjectedRowInitializer().InitializeRow(index_buffer);
 
@@ -736,7 +866,7 @@ uint32_t RecoveryManager::ProcessSpecialCasePGClassRecord(
             col_oids.clear();
             col_oids = {catalog::postgres::PgIndex::INDISUNIQUE.oid_, catalog::postgres::PgIndex::INDISPRIMARY.oid_,
                         catalog::postgres::PgIndex::INDISEXCLUSION.oid_, catalog::postgres::PgIndex::INDIMMEDIATE.oid_,
-                        catalog::postgres::PgIndex::IND_TYPE.oid_};
+                        catalog::postgres::PgIndex::IND_TYPE.oid_, catalog::postgres::PgIndex::INDPRED.oid_};
             auto pg_index_pr_init = db_catalog->pg_core_.indexes_->InitializerForProjectedRow(col_oids);
             auto pg_index_pr_map = db_catalog->pg_core_.indexes_->ProjectionMapForOids(col_oids);
             delete[] buffer;  // Delete old buffer, it won't be large enough for this PR
@@ -755,10 +885,18 @@ uint32_t RecoveryManager::ProcessSpecialCasePGClassRecord(
                 pr->AccessWithNullCheck(pg_index_pr_map[catalog::postgres::PgIndex::INDIMMEDIATE.oid_])));
             storage::index::IndexType index_type = *(reinterpret_cast<storage::index::IndexType *>(
                 pr->AccessWithNullCheck(pg_index_pr_map[catalog::postgres::PgIndex::IND_TYPE.oid_])));
+            auto *predicate_varlen = reinterpret_cast<VarlenEntry *>(
+                pr->AccessWithNullCheck(pg_index_pr_map[catalog::postgres::PgIndex::INDPRED.oid_]));
+            std::unique_ptr<parser::AbstractExpression> predicate;
+            if (predicate_varlen != nullptr) {
+              predicate =
+                  parser::DeserializeExpression(nlohmann::json::parse(predicate_varlen->StringView())).result_;
+            }
 
             // Step 4: Create and set IndexSchema in catalog
-            auto *index_schema =
-                new catalog::IndexSchema(index_cols, index_type, is_unique, is_primary, is_exclusion, is_immediate);
+            auto *index_schema = new catalog::IndexSchema(
+                index_cols, index_type, is_unique, is_primary, is_exclusion, is_immediate,
+                common::ManagedPointer(static_cast<const parser::AbstractExpression *>(predicate.get())));
             result = db_catalog->SetIndexSchemaPointer<RecoveryManager>(common::ManagedPointer(txn),
                                                                         catalog::index_oid_t(class_oid), index_schema);
             NOISEPAGE_ASSERT(result,
@@ -910,7 +1048,7 @@ common::ManagedPointer<storage::SqlTable> RecoveryManager::GetSqlTable(transacti
     return common::ManagedPointer(catalog_->databases_);
   }
 
-  auto db_catalog_ptr = GetDatabaseCatalog(txn, db_oid);
+  auto db_catalog_ptr = GetDatabaseCatalog(txn, db_oid, IsCatalogTable(table_oid));
 
   common::ManagedPointer<storage::SqlTable> table_ptr = nullptr;
 
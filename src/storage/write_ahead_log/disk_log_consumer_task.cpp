@@ -5,6 +5,9 @@
 #include "common/scoped_timer.h"
 #include "common/thread_context.h"
 #include "metrics/metrics_store.h"
+#include "replication/primary_replication_manager.h"
+#include "storage/write_ahead_log/log_segment.h"
+#include "storage/write_ahead_log/uring_log_writer.h"
 
 namespace noisepage::storage {
 
@@ -30,9 +33,20 @@ void DiskLogConsumerTask::WriteBuffersToLogFile() {
     filled_buffer_queue_->Dequeue(&logs);
     if (logs.first != nullptr) {
       // Need the nullptr check because read-only txns don't serialize any buffers, but generate callbacks to be invoked
-      current_data_written_ += logs.first->FlushBuffer();
+      if (log_segments_ != nullptr) {
+        current_data_written_ += log_segments_->Append(logs.first, logs.second);
+      } else if (uring_log_writer_ != nullptr) {
+        current_data_written_ += uring_log_writer_->Append(logs.first);
+      } else {
+        current_data_written_ += logs.first->FlushBuffer();
+      }
     }
     commit_callbacks_.insert(commit_callbacks_.end(), logs.second.begin(), logs.second.end());
+    // Cut the log once the current segment is full. This must happen before the buffer is handed back, since the buffer
+    // tells us whether a record continues in the next buffer.
+    if (logs.first != nullptr && log_segments_ != nullptr && log_segments_->ShouldRotate(*logs.first)) {
+      RotateLogSegment();
+    }
     // Enqueue the flushed buffer to the empty buffer queue if all serializers are done with it.
     if (logs.first != nullptr && logs.first->MarkSerialized()) {
       // nullptr check for the same reason as above
@@ -41,11 +55,35 @@ void DiskLogConsumerTask::WriteBuffersToLogFile() {
   }
 }
 
+void DiskLogConsumerTask::RotateLogSegment() {
+  // The old segment is persisted when it is closed. Its commit callbacks are still invoked by the next persist, once the
+  // records of the new segment are durable as well.
+  log_segments_->Rotate();
+  if (primary_replication_manager_ != DISABLED) {
+    log_segments_->RemoveCoveredSegments(primary_replication_manager_->GetReplicatedTxnWatermark());
+  }
+}
+
 uint64_t DiskLogConsumerTask::PersistLogFile() {
+  if (uring_log_writer_ != nullptr) {
+    // Only queue the sync, unless someone is waiting for it. The callbacks are invoked once the sync has finished.
+    if (current_data_written_ > 0) last_queued_sync_ = uring_log_writer_->Persist();
+    if (!commit_callbacks_.empty()) {
+      pending_commit_callbacks_.emplace(last_queued_sync_, std::move(commit_callbacks_));
+      commit_callbacks_.clear();
+    }
+    return InvokePersistedCallbacks(force_flush_ || !run_task_);
+  }
+
   if (current_data_written_ > 0) {
-    // Force the buffers to be written to disk. Because all buffers log to the same file, it suffices to call persist on
-    // any buffer.
-    buffers_->front().Persist();
+    if (log_segments_ != nullptr) {
+      // Earlier segments were persisted when they were rotated out, so only the current segment needs to be persisted.
+      log_segments_->Persist();
+    } else {
+      // Force the buffers to be written to disk. Because all buffers log to the same file, it suffices to call persist
+      // on any buffer.
+      buffers_->front().Persist();
+    }
   }
   const auto num_buffers = commit_callbacks_.size();
   // Execute the callbacks for the transactions that have been persisted
@@ -54,6 +92,18 @@ uint64_t DiskLogConsumerTask::PersistLogFile() {
   return num_buffers;
 }
 
+uint64_t DiskLogConsumerTask::InvokePersistedCallbacks(const bool wait) {
+  const auto persisted_sync = uring_log_writer_->PersistedUpTo(wait);
+  uint64_t num_callbacks = 0;
+  while (!pending_commit_callbacks_.empty() && pending_commit_callbacks_.front().first <= persisted_sync) {
+    auto &callbacks = pending_commit_callbacks_.front().second;
+    for (auto &callback : callbacks) callback.fn_(callback.arg_);
+    num_callbacks += callbacks.size();
+    pending_commit_callbacks_.pop();
+  }
+  return num_callbacks;
+}
+
 void DiskLogConsumerTask::DiskLogConsumerTaskLoop() {
   // input for this operating unit
   uint64_t num_bytes = 0, num_buffers = 0;
@@ -100,6 +150,12 @@ void DiskLogConsumerTask::DiskLogConsumerTaskLoop() {
     // Flush all the buffers to the log file
     WriteBuffersToLogFile();
 
+    // Invoke the callbacks of asynchronous persists that have finished in the meantime, and keep polling until all have
+    if (!pending_commit_callbacks_.empty()) {
+      num_buffers += InvokePersistedCallbacks(false);
+      next_sleep = persist_interval_;
+    }
+
     // We persist the log file if the following conditions are met
     // 1) The persist interval amount of time has passed since the last persist
     // 2) We have written more data since the last persist than the threshold
@@ -110,7 +166,7 @@ void DiskLogConsumerTask::DiskLogConsumerTaskLoop() {
 
     if (timeout || current_data_written_ > persist_threshold_ || force_flush_ || !run_task_) {
       std::unique_lock<std::mutex> lock(persist_lock_);
-      num_buffers = PersistLogFile();
+      num_buffers += PersistLogFile();
       num_bytes = current_data_written_;
       // Reset meta data
       last_persist = std::chrono::high_resolution_clock::now();
@@ -21,6 +21,26 @@ bool BufferedLogReader::Read(void *dest, uint32_t size) {
   return true;
 }
 
+bool BufferedLogReader::Peek(void *dest, uint32_t size) {
+  NOISEPAGE_ASSERT(size <= common::Constants::LOG_BUFFER_SIZE, "Peek is limited to the size of the read buffer");
+  if (read_head_ + size > filled_size_ && in_ != -1) {
+    // Move the unread bytes to the front of the buffer and top it up from the log file.
+    std::memmove(buffer_, buffer_ + read_head_, filled_size_ - read_head_);
+    filled_size_ -= read_head_;
+    read_head_ = 0;
+    const uint32_t to_read = common::Constants::LOG_BUFFER_SIZE - filled_size_;
+    const auto bytes_read = PosixIoWrappers::ReadFully(in_, buffer_ + filled_size_, to_read);
+    filled_size_ += bytes_read;
+    if (bytes_read < to_read) {
+      PosixIoWrappers::Close(in_);
+      in_ = -1;
+    }
+  }
+  if (read_head_ + size > filled_size_) return false;
+  std::memcpy(dest, buffer_ + read_head_, size);
+  return true;
+}
+
 void BufferedLogReader::RefillBuffer() {
   NOISEPAGE_ASSERT(read_head_ == filled_size_, "Refilling a buffer that is not fully read results in loss of data");
   if (in_ == -1) throw std::runtime_error("No more bytes left in the log file");
@@ -9,9 +9,16 @@ namespace noisepage::storage {
 
 void LogManager::Start() {
   NOISEPAGE_ASSERT(!run_log_manager_, "Can't call Start on already started LogManager");
-  // Initialize buffers for logging
+  // Initialize the log segments or the io_uring writer, if any, and the buffers for logging
+  if (segment_size_ > 0) {
+    log_segments_ = std::make_unique<LogSegmentManager>(log_file_path_, segment_size_);
+    log_segments_->Open();
+    if (io_backend_ != LogIoBackend::POSIX) STORAGE_LOG_WARN("Log segments are always written with POSIX I/O");
+  } else if (io_backend_ != LogIoBackend::POSIX) {
+    uring_log_writer_ = UringLogWriter::Open(log_file_path_, io_backend_ == LogIoBackend::IO_URING_DIRECT);
+  }
   for (size_t i = 0; i < num_buffers_; i++) {
-    buffers_.emplace_back(log_file_path_.c_str());
+    AddBuffer();
   }
   for (size_t i = 0; i < num_buffers_; i++) {
     empty_buffer_queue_->Enqueue(&buffers_[i]);
@@ -22,7 +29,7 @@ void LogManager::Start() {
   // Register DiskLogConsumerTask
   disk_log_writer_task_ = thread_registry_->RegisterDedicatedThread<DiskLogConsumerTask>(
       this /* requester */, persist_interval_, persist_threshold_, &buffers_, empty_buffer_queue_.Get(),
-      &filled_buffer_queue_);
+      &filled_buffer_queue_, log_segments_.get(), uring_log_writer_.get(), primary_replication_manager_);
 
   // Register LogSerializerTask
   log_serializer_task_ = thread_registry_->RegisterDedicatedThread<LogSerializerTask>(
@@ -57,10 +64,18 @@ void LogManager::PersistAndStop() {
   NOISEPAGE_ASSERT(result, "DiskLogConsumerTask should have been stopped");
   NOISEPAGE_ASSERT(filled_buffer_queue_.Empty(), "disk log consumer task should have processed all filled buffers\n");
 
-  // Close the buffers corresponding to the log file
+  // Close the buffers corresponding to the log file, and the current log segment or io_uring writer
   for (auto &buf : buffers_) {
     buf.Close();
   }
+  if (log_segments_ != nullptr) {
+    log_segments_->Close();
+    log_segments_.reset();
+  }
+  if (uring_log_writer_ != nullptr) {
+    uring_log_writer_->Close();
+    uring_log_writer_.reset();
+  }
   // Clear buffer queues
   empty_buffer_queue_->Clear();
   filled_buffer_queue_.Clear();
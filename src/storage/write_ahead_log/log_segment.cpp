@@ -0,0 +1,206 @@
+#include "storage/write_ahead_log/log_segment.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace noisepage::storage {
+
+namespace {
+// Segment ids are zero-padded so that the segment files sort in log order.
+constexpr uint32_t SEGMENT_ID_DIGITS = 10;
+}  // namespace
+
+LogSegmentManager::LogSegmentManager(std::string log_file_path, const uint64_t segment_size)
+    : log_file_path_(std::move(log_file_path)), segment_size_(segment_size) {
+  NOISEPAGE_ASSERT(segment_size_ > sizeof(LogSegmentHeader), "Log segments must have room for log records.");
+}
+
+LogSegmentManager::~LogSegmentManager() {
+  if (out_ != -1) Close();
+}
+
+std::string LogSegmentManager::SegmentPath(const std::string &log_file_path, const uint64_t segment_id) {
+  char suffix[SEGMENT_ID_DIGITS + 2];
+  snprintf(suffix, sizeof(suffix), ".%0*" PRIu64, SEGMENT_ID_DIGITS, segment_id);
+  return log_file_path + suffix;
+}
+
+std::vector<LogSegmentInfo> LogSegmentManager::ListSegments(const std::string &log_file_path) {
+  std::vector<LogSegmentInfo> segments;
+  const std::filesystem::path base(log_file_path);
+  const auto dir = base.has_parent_path() ? base.parent_path() : std::filesystem::path(".");
+  const std::string prefix = base.filename().string() + ".";
+  if (!std::filesystem::is_directory(dir)) return segments;
+
+  for (const auto &entry : std::filesystem::directory_iterator(dir)) {
+    if (!entry.is_regular_file()) continue;
+    const std::string name = entry.path().filename().string();
+    if (name.size() != prefix.size() + SEGMENT_ID_DIGITS || name.compare(0, prefix.size(), prefix) != 0) continue;
+    if (!std::all_of(name.begin() + prefix.size(), name.end(), [](char c) { return c >= '0' && c <= '9'; })) continue;
+
+    LogSegmentHeader header;
+    const int in = PosixIoWrappers::Open(entry.path().c_str(), O_RDONLY);
+    const auto bytes_read = PosixIoWrappers::ReadFully(in, &header, sizeof(LogSegmentHeader));
+    PosixIoWrappers::Close(in);
+    // A segment whose header was never completely written cannot contain any records, so it can be ignored.
+    if (bytes_read < sizeof(LogSegmentHeader)) continue;
+    if (header.magic_ != LogSegmentHeader::MAGIC) {
+      throw std::runtime_error("Log segment " + entry.path().string() + " has a corrupt header");
+    }
+    if (header.version_ != LogSegmentHeader::FORMAT_VERSION) {
+      throw std::runtime_error("Log segment " + entry.path().string() + " has unsupported format version " +
+                               std::to_string(header.version_));
+    }
+    segments.emplace_back(LogSegmentInfo{header.segment_id_, entry.path().string(), header.first_commit_time_,
+                                         header.newest_txn_begin_, static_cast<uint64_t>(entry.file_size())});
+  }
+
+  std::sort(segments.begin(), segments.end(),
+            [](const LogSegmentInfo &a, const LogSegmentInfo &b) { return a.segment_id_ < b.segment_id_; });
+  // A segment that was not closed cleanly does not know its newest transaction. Because the newest transaction is
+  // tracked as a running maximum over the whole log, the next segment's value is a safe upper bound.
+  for (auto it = segments.rbegin(); it != segments.rend(); ++it) {
+    if (it->newest_txn_begin_ == transaction::INVALID_TXN_TIMESTAMP && it != segments.rbegin()) {
+      it->newest_txn_begin_ = std::prev(it)->newest_txn_begin_;
+    }
+  }
+  return segments;
+}
+
+uint64_t LogSegmentManager::FirstSegmentToReplay(const std::vector<LogSegmentInfo> &segments,
+                                                 const transaction::timestamp_t replay_after) {
+  // Newest transaction timestamps are monotonic across segments, so the covered segments form a prefix of the log.
+  uint64_t first = 0;
+  while (first < segments.size() && segments[first].IsCoveredBy(replay_after)) first++;
+  return first;
+}
+
+void LogSegmentManager::Open() {
+  NOISEPAGE_ASSERT(out_ == -1, "Log segments are already open.");
+  {
+    common::SpinLatch::ScopedSpinLatch guard(&segments_latch_);
+    segments_ = ListSegments(log_file_path_);
+  }
+  OpenSegment(segments_.empty() ? 1 : segments_.back().segment_id_ + 1);
+}
+
+void LogSegmentManager::Close() {
+  NOISEPAGE_ASSERT(out_ != -1, "Log segments are not open.");
+  CloseSegment();
+}
+
+void LogSegmentManager::OpenSegment(const uint64_t segment_id) {
+  const std::string path = SegmentPath(log_file_path_, segment_id);
+  // O_APPEND is deliberately not used, since pwrite() ignores the offset for files opened in append mode on Linux and
+  // the header is patched in place.
+  out_ = PosixIoWrappers::Open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+  current_header_ = LogSegmentHeader{LogSegmentHeader::MAGIC,
+                                     LogSegmentHeader::FORMAT_VERSION,
+                                     static_cast<uint16_t>(sizeof(LogSegmentHeader)),
+                                     segment_id,
+                                     transaction::INVALID_TXN_TIMESTAMP,
+                                     transaction::INVALID_TXN_TIMESTAMP};
+  PosixIoWrappers::WriteFully(out_, &current_header_, sizeof(LogSegmentHeader));
+  current_size_ = sizeof(LogSegmentHeader);
+  // Make sure that the new segment file survives a crash.
+  SyncDirectory();
+
+  common::SpinLatch::ScopedSpinLatch guard(&segments_latch_);
+  // The newest transaction of the open segment is a running maximum, so it starts at the previous segment's value.
+  const auto newest_txn_begin =
+      segments_.empty() ? transaction::INITIAL_TXN_TIMESTAMP : segments_.back().newest_txn_begin_;
+  segments_.emplace_back(LogSegmentInfo{segment_id, path, transaction::INVALID_TXN_TIMESTAMP,
+                                        newest_txn_begin == transaction::INVALID_TXN_TIMESTAMP
+                                            ? transaction::INITIAL_TXN_TIMESTAMP
+                                            : newest_txn_begin,
+                                        current_size_});
+  segment_open_ = true;
+}
+
+void LogSegmentManager::CloseSegment() {
+  {
+    common::SpinLatch::ScopedSpinLatch guard(&segments_latch_);
+    current_header_.newest_txn_begin_ = segments_.back().newest_txn_begin_;
+    segment_open_ = false;
+  }
+  PosixIoWrappers::PWriteFully(out_, &current_header_, sizeof(LogSegmentHeader), 0);
+  Persist();
+  PosixIoWrappers::Close(out_);
+  out_ = -1;
+}
+
+uint64_t LogSegmentManager::Append(BufferedLogWriter *const buffer, const std::vector<CommitCallback> &commits) {
+  NOISEPAGE_ASSERT(out_ != -1, "Log segments are not open.");
+  const auto size = buffer->FlushBuffer(out_);
+  current_size_ += size;
+
+  if (current_header_.first_commit_time_ == transaction::INVALID_TXN_TIMESTAMP) {
+    for (const auto &commit : commits) {
+      // Read-only transactions do not serialize their commit records.
+      if (commit.is_from_read_only_) continue;
+      current_header_.first_commit_time_ = commit.txn_commit_time_;
+      PosixIoWrappers::PWriteFully(out_, &current_header_, sizeof(LogSegmentHeader), 0);
+      break;
+    }
+  }
+
+  common::SpinLatch::ScopedSpinLatch guard(&segments_latch_);
+  auto &info = segments_.back();
+  info.first_commit_time_ = current_header_.first_commit_time_;
+  info.newest_txn_begin_ = std::max(info.newest_txn_begin_, buffer->NewestTxnBegin());
+  info.size_ = current_size_;
+  return size;
+}
+
+void LogSegmentManager::Rotate() {
+  const auto next_segment_id = current_header_.segment_id_ + 1;
+  CloseSegment();
+  OpenSegment(next_segment_id);
+}
+
+void LogSegmentManager::Persist() {
+#if __APPLE__
+  if (fsync(out_) == -1) throw std::runtime_error("fsync failed with errno " + std::to_string(errno));
+#else
+  if (fdatasync(out_) == -1) throw std::runtime_error("fdatasync failed with errno " + std::to_string(errno));
+#endif
+}
+
+uint64_t LogSegmentManager::RemoveCoveredSegments(const transaction::timestamp_t covered_txn) {
+  std::vector<std::string> covered_paths;
+  {
+    common::SpinLatch::ScopedSpinLatch guard(&segments_latch_);
+    // The open segment is always kept. Covered segments form a prefix of the log, see FirstSegmentToReplay().
+    const auto num_closed = segment_open_ ? segments_.size() - 1 : segments_.size();
+    auto num_covered = FirstSegmentToReplay(segments_, covered_txn);
+    num_covered = std::min<uint64_t>(num_covered, num_closed);
+    for (uint64_t i = 0; i < num_covered; i++) covered_paths.emplace_back(segments_[i].path_);
+    segments_.erase(segments_.begin(), segments_.begin() + num_covered);
+  }
+  for (const auto &path : covered_paths) {
+    STORAGE_LOG_TRACE("Removing log segment {} covered by txn {}", path, covered_txn);
+    std::filesystem::remove(path);
+  }
+  return covered_paths.size();
+}
+
+std::vector<LogSegmentInfo> LogSegmentManager::GetSegments() const {
+  common::SpinLatch::ScopedSpinLatch guard(&segments_latch_);
+  return segments_;
+}
+
+void LogSegmentManager::SyncDirectory() const {
+  const std::filesystem::path base(log_file_path_);
+  const auto dir = base.has_parent_path() ? base.parent_path().string() : std::string(".");
+  const int dir_fd = PosixIoWrappers::Open(dir.c_str(), O_RDONLY);
+  const int ret = fsync(dir_fd);
+  PosixIoWrappers::Close(dir_fd);
+  if (ret == -1) throw std::runtime_error("fsync of log directory failed with errno " + std::to_string(errno));
+}
+
+}  // namespace noisepage::storage
@@ -178,7 +178,7 @@ BufferedLogWriter *LogSerializerTask::GetCurrentWriteBuffer() {
 /**
  * Hand over the current buffer and commit callbacks for commit records in that buffer to the log consumer task
  */
-void LogSerializerTask::HandFilledBufferToWriter() {
+void LogSerializerTask::HandFilledBufferToWriter(const bool ends_on_record_boundary) {
   NOISEPAGE_ASSERT(filled_buffer_policy_.has_value(),
                    "Make sure policies are being set whenever filled_buffer_ is being updated or "
                    "HandFilledBufferToWriter() is being called.");
@@ -188,6 +188,8 @@ void LogSerializerTask::HandFilledBufferToWriter() {
   if (filled_buffer_ != nullptr) {
     // Prepare the buffer for serialization. This initializes a reference count on the batch of logs within.
     filled_buffer_->PrepareForSerialization(txn_policy);
+    // Log consumers use this to decide where the log can be cut, e.g., when rotating log segments.
+    filled_buffer_->SetBatchMetadata(newest_buffer_txn_, ends_on_record_boundary);
   }
   // Replicate the buffer if the buffer exists.
   // However, even if the buffer doesn't exist, the commit callback needs to be invoked.
@@ -223,7 +225,7 @@ std::tuple<uint64_t, uint64_t, uint64_t> LogSerializerTask::SerializeBuffer(
         if (!commit_record->IsReadOnly()) num_bytes += SerializeRecord(record);
         commits_in_buffer_.emplace_back(CommitCallback{commit_record->CommitCallback(),
                                                        commit_record->CommitCallbackArg(), record.TxnBegin(),
-                                                       commit_record->IsReadOnly()});
+                                                       commit_record->CommitTime(), commit_record->IsReadOnly()});
         // Once serialization is done, we notify the txn manager to let GC know this txn is ready to clean up
         serialized_txns_[commit_record->TimestampManager()].push_back(record.TxnBegin());
         num_txns++;
@@ -350,8 +352,9 @@ uint32_t LogSerializerTask::WriteValue(const void *val, const uint32_t size) {
     const byte *val_byte = reinterpret_cast<const byte *>(val) + size_written;
     size_written += out->BufferWrite(val_byte, size - size_written);
     if (out->IsBufferFull()) {
-      // Mark the buffer full for the disk log consumer task thread to flush it
-      HandFilledBufferToWriter();
+      // Mark the buffer full for the disk log consumer task thread to flush it. The record being written may continue
+      // in the next buffer.
+      HandFilledBufferToWriter(false);
       // Get an empty buffer for writing this value
       out = GetCurrentWriteBuffer();
     }
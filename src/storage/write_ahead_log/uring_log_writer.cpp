@@ -0,0 +1,233 @@
+#include "storage/write_ahead_log/uring_log_writer.h"
+
+#ifdef NOISEPAGE_USE_IO_URING
+#include <liburing.h>
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace noisepage::storage {
+
+#ifdef NOISEPAGE_USE_IO_URING
+
+namespace {
+// Enough submission queue entries for a write of every staging chunk, plus the writes and syncs of queued persists.
+constexpr uint32_t QUEUE_DEPTH = 64;
+// Persist() waits for older syncs once this many are outstanding, so that the completion queue cannot overflow.
+constexpr uint64_t MAX_QUEUED_SYNCS = 16;
+// user_data of sync requests. Writes store their length in the upper and their chunk in the lower 32 bits.
+constexpr uint64_t SYNC_USER_DATA = UINT64_MAX;
+
+uint64_t AlignDown(const uint64_t value) {
+  return value / UringLogWriter::DIRECT_IO_ALIGNMENT * UringLogWriter::DIRECT_IO_ALIGNMENT;
+}
+
+uint64_t AlignUp(const uint64_t value) { return AlignDown(value + UringLogWriter::DIRECT_IO_ALIGNMENT - 1); }
+}  // namespace
+
+std::unique_ptr<UringLogWriter> UringLogWriter::Open(const std::string &log_file_path, bool direct_io) {
+  auto *ring = new io_uring;
+  const int ret = io_uring_queue_init(QUEUE_DEPTH, ring, 0);
+  if (ret < 0) {
+    // Most likely the kernel is too old or io_uring is disabled, e.g., by a seccomp profile.
+    STORAGE_LOG_WARN("io_uring is not available (errno {}), falling back to POSIX log writes", -ret);
+    delete ring;
+    return nullptr;
+  }
+
+  int out = -1;
+  if (direct_io) {
+    do {
+      out = open(log_file_path.c_str(), O_RDWR | O_CREAT | O_DIRECT, S_IRUSR | S_IWUSR);
+    } while (out == -1 && errno == EINTR);
+    if (out == -1) {
+      if (errno != EINVAL) throw std::runtime_error("Failed to open file with errno " + std::to_string(errno));
+      // tmpfs, for example, does not support O_DIRECT.
+      STORAGE_LOG_WARN("The file system of {} does not support O_DIRECT, falling back to buffered log writes",
+                       log_file_path);
+      direct_io = false;
+    }
+  }
+  // O_APPEND is not used, since the writes go to explicit offsets.
+  if (!direct_io) out = PosixIoWrappers::Open(log_file_path.c_str(), O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+
+  struct stat file_stat;
+  if (fstat(out, &file_stat) == -1) throw std::runtime_error("fstat failed with errno " + std::to_string(errno));
+  return std::unique_ptr<UringLogWriter>(
+      new UringLogWriter(ring, out, direct_io, static_cast<uint64_t>(file_stat.st_size)));
+}
+
+UringLogWriter::UringLogWriter(io_uring *const ring, const int out, const bool direct_io, const uint64_t file_size)
+    : ring_(ring), out_(out), direct_io_(direct_io), chunks_(NUM_STAGING_CHUNKS) {
+  std::vector<iovec> iovecs;
+  for (auto &chunk : chunks_) {
+    void *data;
+    if (posix_memalign(&data, DIRECT_IO_ALIGNMENT, STAGING_CHUNK_SIZE) != 0) throw std::bad_alloc();
+    chunk.data_ = static_cast<char *>(data);
+    iovecs.emplace_back(iovec{chunk.data_, STAGING_CHUNK_SIZE});
+  }
+  // Registered buffers are pinned once instead of on every write. Without them, writes still work, just slower.
+  registered_buffers_ = io_uring_register_buffers(ring_, iovecs.data(), iovecs.size()) == 0;
+
+  // New records are appended to the end of the file. With O_DIRECT, the first chunk has to start at a block boundary,
+  // so it starts with the last partial block of the file.
+  auto &first = chunks_[current_chunk_];
+  first.file_offset_ = direct_io_ ? AlignDown(file_size) : file_size;
+  first.filled_ = first.submitted_ = file_size - first.file_offset_;
+  if (first.filled_ > 0 && pread(out_, first.data_, DIRECT_IO_ALIGNMENT, first.file_offset_) < 0) {
+    throw std::runtime_error("pread failed with errno " + std::to_string(errno));
+  }
+}
+
+UringLogWriter::~UringLogWriter() {
+  if (out_ != -1) Close();
+  io_uring_queue_exit(ring_);
+  delete ring_;
+  for (auto &chunk : chunks_) free(chunk.data_);
+}
+
+uint64_t UringLogWriter::Append(BufferedLogWriter *const buffer) {
+  const uint64_t size = buffer->buffer_size_;
+  uint64_t copied = 0;
+  while (copied < size) {
+    auto &chunk = chunks_[current_chunk_];
+    const auto to_copy = std::min(size - copied, STAGING_CHUNK_SIZE - chunk.filled_);
+    std::memcpy(chunk.data_ + chunk.filled_, buffer->buffer_ + copied, to_copy);
+    chunk.filled_ += to_copy;
+    copied += to_copy;
+    if (chunk.filled_ == STAGING_CHUNK_SIZE) {
+      SubmitCurrentChunk();
+      AdvanceChunk();
+    }
+  }
+  buffer->buffer_size_ = 0;
+  // Free up the chunks whose writes have finished without blocking.
+  ProcessCompletions(0);
+  return size;
+}
+
+uint64_t UringLogWriter::Persist() {
+  NOISEPAGE_ASSERT(out_ != -1, "Log file is closed.");
+  while (syncs_queued_ - syncs_completed_ >= MAX_QUEUED_SYNCS) ProcessCompletions(1);
+  SubmitCurrentChunk();
+
+  io_uring_sqe *sqe = io_uring_get_sqe(ring_);
+  NOISEPAGE_ASSERT(sqe != nullptr, "The submission queue is sized for every outstanding request.");
+  io_uring_prep_fsync(sqe, out_, IORING_FSYNC_DATASYNC);
+  // Linking the sync to the last write would not order it after the writes of earlier chunks, which may still be in
+  // flight. Draining starts the sync once every earlier request has completed, and holds back later writes until the
+  // sync is done. The latter also keeps rewrites of a partially written O_DIRECT block in order.
+  io_uring_sqe_set_flags(sqe, IOSQE_IO_DRAIN);
+  sqe->user_data = SYNC_USER_DATA;
+  const int ret = io_uring_submit(ring_);
+  if (ret < 0) throw std::runtime_error("io_uring_submit failed with errno " + std::to_string(-ret));
+  return ++syncs_queued_;
+}
+
+uint64_t UringLogWriter::PersistedUpTo(const bool wait) {
+  ProcessCompletions(0);
+  while (wait && syncs_completed_ < syncs_queued_) ProcessCompletions(1);
+  return syncs_completed_;
+}
+
+void UringLogWriter::Close() {
+  NOISEPAGE_ASSERT(out_ != -1, "Log file is already closed.");
+  Persist();
+  PersistedUpTo(true);
+  for (const auto &chunk : chunks_) {
+    while (chunk.num_pending_ > 0) ProcessCompletions(1);
+  }
+  if (direct_io_) {
+    // Cut off the zero padding of the last block. fdatasync also persists the new file size.
+    const auto &chunk = chunks_[current_chunk_];
+    if (ftruncate(out_, static_cast<off_t>(chunk.file_offset_ + chunk.filled_)) == -1) {
+      throw std::runtime_error("ftruncate failed with errno " + std::to_string(errno));
+    }
+    if (fdatasync(out_) == -1) throw std::runtime_error("fdatasync failed with errno " + std::to_string(errno));
+  }
+  PosixIoWrappers::Close(out_);
+  out_ = -1;
+}
+
+void UringLogWriter::SubmitCurrentChunk() {
+  auto &chunk = chunks_[current_chunk_];
+  if (chunk.submitted_ == chunk.filled_) return;
+  uint64_t begin = chunk.submitted_, end = chunk.filled_;
+  if (direct_io_) {
+    // Rewrite the block that the previous write of this chunk ended in, and pad the last block with zeros.
+    begin = AlignDown(begin);
+    end = AlignUp(end);
+    std::memset(chunk.data_ + chunk.filled_, 0, end - chunk.filled_);
+  }
+
+  io_uring_sqe *sqe = io_uring_get_sqe(ring_);
+  NOISEPAGE_ASSERT(sqe != nullptr, "The submission queue is sized for every outstanding request.");
+  if (registered_buffers_) {
+    io_uring_prep_write_fixed(sqe, out_, chunk.data_ + begin, end - begin, chunk.file_offset_ + begin, current_chunk_);
+  } else {
+    io_uring_prep_write(sqe, out_, chunk.data_ + begin, end - begin, chunk.file_offset_ + begin);
+  }
+  sqe->user_data = ((end - begin) << 32U) | current_chunk_;
+  const int ret = io_uring_submit(ring_);
+  if (ret < 0) throw std::runtime_error("io_uring_submit failed with errno " + std::to_string(-ret));
+  chunk.submitted_ = chunk.filled_;
+  chunk.num_pending_++;
+}
+
+void UringLogWriter::AdvanceChunk() {
+  const auto next_offset = chunks_[current_chunk_].file_offset_ + STAGING_CHUNK_SIZE;
+  current_chunk_ = (current_chunk_ + 1) % NUM_STAGING_CHUNKS;
+  auto &chunk = chunks_[current_chunk_];
+  // The chunk can only be reused once the kernel is done reading it.
+  while (chunk.num_pending_ > 0) ProcessCompletions(1);
+  chunk.file_offset_ = next_offset;
+  chunk.filled_ = chunk.submitted_ = 0;
+}
+
+void UringLogWriter::ProcessCompletions(const uint32_t min_completions) {
+  uint32_t processed = 0;
+  while (true) {
+    io_uring_cqe *cqe;
+    const int ret = processed < min_completions ? io_uring_wait_cqe(ring_, &cqe) : io_uring_peek_cqe(ring_, &cqe);
+    if (ret == -EAGAIN) return;
+    if (ret == -EINTR) continue;
+    if (ret < 0) throw std::runtime_error("Waiting for io_uring completions failed with errno " + std::to_string(-ret));
+
+    const uint64_t user_data = cqe->user_data;
+    const int res = cqe->res;
+    io_uring_cqe_seen(ring_, cqe);
+    if (user_data == SYNC_USER_DATA) {
+      if (res < 0) throw std::runtime_error("fdatasync failed with errno " + std::to_string(-res));
+      syncs_completed_++;
+    } else {
+      // Log files are regular files, so a short write means that the disk is full.
+      if (res < 0) throw std::runtime_error("Log write failed with errno " + std::to_string(-res));
+      if (static_cast<uint64_t>(res) != user_data >> 32U) throw std::runtime_error("Log write was cut short");
+      chunks_[user_data & UINT32_MAX].num_pending_--;
+    }
+    processed++;
+  }
+}
+
+#else
+
+std::unique_ptr<UringLogWriter> UringLogWriter::Open(const std::string &log_file_path, bool direct_io) {
+  STORAGE_LOG_WARN("NoisePage was built without NOISEPAGE_USE_IO_URING, falling back to POSIX log writes");
+  return nullptr;
+}
+
+// Without io_uring support, Open() never creates an UringLogWriter.
+UringLogWriter::~UringLogWriter() = default;
+uint64_t UringLogWriter::Append(BufferedLogWriter *buffer) { throw std::logic_error("io_uring is not supported"); }
+uint64_t UringLogWriter::Persist() { throw std::logic_error("io_uring is not supported"); }
+uint64_t UringLogWriter::PersistedUpTo(bool wait) { throw std::logic_error("io_uring is not supported"); }
+void UringLogWriter::Close() { throw std::logic_error("io_uring is not supported"); }
+
+#endif
+
+}  // namespace noisepage::storage
@@ -27,6 +27,7 @@
 #include "network/postgres/statement.h"
 #include "optimizer/cost_model/trivial_cost_model.h"
 #include "optimizer/statistics/stats_storage.h"
+#include "parser/create_statement.h"
 #include "parser/drop_statement.h"
 #include "parser/explain_statement.h"
 #include "parser/expression/constant_value_expression.h"
@@ -44,7 +45,9 @@
 #include "planner/plannodes/drop_namespace_plan_node.h"
 #include "planner/plannodes/drop_table_plan_node.h"
 #include "settings/settings_manager.h"
+#include "replication/replication_manager.h"
 #include "settings/settings_param.h"
+#include "storage/recovery/recovery_manager.h"
 #include "storage/recovery/replication_log_provider.h"
 #include "traffic_cop/traffic_cop_defs.h"
 #include "traffic_cop/traffic_cop_util.h"
@@ -52,42 +55,47 @@
 
 namespace noisepage::trafficcop {
 
+/**
+ * @param policy the policy of the committing transaction
+ * @return the number of times that the commit callback of the transaction will be invoked
+ */
+static uint8_t NumCommitCallbacks(const transaction::TransactionPolicy &policy) {
+  // Cases: Durability, Replication
+  // - DISABLE, DISABLE => 1. The callback is invoked on LogCommit in TransactionManager.
+  // - ASYNC, SYNC => This is too weird. Not supporting this.
+  // - ASYNC, ASYNC => 1. The callback is invoked immediately in TransactionManager.
+  // - SYNC, ASYNC => 2. The callback is invoked by DiskLogConsumerTask and PrimaryReplicationManager.
+  // - SYNC, SYNC => 2. The callback is invoked by DiskLogConsumerTask and PrimaryReplicationManager.
+
+  NOISEPAGE_ASSERT(!(policy.durability_ == transaction::DurabilityPolicy::ASYNC &&
+                     policy.replication_ == transaction::ReplicationPolicy::SYNC),
+                   "Haven't reasoned about this case.");
+
+  const transaction::DurabilityPolicy &dur = policy.durability_;
+  const transaction::ReplicationPolicy &rep = policy.replication_;
+
+  // Commit callback is always invoked at least once.
+  uint8_t num_callbacks = 1;
+  if (rep != transaction::ReplicationPolicy::DISABLE) {
+    if (dur == transaction::DurabilityPolicy::ASYNC && rep == transaction::ReplicationPolicy::ASYNC) {
+      // Callback will get invoked by TransactionManager, fake EmptyCallback is passed down.
+    } else {
+      NOISEPAGE_ASSERT(dur != transaction::DurabilityPolicy::DISABLE, "Nothing to replicate?");
+      NOISEPAGE_ASSERT(dur == transaction::DurabilityPolicy::SYNC, "What other policies are there?");
+      num_callbacks += 1;
+    }
+  }
+  return num_callbacks;
+}
+
 /** The commit callback argument. */
 struct CommitCallbackArg {
   std::atomic<uint8_t> persist_countdown_;  ///< A countdown latch for what else needs to persist.
   std::promise<bool> ready_to_commit_;      ///< Set this promise to true to wake up the thread for commit.
 
-  explicit CommitCallbackArg(const transaction::TransactionPolicy &policy) {
-    // The value for the persist_countdown_ field.
-    // Note that the field will be decremented exactly once every time a commit callback is invoked.
-    persist_countdown_ = 0;
-
-    // Cases: Durability, Replication
-    // - DISABLE, DISABLE => 1. The callback is invoked on LogCommit in TransactionManager.
-    // - ASYNC, SYNC => This is too weird. Not supporting this.
-    // - ASYNC, ASYNC => 1. The callback is invoked immediately in TransactionManager.
-    // - SYNC, ASYNC => 2. The callback is invoked by DiskLogConsumerTask and PrimaryReplicationManager.
-    // - SYNC, SYNC => 2. The callback is invoked by DiskLogConsumerTask and PrimaryReplicationManager.
-
-    NOISEPAGE_ASSERT(!(policy.durability_ == transaction::DurabilityPolicy::ASYNC &&
-                       policy.replication_ == transaction::ReplicationPolicy::SYNC),
-                     "Haven't reasoned about this case.");
-
-    const transaction::DurabilityPolicy &dur = policy.durability_;
-    const transaction::ReplicationPolicy &rep = policy.replication_;
-
-    // Commit callback is always invoked at least once.
-    persist_countdown_ += 1;
-    if (rep != transaction::ReplicationPolicy::DISABLE) {
-      if (dur == transaction::DurabilityPolicy::ASYNC && rep == transaction::ReplicationPolicy::ASYNC) {
-        // Callback will get invoked by TransactionManager, fake EmptyCallback is passed down.
-      } else {
-        NOISEPAGE_ASSERT(dur != transaction::DurabilityPolicy::DISABLE, "Nothing to replicate?");
-        NOISEPAGE_ASSERT(dur == transaction::DurabilityPolicy::SYNC, "What other policies are there?");
-        persist_countdown_ += 1;
-      }
-    }
-  }
+  // Note that the countdown will be decremented exactly once every time a commit callback is invoked.
+  explicit CommitCallbackArg(const transaction::TransactionPolicy &policy)
+      : persist_countdown_(NumCommitCallbacks(policy)) {}
 };
 
 static void CommitCallback(void *const callback_arg) {
@@ -102,10 +110,42 @@ static void CommitCallback(void *const callback_arg) {
   }
 }
 
+/**
+ * The commit callback argument of a connection that is parked instead of blocked while its commit becomes durable.
+ * It is heap allocated, and freed by whoever decrements the countdown last.
+ */
+struct ParkedCommitCallbackArg {
+  /** A countdown latch for what else needs to persist, plus one for the thread that commits. */
+  std::atomic<uint8_t> persist_countdown_;
+  network::NetworkCallback wakeup_;  ///< Wakes up the parked connection, see ConnectionHandle::Callback.
+  void *wakeup_arg_;                 ///< The argument to wakeup_.
+
+  ParkedCommitCallbackArg(const transaction::TransactionPolicy &policy, const network::NetworkCallback wakeup,
+                          void *const wakeup_arg)
+      : persist_countdown_(NumCommitCallbacks(policy) + 1), wakeup_(wakeup), wakeup_arg_(wakeup_arg) {}
+};
+
+static void ParkedCommitCallback(void *const callback_arg) {
+  auto *const cb_arg = reinterpret_cast<ParkedCommitCallbackArg *const>(callback_arg);
+  const uint8_t count_before_sub = cb_arg->persist_countdown_.fetch_sub(1);
+  NOISEPAGE_ASSERT(
+      count_before_sub != 0,
+      "Every component should have invoked the callback already. The policy may not have been correctly initialized?");
+  if (count_before_sub == 1) {
+    // The committing thread already went on and parked the connection, so the connection has to be woken up.
+    cb_arg->wakeup_(cb_arg->wakeup_arg_);
+    delete cb_arg;
+  }
+}
+
 void TrafficCop::BeginTransaction(const common::ManagedPointer<network::ConnectionContext> connection_ctx) const {
   NOISEPAGE_ASSERT(connection_ctx->TransactionState() == network::NetworkTransactionStateType::IDLE,
                    "Invalid ConnectionContext state, already in a transaction.");
-  const auto txn = txn_manager_->BeginTransaction();
+  // On a replica, queries read a snapshot of the applied transactions instead of some of the transactions that are
+  // being applied in parallel.
+  const bool is_replica = replication_manager_ != DISABLED && replication_manager_->IsReplica();
+  const auto txn = is_replica && recovery_manager_ != DISABLED ? recovery_manager_->BeginSnapshotTransaction()
+                                                               : txn_manager_->BeginTransaction();
   connection_ctx->SetTransaction(common::ManagedPointer(txn));
   connection_ctx->SetAccessor(catalog_->GetAccessor(common::ManagedPointer(txn), connection_ctx->GetDatabaseOid(),
                                                     connection_ctx->GetCatalogCache()));
@@ -119,13 +159,27 @@ void TrafficCop::EndTransaction(const common::ManagedPointer<network::Connection
   if (query_type == network::QueryType::QUERY_COMMIT) {
     NOISEPAGE_ASSERT(connection_ctx->TransactionState() == network::NetworkTransactionStateType::BLOCK,
                      "Invalid ConnectionContext state, not in a transaction that can be committed.");
-    // Set up a blocking callback. Will be invoked when we can tell the client that commit is complete.
-    CommitCallbackArg cb_arg(txn->GetTransactionPolicy());
-    auto future = cb_arg.ready_to_commit_.get_future();
-    NOISEPAGE_ASSERT(future.valid(), "future must be valid for synchronization to work.");
-    txn_manager_->Commit(txn.Get(), CommitCallback, &cb_arg);
-    future.wait();
-    NOISEPAGE_ASSERT(future.get(), "Got past the wait() without the value being set to true. That's weird.");
+    if (park_connection_on_commit_ && connection_ctx->Callback() != nullptr) {
+      // Set up a callback that wakes up the connection once we can tell the client that commit is complete. The
+      // commit is already visible to other transactions, so the network thread can serve other connections meanwhile.
+      auto *const cb_arg = new ParkedCommitCallbackArg(txn->GetTransactionPolicy(), connection_ctx->Callback(),
+                                                       connection_ctx->CallbackArg());
+      txn_manager_->Commit(txn.Get(), ParkedCommitCallback, cb_arg);
+      if (cb_arg->persist_countdown_.fetch_sub(1) == 1) {
+        // Every callback has been invoked already, e.g., because durability is disabled or ASYNC.
+        delete cb_arg;
+      } else {
+        connection_ctx->SetCommitPending(true);
+      }
+    } else {
+      // Set up a blocking callback. Will be invoked when we can tell the client that commit is complete.
+      CommitCallbackArg cb_arg(txn->GetTransactionPolicy());
+      auto future = cb_arg.ready_to_commit_.get_future();
+      NOISEPAGE_ASSERT(future.valid(), "future must be valid for synchronization to work.");
+      txn_manager_->Commit(txn.Get(), CommitCallback, &cb_arg);
+      future.wait();
+      NOISEPAGE_ASSERT(future.get(), "Got past the wait() without the value being set to true. That's weird.");
+    }
   } else {
     NOISEPAGE_ASSERT(connection_ctx->TransactionState() != network::NetworkTransactionStateType::IDLE,
                      "Invalid ConnectionContext state, not in a transaction that can be aborted.");
@@ -438,6 +492,26 @@ TrafficCopResult TrafficCop::BindQuery(
       } else {
         visitor.BindNameToNode(statement->ParseResult(), nullptr, nullptr);
       }
+
+      // Recovery and replication apply the log without evaluating expressions, so they couldn't tell which rows
+      // belong in a partial index, nor compute the keys of an expression index.
+      if (txn_manager_->IsLoggingEnabled() && statement->RootStatement()->GetType() == parser::StatementType::CREATE) {
+        const auto create_stmt = statement->RootStatement().CastManagedPointerTo<parser::CreateStatement>();
+        if (create_stmt->GetCreateType() == parser::CreateStatement::CreateType::kIndex) {
+          if (create_stmt->GetIndexPredicate() != nullptr) {
+            throw BINDER_EXCEPTION("partial indexes are not supported when write-ahead logging is enabled",
+                                   common::ErrorCode::ERRCODE_FEATURE_NOT_SUPPORTED);
+          }
+          const auto &index_attrs = create_stmt->GetIndexAttributes();
+          if (std::any_of(index_attrs.cbegin(), index_attrs.cend(), [](const parser::IndexAttr &attr) {
+                return attr.HasExpr() &&
+                       attr.GetExpression()->GetExpressionType() != parser::ExpressionType::COLUMN_VALUE;
+              })) {
+            throw BINDER_EXCEPTION("expression indexes are not supported when write-ahead logging is enabled",
+                                   common::ErrorCode::ERRCODE_FEATURE_NOT_SUPPORTED);
+          }
+        }
+      }
     } else {
       // it's cached. use the desired_param_types to fast-path the binding
       binder::BinderUtil::PromoteParameters(parameters, statement->GetDesiredParamTypes());
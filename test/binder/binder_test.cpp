@@ -13,6 +13,7 @@
 #include "parser/expression/function_expression.h"
 #include "parser/expression/operator_expression.h"
 #include "parser/expression/subquery_expression.h"
+#include "parser/expression/window_expression.h"
 #include "parser/postgresparser.h"
 #include "parser/statements.h"
 #include "storage/sql_table.h"
@@ -570,6 +571,28 @@ TEST_F(BinderCorrectnessTest, SelectStatementSelectListAliasTest) {
   EXPECT_EQ(col_expr->GetColumnOid(), catalog::col_oid_t(2));  // b2; columns are indexed from 1
 }
 
+// NOLINTNEXTLINE
+TEST_F(BinderCorrectnessTest, SelectStatementSetOpTest) {
+  // Each input of a set operation is bound on its own
+  BINDER_LOG_DEBUG("Checking set operation binding");
+
+  std::string select_sql = "SELECT a1 FROM A UNION ALL SELECT b1 FROM B";
+  auto parse_tree = parser::PostgresParser::BuildParseTree(select_sql);
+  auto statement = parse_tree->GetStatements()[0];
+  binder_->BindNameToNode(common::ManagedPointer(parse_tree), nullptr, nullptr);
+  auto select_stmt = statement.CastManagedPointerTo<parser::SelectStatement>();
+  auto col_expr = select_stmt->GetSelectColumns()[0].CastManagedPointerTo<parser::ColumnValueExpression>();
+  EXPECT_EQ(col_expr->GetTableOid(), table_a_oid_);  // a1
+  col_expr = select_stmt->GetSetOpSelect()->GetSelectColumns()[0].CastManagedPointerTo<parser::ColumnValueExpression>();
+  EXPECT_EQ(col_expr->GetTableOid(), table_b_oid_);  // b1
+
+  // The inputs must have the same number of columns with the same types
+  parse_tree = parser::PostgresParser::BuildParseTree("SELECT a1, a2 FROM A INTERSECT SELECT b1 FROM B");
+  EXPECT_THROW(binder_->BindNameToNode(common::ManagedPointer(parse_tree), nullptr, nullptr), BinderException);
+  parse_tree = parser::PostgresParser::BuildParseTree("SELECT a1 FROM A EXCEPT SELECT b2 FROM B");
+  EXPECT_THROW(binder_->BindNameToNode(common::ManagedPointer(parse_tree), nullptr, nullptr), BinderException);
+}
+
 // NOLINTNEXTLINE
 TEST_F(BinderCorrectnessTest, UpdateStatementSimpleTest) {
   std::string update_sql = "UPDATE A SET A1 = 999 WHERE A1 >= 1";
@@ -666,6 +689,31 @@ TEST_F(BinderCorrectnessTest, AggregateComplexTest) {
   EXPECT_EQ(type::TypeId::INTEGER, col_expr->GetReturnValueType());
 }
 
+// NOLINTNEXTLINE
+TEST_F(BinderCorrectnessTest, WindowFunctionTest) {
+  BINDER_LOG_DEBUG("Checking window functions.");
+
+  std::string select_sql = "SELECT b1, AVG(b1) OVER (PARTITION BY b2) FROM B;";
+  auto parse_tree = parser::PostgresParser::BuildParseTree(select_sql);
+  auto statement = parse_tree->GetStatements()[0];
+  binder_->BindNameToNode(common::ManagedPointer(parse_tree), nullptr, nullptr);
+  auto select_stmt = statement.CastManagedPointerTo<parser::SelectStatement>();
+
+  auto window_expr = select_stmt->GetSelectColumns()[1].CastManagedPointerTo<parser::WindowExpression>();
+  EXPECT_EQ(planner::WindowFunctionType::AVG, window_expr->GetFunctionType());
+  EXPECT_EQ(type::TypeId::REAL, window_expr->GetReturnValueType());
+
+  auto part_key = window_expr->GetPartitionByKeys()[0].CastManagedPointerTo<parser::ColumnValueExpression>();
+  EXPECT_EQ(part_key->GetTableOid(), table_b_oid_);            // B.b2
+  EXPECT_EQ(part_key->GetColumnOid(), catalog::col_oid_t(2));  // B.b2; columns are indexed from 1
+  EXPECT_EQ(type::TypeId::INTEGER, window_expr->GetArgument()->GetReturnValueType());
+
+  // Window functions are computed after filtering, so they cannot be used in WHERE
+  select_sql = "SELECT b1 FROM B WHERE ROW_NUMBER() OVER (ORDER BY b1) < 3;";
+  parse_tree = parser::PostgresParser::BuildParseTree(select_sql);
+  EXPECT_THROW(binder_->BindNameToNode(common::ManagedPointer(parse_tree), nullptr, nullptr), BinderException);
+}
+
 // NOLINTNEXTLINE
 TEST_F(BinderCorrectnessTest, OperatorComplexTest) {
   // Check if nested select columns are correctly processed
@@ -13,6 +13,7 @@
 #include "execution/functions/function_context.h"
 #include "main/db_main.h"
 #include "parser/expression/column_value_expression.h"
+#include "parser/expression/comparison_expression.h"
 #include "parser/expression/constant_value_expression.h"
 #include "storage/index/index_builder.h"
 #include "storage/sql_table.h"
@@ -352,6 +353,49 @@ TEST_F(CatalogTests, UserIndexTest) {
   txn_manager_->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
 }
 
+/*
+ * Create a partial index and verify that the catalog keeps its predicate.
+ */
+// NOLINTNEXTLINE
+TEST_F(CatalogTests, PartialIndexTest) {
+  auto txn = txn_manager_->BeginTransaction();
+  auto accessor = catalog_->GetAccessor(common::ManagedPointer(txn), db_, DISABLED);
+
+  std::vector<catalog::Schema::Column> cols;
+  cols.emplace_back("id", type::TypeId::INTEGER, false, parser::ConstantValueExpression(type::TypeId::INTEGER));
+  cols.emplace_back("status", type::TypeId::INTEGER, false, parser::ConstantValueExpression(type::TypeId::INTEGER));
+  auto table_oid = accessor->CreateTable(accessor->GetDefaultNamespace(), "test_table", catalog::Schema(cols));
+  auto schema = accessor->GetSchema(table_oid);
+
+  // WHERE status = 1
+  std::vector<std::unique_ptr<parser::AbstractExpression>> children;
+  auto status_oid = schema.GetColumn("status").Oid();
+  children.emplace_back(std::make_unique<parser::ColumnValueExpression>(db_, table_oid, status_oid));
+  children.emplace_back(
+      std::make_unique<parser::ConstantValueExpression>(type::TypeId::INTEGER, execution::sql::Integer(1)));
+  parser::ComparisonExpression predicate(parser::ExpressionType::COMPARE_EQUAL, std::move(children));
+
+  std::vector<catalog::IndexSchema::Column> key_cols{catalog::IndexSchema::Column{
+      "id", type::TypeId::INTEGER, false, parser::ColumnValueExpression(db_, table_oid, schema.GetColumn("id").Oid())}};
+  auto index_schema = catalog::IndexSchema(key_cols, storage::index::IndexType::BPLUSTREE, false, false, false, false,
+                                           common::ManagedPointer<const parser::AbstractExpression>(&predicate));
+  EXPECT_TRUE(index_schema.Partial());
+
+  auto idx_oid = accessor->CreateIndex(accessor->GetDefaultNamespace(), table_oid, "test_partial_index", index_schema);
+  EXPECT_NE(idx_oid, catalog::INVALID_INDEX_OID);
+  const auto &true_schema = accessor->GetIndexSchema(idx_oid);
+  EXPECT_TRUE(true_schema.Partial());
+  EXPECT_EQ(*true_schema.Predicate(), predicate);
+
+  // The predicate survives a copy and a round trip through JSON.
+  auto copy = true_schema;
+  EXPECT_EQ(copy, true_schema);
+  auto deserialized = catalog::IndexSchema::DeserializeSchema(true_schema.ToJson());
+  EXPECT_TRUE(deserialized->Partial());
+  EXPECT_EQ(*deserialized->Predicate(), predicate);
+  txn_manager_->Abort(txn);
+}
+
 /*
  * Create a user table and index. Drop them both by dropping the table using cascading drop logic.
  */
@@ -1,7 +1,9 @@
 #include "execution/compiler/compiler.h"
 
+#include <array>
 #include <functional>
 #include <limits>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -11,6 +13,7 @@
 #include "execution/ast/ast_dump.h"
 #include "execution/ast/context.h"
 #include "execution/compiler/compilation_context.h"
+#include "execution/compiler/compiler_settings.h"
 #include "execution/compiler/executable_query.h"
 #include "execution/compiler/expression_maker.h"
 #include "execution/compiler/output_checker.h"
@@ -35,10 +38,13 @@
 #include "planner/plannodes/limit_plan_node.h"
 #include "planner/plannodes/nested_loop_join_plan_node.h"
 #include "planner/plannodes/order_by_plan_node.h"
+#include "planner/plannodes/plan_meta_data.h"
 #include "planner/plannodes/output_schema.h"
 #include "planner/plannodes/projection_plan_node.h"
 #include "planner/plannodes/seq_scan_plan_node.h"
+#include "planner/plannodes/set_op_plan_node.h"
 #include "planner/plannodes/update_plan_node.h"
+#include "planner/plannodes/window_plan_node.h"
 #include "type/type_id.h"
 
 namespace noisepage::execution::compiler::test {
@@ -67,6 +73,137 @@ class CompilerTest : public SqlBasedTest {
     return set_a == set_b;
   }
 
+  /**
+   * Run SELECT t1.colA, t2.col1 FROM (SELECT colA FROM test_1 WHERE colA < build_limit) t1 <join_type> JOIN
+   * (SELECT col1 FROM test_2 WHERE col1 >= probe_floor) t2 ON t1.colA = t2.col1, and check the number of matched
+   * rows and of the rows padded with NULLs on either side. If a build cardinality estimate is given, it's passed to
+   * the compiler as the optimizer's estimate of the rows in t1, and inner joins must then be partitioned.
+   */
+  void CheckHashJoin(planner::LogicalJoinType join_type, int32_t build_limit, int32_t probe_floor,
+                     uint32_t num_expected_matched, uint32_t num_expected_unmatched_build,
+                     uint32_t num_expected_unmatched_probe, uint64_t build_cardinality_estimate = 0) {
+    auto accessor = MakeAccessor();
+    ExpressionMaker expr_maker;
+    auto table_oid1 = accessor->GetTableOid(NSOid(), "test_1");
+    auto table_oid2 = accessor->GetTableOid(NSOid(), "test_2");
+    auto table_schema1 = accessor->GetSchema(table_oid1);
+    auto table_schema2 = accessor->GetSchema(table_oid2);
+
+    // Build side: SELECT colA FROM test_1 WHERE colA < build_limit
+    std::unique_ptr<planner::AbstractPlanNode> seq_scan1;
+    OutputSchemaHelper seq_scan_out1{0, &expr_maker};
+    {
+      auto cola_oid = table_schema1.GetColumn("colA").Oid();
+      auto col1 = expr_maker.CVE(cola_oid, type::TypeId::INTEGER);
+      seq_scan_out1.AddOutput("col1", col1);
+      auto schema = seq_scan_out1.MakeSchema();
+      auto predicate = expr_maker.ComparisonLt(col1, expr_maker.Constant(build_limit));
+      planner::SeqScanPlanNode::Builder builder;
+      seq_scan1 = builder.SetOutputSchema(std::move(schema))
+                      .SetColumnOids({cola_oid})
+                      .SetScanPredicate(predicate)
+                      .SetIsForUpdateFlag(false)
+                      .SetTableOid(table_oid1)
+                      .SetPlanNodeId(BUILD_PLAN_NODE_ID)
+                      .Build();
+    }
+    // Probe side: SELECT col1 FROM test_2 WHERE col1 >= probe_floor
+    std::unique_ptr<planner::AbstractPlanNode> seq_scan2;
+    OutputSchemaHelper seq_scan_out2{1, &expr_maker};
+    {
+      auto col1_oid = table_schema2.GetColumn("col1").Oid();
+      auto col1 = expr_maker.CVE(col1_oid, type::TypeId::SMALLINT);
+      seq_scan_out2.AddOutput("col1", col1);
+      auto schema = seq_scan_out2.MakeSchema();
+      auto predicate = expr_maker.ComparisonGe(col1, expr_maker.Constant(probe_floor));
+      planner::SeqScanPlanNode::Builder builder;
+      seq_scan2 = builder.SetOutputSchema(std::move(schema))
+                      .SetColumnOids({col1_oid})
+                      .SetScanPredicate(predicate)
+                      .SetIsForUpdateFlag(false)
+                      .SetTableOid(table_oid2)
+                      .SetPlanNodeId(planner::plan_node_id_t(2))
+                      .Build();
+    }
+    std::unique_ptr<planner::AbstractPlanNode> hash_join;
+    OutputSchemaHelper hash_join_out{0, &expr_maker};
+    {
+      auto t1_col1 = seq_scan_out1.GetOutput("col1");
+      auto t2_col1 = seq_scan_out2.GetOutput("col1");
+      hash_join_out.AddOutput("t1.col1", t1_col1);
+      hash_join_out.AddOutput("t2.col1", t2_col1);
+      auto schema = hash_join_out.MakeSchema();
+      planner::HashJoinPlanNode::Builder builder;
+      hash_join = builder.AddChild(std::move(seq_scan1))
+                      .AddChild(std::move(seq_scan2))
+                      .SetOutputSchema(std::move(schema))
+                      .AddLeftHashKey(t1_col1)
+                      .AddRightHashKey(t2_col1)
+                      .SetJoinType(join_type)
+                      .SetJoinPredicate(expr_maker.ComparisonEq(t1_col1, t2_col1))
+                      .SetPlanNodeId(planner::plan_node_id_t(3))
+                      .Build();
+    }
+
+    // test_1.colA and test_2.col1 are both serial from 0, so every key appears at most once on each side.
+    uint32_t num_matched{0}, num_unmatched_build{0}, num_unmatched_probe{0};
+    RowChecker row_checker = [&](const std::vector<sql::Val *> &vals) {
+      auto t1_col1 = static_cast<sql::Integer *>(vals[0]);
+      auto t2_col1 = static_cast<sql::Integer *>(vals[1]);
+      ASSERT_FALSE(t1_col1->is_null_ && t2_col1->is_null_);
+      if (t2_col1->is_null_) {
+        // A build row without a partner, padded with NULLs for the probe side.
+        ASSERT_LT(t1_col1->val_, build_limit);
+        ASSERT_TRUE(t1_col1->val_ < probe_floor || t1_col1->val_ >= sql::TEST2_SIZE);
+        num_unmatched_build++;
+      } else if (t1_col1->is_null_) {
+        // A probe row without a partner, padded with NULLs for the build side.
+        ASSERT_GE(t2_col1->val_, probe_floor);
+        ASSERT_GE(t2_col1->val_, build_limit);
+        num_unmatched_probe++;
+      } else {
+        ASSERT_EQ(t1_col1->val_, t2_col1->val_);
+        num_matched++;
+      }
+    };
+    CorrectnessFn correctness_fn = [&]() {
+      ASSERT_EQ(num_matched, num_expected_matched);
+      ASSERT_EQ(num_unmatched_build, num_expected_unmatched_build);
+      ASSERT_EQ(num_unmatched_probe, num_expected_unmatched_probe);
+    };
+    GenericChecker checker(row_checker, correctness_fn);
+
+    OutputStore store{&checker, hash_join->GetOutputSchema().Get()};
+    exec::OutputPrinter printer(hash_join->GetOutputSchema().Get());
+    MultiOutputCallback callback{std::vector<exec::OutputCallback>{store, printer}};
+    exec::OutputCallback callback_fn = callback.ConstructOutputCallback();
+    auto exec_ctx = MakeExecCtx(&callback_fn, hash_join->GetOutputSchema().Get());
+
+    planner::PlanMetaData plan_meta_data;
+    if (build_cardinality_estimate != 0) {
+      plan_meta_data.AddPlanNodeMetaData(
+          BUILD_PLAN_NODE_ID,
+          planner::PlanMetaData::PlanNodeMetaData(build_cardinality_estimate, build_cardinality_estimate, {}));
+    }
+    // Capture the generated TPL to check which join was generated.
+    auto exec_settings = exec_ctx->GetExecutionSettings();
+    CompilerSettings compiler_settings;
+    compiler_settings.SetShouldCaptureTPL(true);
+    exec_settings.SetCompilerSettings(compiler_settings);
+
+    auto executable = execution::compiler::CompilationContext::Compile(
+        *hash_join, exec_settings, exec_ctx->GetAccessor(), CompilationMode::Interleaved, std::nullopt,
+        common::ManagedPointer(&plan_meta_data));
+    executable->Run(common::ManagedPointer(exec_ctx), MODE);
+    checker.CheckCorrectness();
+
+    const auto &tpl = executable->GetFragments()[0]->GetModuleMetadata().GetCompileTimeMetadata().GetTPL();
+    const bool partitioned = tpl.find("@joinHTBuildAndJoin") != std::string::npos;
+    EXPECT_EQ(join_type == planner::LogicalJoinType::INNER && build_cardinality_estimate != 0, partitioned);
+  }
+
+  static constexpr planner::plan_node_id_t BUILD_PLAN_NODE_ID = planner::plan_node_id_t(1);
+
   static constexpr vm::ExecutionMode MODE = vm::ExecutionMode::Interpret;
 };
 
@@ -1393,6 +1530,90 @@ TEST_F(CompilerTest, StaticAggregateHavingTest) {
   multi_checker.CheckCorrectness();
 }
 
+// NOLINTNEXTLINE
+TEST_F(CompilerTest, ParallelAggregateBypassTest) {
+  // SELECT colA % 100000, COUNT(colA), SUM(colA) FROM index_test_table GROUP BY colA % 100000;
+  // Every group has four rows, 100000 rows apart. On one thread, each window of the serial scan that fills the
+  // thread-local pre-aggregation table holds unique keys, so every flush measures no reduction and the tuples that
+  // follow are inserted straight into the overflow partitions. The merge must still produce one row per group.
+  constexpr int32_t num_groups = 100000;
+  SetNumberOfParallelExecutionThreads(1);
+  auto accessor = MakeAccessor();
+  ExpressionMaker expr_maker;
+  auto table_oid = accessor->GetTableOid(NSOid(), "index_test_table");
+  auto table_schema = accessor->GetSchema(table_oid);
+  std::unique_ptr<planner::AbstractPlanNode> seq_scan;
+  OutputSchemaHelper seq_scan_out{0, &expr_maker};
+  {
+    auto cola_oid = table_schema.GetColumn("colA").Oid();
+    auto col1 = expr_maker.CVE(cola_oid, type::TypeId::INTEGER);
+    seq_scan_out.AddOutput("col1", col1);
+    auto schema = seq_scan_out.MakeSchema();
+    planner::SeqScanPlanNode::Builder builder;
+    seq_scan = builder.SetOutputSchema(std::move(schema))
+                   .SetColumnOids({cola_oid})
+                   .SetScanPredicate(nullptr)
+                   .SetIsForUpdateFlag(false)
+                   .SetTableOid(table_oid)
+                   .Build();
+  }
+  std::unique_ptr<planner::AbstractPlanNode> agg;
+  OutputSchemaHelper agg_out{0, &expr_maker};
+  {
+    auto col1 = seq_scan_out.GetOutput("col1");
+    agg_out.AddGroupByTerm("key", expr_maker.OpMod(col1, expr_maker.Constant(num_groups)));
+    agg_out.AddAggTerm("count_col1", expr_maker.AggCount(col1));
+    agg_out.AddAggTerm("sum_col1", expr_maker.AggSum(col1));
+    agg_out.AddOutput("key", agg_out.GetGroupByTermForOutput("key"));
+    agg_out.AddOutput("count_col1", agg_out.GetAggTermForOutput("count_col1"));
+    agg_out.AddOutput("sum_col1", agg_out.GetAggTermForOutput("sum_col1"));
+    auto schema = agg_out.MakeSchema();
+    planner::AggregatePlanNode::Builder builder;
+    agg = builder.SetOutputSchema(std::move(schema))
+              .AddGroupByTerm(agg_out.GetGroupByTerm("key"))
+              .AddAggregateTerm(agg_out.GetAggTerm("count_col1"))
+              .AddAggregateTerm(agg_out.GetAggTerm("sum_col1"))
+              .AddChild(std::move(seq_scan))
+              .SetAggregateStrategyType(planner::AggregateStrategyType::HASH)
+              .SetHavingClausePredicate(nullptr)
+              .Build();
+  }
+
+  // Each key k is made of k, k + 100000, k + 200000 and k + 300000.
+  constexpr int64_t rows_per_group = sql::INDEX_TEST_SIZE / num_groups;
+  std::vector<uint32_t> seen(num_groups, 0);
+  RowChecker row_checker = [&](const std::vector<sql::Val *> &vals) {
+    auto key = static_cast<sql::Integer *>(vals[0]);
+    auto count = static_cast<sql::Integer *>(vals[1]);
+    auto sum = static_cast<sql::Integer *>(vals[2]);
+    ASSERT_FALSE(key->is_null_ || count->is_null_ || sum->is_null_);
+    ASSERT_GE(key->val_, 0);
+    ASSERT_LT(key->val_, num_groups);
+    seen[key->val_]++;
+    EXPECT_EQ(count->val_, rows_per_group);
+    EXPECT_EQ(sum->val_, rows_per_group * key->val_ + num_groups * rows_per_group * (rows_per_group - 1) / 2);
+  };
+  CorrectnessFn correctness_fn = [&]() {
+    for (int64_t key = 0; key < num_groups; key++) {
+      ASSERT_EQ(seen[key], 1) << "key " << key;
+    }
+  };
+  GenericChecker checker(row_checker, correctness_fn);
+
+  // Compile and Run
+  OutputStore store{&checker, agg->GetOutputSchema().Get()};
+  MultiOutputCallback callback{std::vector<exec::OutputCallback>{store}};
+  exec::OutputCallback callback_fn = callback.ConstructOutputCallback();
+  auto exec_ctx = MakeExecCtx(&callback_fn, agg->GetOutputSchema().Get());
+  ASSERT_TRUE(exec_ctx->GetExecutionSettings().GetIsParallelQueryExecutionEnabled());
+
+  // Run & Check
+  auto executable =
+      execution::compiler::CompilationContext::Compile(*agg, exec_ctx->GetExecutionSettings(), exec_ctx->GetAccessor());
+  executable->Run(common::ManagedPointer(exec_ctx), MODE);
+  checker.CheckCorrectness();
+}
+
 // NOLINTNEXTLINE
 TEST_F(CompilerTest, SimpleHashJoinTest) {
   // SELECT t1.col1, t2.col1, t2.col2, t1.col1 + t2.col2 FROM t1 INNER JOIN t2 ON t1.col1=t2.col1
@@ -1538,6 +1759,46 @@ TEST_F(CompilerTest, SimpleHashJoinTest) {
   EXPECT_TRUE(CheckFeatureVectorEquality(feature_vec1, exp_vec1));
 }
 
+// NOLINTNEXTLINE
+TEST_F(CompilerTest, LeftHashJoinTest) {
+  // SELECT t1.colA, t2.col1 FROM test_1 t1 LEFT JOIN (SELECT col1 FROM test_2 WHERE col1 >= 920) t2
+  // ON t1.colA = t2.col1
+  // Both pipelines are parallel, so the build rows without a partner are emitted by the parallel scan of the join
+  // hash table. Only keys 920 to 999 match, the other 9920 rows of test_1 are padded with NULLs.
+  ASSERT_TRUE(MakeExecCtx()->GetExecutionSettings().GetIsParallelQueryExecutionEnabled());
+  CheckHashJoin(planner::LogicalJoinType::LEFT, sql::TEST1_SIZE, 920, 80, sql::TEST1_SIZE - 80, 0);
+}
+
+// NOLINTNEXTLINE
+TEST_F(CompilerTest, RightHashJoinTest) {
+  // SELECT t1.colA, t2.col1 FROM (SELECT colA FROM test_1 WHERE colA < 80) t1 RIGHT JOIN test_2 t2
+  // ON t1.colA = t2.col1
+  // Keys 0 to 79 match, the other 920 rows of test_2 are padded with NULLs. Unmatched build rows are dropped.
+  CheckHashJoin(planner::LogicalJoinType::RIGHT, 80, 0, 80, 0, sql::TEST2_SIZE - 80);
+}
+
+// NOLINTNEXTLINE
+TEST_F(CompilerTest, FullOuterHashJoinTest) {
+  // SELECT t1.colA, t2.col1 FROM (SELECT colA FROM test_1 WHERE colA < 100) t1
+  // FULL OUTER JOIN (SELECT col1 FROM test_2 WHERE col1 >= 50) t2 ON t1.colA = t2.col1
+  // Keys 50 to 99 match. Build keys 0 to 49 and probe keys 100 to 999 are padded with NULLs.
+  CheckHashJoin(planner::LogicalJoinType::OUTER, 100, 50, 50, 50, sql::TEST2_SIZE - 100);
+}
+
+// NOLINTNEXTLINE
+TEST_F(CompilerTest, PartitionedHashJoinTest) {
+  // SELECT t1.colA, t2.col1 FROM test_1 t1 INNER JOIN test_2 t2 ON t1.colA = t2.col1
+  // The optimizer's estimate of the build side is far larger than the cache, so the probe side is materialized and
+  // both sides are joined partition by partition. The actual build side is small, so the runtime builds one table.
+  CheckHashJoin(planner::LogicalJoinType::INNER, sql::TEST1_SIZE, 0, sql::TEST2_SIZE, 0, 0, uint64_t{1} << 32);
+}
+
+// NOLINTNEXTLINE
+TEST_F(CompilerTest, PartitionedOuterHashJoinTest) {
+  // The same estimate leaves outer joins probing one row at a time, since they track the rows that never matched.
+  CheckHashJoin(planner::LogicalJoinType::LEFT, sql::TEST1_SIZE, 920, 80, sql::TEST1_SIZE - 80, 0, uint64_t{1} << 32);
+}
+
 // NOLINTNEXTLINE
 TEST_F(CompilerTest, MultiWayHashJoinTest) {
   // SELECT t1.col1, t2.col1, t3.col1, t1.col1 + t2.col1 + t3.col1
@@ -1730,6 +1991,207 @@ TEST_F(CompilerTest, MultiWayHashJoinTest) {
   EXPECT_TRUE(CheckFeatureVectorEquality(feature_vec2, exp_vec2));
 }
 
+// NOLINTNEXTLINE
+TEST_F(CompilerTest, SimpleSetOpTest) {
+  // SELECT colA / 10 FROM test_1 WHERE colA < 100 <SET_OP> SELECT colA / 6 FROM test_1 WHERE colA < 30
+  // The left input produces the values 0..9 ten times each, the right input the values 0..4 six times each.
+  const std::vector<std::pair<planner::SetOpType, int64_t>> set_ops = {
+      {planner::SetOpType::UNION, 10},     {planner::SetOpType::UNION_ALL, 130},
+      {planner::SetOpType::INTERSECT, 5},  {planner::SetOpType::INTERSECT_ALL, 30},
+      {planner::SetOpType::EXCEPT, 5},     {planner::SetOpType::EXCEPT_ALL, 70},
+  };
+
+  auto accessor = MakeAccessor();
+  auto table_oid = accessor->GetTableOid(NSOid(), "test_1");
+  auto table_schema = accessor->GetSchema(table_oid);
+  auto cola_oid = table_schema.GetColumn("colA").Oid();
+
+  for (const auto &[set_op, num_expected_rows] : set_ops) {
+    ExpressionMaker expr_maker;
+    // Make a seq scan producing colA / divisor for every colA < limit.
+    auto make_seq_scan = [&](int32_t limit, int32_t divisor, OutputSchemaHelper *seq_scan_out) {
+      auto col1 = expr_maker.CVE(cola_oid, type::TypeId::INTEGER);
+      seq_scan_out->AddOutput("col1", expr_maker.OpDiv(col1, expr_maker.Constant(divisor)));
+      auto schema = seq_scan_out->MakeSchema();
+      auto predicate = expr_maker.ComparisonLt(col1, expr_maker.Constant(limit));
+      planner::SeqScanPlanNode::Builder builder;
+      return builder.SetOutputSchema(std::move(schema))
+          .SetColumnOids({cola_oid})
+          .SetScanPredicate(predicate)
+          .SetIsForUpdateFlag(false)
+          .SetTableOid(table_oid)
+          .Build();
+    };
+    OutputSchemaHelper seq_scan_out1{0, &expr_maker};
+    OutputSchemaHelper seq_scan_out2{1, &expr_maker};
+    auto seq_scan1 = make_seq_scan(100, 10, &seq_scan_out1);
+    auto seq_scan2 = make_seq_scan(30, 6, &seq_scan_out2);
+
+    // Make the set operation. Its output refers to the columns of the left input.
+    std::unique_ptr<planner::AbstractPlanNode> set_op_node;
+    OutputSchemaHelper set_op_out{0, &expr_maker};
+    {
+      set_op_out.AddOutput("col1", seq_scan_out1.GetOutput("col1"));
+      auto schema = set_op_out.MakeSchema();
+      planner::SetOpPlanNode::Builder builder;
+      set_op_node = builder.AddChild(std::move(seq_scan1))
+                        .AddChild(std::move(seq_scan2))
+                        .SetOutputSchema(std::move(schema))
+                        .SetSetOp(set_op)
+                        .Build();
+    }
+
+    // Compile and Run
+    NumChecker num_checker{num_expected_rows};
+    OutputStore store{&num_checker, set_op_node->GetOutputSchema().Get()};
+    MultiOutputCallback callback{std::vector<exec::OutputCallback>{store}};
+    exec::OutputCallback callback_fn = callback.ConstructOutputCallback();
+    auto exec_ctx = MakeExecCtx(&callback_fn, set_op_node->GetOutputSchema().Get());
+    auto executable = execution::compiler::CompilationContext::Compile(*set_op_node, exec_ctx->GetExecutionSettings(),
+                                                                       exec_ctx->GetAccessor());
+    executable->Run(common::ManagedPointer(exec_ctx), MODE);
+    num_checker.CheckCorrectness();
+  }
+}
+
+// NOLINTNEXTLINE
+TEST_F(CompilerTest, SimpleWindowTest) {
+  // SELECT col1, col2, ROW_NUMBER() OVER w, RANK() OVER w,
+  //        SUM(col1) OVER (w ROWS BETWEEN 1 PRECEDING AND 1 FOLLOWING), COUNT(*) OVER (PARTITION BY col2)
+  // FROM test_1 WHERE col1 < 500
+  // WINDOW w AS (PARTITION BY col2 ORDER BY col1 / 10)
+  // Get accessor
+  auto accessor = MakeAccessor();
+  ExpressionMaker expr_maker;
+  auto table_oid = accessor->GetTableOid(NSOid(), "test_1");
+  auto table_schema = accessor->GetSchema(table_oid);
+  std::unique_ptr<planner::AbstractPlanNode> seq_scan;
+  OutputSchemaHelper seq_scan_out{0, &expr_maker};
+  {
+    // OIDs
+    auto cola_oid = table_schema.GetColumn("colA").Oid();
+    auto colb_oid = table_schema.GetColumn("colB").Oid();
+    // Get Table columns
+    auto col1 = expr_maker.CVE(cola_oid, type::TypeId::INTEGER);
+    auto col2 = expr_maker.CVE(colb_oid, type::TypeId::INTEGER);
+    seq_scan_out.AddOutput("col1", col1);
+    seq_scan_out.AddOutput("col2", col2);
+    auto schema = seq_scan_out.MakeSchema();
+    // Make predicate
+    auto predicate = expr_maker.ComparisonLt(col1, expr_maker.Constant(500));
+    // Build
+    planner::SeqScanPlanNode::Builder builder;
+    seq_scan = builder.SetOutputSchema(std::move(schema))
+                   .SetColumnOids({cola_oid, colb_oid})
+                   .SetScanPredicate(predicate)
+                   .SetIsForUpdateFlag(false)
+                   .SetTableOid(table_oid)
+                   .Build();
+  }
+  // Window
+  std::unique_ptr<planner::AbstractPlanNode> window;
+  OutputSchemaHelper window_out{0, &expr_maker};
+  {
+    auto col1 = seq_scan_out.GetOutput("col1");
+    auto col2 = seq_scan_out.GetOutput("col2");
+    // Output columns: the child's columns, then the window functions.
+    window_out.AddOutput("col1", col1);
+    window_out.AddOutput("col2", col2);
+    window_out.AddOutput("row_number", expr_maker.DVE(type::TypeId::BIGINT, 1, 0));
+    window_out.AddOutput("rank", expr_maker.DVE(type::TypeId::BIGINT, 1, 1));
+    window_out.AddOutput("sum", expr_maker.DVE(type::TypeId::BIGINT, 1, 2));
+    window_out.AddOutput("count", expr_maker.DVE(type::TypeId::BIGINT, 1, 3));
+    auto schema = window_out.MakeSchema();
+    // Window functions
+    planner::WindowFunction row_number;
+    row_number.type_ = planner::WindowFunctionType::ROW_NUMBER;
+    planner::WindowFunction rank;
+    rank.type_ = planner::WindowFunctionType::RANK;
+    planner::WindowFunction sum;
+    sum.type_ = planner::WindowFunctionType::SUM;
+    sum.argument_ = col1;
+    sum.start_unbounded_ = false;
+    sum.start_preceding_ = 1;
+    sum.end_unbounded_ = false;
+    sum.end_following_ = 1;
+    planner::WindowFunction count;
+    count.type_ = planner::WindowFunctionType::COUNT_STAR;
+    // Build
+    planner::WindowPlanNode::Builder builder;
+    window = builder.SetOutputSchema(std::move(schema))
+                 .AddChild(std::move(seq_scan))
+                 .AddPartitionByKey(col2)
+                 .AddSortKey(expr_maker.OpDiv(col1, expr_maker.Constant(10)), optimizer::OrderByOrderingType::ASC)
+                 .AddWindowFunction(row_number)
+                 .AddWindowFunction(rank)
+                 .AddWindowFunction(sum)
+                 .AddWindowFunction(count)
+                 .Build();
+  }
+  // Checkers:
+  // There should be 500 output rows, where col1 < 500. Both pipelines are parallel, so partitions are produced
+  // concurrently and arrive in no particular order, but every partition is emitted by a single thread. Within a
+  // partition, rows are ordered by col1 / 10, and the window functions are checked against the rows of the partition
+  // in output order.
+  ASSERT_TRUE(MakeExecCtx()->GetExecutionSettings().GetIsParallelQueryExecutionEnabled());
+  std::map<int64_t, std::vector<std::array<int64_t, 6>>> partitions;
+  uint32_t num_output_rows = 0;
+  RowChecker row_checker = [&partitions, &num_output_rows](const std::vector<sql::Val *> &vals) {
+    std::array<int64_t, 6> row{};
+    for (uint32_t i = 0; i < row.size(); i++) {
+      auto val = static_cast<sql::Integer *>(vals[i]);
+      ASSERT_FALSE(val->is_null_);
+      row[i] = val->val_;
+    }
+    partitions[row[1]].push_back(row);
+    num_output_rows++;
+  };
+  CorrectnessFn correctness_fn = [&partitions, &num_output_rows]() {
+    ASSERT_EQ(num_output_rows, 500);
+    for (const auto &[col2, output_rows] : partitions) {
+      (void)col2;
+      const uint64_t part_begin = 0, part_end = output_rows.size();
+      const auto part_size = static_cast<int64_t>(part_end - part_begin);
+      for (uint64_t i = part_begin; i < part_end; i++) {
+        const auto &row = output_rows[i];
+        const auto row_idx = static_cast<int64_t>(i - part_begin);
+        ASSERT_LT(row[0], 500);
+        // ROW_NUMBER
+        ASSERT_EQ(row[2], row_idx + 1);
+        // RANK: peers share the rank of the first peer.
+        if (row_idx > 0 && output_rows[i - 1][0] / 10 == row[0] / 10) {
+          ASSERT_EQ(row[3], output_rows[i - 1][3]);
+        } else {
+          if (row_idx > 0) {
+            ASSERT_LT(output_rows[i - 1][0] / 10, row[0] / 10);
+          }
+          ASSERT_EQ(row[3], row_idx + 1);
+        }
+        // SUM over the previous, current and next rows of the partition.
+        int64_t expected_sum = row[0];
+        if (i > part_begin) expected_sum += output_rows[i - 1][0];
+        if (i + 1 < part_end) expected_sum += output_rows[i + 1][0];
+        ASSERT_EQ(row[4], expected_sum);
+        // COUNT(*) over the whole partition.
+        ASSERT_EQ(row[5], part_size);
+      }
+    }
+  };
+  GenericChecker checker(row_checker, correctness_fn);
+
+  // Create exec ctx
+  OutputStore store{&checker, window->GetOutputSchema().Get()};
+  MultiOutputCallback callback{std::vector<exec::OutputCallback>{store}};
+  exec::OutputCallback callback_fn = callback.ConstructOutputCallback();
+  auto exec_ctx = MakeExecCtx(&callback_fn, window->GetOutputSchema().Get());
+
+  // Run & Check
+  auto executable = execution::compiler::CompilationContext::Compile(*window, exec_ctx->GetExecutionSettings(),
+                                                                     exec_ctx->GetAccessor());
+  executable->Run(common::ManagedPointer(exec_ctx), MODE);
+  checker.CheckCorrectness();
+}
+
 // NOLINTNEXTLINE
 TEST_F(CompilerTest, SimpleSortTest) {
   // SELECT col1, col2, col1 + col2 FROM test_1 WHERE col1 < 500 ORDER BY col2 ASC, col1 - col2 DESC
@@ -2386,6 +2848,128 @@ TEST_F(CompilerTest, SimpleIndexNestedLoopJoinTest) {
   EXPECT_TRUE(CheckFeatureVectorEquality(feature_vec0, exp_vec0));
 }
 
+// NOLINTNEXTLINE
+TEST_F(CompilerTest, BatchedIndexNestedLoopJoinTest) {
+  // SELECT t1.col1, t2.col1, t2.col2, t1.col2 + t2.col2 FROM test_2 AS t2 INNER JOIN test_1 AS t1 ON t1.col1=t2.col1
+  // WHERE t2.col1 < 80
+  // The index is probed with exact keys from a sequential scan, so the keys of every vector projection of test_2 are
+  // looked up in one batch.
+  // Get accessor
+  auto accessor = MakeAccessor();
+  ExpressionMaker expr_maker;
+
+  // Make the seq scan: Here test_2 is the outer table
+  std::unique_ptr<planner::AbstractPlanNode> seq_scan;
+  OutputSchemaHelper seq_scan_out{0, &expr_maker};
+  {
+    auto table_oid2 = accessor->GetTableOid(NSOid(), "test_2");
+    auto table_schema2 = accessor->GetSchema(table_oid2);
+    // OIDs
+    auto cola_oid = table_schema2.GetColumn("col1").Oid();
+    auto colb_oid = table_schema2.GetColumn("col2").Oid();
+    // Get Table columns
+    auto col1 = expr_maker.CVE(cola_oid, type::TypeId::INTEGER);
+    auto col2 = expr_maker.CVE(colb_oid, type::TypeId::INTEGER);
+    seq_scan_out.AddOutput("col1", col1);
+    seq_scan_out.AddOutput("col2", col2);
+    auto schema = seq_scan_out.MakeSchema();
+    // Make predicate
+    auto predicate = expr_maker.ComparisonLt(col1, expr_maker.Constant(80));
+    // Build
+    planner::SeqScanPlanNode::Builder builder;
+    seq_scan = builder.SetOutputSchema(std::move(schema))
+                   .SetColumnOids({cola_oid, colb_oid})
+                   .SetScanPredicate(predicate)
+                   .SetIsForUpdateFlag(false)
+                   .SetTableOid(table_oid2)
+                   .Build();
+  }
+  // Make index join
+  std::unique_ptr<planner::AbstractPlanNode> index_join;
+  OutputSchemaHelper index_join_out{0, &expr_maker};
+  {
+    // Retrieve table and index
+    auto table_oid1 = accessor->GetTableOid(NSOid(), "test_1");
+    auto table_schema1 = accessor->GetSchema(table_oid1);
+    auto index_oid1 = accessor->GetIndexOid(NSOid(), "index_1");
+    // t1.col1, and t1.col2
+    auto t1_col1 = expr_maker.CVE(table_schema1.GetColumn("colA").Oid(), type::TypeId::INTEGER);
+    // t2.col1, and t2.col2
+    auto t2_col1 = seq_scan_out.GetOutput("col1");
+    auto t2_col2 = seq_scan_out.GetOutput("col2");
+    // t1.col2 + t2.col2
+    auto sum = expr_maker.OpSum(t1_col1, t2_col2);
+    // Output Schema
+    index_join_out.AddOutput("t1.col1", t1_col1);
+    index_join_out.AddOutput("t2.col1", t2_col1);
+    index_join_out.AddOutput("t2.col2", t2_col2);
+    index_join_out.AddOutput("sum", sum);
+    auto schema = index_join_out.MakeSchema();
+    // Predicate
+    auto predicate = expr_maker.ComparisonEq(t1_col1, t2_col1);
+    // Build
+    planner::IndexJoinPlanNode::Builder builder;
+    index_join = builder.AddChild(std::move(seq_scan))
+                     .SetIndexOid(index_oid1)
+                     .SetTableOid(table_oid1)
+                     .AddLoIndexColumn(catalog::indexkeycol_oid_t(1), t2_col1)
+                     .SetOutputSchema(std::move(schema))
+                     .SetJoinType(planner::LogicalJoinType::INNER)
+                     .SetJoinPredicate(predicate)
+                     .SetScanType(planner::IndexScanType::Exact)
+                     .Build();
+  }
+  // Compile and Run
+  // 80 hundred rows should be outputted because of the WHERE clause
+  // The joined cols should be equal
+  // The 4th column is the sum of the 1nd and 3rd columns
+  uint32_t num_output_rows{0};
+  uint32_t num_expected_rows{80};
+  RowChecker row_checker = [&num_output_rows, num_expected_rows](const std::vector<sql::Val *> &vals) {
+    // Read cols
+    auto col1 = static_cast<sql::Integer *>(vals[0]);
+    auto col2 = static_cast<sql::Integer *>(vals[1]);
+    auto col3 = static_cast<sql::Integer *>(vals[2]);
+    auto col4 = static_cast<sql::Integer *>(vals[3]);
+    ASSERT_FALSE(col1->is_null_ || col2->is_null_);
+    // Check join cols
+    ASSERT_EQ(col1->val_, col2->val_);
+    // Check that col4 = col1 + col3
+    ASSERT_EQ(col4->val_, col1->val_ + col3->val_);
+    // Check the number of output row
+    num_output_rows++;
+    ASSERT_LE(num_output_rows, num_expected_rows);
+  };
+  CorrectnessFn correctness_fn = [&num_output_rows, num_expected_rows]() {
+    ASSERT_EQ(num_output_rows, num_expected_rows);
+  };
+  GenericChecker checker(row_checker, correctness_fn);
+
+  // Make Exec Ctx
+  OutputStore store{&checker, index_join->GetOutputSchema().Get()};
+  exec::OutputPrinter printer(index_join->GetOutputSchema().Get());
+  MultiOutputCallback callback{std::vector<exec::OutputCallback>{store, printer}};
+  exec::OutputCallback callback_fn = callback.ConstructOutputCallback();
+  auto exec_ctx = MakeExecCtx(&callback_fn, index_join->GetOutputSchema().Get());
+
+  // Run & Check
+  auto executable = execution::compiler::CompilationContext::Compile(*index_join, exec_ctx->GetExecutionSettings(),
+                                                                     exec_ctx->GetAccessor());
+  executable->Run(common::ManagedPointer(exec_ctx), MODE);
+  checker.CheckCorrectness();
+
+  // Pipeline Units
+  auto pipeline = executable->GetPipelineOperatingUnits();
+  EXPECT_EQ(pipeline->units_.size(), 1);
+
+  auto feature_vec0 = pipeline->GetPipelineFeatures(execution::pipeline_id_t(1));
+  auto exp_vec0 = std::vector<selfdriving::ExecutionOperatingUnitType>{
+      selfdriving::ExecutionOperatingUnitType::OUTPUT, selfdriving::ExecutionOperatingUnitType::OP_INTEGER_COMPARE,
+      selfdriving::ExecutionOperatingUnitType::OP_INTEGER_PLUS_OR_MINUS,
+      selfdriving::ExecutionOperatingUnitType::IDX_SCAN, selfdriving::ExecutionOperatingUnitType::SEQ_SCAN};
+  EXPECT_TRUE(CheckFeatureVectorEquality(feature_vec0, exp_vec0));
+}
+
 // NOLINTNEXTLINE
 TEST_F(CompilerTest, SimpleIndexNestedLoopJoinMultiColumnTest) {
   // SELECT t1.col1, t2.col1, t2.col2, t1.col2 + t2.col2 FROM test_1 AS t1 INNER JOIN test_2 AS t2 ON t1.col1=t2.col1
@@ -75,6 +75,52 @@ TEST_F(IndexIteratorTest, SimpleIndexIteratorTest) {
   }
 }
 
+// NOLINTNEXTLINE
+TEST_F(IndexIteratorTest, BatchScanKeyTest) {
+  //
+  // Probe the index with the keys of a whole vector projection at once
+  //
+
+  auto table_oid = exec_ctx_->GetAccessor()->GetTableOid(NSOid(), "test_1");
+  auto index_oid = exec_ctx_->GetAccessor()->GetIndexOid(NSOid(), "index_1");
+  std::array<uint32_t, 1> col_oids{1};
+  TableVectorIterator table_iter(exec_ctx_.get(), table_oid.UnderlyingValue(), col_oids.data(),
+                                 static_cast<uint32_t>(col_oids.size()));
+  IndexIterator index_iter{exec_ctx_.get(),
+                           1,
+                           table_oid.UnderlyingValue(),
+                           index_oid.UnderlyingValue(),
+                           col_oids.data(),
+                           static_cast<uint32_t>(col_oids.size())};
+  table_iter.Init();
+  index_iter.Init();
+  VectorProjectionIterator *vpi = table_iter.GetVectorProjectionIterator();
+
+  uint32_t num_keys = 0;
+  while (table_iter.Advance()) {
+    // Collect the keys of the vector projection, and probe them together
+    for (; vpi->HasNext(); vpi->Advance()) {
+      auto *key = vpi->GetValue<int32_t, false>(0, nullptr);
+      index_iter.LoPR()->Set<int32_t, false>(0, *key, false);
+      index_iter.AddBatchKey();
+    }
+    index_iter.ScanKeyBatch();
+
+    // Every key should find its own tuple, and nothing else
+    vpi->Reset();
+    for (uint32_t key_idx = 0; vpi->HasNext(); vpi->Advance(), key_idx++) {
+      auto *key = vpi->GetValue<int32_t, false>(0, nullptr);
+      index_iter.SelectBatchResult(key_idx);
+      ASSERT_TRUE(index_iter.Advance());
+      auto *val = index_iter.TablePR()->Get<int32_t, false>(0, nullptr);
+      ASSERT_EQ(*key, *val);
+      ASSERT_FALSE(index_iter.Advance());
+      num_keys++;
+    }
+  }
+  ASSERT_EQ(num_keys, sql::TEST1_SIZE);
+}
+
 // NOLINTNEXTLINE
 TEST_F(IndexIteratorTest, SimpleAscendingScanTest) {
   //
@@ -121,6 +121,28 @@ TEST_F(AggregationHashTableTest, SimpleRandomInsertionTest) {
   }
 }
 
+// NOLINTNEXTLINE
+TEST_F(AggregationHashTableTest, PresizedInsertionTest) {
+  const uint32_t num_tuples = 10000;
+
+  // A table sized for all groups up-front should never grow, unlike a default-sized one.
+  auto exec_ctx = MakeExecCtx();
+  AggregationHashTable presized_table(exec_ctx->GetExecutionSettings(), exec_ctx.get(), sizeof(AggTuple), num_tuples);
+
+  for (auto *table : {AggTable(), &presized_table}) {
+    for (uint32_t idx = 0; idx < num_tuples; idx++) {
+      auto input = InputTuple(idx, 1);
+      auto hash_val = input.Hash();
+      EXPECT_EQ(nullptr, table->Lookup(hash_val, AggTupleKeyEq, reinterpret_cast<const void *>(&input)));
+      new (table->AllocInputTuple(hash_val)) AggTuple(input);
+    }
+    EXPECT_EQ(num_tuples, table->GetTupleCount());
+  }
+
+  EXPECT_GT(AggTable()->GetStatistics()->num_growths_, 0);
+  EXPECT_EQ(0u, presized_table.GetStatistics()->num_growths_);
+}
+
 // NOLINTNEXTLINE
 TEST_F(AggregationHashTableTest, IterationTest) {
   //
@@ -267,6 +289,97 @@ TEST_F(AggregationHashTableTest, BatchProcessTest) {
   }
 }
 
+// NOLINTNEXTLINE
+TEST_F(AggregationHashTableTest, AdaptiveBypassTest) {
+  auto exec_ctx = MakeExecCtx();
+
+  struct QueryState {
+    uint32_t row_count_;
+    uint32_t num_bad_aggs_;
+  };
+
+  MemoryPool memory(nullptr);
+  ThreadStateContainer container(&memory);
+  container.Reset(
+      sizeof(AggregationHashTable),
+      [](void *ctx, void *aht) {
+        auto exec_ctx = reinterpret_cast<exec::ExecutionContext *>(ctx);
+        new (aht) AggregationHashTable(exec_ctx->GetExecutionSettings(), exec_ctx, sizeof(AggTuple));
+      },
+      [](void *ctx, void *aht) { std::destroy_at(reinterpret_cast<AggregationHashTable *>(aht)); }, exec_ctx.get());
+
+  // Every key appears once per round, so the thread-local pre-aggregation
+  // table can't reduce its input and should be bypassed. The duplicates across
+  // rounds must still be combined when the overflow partitions are merged.
+  constexpr uint32_t num_keys = 1U << 18U;
+  constexpr uint32_t num_rounds = 2;
+  auto *agg_table = container.AccessCurrentThreadStateAs<AggregationHashTable>();
+
+  VectorProjection vector_projection;
+  vector_projection.Initialize({TypeId::Integer, TypeId::Integer});
+  vector_projection.Reset(common::Constants::K_DEFAULT_VECTOR_SIZE);
+  for (uint32_t key_base = 0; key_base < num_keys * num_rounds; key_base += common::Constants::K_DEFAULT_VECTOR_SIZE) {
+    auto keys = reinterpret_cast<uint32_t *>(vector_projection.GetColumn(0)->GetData());
+    auto values = reinterpret_cast<uint32_t *>(vector_projection.GetColumn(1)->GetData());
+    for (uint32_t i = 0; i < common::Constants::K_DEFAULT_VECTOR_SIZE; i++) {
+      keys[i] = (key_base + i) % num_keys;
+      values[i] = 1;
+    }
+
+    VectorProjectionIterator vpi(&vector_projection);
+    agg_table->ProcessBatch(
+        &vpi, {0},
+        [](VectorProjectionIterator *new_aggs, VectorProjectionIterator *input) {
+          VectorProjectionIterator::SynchronizedForEach({new_aggs, input}, [&]() {
+            auto *e = *new_aggs->GetValue<sql::HashTableEntry *, false>(1, nullptr);
+            auto agg = const_cast<AggTuple *>(e->PayloadAs<AggTuple>());
+            agg->key_ = *input->GetValue<uint32_t, false>(0, nullptr);
+            agg->count1_ = agg->count2_ = agg->count3_ = 0;
+          });
+        },
+        [](VectorProjectionIterator *aggs, VectorProjectionIterator *input) {
+          VectorProjectionIterator::SynchronizedForEach({aggs, input}, [&]() {
+            auto *e = *aggs->GetValue<sql::HashTableEntry *, false>(1, nullptr);
+            auto agg = const_cast<AggTuple *>(e->PayloadAs<AggTuple>());
+            agg->count1_ += *input->GetValue<uint32_t, false>(1, nullptr);
+          });
+        },
+        true /* Partitioned? */);
+  }
+
+  EXPECT_GT(agg_table->GetStatistics()->num_flushes_, 0);
+  EXPECT_GT(agg_table->GetStatistics()->num_bypassed_, 0);
+
+  // Merge the partitions and check every group saw all of its tuples.
+  AggregationHashTable main_table(exec_ctx->GetExecutionSettings(), exec_ctx.get(), sizeof(AggTuple));
+  main_table.TransferMemoryAndPartitions(
+      &container, 0, [](void *ctx, AggregationHashTable *table, AHTOverflowPartitionIterator *iter) {
+        for (; iter->HasNext(); iter->Next()) {
+          auto *partial_agg = iter->GetRowAs<AggTuple>();
+          auto *existing = reinterpret_cast<AggTuple *>(table->Lookup(iter->GetRowHash(), AggAggKeyEq, partial_agg));
+          if (existing != nullptr) {
+            existing->Merge(*partial_agg);
+          } else {
+            table->Insert(iter->GetEntryForRow());
+          }
+        }
+      });
+
+  QueryState query_state{0, 0};
+  main_table.ExecutePartitionedScan(&query_state, [](void *query_state, void *thread_state,
+                                                     const AggregationHashTable *table) {
+    auto *qs = reinterpret_cast<QueryState *>(query_state);
+    for (AHTIterator iter(*table); iter.HasNext(); iter.Next()) {
+      auto agg = reinterpret_cast<const AggTuple *>(iter.GetCurrentAggregateRow());
+      qs->row_count_++;
+      qs->num_bad_aggs_ += static_cast<uint32_t>(agg->count1_ != num_rounds);
+    }
+  });
+
+  EXPECT_EQ(num_keys, query_state.row_count_);
+  EXPECT_EQ(0u, query_state.num_bad_aggs_);
+}
+
 // NOLINTNEXTLINE
 TEST_F(AggregationHashTableTest, OverflowPartitonIteratorTest) {
   struct Data {
@@ -0,0 +1,145 @@
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "execution/sql/csv_scanner.h"
+#include "execution/sql/thread_state_container.h"
+#include "execution/sql_test.h"
+
+namespace noisepage::execution::sql::test {
+
+class CSVScannerTest : public SqlBasedTest {
+  void SetUp() override {
+    SqlBasedTest::SetUp();
+    exec_ctx_ = MakeExecCtx();
+  }
+
+  void TearDown() override { std::remove(FILE_NAME); }
+
+ protected:
+  static constexpr const char *FILE_NAME = "csv_scanner_test.csv";
+
+  // Write the given contents to the test file.
+  static void WriteFile(const std::string &contents) {
+    std::ofstream out(FILE_NAME, std::ios::binary);
+    out << contents;
+  }
+
+  // Read all records of the test file as strings, where NULL fields are "<null>".
+  std::vector<std::vector<std::string>> ReadAll(uint32_t num_cols, char delimiter = ',', char quote = '"',
+                                                char escape = '"') {
+    std::vector<std::vector<std::string>> records;
+    CSVScanner scanner(exec_ctx_.get(), FILE_NAME, num_cols, delimiter, quote, escape);
+    while (scanner.Advance()) {
+      for (auto *vpi = scanner.GetVectorProjectionIterator(); vpi->HasNext(); vpi->Advance()) {
+        std::vector<std::string> record;
+        for (uint32_t col = 0; col < num_cols; col++) {
+          bool null = false;
+          const auto *field = vpi->GetValue<storage::VarlenEntry, false>(col, &null);
+          record.emplace_back(null ? "<null>" : std::string(field->StringView()));
+        }
+        records.emplace_back(std::move(record));
+      }
+    }
+    return records;
+  }
+
+  /**
+   * Execution context to use for the test
+   */
+  std::unique_ptr<exec::ExecutionContext> exec_ctx_;
+};
+
+// NOLINTNEXTLINE
+TEST_F(CSVScannerTest, QuotingTest) {
+  WriteFile(
+      "1,abc,\"x,y\"\n"
+      "2,,\"\"\r\n"
+      "\n"
+      "3,\"say \"\"hi\"\"\",\"two\nlines\"\n"
+      "4,last,no newline");
+
+  const auto records = ReadAll(3);
+  ASSERT_EQ(4u, records.size());
+  EXPECT_EQ((std::vector<std::string>{"1", "abc", "x,y"}), records[0]);
+  EXPECT_EQ((std::vector<std::string>{"2", "<null>", ""}), records[1]);
+  EXPECT_EQ((std::vector<std::string>{"3", "say \"hi\"", "two\nlines"}), records[2]);
+  EXPECT_EQ((std::vector<std::string>{"4", "last", "no newline"}), records[3]);
+}
+
+// NOLINTNEXTLINE
+TEST_F(CSVScannerTest, EscapeTest) {
+  WriteFile("1|'it\\'s'|'a\\\\b'\n2|plain|'x|y'\n");
+
+  const auto records = ReadAll(3, '|', '\'', '\\');
+  ASSERT_EQ(2u, records.size());
+  EXPECT_EQ((std::vector<std::string>{"1", "it's", "a\\b"}), records[0]);
+  EXPECT_EQ((std::vector<std::string>{"2", "plain", "x|y"}), records[1]);
+}
+
+// NOLINTNEXTLINE
+TEST_F(CSVScannerTest, WrongFieldCountTest) {
+  WriteFile("1,2\n3\n");
+  EXPECT_THROW(ReadAll(2), ExecutionException);
+}
+
+// NOLINTNEXTLINE
+TEST_F(CSVScannerTest, ManyChunksTest) {
+  //
+  // Records with quoted newlines span many chunks, and must all come back in order
+  //
+
+  constexpr uint32_t num_records = 100000;
+  std::string contents;
+  for (uint32_t i = 0; i < num_records; i++) {
+    contents += std::to_string(i) + ",\"line\nbreak, " + std::to_string(i) + "\"\n";
+  }
+  WriteFile(contents);
+
+  const auto records = ReadAll(2);
+  ASSERT_EQ(num_records, records.size());
+  for (uint32_t i = 0; i < num_records; i++) {
+    ASSERT_EQ(std::to_string(i), records[i][0]);
+    ASSERT_EQ("line\nbreak, " + std::to_string(i), records[i][1]);
+  }
+}
+
+// NOLINTNEXTLINE
+TEST_F(CSVScannerTest, ParallelScanTest) {
+  struct Counter {
+    uint32_t c_;
+  };
+
+  auto init_count = [](void *ctx, void *tls) { reinterpret_cast<Counter *>(tls)->c_ = 0; };
+
+  // Scan function just counts all records it sees
+  auto scan_fn = [](UNUSED_ATTRIBUTE void *state, void *tls, VectorProjectionIterator *vpi) {
+    auto *counter = reinterpret_cast<Counter *>(tls);
+    for (; vpi->HasNext(); vpi->Advance()) {
+      counter->c_++;
+    }
+  };
+
+  constexpr uint32_t num_records = 200000;
+  std::string contents;
+  for (uint32_t i = 0; i < num_records; i++) {
+    contents += std::to_string(i) + ",\"" + std::to_string(i * 7) + "\"\n";
+  }
+  WriteFile(contents);
+
+  // Setup thread states
+  exec_ctx_->GetThreadStateContainer()->Reset(sizeof(Counter), init_count, nullptr, exec_ctx_.get());
+
+  CSVScanner scanner(exec_ctx_.get(), FILE_NAME, 2, ',', '"', '"');
+  EXPECT_LT(1u, scanner.GetNumChunks());
+  scanner.ParallelScan(nullptr, scan_fn);
+
+  // Count total record count seen by all threads
+  uint32_t aggregate_count = 0;
+  exec_ctx_->GetThreadStateContainer()->ForEach<Counter>([&](Counter *counter) { aggregate_count += counter->c_; });
+  EXPECT_EQ(num_records, aggregate_count);
+}
+
+}  // namespace noisepage::execution::sql::test
@@ -7,6 +7,7 @@
 #include "execution/exec/execution_settings.h"
 #include "execution/sql/join_hash_table.h"
 #include "execution/sql/thread_state_container.h"
+#include "execution/util/cpu_info.h"
 #include "execution/sql_test.h"
 
 // TODO(WAN): can't FRIEND_TEST unless in the same namespace
@@ -217,6 +218,213 @@ TEST_F(JoinHashTableTest, ParallelBuildTest) {
   }
 }
 
+// The result of a join whose probe tuples are Tuples: the number of pairs of
+// tuples with equal keys, and the sum of their keys.
+struct JoinResult {
+  uint64_t count_;
+  uint64_t key_sum_;
+};
+
+void CountJoinMatch(void *query_state, void *thread_state, const byte *build_tuple, const byte *probe_tuple) {
+  const auto key = reinterpret_cast<const Tuple *>(probe_tuple)->a_;
+  if (reinterpret_cast<const Tuple *>(build_tuple)->a_ == key) {
+    auto *result = reinterpret_cast<JoinResult *>(thread_state != nullptr ? thread_state : query_state);
+    result->count_++;
+    result->key_sum_ += key;
+  }
+}
+
+// Materialize the probe tuples with keys [0, num_keys) in the given table.
+void PopulateProbeTable(JoinHashTable *jht, const uint32_t num_keys) {
+  for (uint32_t i = 0; i < num_keys; i++) {
+    const auto tuple = Tuple{i, 1, 2, 3};
+    *reinterpret_cast<Tuple *>(jht->AllocInputTuple(tuple.Hash())) = tuple;
+  }
+}
+
+// A container of thread-local join hash tables of Tuples.
+class ThreadLocalTables {
+ public:
+  ThreadLocalTables(exec::ExecutionContext *exec_ctx, exec::ExecutionSettings *exec_settings)
+      : exec_ctx_(exec_ctx), exec_settings_(exec_settings), container_(exec_ctx->GetMemoryPool()) {
+    container_.Reset(
+        sizeof(JoinHashTable),
+        [](auto *ctx, auto *s) {
+          auto *self = reinterpret_cast<ThreadLocalTables *>(ctx);
+          new (s) JoinHashTable(*self->exec_settings_, self->exec_ctx_, sizeof(Tuple));
+        },
+        [](auto *ctx, auto *s) { reinterpret_cast<JoinHashTable *>(s)->~JoinHashTable(); }, this);
+  }
+
+  JoinHashTable *Local() { return container_.AccessCurrentThreadStateAs<JoinHashTable>(); }
+
+  ThreadStateContainer *Container() { return &container_; }
+
+ private:
+  exec::ExecutionContext *exec_ctx_;
+  exec::ExecutionSettings *exec_settings_;
+  ThreadStateContainer container_;
+};
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashTableTest, BuildAndJoinTest) {
+  auto exec_ctx = MakeExecCtx();
+  exec::ExecutionSettings exec_settings{};
+
+  const uint32_t num_tuples = 10000;
+  const uint32_t dup_scale_factor = 3;
+
+  JoinHashTable join_hash_table(exec_settings, exec_ctx.get(), sizeof(Tuple));
+  PopulateJoinHashTable(&join_hash_table, num_tuples, dup_scale_factor);
+
+  // Half of the probe keys have matches.
+  JoinHashTable probe_table(exec_settings, exec_ctx.get(), sizeof(Tuple));
+  PopulateProbeTable(&probe_table, num_tuples * 2);
+
+  JoinResult result{0, 0};
+  join_hash_table.BuildAndJoin(&probe_table, nullptr, &result, CountJoinMatch);
+
+  EXPECT_TRUE(join_hash_table.IsBuilt());
+  EXPECT_EQ(num_tuples * dup_scale_factor, result.count_);
+  EXPECT_EQ(uint64_t{dup_scale_factor} * num_tuples * (num_tuples - 1) / 2, result.key_sum_);
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashTableTest, PartitionedJoinTest) {
+  auto exec_ctx = MakeExecCtx();
+  exec::ExecutionSettings exec_settings{};
+  tbb::task_scheduler_init sched;
+
+  // Enough tuples to need more than one partition.
+  const uint32_t num_tuples = 100000;
+  const uint32_t num_thread_local_tables = 4;
+
+  // Both sides are materialized in thread-local tables, as in a parallel
+  // pipeline, and moved into a global table.
+  ThreadLocalTables build_tables(exec_ctx.get(), &exec_settings);
+  ThreadLocalTables probe_tables(exec_ctx.get(), &exec_settings);
+  LaunchParallel(num_thread_local_tables, [&](auto tid) {
+    PopulateJoinHashTable(build_tables.Local(), num_tuples, 1);
+    PopulateProbeTable(probe_tables.Local(), num_tuples * 2);
+  });
+
+  JoinHashTable join_hash_table(exec_settings, exec_ctx.get(), sizeof(Tuple));
+  join_hash_table.MoveTuplesParallel(build_tables.Container(), 0);
+  JoinHashTable probe_table(exec_settings, exec_ctx.get(), sizeof(Tuple));
+  probe_table.MoveTuplesParallel(probe_tables.Container(), 0);
+  EXPECT_EQ(num_tuples * num_thread_local_tables, join_hash_table.GetTupleCount());
+  EXPECT_FALSE(join_hash_table.IsBuilt());
+
+  ThreadStateContainer container(exec_ctx->GetMemoryPool());
+  container.Reset(
+      sizeof(JoinResult), [](auto *ctx, auto *s) { *reinterpret_cast<JoinResult *>(s) = JoinResult{0, 0}; }, nullptr,
+      nullptr);
+  join_hash_table.BuildAndJoinPartitioned(probe_table.GetEntryLists(), nullptr, nullptr, &container, CountJoinMatch);
+
+  // Every build tuple matches one probe tuple from each thread-local table.
+  JoinResult result{0, 0};
+  container.ForEach<JoinResult>([&](JoinResult *r) {
+    result.count_ += r->count_;
+    result.key_sum_ += r->key_sum_;
+  });
+  const uint64_t num_pairs = uint64_t{num_thread_local_tables} * num_thread_local_tables;
+  EXPECT_EQ(num_pairs * num_tuples, result.count_);
+  EXPECT_EQ(num_pairs * num_tuples * (num_tuples - 1) / 2, result.key_sum_);
+
+  // The partitioned table can be probed as usual afterwards.
+  EXPECT_TRUE(join_hash_table.IsBuilt());
+  EXPECT_EQ(num_tuples * num_thread_local_tables, join_hash_table.GetTupleCount());
+  for (uint32_t i = 0; i < num_tuples; i += 97) {
+    const auto probe = Tuple{i, 0, 0, 0};
+    uint32_t count = 0;
+    for (auto iter = join_hash_table.Lookup<false>(probe.Hash()); iter.HasNext();) {
+      count += static_cast<uint32_t>(reinterpret_cast<const Tuple *>(iter.GetMatchPayload())->a_ == i);
+    }
+    EXPECT_EQ(num_thread_local_tables, count);
+  }
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashTableTest, ShouldPartitionJoinTest) {
+  const uint64_t l3_cache_size = CpuInfo::Instance()->GetCacheSize(CpuInfo::L3_CACHE);
+  EXPECT_FALSE(JoinHashTable::ShouldPartitionJoin(0, sizeof(Tuple)));
+  EXPECT_FALSE(JoinHashTable::ShouldPartitionJoin(1000, sizeof(Tuple)));
+  EXPECT_TRUE(JoinHashTable::ShouldPartitionJoin(l3_cache_size / sizeof(Tuple), sizeof(Tuple)));
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashTableTest, ParallelScanTest) {
+  auto exec_ctx = MakeExecCtx();
+  exec::ExecutionSettings exec_settings{};
+  tbb::task_scheduler_init sched;
+
+  // Enough tuples for several morsels, where the last one is partial.
+  const uint32_t num_tuples = JoinHashTable::PARALLEL_SCAN_MORSEL_SIZE * 3 + 100;
+  const uint32_t num_thread_local_tables = 4;
+
+  // Count every tuple scanned, and sum up their keys.
+  auto scan_fn = [](void *query_state, void *thread_state, JoinHashTableIterator *iter) {
+    auto *result = reinterpret_cast<JoinResult *>(thread_state);
+    for (; iter->HasNext(); iter->Next()) {
+      result->count_++;
+      result->key_sum_ += iter->GetCurrentRowAs<Tuple>()->a_;
+    }
+  };
+  auto scan = [&](const JoinHashTable &jht) {
+    ThreadStateContainer container(exec_ctx->GetMemoryPool());
+    container.Reset(
+        sizeof(JoinResult), [](auto *ctx, auto *s) { *reinterpret_cast<JoinResult *>(s) = JoinResult{0, 0}; },
+        nullptr, nullptr);
+    jht.ExecuteParallelScan(nullptr, &container, scan_fn);
+    JoinResult result{0, 0};
+    container.ForEach<JoinResult>([&](JoinResult *r) {
+      result.count_ += r->count_;
+      result.key_sum_ += r->key_sum_;
+    });
+    return result;
+  };
+
+  // A table built serially.
+  {
+    JoinHashTable join_hash_table(exec_settings, exec_ctx.get(), sizeof(Tuple));
+    PopulateJoinHashTable(&join_hash_table, num_tuples, 1);
+    join_hash_table.Build();
+
+    const auto result = scan(join_hash_table);
+    EXPECT_EQ(num_tuples, result.count_);
+    EXPECT_EQ(uint64_t{num_tuples} * (num_tuples - 1) / 2, result.key_sum_);
+  }
+
+  // A table merged from thread-local tables, whose tuples are spread over
+  // several entry lists.
+  {
+    struct Context {
+      exec::ExecutionContext *exec_ctx_;
+      exec::ExecutionSettings *settings_;
+    };
+    Context ctx{exec_ctx.get(), &exec_settings};
+
+    ThreadStateContainer container(exec_ctx->GetMemoryPool());
+    container.Reset(
+        sizeof(JoinHashTable),
+        [](auto *ctx, auto *s) {
+          auto context = reinterpret_cast<Context *>(ctx);
+          new (s) JoinHashTable(*context->settings_, context->exec_ctx_, sizeof(Tuple));
+        },
+        [](auto *ctx, auto *s) { reinterpret_cast<JoinHashTable *>(s)->~JoinHashTable(); }, &ctx);
+    LaunchParallel(num_thread_local_tables, [&](auto tid) {
+      PopulateJoinHashTable(container.AccessCurrentThreadStateAs<JoinHashTable>(), num_tuples, 1);
+    });
+
+    JoinHashTable join_hash_table(exec_settings, exec_ctx.get(), sizeof(Tuple));
+    join_hash_table.MergeParallel(&container, 0);
+
+    const auto result = scan(join_hash_table);
+    EXPECT_EQ(num_thread_local_tables * num_tuples, result.count_);
+    EXPECT_EQ(uint64_t{num_thread_local_tables} * num_tuples * (num_tuples - 1) / 2, result.key_sum_);
+  }
+}
+
 #if 0
 // NOLINTNEXTLINE
 TEST_F(JoinHashTableTest, PerfTest) {
@@ -1,4 +1,6 @@
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "execution/sql/operators/like_operators.h"
 #include "execution/tpl_test.h"
@@ -80,4 +82,78 @@ TEST_F(LikeOperatorsTests, MultiCharacter_Wildcard) {
   EXPECT_TRUE(Like{}(storage::VarlenEntry::Create(s), storage::VarlenEntry::Create(p)));  // NOLINT
 }
 
+// NOLINTNEXTLINE
+TEST_F(LikeOperatorsTests, EscapedWildcard) {
+  // An escaped '%' after a wildcard must still match literally
+  std::string s = "50%";
+  std::string p = "%\\%";
+  EXPECT_TRUE(Like{}(storage::VarlenEntry::Create(s), storage::VarlenEntry::Create(p)));  // NOLINT
+
+  s = "50";
+  EXPECT_FALSE(Like{}(storage::VarlenEntry::Create(s), storage::VarlenEntry::Create(p)));  // NOLINT
+}
+
+// NOLINTNEXTLINE
+TEST_F(LikeOperatorsTests, PatternKinds) {
+  EXPECT_EQ(LikePattern::Kind::Exact, LikePattern(storage::VarlenEntry::Create("abc")).GetKind());
+  EXPECT_EQ(LikePattern::Kind::Prefix, LikePattern(storage::VarlenEntry::Create("abc%%")).GetKind());
+  EXPECT_EQ(LikePattern::Kind::Suffix, LikePattern(storage::VarlenEntry::Create("%abc")).GetKind());
+  EXPECT_EQ(LikePattern::Kind::Contains, LikePattern(storage::VarlenEntry::Create("%abc%")).GetKind());
+  EXPECT_EQ(LikePattern::Kind::General, LikePattern(storage::VarlenEntry::Create("a%c")).GetKind());
+  EXPECT_EQ(LikePattern::Kind::General, LikePattern(storage::VarlenEntry::Create("%a_c%")).GetKind());
+
+  // Escapes are removed from the literal
+  const auto escaped_pattern = storage::VarlenEntry::Create("%10\\%%");
+  LikePattern escaped(escaped_pattern);
+  EXPECT_EQ(LikePattern::Kind::Contains, escaped.GetKind());
+  EXPECT_EQ("10%", escaped.GetLiteral());
+  EXPECT_TRUE(escaped.Matches(storage::VarlenEntry::Create("save 10% now")));
+  EXPECT_FALSE(escaped.Matches(storage::VarlenEntry::Create("save 10 now")));
+}
+
+// NOLINTNEXTLINE
+TEST_F(LikeOperatorsTests, PatternCopyAndMove) {
+  // Patterns stay valid after the string they were built from is gone, and after being copied or moved. Short
+  // patterns are the interesting case, since both the VarlenEntry and the copied pattern store them inline.
+  std::vector<LikePattern> patterns;
+  for (const std::string p : {"ab%", "%\\%", "%10\\%%", "%a_c%"}) {
+    auto pattern = LikePattern(storage::VarlenEntry::Create(p));
+    LikePattern copy(pattern);
+    patterns.emplace_back(std::move(pattern));
+    patterns.push_back(copy);
+  }
+  // Force another round of moves.
+  patterns.reserve(patterns.capacity() * 2);
+
+  const std::vector<std::pair<std::string, std::string>> cases = {
+      {"abc", "xab"}, {"50%", "50"}, {"a 10% b", "a 10 b"}, {"xabcx", "xacx"}};
+  for (uint32_t i = 0; i < cases.size(); i++) {
+    for (uint32_t j = 2 * i; j < 2 * i + 2; j++) {
+      EXPECT_TRUE(patterns[j].Matches(storage::VarlenEntry::Create(cases[i].first)));
+      EXPECT_FALSE(patterns[j].Matches(storage::VarlenEntry::Create(cases[i].second)));
+    }
+  }
+}
+
+// NOLINTNEXTLINE
+TEST_F(LikeOperatorsTests, Contains) {
+  // Place the needle at every position of strings that span several SIMD blocks
+  const std::string needle = "special";
+  for (uint32_t len = needle.size(); len < 100; len++) {
+    for (uint32_t pos = 0; pos + needle.size() <= len; pos++) {
+      std::string s(len, 's');
+      s.replace(pos, needle.size(), needle);
+      EXPECT_TRUE(LikePattern::Contains(s.data(), s.size(), needle.data(), needle.size()));
+      // Break the match in the middle
+      s[pos + 3] = 'x';
+      EXPECT_FALSE(LikePattern::Contains(s.data(), s.size(), needle.data(), needle.size()));
+    }
+  }
+
+  std::string s = "%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%special%requests";
+  EXPECT_TRUE(Like{}(storage::VarlenEntry::Create(s), storage::VarlenEntry::Create("%special%requests%")));  // NOLINT
+  EXPECT_TRUE(Like{}(storage::VarlenEntry::Create(s), storage::VarlenEntry::Create("%special%")));           // NOLINT
+  EXPECT_FALSE(Like{}(storage::VarlenEntry::Create(s), storage::VarlenEntry::Create("%specials%")));         // NOLINT
+}
+
 }  // namespace noisepage::execution::sql::test
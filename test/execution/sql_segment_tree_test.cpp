@@ -0,0 +1,163 @@
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "execution/sql/segment_tree.h"
+#include "execution/sql/value.h"
+#include "execution/sql_test.h"
+
+namespace noisepage::execution::sql::test {
+
+class SegmentTreeTest : public SqlBasedTest {
+ public:
+  std::default_random_engine generator_;
+};
+
+namespace {
+
+// Compute the aggregate over the range [begin, end) of the given values by brute force. NULLs are empty optionals.
+std::optional<int64_t> NaiveAggregate(const std::vector<std::optional<int64_t>> &vals, SegmentTree::AggregateKind kind,
+                                      uint64_t begin, uint64_t end) {
+  std::optional<int64_t> result;
+  int64_t count = 0;
+  for (uint64_t i = begin; i < end; i++) {
+    if (!vals[i].has_value()) continue;
+    const int64_t val = *vals[i];
+    count++;
+    switch (kind) {
+      case SegmentTree::AggregateKind::Sum:
+        result = result.value_or(0) + val;
+        break;
+      case SegmentTree::AggregateKind::Min:
+        result = std::min(result.value_or(std::numeric_limits<int64_t>::max()), val);
+        break;
+      case SegmentTree::AggregateKind::Max:
+        result = std::max(result.value_or(std::numeric_limits<int64_t>::min()), val);
+        break;
+      default:
+        break;
+    }
+  }
+  return kind == SegmentTree::AggregateKind::Count ? count : result;
+}
+
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_F(SegmentTreeTest, EmptyTree) {
+  auto exec_ctx = MakeExecCtx();
+  SegmentTree tree(exec_ctx.get(), SegmentTree::AggregateKind::Sum);
+  tree.Build();
+  EXPECT_EQ(0, tree.GetNumValues());
+
+  Integer result(1);
+  tree.Query(0, 0, &result);
+  EXPECT_TRUE(result.is_null_);
+}
+
+// NOLINTNEXTLINE
+TEST_F(SegmentTreeTest, IntegerRangesMatchNaive) {
+  auto exec_ctx = MakeExecCtx();
+  std::uniform_int_distribution<int64_t> val_dist(-1000, 1000);
+  std::uniform_int_distribution<uint32_t> null_dist(0, 9);
+
+  for (const auto kind : {SegmentTree::AggregateKind::Count, SegmentTree::AggregateKind::Sum,
+                          SegmentTree::AggregateKind::Min, SegmentTree::AggregateKind::Max}) {
+    SegmentTree tree(exec_ctx.get(), kind);
+    // Reuse the tree for sequences of different sizes, including odd sizes and sizes that aren't a power of two.
+    for (const uint64_t num_vals : {1, 2, 7, 64, 100, 333}) {
+      std::vector<std::optional<int64_t>> vals;
+      tree.Reset();
+      for (uint64_t i = 0; i < num_vals; i++) {
+        if (null_dist(generator_) == 0) {
+          vals.emplace_back(std::nullopt);
+          tree.Append(Integer::Null());
+        } else {
+          vals.emplace_back(val_dist(generator_));
+          tree.Append(Integer(*vals.back()));
+        }
+      }
+      tree.Build();
+      EXPECT_EQ(num_vals, tree.GetNumValues());
+
+      for (uint64_t begin = 0; begin <= num_vals; begin++) {
+        for (uint64_t end = begin; end <= num_vals; end++) {
+          Integer result(0);
+          tree.Query(begin, end, &result);
+          const auto expected = NaiveAggregate(vals, kind, begin, end);
+          ASSERT_EQ(!expected.has_value(), result.is_null_) << "range [" << begin << ", " << end << ")";
+          if (expected.has_value()) {
+            ASSERT_EQ(*expected, result.val_) << "range [" << begin << ", " << end << ")";
+          }
+        }
+      }
+    }
+  }
+}
+
+// NOLINTNEXTLINE
+TEST_F(SegmentTreeTest, AverageOfIntegers) {
+  auto exec_ctx = MakeExecCtx();
+  SegmentTree tree(exec_ctx.get(), SegmentTree::AggregateKind::Avg);
+  // 1, NULL, 2, 3, NULL, 6
+  for (const auto &val : {Integer(1), Integer::Null(), Integer(2), Integer(3), Integer::Null(), Integer(6)}) {
+    tree.Append(val);
+  }
+  tree.Build();
+
+  Real result(0.0);
+  tree.Query(0, 6, &result);
+  EXPECT_FALSE(result.is_null_);
+  EXPECT_DOUBLE_EQ(3.0, result.val_);
+
+  tree.Query(2, 4, &result);
+  EXPECT_DOUBLE_EQ(2.5, result.val_);
+
+  // A range of only NULLs has no average.
+  tree.Query(4, 5, &result);
+  EXPECT_TRUE(result.is_null_);
+}
+
+// NOLINTNEXTLINE
+TEST_F(SegmentTreeTest, RealMinMaxSum) {
+  auto exec_ctx = MakeExecCtx();
+  const std::vector<double> vals = {2.5, -1.0, 4.0, 0.5, 3.25};
+
+  SegmentTree min_tree(exec_ctx.get(), SegmentTree::AggregateKind::Min);
+  SegmentTree max_tree(exec_ctx.get(), SegmentTree::AggregateKind::Max);
+  SegmentTree sum_tree(exec_ctx.get(), SegmentTree::AggregateKind::Sum);
+  for (const auto val : vals) {
+    min_tree.Append(Real(val));
+    max_tree.Append(Real(val));
+    sum_tree.Append(Real(val));
+  }
+  min_tree.Build();
+  max_tree.Build();
+  sum_tree.Build();
+
+  Real result(0.0);
+  min_tree.Query(0, 5, &result);
+  EXPECT_DOUBLE_EQ(-1.0, result.val_);
+  min_tree.Query(2, 5, &result);
+  EXPECT_DOUBLE_EQ(0.5, result.val_);
+  max_tree.Query(0, 2, &result);
+  EXPECT_DOUBLE_EQ(2.5, result.val_);
+  max_tree.Query(1, 5, &result);
+  EXPECT_DOUBLE_EQ(4.0, result.val_);
+  sum_tree.Query(1, 4, &result);
+  EXPECT_DOUBLE_EQ(3.5, result.val_);
+
+  // COUNT over reals is an integer.
+  SegmentTree count_tree(exec_ctx.get(), SegmentTree::AggregateKind::Count);
+  count_tree.Append(Real(1.0));
+  count_tree.Append(Real::Null());
+  count_tree.Append(Real(2.0));
+  count_tree.Build();
+  Integer count(0);
+  count_tree.Query(0, 3, &count);
+  EXPECT_EQ(2, count.val_);
+}
+
+}  // namespace noisepage::execution::sql::test
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <functional>
 #include <limits>
+#include <mutex>
 #include <queue>
 #include <random>
 #include <vector>
@@ -262,4 +263,66 @@ TEST_F(SorterTest, UnbalancedParallelSortTest) {
   }
 }
 
+// NOLINTNEXTLINE
+TEST_F(SorterTest, ScanPartitionsParallelTest) {
+  tbb::task_scheduler_init sched;
+  auto exec_ctx = MakeExecCtx();
+
+  // Tuples are partitioned by their key divided by 10.
+  static const auto cmp_fn = [](const void *left, const void *right) {
+    return reinterpret_cast<const TestTuple<1> *>(left)->Compare(*reinterpret_cast<const TestTuple<1> *>(right));
+  };
+  static const auto same_partition_fn = [](const void *left, const void *right) {
+    return reinterpret_cast<const TestTuple<1> *>(left)->key_ / 10 ==
+           reinterpret_cast<const TestTuple<1> *>(right)->key_ / 10;
+  };
+
+  // The query state counts the tuples and the ranges each partition is seen in.
+  struct ScanState {
+    std::mutex mutex_;
+    std::vector<uint32_t> tuple_counts_;
+    std::vector<uint32_t> range_counts_;
+  };
+  static const auto scan_fn = [](void *query_state, UNUSED_ATTRIBUTE void *thread_state, SorterIterator *iter,
+                                 SorterIterator *peek_iter) {
+    auto *state = reinterpret_cast<ScanState *>(query_state);
+    EXPECT_EQ(iter->NumRemaining(), peek_iter->NumRemaining());
+    std::vector<uint32_t> tuple_counts(state->tuple_counts_.size(), 0);
+    for (; iter->HasNext(); iter->Next()) {
+      tuple_counts[iter->GetRowAs<TestTuple<1>>()->key_ / 10]++;
+    }
+    std::lock_guard<std::mutex> lock(state->mutex_);
+    for (uint32_t part = 0; part < tuple_counts.size(); part++) {
+      state->tuple_counts_[part] += tuple_counts[part];
+      state->range_counts_[part] += tuple_counts[part] != 0 ? 1 : 0;
+    }
+  };
+
+  ThreadStateContainer container(exec_ctx->GetMemoryPool());
+  container.Reset(sizeof(uint32_t), nullptr, nullptr, nullptr);
+
+  for (uint32_t num_tuples : {0, 1, 10, 1000, 100000}) {
+    const uint32_t num_partitions = 50;
+    std::vector<uint32_t> expected_counts(num_partitions, 0);
+    Sorter sorter(exec_ctx.get(), cmp_fn, sizeof(TestTuple<1>));
+    for (uint32_t i = 0; i < num_tuples; i++) {
+      auto *elem = reinterpret_cast<TestTuple<1> *>(sorter.AllocInputTuple());
+      elem->key_ = generator_() % (num_partitions * 10);
+      expected_counts[elem->key_ / 10]++;
+    }
+    sorter.Sort();
+
+    ScanState state;
+    state.tuple_counts_.resize(num_partitions, 0);
+    state.range_counts_.resize(num_partitions, 0);
+    sorter.ScanPartitionsParallel(&state, &container, same_partition_fn, scan_fn);
+
+    // Every tuple is scanned once, and no partition is split across ranges.
+    EXPECT_EQ(expected_counts, state.tuple_counts_);
+    for (uint32_t part = 0; part < num_partitions; part++) {
+      EXPECT_EQ(expected_counts[part] != 0 ? 1 : 0, state.range_counts_[part]);
+    }
+  }
+}
+
 }  // namespace noisepage::execution::sql::test
@@ -0,0 +1,114 @@
+#include "execution/sql/tuple_id_list.h"
+#include "execution/sql/vector.h"
+#include "execution/sql/vector_operations/vector_operations.h"
+#include "execution/sql_test.h"
+
+namespace noisepage::execution::sql::test {
+
+class VectorAggregateTest : public TplTest {};
+
+// NOLINTNEXTLINE
+TEST_F(VectorAggregateTest, SimpleNonNull) {
+  // Aggregate a full vector of the given type: 0, 1, 2, ..., SIZE-1
+#define CHECK_SIMPLE_AGGREGATE(TYPE, RESULT_TYPE, SIZE)                \
+  {                                                                    \
+    auto vec = Make##TYPE##Vector(SIZE);                               \
+    VectorOps::Generate(vec.get(), 0, 1);                              \
+    RESULT_TYPE sum = 0, min = 0, max = 0;                             \
+    EXPECT_EQ(SIZE, VectorOps::Count(*vec));                           \
+    EXPECT_EQ(SIZE, VectorOps::Sum(*vec, &sum));                       \
+    EXPECT_EQ(SIZE, VectorOps::Min(*vec, &min));                       \
+    EXPECT_EQ(SIZE, VectorOps::Max(*vec, &max));                       \
+    EXPECT_EQ(static_cast<RESULT_TYPE>(SIZE * (SIZE - 1) / 2), sum);   \
+    EXPECT_EQ(static_cast<RESULT_TYPE>(0), min);                       \
+    EXPECT_EQ(static_cast<RESULT_TYPE>(SIZE - 1), max);                \
+  }
+
+  CHECK_SIMPLE_AGGREGATE(TinyInt, int64_t, 100);
+  CHECK_SIMPLE_AGGREGATE(SmallInt, int64_t, 1000);
+  CHECK_SIMPLE_AGGREGATE(Integer, int64_t, 2048);
+  CHECK_SIMPLE_AGGREGATE(Integer, int64_t, 2047);
+  CHECK_SIMPLE_AGGREGATE(BigInt, int64_t, 13);
+  CHECK_SIMPLE_AGGREGATE(Float, double, 1000);
+  CHECK_SIMPLE_AGGREGATE(Double, double, 2048);
+#undef CHECK_SIMPLE_AGGREGATE
+}
+
+// NOLINTNEXTLINE
+TEST_F(VectorAggregateTest, NegativeValues) {
+  auto vec = MakeIntegerVector({-4, 10, -20, 7, 3, -1, 0, 15, -9, 2}, std::vector<bool>(10, false));
+
+  int64_t sum = 0, min = 0, max = 0;
+  EXPECT_EQ(10, VectorOps::Sum(*vec, &sum));
+  EXPECT_EQ(10, VectorOps::Min(*vec, &min));
+  EXPECT_EQ(10, VectorOps::Max(*vec, &max));
+  EXPECT_EQ(3, sum);
+  EXPECT_EQ(-20, min);
+  EXPECT_EQ(15, max);
+}
+
+// NOLINTNEXTLINE
+TEST_F(VectorAggregateTest, WithNulls) {
+  // NULLs are skipped, including the extreme values they hide
+  auto vec = MakeBigIntVector({100, 1, 2, -100, 3, 4, 5, 6, 7, 8},
+                              {true, false, false, true, false, false, false, false, false, false});
+
+  int64_t sum = 0, min = 0, max = 0;
+  EXPECT_EQ(8, VectorOps::Count(*vec));
+  EXPECT_EQ(8, VectorOps::Sum(*vec, &sum));
+  EXPECT_EQ(8, VectorOps::Min(*vec, &min));
+  EXPECT_EQ(8, VectorOps::Max(*vec, &max));
+  EXPECT_EQ(36, sum);
+  EXPECT_EQ(1, min);
+  EXPECT_EQ(8, max);
+}
+
+// NOLINTNEXTLINE
+TEST_F(VectorAggregateTest, FilteredWithNulls) {
+  auto vec = MakeDoubleVector({1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0},
+                              {false, false, true, false, false, false, false, false, false, false});
+
+  auto tids = TupleIdList(vec->GetSize());
+  tids = {0, 2, 4, 6, 8};
+  vec->SetFilteredTupleIdList(&tids, tids.GetTupleCount());
+
+  // Only 1.0, 5.0, 7.0, 9.0 are active and non-NULL
+  double sum = 0, min = 0, max = 0;
+  EXPECT_EQ(4, VectorOps::Count(*vec));
+  EXPECT_EQ(4, VectorOps::Sum(*vec, &sum));
+  EXPECT_EQ(4, VectorOps::Min(*vec, &min));
+  EXPECT_EQ(4, VectorOps::Max(*vec, &max));
+  EXPECT_DOUBLE_EQ(22.0, sum);
+  EXPECT_DOUBLE_EQ(1.0, min);
+  EXPECT_DOUBLE_EQ(9.0, max);
+}
+
+// NOLINTNEXTLINE
+TEST_F(VectorAggregateTest, AllFilteredOrNull) {
+  // Nothing to aggregate, so the results are untouched
+  auto vec = MakeIntegerVector({1, 2, 3, 4}, {true, false, true, false});
+  auto tids = TupleIdList(vec->GetSize());
+  tids = {0, 2};
+  vec->SetFilteredTupleIdList(&tids, tids.GetTupleCount());
+
+  int64_t sum = -1, min = -1, max = -1;
+  EXPECT_EQ(0, VectorOps::Count(*vec));
+  EXPECT_EQ(0, VectorOps::Sum(*vec, &sum));
+  EXPECT_EQ(0, VectorOps::Min(*vec, &min));
+  EXPECT_EQ(0, VectorOps::Max(*vec, &max));
+  EXPECT_EQ(-1, sum);
+  EXPECT_EQ(-1, min);
+  EXPECT_EQ(-1, max);
+}
+
+// NOLINTNEXTLINE
+TEST_F(VectorAggregateTest, InvalidTypes) {
+  auto vec = MakeVarcharVector({"a", "b"}, {false, false});
+  int64_t int_result;
+  double real_result;
+  EXPECT_THROW(VectorOps::Sum(*vec, &int_result), ExecutionException);
+  EXPECT_THROW(VectorOps::Min(*vec, &real_result), ExecutionException);
+  EXPECT_EQ(2, VectorOps::Count(*vec));
+}
+
+}  // namespace noisepage::execution::sql::test
@@ -0,0 +1,92 @@
+#include <random>
+#include <vector>
+
+#include "common/error/exception.h"
+#include "execution/sql/tuple_id_list.h"
+#include "execution/sql/vector.h"
+#include "execution/sql/vector_operations/vector_operations.h"
+#include "execution/sql_test.h"
+
+namespace noisepage::execution::sql::test {
+
+class VectorGatherSelectTest : public TplTest {
+ protected:
+  static std::vector<uint64_t> ToVector(const TupleIdList &tids) {
+    std::vector<uint64_t> result;
+    tids.ForEach([&](const uint64_t i) { result.push_back(i); });
+    return result;
+  }
+};
+
+// NOLINTNEXTLINE
+TEST_F(VectorGatherSelectTest, InvalidPointers) {
+  auto input = MakeIntegerVector(10);
+  auto pointers = MakeBigIntVector(10);
+  auto result = TupleIdList(10);
+  result.AddAll();
+  EXPECT_THROW(VectorOps::GatherAndSelectEqual(*input, *pointers, 0, &result), ExecutionException);
+}
+
+// NOLINTNEXTLINE
+TEST_F(VectorGatherSelectTest, EqualIntegerKeys) {
+  //
+  // Compare 32- and 64-bit keys at an offset of the rows against a vector of inputs with some NULLs, under TID lists
+  // of varying density, including sizes that aren't a multiple of the SIMD width. Inactive TIDs point nowhere.
+  //
+
+  struct Row {
+    int32_t pad_;
+    int32_t int_key_;
+    int64_t big_int_key_;
+  };
+
+  std::mt19937 gen(7);
+  for (const uint32_t size : {1u, 3u, 67u, 1000u, common::Constants::K_DEFAULT_VECTOR_SIZE}) {
+    for (const uint32_t density : {1u, 10u, 50u, 100u}) {
+      std::vector<Row> rows(size);
+      auto int_input = MakeIntegerVector(size);
+      auto big_int_input = MakeBigIntVector(size);
+      auto pointers = MakePointerVector(size);
+      auto tids = TupleIdList(size);
+
+      for (uint32_t i = 0; i < size; i++) {
+        rows[i].int_key_ = gen() % 4;
+        rows[i].big_int_key_ = (int64_t{1} << 40) + gen() % 4;
+        if (gen() % 8 == 0) {
+          int_input->SetValue(i, GenericValue::CreateNull(TypeId::Integer));
+          big_int_input->SetValue(i, GenericValue::CreateNull(TypeId::BigInt));
+        } else {
+          int_input->SetValue(i, GenericValue::CreateInteger(gen() % 4));
+          big_int_input->SetValue(i, GenericValue::CreateBigInt((int64_t{1} << 40) + gen() % 4));
+        }
+        if (gen() % 100 < density) {
+          tids.Add(i);
+          pointers->SetValue(i, GenericValue::CreatePointer(reinterpret_cast<uintptr_t>(&rows[i])));
+        } else {
+          pointers->SetValue(i, GenericValue::CreatePointer(0));
+        }
+      }
+
+      // Expected results.
+      const auto *raw_ints = reinterpret_cast<const int32_t *>(int_input->GetData());
+      const auto *raw_big_ints = reinterpret_cast<const int64_t *>(big_int_input->GetData());
+      std::vector<uint64_t> expected_int, expected_big_int;
+      tids.ForEach([&](const uint64_t i) {
+        if (!int_input->IsNull(i) && rows[i].int_key_ == raw_ints[i]) expected_int.push_back(i);
+        if (!big_int_input->IsNull(i) && rows[i].big_int_key_ == raw_big_ints[i]) expected_big_int.push_back(i);
+      });
+
+      auto int_result = TupleIdList(size);
+      int_result.AssignFrom(tids);
+      VectorOps::GatherAndSelectEqual(*int_input, *pointers, offsetof(Row, int_key_), &int_result);
+      EXPECT_EQ(expected_int, ToVector(int_result));
+
+      auto big_int_result = TupleIdList(size);
+      big_int_result.AssignFrom(tids);
+      VectorOps::GatherAndSelectEqual(*big_int_input, *pointers, offsetof(Row, big_int_key_), &big_int_result);
+      EXPECT_EQ(expected_big_int, ToVector(big_int_result));
+    }
+  }
+}
+
+}  // namespace noisepage::execution::sql::test
@@ -233,6 +233,13 @@ class ExpressionMaker {
     return Operator(parser::ExpressionType::OPERATOR_DIVIDE, child1->GetReturnValueType(), child1, child2);
   }
 
+  /**
+   * create expression for child1 % child2
+   */
+  ManagedExpression OpMod(ManagedExpression child1, ManagedExpression child2) {
+    return Operator(parser::ExpressionType::OPERATOR_MOD, child1->GetReturnValueType(), child1, child2);
+  }
+
   /**
    * create expression for -child
    */
@@ -75,6 +75,11 @@ class SqlBasedTest : public TplTest {
     return catalog_->GetAccessor(common::ManagedPointer(test_txn_), test_db_oid_, DISABLED);
   }
 
+  /** Limit the number of threads that the execution contexts made after this call run parallel pipelines on. */
+  void SetNumberOfParallelExecutionThreads(int num_threads) {
+    exec_settings_->number_of_parallel_execution_threads_ = num_threads;
+  }
+
  protected:
   std::unique_ptr<catalog::CatalogAccessor> accessor_;
   catalog::db_oid_t test_db_oid_{0};
@@ -26,9 +26,11 @@
 #include "parser/expression/aggregate_expression.h"
 #include "parser/expression/column_value_expression.h"
 #include "parser/expression/constant_value_expression.h"
+#include "parser/expression/derived_value_expression.h"
 #include "parser/expression/function_expression.h"
 #include "parser/expression/operator_expression.h"
 #include "parser/expression/subquery_expression.h"
+#include "parser/expression/window_expression.h"
 #include "parser/expression_defs.h"
 #include "parser/postgresparser.h"
 #include "planner/plannodes/analyze_plan_node.h"
@@ -45,6 +47,9 @@
 #include "planner/plannodes/drop_table_plan_node.h"
 #include "planner/plannodes/drop_trigger_plan_node.h"
 #include "planner/plannodes/drop_view_plan_node.h"
+#include "planner/plannodes/projection_plan_node.h"
+#include "planner/plannodes/set_op_plan_node.h"
+#include "planner/plannodes/window_plan_node.h"
 #include "storage/garbage_collector.h"
 #include "storage/index/index_builder.h"
 #include "storage/sql_table.h"
@@ -427,6 +432,181 @@ TEST_F(OperatorTransformerTest, SelectStatementOrderByTest) {
   EXPECT_FALSE(logical_get->GetIsForUpdate());
 }
 
+// NOLINTNEXTLINE
+TEST_F(OperatorTransformerTest, SelectStatementSetOpTest) {
+  OPTIMIZER_LOG_DEBUG("Parsing sql query");
+  std::string select_sql = "SELECT a1 FROM A WHERE a1 > 1 UNION ALL SELECT b1 FROM B";
+
+  std::string ref =
+      "{\"Op\":\"LogicalSetOp\",\"Children\":"
+      "[{\"Op\":\"LogicalFilter\",\"Children\":"
+      "[{\"Op\":\"LogicalGet\",}]},{\"Op\":\"LogicalGet\",}]}";
+
+  auto parse_tree = parser::PostgresParser::BuildParseTree(select_sql);
+  auto statement = parse_tree->GetStatements()[0];
+  binder_->BindNameToNode(common::ManagedPointer(parse_tree), nullptr, nullptr);
+  operator_transformer_ =
+      std::make_unique<optimizer::QueryToOperatorTransformer>(common::ManagedPointer(accessor_), db_oid_);
+  operator_tree_ = operator_transformer_->ConvertToOpExpression(statement, common::ManagedPointer(parse_tree));
+  auto info = GenerateOperatorAudit(common::ManagedPointer<optimizer::AbstractOptimizerNode>(operator_tree_));
+
+  EXPECT_EQ(ref, info);
+
+  // Test LogicalSetOp
+  auto logical_set_op = operator_tree_->Contents()->GetContentsAs<optimizer::LogicalSetOp>();
+  EXPECT_EQ(planner::SetOpType::UNION_ALL, logical_set_op->GetSetOp());
+  EXPECT_EQ(1, logical_set_op->GetLeftColumns().size());
+  EXPECT_EQ("a1",
+            logical_set_op->GetLeftColumns()[0].CastManagedPointerTo<parser::ColumnValueExpression>()->GetColumnName());
+  EXPECT_EQ("b1",
+            logical_set_op->GetRightColumns()[0].CastManagedPointerTo<parser::ColumnValueExpression>()->GetColumnName());
+
+  // Test the right LogicalGet
+  auto logical_get = operator_tree_->GetChildren()[1]->Contents()->GetContentsAs<optimizer::LogicalGet>();
+  EXPECT_EQ(table_b_oid_, logical_get->GetTableOid());
+
+  auto optree_ptr = common::ManagedPointer(operator_tree_);
+  auto *op_ctx = optimization_context_.get();
+  std::vector<std::unique_ptr<optimizer::AbstractOptimizerNode>> transformed;
+
+  optimizer::LogicalSetOpToPhysicalHashSetOp rule;
+  EXPECT_TRUE(rule.Check(optree_ptr.CastManagedPointerTo<optimizer::AbstractOptimizerNode>(), op_ctx));
+  rule.Transform(optree_ptr.CastManagedPointerTo<optimizer::AbstractOptimizerNode>(), &transformed, op_ctx);
+
+  auto op = transformed[0]->Contents();
+  EXPECT_EQ(op->GetOpType(), optimizer::OpType::HASHSETOP);
+  EXPECT_TRUE(op->IsPhysical());
+  EXPECT_EQ(op->GetName(), "HashSetOp");
+  EXPECT_EQ(2, transformed[0]->GetChildren().size());
+
+  // Both children already output their select list, as InputColumnDeriver asks them to
+  std::vector<std::unique_ptr<planner::AbstractPlanNode>> children_plans{};
+  for (uint32_t i = 0; i < 2; i++) {
+    std::vector<planner::OutputSchema::Column> cols;
+    cols.emplace_back("col", type::TypeId::INTEGER,
+                      std::make_unique<parser::DerivedValueExpression>(type::TypeId::INTEGER, 0, 0));
+    children_plans.emplace_back(planner::ProjectionPlanNode::Builder()
+                                    .SetPlanNodeId(planner::plan_node_id_t(i + 100))
+                                    .SetOutputSchema(std::make_unique<planner::OutputSchema>(std::move(cols)))
+                                    .Build());
+  }
+
+  planner::PlanMetaData plan_meta_data{};
+  optimizer::PlanGenerator plan_generator(common::ManagedPointer<planner::PlanMetaData>{&plan_meta_data});
+  optimizer::PropertySet property_set{};
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> required_cols = logical_set_op->GetLeftColumns();
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> output_cols = logical_set_op->GetLeftColumns();
+  std::vector<optimizer::ExprMap> children_expr_map{};
+
+  auto plan_node = plan_generator.ConvertOpNode(
+      txn_, accessor_.get(), transformed[0].get(), &property_set, required_cols, output_cols, std::move(children_plans),
+      std::move(children_expr_map), planner::PlanMetaData::PlanNodeMetaData());
+  EXPECT_EQ(plan_node->GetPlanNodeType(), planner::PlanNodeType::SETOP);
+  auto sopn = common::ManagedPointer(plan_node).CastManagedPointerTo<planner::SetOpPlanNode>();
+  EXPECT_EQ(sopn->GetSetOp(), planner::SetOpType::UNION_ALL);
+  EXPECT_EQ(sopn->GetChildrenSize(), 2);
+  EXPECT_EQ(sopn->GetOutputSchema()->NumColumns(), 1);
+  EXPECT_EQ(sopn->GetOutputSchema()->GetColumn(0).GetType(), type::TypeId::INTEGER);
+}
+
+// NOLINTNEXTLINE
+TEST_F(OperatorTransformerTest, SelectStatementWindowTest) {
+  OPTIMIZER_LOG_DEBUG("Parsing sql query");
+  std::string select_sql =
+      "SELECT a1, SUM(a1) OVER (PARTITION BY a2 ORDER BY a1 DESC ROWS BETWEEN 1 PRECEDING AND CURRENT ROW) FROM A";
+
+  std::string ref = "{\"Op\":\"LogicalWindow\",\"Children\":[{\"Op\":\"LogicalGet\",}]}";
+
+  auto parse_tree = parser::PostgresParser::BuildParseTree(select_sql);
+  auto statement = parse_tree->GetStatements()[0];
+  binder_->BindNameToNode(common::ManagedPointer(parse_tree), nullptr, nullptr);
+  operator_transformer_ =
+      std::make_unique<optimizer::QueryToOperatorTransformer>(common::ManagedPointer(accessor_), db_oid_);
+  operator_tree_ = operator_transformer_->ConvertToOpExpression(statement, common::ManagedPointer(parse_tree));
+  auto info = GenerateOperatorAudit(common::ManagedPointer<optimizer::AbstractOptimizerNode>(operator_tree_));
+
+  EXPECT_EQ(ref, info);
+
+  // Test LogicalWindow
+  auto logical_window = operator_tree_->Contents()->GetContentsAs<optimizer::LogicalWindow>();
+  EXPECT_EQ(1, logical_window->GetWindowExprs().size());
+  auto window_expr = logical_window->GetWindowExprs()[0].CastManagedPointerTo<parser::WindowExpression>();
+  EXPECT_EQ(planner::WindowFunctionType::SUM, window_expr->GetFunctionType());
+  EXPECT_EQ(type::TypeId::INTEGER, window_expr->GetReturnValueType());
+  EXPECT_EQ(1, window_expr->GetPartitionByKeys().size());
+  EXPECT_EQ(1, window_expr->GetSortKeys().size());
+  EXPECT_EQ(optimizer::OrderByOrderingType::DESC, window_expr->GetSortOrders()[0]);
+  EXPECT_FALSE(window_expr->IsStartUnbounded());
+  EXPECT_EQ(1, window_expr->GetStartPreceding());
+  EXPECT_FALSE(window_expr->IsEndUnbounded());
+  EXPECT_EQ(0, window_expr->GetEndFollowing());
+
+  auto optree_ptr = common::ManagedPointer(operator_tree_);
+  auto *op_ctx = optimization_context_.get();
+  std::vector<std::unique_ptr<optimizer::AbstractOptimizerNode>> transformed;
+
+  optimizer::LogicalWindowToPhysicalWindow rule;
+  EXPECT_TRUE(rule.Check(optree_ptr.CastManagedPointerTo<optimizer::AbstractOptimizerNode>(), op_ctx));
+  rule.Transform(optree_ptr.CastManagedPointerTo<optimizer::AbstractOptimizerNode>(), &transformed, op_ctx);
+
+  auto op = transformed[0]->Contents();
+  EXPECT_EQ(op->GetOpType(), optimizer::OpType::WINDOW);
+  EXPECT_TRUE(op->IsPhysical());
+  EXPECT_EQ(op->GetName(), "Window");
+  EXPECT_EQ(1, transformed[0]->GetChildren().size());
+
+  // The child outputs a1 and a2
+  auto a1 = statement.CastManagedPointerTo<parser::SelectStatement>()->GetSelectColumns()[0];
+  auto a2 = window_expr->GetPartitionByKeys()[0];
+  std::vector<planner::OutputSchema::Column> cols;
+  cols.emplace_back("a1", type::TypeId::INTEGER,
+                    std::make_unique<parser::DerivedValueExpression>(type::TypeId::INTEGER, 0, 0));
+  cols.emplace_back("a2", type::TypeId::VARCHAR,
+                    std::make_unique<parser::DerivedValueExpression>(type::TypeId::VARCHAR, 0, 1));
+  std::vector<std::unique_ptr<planner::AbstractPlanNode>> children_plans{};
+  children_plans.emplace_back(planner::ProjectionPlanNode::Builder()
+                                  .SetPlanNodeId(planner::plan_node_id_t(100))
+                                  .SetOutputSchema(std::make_unique<planner::OutputSchema>(std::move(cols)))
+                                  .Build());
+  std::vector<optimizer::ExprMap> children_expr_map(1);
+  children_expr_map[0][a1] = 0;
+  children_expr_map[0][a2] = 1;
+
+  planner::PlanMetaData plan_meta_data{};
+  optimizer::PlanGenerator plan_generator(common::ManagedPointer<planner::PlanMetaData>{&plan_meta_data});
+  optimizer::PropertySet property_set{};
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> required_cols{a1,
+                                                                                logical_window->GetWindowExprs()[0]};
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> output_cols = required_cols;
+
+  auto plan_node = plan_generator.ConvertOpNode(
+      txn_, accessor_.get(), transformed[0].get(), &property_set, required_cols, output_cols, std::move(children_plans),
+      std::move(children_expr_map), planner::PlanMetaData::PlanNodeMetaData());
+  EXPECT_EQ(plan_node->GetPlanNodeType(), planner::PlanNodeType::WINDOW);
+  auto wpn = common::ManagedPointer(plan_node).CastManagedPointerTo<planner::WindowPlanNode>();
+  EXPECT_EQ(wpn->GetChildrenSize(), 1);
+  EXPECT_EQ(wpn->GetPartitionByKeys().size(), 1);
+  EXPECT_EQ(wpn->GetSortKeys().size(), 1);
+  EXPECT_EQ(wpn->GetSortKeys()[0].second, optimizer::OrderByOrderingType::DESC);
+  ASSERT_EQ(wpn->GetWindowFunctions().size(), 1);
+  const auto &func = wpn->GetWindowFunctions()[0];
+  EXPECT_EQ(func.type_, planner::WindowFunctionType::SUM);
+  EXPECT_EQ(func.argument_->GetExpressionType(), parser::ExpressionType::VALUE_TUPLE);
+  EXPECT_EQ(func.start_preceding_, 1);
+  EXPECT_EQ(func.end_following_, 0);
+
+  // a1 is read from the child, the window function from the window
+  auto schema = wpn->GetOutputSchema();
+  ASSERT_EQ(schema->NumColumns(), 2);
+  auto col0 = schema->GetColumn(0).GetExpr().CastManagedPointerTo<parser::DerivedValueExpression>();
+  EXPECT_EQ(col0->GetTupleIdx(), 0);
+  EXPECT_EQ(col0->GetValueIdx(), 0);
+  auto col1 = schema->GetColumn(1).GetExpr().CastManagedPointerTo<parser::DerivedValueExpression>();
+  EXPECT_EQ(col1->GetTupleIdx(), 1);
+  EXPECT_EQ(col1->GetValueIdx(), 0);
+  EXPECT_EQ(schema->GetColumn(1).GetType(), type::TypeId::INTEGER);
+}
+
 // NOLINTNEXTLINE
 TEST_F(OperatorTransformerTest, SelectStatementLeftJoinTest) {
   // Check if star expression is correctly processed
@@ -957,20 +957,59 @@ TEST(OperatorTests, RightHashJoinTest) {
   auto x_2 = common::ManagedPointer<parser::AbstractExpression>(expr_b_2);
   auto x_3 = common::ManagedPointer<parser::AbstractExpression>(expr_b_3);
 
-  Operator right_hash_join_1 = RightHashJoin::Make(x_1).RegisterWithTxnContext(txn_context);
-  Operator right_hash_join_2 = RightHashJoin::Make(x_2).RegisterWithTxnContext(txn_context);
-  Operator right_hash_join_3 = RightHashJoin::Make(x_3).RegisterWithTxnContext(txn_context);
+  auto annotated_expr_0 =
+      AnnotatedExpression(common::ManagedPointer<parser::AbstractExpression>(), std::unordered_set<std::string>());
+  auto annotated_expr_1 = AnnotatedExpression(x_1, std::unordered_set<std::string>());
+  auto annotated_expr_2 = AnnotatedExpression(x_2, std::unordered_set<std::string>());
+  auto annotated_expr_3 = AnnotatedExpression(x_3, std::unordered_set<std::string>());
+
+  Operator right_hash_join_1 =
+      RightHashJoin::Make(std::vector<AnnotatedExpression>(), {x_1}, {x_1}).RegisterWithTxnContext(txn_context);
+  Operator right_hash_join_2 =
+      RightHashJoin::Make(std::vector<AnnotatedExpression>(), {x_1}, {x_1}).RegisterWithTxnContext(txn_context);
+  Operator right_hash_join_3 = RightHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_0}, {x_1}, {x_1})
+                                   .RegisterWithTxnContext(txn_context);
+  Operator right_hash_join_4 = RightHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_1})
+                                   .RegisterWithTxnContext(txn_context);
+  Operator right_hash_join_5 = RightHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_2}, {x_2}, {x_1})
+                                   .RegisterWithTxnContext(txn_context);
+  Operator right_hash_join_6 = RightHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_2})
+                                   .RegisterWithTxnContext(txn_context);
+  Operator right_hash_join_7 = RightHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_3}, {x_1}, {x_1})
+                                   .RegisterWithTxnContext(txn_context);
+  Operator right_hash_join_8 = RightHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_3}, {x_1})
+                                   .RegisterWithTxnContext(txn_context);
+  Operator right_hash_join_9 = RightHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_3})
+                                   .RegisterWithTxnContext(txn_context);
 
   EXPECT_EQ(right_hash_join_1.GetOpType(), OpType::RIGHTHASHJOIN);
   EXPECT_EQ(right_hash_join_3.GetOpType(), OpType::RIGHTHASHJOIN);
   EXPECT_EQ(right_hash_join_1.GetName(), "RightHashJoin");
-  EXPECT_EQ(*(right_hash_join_1.GetContentsAs<RightHashJoin>()->GetJoinPredicate()), *x_1);
-  EXPECT_EQ(*(right_hash_join_2.GetContentsAs<RightHashJoin>()->GetJoinPredicate()), *x_2);
-  EXPECT_EQ(*(right_hash_join_3.GetContentsAs<RightHashJoin>()->GetJoinPredicate()), *x_3);
+  EXPECT_EQ(right_hash_join_1.GetContentsAs<RightHashJoin>()->GetJoinPredicates(), std::vector<AnnotatedExpression>());
+  EXPECT_EQ(right_hash_join_3.GetContentsAs<RightHashJoin>()->GetJoinPredicates(),
+            std::vector<AnnotatedExpression>{annotated_expr_0});
+  EXPECT_EQ(right_hash_join_4.GetContentsAs<RightHashJoin>()->GetJoinPredicates(),
+            std::vector<AnnotatedExpression>{annotated_expr_1});
+  EXPECT_EQ(right_hash_join_1.GetContentsAs<RightHashJoin>()->GetLeftKeys(),
+            std::vector<common::ManagedPointer<parser::AbstractExpression>>{x_1});
+  EXPECT_EQ(right_hash_join_9.GetContentsAs<RightHashJoin>()->GetRightKeys(),
+            std::vector<common::ManagedPointer<parser::AbstractExpression>>{x_3});
   EXPECT_TRUE(right_hash_join_1 == right_hash_join_2);
   EXPECT_FALSE(right_hash_join_1 == right_hash_join_3);
+  EXPECT_FALSE(right_hash_join_4 == right_hash_join_3);
+  EXPECT_TRUE(right_hash_join_4 == right_hash_join_5);
+  EXPECT_TRUE(right_hash_join_4 == right_hash_join_6);
+  EXPECT_FALSE(right_hash_join_4 == right_hash_join_7);
+  EXPECT_FALSE(right_hash_join_4 == right_hash_join_8);
+  EXPECT_FALSE(right_hash_join_4 == right_hash_join_9);
   EXPECT_EQ(right_hash_join_1.Hash(), right_hash_join_2.Hash());
   EXPECT_NE(right_hash_join_1.Hash(), right_hash_join_3.Hash());
+  EXPECT_NE(right_hash_join_4.Hash(), right_hash_join_3.Hash());
+  EXPECT_EQ(right_hash_join_4.Hash(), right_hash_join_5.Hash());
+  EXPECT_EQ(right_hash_join_4.Hash(), right_hash_join_6.Hash());
+  EXPECT_NE(right_hash_join_4.Hash(), right_hash_join_7.Hash());
+  EXPECT_NE(right_hash_join_4.Hash(), right_hash_join_8.Hash());
+  EXPECT_NE(right_hash_join_4.Hash(), right_hash_join_9.Hash());
 
   delete expr_b_1;
   delete expr_b_2;
@@ -1005,20 +1044,59 @@ TEST(OperatorTests, OuterHashJoinTest) {
   auto x_2 = common::ManagedPointer<parser::AbstractExpression>(expr_b_2);
   auto x_3 = common::ManagedPointer<parser::AbstractExpression>(expr_b_3);
 
-  Operator outer_hash_join_1 = OuterHashJoin::Make(x_1).RegisterWithTxnContext(txn_context);
-  Operator outer_hash_join_2 = OuterHashJoin::Make(x_2).RegisterWithTxnContext(txn_context);
-  Operator outer_hash_join_3 = OuterHashJoin::Make(x_3).RegisterWithTxnContext(txn_context);
+  auto annotated_expr_0 =
+      AnnotatedExpression(common::ManagedPointer<parser::AbstractExpression>(), std::unordered_set<std::string>());
+  auto annotated_expr_1 = AnnotatedExpression(x_1, std::unordered_set<std::string>());
+  auto annotated_expr_2 = AnnotatedExpression(x_2, std::unordered_set<std::string>());
+  auto annotated_expr_3 = AnnotatedExpression(x_3, std::unordered_set<std::string>());
+
+  Operator outer_hash_join_1 =
+      OuterHashJoin::Make(std::vector<AnnotatedExpression>(), {x_1}, {x_1}).RegisterWithTxnContext(txn_context);
+  Operator outer_hash_join_2 =
+      OuterHashJoin::Make(std::vector<AnnotatedExpression>(), {x_1}, {x_1}).RegisterWithTxnContext(txn_context);
+  Operator outer_hash_join_3 = OuterHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_0}, {x_1}, {x_1})
+                                   .RegisterWithTxnContext(txn_context);
+  Operator outer_hash_join_4 = OuterHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_1})
+                                   .RegisterWithTxnContext(txn_context);
+  Operator outer_hash_join_5 = OuterHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_2}, {x_2}, {x_1})
+                                   .RegisterWithTxnContext(txn_context);
+  Operator outer_hash_join_6 = OuterHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_2})
+                                   .RegisterWithTxnContext(txn_context);
+  Operator outer_hash_join_7 = OuterHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_3}, {x_1}, {x_1})
+                                   .RegisterWithTxnContext(txn_context);
+  Operator outer_hash_join_8 = OuterHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_3}, {x_1})
+                                   .RegisterWithTxnContext(txn_context);
+  Operator outer_hash_join_9 = OuterHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_3})
+                                   .RegisterWithTxnContext(txn_context);
 
   EXPECT_EQ(outer_hash_join_1.GetOpType(), OpType::OUTERHASHJOIN);
   EXPECT_EQ(outer_hash_join_3.GetOpType(), OpType::OUTERHASHJOIN);
   EXPECT_EQ(outer_hash_join_1.GetName(), "OuterHashJoin");
-  EXPECT_EQ(*(outer_hash_join_1.GetContentsAs<OuterHashJoin>()->GetJoinPredicate()), *x_1);
-  EXPECT_EQ(*(outer_hash_join_2.GetContentsAs<OuterHashJoin>()->GetJoinPredicate()), *x_2);
-  EXPECT_EQ(*(outer_hash_join_3.GetContentsAs<OuterHashJoin>()->GetJoinPredicate()), *x_3);
+  EXPECT_EQ(outer_hash_join_1.GetContentsAs<OuterHashJoin>()->GetJoinPredicates(), std::vector<AnnotatedExpression>());
+  EXPECT_EQ(outer_hash_join_3.GetContentsAs<OuterHashJoin>()->GetJoinPredicates(),
+            std::vector<AnnotatedExpression>{annotated_expr_0});
+  EXPECT_EQ(outer_hash_join_4.GetContentsAs<OuterHashJoin>()->GetJoinPredicates(),
+            std::vector<AnnotatedExpression>{annotated_expr_1});
+  EXPECT_EQ(outer_hash_join_1.GetContentsAs<OuterHashJoin>()->GetLeftKeys(),
+            std::vector<common::ManagedPointer<parser::AbstractExpression>>{x_1});
+  EXPECT_EQ(outer_hash_join_9.GetContentsAs<OuterHashJoin>()->GetRightKeys(),
+            std::vector<common::ManagedPointer<parser::AbstractExpression>>{x_3});
   EXPECT_TRUE(outer_hash_join_1 == outer_hash_join_2);
   EXPECT_FALSE(outer_hash_join_1 == outer_hash_join_3);
+  EXPECT_FALSE(outer_hash_join_4 == outer_hash_join_3);
+  EXPECT_TRUE(outer_hash_join_4 == outer_hash_join_5);
+  EXPECT_TRUE(outer_hash_join_4 == outer_hash_join_6);
+  EXPECT_FALSE(outer_hash_join_4 == outer_hash_join_7);
+  EXPECT_FALSE(outer_hash_join_4 == outer_hash_join_8);
+  EXPECT_FALSE(outer_hash_join_4 == outer_hash_join_9);
   EXPECT_EQ(outer_hash_join_1.Hash(), outer_hash_join_2.Hash());
   EXPECT_NE(outer_hash_join_1.Hash(), outer_hash_join_3.Hash());
+  EXPECT_NE(outer_hash_join_4.Hash(), outer_hash_join_3.Hash());
+  EXPECT_EQ(outer_hash_join_4.Hash(), outer_hash_join_5.Hash());
+  EXPECT_EQ(outer_hash_join_4.Hash(), outer_hash_join_6.Hash());
+  EXPECT_NE(outer_hash_join_4.Hash(), outer_hash_join_7.Hash());
+  EXPECT_NE(outer_hash_join_4.Hash(), outer_hash_join_8.Hash());
+  EXPECT_NE(outer_hash_join_4.Hash(), outer_hash_join_9.Hash());
 
   delete expr_b_1;
   delete expr_b_2;
@@ -14,6 +14,7 @@
 #include "parser/expression/function_expression.h"
 #include "parser/expression/operator_expression.h"
 #include "parser/expression/type_cast_expression.h"
+#include "parser/expression/window_expression.h"
 #include "parser/pg_trigger.h"
 #include "parser/postgresparser.h"
 #include "parser/statements.h"
@@ -215,6 +216,36 @@ TEST_F(ParserTestBase, CreateIndexTest) {
   EXPECT_EQ(ia2r->GetColumnName(), "o");
 }
 
+// NOLINTNEXTLINE
+TEST_F(ParserTestBase, CreatePartialIndexTest) {
+  std::string query = "CREATE INDEX pending_idx ON queue (id) WHERE status = 'PENDING' AND priority > 2;";
+  auto result = parser::PostgresParser::BuildParseTree(query);
+  auto create_stmt = result->GetStatement(0).CastManagedPointerTo<CreateStatement>();
+
+  EXPECT_EQ(create_stmt->GetCreateType(), CreateStatement::kIndex);
+  EXPECT_EQ(create_stmt->GetIndexName(), "pending_idx");
+  EXPECT_EQ(create_stmt->GetTableName(), "queue");
+  EXPECT_EQ(create_stmt->GetIndexAttributes().size(), 1);
+  EXPECT_EQ(create_stmt->GetIndexAttributes()[0].GetName(), "id");
+
+  auto predicate = create_stmt->GetIndexPredicate();
+  ASSERT_NE(predicate, nullptr);
+  EXPECT_EQ(predicate->GetExpressionType(), ExpressionType::CONJUNCTION_AND);
+  auto status = predicate->GetChild(0);
+  EXPECT_EQ(status->GetExpressionType(), ExpressionType::COMPARE_EQUAL);
+  EXPECT_EQ(status->GetChild(0).CastManagedPointerTo<ColumnValueExpression>()->GetColumnName(), "status");
+  EXPECT_EQ(status->GetChild(1).CastManagedPointerTo<ConstantValueExpression>()->Peek<std::string_view>(), "PENDING");
+  auto priority = predicate->GetChild(1);
+  EXPECT_EQ(priority->GetExpressionType(), ExpressionType::COMPARE_GREATER_THAN);
+  EXPECT_EQ(priority->GetChild(0).CastManagedPointerTo<ColumnValueExpression>()->GetColumnName(), "priority");
+  EXPECT_EQ(priority->GetChild(1).CastManagedPointerTo<ConstantValueExpression>()->Peek<int64_t>(), 2);
+
+  query = "CREATE INDEX ii ON t (col);";
+  result = parser::PostgresParser::BuildParseTree(query);
+  create_stmt = result->GetStatement(0).CastManagedPointerTo<CreateStatement>();
+  EXPECT_EQ(create_stmt->GetIndexPredicate(), nullptr);
+}
+
 // NOLINTNEXTLINE
 TEST_F(ParserTestBase, CreateTableTest) {
   std::string query =
@@ -416,6 +447,38 @@ TEST_F(ParserTestBase, SelectUnionTest) {
   auto result = parser::PostgresParser::BuildParseTree("SELECT * FROM foo UNION SELECT * FROM bar;");
   EXPECT_EQ(result->GetStatements().size(), 1);
   EXPECT_EQ(result->GetStatement(0)->GetType(), StatementType::SELECT);
+  auto select_stmt = result->GetStatement(0).CastManagedPointerTo<SelectStatement>();
+  EXPECT_EQ(select_stmt->GetSetOpType(), SetOperationType::UNION);
+  EXPECT_FALSE(select_stmt->IsSetOpAll());
+  EXPECT_EQ(select_stmt->GetSetOpSelect()->GetSelectTable()->GetTableName(), "bar");
+}
+
+// NOLINTNEXTLINE
+TEST_F(ParserTestBase, SelectSetOpTest) {
+  // A chain of the same operation is stored right-deep: foo, then bar, then baz
+  auto result = parser::PostgresParser::BuildParseTree(
+      "SELECT id FROM foo INTERSECT ALL SELECT id FROM bar INTERSECT ALL SELECT id FROM baz;");
+  auto select_stmt = result->GetStatement(0).CastManagedPointerTo<SelectStatement>();
+  EXPECT_EQ(select_stmt->GetSelectTable()->GetTableName(), "foo");
+  EXPECT_EQ(select_stmt->GetSetOpType(), SetOperationType::INTERSECT);
+  EXPECT_TRUE(select_stmt->IsSetOpAll());
+  auto right = select_stmt->GetSetOpSelect();
+  EXPECT_EQ(right->GetSelectTable()->GetTableName(), "bar");
+  EXPECT_EQ(right->GetSetOpType(), SetOperationType::INTERSECT);
+  EXPECT_EQ(right->GetSetOpSelect()->GetSelectTable()->GetTableName(), "baz");
+  EXPECT_EQ(right->GetSetOpSelect()->GetSetOpSelect(), nullptr);
+
+  result = parser::PostgresParser::BuildParseTree("SELECT id FROM foo EXCEPT SELECT id FROM bar;");
+  select_stmt = result->GetStatement(0).CastManagedPointerTo<SelectStatement>();
+  EXPECT_EQ(select_stmt->GetSetOpType(), SetOperationType::EXCEPT);
+  EXPECT_FALSE(select_stmt->IsSetOpAll());
+
+  // EXCEPT is not associative, and ORDER BY of the whole result is not supported
+  EXPECT_THROW(
+      parser::PostgresParser::BuildParseTree("SELECT id FROM foo EXCEPT SELECT id FROM bar EXCEPT SELECT id FROM baz;"),
+      NotImplementedException);
+  EXPECT_THROW(parser::PostgresParser::BuildParseTree("SELECT id FROM foo UNION SELECT id FROM bar ORDER BY id;"),
+               NotImplementedException);
 }
 
 // NOLINTNEXTLINE
@@ -728,6 +791,63 @@ TEST_F(ParserTestBase, OldAggTest) {
   }
 }
 
+// NOLINTNEXTLINE
+TEST_F(ParserTestBase, WindowFunctionTest) {
+  std::string query;
+
+  {
+    query = "SELECT id, RANK() OVER (PARTITION BY name ORDER BY id DESC) FROM foo;";
+    auto result = parser::PostgresParser::BuildParseTree(query);
+    auto statement = result->GetStatement(0).CastManagedPointerTo<SelectStatement>();
+    EXPECT_EQ(ExpressionType::WINDOW_FUNCTION, statement->GetSelectColumns()[1]->GetExpressionType());
+
+    auto window_expr = statement->GetSelectColumns()[1].CastManagedPointerTo<WindowExpression>();
+    EXPECT_EQ(planner::WindowFunctionType::RANK, window_expr->GetFunctionType());
+    EXPECT_TRUE(window_expr->GetArgument() == nullptr);
+    ASSERT_EQ(1, window_expr->GetPartitionByKeys().size());
+    auto part_key = window_expr->GetPartitionByKeys()[0].CastManagedPointerTo<ColumnValueExpression>();
+    EXPECT_EQ("name", part_key->GetColumnName());
+    ASSERT_EQ(1, window_expr->GetSortKeys().size());
+    EXPECT_EQ("id", window_expr->GetSortKeys()[0].CastManagedPointerTo<ColumnValueExpression>()->GetColumnName());
+    EXPECT_EQ(optimizer::OrderByOrderingType::DESC, window_expr->GetSortOrders()[0]);
+  }
+
+  {
+    query = "SELECT SUM(id) OVER (ORDER BY id ROWS BETWEEN 2 PRECEDING AND 1 FOLLOWING) FROM foo;";
+    auto result = parser::PostgresParser::BuildParseTree(query);
+    auto statement = result->GetStatement(0).CastManagedPointerTo<SelectStatement>();
+    auto window_expr = statement->GetSelectColumns()[0].CastManagedPointerTo<WindowExpression>();
+    EXPECT_EQ(planner::WindowFunctionType::SUM, window_expr->GetFunctionType());
+    EXPECT_EQ("id", window_expr->GetArgument().CastManagedPointerTo<ColumnValueExpression>()->GetColumnName());
+    EXPECT_TRUE(window_expr->GetPartitionByKeys().empty());
+    EXPECT_FALSE(window_expr->IsStartUnbounded());
+    EXPECT_EQ(2, window_expr->GetStartPreceding());
+    EXPECT_FALSE(window_expr->IsEndUnbounded());
+    EXPECT_EQ(1, window_expr->GetEndFollowing());
+  }
+
+  {
+    // Without ORDER BY, the default frame is the whole partition.
+    query = "SELECT COUNT(*) OVER (PARTITION BY name) FROM foo;";
+    auto result = parser::PostgresParser::BuildParseTree(query);
+    auto statement = result->GetStatement(0).CastManagedPointerTo<SelectStatement>();
+    auto window_expr = statement->GetSelectColumns()[0].CastManagedPointerTo<WindowExpression>();
+    EXPECT_EQ(planner::WindowFunctionType::COUNT_STAR, window_expr->GetFunctionType());
+    EXPECT_TRUE(window_expr->IsStartUnbounded());
+    EXPECT_TRUE(window_expr->IsEndUnbounded());
+  }
+
+  // With ORDER BY, the default frame ends at the peers of the current row, which isn't supported.
+  EXPECT_THROW(parser::PostgresParser::BuildParseTree("SELECT SUM(id) OVER (ORDER BY id) FROM foo;"),
+               NotImplementedException);
+  EXPECT_THROW(parser::PostgresParser::BuildParseTree("SELECT SUM(id) OVER w FROM foo WINDOW w AS (ORDER BY id);"),
+               NotImplementedException);
+  EXPECT_THROW(parser::PostgresParser::BuildParseTree("SELECT LAG(id) OVER (ORDER BY id) FROM foo;"),
+               NotImplementedException);
+  EXPECT_THROW(parser::PostgresParser::BuildParseTree("SELECT ROW_NUMBER(id) OVER (ORDER BY id) FROM foo;"),
+               ParserException);
+}
+
 // NOLINTNEXTLINE
 TEST_F(ParserTestBase, OldGroupByTest) {
   // Select with group by clause
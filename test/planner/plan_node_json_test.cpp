@@ -41,6 +41,7 @@
 #include "planner/plannodes/seq_scan_plan_node.h"
 #include "planner/plannodes/set_op_plan_node.h"
 #include "planner/plannodes/update_plan_node.h"
+#include "planner/plannodes/window_plan_node.h"
 #include "test_util/storage_test_util.h"
 #include "test_util/test_harness.h"
 #include "type/type_id.h"
@@ -900,4 +901,44 @@ TEST(PlanNodeJsonTest, UpdatePlanNodeJsonTest) {
   EXPECT_EQ(plan_node->Hash(), deserialized_plan->Hash());
 }
 
+// NOLINTNEXTLINE
+TEST(PlanNodeJsonTest, WindowPlanNodeJsonTest) {
+  // Construct WindowPlanNode
+  WindowPlanNode::Builder builder;
+  parser::AbstractExpression *partition_key = new parser::DerivedValueExpression(type::TypeId::INTEGER, 0, 0);
+  parser::AbstractExpression *sort_key = new parser::DerivedValueExpression(type::TypeId::INTEGER, 0, 1);
+  parser::AbstractExpression *argument = new parser::DerivedValueExpression(type::TypeId::INTEGER, 0, 1);
+
+  WindowFunction rank;
+  rank.type_ = WindowFunctionType::RANK;
+  WindowFunction sum;
+  sum.type_ = WindowFunctionType::SUM;
+  sum.argument_ = common::ManagedPointer(argument);
+  sum.end_unbounded_ = false;
+  sum.end_following_ = 2;
+
+  auto plan_node = builder.SetOutputSchema(PlanNodeJsonTest::BuildDummyOutputSchema())
+                       .AddPartitionByKey(common::ManagedPointer(partition_key))
+                       .AddSortKey(common::ManagedPointer(sort_key), optimizer::OrderByOrderingType::DESC)
+                       .AddWindowFunction(rank)
+                       .AddWindowFunction(sum)
+                       .Build();
+
+  // Serialize to Json
+  auto json = plan_node->ToJson();
+  EXPECT_FALSE(json.is_null());
+
+  // Deserialize plan node
+  auto deserialized = DeserializePlanNode(json);
+  auto deserialized_plan = common::ManagedPointer(deserialized.result_).CastManagedPointerTo<WindowPlanNode>();
+  EXPECT_TRUE(deserialized_plan != nullptr);
+  EXPECT_EQ(PlanNodeType::WINDOW, deserialized_plan->GetPlanNodeType());
+  EXPECT_EQ(*plan_node, *deserialized_plan);
+  EXPECT_EQ(plan_node->Hash(), deserialized_plan->Hash());
+
+  delete partition_key;
+  delete sort_key;
+  delete argument;
+}
+
 }  // namespace noisepage::planner
@@ -0,0 +1,115 @@
+#include "replication/replication_messages.h"
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/error/exception.h"
+#include "gtest/gtest.h"
+#include "storage/recovery/replication_log_provider.h"
+#include "storage/write_ahead_log/log_io.h"
+#include "storage/write_ahead_log/log_record.h"
+#include "test_util/test_harness.h"
+
+namespace noisepage::replication {
+
+class ReplicationMessagesTests : public TerrierTest {
+ protected:
+  /** Serialize a commit record the way that the log serializer does. */
+  static void AppendCommitRecord(storage::BufferedLogWriter *buffer, const transaction::timestamp_t txn_begin) {
+    const uint32_t size = storage::CommitRecord::Size();
+    const auto type = storage::LogRecordType::COMMIT;
+    const transaction::timestamp_t commit_time{txn_begin.UnderlyingValue() + 1};
+    buffer->BufferWrite(&size, sizeof(size));
+    buffer->BufferWrite(&type, sizeof(type));
+    buffer->BufferWrite(&txn_begin, sizeof(txn_begin));
+    buffer->BufferWrite(&commit_time, sizeof(commit_time));
+    buffer->BufferWrite(&txn_begin, sizeof(txn_begin));
+  }
+
+  /** @return a received copy of the given message */
+  template <typename Msg>
+  static std::unique_ptr<Msg> RoundTrip(const Msg &msg) {
+    auto parsed = BaseReplicationMessage::ParseFromString(msg.Serialize());
+    EXPECT_EQ(msg.GetMessageType(), parsed->GetMessageType());
+    EXPECT_EQ(msg.GetMessageId(), parsed->GetMessageId());
+    return std::unique_ptr<Msg>(static_cast<Msg *>(parsed.release()));
+  }
+};
+
+// Every message type survives serialization.
+// NOLINTNEXTLINE
+TEST_F(ReplicationMessagesTests, RoundTripTest) {
+  auto oat = RoundTrip(NotifyOATMsg(ReplicationMessageMetadata(msg_id_t(1)), record_batch_id_t(42),
+                                    transaction::timestamp_t(999)));
+  EXPECT_EQ(record_batch_id_t(42), oat->GetBatchId());
+  EXPECT_EQ(transaction::timestamp_t(999), oat->GetOldestActiveTxn());
+
+  auto ack = RoundTrip(RecordsBatchAckMsg(ReplicationMessageMetadata(msg_id_t(2)), record_batch_id_t(7)));
+  EXPECT_EQ(record_batch_id_t(7), ack->GetReceivedBatchId());
+
+  auto applied = RoundTrip(TxnAppliedMsg(ReplicationMessageMetadata(msg_id_t(3)), transaction::timestamp_t(5)));
+  EXPECT_EQ(transaction::timestamp_t(5), applied->GetAppliedTxnId());
+
+  // Compressible and incompressible contents, with and without compression, which may fall back to raw contents.
+  for (const bool compress : {false, true}) {
+    for (const bool random : {false, true}) {
+      storage::BufferedLogWriter buffer;
+      std::vector<char> contents(common::Constants::LOG_BUFFER_SIZE);
+      for (size_t i = 0; i < contents.size(); i++) {
+        contents[i] = static_cast<char>(random ? std::rand() : i / 64);  // NOLINT
+      }
+      buffer.BufferWrite(contents.data(), static_cast<uint32_t>(contents.size()));
+
+      RecordsBatchMsg msg(ReplicationMessageMetadata(msg_id_t(4)), record_batch_id_t(8), &buffer, compress, random);
+      const std::string serialized = msg.Serialize();
+      auto batch = RoundTrip(msg);
+      EXPECT_EQ(record_batch_id_t(8), batch->GetBatchId());
+      EXPECT_EQ(random, batch->IsAckRequested());
+      EXPECT_EQ(std::string_view(contents.data(), contents.size()), batch->GetContents());
+      // Uncompressed batches only add a fixed size header to the log records.
+      if (!compress) {
+        EXPECT_LT(serialized.size(), contents.size() + 32);
+      }
+    }
+  }
+}
+
+// Messages that were cut short are rejected instead of being read past their end.
+// NOLINTNEXTLINE
+TEST_F(ReplicationMessagesTests, TruncatedMessageTest) {
+  storage::BufferedLogWriter buffer;
+  AppendCommitRecord(&buffer, transaction::timestamp_t(1));
+  const std::string serialized =
+      RecordsBatchMsg(ReplicationMessageMetadata(msg_id_t(1)), record_batch_id_t(1), &buffer).Serialize();
+  EXPECT_THROW(BaseReplicationMessage::ParseFromString(std::string_view(serialized).substr(0, serialized.size() - 1)),
+               ReplicationException);
+  EXPECT_THROW(BaseReplicationMessage::ParseFromString(std::string_view(serialized).substr(0, 4)),
+               ReplicationException);
+}
+
+// The log provider reads received batches in batch order, without regard to the order in which they arrived.
+// NOLINTNEXTLINE
+TEST_F(ReplicationMessagesTests, OutOfOrderBatchesTest) {
+  storage::ReplicationLogProvider provider;
+  for (const uint64_t batch_id : {2, 1, 3}) {
+    storage::BufferedLogWriter buffer;
+    AppendCommitRecord(&buffer, transaction::timestamp_t(10 * batch_id));
+    AppendCommitRecord(&buffer, transaction::timestamp_t(10 * batch_id + 1));
+    RecordsBatchMsg msg(ReplicationMessageMetadata(msg_id_t(batch_id)), record_batch_id_t(batch_id), &buffer, true);
+    auto received = BaseReplicationMessage::ParseFromString(msg.Serialize());
+    provider.AddBatchOfRecords(std::move(*static_cast<RecordsBatchMsg *>(received.get())));
+    }
+
+  for (const uint64_t txn_begin : {10, 11, 20, 21, 30, 31}) {
+    auto record = provider.GetNextRecord();
+    ASSERT_NE(nullptr, record.first);
+    EXPECT_EQ(storage::LogRecordType::COMMIT, record.first->RecordType());
+    EXPECT_EQ(transaction::timestamp_t(txn_begin), record.first->TxnBegin());
+    delete[] reinterpret_cast<byte *>(record.first);
+  }
+  provider.EndReplication();
+}
+
+}  // namespace noisepage::replication
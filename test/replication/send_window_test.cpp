@@ -0,0 +1,79 @@
+#include "replication/send_window.h"
+
+#include <chrono>  // NOLINT
+#include <thread>  // NOLINT
+
+#include "gtest/gtest.h"
+#include "test_util/test_harness.h"
+
+namespace noisepage::replication {
+
+class SendWindowTests : public TerrierTest {};
+
+/** A batch within the window of every replica is sent right away. */
+// NOLINTNEXTLINE
+TEST_F(SendWindowTests, WithinWindowTest) {
+  SendWindow window({"replica1", "replica2"}, 2, std::chrono::hours(1));
+  window.WaitToSend(record_batch_id_t(1));
+  window.WaitToSend(record_batch_id_t(2));
+  window.Acknowledge("replica1", record_batch_id_t(2));
+  window.Acknowledge("replica2", record_batch_id_t(1));
+  window.WaitToSend(record_batch_id_t(3));
+  EXPECT_FALSE(window.IsLagging("replica1"));
+  EXPECT_FALSE(window.IsLagging("replica2"));
+}
+
+/** The sender waits until a replica acknowledges enough batches. */
+// NOLINTNEXTLINE
+TEST_F(SendWindowTests, AcknowledgementReleasesSenderTest) {
+  SendWindow window({"replica1"}, 1, std::chrono::hours(1));
+  window.WaitToSend(record_batch_id_t(1));
+
+  std::thread acker([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    window.Acknowledge("replica1", record_batch_id_t(1));
+  });
+  window.WaitToSend(record_batch_id_t(2));
+  acker.join();
+  EXPECT_FALSE(window.IsLagging("replica1"));
+}
+
+/** A replica that never acknowledges anything can't stall the sender, and rejoins the window once it catches up. */
+// NOLINTNEXTLINE
+TEST_F(SendWindowTests, ReplicaNeverAcksTest) {
+  const auto timeout = std::chrono::milliseconds(50);
+  SendWindow window({"live", "dead"}, 2, timeout);
+
+  // The first batches are within the window of both replicas.
+  window.WaitToSend(record_batch_id_t(1));
+  window.WaitToSend(record_batch_id_t(2));
+  window.Acknowledge("live", record_batch_id_t(2));
+
+  // The dead replica is out of its window, so the sender waits for it until the timeout expires.
+  auto start = std::chrono::steady_clock::now();
+  window.WaitToSend(record_batch_id_t(3));
+  EXPECT_GE(std::chrono::steady_clock::now() - start, timeout);
+  EXPECT_TRUE(window.IsLagging("dead"));
+  EXPECT_FALSE(window.IsLagging("live"));
+
+  // The dead replica is not waited for anymore, as long as the live one keeps up.
+  start = std::chrono::steady_clock::now();
+  for (uint64_t batch = 4; batch <= 100; batch++) {
+    window.Acknowledge("live", record_batch_id_t(batch - 1));
+    window.WaitToSend(record_batch_id_t(batch));
+  }
+  EXPECT_LT(std::chrono::steady_clock::now() - start, timeout * 10);
+
+  // Falling behind is still detected for the live replica.
+  window.WaitToSend(record_batch_id_t(101));
+  window.WaitToSend(record_batch_id_t(102));
+  EXPECT_TRUE(window.IsLagging("live"));
+
+  // Both replicas catch up with the newest batch and are waited for again.
+  window.Acknowledge("live", record_batch_id_t(102));
+  window.Acknowledge("dead", record_batch_id_t(100));
+  EXPECT_FALSE(window.IsLagging("live"));
+  EXPECT_FALSE(window.IsLagging("dead"));
+}
+
+}  // namespace noisepage::replication
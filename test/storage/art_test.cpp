@@ -0,0 +1,285 @@
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "portable_endian/portable_endian.h"
+#include "storage/index/art.h"
+#include "test_util/multithread_test_util.h"
+#include "test_util/test_harness.h"
+
+namespace noisepage::storage::index {
+
+/**
+ * Integer key in the same binary-comparable form as CompactIntsKey, so that the tree can be tested on its own.
+ */
+struct ArtIntKey {
+  static constexpr uint16_t BINARY_COMPARABLE_SIZE = sizeof(int64_t);
+
+  uint16_t ToBinaryComparable(byte *const buffer) const {
+    const uint64_t big_endian = htobe64(static_cast<uint64_t>(value_) ^ (uint64_t{1} << 63U));
+    std::memcpy(buffer, &big_endian, sizeof(big_endian));
+    return sizeof(big_endian);
+  }
+
+  int64_t value_;
+};
+
+/**
+ * String key in the same binary-comparable form as a VARCHAR attribute of GenericKey, whose keys have different
+ * lengths and can share long prefixes.
+ */
+struct ArtStringKey {
+  static constexpr uint16_t BINARY_COMPARABLE_SIZE = 256;
+
+  uint16_t ToBinaryComparable(byte *const buffer) const {
+    uint16_t size = 0;
+    for (const char c : value_) {
+      buffer[size++] = static_cast<byte>(c);
+      if (c == '\0') buffer[size++] = static_cast<byte>(0xFF);
+    }
+    buffer[size++] = static_cast<byte>(0);
+    buffer[size++] = static_cast<byte>(0);
+    return size;
+  }
+
+  std::string value_;
+};
+
+class ArtTests : public TerrierTest {
+ public:
+  const uint32_t num_threads_ = 4;
+  common::WorkerPool thread_pool_{num_threads_, {}};
+
+  static bool NoPredicate(const int64_t /*unused*/) { return false; }
+
+  /** @return all keys of the tree in scan order, starting at start_key */
+  template <typename KeyType, typename CType>
+  static std::vector<CType> ScanKeys(AdaptiveRadixTree<KeyType, int64_t> *const tree, const KeyType *const start_key,
+                                     const bool ascending) {
+    std::vector<CType> keys;
+    tree->Scan(start_key, ascending, [&](const KeyType &key, const std::vector<int64_t> &values) {
+      EXPECT_FALSE(values.empty());
+      keys.push_back(key.value_);
+      return true;
+    });
+    return keys;
+  }
+
+ protected:
+  void SetUp() override { thread_pool_.Startup(); }
+
+  void TearDown() override { thread_pool_.Shutdown(); }
+};
+
+// Random inserts, lookups and deletes agree with std::multimap, including keys with several values.
+// NOLINTNEXTLINE
+TEST_F(ArtTests, RandomOperationsTest) {
+  AdaptiveRadixTree<ArtIntKey, int64_t> tree;
+  std::map<int64_t, std::vector<int64_t>> reference;
+  std::default_random_engine generator(15721);
+  // Mostly small keys, so that keys share prefixes and nodes fill up, and some sparse ones of either sign.
+  std::uniform_int_distribution<int64_t> dense_keys(0, 5000);
+  std::uniform_int_distribution<int64_t> sparse_keys(INT64_MIN, INT64_MAX);
+  std::uniform_int_distribution<int64_t> values(0, 3);
+
+  for (uint32_t i = 0; i < 200000; i++) {
+    const int64_t key = i % 10 == 0 ? sparse_keys(generator) : dense_keys(generator);
+    const int64_t value = values(generator);
+    auto &expected = reference[key];
+    const bool present = std::find(expected.begin(), expected.end(), value) != expected.end();
+
+    if (i % 3 == 0) {
+      EXPECT_EQ(present, tree.Delete({key}, value));
+      if (present) expected.erase(std::find(expected.begin(), expected.end(), value));
+    } else {
+      EXPECT_EQ(!present, tree.Insert({key}, value, NoPredicate));
+      if (!present) expected.push_back(value);
+    }
+    if (expected.empty()) reference.erase(key);
+
+    std::vector<int64_t> results;
+    tree.FindValues({key}, &results);
+    EXPECT_EQ(reference.count(key) == 0 ? std::vector<int64_t>{} : reference[key], results);
+  }
+  EXPECT_EQ(reference.size(), tree.GetSize());
+
+  std::vector<int64_t> expected_keys;
+  for (const auto &entry : reference) expected_keys.push_back(entry.first);
+  EXPECT_EQ(expected_keys, (ScanKeys<ArtIntKey, int64_t>(&tree, nullptr, true)));
+
+  // Emptying the tree shrinks every node away again.
+  for (const auto &entry : reference) {
+    for (const auto value : entry.second) EXPECT_TRUE(tree.Delete({entry.first}, value));
+  }
+  EXPECT_EQ(0, tree.GetSize());
+  EXPECT_TRUE((ScanKeys<ArtIntKey, int64_t>(&tree, nullptr, true).empty()));
+  tree.PerformGarbageCollection();
+}
+
+// A key does not get a value that it already has, or any value if the predicate holds for one of its values.
+// NOLINTNEXTLINE
+TEST_F(ArtTests, UniqueInsertTest) {
+  AdaptiveRadixTree<ArtIntKey, int64_t> tree;
+  auto predicate = [](const int64_t value) { return value > 0; };
+  EXPECT_TRUE(tree.Insert({42}, 0, predicate));
+  EXPECT_FALSE(tree.Insert({42}, 0, predicate));
+  EXPECT_TRUE(tree.Insert({42}, 1, predicate));
+  EXPECT_FALSE(tree.Insert({42}, 2, predicate));
+
+  std::vector<int64_t> results;
+  tree.FindValues({42}, &results);
+  EXPECT_EQ((std::vector<int64_t>{0, 1}), results);
+  EXPECT_EQ(1, tree.GetSize());
+}
+
+// Scans start at the given key, or at the next one if it is not present, and visit keys in order in both directions.
+// NOLINTNEXTLINE
+TEST_F(ArtTests, ScanTest) {
+  AdaptiveRadixTree<ArtStringKey, int64_t> tree;
+  std::vector<std::string> keys;
+  // Long shared prefixes, keys that are prefixes of other keys, and embedded NUL characters.
+  for (const std::string &stem : {std::string("customer"), std::string("customer_address_"), std::string("a\0b", 3),
+                                  std::string("a"), std::string()}) {
+    for (int i = 0; i < 300; i += 7) keys.push_back(stem + std::to_string(i));
+    keys.push_back(stem);
+  }
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+  std::vector<std::string> shuffled = keys;
+  std::shuffle(shuffled.begin(), shuffled.end(), std::default_random_engine(15445));
+  for (const auto &key : shuffled) EXPECT_TRUE(tree.Insert({key}, 0, NoPredicate));
+  EXPECT_EQ(keys.size(), tree.GetSize());
+
+  EXPECT_EQ(keys, (ScanKeys<ArtStringKey, std::string>(&tree, nullptr, true)));
+  std::vector<std::string> reversed(keys.rbegin(), keys.rend());
+  EXPECT_EQ(reversed, (ScanKeys<ArtStringKey, std::string>(&tree, nullptr, false)));
+
+  for (const std::string &start : {std::string("customer1"), std::string("customer_address_14"), std::string("b"),
+                                   std::string("a\0", 2), std::string()}) {
+    const ArtStringKey start_key{start};
+    const std::vector<std::string> ascending(std::lower_bound(keys.begin(), keys.end(), start), keys.end());
+    EXPECT_EQ(ascending, (ScanKeys<ArtStringKey, std::string>(&tree, &start_key, true)));
+    const auto descending_begin = std::make_reverse_iterator(std::upper_bound(keys.begin(), keys.end(), start));
+    const std::vector<std::string> descending(descending_begin, keys.rend());
+    EXPECT_EQ(descending, (ScanKeys<ArtStringKey, std::string>(&tree, &start_key, false)));
+  }
+
+  // Deleting collapses the nodes of the shared prefixes.
+  for (const auto &key : shuffled) {
+    if (key.size() % 2 == 0) EXPECT_TRUE(tree.Delete({key}, 0));
+  }
+  std::vector<std::string> remaining;
+  std::copy_if(keys.begin(), keys.end(), std::back_inserter(remaining),
+               [](const std::string &key) { return key.size() % 2 != 0; });
+  EXPECT_EQ(remaining, (ScanKeys<ArtStringKey, std::string>(&tree, nullptr, true)));
+}
+
+// Batched lookups find the same values as lookups of one key at a time, for present, duplicate and missing keys.
+// NOLINTNEXTLINE
+TEST_F(ArtTests, BatchLookupTest) {
+  AdaptiveRadixTree<ArtStringKey, int64_t> tree;
+  std::default_random_engine generator;
+  std::uniform_int_distribution<int64_t> distribution(0, 20 * 1000);
+  // Keys share long prefixes, so that lookups go through nodes with prefixes and end at leaves of different depths
+  auto make_key = [](const int64_t i) { return ArtStringKey{"key_" + std::to_string(i) + std::string(i % 3, 'x')}; };
+  for (int i = 0; i < 10 * 1000; i++) {
+    const int64_t i_key = distribution(generator);
+    tree.Insert(make_key(i_key), i_key, NoPredicate);
+    if (i_key % 10 == 0) tree.Insert(make_key(i_key), -i_key, NoPredicate);
+  }
+
+  // The batch size is not a multiple of the number of lookups that are interleaved
+  std::vector<ArtStringKey> keys;
+  for (int i = 0; i < 1000 + 7; i++) keys.push_back(make_key(distribution(generator)));
+  keys.push_back({"key_"});
+  keys.push_back({"key_1234567890"});
+  std::vector<std::vector<int64_t>> batch_results(keys.size());
+  tree.FindValuesBatch(keys.data(), static_cast<uint32_t>(keys.size()), batch_results.data());
+  for (uint32_t i = 0; i < keys.size(); i++) {
+    std::vector<int64_t> results;
+    tree.FindValues(keys[i], &results);
+    EXPECT_EQ(results, batch_results[i]);
+  }
+}
+
+// Lookups and scans run without latches while writers keep growing, shrinking and collapsing the nodes that they read.
+// NOLINTNEXTLINE
+TEST_F(ArtTests, MultiThreadedOptimisticReadTest) {
+  const int64_t key_num = 100 * 1000;
+  const uint32_t num_writers = num_threads_ / 2;
+  const int rounds = 4;
+
+  // Even keys stay in the tree, odd keys are inserted and deleted by the writers.
+  AdaptiveRadixTree<ArtIntKey, int64_t> tree;
+  for (int64_t i = 0; i < key_num; i += 2) tree.Insert({i}, i, NoPredicate);
+
+  std::atomic<uint32_t> writers_done = 0;
+  auto workload = [&](uint32_t worker_id) {
+    std::default_random_engine generator(worker_id);
+    if (worker_id < num_writers) {
+      for (int round = 0; round < rounds; round++) {
+        // Every key gets a second value for a while, so that value lists are replaced as well.
+        for (int64_t i = 2 * worker_id + 1; i < key_num; i += 2 * num_writers) {
+          EXPECT_TRUE(tree.Insert({i}, i, NoPredicate));
+          EXPECT_TRUE(tree.Insert({i}, -i, NoPredicate));
+        }
+        for (int64_t i = 2 * worker_id + 1; i < key_num; i += 2 * num_writers) {
+          EXPECT_TRUE(tree.Delete({i}, -i));
+          EXPECT_TRUE(tree.Delete({i}, i));
+        }
+      }
+      writers_done++;
+      return;
+    }
+
+    std::uniform_int_distribution<int64_t> distribution(0, key_num / 2 - 1);
+    std::vector<int64_t> results;
+    while (writers_done < num_writers) {
+      const int64_t key = 2 * distribution(generator);
+      results.clear();
+      tree.FindValues({key}, &results);
+      EXPECT_EQ(std::vector<int64_t>{key}, results);
+
+      // Batched lookups restart the lookups that a writer gets in the way of
+      std::vector<ArtIntKey> batch_keys;
+      for (int i = 0; i < 37; i++) batch_keys.push_back({2 * distribution(generator)});
+      std::vector<std::vector<int64_t>> batch_results(batch_keys.size());
+      tree.FindValuesBatch(batch_keys.data(), static_cast<uint32_t>(batch_keys.size()), batch_results.data());
+      for (uint32_t i = 0; i < batch_keys.size(); i++) {
+        EXPECT_EQ(std::vector<int64_t>{batch_keys[i].value_}, batch_results[i]);
+      }
+
+      // Scans see every even key in order, and odd keys only with the values that the writers insert.
+      for (const bool ascending : {true, false}) {
+        int64_t expected_even = key;
+        int num_visited = 0;
+        const ArtIntKey start_key{key};
+        tree.Scan(&start_key, ascending, [&](const ArtIntKey &visited, const std::vector<int64_t> &values) {
+          if (visited.value_ % 2 != 0) {
+            EXPECT_EQ(ascending ? expected_even - 1 : expected_even + 1, visited.value_);
+            for (const auto value : values) EXPECT_TRUE(value == visited.value_ || value == -visited.value_);
+            return true;
+          }
+          EXPECT_EQ(expected_even, visited.value_);
+          EXPECT_EQ(std::vector<int64_t>{visited.value_}, values);
+          expected_even += ascending ? 2 : -2;
+          return ++num_visited < 100;
+        });
+      }
+    }
+  };
+
+  MultiThreadTestUtil::RunThreadsUntilFinish(&thread_pool_, num_threads_, workload);
+
+  EXPECT_EQ(key_num / 2, tree.GetSize());
+  tree.PerformGarbageCollection();
+
+  std::vector<int64_t> expected_keys;
+  for (int64_t i = 0; i < key_num; i += 2) expected_keys.push_back(i);
+  EXPECT_EQ(expected_keys, (ScanKeys<ArtIntKey, int64_t>(&tree, nullptr, true)));
+}
+
+}  // namespace noisepage::storage::index
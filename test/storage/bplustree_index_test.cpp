@@ -1,7 +1,9 @@
+#include <algorithm>
 #include <cstring>
 #include <map>
 #include <memory>
 #include <random>
+#include <utility>
 #include <vector>
 
 #include "main/db_main.h"
@@ -10,6 +12,7 @@
 #include "storage/index/index_builder.h"
 #include "storage/projected_row.h"
 #include "storage/sql_table.h"
+#include "storage/storage_util.h"
 #include "test_util/catalog_test_util.h"
 #include "test_util/storage_test_util.h"
 #include "test_util/test_harness.h"
@@ -247,6 +250,206 @@ TEST_F(BPlusTreeIndexTests, DefaultInsert) {
   txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
 }
 
+/**
+ * This test inserts [0,num_inserts) twice into the table, and has multiple worker threads stage them for a bulk load of
+ * the default index. Once it is bulk loaded, a scan should return every version in key order. Bulk loading the unique
+ * index from the same tuples should fail.
+ */
+// NOLINTNEXTLINE
+TEST_F(BPlusTreeIndexTests, BulkLoad) {
+  const uint32_t num_inserts = 100000;
+  auto *const insert_txn = txn_manager_->BeginTransaction();
+  std::vector<std::pair<int32_t, storage::TupleSlot>> tuples;
+  for (uint32_t copy = 0; copy < 2; copy++) {
+    for (uint32_t i = 0; i < num_inserts; i++) {
+      auto *const insert_redo =
+          insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+      *reinterpret_cast<int32_t *>(insert_redo->Delta()->AccessForceNotNull(0)) = i;
+      tuples.emplace_back(i, sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo));
+    }
+  }
+  std::shuffle(tuples.begin(), tuples.end(), generator_);
+
+  auto workload = [&](uint32_t worker_id) {
+    auto *const key_buffer =
+        common::AllocationUtil::AllocateAligned(default_index_->GetProjectedRowInitializer().ProjectedRowSize());
+    auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer);
+    for (size_t i = worker_id; i < tuples.size(); i += num_threads_) {
+      *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = tuples[i].first;
+      EXPECT_TRUE(
+          default_index_->StageForBulkLoad(common::ManagedPointer(insert_txn), *insert_key, tuples[i].second));
+    }
+    delete[] key_buffer;
+  };
+  for (uint32_t i = 0; i < num_threads_; i++) {
+    thread_pool_.SubmitTask([i, &workload] { workload(i); });
+  }
+  thread_pool_.WaitUntilAllFinished();
+  EXPECT_TRUE(default_index_->BulkLoad(common::ManagedPointer(insert_txn), BULK_LOAD_FILL_FACTOR));
+  txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  auto *const scan_txn = txn_manager_->BeginTransaction();
+  std::vector<storage::TupleSlot> results;
+  auto *const low_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  auto *const high_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_2_);
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 0;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = num_inserts - 1;
+  default_index_->ScanAscending(*scan_txn, storage::index::ScanType::Closed, 1, low_key_pr, high_key_pr, 0, &results);
+  ASSERT_EQ(results.size(), 2 * num_inserts);
+  auto *const select_buffer = common::AllocationUtil::AllocateAligned(tuple_initializer_.ProjectedRowSize());
+  auto *const select_row = tuple_initializer_.InitializeRow(select_buffer);
+  int32_t prev_key = 0;
+  for (const auto &slot : results) {
+    EXPECT_TRUE(sql_table_->Select(common::ManagedPointer(scan_txn), slot, select_row));
+    const int32_t key = *reinterpret_cast<int32_t *>(select_row->AccessForceNotNull(0));
+    EXPECT_LE(prev_key, key);
+    prev_key = key;
+  }
+  delete[] select_buffer;
+
+  // The same keys again, this time for a point lookup
+  results.clear();
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = num_inserts / 2;
+  default_index_->ScanKey(*scan_txn, *low_key_pr, &results);
+  EXPECT_EQ(results.size(), 2);
+  txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  // Every key is in the table twice, so it cannot have a unique index
+  auto *const unique_txn = txn_manager_->BeginTransaction();
+  auto *const unique_key = unique_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_2_);
+  for (const auto &[key, slot] : tuples) {
+    *reinterpret_cast<int32_t *>(unique_key->AccessForceNotNull(0)) = key;
+    EXPECT_TRUE(unique_index_->StageForBulkLoad(common::ManagedPointer(unique_txn), *unique_key, slot));
+  }
+  EXPECT_FALSE(unique_index_->BulkLoad(common::ManagedPointer(unique_txn), BULK_LOAD_FILL_FACTOR));
+  EXPECT_TRUE(unique_txn->MustAbort());
+  txn_manager_->Abort(unique_txn);
+  EXPECT_EQ(unique_index_->GetSize(), 0);
+}
+
+/**
+ * Looks up a batch of present and missing keys at once, including a key whose only tuple is not visible to the scanning
+ * txn. The results have to match the ones of ScanKey for every key.
+ */
+// NOLINTNEXTLINE
+TEST_F(BPlusTreeIndexTests, ScanKeyBatch) {
+  // populate index with [0..100] even keys
+  std::map<int32_t, storage::TupleSlot> reference;
+  auto *const insert_txn = txn_manager_->BeginTransaction();
+  for (int32_t i = 0; i <= 100; i += 2) {
+    auto *const insert_redo =
+        insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+    *reinterpret_cast<int32_t *>(insert_redo->Delta()->AccessForceNotNull(0)) = i;
+    const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+
+    auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+    *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
+    EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(insert_txn), *insert_key, tuple_slot));
+    reference[i] = tuple_slot;
+  }
+  txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  // key 1 is inserted by a txn that is still running
+  auto *const uncommitted_txn = txn_manager_->BeginTransaction();
+  auto *const uncommitted_redo =
+      uncommitted_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+  *reinterpret_cast<int32_t *>(uncommitted_redo->Delta()->AccessForceNotNull(0)) = 1;
+  const auto uncommitted_slot = sql_table_->Insert(common::ManagedPointer(uncommitted_txn), uncommitted_redo);
+  auto *const uncommitted_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  *reinterpret_cast<int32_t *>(uncommitted_key->AccessForceNotNull(0)) = 1;
+  EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(uncommitted_txn), *uncommitted_key, uncommitted_slot));
+
+  // look up [-1..101] in reverse order
+  const auto &initializer = default_index_->GetProjectedRowInitializer();
+  const uint32_t key_size = StorageUtil::PadUpToSize(sizeof(uint64_t), initializer.ProjectedRowSize());
+  const uint32_t num_keys = 103;
+  auto *const batch_key_buffer = common::AllocationUtil::AllocateAligned(num_keys * key_size);
+  std::vector<const ProjectedRow *> keys;
+  for (uint32_t i = 0; i < num_keys; i++) {
+    auto *const key = initializer.InitializeRow(batch_key_buffer + i * key_size);
+    *reinterpret_cast<int32_t *>(key->AccessForceNotNull(0)) = 101 - static_cast<int32_t>(i);
+    keys.emplace_back(key);
+  }
+
+  auto *const scan_txn = txn_manager_->BeginTransaction();
+  std::vector<std::vector<storage::TupleSlot>> batch_results;
+  default_index_->ScanKeyBatch(*scan_txn, keys, &batch_results);
+  ASSERT_EQ(batch_results.size(), num_keys);
+  for (uint32_t i = 0; i < num_keys; i++) {
+    const int32_t key = 101 - static_cast<int32_t>(i);
+    std::vector<storage::TupleSlot> results;
+    default_index_->ScanKey(*scan_txn, *keys[i], &results);
+    EXPECT_EQ(results, batch_results[i]);
+    if (key >= 0 && key <= 100 && key % 2 == 0) {
+      ASSERT_EQ(batch_results[i].size(), 1);
+      EXPECT_EQ(reference.at(key), batch_results[i][0]);
+    } else {
+      EXPECT_TRUE(batch_results[i].empty());
+    }
+  }
+  txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+  txn_manager_->Commit(uncommitted_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  delete[] batch_key_buffer;
+}
+
+/**
+ * Inserts batches of keys into the unique index. A batch that conflicts with a committed key is rejected, and its other
+ * keys are removed from the index again when its txn aborts.
+ */
+// NOLINTNEXTLINE
+TEST_F(BPlusTreeIndexTests, InsertBatch) {
+  const auto &initializer = unique_index_->GetProjectedRowInitializer();
+  const uint32_t key_size = StorageUtil::PadUpToSize(sizeof(uint64_t), initializer.ProjectedRowSize());
+  const uint32_t num_keys = 100;
+  auto *const batch_key_buffer = common::AllocationUtil::AllocateAligned(num_keys * key_size);
+
+  // Inserts every key in [first, first + count) into the table in reverse order, and into the index in one batch.
+  auto insert_batch = [&](transaction::TransactionContext *txn, int32_t first, uint32_t count) {
+    std::vector<const ProjectedRow *> keys;
+    std::vector<storage::TupleSlot> slots;
+    for (uint32_t i = 0; i < count; i++) {
+      const int32_t key = first + static_cast<int32_t>(count - 1 - i);
+      auto *const redo =
+          txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+      *reinterpret_cast<int32_t *>(redo->Delta()->AccessForceNotNull(0)) = key;
+      slots.emplace_back(sql_table_->Insert(common::ManagedPointer(txn), redo));
+
+      auto *const index_key = initializer.InitializeRow(batch_key_buffer + i * key_size);
+      *reinterpret_cast<int32_t *>(index_key->AccessForceNotNull(0)) = key;
+      keys.emplace_back(index_key);
+    }
+    return std::make_pair(unique_index_->InsertBatch(common::ManagedPointer(txn), keys, slots), slots);
+  };
+
+  auto *const insert_txn = txn_manager_->BeginTransaction();
+  const auto [inserted, slots] = insert_batch(insert_txn, 0, num_keys);
+  EXPECT_TRUE(inserted);
+  EXPECT_FALSE(insert_txn->MustAbort());
+  txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+  EXPECT_EQ(unique_index_->GetSize(), num_keys);
+
+  // [90, 110) conflicts with the committed keys [90, 100)
+  auto *const conflict_txn = txn_manager_->BeginTransaction();
+  EXPECT_FALSE(insert_batch(conflict_txn, 90, 20).first);
+  EXPECT_TRUE(conflict_txn->MustAbort());
+  txn_manager_->Abort(conflict_txn);
+  EXPECT_EQ(unique_index_->GetSize(), num_keys);
+
+  auto *const scan_txn = txn_manager_->BeginTransaction();
+  for (uint32_t i = 0; i < num_keys; i++) {
+    auto *const key = initializer.InitializeRow(key_buffer_1_);
+    *reinterpret_cast<int32_t *>(key->AccessForceNotNull(0)) = static_cast<int32_t>(num_keys - 1 - i);
+    std::vector<storage::TupleSlot> results;
+    unique_index_->ScanKey(*scan_txn, *key, &results);
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_EQ(results[0], slots[i]);
+  }
+  txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  delete[] batch_key_buffer;
+}
+
 /**
  * Tests basic scan behavior using various windows to scan over (some out of of bounds of keyspace, some matching
  * exactly, etc.)
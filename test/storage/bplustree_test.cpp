@@ -1,4 +1,9 @@
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
+#include <list>
+#include <map>
+#include <random>
 #include <set>
 #include <unordered_map>
 
@@ -1349,6 +1354,56 @@ void BPlusTreeCompleteDeleteAndReinsertTest() {
   delete bplustree;
 }
 
+/**
+ * Bulk load sorted keys, some of which have several values, with different fill factors. The tree must be as
+ * well-formed as one built by inserts, and take further inserts.
+ */
+void BulkLoadTest() {
+  auto predicate = [](const int slot) -> bool { return false; };
+  for (const double fill_factor : {0.5, 0.9, 1.0}) {
+    std::vector<BPlusTree<int, int>::KeyElementPair> sorted;
+    std::set<int> keys;
+    unsigned key_num = 100000;
+    for (unsigned i = 0; i < key_num; i++) {
+      int k = 2 * static_cast<int>(i);
+      keys.insert(k);
+      sorted.emplace_back(k, k);
+      if (i % 10 == 0) sorted.emplace_back(k, k + 1);
+    }
+
+    auto bplustree = new BPlusTree<int, int>;
+    EXPECT_EQ(bplustree->BulkLoad(sorted, fill_factor), true);
+    EXPECT_EQ(bplustree->GetSize(), key_num);
+    EXPECT_EQ(bplustree->SiblingForwardCheck(&keys), true);
+    EXPECT_EQ(bplustree->SiblingBackwardCheck(&keys), true);
+    for (unsigned i = 0; i < key_num; i += 7) {
+      std::vector<int> results;
+      bplustree->FindValueOfKey(2 * static_cast<int>(i), &results);
+      EXPECT_EQ(results.size(), i % 10 == 0 ? 2 : 1);
+    }
+
+    // A tree that is not empty is left alone
+    EXPECT_EQ(bplustree->BulkLoad(sorted, fill_factor), false);
+
+    // Fill the gaps between the loaded keys
+    for (unsigned i = 0; i < key_num; i++) {
+      BPlusTree<int, int>::KeyElementPair p1;
+      p1.first = 2 * static_cast<int>(i) + 1;
+      p1.second = p1.first;
+      keys.insert(p1.first);
+      bplustree->Insert(p1, predicate);
+    }
+    std::set<int> keys_copy = keys;
+    EXPECT_EQ(bplustree->SiblingForwardCheck(&keys_copy), true);
+    EXPECT_EQ(
+        bplustree->StructuralIntegrityVerification(*keys.begin(), *keys.rbegin(), &keys_copy, bplustree->GetRoot()),
+        true);
+    EXPECT_EQ(keys_copy.size(), 0);
+
+    delete bplustree;
+  }
+}
+
 // NOLINTNEXTLINE
 TEST_F(BPlusTreeTests, InsertTests) {
   BasicBPlusTreeInsertTestNoSplit();
@@ -1377,6 +1432,9 @@ TEST_F(BPlusTreeTests, StructuralIntegrityTests) {
   StructuralIntegrityTestWithRandomInsertAndDelete();
 }
 
+// NOLINTNEXTLINE
+TEST_F(BPlusTreeTests, BulkLoadTests) { BulkLoadTest(); }
+
 // NOLINTNEXTLINE
 TEST_F(BPlusTreeTests, LargeTests) {
   LargeStructuralIntegrityVerificationTest();
@@ -1503,6 +1561,222 @@ TEST_F(BPlusTreeTests, MultiThreadedDeleteTest) {
   delete tree;
 }
 
+// Batched lookups find the same values as lookups of one key at a time, for present, duplicate and missing keys.
+// NOLINTNEXTLINE
+TEST_F(BPlusTreeTests, BatchLookupTest) {
+  auto predicate = [](const int64_t slot) -> bool { return false; };
+  auto *const tree = new BPlusTree<int64_t, int64_t>;
+
+  // Nothing is found in an empty tree
+  std::vector<int64_t> keys = {1, 2, 3};
+  std::vector<std::vector<int64_t>> batch_results(keys.size());
+  tree->FindValuesOfKeys(keys.data(), static_cast<uint32_t>(keys.size()), batch_results.data());
+  for (const auto &results : batch_results) EXPECT_TRUE(results.empty());
+
+  std::default_random_engine generator;
+  std::uniform_int_distribution<int64_t> distribution(0, 100 * 1000);
+  for (int i = 0; i < 50 * 1000; i++) {
+    const int64_t key = distribution(generator);
+    tree->Insert(tree->GetElement(key, key), predicate);
+    if (key % 10 == 0) tree->Insert(tree->GetElement(key, -key), predicate);
+  }
+
+  // The batch size is not a multiple of the number of lookups that are interleaved
+  keys.clear();
+  for (int i = 0; i < 1000 + 7; i++) keys.push_back(distribution(generator));
+  batch_results.assign(keys.size(), {});
+  tree->FindValuesOfKeys(keys.data(), static_cast<uint32_t>(keys.size()), batch_results.data());
+  for (uint32_t i = 0; i < keys.size(); i++) {
+    std::vector<int64_t> results;
+    tree->FindValueOfKey(keys[i], &results);
+    EXPECT_EQ(results, batch_results[i]);
+  }
+
+  delete tree;
+}
+
+// NOLINTNEXTLINE
+TEST_F(BPlusTreeTests, InsertDeleteBatchTest) {
+  auto predicate = [](const int64_t slot) -> bool { return false; };
+  auto *const tree = new BPlusTree<int64_t, int64_t>;
+  tree->SetLeafNodeSizeUpperThreshold(16);
+  tree->SetLeafNodeSizeLowerThreshold(8);
+  tree->SetInnerNodeSizeUpperThreshold(16);
+  tree->SetInnerNodeSizeLowerThreshold(8);
+
+  // The first batch goes into an empty tree, the later ones split and merge the leaf nodes that they visit.
+  std::default_random_engine generator;
+  std::uniform_int_distribution<int64_t> distribution(0, 10 * 1000);
+  std::multimap<int64_t, int64_t> reference;
+  int64_t value = 0;
+  for (int round = 0; round < 10; round++) {
+    std::vector<BPlusTree<int64_t, int64_t>::KeyElementPair> batch;
+    for (int i = 0; i < 2000; i++) {
+      const int64_t key = distribution(generator);
+      batch.push_back(tree->GetElement(key, value++));
+      reference.emplace(key, batch.back().second);
+    }
+    std::sort(batch.begin(), batch.end());
+    std::vector<BPlusTree<int64_t, int64_t>::KeyElementPair> inserted;
+    EXPECT_TRUE(tree->InsertBatch(batch, predicate, &inserted));
+    EXPECT_EQ(inserted.size(), batch.size());
+
+    // Delete every third pair of the batch again
+    std::vector<BPlusTree<int64_t, int64_t>::KeyElementPair> deleted;
+    for (uint32_t i = 0; i < batch.size(); i += 3) {
+      deleted.push_back(batch[i]);
+      for (auto it = reference.find(batch[i].first); it != reference.end(); ++it) {
+        if (it->second == batch[i].second) {
+          reference.erase(it);
+          break;
+        }
+      }
+    }
+    EXPECT_EQ(tree->DeleteBatch(deleted), deleted.size());
+    // Deleting the same pairs again finds none of them
+    EXPECT_EQ(tree->DeleteBatch(deleted), 0);
+  }
+
+  uint32_t num_values = 0;
+  for (auto it = tree->Begin(); it != tree->End(); ++it) num_values++;
+  EXPECT_EQ(num_values, reference.size());
+  for (const auto &[key, v] : reference) {
+    std::vector<int64_t> results;
+    tree->FindValueOfKey(key, &results);
+    EXPECT_NE(std::find(results.begin(), results.end(), v), results.end());
+  }
+
+  // Everything can be deleted in one batch
+  std::vector<BPlusTree<int64_t, int64_t>::KeyElementPair> all;
+  for (const auto &[key, v] : reference) all.push_back(tree->GetElement(key, v));
+  EXPECT_EQ(tree->DeleteBatch(all), all.size());
+  for (const auto &[key, v] : reference) {
+    std::vector<int64_t> results;
+    tree->FindValueOfKey(key, &results);
+    EXPECT_TRUE(results.empty());
+  }
+
+  delete tree;
+}
+
+// NOLINTNEXTLINE
+TEST_F(BPlusTreeTests, UniqueInsertBatchTest) {
+  auto *const tree = new BPlusTree<int64_t, int64_t>;
+  // Every key can have only one value
+  auto predicate = [](const int64_t slot) -> bool { return true; };
+
+  std::vector<BPlusTree<int64_t, int64_t>::KeyElementPair> batch;
+  for (int64_t i = 0; i < 1000; i++) batch.push_back(tree->GetElement(2 * i, i));
+  std::vector<BPlusTree<int64_t, int64_t>::KeyElementPair> inserted;
+  EXPECT_TRUE(tree->InsertBatch(batch, predicate, &inserted));
+  EXPECT_EQ(inserted.size(), batch.size());
+
+  // Keys that are already in the tree or earlier in the batch are rejected, the others are inserted
+  batch = {tree->GetElement(-1, 0), tree->GetElement(4, 0), tree->GetElement(5, 0), tree->GetElement(5, 1),
+           tree->GetElement(3000, 0)};
+  inserted.clear();
+  EXPECT_FALSE(tree->InsertBatch(batch, predicate, &inserted));
+  ASSERT_EQ(inserted.size(), 3);
+  EXPECT_EQ(inserted[0], tree->GetElement(-1, 0));
+  EXPECT_EQ(inserted[1], tree->GetElement(5, 0));
+  EXPECT_EQ(inserted[2], tree->GetElement(3000, 0));
+
+  std::vector<int64_t> results;
+  tree->FindValueOfKey(4, &results);
+  EXPECT_EQ(results, std::vector<int64_t>{2});
+  results.clear();
+  tree->FindValueOfKey(5, &results);
+  EXPECT_EQ(results, std::vector<int64_t>{0});
+
+  delete tree;
+}
+
+// Lookups and scans run without latches while writers keep splitting and merging the leaf nodes that they read.
+// NOLINTNEXTLINE
+TEST_F(BPlusTreeTests, MultiThreadedOptimisticReadTest) {
+  auto predicate = [](const int64_t slot) -> bool { return false; };
+  const int64_t key_num = 100 * 1000;
+  const uint32_t num_writers = num_threads_ / 2;
+  const int rounds = 4;
+
+  // Even keys stay in the tree, odd keys are inserted and deleted by the writers.
+  auto *const tree = new BPlusTree<int64_t, int64_t>;
+  for (int64_t i = 0; i < key_num; i += 2) {
+    tree->Insert(tree->GetElement(i, i), predicate);
+  }
+
+  std::atomic<uint32_t> writers_done = 0;
+  auto workload = [&](uint32_t worker_id) {
+    std::default_random_engine generator(worker_id);
+    if (worker_id < num_writers) {
+      for (int round = 0; round < rounds; round++) {
+        // Every key gets a second value for a while, so that value lists are replaced as well.
+        for (int64_t i = 2 * worker_id + 1; i < key_num; i += 2 * num_writers) {
+          EXPECT_TRUE(tree->Insert(tree->GetElement(i, i), predicate));
+          EXPECT_TRUE(tree->Insert(tree->GetElement(i, -i), predicate));
+        }
+        for (int64_t i = 2 * worker_id + 1; i < key_num; i += 2 * num_writers) {
+          EXPECT_TRUE(tree->DeleteElement(tree->GetElement(i, -i)));
+          EXPECT_TRUE(tree->DeleteElement(tree->GetElement(i, i)));
+        }
+      }
+      writers_done++;
+      return;
+    }
+
+    std::uniform_int_distribution<int64_t> distribution(0, key_num / 2 - 1);
+    std::vector<int64_t> results;
+    while (writers_done < num_writers) {
+      const int64_t key = 2 * distribution(generator);
+      results.clear();
+      tree->FindValueOfKey(key, &results);
+      ASSERT_EQ(results.size(), 1);
+      EXPECT_EQ(results[0], key);
+      EXPECT_TRUE(tree->IsPresent(key));
+
+      // Batched lookups restart the descents that a writer gets in the way of
+      std::vector<int64_t> batch_keys;
+      for (int i = 0; i < 37; i++) batch_keys.push_back(2 * distribution(generator));
+      std::vector<std::vector<int64_t>> batch_results(batch_keys.size());
+      tree->FindValuesOfKeys(batch_keys.data(), static_cast<uint32_t>(batch_keys.size()), batch_results.data());
+      for (uint32_t i = 0; i < batch_keys.size(); i++) EXPECT_EQ(std::vector<int64_t>{batch_keys[i]}, batch_results[i]);
+
+      // Scans see every even key in order, and odd keys only with the values that the writers insert.
+      for (const bool ascending : {true, false}) {
+        int64_t expected_even = key;
+        int num_visited = 0;
+        tree->OptimisticScan(&key, ascending, [&](const int64_t &visited, const std::list<int64_t> &values) {
+          if (visited % 2 != 0) {
+            EXPECT_EQ(ascending ? expected_even - 1 : expected_even + 1, visited);
+            for (const auto value : values) EXPECT_TRUE(value == visited || value == -visited);
+            return true;
+          }
+          EXPECT_EQ(expected_even, visited);
+          EXPECT_EQ(std::list<int64_t>{visited}, values);
+          expected_even += ascending ? 2 : -2;
+          return ++num_visited < 100;
+        });
+      }
+    }
+  };
+
+  // Run the workload
+  for (uint32_t i = 0; i < num_threads_; i++) {
+    thread_pool_.SubmitTask([i, &workload] { workload(i); });
+  }
+  thread_pool_.WaitUntilAllFinished();
+
+  EXPECT_EQ(tree->GetSize(), key_num / 2);
+  tree->PerformGarbageCollection();
+
+  // Verify Structural Integrity
+  std::set<int64_t> keys_present;
+  for (int64_t i = 0; i < key_num; i += 2) keys_present.insert(i);
+  EXPECT_EQ(tree->StructuralIntegrityVerification(0, key_num - 2, &keys_present, tree->GetRoot()), true);
+
+  delete tree;
+}
+
 TEST_F(BPlusTreeTests, IteratorTest) {
   const auto key_num = 1000 * 1000;
   auto predicate = [](const int64_t slot) -> bool { return false; };
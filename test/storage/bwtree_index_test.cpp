@@ -1,9 +1,11 @@
+#include <algorithm>
 #include <cstring>
 #include <functional>
 #include <limits>
 #include <map>
 #include <memory>
 #include <random>
+#include <utility>
 #include <vector>
 
 #include "main/db_main.h"
@@ -254,6 +256,83 @@ TEST_F(BwTreeIndexTests, DefaultInsert) {
   txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
 }
 
+/**
+ * This test inserts [0,num_inserts) twice into the table, and has multiple worker threads stage them for a bulk load of
+ * the default index. Once it is bulk loaded, a scan should return every version in key order. Bulk loading the unique
+ * index from the same tuples should fail.
+ */
+// NOLINTNEXTLINE
+TEST_F(BwTreeIndexTests, BulkLoad) {
+  const uint32_t num_inserts = 100000;
+  auto *const insert_txn = txn_manager_->BeginTransaction();
+  std::vector<std::pair<int32_t, storage::TupleSlot>> tuples;
+  for (uint32_t copy = 0; copy < 2; copy++) {
+    for (uint32_t i = 0; i < num_inserts; i++) {
+      auto *const insert_redo =
+          insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+      *reinterpret_cast<int32_t *>(insert_redo->Delta()->AccessForceNotNull(0)) = i;
+      tuples.emplace_back(i, sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo));
+    }
+  }
+  std::shuffle(tuples.begin(), tuples.end(), generator_);
+
+  auto workload = [&](uint32_t worker_id) {
+    auto *const key_buffer =
+        common::AllocationUtil::AllocateAligned(default_index_->GetProjectedRowInitializer().ProjectedRowSize());
+    auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer);
+    for (size_t i = worker_id; i < tuples.size(); i += num_threads_) {
+      *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = tuples[i].first;
+      EXPECT_TRUE(
+          default_index_->StageForBulkLoad(common::ManagedPointer(insert_txn), *insert_key, tuples[i].second));
+    }
+    delete[] key_buffer;
+  };
+  for (uint32_t i = 0; i < num_threads_; i++) {
+    thread_pool_.SubmitTask([i, &workload] { workload(i); });
+  }
+  thread_pool_.WaitUntilAllFinished();
+  EXPECT_TRUE(default_index_->BulkLoad(common::ManagedPointer(insert_txn), BULK_LOAD_FILL_FACTOR));
+  txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  auto *const scan_txn = txn_manager_->BeginTransaction();
+  std::vector<storage::TupleSlot> results;
+  auto *const low_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  auto *const high_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_2_);
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 0;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = num_inserts - 1;
+  default_index_->ScanAscending(*scan_txn, storage::index::ScanType::Closed, 1, low_key_pr, high_key_pr, 0, &results);
+  ASSERT_EQ(results.size(), 2 * num_inserts);
+  auto *const select_buffer = common::AllocationUtil::AllocateAligned(tuple_initializer_.ProjectedRowSize());
+  auto *const select_row = tuple_initializer_.InitializeRow(select_buffer);
+  int32_t prev_key = 0;
+  for (const auto &slot : results) {
+    EXPECT_TRUE(sql_table_->Select(common::ManagedPointer(scan_txn), slot, select_row));
+    const int32_t key = *reinterpret_cast<int32_t *>(select_row->AccessForceNotNull(0));
+    EXPECT_LE(prev_key, key);
+    prev_key = key;
+  }
+  delete[] select_buffer;
+
+  // The same keys again, this time for a point lookup
+  results.clear();
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = num_inserts / 2;
+  default_index_->ScanKey(*scan_txn, *low_key_pr, &results);
+  EXPECT_EQ(results.size(), 2);
+  txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  // Every key is in the table twice, so it cannot have a unique index
+  auto *const unique_txn = txn_manager_->BeginTransaction();
+  auto *const unique_key = unique_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_2_);
+  for (const auto &[key, slot] : tuples) {
+    *reinterpret_cast<int32_t *>(unique_key->AccessForceNotNull(0)) = key;
+    EXPECT_TRUE(unique_index_->StageForBulkLoad(common::ManagedPointer(unique_txn), *unique_key, slot));
+  }
+  EXPECT_FALSE(unique_index_->BulkLoad(common::ManagedPointer(unique_txn), BULK_LOAD_FILL_FACTOR));
+  EXPECT_TRUE(unique_txn->MustAbort());
+  txn_manager_->Abort(unique_txn);
+  EXPECT_EQ(unique_index_->GetSize(), 0);
+}
+
 /**
  * Tests basic scan behavior using various windows to scan over (some out of of bounds of keyspace, some matching
  * exactly, etc.)
@@ -242,6 +242,79 @@ TEST_F(HashIndexTests, DefaultInsert) {
   txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
 }
 
+/**
+ * This test creates multiple worker threads that all insert tuples under a handful of keys, so that every key has
+ * thousands of values. Every third txn aborts, which deletes its value again. At completion of the workload, every key
+ * should have the values of the committed txns, and batched lookups should agree with single lookups.
+ */
+// NOLINTNEXTLINE
+TEST_F(HashIndexTests, SkewedInsert) {
+  const uint32_t num_inserts = 30000;  // number of tuples for each worker to attempt to insert
+  const uint32_t num_keys = 8;
+  auto workload = [&](uint32_t worker_id) {
+    auto *const key_buffer =
+        common::AllocationUtil::AllocateAligned(default_index_->GetProjectedRowInitializer().ProjectedRowSize());
+    auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer);
+
+    for (uint32_t i = 0; i < num_inserts; i++) {
+      auto *const insert_txn = txn_manager_->BeginTransaction();
+      auto *const insert_redo =
+          insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+      auto *const insert_tuple = insert_redo->Delta();
+      *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i % num_keys;
+      const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+
+      *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i % num_keys;
+      EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(insert_txn), *insert_key, tuple_slot));
+      if (i % 3 == 0) {
+        txn_manager_->Abort(insert_txn);
+      } else {
+        txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+      }
+    }
+
+    delete[] key_buffer;
+  };
+
+  // run the workload
+  for (uint32_t i = 0; i < num_threads_; i++) {
+    thread_pool_.SubmitTask([i, &workload] { workload(i); });
+  }
+  thread_pool_.WaitUntilAllFinished();
+
+  EXPECT_EQ(default_index_->GetSize(), num_keys);
+
+  // scan the results
+  auto *const scan_txn = txn_manager_->BeginTransaction();
+
+  std::vector<byte *> key_buffers;
+  std::vector<const ProjectedRow *> keys;
+  std::vector<storage::TupleSlot> results;
+  for (uint32_t i = 0; i < num_keys; i++) {
+    key_buffers.emplace_back(
+        common::AllocationUtil::AllocateAligned(default_index_->GetProjectedRowInitializer().ProjectedRowSize()));
+    auto *const key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffers.back());
+    *reinterpret_cast<int32_t *>(key_pr->AccessForceNotNull(0)) = i;
+    keys.emplace_back(key_pr);
+
+    // every key gets num_inserts / num_keys tuples from every worker, of which a third aborted
+    default_index_->ScanKey(*scan_txn, *key_pr, &results);
+    EXPECT_EQ(results.size(), num_threads_ * (num_inserts / num_keys) * 2 / 3);
+    results.clear();
+  }
+
+  std::vector<std::vector<storage::TupleSlot>> batch_results;
+  default_index_->ScanKeyBatch(*scan_txn, keys, &batch_results);
+  for (uint32_t i = 0; i < num_keys; i++) {
+    default_index_->ScanKey(*scan_txn, *keys[i], &results);
+    EXPECT_EQ(batch_results[i], results);
+    results.clear();
+  }
+
+  txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+  for (auto *const key_buffer : key_buffers) delete[] key_buffer;
+}
+
 // Verifies that primary key insert fails on write-write conflict
 // NOLINTNEXTLINE
 TEST_F(HashIndexTests, UniqueKey1) {
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <functional>
 #include <limits>
@@ -28,6 +29,18 @@
 
 namespace noisepage::storage::index {
 
+/**
+ * @return true if the binary-comparable form of the first key sorts before the one of the second key
+ */
+template <typename KeyType>
+bool BinaryComparableLess(const KeyType &lhs, const KeyType &rhs) {
+  std::array<byte, KeyType::BINARY_COMPARABLE_SIZE> lhs_bytes, rhs_bytes;
+  const uint16_t lhs_size = lhs.ToBinaryComparable(lhs_bytes.data());
+  const uint16_t rhs_size = rhs.ToBinaryComparable(rhs_bytes.data());
+  const int result = std::memcmp(lhs_bytes.data(), rhs_bytes.data(), std::min(lhs_size, rhs_size));
+  return result < 0 || (result == 0 && lhs_size < rhs_size);
+}
+
 class IndexKeyTests : public TerrierTest {
  public:
   std::default_random_engine generator_;
@@ -372,6 +385,7 @@ class IndexKeyTests : public TerrierTest {
 
     EXPECT_EQ(generic_eq64(key1, key2), ref_eq);
     EXPECT_EQ(generic_lt64(key1, key2), ref_lt);
+    EXPECT_EQ(BinaryComparableLess(key1, key2), ref_lt);
   }
 
  protected:
@@ -894,6 +908,7 @@ void NumericComparisons(const type::TypeId type_id, const bool nullable) {
   EXPECT_TRUE(std::equal_to<KeyType>()(key1, key2));
   EXPECT_EQ(std::hash<KeyType>()(key1), std::hash<KeyType>()(key2));
   EXPECT_FALSE(std::less<KeyType>()(key1, key2));
+  EXPECT_EQ(std::less<KeyType>()(key1, key2), BinaryComparableLess(key1, key2));
 
   data = 72;
   *reinterpret_cast<CType *>(pr->AccessForceNotNull(0)) = data;
@@ -903,6 +918,7 @@ void NumericComparisons(const type::TypeId type_id, const bool nullable) {
   EXPECT_FALSE(std::equal_to<KeyType>()(key1, key2));
   EXPECT_NE(std::hash<KeyType>()(key1), std::hash<KeyType>()(key2));
   EXPECT_TRUE(std::less<KeyType>()(key1, key2));
+  EXPECT_EQ(std::less<KeyType>()(key1, key2), BinaryComparableLess(key1, key2));
 
   data = 116;
   *reinterpret_cast<CType *>(pr->AccessForceNotNull(0)) = data;
@@ -912,6 +928,20 @@ void NumericComparisons(const type::TypeId type_id, const bool nullable) {
   EXPECT_FALSE(std::equal_to<KeyType>()(key1, key2));
   EXPECT_NE(std::hash<KeyType>()(key1), std::hash<KeyType>()(key2));
   EXPECT_FALSE(std::less<KeyType>()(key1, key2));
+  EXPECT_EQ(std::less<KeyType>()(key1, key2), BinaryComparableLess(key1, key2));
+
+  data = static_cast<CType>(-72);
+  *reinterpret_cast<CType *>(pr->AccessForceNotNull(0)) = data;
+  key2.SetFromProjectedRow(*pr, metadata, 1);
+
+  // lhs: 116, rhs: -72 (wraps around for unsigned types)
+  EXPECT_FALSE(std::equal_to<KeyType>()(key1, key2));
+  EXPECT_EQ(std::less<KeyType>()(key1, key2), BinaryComparableLess(key1, key2));
+  EXPECT_EQ(std::less<KeyType>()(key2, key1), BinaryComparableLess(key2, key1));
+
+  data = 72;
+  *reinterpret_cast<CType *>(pr->AccessForceNotNull(0)) = data;
+  key2.SetFromProjectedRow(*pr, metadata, 1);
 
   if (nullable) {
     pr->SetNull(0);
@@ -921,6 +951,7 @@ void NumericComparisons(const type::TypeId type_id, const bool nullable) {
     EXPECT_FALSE(std::equal_to<KeyType>()(key1, key2));
     EXPECT_NE(std::hash<KeyType>()(key1), std::hash<KeyType>()(key2));
     EXPECT_TRUE(std::less<KeyType>()(key1, key2));
+    EXPECT_EQ(std::less<KeyType>()(key1, key2), BinaryComparableLess(key1, key2));
 
     key2.SetFromProjectedRow(*pr, metadata, 1);
 
@@ -928,6 +959,7 @@ void NumericComparisons(const type::TypeId type_id, const bool nullable) {
     EXPECT_TRUE(std::equal_to<KeyType>()(key1, key2));
     EXPECT_EQ(std::hash<KeyType>()(key1), std::hash<KeyType>()(key2));
     EXPECT_FALSE(std::less<KeyType>()(key1, key2));
+    EXPECT_EQ(std::less<KeyType>()(key1, key2), BinaryComparableLess(key1, key2));
 
     data = 15;
     *reinterpret_cast<CType *>(pr->AccessForceNotNull(0)) = data;
@@ -937,6 +969,7 @@ void NumericComparisons(const type::TypeId type_id, const bool nullable) {
     EXPECT_FALSE(std::equal_to<KeyType>()(key1, key2));
     EXPECT_NE(std::hash<KeyType>()(key1), std::hash<KeyType>()(key2));
     EXPECT_FALSE(std::less<KeyType>()(key1, key2));
+    EXPECT_EQ(std::less<KeyType>()(key1, key2), BinaryComparableLess(key1, key2));
   }
 
   delete[] pr_buffer;
@@ -1197,6 +1230,198 @@ TEST_F(IndexKeyTests, GenericKeyNonInlineVarlenComparisons) {
   delete[] pr_buffer;
 }
 
+/**
+ * GenericKey compares its normalized bytes with a single memcmp, so a VARBINARY that ends with zero bytes, or that is a
+ * prefix of another one across the boundary of a varlen group, must still order like the raw bytes followed by length.
+ */
+// NOLINTNEXTLINE
+TEST_F(IndexKeyTests, GenericKeyNormalizedVarbinaryComparisons) {
+  std::vector<catalog::IndexSchema::Column> key_cols;
+  key_cols.emplace_back("", type::TypeId::VARBINARY, 20, false,
+                        parser::ConstantValueExpression(type::TypeId::VARBINARY));
+  StorageTestUtil::ForceOid(&(key_cols.back()), catalog::indexkeycol_oid_t(0));
+  key_cols.emplace_back("", type::TypeId::INTEGER, false, parser::ConstantValueExpression(type::TypeId::INTEGER));
+  StorageTestUtil::ForceOid(&(key_cols.back()), catalog::indexkeycol_oid_t(1));
+
+  const IndexMetadata metadata(
+      catalog::IndexSchema(key_cols, storage::index::IndexType::BPLUSTREE, false, false, false, true));
+  const auto &initializer = metadata.GetProjectedRowInitializer();
+  const auto &oid_offset_map = metadata.GetKeyOidToOffsetMap();
+  const uint16_t varbinary_offset = oid_offset_map.at(catalog::indexkeycol_oid_t(0));
+  const uint16_t integer_offset = oid_offset_map.at(catalog::indexkeycol_oid_t(1));
+
+  auto *const pr_buffer = common::AllocationUtil::AllocateAligned(initializer.ProjectedRowSize());
+  auto *const pr = initializer.InitializeRow(pr_buffer);
+
+  // Sorted by their bytes, and then by their length
+  const std::vector<std::vector<uint8_t>> values{{},
+                                                 {0},
+                                                 {0, 0},
+                                                 {0, 1},
+                                                 {1, 2, 3, 4, 5, 6, 7},
+                                                 {1, 2, 3, 4, 5, 6, 7, 0},
+                                                 {1, 2, 3, 4, 5, 6, 7, 0, 0},
+                                                 {1, 2, 3, 4, 5, 6, 7, 8},
+                                                 {1, 2, 3, 4, 5, 6, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+                                                 {1, 2, 3, 4, 5, 6, 7, 8, 9},
+                                                 {255}};
+
+  const auto set_key = [&](GenericKey<128> *const key, const std::vector<uint8_t> &value, const int32_t integer) {
+    *reinterpret_cast<VarlenEntry *>(pr->AccessForceNotNull(varbinary_offset)) =
+        value.size() <= VarlenEntry::InlineThreshold()
+            ? VarlenEntry::CreateInline(reinterpret_cast<const byte *>(value.data()),
+                                        static_cast<uint32_t>(value.size()))
+            : VarlenEntry::Create(reinterpret_cast<const byte *>(value.data()), static_cast<uint32_t>(value.size()),
+                                  false);
+    *reinterpret_cast<int32_t *>(pr->AccessForceNotNull(integer_offset)) = integer;
+    key->SetFromProjectedRow(*pr, metadata, 2);
+  };
+
+  const auto generic_eq128 = std::equal_to<GenericKey<128>>();  // NOLINT transparent functors can't figure out template
+  const auto generic_lt128 = std::less<GenericKey<128>>();      // NOLINT transparent functors can't figure out template
+
+  GenericKey<128> key1, key2;
+  for (uint32_t i = 0; i < values.size(); i++) {
+    for (uint32_t j = 0; j < values.size(); j++) {
+      // A larger second attribute must not be able to make up for a smaller first attribute
+      set_key(&key1, values[i], 1);
+      set_key(&key2, values[j], -1);
+      EXPECT_EQ(generic_lt128(key1, key2), i < j);
+      EXPECT_EQ(generic_lt128(key2, key1), j <= i);
+      EXPECT_FALSE(generic_eq128(key1, key2));
+      EXPECT_EQ(BinaryComparableLess(key1, key2), i < j);
+      EXPECT_EQ(key1.PartialLessThan(key2, &metadata, 1), i <= j);
+    }
+  }
+
+  delete[] pr_buffer;
+}
+
+// NOLINTNEXTLINE
+TEST_F(IndexKeyTests, GenericKeyToProjectedRow) {
+  std::vector<catalog::IndexSchema::Column> key_cols;
+  key_cols.emplace_back("", type::TypeId::VARBINARY, 20, true,
+                        parser::ConstantValueExpression(type::TypeId::VARBINARY));
+  StorageTestUtil::ForceOid(&(key_cols.back()), catalog::indexkeycol_oid_t(0));
+  key_cols.emplace_back("", type::TypeId::INTEGER, true, parser::ConstantValueExpression(type::TypeId::INTEGER));
+  StorageTestUtil::ForceOid(&(key_cols.back()), catalog::indexkeycol_oid_t(1));
+  key_cols.emplace_back("", type::TypeId::REAL, false, parser::ConstantValueExpression(type::TypeId::REAL));
+  StorageTestUtil::ForceOid(&(key_cols.back()), catalog::indexkeycol_oid_t(2));
+  key_cols.emplace_back("", type::TypeId::SMALLINT, false, parser::ConstantValueExpression(type::TypeId::SMALLINT));
+  StorageTestUtil::ForceOid(&(key_cols.back()), catalog::indexkeycol_oid_t(3));
+
+  const IndexMetadata metadata(
+      catalog::IndexSchema(key_cols, storage::index::IndexType::BPLUSTREE, false, false, false, true));
+  const auto &initializer = metadata.GetProjectedRowInitializer();
+  const auto &oid_offset_map = metadata.GetKeyOidToOffsetMap();
+  const uint16_t varbinary_offset = oid_offset_map.at(catalog::indexkeycol_oid_t(0));
+  const uint16_t integer_offset = oid_offset_map.at(catalog::indexkeycol_oid_t(1));
+  const uint16_t real_offset = oid_offset_map.at(catalog::indexkeycol_oid_t(2));
+  const uint16_t smallint_offset = oid_offset_map.at(catalog::indexkeycol_oid_t(3));
+
+  auto *const pr_buffer = common::AllocationUtil::AllocateAligned(initializer.ProjectedRowSize());
+  auto *const pr = initializer.InitializeRow(pr_buffer);
+  auto *const out_buffer = common::AllocationUtil::AllocateAligned(initializer.ProjectedRowSize());
+  auto *const out = initializer.InitializeRow(out_buffer);
+  byte varlen_buffer[sizeof(GenericKey<128>)];
+
+  const std::vector<std::vector<uint8_t>> varbinaries{
+      {}, {0}, {1, 2, 3, 4, 5, 6, 7, 8}, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20}};
+  const std::vector<double> reals{-1.5, -0.0, 0.0, 3.25, std::numeric_limits<double>::max()};
+  const std::vector<int16_t> smallints{std::numeric_limits<int16_t>::min(), -1, 0, 42};
+
+  GenericKey<128> key;
+  for (uint32_t i = 0; i < varbinaries.size(); i++) {
+    const auto &value = varbinaries[i];
+    *reinterpret_cast<VarlenEntry *>(pr->AccessForceNotNull(varbinary_offset)) =
+        value.size() <= VarlenEntry::InlineThreshold()
+            ? VarlenEntry::CreateInline(reinterpret_cast<const byte *>(value.data()),
+                                        static_cast<uint32_t>(value.size()))
+            : VarlenEntry::Create(reinterpret_cast<const byte *>(value.data()), static_cast<uint32_t>(value.size()),
+                                  false);
+    if (i % 2 == 0) {
+      *reinterpret_cast<int32_t *>(pr->AccessForceNotNull(integer_offset)) = static_cast<int32_t>(i) - 2;
+    } else {
+      pr->SetNull(integer_offset);
+    }
+    for (const auto real : reals) {
+      for (const auto smallint : smallints) {
+        *reinterpret_cast<double *>(pr->AccessForceNotNull(real_offset)) = real;
+        *reinterpret_cast<int16_t *>(pr->AccessForceNotNull(smallint_offset)) = smallint;
+        key.SetFromProjectedRow(*pr, metadata, 4);
+        key.ToProjectedRow(metadata, out, varlen_buffer);
+
+        const auto *const varlen = reinterpret_cast<const VarlenEntry *>(out->AccessWithNullCheck(varbinary_offset));
+        ASSERT_NE(varlen, nullptr);
+        EXPECT_EQ(std::vector<uint8_t>(reinterpret_cast<const uint8_t *>(varlen->Content()),
+                                       reinterpret_cast<const uint8_t *>(varlen->Content()) + varlen->Size()),
+                  value);
+        if (i % 2 == 0) {
+          ASSERT_NE(out->AccessWithNullCheck(integer_offset), nullptr);
+          EXPECT_EQ(*reinterpret_cast<const int32_t *>(out->AccessWithNullCheck(integer_offset)),
+                    static_cast<int32_t>(i) - 2);
+        } else {
+          EXPECT_EQ(out->AccessWithNullCheck(integer_offset), nullptr);
+        }
+        EXPECT_EQ(*reinterpret_cast<const double *>(out->AccessWithNullCheck(real_offset)), real);
+        EXPECT_EQ(*reinterpret_cast<const int16_t *>(out->AccessWithNullCheck(smallint_offset)), smallint);
+
+        // The decoded key must build the same key again
+        GenericKey<128> rebuilt_key;
+        rebuilt_key.SetFromProjectedRow(*out, metadata, 4);
+        EXPECT_TRUE(std::equal_to<GenericKey<128>>()(key, rebuilt_key));  // NOLINT
+      }
+    }
+  }
+
+  delete[] pr_buffer;
+  delete[] out_buffer;
+}
+
+// NOLINTNEXTLINE
+TEST_F(IndexKeyTests, CompactIntsKeyToProjectedRow) {
+  std::vector<catalog::IndexSchema::Column> key_cols;
+  const std::vector<type::TypeId> types{type::TypeId::BIGINT, type::TypeId::TINYINT, type::TypeId::INTEGER,
+                                        type::TypeId::SMALLINT};
+  for (uint32_t i = 0; i < types.size(); i++) {
+    key_cols.emplace_back("", types[i], false, parser::ConstantValueExpression(types[i]));
+    StorageTestUtil::ForceOid(&(key_cols.back()), catalog::indexkeycol_oid_t(i));
+  }
+
+  const IndexMetadata metadata(
+      catalog::IndexSchema(key_cols, storage::index::IndexType::BPLUSTREE, false, false, false, true));
+  const auto &initializer = metadata.GetProjectedRowInitializer();
+  const auto &oid_offset_map = metadata.GetKeyOidToOffsetMap();
+
+  auto *const pr_buffer = common::AllocationUtil::AllocateAligned(initializer.ProjectedRowSize());
+  auto *const pr = initializer.InitializeRow(pr_buffer);
+  auto *const out_buffer = common::AllocationUtil::AllocateAligned(initializer.ProjectedRowSize());
+  auto *const out = initializer.InitializeRow(out_buffer);
+
+  std::uniform_int_distribution<int64_t> distribution;
+  for (uint32_t iter = 0; iter < 100; iter++) {
+    const auto value = distribution(generator_);
+    *reinterpret_cast<int64_t *>(pr->AccessForceNotNull(oid_offset_map.at(catalog::indexkeycol_oid_t(0)))) = value;
+    *reinterpret_cast<int8_t *>(pr->AccessForceNotNull(oid_offset_map.at(catalog::indexkeycol_oid_t(1)))) =
+        static_cast<int8_t>(value);
+    *reinterpret_cast<int32_t *>(pr->AccessForceNotNull(oid_offset_map.at(catalog::indexkeycol_oid_t(2)))) =
+        static_cast<int32_t>(value >> 7);
+    *reinterpret_cast<int16_t *>(pr->AccessForceNotNull(oid_offset_map.at(catalog::indexkeycol_oid_t(3)))) =
+        static_cast<int16_t>(value >> 3);
+
+    CompactIntsKey<16> key;
+    key.SetFromProjectedRow(*pr, metadata, 4);
+    key.ToProjectedRow(metadata, out, nullptr);
+    for (const auto &entry : oid_offset_map) {
+      const auto size = storage::AttrSizeBytes(type::TypeUtil::GetTypeSize(types[entry.first.UnderlyingValue()]));
+      EXPECT_EQ(std::memcmp(out->AccessWithNullCheck(entry.second), pr->AccessWithNullCheck(entry.second), size), 0);
+    }
+  }
+
+  delete[] pr_buffer;
+  delete[] out_buffer;
+}
+
 // NOLINTNEXTLINE
 TEST_F(IndexKeyTests, CompactIntsKeyBuilderTest) {
   const uint32_t num_iters = 100;
@@ -1255,6 +1480,51 @@ TEST_F(IndexKeyTests, HashKeyBuilderTest) {
   }
 }
 
+// NOLINTNEXTLINE
+TEST_F(IndexKeyTests, ARTCompactIntsKeyBuilderTest) {
+  const uint32_t num_iters = 100;
+
+  for (uint32_t i = 0; i < num_iters; i++) {
+    auto key_schema = StorageTestUtil::RandomSimpleKeySchema(&generator_, COMPACTINTSKEY_MAX_SIZE);
+
+    key_schema.SetType(storage::index::IndexType::ART);
+
+    IndexBuilder builder;
+    builder.SetKeySchema(key_schema);
+    auto *index = builder.Build();
+    EXPECT_EQ(index->Type(), storage::index::IndexType::ART);
+    EXPECT_EQ(index->KeyKind(), storage::index::IndexKeyKind::COMPACTINTSKEY);
+    BasicOps(index);
+
+    delete index;
+  }
+}
+
+// NOLINTNEXTLINE
+TEST_F(IndexKeyTests, ARTGenericKeyBuilderTest) {
+  const uint32_t num_iters = 100;
+
+  const std::vector<type::TypeId> generic_key_types{
+      type::TypeId::BOOLEAN, type::TypeId::TINYINT,  type::TypeId::SMALLINT,  type::TypeId::INTEGER,
+      type::TypeId::BIGINT,  type::TypeId::REAL,     type::TypeId::TIMESTAMP, type::TypeId::DATE,
+      type::TypeId::VARCHAR, type::TypeId::VARBINARY};
+
+  for (uint32_t i = 0; i < num_iters; i++) {
+    auto key_schema = StorageTestUtil::RandomGenericKeySchema(10, generic_key_types, &generator_);
+
+    key_schema.SetType(storage::index::IndexType::ART);
+
+    IndexBuilder builder;
+    builder.SetKeySchema(key_schema);
+    auto *index = builder.Build();
+    EXPECT_EQ(index->Type(), storage::index::IndexType::ART);
+    EXPECT_EQ(index->KeyKind(), storage::index::IndexKeyKind::GENERICKEY);
+    BasicOps(index);
+
+    delete index;
+  }
+}
+
 /**
  * This test exercises an edge case detected while incorporating the catalog that had a VARCHAR(63) attribute. The
  * IndexBuilder was looking at the user-facing PR size rather than the inlined PR size, so the computation of the key
@@ -1278,4 +1548,64 @@ TEST_F(IndexKeyTests, GenericKeyBuilderVarlenSizeEdgeCaseTest) {
   delete index;
 }
 
+/**
+ * GenericKeys size a varlen without a maximum size, e.g., TEXT, as if it fits inline. Longer values must not write past
+ * the key, so the insert fails with an exception instead and leaves the index untouched.
+ */
+// NOLINTNEXTLINE
+TEST_F(IndexKeyTests, GenericKeyUnboundedVarcharTooLongTest) {
+  auto db_main = DBMain::Builder().SetUseGC(true).Build();
+  auto txn_manager = db_main->GetTransactionLayer()->GetTransactionManager();
+
+  std::vector<catalog::Schema::Column> columns;
+  columns.emplace_back("attribute", type::TypeId::INTEGER, false,
+                       parser::ConstantValueExpression(type::TypeId::INTEGER));
+  catalog::Schema schema{columns};
+  auto *sql_table = new storage::SqlTable(db_main->GetStorageLayer()->GetBlockStore(), schema);
+  const auto &tuple_initializer = sql_table->InitializerForProjectedRow({catalog::col_oid_t(0)});
+
+  const std::string short_value = "short";
+  const std::string long_value(200, 'x');
+
+  for (const auto index_type : {storage::index::IndexType::BPLUSTREE, storage::index::IndexType::BWTREE,
+                                storage::index::IndexType::HASHMAP, storage::index::IndexType::ART}) {
+    std::vector<catalog::IndexSchema::Column> key_cols;
+    key_cols.emplace_back("", type::TypeId::VARCHAR, -1, false, parser::ConstantValueExpression(type::TypeId::VARCHAR));
+    StorageTestUtil::ForceOid(&(key_cols.back()), catalog::indexkeycol_oid_t(0));
+    const auto key_schema = catalog::IndexSchema(key_cols, index_type, false, false, false, true);
+
+    IndexBuilder builder;
+    builder.SetKeySchema(key_schema);
+    auto *index = builder.Build();
+    EXPECT_EQ(index->KeyKind(), storage::index::IndexKeyKind::GENERICKEY);
+
+    auto *const txn = txn_manager->BeginTransaction();
+    auto *const insert_redo =
+        txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer);
+    *reinterpret_cast<int32_t *>(insert_redo->Delta()->AccessForceNotNull(0)) = 15721;
+    const auto tuple_slot = sql_table->Insert(common::ManagedPointer(txn), insert_redo);
+
+    const auto &initializer = index->GetProjectedRowInitializer();
+    auto *const key_buffer = common::AllocationUtil::AllocateAligned(initializer.ProjectedRowSize());
+    auto *const key = initializer.InitializeRow(key_buffer);
+    auto *const varlen = reinterpret_cast<VarlenEntry *>(key->AccessForceNotNull(0));
+
+    *varlen = VarlenEntry::Create(reinterpret_cast<const byte *>(short_value.data()),
+                                  static_cast<uint32_t>(short_value.size()), false);
+    EXPECT_TRUE(index->Insert(common::ManagedPointer(txn), *key, tuple_slot));
+
+    *varlen = VarlenEntry::Create(reinterpret_cast<const byte *>(long_value.data()),
+                                  static_cast<uint32_t>(long_value.size()), false);
+    EXPECT_THROW(index->Insert(common::ManagedPointer(txn), *key, tuple_slot), ExecutionException);
+    EXPECT_EQ(index->GetSize(), 1);
+
+    txn_manager->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+    delete[] key_buffer;
+    delete index;
+  }
+
+  // Clean up
+  db_main->GetTransactionLayer()->GetDeferredActionManager()->RegisterDeferredAction([=]() { delete sql_table; });
+}
+
 }  // namespace noisepage::storage::index
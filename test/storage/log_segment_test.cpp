@@ -0,0 +1,102 @@
+#include "storage/write_ahead_log/log_segment.h"
+
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "test_util/test_harness.h"
+
+#define LOG_SEGMENT_TEST_LOG_FILE_NAME "./test_log_segment_test.log"
+
+namespace noisepage::storage {
+
+class LogSegmentTests : public TerrierTest {
+ protected:
+  void SetUp() override { RemoveSegments(); }
+
+  void TearDown() override { RemoveSegments(); }
+
+  static void RemoveSegments() {
+    for (const auto &segment : LogSegmentManager::ListSegments(LOG_SEGMENT_TEST_LOG_FILE_NAME)) {
+      unlink(segment.path_.c_str());
+    }
+  }
+
+  /** Append size bytes of filler to the segments through the given buffer. */
+  static void AppendFiller(LogSegmentManager *segments, BufferedLogWriter *buffer, uint32_t size,
+                           transaction::timestamp_t newest_txn, bool ends_on_record_boundary,
+                           const std::vector<CommitCallback> &commits = {}) {
+    std::vector<byte> filler(size, static_cast<byte>(0xAB));
+    buffer->BufferWrite(filler.data(), size);
+    buffer->SetBatchMetadata(newest_txn, ends_on_record_boundary);
+    EXPECT_EQ(size, segments->Append(buffer, commits));
+  }
+};
+
+// Segments are only rotated at record boundaries, and their headers record the first commit in the segment.
+// NOLINTNEXTLINE
+TEST_F(LogSegmentTests, RotateAtRecordBoundaryTest) {
+  LogSegmentManager segments(LOG_SEGMENT_TEST_LOG_FILE_NAME, 1024);
+  BufferedLogWriter buffer;
+  segments.Open();
+
+  const std::vector<CommitCallback> commits = {
+      {nullptr, nullptr, transaction::timestamp_t(1), transaction::timestamp_t(2), true},
+      {nullptr, nullptr, transaction::timestamp_t(3), transaction::timestamp_t(5), false}};
+  AppendFiller(&segments, &buffer, 512, transaction::timestamp_t(3), true, commits);
+  EXPECT_FALSE(segments.ShouldRotate(buffer));
+  // The segment is full, but the last record continues in the next buffer.
+  AppendFiller(&segments, &buffer, 1024, transaction::timestamp_t(7), false);
+  EXPECT_FALSE(segments.ShouldRotate(buffer));
+  AppendFiller(&segments, &buffer, 16, transaction::timestamp_t(7), true);
+  EXPECT_TRUE(segments.ShouldRotate(buffer));
+  segments.Rotate();
+  AppendFiller(&segments, &buffer, 16, transaction::timestamp_t(9), true);
+  segments.Close();
+
+  const auto on_disk = LogSegmentManager::ListSegments(LOG_SEGMENT_TEST_LOG_FILE_NAME);
+  ASSERT_EQ(2, on_disk.size());
+  EXPECT_EQ(1, on_disk[0].segment_id_);
+  EXPECT_EQ(sizeof(LogSegmentHeader) + 512 + 1024 + 16, on_disk[0].size_);
+  // Read-only commits are not serialized, so they do not count as the first commit.
+  EXPECT_EQ(transaction::timestamp_t(5), on_disk[0].first_commit_time_);
+  EXPECT_EQ(transaction::timestamp_t(7), on_disk[0].newest_txn_begin_);
+  EXPECT_EQ(2, on_disk[1].segment_id_);
+  EXPECT_EQ(transaction::INVALID_TXN_TIMESTAMP, on_disk[1].first_commit_time_);
+  EXPECT_EQ(transaction::timestamp_t(9), on_disk[1].newest_txn_begin_);
+
+  // Reopening the log never appends to existing segments.
+  segments.Open();
+  EXPECT_EQ(3, segments.GetSegments().back().segment_id_);
+  segments.Close();
+}
+
+// Only closed segments that are covered by the given timestamp are deleted, and log providers skip covered segments.
+// NOLINTNEXTLINE
+TEST_F(LogSegmentTests, RemoveCoveredSegmentsTest) {
+  LogSegmentManager segments(LOG_SEGMENT_TEST_LOG_FILE_NAME, 1024);
+  BufferedLogWriter buffer;
+  segments.Open();
+  for (int64_t i = 1; i <= 3; i++) {
+    AppendFiller(&segments, &buffer, 2048, transaction::timestamp_t(10 * i), true);
+    segments.Rotate();
+  }
+  AppendFiller(&segments, &buffer, 16, transaction::timestamp_t(40), true);
+  ASSERT_EQ(4, segments.GetSegments().size());
+
+  EXPECT_EQ(1, LogSegmentManager::FirstSegmentToReplay(segments.GetSegments(), transaction::timestamp_t(15)));
+  EXPECT_EQ(0, segments.RemoveCoveredSegments(transaction::timestamp_t(5)));
+  EXPECT_EQ(2, segments.RemoveCoveredSegments(transaction::timestamp_t(25)));
+  // The open segment is never deleted, even if it is covered.
+  EXPECT_EQ(1, segments.RemoveCoveredSegments(transaction::timestamp_t(100)));
+
+  const auto remaining = segments.GetSegments();
+  ASSERT_EQ(1, remaining.size());
+  EXPECT_EQ(4, remaining[0].segment_id_);
+  segments.Close();
+  EXPECT_EQ(1, LogSegmentManager::ListSegments(LOG_SEGMENT_TEST_LOG_FILE_NAME).size());
+}
+
+}  // namespace noisepage::storage
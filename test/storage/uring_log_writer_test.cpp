@@ -0,0 +1,101 @@
+#include "storage/write_ahead_log/uring_log_writer.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "test_util/test_harness.h"
+
+#define URING_LOG_WRITER_TEST_LOG_FILE_NAME "./test_uring_log_writer_test.log"
+
+namespace noisepage::storage {
+
+class UringLogWriterTests : public TerrierTest {
+ protected:
+  void SetUp() override { unlink(URING_LOG_WRITER_TEST_LOG_FILE_NAME); }
+
+  void TearDown() override { unlink(URING_LOG_WRITER_TEST_LOG_FILE_NAME); }
+
+  /** Append size bytes of a deterministic pattern, starting at the given position of the pattern. */
+  static void AppendPattern(UringLogWriter *writer, BufferedLogWriter *buffer, uint64_t start, uint32_t size) {
+    std::vector<uint8_t> bytes(size);
+    for (uint32_t i = 0; i < size; i++) bytes[i] = Pattern(start + i);
+    for (uint32_t appended = 0; appended < size;) {
+      const auto buffered = buffer->BufferWrite(bytes.data() + appended, size - appended);
+      EXPECT_EQ(buffered, writer->Append(buffer));
+      appended += buffered;
+    }
+  }
+
+  static uint8_t Pattern(const uint64_t pos) { return static_cast<uint8_t>(pos * 31 + pos / 251); }
+
+  /** Check that the log file holds exactly size bytes of the pattern. */
+  static void CheckLogFile(const uint64_t size) {
+    BufferedLogReader in(URING_LOG_WRITER_TEST_LOG_FILE_NAME);
+    for (uint64_t i = 0; i < size; i++) {
+      uint8_t value;
+      ASSERT_TRUE(in.Read(&value, sizeof(value)));
+      ASSERT_EQ(Pattern(i), value) << "at offset " << i;
+    }
+    EXPECT_FALSE(in.HasMore());
+  }
+
+  static uint64_t FileSize() {
+    struct stat file_stat;
+    stat(URING_LOG_WRITER_TEST_LOG_FILE_NAME, &file_stat);
+    return static_cast<uint64_t>(file_stat.st_size);
+  }
+};
+
+// Writes that span several staging chunks end up in the log file in order, with and without O_DIRECT.
+// NOLINTNEXTLINE
+TEST_F(UringLogWriterTests, AppendAcrossChunksTest) {
+  for (const bool direct_io : {false, true}) {
+    unlink(URING_LOG_WRITER_TEST_LOG_FILE_NAME);
+    auto writer = UringLogWriter::Open(URING_LOG_WRITER_TEST_LOG_FILE_NAME, direct_io);
+    // io_uring is not available in this build or on this kernel, and the log manager falls back to POSIX writes.
+    if (writer == nullptr) return;
+
+    BufferedLogWriter buffer;
+    uint64_t written = 0;
+    uint64_t last_sync = 0;
+    // More than every staging chunk, so that chunks are reused.
+    while (written < 2 * UringLogWriter::NUM_STAGING_CHUNKS * UringLogWriter::STAGING_CHUNK_SIZE) {
+      const uint32_t size = 1 + written % common::Constants::LOG_BUFFER_SIZE;
+      AppendPattern(writer.get(), &buffer, written, size);
+      written += size;
+      if (written % 7 == 0) last_sync = writer->Persist();
+    }
+    EXPECT_GE(writer->PersistedUpTo(true), last_sync);
+    writer->Close();
+    CheckLogFile(written);
+  }
+}
+
+// With O_DIRECT, the tail of the log is padded to a block boundary until the writer is closed, and a reopened writer
+// continues after the last record instead of after the padding.
+// NOLINTNEXTLINE
+TEST_F(UringLogWriterTests, DirectIoPaddingTest) {
+  auto writer = UringLogWriter::Open(URING_LOG_WRITER_TEST_LOG_FILE_NAME, true);
+  if (writer == nullptr) return;
+
+  BufferedLogWriter buffer;
+  AppendPattern(writer.get(), &buffer, 0, 1000);
+  const auto sync = writer->Persist();
+  EXPECT_EQ(sync, writer->PersistedUpTo(true));
+  if (writer->IsDirectIo()) {
+    EXPECT_EQ(UringLogWriter::DIRECT_IO_ALIGNMENT, FileSize());
+  }
+  writer->Close();
+  EXPECT_EQ(1000, FileSize());
+
+  writer = UringLogWriter::Open(URING_LOG_WRITER_TEST_LOG_FILE_NAME, true);
+  AppendPattern(writer.get(), &buffer, 1000, 5000);
+  writer->Close();
+  CheckLogFile(6000);
+}
+
+}  // namespace noisepage::storage
@@ -16,7 +16,7 @@ namespace noisepage::trafficcop {
 
 class TrafficCopTests : public TerrierTest {
  protected:
-  void StartServer(const bool wal_async_commit_enable) {
+  void StartServer(const bool wal_async_commit_enable, const bool park_connection_on_commit = true) {
     std::unordered_map<settings::Param, settings::ParamInfo> param_map;
     noisepage::settings::SettingsManager::ConstructParamMap(param_map);
 
@@ -32,6 +32,7 @@ class TrafficCopTests : public TerrierTest {
                    .SetUseNetwork(true)
                    .SetUseExecution(true)
                    .SetWalAsyncCommit(wal_async_commit_enable)
+                   .SetParkConnectionOnCommit(park_connection_on_commit)
                    .Build();
 
     db_main_->GetNetworkLayer()->GetServer()->RunServer();
@@ -144,6 +145,48 @@ TEST_F(TrafficCopTests, BasicTest) {
   }
 }
 
+/**
+ * Recovery and replication can't evaluate index predicates or keys, so partial and expression indexes are refused while
+ * logging is enabled
+ */
+// NOLINTNEXTLINE
+TEST_F(TrafficCopTests, PartialIndexWithLoggingTest) {
+  StartServer(false);
+  pqxx::connection connection(fmt::format("host=127.0.0.1 port={0} user={1} sslmode=disable application_name=psql",
+                                          port_, catalog::DEFAULT_DATABASE));
+  {
+    pqxx::work txn1(connection);
+    txn1.exec("CREATE TABLE TableA (id INT, data INT);");
+    txn1.commit();
+  }
+  try {
+    pqxx::work txn2(connection);
+    txn2.exec("CREATE INDEX partial_idx ON TableA (id) WHERE data > 10;");
+    txn2.commit();
+    EXPECT_TRUE(false);
+  } catch (const std::exception &e) {
+    std::string error(e.what());
+    std::string expect("ERROR:  partial indexes are not supported when write-ahead logging is enabled\n");
+    EXPECT_EQ(error, expect);
+  }
+  try {
+    pqxx::work txn2(connection);
+    txn2.exec("CREATE INDEX expr_idx ON TableA ((id + data));");
+    txn2.commit();
+    EXPECT_TRUE(false);
+  } catch (const std::exception &e) {
+    std::string error(e.what());
+    std::string expect("ERROR:  expression indexes are not supported when write-ahead logging is enabled\n");
+    EXPECT_EQ(error, expect);
+  }
+  {
+    // A full index is still fine
+    pqxx::work txn3(connection);
+    txn3.exec("CREATE INDEX full_idx ON TableA (id);");
+    txn3.commit();
+  }
+}
+
 /**
  * Test whether a temporary namespace is created for a connection to the database
  */
@@ -210,4 +253,39 @@ TEST_F(TrafficCopTests, AsyncCommitTest) {
   }
 }
 
+// Commits over several connections, both with connections that are parked until their commits are durable, and with
+// network threads that block on the commits.
+// NOLINTNEXTLINE
+TEST_F(TrafficCopTests, ParkedCommitTest) {
+  for (const bool park_connection_on_commit : {true, false}) {
+    StartServer(false, park_connection_on_commit);
+    try {
+      pqxx::connection connection1(fmt::format("host=127.0.0.1 port={0} user={1} sslmode=disable application_name=psql",
+                                               port_, catalog::DEFAULT_DATABASE));
+      pqxx::connection connection2(fmt::format("host=127.0.0.1 port={0} user={1} sslmode=disable application_name=psql",
+                                               port_, catalog::DEFAULT_DATABASE));
+
+      pqxx::nontransaction autocommit(connection1);
+      autocommit.exec("CREATE TABLE TableA (id INT PRIMARY KEY, data TEXT);");
+      autocommit.exec("INSERT INTO TableA VALUES (1, 'abc');");
+      autocommit.commit();
+
+      for (int i = 2; i <= 10; i++) {
+        pqxx::work txn1(connection1);
+        txn1.exec(fmt::format("INSERT INTO TableA VALUES ({0}, 'abc');", i));
+        txn1.commit();
+
+        // Once the commit has been acknowledged, every other connection sees it.
+        pqxx::work txn2(connection2);
+        pqxx::result r = txn2.exec("SELECT * FROM TableA");
+        EXPECT_EQ(r.size(), i);
+        txn2.commit();
+      }
+    } catch (const std::exception &e) {
+      EXPECT_TRUE(false) << e.what();
+    }
+    db_main_.reset();
+  }
+}
+
 }  // namespace noisepage::trafficcop
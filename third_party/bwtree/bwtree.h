@@ -2,6 +2,7 @@
 
 // 2020-08-27: modified by Wan to track index_size, exposed via GetSize()
 // 2020-10-05: modified by Wan to disable ASAN per function, because apparently gcc refuses to add fsanitize-blacklist.
+// 2026-10-18: added BulkLoad() to build the tree bottom-up from sorted key-value pairs.
 
 // As we have learned from recent events, if we do not test for something, then it does not exist.
 #define NO_ASAN __attribute__((no_sanitize("address")))
@@ -6552,6 +6553,108 @@ class BwTree : public BwTreeBase {
     return ret;
   }
 
+  /*
+   * BulkLoadNodeCount() - Returns the number of nodes to build on a level
+   *
+   * Nodes get about fill_factor * max_node_size elements, but never more
+   * than max_node_size
+   */
+  NO_ASAN static size_t BulkLoadNodeCount(size_t num_elements, int max_node_size, double fill_factor) {
+    const auto target_size =
+        static_cast<size_t>(std::max(1.0, static_cast<double>(max_node_size) * std::clamp(fill_factor, 0.5, 1.0)));
+    const auto max_size = static_cast<size_t>(max_node_size);
+    return std::max({num_elements / target_size, (num_elements + max_size - 1) / max_size, static_cast<size_t>(1)});
+  }
+
+  /*
+   * BulkLoad() - Build the tree bottom-up from key-value pairs sorted by key
+   *
+   * Leaves are filled from left to right with about fill_factor times
+   * LEAF_NODE_SIZE_UPPER_THRESHOLD pairs, and every level of inner nodes is
+   * built from the low keys of the level below it, until a single root is
+   * left. This replaces the initial node layout, so the root and the first
+   * leaf keep their NodeIDs.
+   *
+   * Returns false without loading anything if the tree is not empty
+   *
+   * NOTE: This function must not be called concurrently with any other
+   * operation on the tree
+   */
+  NO_ASAN bool BulkLoad(const std::vector<KeyValuePair> &sorted, double fill_factor) {
+    // An empty tree still has its initial layout, i.e. no node has been split
+    // and the first leaf has no delta chain
+    const BaseNode *first_leaf_p = GetNode(first_leaf_id);
+    if (next_unused_node_id.load() != first_leaf_id + 1 || root_id.load() != 1UL ||
+        first_leaf_p->GetType() != NodeType::LeafType ||
+        static_cast<const LeafNode *>(first_leaf_p)->GetSize() != 0) {
+      return false;
+    }
+    if (sorted.empty()) return true;
+
+    // This also frees the first leaf, which is the only child of the root
+    FreeNodeByNodeID(root_id.load());
+
+    // Split the pairs into leaves, moving the boundaries forward such that all
+    // values of a key are in the same leaf, since a search only visits the
+    // leaf whose key range covers the key
+    const size_t num_leaves = BulkLoadNodeCount(sorted.size(), LEAF_NODE_SIZE_UPPER_THRESHOLD, fill_factor);
+    std::vector<size_t> leaf_begins;
+    for (size_t i = 0; i < num_leaves; i++) {
+      size_t begin = sorted.size() * i / num_leaves;
+      while (begin > 0 && begin < sorted.size() && KeyCmpEqual(sorted[begin - 1].first, sorted[begin].first)) {
+        begin++;
+      }
+      if (begin < sorted.size() && (leaf_begins.empty() || begin > leaf_begins.back())) leaf_begins.push_back(begin);
+    }
+
+    std::vector<NodeID> leaf_ids{first_leaf_id};
+    while (leaf_ids.size() < leaf_begins.size()) leaf_ids.push_back(GetNextNodeID());
+    leaf_begins.push_back(sorted.size());
+
+    // The low key and NodeID of every node on the level that was built last.
+    // Like in the initial layout, the leftmost nodes have an empty low key.
+    std::vector<KeyNodeIDPair> level;
+    for (size_t i = 0; i < leaf_ids.size(); i++) {
+      const size_t begin = leaf_begins[i];
+      const size_t end = leaf_begins[i + 1];
+      const auto size = static_cast<int>(end - begin);
+      const KeyNodeIDPair low_key =
+          i == 0 ? std::make_pair(KeyType{}, INVALID_NODE_ID) : std::make_pair(sorted[begin].first, ~INVALID_NODE_ID);
+      const KeyNodeIDPair high_key = i + 1 < leaf_ids.size() ? std::make_pair(sorted[end].first, leaf_ids[i + 1])
+                                                             : std::make_pair(KeyType{}, INVALID_NODE_ID);
+      auto *leaf_node_p = reinterpret_cast<LeafNode *>(
+          ElasticNode<KeyValuePair>::Get(size, NodeType::LeafType, 0, size, low_key, high_key));
+      leaf_node_p->PushBack(sorted.data() + begin, sorted.data() + end);
+      InstallNewNode(leaf_ids[i], leaf_node_p);
+      level.emplace_back(i == 0 ? KeyType{} : sorted[begin].first, leaf_ids[i]);
+    }
+
+    // The root is always an inner node, even if there is only one leaf
+    do {
+      const size_t num_nodes = BulkLoadNodeCount(level.size(), INNER_NODE_SIZE_UPPER_THRESHOLD, fill_factor);
+      std::vector<NodeID> ids;
+      for (size_t i = 0; i < num_nodes; i++) ids.push_back(num_nodes == 1 ? root_id.load() : GetNextNodeID());
+
+      std::vector<KeyNodeIDPair> parents;
+      for (size_t i = 0; i < num_nodes; i++) {
+        const size_t begin = level.size() * i / num_nodes;
+        const size_t end = level.size() * (i + 1) / num_nodes;
+        const auto size = static_cast<int>(end - begin);
+        const KeyNodeIDPair high_key = i + 1 < num_nodes ? std::make_pair(level[end].first, ids[i + 1])
+                                                         : std::make_pair(KeyType{}, INVALID_NODE_ID);
+        auto *inner_node_p = reinterpret_cast<InnerNode *>(
+            ElasticNode<KeyNodeIDPair>::Get(size, NodeType::InnerType, 0, size, level[begin], high_key));
+        inner_node_p->PushBack(level.data() + begin, level.data() + end);
+        InstallNewNode(ids[i], inner_node_p);
+        parents.emplace_back(level[begin].first, ids[i]);
+      }
+      level = std::move(parents);
+    } while (level.size() > 1);
+
+    index_size.store(sorted.size());
+    return true;
+  }
+
   /*
    * Insert() - Insert a key-value pair
    *